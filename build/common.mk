@@ -83,6 +83,9 @@ CSRCS2 = $(filter-out $(SRC)/libs/Network/%,$(CSRCS1))
 DEFINES += -DNONETWORK
 else
 CSRCS2 = $(CSRCS1)
+ifeq "$(NETWORK_FULL_MTU)" "1"
+DEFINES += -DNETWORK_FULL_MTU
+endif
 endif
 
 # do not compile the src/testframework as that can only be done with rake
@@ -23,6 +23,9 @@
 #include "platform_memory.h"
 
 unsigned int g_maximumHeapAddress;
+/* Bytes in allocated heap chunks now and the most there have been, kept by the malloc wraps for the mem command. */
+unsigned int g_heapInUse;
+unsigned int g_heapPeak;
 
 static void fillUnusedRAM(void);
 static void configureStackSizeLimit(unsigned int stackSizeLimit);
@@ -359,11 +362,32 @@ static void breakOnHeapOpFromInterruptHandler(void)
         __debugbreak();
 }
 
+/* newlib-nano keeps the chunk size in the word before the returned pointer, unless that is the negative offset back
+   to it over the padding added to align the pointer. */
+static unsigned int sizeOfNanoChunk(void *pv)
+{
+    int *pSize = (int *)pv - 1;
+    if (*pSize < 0)
+        pSize = (int *)(void *)((char *)pSize + *pSize);
+    return *pSize;
+}
+
+static void countAllocation(void *pv)
+{
+    if (!pv)
+        return;
+    g_heapInUse += sizeOfNanoChunk(pv);
+    if (g_heapInUse > g_heapPeak)
+        g_heapPeak = g_heapInUse;
+}
+
 extern "C" void *__real_malloc(size_t size);
 extern "C" void *__wrap_malloc(size_t size)
 {
     breakOnHeapOpFromInterruptHandler();
-    return __real_malloc(size);
+    void *p = __real_malloc(size);
+    countAllocation(p);
+    return p;
 }
 
 
@@ -371,7 +395,12 @@ extern "C" void *__real_realloc(void *ptr, size_t size);
 extern "C" void *__wrap_realloc(void *ptr, size_t size)
 {
     breakOnHeapOpFromInterruptHandler();
-    return __real_realloc(ptr, size);
+    unsigned int oldSize = ptr ? sizeOfNanoChunk(ptr) : 0;
+    void *p = __real_realloc(ptr, size);
+    if (p || size == 0)
+        g_heapInUse -= oldSize;
+    countAllocation(p);
+    return p;
 }
 
 
@@ -379,6 +408,8 @@ extern "C" void __real_free(void *ptr);
 extern "C" void __wrap_free(void *ptr)
 {
     breakOnHeapOpFromInterruptHandler();
+    if (ptr)
+        g_heapInUse -= sizeOfNanoChunk(ptr);
     __real_free(ptr);
 }
 
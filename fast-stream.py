@@ -13,6 +13,8 @@ import threading
 import time
 import signal
 import sys
+import re
+import struct
  
 errorflg= False
 intrflg= False
@@ -32,9 +34,16 @@ parser.add_argument('device',
         help='Smoothie Serial Device')
 parser.add_argument('-q','--quiet',action='store_true', default=False,
         help='suppress output text')
+parser.add_argument('-b','--binary',action='store_true', default=False,
+        help='send plain G0/G1 lines as binary frames')
+parser.add_argument('-p','--planned',action='store_true', default=False,
+        help='the file is a plan made by motionsim -p, send its blocks to be run as they are')
 args = parser.parse_args()
 
 f = args.gcode_file
+if args.planned :
+    f.close()
+    f = open(f.name, 'rb')
 verbose = not args.quiet
 
 # Stream g-code to Smoothie
@@ -49,6 +58,51 @@ print("Streaming " + args.gcode_file.name + " to " + args.device)
 
 okcnt= 0
 
+# binary frames: sync(0xA5) seq opcode mask value... crc16, see USBSerial.h
+BINARY_LETTERS= 'XYZEABFS'
+move_re= re.compile(r'^G0?([01])((?:\s*[XYZEABFS][-+]?(?:\d+\.?\d*|\.\d+))+)\s*$')
+word_re= re.compile(r'([XYZEABFS])([-+]?(?:\d+\.?\d*|\.\d+))')
+
+def crc16(data):
+    crc= 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for i in range(8):
+            crc= ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+def encode_binary(line, seq):
+    """returns the frame for a plain G0/G1 line, or None if it has to be sent as text"""
+    m= move_re.match(line)
+    if m is None :
+        return None
+    values= {}
+    for letter, value in word_re.findall(m.group(2)):
+        if letter in values :
+            return None
+        values[letter]= float(value)
+    mask= 0
+    payload= bytearray()
+    for i, letter in enumerate(BINARY_LETTERS):
+        if letter in values :
+            mask |= 1 << i
+            payload += bytearray(struct.pack('<f', values[letter]))
+    body= bytearray([seq, int(m.group(1)), mask]) + payload
+    crc= crc16(body)
+    return bytearray([0xA5]) + body + bytearray([crc & 0xFF, crc >> 8])
+
+# host planning frames, see USBSerial.h, a block has this much before the steps
+PLANNED_SIZE= 3 * 4 + 7 * 4 + 1
+
+def planned_frames(data):
+    """the frames of a motionsim -p plan without their sync and crc, they are numbered again as they are sent"""
+    i= 0
+    while i + 4 <= len(data) and data[i] == 0xA5 :
+        n= 3 + (PLANNED_SIZE if data[i + 2] == 2 else 0) + 4 * bin(data[i + 3]).count('1')
+        yield data[i + 1:i + 1 + n]
+        i += 1 + n + 2
+
 def read_thread():
     """thread worker function"""
     global okcnt, errorflg
@@ -58,7 +112,7 @@ def read_thread():
         n= rep.count("ok")
         if n == 0 :
             print("Incoming: " + rep)
-            if "error" in rep or "!!" in rep or "ALARM" in rep or "ERROR" in rep:
+            if "error" in rep or "!!" in rep or "ALARM" in rep or "ERROR" in rep or rep.startswith("rs b"):
                 errorflg= True
                 break
         else :
@@ -73,15 +127,30 @@ t.daemon = True
 t.start()
 
 linecnt= 0
+seq= 0
 try:
-    for line in f:
+    for body in (planned_frames(bytearray(f.read())) if args.planned else []):
+        if errorflg :
+            break
+        body[0]= seq
+        crc= crc16(body)
+        s.write(bytearray([0xA5]) + body + bytearray([crc & 0xFF, crc >> 8]))
+        seq= (seq + 1) & 0xFF
+        linecnt+=1
+
+    for line in ([] if args.planned else f):
         if errorflg :
             break
         # strip comments
         if line.startswith(';') :
             continue
         l= line.strip()
-        s.write(l + '\n')
+        frame= encode_binary(l, seq) if args.binary else None
+        if frame is not None :
+            s.write(frame)
+            seq= (seq + 1) & 0xFF
+        else :
+            s.write(l + '\n')
         linecnt+=1
         if verbose: print("SND " + str(linecnt) + ": " + line.strip() + " - " + str(okcnt))
         
@@ -1,6 +1,6 @@
 #!/usr/bin/env python
 """\
-Upload a file to Smoothie over the network
+Upload a file to Smoothie over the network, or with -s over a USB serial port using the binary upload
 """
 
 from __future__ import print_function
@@ -8,12 +8,16 @@ import sys
 import argparse
 import socket
 import os
+import struct
+import zlib
 # Define command line argument interface
-parser = argparse.ArgumentParser(description='Upload a file to Smoothie over network.')
-parser.add_argument('file', type=argparse.FileType('r'),
+parser = argparse.ArgumentParser(description='Upload a file to Smoothie over network or USB serial.')
+parser.add_argument('file', type=argparse.FileType('rb'),
         help='filename to be uploaded')
 parser.add_argument('ipaddr',
-        help='Smoothie IP address')
+        help='Smoothie IP address, or serial device with -s')
+parser.add_argument('-s','--serial',action='store_true',
+        help='upload over a USB serial port with upload -b')
 parser.add_argument('-v','--verbose',action='store_true',
         help='Show data being uploaded')
 parser.add_argument('-o','--output',
@@ -33,6 +37,57 @@ filesize= os.path.getsize(args.file.name)
 
 if not args.quiet : print("Uploading " + args.file.name + " to " + args.ipaddr + " as " + output + " size: " + str(filesize) )
 
+def crc32(data, crc= 0):
+    return zlib.crc32(data, crc) & 0xFFFFFFFF
+
+def serial_upload():
+    """frames of a 2 byte length, the data and its crc32 with up to window frames sent ahead of the replies"""
+    import serial
+    s= serial.Serial(args.ipaddr, 115200, timeout= 10)
+    s.flushInput()
+    s.write(("upload -b " + str(filesize) + " /sd/" + output + "\n").encode())
+    ln= s.readline().decode().strip()
+    if not ln.startswith("ready") :
+        print("Failed to start upload: " + ln)
+        sys.exit(1)
+    chunk, window= [int(x) for x in ln.split()[1:3]]
+    if verbose: print("RSP: " + ln)
+
+    sent= acked= cnt= 0
+    crc= 0
+    while True:
+        # keep window frames in flight so the next is arriving while the last is written
+        while sent - acked < window :
+            data= f.read(chunk)
+            if not data :
+                break
+            s.write(struct.pack('<H', len(data)) + data + struct.pack('<I', crc32(data)))
+            crc= crc32(data, crc)
+            sent += 1
+            cnt += len(data)
+        if acked == sent :
+            break
+        ln= s.readline().decode().strip()
+        if not ln.startswith("ok") :
+            print("Failed: " + ln)
+            sys.exit(1)
+        acked += 1
+        if verbose : print("RSP: " + ln)
+        elif not args.quiet : print(str(cnt) + "/" + str(filesize) + "\r", end='')
+
+    ln= s.readline().decode().strip()
+    if not ln.startswith("uploaded") or int(ln.split()[-1], 16) != crc :
+        print("Failed to save file: " + ln)
+        sys.exit(1)
+    if verbose: print("RSP: " + ln)
+    s.close()
+
+if args.serial :
+    serial_upload()
+    f.close()
+    if not args.quiet : print("Upload complete")
+    sys.exit(0)
+
 # make connection to sftp server
 s =  socket.socket(socket.AF_INET, socket.SOCK_STREAM)
 s.settimeout(4.0)
@@ -70,23 +125,27 @@ if not ln.startswith("+") :
 if verbose: print("RSP: " + ln.strip())
 
 cnt= 0
+crc= 0
 # now send file
-for line in f:
-    tn.write(line)
-    if verbose :
-        print("SND: " + line.strip())
-    elif not args.quiet :
-        cnt += len(line)
-        print(str(cnt) + "/" + str(filesize) + "\r", end='')
-
-
-tn.flush()
+while True:
+    data= f.read(4096)
+    if not data :
+        break
+    s.sendall(data)
+    crc= crc32(data, crc)
+    cnt += len(data)
+    if not args.quiet : print(str(cnt) + "/" + str(filesize) + "\r", end='')
 
 ln= tn.readline()
 if not ln.startswith("+") :
     print("Failed to save file: " + ln)
     sys.exit();
 
+# newer firmware reports the crc32 of what it saved
+if "crc32" in ln and int(ln.split()[-1], 16) != crc :
+    print("Saved file is corrupt: " + ln)
+    sys.exit();
+
 if verbose: print("RSP: " + ln.strip())
 
 # exit
@@ -10,8 +10,7 @@
 #include "libs/Kernel.h"
 #include "libs/Pin.h"
 #include "libs/ADC/adc.h"
-#include "libs/Pin.h"
-#include "libs/Median.h"
+#include "platform_memory.h"
 
 #include <cstring>
 #include <algorithm>
@@ -21,6 +20,10 @@
 // This is an interface to the mbed.org ADC library you can find in libs/ADC/adc.h
 // TODO : Having the same name is confusing, should change that
 
+// channel 6, just above the uart rx dma in priority, a conversion result is only needed every ms or so
+#define ADC_DMA_CHANNEL LPC_GPDMACH6
+#define ADC_DMA_REQUEST 4
+
 Adc *Adc::instance;
 
 static void sample_isr(int chan, uint32_t value)
@@ -28,9 +31,18 @@ static void sample_isr(int chan, uint32_t value)
     Adc::instance->new_sample(chan, value);
 }
 
+static void dma_isr()
+{
+    Adc::instance->dma_done();
+}
+
 Adc::Adc()
 {
     instance = this;
+    dma = false;
+    dma_buf = nullptr;
+    dma_lli = nullptr;
+    dma_half = 0;
     // ADC sample rate need to be fast enough to be able to read the enabled channels within the thermistor poll time
     // even though ther maybe 32 samples we only need one new one within the polling time
     const uint32_t sample_rate= 1000; // 1KHz sample rate
@@ -57,68 +69,116 @@ void Adc::enable_pin(Pin *pin)
 {
     PinName pin_name = this->_pin_to_pinname(pin);
     int channel = adc->_pin_to_channel(pin_name);
-    memset(sample_buffers[channel], 0, sizeof(sample_buffers[0]));
+    memset(&filters[channel], 0, sizeof(filters[0]));
 
     this->adc->burst(1);
     this->adc->setup(pin_name, 1);
+    // with dma the channel interrupt enable is what raises the dma request, so it is still needed
     this->adc->interrupt_state(pin_name, 1);
+    if(dma) NVIC_DisableIRQ(ADC_IRQn);
+}
+
+bool Adc::enable_dma()
+{
+    // the dma can not reach the cpu local ram so both go in AHB ram
+    dma_buf = (uint32_t *)AHB0.alloc(2 * dma_half_size * sizeof(uint32_t));
+    dma_lli = (uint32_t *)AHB0.alloc(8 * sizeof(uint32_t));
+    if(dma_buf == nullptr || dma_lli == nullptr) {
+        if(dma_buf != nullptr) AHB0.dealloc(dma_buf);
+        if(dma_lli != nullptr) AHB0.dealloc(dma_lli);
+        dma_buf = dma_lli = nullptr;
+        return false;
+    }
+    memset(dma_buf, 0, 2 * dma_half_size * sizeof(uint32_t));
+    dma_half = 0;
+
+    // word wide single transfers from ADGDR, which has the channel number with the result, two descriptors
+    // that link to each other, each fills one half of the buffer and raises the terminal count interrupt
+    uint32_t control = dma_half_size | (2 << 18) | (2 << 21) | (1 << 27) | (1UL << 31);
+    for (int i = 0; i < 2; ++i) {
+        uint32_t *lli = &dma_lli[i * 4];
+        lli[0] = (uint32_t)&LPC_ADC->ADGDR;
+        lli[1] = (uint32_t)&dma_buf[i * dma_half_size];
+        lli[2] = (uint32_t)&dma_lli[((i + 1) & 1) * 4];
+        lli[3] = control;
+    }
+
+    LPC_SC->PCONP |= (1 << 29); // power up the GPDMA
+    LPC_GPDMA->DMACConfig = 1;
+
+    ADC_DMA_CHANNEL->DMACCConfig = 0;
+    LPC_GPDMA->DMACIntTCClear = (1 << 6);
+    LPC_GPDMA->DMACIntErrClr = (1 << 6);
+    ADC_DMA_CHANNEL->DMACCSrcAddr = dma_lli[0];
+    ADC_DMA_CHANNEL->DMACCDestAddr = dma_lli[1];
+    ADC_DMA_CHANNEL->DMACCLLI = dma_lli[2];
+    ADC_DMA_CHANNEL->DMACCControl = control;
+
+    NVIC_SetVector(DMA_IRQn, (uint32_t)&dma_isr);
+    NVIC_EnableIRQ(DMA_IRQn);
+
+    // enabled, source is the adc request, peripheral to memory, terminal count interrupt unmasked
+    ADC_DMA_CHANNEL->DMACCConfig = 1 | (ADC_DMA_REQUEST << 1) | (2 << 11) | (1 << 15);
+
+    // the samples now come from the dma, the per conversion interrupt stays off
+    NVIC_DisableIRQ(ADC_IRQn);
+    dma = true;
+    return true;
 }
 
-// Keeps the last 8 values for each channel
-// This is called in an ISR, so sample_buffers needs to be accessed atomically
+// A half of the dma buffer has been filled, filter everything in it
+// Words whose DONE bit is clear were already handled or never written
+void Adc::dma_done()
+{
+    if(!(LPC_GPDMA->DMACIntTCStat & (1 << 6))) return; // another channel
+    LPC_GPDMA->DMACIntTCClear = (1 << 6);
+
+    uint32_t *p = &dma_buf[dma_half * dma_half_size];
+    dma_half ^= 1;
+    for (int i = 0; i < dma_half_size; ++i) {
+        uint32_t v = p[i];
+        if(v & (1UL << 31)) {
+            new_sample((v >> 24) & 0x07, v);
+            p[i] = 0;
+        }
+    }
+}
+
+// Filters the readings for each channel as they arrive, see channel_filter
+// This is called in an ISR, only the aligned sum is read outside of it
 void Adc::new_sample(int chan, uint32_t value)
 {
-    // Shuffle down and add new value to the end
     if(chan < num_channels) {
-        memmove(&sample_buffers[chan][0], &sample_buffers[chan][1], sizeof(sample_buffers[0]) - sizeof(sample_buffers[0][0]));
-        sample_buffers[chan][num_samples - 1] = (value >> 4) & 0xFFF; // the 12 bit ADC reading
+        channel_filter &f= filters[chan];
+        uint16_t v= (value >> 4) & 0xFFF; // the 12 bit ADC reading
+        uint16_t a= f.last[0], b= f.last[1];
+        f.last[0]= b;
+        f.last[1]= v;
+        // median of three
+        uint16_t m= std::max(std::min(a, b), std::min(std::max(a, b), v));
+
+        f.sum += m - f.ring[f.head];
+        f.ring[f.head]= m;
+        if(++f.head == num_samples) f.head= 0;
     }
 }
 
-//#define USE_MEDIAN_FILTER
 // Read the filtered value ( burst mode ) on a given pin
 unsigned int Adc::read(Pin *pin)
 {
     PinName p = this->_pin_to_pinname(pin);
     int channel = adc->_pin_to_channel(p);
 
-    uint16_t median_buffer[num_samples];
-    // needs atomic access TODO maybe be able to use std::atomic here or some lockless mutex
-    __disable_irq();
-    memcpy(median_buffer, sample_buffers[channel], sizeof(median_buffer));
-    __enable_irq();
-
-#ifdef USE_MEDIAN_FILTER
-    // returns the median value of the last 8 samples
-    return median_buffer[quick_median(median_buffer, num_samples)];
-
-#elif defined(OVERSAMPLE)
-    // Oversample to get 2 extra bits of resolution
-    // weed out top and bottom worst values then oversample the rest
-    // put into a 4 element moving average and return the average of the last 4 oversampled readings
-    static uint16_t ave_buf[num_channels][4] =  { {0} };
-    std::sort(median_buffer, median_buffer + num_samples);
-    uint32_t sum = 0;
-    for (int i = num_samples / 4; i < (num_samples - (num_samples / 4)); ++i) {
-        sum += median_buffer[i];
-    }
-    // this slows down the rate of change a little bit
-    ave_buf[channel][3]= ave_buf[channel][2];
-    ave_buf[channel][2]= ave_buf[channel][1];
-    ave_buf[channel][1]= ave_buf[channel][0];
-    ave_buf[channel][0]= sum >> OVERSAMPLE;
-    return roundf((ave_buf[channel][0]+ave_buf[channel][1]+ave_buf[channel][2]+ave_buf[channel][3])/4.0F);
+    uint32_t sum= filters[channel].sum;
 
+#ifdef OVERSAMPLE
+    // the average of 4^n samples * 2, scaled to give n extra bits of resolution
+    const int shift= OVERSAMPLE + 1;
 #else
-    // sort the 8 readings and return the average of the middle 4
-    std::sort(median_buffer, median_buffer + num_samples);
-    int sum = 0;
-    for (int i = num_samples / 4; i < (num_samples - (num_samples / 4)); ++i) {
-        sum += median_buffer[i];
-    }
-    return sum / (num_samples / 2);
-
+    // the average of the 8 samples
+    const int shift= 3;
 #endif
+    return (sum + (1 << (shift - 1))) >> shift;
 }
 
 // Convert a smoothie Pin into a mBed Pin
@@ -29,9 +29,12 @@ public:
     Adc();
     void enable_pin(Pin *pin);
     unsigned int read(Pin *pin);
+    // capture the burst conversions by dma, with one interrupt per half buffer instead of one per conversion
+    bool enable_dma();
 
     static Adc *instance;
     void new_sample(int chan, uint32_t value);
+    void dma_done();
     // return the maximum ADC value, base is 12bits 4095.
 #ifdef OVERSAMPLE
     int get_max_value() const { return 4095 << OVERSAMPLE;}
@@ -50,8 +53,23 @@ private:
 #else
     static const int num_samples= 8;
 #endif
-    // buffers storing the last num_samples readings for each channel
-    uint16_t sample_buffers[num_channels][num_samples];
+    // each new reading is the median of it and the two before, which takes out single spikes,
+    // that goes into a ring of the last num_samples, and their sum is kept as it changes
+    // so a read is just a shift of the sum and the ISR does a fixed amount of work
+    struct channel_filter {
+        uint16_t ring[num_samples];
+        uint16_t last[2]; // the two raw readings before this one
+        uint32_t sum;     // of ring, one aligned word so read does not need to disable interrupts
+        uint8_t head;
+    };
+    channel_filter filters[num_channels];
+
+    // ADGDR words written by the dma, two halves that each raise an interrupt when full
+    static const int dma_half_size= 16;
+    uint32_t *dma_buf;
+    uint32_t *dma_lli;
+    uint8_t dma_half; // the half the next interrupt is for
+    bool dma;
 };
 
 #endif
@@ -0,0 +1,44 @@
+#include "BootTrace.h"
+
+#include "StreamOutput.h"
+#include "platform_memory.h"
+#include "us_ticker_api.h"
+
+extern unsigned int g_heapInUse;
+
+BootTrace::Entry *BootTrace::entries= nullptr;
+uint8_t BootTrace::count= 0;
+bool BootTrace::finished= false;
+
+void BootTrace::mark(const char *what, const void *module)
+{
+    uint32_t now= us_ticker_read();
+    if(finished || count >= max_entries) return;
+
+    if(entries == nullptr) {
+        // kept after boot for the boottime command, so out of the main heap
+        entries= (Entry *)AHB0.alloc(max_entries * sizeof(Entry));
+        if(entries == nullptr) entries= new Entry[max_entries];
+    }
+    entries[count++]= {what, module, now, g_heapInUse, AHB0.get_used() + AHB1.get_used()};
+}
+
+void BootTrace::print(StreamOutput *stream)
+{
+    if(count == 0) {
+        stream->printf("no boot trace\n");
+        return;
+    }
+
+    // the us_ticker starts on the first read, so times are from the first mark
+    const Entry *prev= &entries[0];
+    stream->printf("      at ms   took ms    heap     ahb\n");
+    for (int i = 0; i < count; ++i) {
+        const Entry& e= entries[i];
+        stream->printf("%11.3f %9.3f %7ld %7ld %s", (e.us - entries[0].us) / 1000.0F, (e.us - prev->us) / 1000.0F,
+            (int32_t)(e.heap - prev->heap), (int32_t)(e.ahb - prev->ahb), e.what);
+        if(e.module != nullptr) stream->printf(" %p", e.module);
+        stream->printf("\n");
+        prev= &e;
+    }
+}
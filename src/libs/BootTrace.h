@@ -0,0 +1,34 @@
+#ifndef BOOTTRACE_H
+#define BOOTTRACE_H
+
+#include <stdint.h>
+
+class StreamOutput;
+
+// Where the time goes while booting, a us_ticker timestamp at the end of each phase of init and of each module
+// loaded, shown by the boottime command. A module is shown by the address of its vtable to look up in the map file,
+// as there is no RTTI. Marks after done() are ignored, so add_module can mark unconditionally.
+// Each mark also takes the heap and AHB pool bytes in use, what a module allocated is the difference from the mark
+// before it, that covers its constructor as well as its on_module_loaded.
+class BootTrace {
+public:
+    static void mark(const char *what, const void *module= nullptr);
+    static void done() { mark("boot done"); finished= true; }
+    static void print(StreamOutput *stream);
+
+private:
+    struct Entry {
+        const char *what;
+        const void *module;
+        uint32_t us;
+        uint32_t heap;
+        uint32_t ahb;
+    };
+
+    static const int max_entries= 48;
+    static Entry *entries;
+    static uint8_t count;
+    static bool finished;
+};
+
+#endif
@@ -708,6 +708,96 @@ void clear_lock (    /* Clear lock entries of the volume */
 
 
 
+/*-----------------------------------------------------------------------*/
+/* FAT and directory sector cache                                        */
+/*-----------------------------------------------------------------------*/
+#if _FS_SECTOR_CACHE
+#include "platform_memory.h"
+
+static BYTE *SectorCacheBuf;                    /* _FS_SECTOR_CACHE sectors in AHB RAM, allocated on first use */
+static DWORD SectorCacheSect[_FS_SECTOR_CACHE];    /* Sector in each line, 0xFFFFFFFF: empty */
+static BYTE SectorCacheDrv[_FS_SECTOR_CACHE];    /* Physical drive of each line */
+static DWORD SectorCacheUse[_FS_SECTOR_CACHE];    /* Last use of each line for LRU replacement */
+static DWORD SectorCacheTick;
+
+static
+void cache_clear (void)
+{
+    UINT i;
+
+    for (i = 0; i < _FS_SECTOR_CACHE; i++) SectorCacheSect[i] = 0xFFFFFFFF;
+}
+
+static
+int cache_find (    /* Line the sector is in, -1: not cached */
+    BYTE drv,
+    DWORD sect
+)
+{
+    UINT i;
+
+    if (!SectorCacheBuf) return -1;
+    for (i = 0; i < _FS_SECTOR_CACHE; i++) {
+        if (SectorCacheSect[i] == sect && SectorCacheDrv[i] == drv) {
+            SectorCacheUse[i] = ++SectorCacheTick;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static
+void cache_store (    /* Put a copy of the sector in the cache, replacing the least recently used line */
+    BYTE drv,
+    DWORD sect,
+    const BYTE *buf
+)
+{
+    int n;
+    UINT i;
+
+    if (!SectorCacheBuf) {
+        SectorCacheBuf = (BYTE*)AHB0.alloc(_FS_SECTOR_CACHE * 512);
+        if (!SectorCacheBuf) return;
+        cache_clear();
+    }
+    n = cache_find(drv, sect);
+    if (n < 0) {
+        for (i = n = 0; i < _FS_SECTOR_CACHE; i++) {
+            if (SectorCacheSect[i] == 0xFFFFFFFF) { n = i; break; }
+            if (SectorCacheUse[i] < SectorCacheUse[n]) n = i;
+        }
+        SectorCacheSect[n] = sect;
+        SectorCacheDrv[n] = drv;
+        SectorCacheUse[n] = ++SectorCacheTick;
+    }
+    mem_cpy(&SectorCacheBuf[n * 512], buf, 512);
+}
+
+/* File data is written straight to the disk without invalidating, a sector only comes to be read
+   through the window again as part of a new directory, and that is cleared and written through the window first */
+static
+void cache_invalidate (    /* Sectors written other than through the window */
+    BYTE drv,
+    DWORD sect,
+    UINT count
+)
+{
+    UINT i;
+
+    if (!SectorCacheBuf) return;
+    for (i = 0; i < _FS_SECTOR_CACHE; i++) {
+        if (SectorCacheDrv[i] == drv && SectorCacheSect[i] - sect < count)
+            SectorCacheSect[i] = 0xFFFFFFFF;
+    }
+}
+#else
+#define cache_clear()
+#define cache_invalidate(drv, sect, count)
+#endif
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Change window offset                                                  */
 /*-----------------------------------------------------------------------*/
@@ -728,6 +818,9 @@ FRESULT move_window (
             if (disk_write(fs->drv, fs->win, wsect, 1) != RES_OK)
                 return FR_DISK_ERR;
             fs->wflag = 0;
+#if _FS_SECTOR_CACHE
+            if (cache_find(fs->drv, wsect) >= 0) cache_store(fs->drv, wsect, fs->win);
+#endif
             if (wsect < (fs->fatbase + fs->fsize)) {    /* In FAT area */
                 BYTE nf;
                 for (nf = fs->n_fats; nf > 1; nf--) {    /* Reflect the change to all FAT copies */
@@ -738,8 +831,19 @@ FRESULT move_window (
         }
 #endif
         if (sector) {
+#if _FS_SECTOR_CACHE
+            int n = cache_find(fs->drv, sector);
+            if (n >= 0) {
+                mem_cpy(fs->win, &SectorCacheBuf[n * 512], 512);
+            } else {
+                if (disk_read(fs->drv, fs->win, sector, 1) != RES_OK)
+                    return FR_DISK_ERR;
+                cache_store(fs->drv, sector, fs->win);
+            }
+#else
             if (disk_read(fs->drv, fs->win, sector, 1) != RES_OK)
                 return FR_DISK_ERR;
+#endif
             fs->winsect = sector;
         }
     }
@@ -776,6 +880,7 @@ FRESULT sync (    /* FR_OK: successful, FR_DISK_ERR: failed */
             ST_DWORD(fs->win+FSI_Nxt_Free, fs->last_clust);
             /* Write it into the FSInfo sector */
             disk_write(fs->drv, fs->win, fs->fsi_sector, 1);
+            cache_invalidate(fs->drv, fs->fsi_sector, 1);
         fs->fsi_flag = 0;
     }
     /* Make sure that no pending write process in the physical drive */
@@ -1033,7 +1138,7 @@ DWORD create_chain (    /* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:Disk
 #if _USE_FASTSEEK
 static
 DWORD clmt_clust (    /* <2:Error, >=2:Cluster number */
-    FIL* fp,        /* Pointer to the file object */
+    FIL_t* fp,        /* Pointer to the file object */
     DWORD ofs        /* File offset to be converted to cluster# */
 )
 {
@@ -2051,6 +2156,7 @@ FRESULT chk_mounted (    /* FR_OK(0): successful, !=0: any error occurred */
 
     fs->fs_type = 0;                    /* Clear the file system object */
     fs->drv = (BYTE)LD2PD(vol);            /* Bind the logical drive and a physical drive */
+    cache_clear();                        /* The media may have been changed */
     stat = disk_initialize(fs->drv);    /* Initialize low level disk I/O layer */
     if (stat & STA_NOINIT)                /* Check if the initialization succeeded */
         return FR_NOT_READY;            /* Failed to initialize due to no media or hard error */
@@ -48,10 +48,17 @@
 /* To enable f_forward function, set _USE_FORWARD to 1 and set _FS_TINY to 1. */
 
 
-#define    _USE_FASTSEEK    0    /* 0:Disable or 1:Enable */
+#define    _USE_FASTSEEK    1    /* 0:Disable or 1:Enable */
 /* To enable fast seek feature, set _USE_FASTSEEK to 1. */
 
 
+#define    _FS_SECTOR_CACHE    4    /* 0:Disable or number of sectors */
+/* Number of FAT and directory sectors kept in AHB RAM besides the window of
+/  each file system object, so a FAT lookup in between data reads or directory
+/  scans does not read the same sector again. Sectors are written through to
+/  the disk when the window is written back so the cache is never dirty. */
+
+
 
 /*---------------------------------------------------------------------------/
 / Locale and Namespace Configurations
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include "ff.h"
 #include "FATFileSystem.h"
+#include "platform_memory.h"
 
 namespace mbed {
 
@@ -37,6 +38,10 @@ FATFileHandle::FATFileHandle(FIL_t fh) {
 int FATFileHandle::close() {
     FFSDEBUG("close\n");
     int retval = f_close(&_fh);
+    if(_fh.cltbl != NULL) {
+        AHB0.dealloc(_fh.cltbl);
+        _fh.cltbl = NULL;
+    }
     delete this;
     return retval;
 }
@@ -74,6 +79,11 @@ off_t FATFileHandle::lseek(off_t position, int whence) {
     } else if(whence==SEEK_CUR) {
         position += _fh.fptr;
     }
+    // a long seek in a file being read, eg to get its size or to resume a print, walks the cluster chain from the start
+    // so the first one maps the chain once and the seeks after that are done from the map
+    if(_fh.cltbl == NULL && !(_fh.flag & FA_WRITE) && (DWORD)position >= (DWORD)_fh.fs->csize * 512) {
+        create_linkmap();
+    }
     FRESULT res = f_lseek(&_fh, position);
     if(res) {
         FFSDEBUG("lseek failed (%d, %s)\n", res, FR_ERRORS[res]);
@@ -84,6 +94,25 @@ off_t FATFileHandle::lseek(off_t position, int whence) {
     }
 }
         
+// the map is the length and first cluster of each fragment of the file, it is left out if there is no memory for it
+void FATFileHandle::create_linkmap() {
+    DWORD n = 32;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        DWORD *tbl = (DWORD *)AHB0.alloc(n * sizeof(DWORD));
+        if(tbl == NULL) return;
+        tbl[0] = n;
+        _fh.cltbl = tbl;
+        FRESULT res = f_lseek(&_fh, CREATE_LINKMAP);
+        if(res == FR_OK) return;
+
+        // tbl[0] says how big it needs to be, a very fragmented file is not worth the memory
+        _fh.cltbl = NULL;
+        n = tbl[0];
+        AHB0.dealloc(tbl);
+        if(res != FR_NOT_ENOUGH_CORE || n > 512) return;
+    }
+}
+
 int FATFileHandle::fsync() {
     FFSDEBUG("fsync()\n");
     FRESULT res = f_sync(&_fh);
@@ -80,6 +80,8 @@ void Config::config_cache_load(bool parse)
         for( ConfigSource *source : this->config_sources ) {
             source->transfer_values_to_cache(this->config_cache);
         }
+        // every module looks up its values in it from here on
+        this->config_cache->build_index();
     }
 }
 
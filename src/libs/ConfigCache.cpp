@@ -3,6 +3,9 @@
 
 #include "libs/StreamOutput.h"
 
+#include <algorithm>
+#include <string.h>
+
 ConfigCache::ConfigCache()
 {
 }
@@ -19,15 +22,18 @@ void ConfigCache::clear()
     }
     store.clear();
     storage_t().swap(store);   //  makes sure the vector releases its memory
+    storage_t().swap(index);
 }
 
 void ConfigCache::add(ConfigValue *v)
 {
+    index.clear();
     store.push_back(v);
 }
 
 void ConfigCache::pop()
 {
+    index.clear();
     auto cv= store.back();
     store.pop_back();
     delete cv;
@@ -36,6 +42,8 @@ void ConfigCache::pop()
 // If we find an existing value, replace it, otherwise, push it at the back of the list
 void ConfigCache::replace_or_push_back(ConfigValue *new_value)
 {
+    index.clear();
+
     // For each already existing element
     for(auto &cv : store) {
         // If this configvalue matches the checksum
@@ -52,8 +60,35 @@ void ConfigCache::replace_or_push_back(ConfigValue *new_value)
     store.push_back(new_value);
 }
 
+// The index is ordered on the first and last checksums only, the module family and the setting, and keeps file order between
+// equal ones. A run of equal keys is the same setting of each module of a family, so collect can take it as it is,
+// and lookup only has to look through the few modules of that family for the one it wants.
+static inline uint32_t index_key(const uint16_t *check_sums)
+{
+    return ((uint32_t)check_sums[0] << 16) | check_sums[2];
+}
+
+bool ConfigCache::index_less(const ConfigValue *cv, uint32_t key)
+{
+    return index_key(cv->check_sums) < key;
+}
+
+void ConfigCache::build_index()
+{
+    index= store;
+    std::stable_sort(index.begin(), index.end(), [](const ConfigValue *a, const ConfigValue *b) { return index_key(a->check_sums) < index_key(b->check_sums); });
+}
+
 ConfigValue *ConfigCache::lookup(const uint16_t *check_sums) const
 {
+    if(!index.empty()) {
+        uint32_t key= index_key(check_sums);
+        for(auto i= std::lower_bound(index.begin(), index.end(), key, index_less); i != index.end() && index_key((*i)->check_sums) == key; ++i) {
+            if((*i)->check_sums[1] == check_sums[1]) return *i;
+        }
+        return NULL;
+    }
+
     for( auto &cv : store) {
         if(memcmp(check_sums, cv->check_sums, sizeof(cv->check_sums)) == 0)
             return cv;
@@ -64,6 +99,15 @@ ConfigValue *ConfigCache::lookup(const uint16_t *check_sums) const
 
 void ConfigCache::collect(uint16_t family, uint16_t cs, vector<uint16_t> *list)
 {
+    if(!index.empty()) {
+        uint16_t check_sums[3]= {family, 0, cs};
+        uint32_t key= index_key(check_sums);
+        for(auto i= std::lower_bound(index.begin(), index.end(), key, index_less); i != index.end() && index_key((*i)->check_sums) == key; ++i) {
+            list->push_back((*i)->check_sums[1]);
+        }
+        return;
+    }
+
     for( auto &kv : store ) {
         if( kv->check_sums[2] == cs && kv->check_sums[0] == family ) {
             // We found a module enable for this family, add it's number
@@ -72,6 +116,16 @@ void ConfigCache::collect(uint16_t family, uint16_t cs, vector<uint16_t> *list)
     }
 }
 
+void ConfigCache::merge_into(ConfigCache *other)
+{
+    for( auto &cv : store ) {
+        other->replace_or_push_back(cv);
+    }
+    store.clear();
+    storage_t().swap(store);
+    storage_t().swap(index);
+}
+
 void ConfigCache::dump(StreamOutput *stream)
 {
     int l = 1;
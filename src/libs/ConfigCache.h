@@ -28,7 +28,7 @@ class ConfigCache {
         // lookup and return the entru that matches the check sums,return NULL if not found
         ConfigValue *lookup(const uint16_t *check_sums) const;
 
-        // collect enabled checksums of the given family
+        // collect enabled checksums of the given family, in the order they are in the config
         void collect(uint16_t family, uint16_t cs, vector<uint16_t> *list);
 
         // If we find an existing value, replace it, otherwise, push it at the back of the list
@@ -37,9 +37,21 @@ class ConfigCache {
         // used for debugging, dumps the cache to a stream
         void dump(StreamOutput *stream);
 
+        // move every value to other as if they were added to it one by one with replace_or_push_back, leaves this empty
+        void merge_into(ConfigCache *other);
+
+        // sort an index of the values so lookup does not have to look at them all, any change to the cache drops it
+        void build_index();
+
+        size_t size() const { return store.size(); }
+        // the values in the order they were added
+        const ConfigValue *get(size_t n) const { return store[n]; }
+
     private:
         typedef vector<ConfigValue*> storage_t;
         storage_t store;
+        storage_t index; // store sorted by family and setting, empty if not built
+        static bool index_less(const ConfigValue *cv, uint32_t key);
 };
 
 
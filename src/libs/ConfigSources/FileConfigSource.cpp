@@ -12,6 +12,7 @@
 #include "checksumm.h"
 #include "utils.h"
 #include <malloc.h>
+#include <stdlib.h>
 
 using namespace std;
 #include <string>
@@ -55,7 +56,118 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache )
     if( !this->has_config_file() ) {
         return;
     }
-    transfer_values_to_cache( cache, this->get_config_file().c_str());
+
+    if(load_compiled(cache)) return;
+
+    // parse it on its own first so what it gave can be kept for next time
+    ConfigCache values;
+    transfer_values_to_cache( &values, this->get_config_file().c_str());
+    write_compiled(values);
+    vector<string>().swap(read_files);
+    values.merge_into(cache);
+}
+
+// size and crc of the whole file
+bool FileConfigSource::fingerprint(const char *file_name, uint32_t& size, uint32_t& crc)
+{
+    FILE *fp = fopen(file_name, "r");
+    if(fp == NULL) return false;
+
+    char buf[512];
+    size= 0;
+    crc= 0;
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) {
+        crc= crc32(buf, n, crc);
+        size += n;
+    }
+    fclose(fp);
+    return true;
+}
+
+// load the compiled config if every file it was made from is unchanged
+bool FileConfigSource::load_compiled(ConfigCache *cache)
+{
+    string bin_name= this->config_file + ".bin";
+    FILE *fp = fopen(bin_name.c_str(), "r");
+    if(fp == NULL) return false;
+
+    fseek(fp, 0, SEEK_END);
+    long len= ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf= len > (long)sizeof(CompiledHeader) && len < 65536 ? (char *)malloc(len) : NULL;
+    bool ok= buf != NULL && fread(buf, 1, len, fp) == (size_t)len;
+    fclose(fp);
+    if(!ok) {
+        free(buf);
+        return false;
+    }
+
+    CompiledHeader h;
+    memcpy(&h, buf, sizeof(h));
+    const char *p= buf + sizeof(h);
+    const char *end= buf + len;
+    ok= memcmp(h.magic, "SCFG", 4) == 0 && h.version == 1;
+
+    // a file record is size, crc, name length and name
+    for (uint32_t i = 0; ok && i < h.files; i++) {
+        uint32_t size, crc, fsize, fcrc;
+        if(end - p < 9 || end - p < 9 + (uint8_t)p[8]) { ok= false; break; }
+        memcpy(&size, p, 4);
+        memcpy(&crc, p + 4, 4);
+        string name(p + 9, (uint8_t)p[8]);
+        p += 9 + (uint8_t)p[8];
+        ok= fingerprint(name.c_str(), fsize, fcrc) && fsize == size && fcrc == crc;
+    }
+
+    // a value record is the three checksums, value length and value, check they are all there before using any
+    const char *values= p;
+    for (uint32_t i = 0; ok && i < h.values; i++) {
+        if(end - p < 7 || end - p < 7 + (uint8_t)p[6]) ok= false;
+        else p += 7 + (uint8_t)p[6];
+    }
+
+    if(ok) {
+        p= values;
+        for (uint32_t i = 0; i < h.values; i++) {
+            ConfigValue *cv = new ConfigValue;
+            cv->found = true;
+            memcpy(cv->check_sums, p, 6);
+            cv->value.assign(p + 7, (uint8_t)p[6]);
+            p += 7 + (uint8_t)p[6];
+            cache->replace_or_push_back(cv);
+        }
+    }
+
+    free(buf);
+    return ok;
+}
+
+void FileConfigSource::write_compiled(const ConfigCache &values)
+{
+    string bin_name= this->config_file + ".bin";
+    FILE *fp = fopen(bin_name.c_str(), "w");
+    if(fp == NULL) return;
+
+    CompiledHeader h{{'S', 'C', 'F', 'G'}, 1, (uint32_t)read_files.size(), (uint32_t)values.size()};
+    bool ok= fwrite(&h, sizeof(h), 1, fp) == 1;
+
+    for(auto &name : read_files) {
+        uint32_t size, crc;
+        uint8_t n= name.size();
+        if(!fingerprint(name.c_str(), size, crc)) ok= false;
+        ok= ok && fwrite(&size, 4, 1, fp) == 1 && fwrite(&crc, 4, 1, fp) == 1 && fwrite(&n, 1, 1, fp) == 1 && fwrite(name.data(), 1, n, fp) == n;
+    }
+
+    for (size_t i = 0; i < values.size(); i++) {
+        const ConfigValue *cv= values.get(i);
+        uint8_t n= cv->value.size();
+        ok= ok && fwrite(cv->check_sums, 6, 1, fp) == 1 && fwrite(&n, 1, 1, fp) == 1 && fwrite(cv->value.data(), 1, n, fp) == n;
+    }
+
+    fclose(fp);
+    // a partly written one would be thrown away when loaded, but do not leave it there
+    if(!ok) remove(bin_name.c_str());
 }
 
 void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char * file_name )
@@ -63,6 +175,7 @@ void FileConfigSource::transfer_values_to_cache( ConfigCache *cache, const char
     if( !file_exists(file_name) ) {
         return;
     }
+    read_files.push_back(file_name);
 
     // Open the config file ( find it if we haven't already found it )
     FILE *lp = fopen(file_name, "r");
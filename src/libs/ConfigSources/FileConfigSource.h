@@ -14,7 +14,9 @@ class ConfigCache;
 
 using namespace std;
 #include <string>
+#include <vector>
 #include <stdio.h>
+#include <stdint.h>
 
 class FileConfigSource : public ConfigSource
 {
@@ -31,7 +33,21 @@ public:
 
 private:
     bool readLine(string& line, int lineno, FILE *fp);
+    bool load_compiled(ConfigCache *cache);
+    void write_compiled(const ConfigCache &values);
+    static bool fingerprint(const char *file_name, uint32_t& size, uint32_t& crc);
+
+    // the values parsed from the text are kept in config_file.bin with the size and crc of each file they came from,
+    // so the next boot can load them with one read instead of parsing it all again
+    struct CompiledHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t files;
+        uint32_t values;
+    };
+
     string config_file;         // Path to the config file
+    vector<string> read_files;  // the config file and its includes, while it is being parsed
     bool   config_file_found;   // Wether or not the config file's location is known
 };
 
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+// Cortex-M3 DWT cycle counter, counts at SystemCoreClock and wraps every ~42 seconds at 100MHz
+// so only use it for measuring short intervals (unsigned subtraction handles the wrap)
+// NOTE the DWT is not defined in the smoothed score_cm3.h so we access the registers directly
+#define CYCLECOUNTER_DEMCR  (*(volatile uint32_t *)0xE000EDFC)
+#define CYCLECOUNTER_CTRL   (*(volatile uint32_t *)0xE0001000)
+#define CYCLECOUNTER_CYCCNT (*(volatile uint32_t *)0xE0001004)
+
+// enable trace and the cycle counter, safe to call more than once
+static inline void cycle_counter_enable()
+{
+    CYCLECOUNTER_DEMCR |= (1UL << 24); // TRCENA
+    CYCLECOUNTER_CTRL |= 1UL;          // CYCCNTENA
+}
+
+static inline uint32_t cycle_counter_read()
+{
+    return CYCLECOUNTER_CYCCNT;
+}
@@ -0,0 +1,120 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "FileTail.h"
+#include "platform_memory.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+char FileTail::path[64];
+char *FileTail::ring= nullptr;
+uint32_t FileTail::written= 0;
+uint32_t FileTail::on_card= 0;
+uint32_t FileTail::ring_start= 0;
+bool FileTail::writing= false;
+bool FileTail::ok= false;
+bool FileTail::sync_wanted= false;
+
+bool FileTail::begin(const char *p)
+{
+    if(writing || strlen(p) >= sizeof(path)) return false;
+    strcpy(path, p);
+    written= on_card= ring_start= 0;
+    writing= true;
+    ok= false;
+    sync_wanted= false;
+    return true;
+}
+
+bool FileTail::write(const void *data, size_t n)
+{
+    if(!writing) return false;
+
+    if(ring != nullptr) {
+        // only the last ring_size bytes are kept, each byte goes at its offset in the file modulo the size
+        const char *p= (const char *)data;
+        if(n > ring_size) {
+            p += n - ring_size;
+            written += n - ring_size;
+            n= ring_size;
+        }
+        while(n > 0) {
+            size_t at= written % ring_size;
+            size_t len= ring_size - at;
+            if(len > n) len= n;
+            memcpy(&ring[at], p, len);
+            p += len;
+            written += len;
+            n -= len;
+        }
+        if(written - ring_start > ring_size) ring_start= written - ring_size;
+
+    } else {
+        written += n;
+        ring_start= written;
+    }
+
+    return sync_wanted;
+}
+
+void FileTail::end(bool whole)
+{
+    if(!writing) return;
+    writing= false;
+    ok= whole;
+    on_card= written;
+    sync_wanted= false;
+}
+
+bool FileTail::is_writing(const char *p)
+{
+    return writing && strcmp(path, p) == 0;
+}
+
+bool FileTail::has_failed(const char *p)
+{
+    return !writing && !ok && strcmp(path, p) == 0;
+}
+
+bool FileTail::follow()
+{
+    if(ring == nullptr) {
+        ring= (char *)AHB0.alloc(ring_size);
+        if(ring == nullptr) ring= (char *)malloc(ring_size);
+        if(ring == nullptr) return false;
+    }
+    // what was written before is not in the ring, so the card has to have it
+    ring_start= written;
+    if(on_card < written) sync_wanted= true;
+    return true;
+}
+
+void FileTail::unfollow()
+{
+    if(ring == nullptr) return;
+    if(AHB0.has(ring)) AHB0.dealloc(ring);
+    else free(ring);
+    ring= nullptr;
+}
+
+size_t FileTail::read(uint32_t offset, void *buf, size_t n)
+{
+    if(ring == nullptr || offset < ring_start || offset >= written) return 0;
+
+    if(n > written - offset) n= written - offset;
+    char *p= (char *)buf;
+    size_t got= 0;
+    while(got < n) {
+        size_t at= (offset + got) % ring_size;
+        size_t len= ring_size - at;
+        if(len > n - got) len= n - got;
+        memcpy(&p[got], &ring[at], len);
+        got += len;
+    }
+    return got;
+}
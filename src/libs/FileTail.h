@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Lets a file be played while it is still being uploaded. The upload puts everything it writes through here as well,
+// once something follows the file the last of it is kept in a ring in RAM, as a handle opened on the card only sees
+// the size the file had when the directory entry was last updated. A follower that has fallen behind the ring asks
+// for a checkpoint, the writer then closes the file and opens it again to append so the card has everything.
+// Only one upload at a time is shared, everything here is called from the main loop.
+class FileTail {
+    public:
+        // writer side, begin returns false if another upload is being shared, then the rest need not be called
+        static bool begin(const char *path);
+        // returns true if the writer should checkpoint the file now and then call synced()
+        static bool write(const void *data, size_t n);
+        static void synced() { on_card= written; sync_wanted= false; }
+        // the end of the transfer, ok is false if the file is not whole and should not be played
+        static void end(bool ok);
+
+        // reader side
+        static bool is_writing(const char *path);
+        static bool has_failed(const char *path);
+        // keeps what is written from now on in RAM, returns false if there is no memory for it
+        static bool follow();
+        static void unfollow();
+        // copies up to n bytes from offset in the file out of the ring, returns 0 if it does not hold them
+        static size_t read(uint32_t offset, void *buf, size_t n);
+        static void want_sync() { sync_wanted= true; }
+        static uint32_t get_written() { return written; }
+        static uint32_t get_on_card() { return on_card; }
+        static const char *get_path() { return path; }
+
+    private:
+        static const size_t ring_size= 4096;
+
+        static char path[64];
+        static char *ring;
+        static uint32_t written; // bytes of the file written so far
+        static uint32_t on_card; // bytes a handle opened now would see
+        static uint32_t ring_start; // first byte of the file the ring still holds
+        static bool writing;
+        static bool ok;
+        static bool sync_wanted;
+};
@@ -0,0 +1,176 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "FileWriter.h"
+#include "platform_memory.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static char *alloc_buffer(size_t size)
+{
+    char *p= (char *)AHB0.alloc(size);
+    if(p == nullptr) p= (char *)malloc(size);
+    return p;
+}
+
+static void free_buffer(char *p)
+{
+    if(p == nullptr) return;
+    if(AHB0.has(p)) AHB0.dealloc(p);
+    else free(p);
+}
+
+bool FileWriter::open(const char *filename, const char *mode, bool deferred)
+{
+    close();
+    fp= fopen(filename, mode);
+    if(fp == nullptr) return false;
+
+    used= 0;
+    pending= 0;
+    written= 0;
+    crc= 0;
+    failed= false;
+    buffer= alloc_buffer(buffer_size);
+    // without a second buffer the writes are just not deferred
+    if(deferred && buffer != nullptr) spare= alloc_buffer(buffer_size);
+    // we do our own buffering so the writes go straight to the file system
+    if(buffer != nullptr) setvbuf(fp, nullptr, _IONBF, 0);
+    return true;
+}
+
+bool FileWriter::write(const void *data, size_t n)
+{
+    if(fp == nullptr || failed) return false;
+
+    crc= crc32(data, n, crc);
+    written += n;
+    bool sync= shared && FileTail::write(data, n);
+
+    if(buffer == nullptr) {
+        if(fwrite(data, 1, n, fp) != n) failed= true;
+        return !failed && (!sync || checkpoint());
+    }
+
+    const char *p= (const char *)data;
+    while(n > 0) {
+        size_t len= buffer_size - used;
+        if(len > n) len= n;
+        memcpy(&buffer[used], p, len);
+        used += len;
+        p += len;
+        n -= len;
+        if(used == buffer_size && !buffer_full()) return false;
+    }
+    return !sync || checkpoint();
+}
+
+bool FileWriter::buffer_full()
+{
+    if(spare == nullptr) return flush();
+
+    // only one can be waiting, if the caller has not written it yet do it now
+    if(pending > 0 && !write_pending()) return false;
+    char *t= spare;
+    spare= buffer;
+    buffer= t;
+    pending= used;
+    used= 0;
+    return true;
+}
+
+bool FileWriter::write_pending()
+{
+    if(fp == nullptr || failed) return false;
+    if(pending > 0) {
+        if(fwrite(spare, 1, pending, fp) != pending) failed= true;
+        pending= 0;
+    }
+    return !failed;
+}
+
+bool FileWriter::flush()
+{
+    if(!write_pending()) return false;
+    if(used > 0) {
+        if(fwrite(buffer, 1, used, fp) != used) failed= true;
+        used= 0;
+    }
+    return !failed;
+}
+
+// something playing the file has fallen behind what FileTail keeps in RAM, closing it updates the directory entry
+// so a handle opened on it now sees everything written so far
+bool FileWriter::checkpoint()
+{
+    if(!flush()) return false;
+    fclose(fp);
+    fp= fopen(FileTail::get_path(), "a");
+    FileTail::synced();
+    if(fp == nullptr) {
+        failed= true;
+        return false;
+    }
+    if(buffer != nullptr) setvbuf(fp, nullptr, _IONBF, 0);
+    return true;
+}
+
+bool FileWriter::close()
+{
+    if(fp == nullptr) return false;
+
+    bool ok= flush();
+    if(fclose(fp) != 0) ok= false;
+    fp= nullptr;
+    if(shared) FileTail::end(ok);
+    shared= false;
+
+    free_buffer(buffer);
+    free_buffer(spare);
+    buffer= nullptr;
+    spare= nullptr;
+    return ok;
+}
+
+extern "C" {
+    void *file_writer_open(const char *filename, int deferred)
+    {
+        FileWriter *w= new FileWriter;
+        if(!w->open(filename, "w", deferred != 0)) {
+            delete w;
+            return nullptr;
+        }
+        w->share(filename);
+        return w;
+    }
+
+    int file_writer_write(void *w, const void *data, size_t n)
+    {
+        return static_cast<FileWriter *>(w)->write(data, n) ? 1 : 0;
+    }
+
+    int file_writer_has_pending(void *w)
+    {
+        return static_cast<FileWriter *>(w)->has_pending() ? 1 : 0;
+    }
+
+    int file_writer_write_pending(void *w)
+    {
+        return static_cast<FileWriter *>(w)->write_pending() ? 1 : 0;
+    }
+
+    int file_writer_close(void *w, uint32_t *crc)
+    {
+        FileWriter *fw= static_cast<FileWriter *>(w);
+        bool ok= fw->close();
+        if(crc != nullptr) *crc= fw->get_crc();
+        delete fw;
+        return ok ? 1 : 0;
+    }
+}
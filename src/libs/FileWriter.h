@@ -0,0 +1,73 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+
+#include "FileTail.h"
+
+// Writes a file in whole sectors from a staging buffer with stdio buffering turned off, so each write goes
+// straight to f_write and on to the card as a multi sector transfer. Keeps a crc32 of everything written.
+// If deferred a second buffer is used, a full one is only written by write_pending, so the caller can
+// do that later (eg after the ack for the data that filled it has gone out) while the other one fills.
+class FileWriter {
+    public:
+        FileWriter() : fp(nullptr), buffer(nullptr), spare(nullptr), used(0), pending(0), written(0), crc(0), failed(false), shared(false) {}
+        ~FileWriter() { close(); }
+
+        bool open(const char *filename, const char *mode= "w", bool deferred= false);
+        bool is_open() const { return fp != nullptr; }
+        // puts everything written through FileTail as well so the file can be played while it is written
+        void share(const char *filename) { shared= FileTail::begin(filename); }
+
+        // queues n bytes, returns false if the file could not be written
+        bool write(const void *data, size_t n);
+        // writes out the full buffer left by a deferred write
+        bool write_pending();
+        bool has_pending() const { return pending > 0; }
+        // writes out whatever is staged
+        bool flush();
+        // flushes and closes, returns false if any write failed
+        bool close();
+
+        uint32_t get_crc() const { return crc; }
+        uint32_t get_written() const { return written; }
+        size_t get_staged() const { return used; }
+
+        static const size_t buffer_size= 4096; // a whole number of sectors
+
+    private:
+        bool buffer_full();
+        bool checkpoint();
+
+        FILE *fp;
+        char *buffer; // nullptr if it could not be allocated, then writes go straight to fwrite
+        char *spare;  // the second buffer when deferred
+        size_t used;
+        size_t pending; // bytes in spare waiting for write_pending
+        uint32_t written;
+        uint32_t crc;
+        bool failed;
+        bool shared;
+};
+
+#else
+
+// for the C parts of the network stack, the handle is a FileWriter
+extern void *file_writer_open(const char *filename, int deferred);
+extern int file_writer_write(void *w, const void *data, size_t n);
+extern int file_writer_has_pending(void *w);
+extern int file_writer_write_pending(void *w);
+// closes and deletes it, crc may be NULL
+extern int file_writer_close(void *w, uint32_t *crc);
+
+#endif // __cplusplus
@@ -1,14 +1,16 @@
 #ifndef HOOK_H
 #define HOOK_H
 #include "libs/FPointer.h"
+#include <stdint.h>
 
 // Hook is just a glorified FPointer
 
 class Hook : public FPointer {
     public:
         Hook();
-        int     interval;
-        int     countdown;
+        // in SlowTicker timer counts, due is the count at which it is next called
+        uint32_t interval;
+        uint32_t due;
 };
 
 #endif
@@ -18,11 +18,16 @@
 
 #include "libs/StepTicker.h"
 #include "libs/PublicData.h"
+#include "libs/BootTrace.h"
+#include "libs/Trace.h"
+#include "libs/Watchdog.h"
 #include "modules/communication/SerialConsole.h"
 #include "modules/communication/GcodeDispatch.h"
 #include "modules/robot/Planner.h"
 #include "modules/robot/Robot.h"
 #include "modules/robot/Conveyor.h"
+#include "modules/robot/Block.h"
+#include "Gcode.h"
 #include "StepperMotor.h"
 #include "BaseSolution.h"
 #include "EndstopsPublicAccess.h"
@@ -35,9 +40,15 @@
 #endif
 
 #include "platform_memory.h"
+#include "us_ticker_api.h"
+#ifdef EVENT_PROFILE
+#include "CycleCounter.h"
+#endif
 
 #include <malloc.h>
 #include <array>
+#include <algorithm>
+#include <string.h>
 #include <string>
 
 #define laser_checksum CHECKSUM("laser")
@@ -46,11 +57,20 @@
 
 #define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
 #define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define microseconds_direction_setup_checksum       CHECKSUM("microseconds_direction_setup")
+#define variable_step_interval_checksum             CHECKSUM("variable_step_interval")
+#define single_timer_step_pulse_checksum            CHECKSUM("single_timer_step_pulse")
+#define secondary_stepping_divider_checksum         CHECKSUM("secondary_stepping_divider")
 #define disable_leds_checksum                       CHECKSUM("leds_disable")
 #define grbl_mode_checksum                          CHECKSUM("grbl_mode")
 #define feed_hold_enable_checksum                   CHECKSUM("enable_feed_hold")
 #define ok_per_line_checksum                        CHECKSUM("ok_per_line")
 #define new_status_format_checksum                  CHECKSUM("new_status_format")
+#define adc_dma_checksum                            CHECKSUM("adc_dma")
+
+// how old the status snapshot sent for ? may get, hosts poll it at up to 10Hz
+#define status_snapshot_period_us 50000
+#define status_snapshot_size 256
 
 Kernel* Kernel::instance;
 
@@ -62,6 +82,11 @@ Kernel::Kernel()
     enable_feed_hold = false;
 
     instance = this; // setup the Singleton instance of the kernel
+    BootTrace::mark("kernel");
+
+#ifdef EVENT_PROFILE
+    cycle_counter_enable();
+#endif
 
     // serial first at fixed baud rate (DEFAULT_SERIAL_BAUD_RATE) so config can report errors to serial
     // Set to UART0, this will be changed to use the same UART as MRI if it's enabled
@@ -72,6 +97,7 @@ Kernel::Kernel()
 
     // Pre-load the config cache, do after setting up serial so we can report errors to serial
     this->config->config_cache_load();
+    BootTrace::mark("config load");
 
     // now config is loaded we can do normal setup for serial based on config
     delete this->serial;
@@ -129,6 +155,9 @@ Kernel::Kernel()
 
     this->step_ticker = new StepTicker();
     this->adc = new Adc();
+    if(this->config->value( adc_dma_checksum )->by_default(false)->as_bool() && !this->adc->enable_dma()) {
+        this->streams->printf("Error: adc dma could not be enabled, using interrupts\n");
+    }
 
     // TODO : These should go into platform-specific files
     // LPC17xx-specific
@@ -137,11 +166,20 @@ Kernel::Kernel()
     NVIC_SetPriority(TIMER1_IRQn, 1);
     NVIC_SetPriority(TIMER2_IRQn, 4);
     NVIC_SetPriority(PendSV_IRQn, 3);
+    NVIC_SetPriority(RIT_IRQn, 3);      // the secondary step tick, pended by the step ticker
+    // all pin change interrupts share EINT3, the endstop, probe and kill button edges need it as high as the step ticker
+    // so it never lands in the middle of a tick, modules using InterruptIn must not change it
+    NVIC_SetPriority(EINT3_IRQn, 2);
 
     // Set other priorities lower than the timers
     NVIC_SetPriority(ADC_IRQn, 5);
+    NVIC_SetPriority(DMA_IRQn, 5);
     NVIC_SetPriority(USB_IRQn, 5);
 
+    // the SPI bus interrupts run queued transactions, above USB so the sdcard can wait for the bus from there
+    NVIC_SetPriority(SSP0_IRQn, 4);
+    NVIC_SetPriority(SSP1_IRQn, 4);
+
     // If MRI is enabled
     if( MRI_ENABLE ) {
         if( NVIC_GetPriority(UART0_IRQn) > 0 ) { NVIC_SetPriority(UART0_IRQn, 5); }
@@ -162,6 +200,14 @@ Kernel::Kernel()
     // Configure the step ticker
     this->step_ticker->set_frequency( this->base_stepping_frequency );
     this->step_ticker->set_unstep_time( microseconds_per_step_pulse );
+    // external drivers that need the direction well before the step, only the steps just after a direction change wait
+    this->step_ticker->set_dir_setup_time( this->config->value(microseconds_direction_setup_checksum)->by_default(0)->as_number() );
+    // skip the step ticks where no motor can step, reduces the interrupt load for slow moves
+    this->step_ticker->set_variable_interval( this->config->value(variable_step_interval_checksum)->by_default(false)->as_bool() );
+    // end the step pulse from the step timer, which takes one interrupt per step instead of two
+    this->step_ticker->set_single_timer( this->config->value(single_timer_step_pulse_checksum)->by_default(false)->as_bool() );
+    // step the extruders and other motors after XYZ every n step ticks from a lower priority interrupt, 1 steps them with XYZ
+    this->step_ticker->set_secondary_divider( this->config->value(secondary_stepping_divider_checksum)->by_default(1)->as_int() );
 
     // Core modules
     this->add_module( this->conveyor       = new Conveyor()      );
@@ -171,6 +217,48 @@ Kernel::Kernel()
 
     this->planner = new Planner();
     this->configurator = new Configurator();
+
+    for (auto& b : status_snapshot) {
+        b= (char *)AHB0.alloc(status_snapshot_size);
+        if(b == nullptr) b= new char[status_snapshot_size];
+        strcpy(b, "<Idle>\n");
+    }
+}
+
+// this also stops the step ticker in the middle of whatever block it is running, not just the queuing of new ones
+void Kernel::set_feed_hold(bool f)
+{
+    feed_hold= f;
+    step_ticker->set_feed_hold(f);
+    status_stale= true;
+}
+
+// format the status into the back buffer then make it the front one, a reader of the front buffer is not disturbed
+void Kernel::refresh_status_snapshot()
+{
+    status_stale= false;
+    status_time= us_ticker_read();
+    std::string s= get_query_string();
+    uint8_t back= status_front ^ 1;
+    size_t n= std::min(s.size(), (size_t)status_snapshot_size - 3);
+    memcpy(status_snapshot[back], s.data(), n);
+    if(n < s.size()) {
+        // truncated, keep it terminated like the full one
+        status_snapshot[back][n++]= '>';
+        status_snapshot[back][n++]= '\n';
+    }
+    status_snapshot[back][n]= '\0';
+    __DMB();
+    status_front= back;
+}
+
+// the reply to ?, formatted in advance so it can be sent straight away even when the main loop is busy
+// it is refreshed every status_snapshot_period_us from idle, and immediately after the state changes
+const char *Kernel::get_status_snapshot()
+{
+    if(status_snapshot[1] == nullptr) return "<Idle>\n";
+    if(status_stale) refresh_status_snapshot();
+    return status_snapshot[status_front];
 }
 
 // return a GRBL-like query string for serial ?
@@ -242,6 +330,16 @@ std::string Kernel::get_query_string()
             if(n > sizeof(buf)) n= sizeof(buf);
             str.append(buf, n);
 
+            // the line the running block was queued from and how much of it is done, from the steps of its primary motor
+            const Block *b= step_ticker->get_current_block();
+            if(b != nullptr) {
+                const Block::tickinfo_t &ti= b->tick_info[b->primary_motor];
+                float done= ti.steps_to_move > 0 ? (float)ti.step_count / ti.steps_to_move : 0.0F;
+                n = b->source_line > 0 ? snprintf(buf, sizeof(buf), "|Ln:%lu|Blk:%1.4f", b->source_line, done) : snprintf(buf, sizeof(buf), "|Blk:%1.4f", done);
+                if(n > sizeof(buf)) n= sizeof(buf);
+                str.append(buf, n);
+            }
+
             // current Laser power
             #ifndef NO_TOOLS_LASER
                 Laser *plaser= nullptr;
@@ -322,13 +420,159 @@ std::string Kernel::get_query_string()
 // Add a module to Kernel. We don't actually hold a list of modules we just call its on_module_loaded
 void Kernel::add_module(Module* module)
 {
+    // a disabled module deletes itself in on_module_loaded
+    const void *vtable= *(void **)module;
     module->on_module_loaded();
+    BootTrace::mark("module", vtable);
 }
 
 // Adds a hook for a given module and event
-void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod)
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod, uint8_t priority, uint32_t period_us, uint32_t budget_us)
+{
+    // keep the hooks sorted by priority, after any already registered with the same priority
+    auto& v= this->hooks[id_event];
+    auto i= v.begin();
+    while(i != v.end() && i->priority <= priority) ++i;
+    // gcc's bound member function extension looks the handler up once here, a module has its final vtable by the
+    // time it registers as that is done from on_module_loaded or the constructor of a class nothing derives from
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpmf-conversions"
+    HookFunction fn= (HookFunction)(mod->*kernel_callback_functions[id_event]);
+#pragma GCC diagnostic pop
+    v.insert(i, Hook{mod, fn, period_us, budget_us, 0, priority, false, false});
+    if(id_event == ON_GCODE_RECEIVED) gcode_routes_stale= true;
+}
+
+void Kernel::register_for_gcode(Module *mod, char letter, uint16_t code, uint8_t priority)
+{
+    if(code >= 0x8000) return; // can not be routed, only a catch all would see it
+    if(!kernel_has_event(ON_GCODE_RECEIVED, mod)) register_for_event(ON_GCODE_RECEIVED, mod, priority);
+    for (auto& h : hooks[ON_GCODE_RECEIVED]) {
+        if(h.module == mod) h.routed= true;
+    }
+
+    uint16_t key= gcode_key(letter == 'M', code);
+    for (auto& c : gcode_codes) {
+        if(c.module == mod && c.key == key) return;
+    }
+    gcode_codes.push_back(GcodeCode{mod, key});
+    gcode_routes_stale= true;
+}
+
+void Kernel::unregister_for_gcodes(Module *mod)
 {
-    this->hooks[id_event].push_back(mod);
+    gcode_codes.erase(std::remove_if(gcode_codes.begin(), gcode_codes.end(), [mod](const GcodeCode& c) { return c.module == mod; }), gcode_codes.end());
+    gcode_routes_stale= true;
+}
+
+void Kernel::build_gcode_routes()
+{
+    auto& v= hooks[ON_GCODE_RECEIVED];
+    gcode_routes.clear();
+    gcode_catch_all.clear();
+    for (uint16_t i = 0; i < v.size(); i++) {
+        if(!v[i].routed) {
+            gcode_catch_all.push_back(i);
+            continue;
+        }
+        for (auto& c : gcode_codes) {
+            if(c.module == v[i].module) gcode_routes.push_back(GcodeRoute{c.key, i});
+        }
+    }
+    // they went in by hook, this keeps that order within each code
+    std::stable_sort(gcode_routes.begin(), gcode_routes.end(), [](const GcodeRoute& a, const GcodeRoute& b) { return a.key < b.key; });
+    gcode_routes_stale= false;
+}
+
+void Kernel::dispatch_gcode(void *argument)
+{
+    if(gcode_routes_stale && gcode_depth == 0) build_gcode_routes();
+
+    auto& v= hooks[ON_GCODE_RECEIVED];
+    if(gcode_routes_stale) {
+        // registered from inside a gcode handler, the routes are out of date until that is done so just send it to everyone
+        for (size_t i = 0; i < v.size(); i++) {
+            call_hook(v[i], ON_GCODE_RECEIVED, argument);
+        }
+        return;
+    }
+
+    const Gcode *gcode= static_cast<const Gcode *>(argument);
+    const GcodeRoute *r= nullptr, *r_end= nullptr;
+    if(gcode->has_g != gcode->has_m) {
+        uint16_t key= gcode_key(gcode->has_m, gcode->has_m ? gcode->m : gcode->g);
+        auto range= std::equal_range(gcode_routes.begin(), gcode_routes.end(), GcodeRoute{key, 0},
+            [](const GcodeRoute& a, const GcodeRoute& b) { return a.key < b.key; });
+        r= gcode_routes.data() + (range.first - gcode_routes.begin());
+        r_end= gcode_routes.data() + (range.second - gcode_routes.begin());
+    }
+
+    // merge the ones routed to with the catch all ones, both are in hook order
+    ++gcode_depth;
+    const uint16_t *c= gcode_catch_all.data(), *c_end= c + gcode_catch_all.size();
+    while(true) {
+        uint16_t next;
+        if(r < r_end && (c == c_end || r->hook < *c)) next= (r++)->hook;
+        else if(c < c_end) next= *c++;
+        else break;
+        call_hook(v[next], ON_GCODE_RECEIVED, argument);
+    }
+    --gcode_depth;
+}
+
+// blocking waits call ON_IDLE from inside a main loop or idle handler, low priority hooks are not called more often
+// than this in there so the motion feeding hooks get the time
+#define nested_low_priority_period_us 20000
+
+bool Kernel::hook_is_due(Hook& h, uint8_t depth)
+{
+    uint32_t period= h.period_us;
+    if(h.priority == PRIORITY_LOW && depth > 1 && period < nested_low_priority_period_us) period= nested_low_priority_period_us;
+    if(period != 0) {
+        uint32_t now= us_ticker_read();
+        if(now - h.last_us < period) return false;
+        h.last_us= now;
+    }
+    if(h.skip_next) {
+        // overran its budget last time
+        h.skip_next= false;
+        return false;
+    }
+    return true;
+}
+
+inline void Kernel::call_hook(Hook& h, _EVENT_ENUM id_event, void *argument)
+{
+#ifdef EVENT_PROFILE
+    // events called from inside this handler are counted against their own module, not this one
+    uint32_t outer= nested_cycles;
+    nested_cycles= 0;
+    uint32_t start= cycle_counter_read();
+    h.fn(h.module, argument);
+    uint32_t elapsed= cycle_counter_read() - start;
+    uint32_t self= elapsed - nested_cycles;
+    nested_cycles= outer + elapsed;
+    ++h.count;
+    h.total_cycles += self;
+    if(self > h.max_cycles) h.max_cycles= self;
+#else
+    h.fn(h.module, argument);
+#endif
+}
+
+bool Kernel::yield(uint32_t interval_us)
+{
+    Watchdog::feed();
+
+    if(idle_depth == 0) {
+        uint32_t now= us_ticker_read();
+        if(interval_us == 0 || now - yield_time >= interval_us) {
+            yield_time= now;
+            call_event(ON_IDLE);
+        }
+    }
+
+    return halted;
 }
 
 // Call a specific event with an argument
@@ -340,12 +584,53 @@ void Kernel::call_event(_EVENT_ENUM id_event, void * argument)
         was_idle = conveyor->is_idle(); // see if we were doing anything like printing
     }
 
-    // send to all registered modules
-    for (auto m : hooks[id_event]) {
-        (m->*kernel_callback_functions[id_event])(argument);
+#ifdef EVENT_TRACE
+    if(id_event == ON_IDLE) {
+        // the main loop stalled if nothing idled for this long, whatever it was doing
+        const uint32_t idle_gap_us= 10000;
+        uint32_t now= us_ticker_read();
+        if(idle_time != 0 && now - idle_time > idle_gap_us) TRACE(Trace::IDLE_GAP, 0, std::min<uint32_t>((now - idle_time) / 1000, 65535));
+        idle_time= now;
+    } else if(id_event == ON_HALT) {
+        TRACE(argument == nullptr ? Trace::HALT : Trace::HALT_CLEAR);
+    }
+#endif
+
+    if(id_event == ON_IDLE && status_snapshot[1] != nullptr && (status_stale || us_ticker_read() - status_time >= status_snapshot_period_us)) {
+        refresh_status_snapshot();
+    }
+
+    auto& v= hooks[id_event];
+    if(id_event == ON_MAIN_LOOP || id_event == ON_IDLE) {
+        // the main loop and idle are scheduled by priority, period and budget
+        uint8_t depth= ++loop_depth;
+        if(id_event == ON_IDLE) ++idle_depth;
+        for (size_t i = 0; i < v.size(); i++) {
+            Hook& h= v[i];
+            if(!hook_is_due(h, depth)) continue;
+            if(h.budget_us == 0) {
+                call_hook(h, id_event, argument);
+            } else {
+                uint32_t start= us_ticker_read();
+                call_hook(h, id_event, argument);
+                if(us_ticker_read() - start > h.budget_us) h.skip_next= true;
+            }
+        }
+        --loop_depth;
+        if(id_event == ON_IDLE) --idle_depth;
+
+    } else if(id_event == ON_GCODE_RECEIVED) {
+        dispatch_gcode(argument);
+
+    } else {
+        // send to all registered modules
+        for (size_t i = 0; i < v.size(); i++) {
+            call_hook(v[i], id_event, argument);
+        }
     }
 
     if(id_event == ON_HALT) {
+        status_stale= true;
         if(!this->halted || !was_idle) {
             // if we were running and this is a HALT
             // or if we are clearing the halt with $X or M999
@@ -355,11 +640,53 @@ void Kernel::call_event(_EVENT_ENUM id_event, void * argument)
     }
 }
 
+#ifdef EVENT_PROFILE
+static const char *event_names[NUMBER_OF_DEFINED_EVENTS]= {
+    "main_loop", "console_line", "gcode", "idle", "second_tick", "get_public_data", "set_public_data", "halt", "enable", "config_reload"
+};
+
+// one line per module and event it has been called for, module is the address of the module to look up in the map file
+// the cycles used by events called from inside a handler are not included in that handler
+void Kernel::print_event_profile(StreamOutput *stream)
+{
+    uint64_t all= 0;
+    for (auto& v : hooks) {
+        for (auto& h : v) all += h.total_cycles;
+    }
+    if(all == 0) {
+        stream->printf("no samples\n");
+        return;
+    }
+
+    uint32_t mhz= SystemCoreClock / 1000000;
+    stream->printf("event           module     calls      total ms  avg us  max us  %%cpu\n");
+    for (int e = 0; e < NUMBER_OF_DEFINED_EVENTS; ++e) {
+        for (auto& h : hooks[e]) {
+            if(h.count == 0) continue;
+            stream->printf("%-15s %p %9lu %9lu %7lu %7lu %5.1f\n", event_names[e], h.module, h.count,
+                (uint32_t)(h.total_cycles / (mhz * 1000)), (uint32_t)(h.total_cycles / h.count / mhz), h.max_cycles / mhz,
+                h.total_cycles * 100.0F / all);
+        }
+    }
+}
+
+void Kernel::reset_event_profile()
+{
+    for (auto& v : hooks) {
+        for (auto& h : v) {
+            h.count= 0;
+            h.max_cycles= 0;
+            h.total_cycles= 0;
+        }
+    }
+}
+#endif
+
 // These are used by tests to test for various things. basically mocks
 bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
 {
-    for (auto m : hooks[id_event]) {
-        if(m == mod) return true;
+    for (auto& h : hooks[id_event]) {
+        if(h.module == mod) return true;
     }
     return false;
 }
@@ -367,8 +694,9 @@ bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
 void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
 {
     for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
-        if(*i == mod) {
+        if(i->module == mod) {
             hooks[id_event].erase(i);
+            if(id_event == ON_GCODE_RECEIVED) unregister_for_gcodes(mod);
             return;
         }
     }
@@ -32,6 +32,7 @@ class Adc;
 class PublicData;
 class SimpleShell;
 class Configurator;
+class StreamOutput;
 
 class Kernel {
     public:
@@ -40,10 +41,24 @@ class Kernel {
         const char* config_override_filename(){ return "/sd/config-override"; }
 
         void add_module(Module* module);
-        void register_for_event(_EVENT_ENUM id_event, Module *module);
+        void register_for_event(_EVENT_ENUM id_event, Module *module, uint8_t priority= PRIORITY_NORMAL, uint32_t period_us= 0, uint32_t budget_us= 0);
         void call_event(_EVENT_ENUM id_event, void * argument= nullptr);
 
         bool kernel_has_event(_EVENT_ENUM id_event, Module *module);
+
+        // the module is only called on ON_GCODE_RECEIVED for the G and M codes it registers, instead of for every gcode.
+        // This also registers it for ON_GCODE_RECEIVED at the given priority if it is not already, the modules that
+        // only register for the event still get every gcode. Either way the order they are called in is the same
+        void register_for_gcode(Module *module, char letter, uint16_t code, uint8_t priority= PRIORITY_NORMAL);
+        // drops the codes the module registered, it is not called for any gcode until it registers some again
+        void unregister_for_gcodes(Module *module);
+
+        // for work that takes a long time in one handler, call it every so often instead of calling ON_IDLE directly
+        // feeds the watchdog and gives everything on ON_IDLE a turn, so ^X, ? and the network are still serviced,
+        // but runs idle at most once every interval_us so it can be called on every pass of a tight loop
+        // from inside ON_IDLE it only feeds the watchdog, as going round idle again would call the running handler again
+        // returns true if halted so the caller can give up
+        bool yield(uint32_t interval_us= 0);
         void unregister_for_event(_EVENT_ENUM id_event, Module *module);
 
         bool is_using_leds() const { return use_leds; }
@@ -51,11 +66,19 @@ class Kernel {
         bool is_grbl_mode() const { return grbl_mode; }
         bool is_ok_per_line() const { return ok_per_line; }
 
-        void set_feed_hold(bool f) { feed_hold= f; }
+        void set_feed_hold(bool f);
         bool get_feed_hold() const { return feed_hold; }
         bool is_feed_hold_enabled() const { return enable_feed_hold; }
 
         std::string get_query_string();
+        const char *get_status_snapshot();
+        void invalidate_status_snapshot() { status_stale= true; }
+
+#ifdef EVENT_PROFILE
+        // cycles used by each module in each event, only compiled in if EVENT_PROFILE is set in src/makefile
+        void print_event_profile(StreamOutput *stream);
+        void reset_event_profile();
+#endif
 
         // These modules are available to all other modules
         SerialConsole*    serial;
@@ -76,7 +99,64 @@ class Kernel {
 
     private:
         // When a module asks to be called for a specific event ( a hook ), this is where that request is remembered
-        std::array<std::vector<Module*>, NUMBER_OF_DEFINED_EVENTS> hooks;
+        // for ON_MAIN_LOOP and ON_IDLE a hook is not called again until period_us has passed since it last was,
+        // and a hook that takes longer than its budget_us misses its next turn
+        // fn is the handler the module's vtable had for the event when it registered, so a call does not have
+        // to go through the member pointer and the vtable each time
+        typedef void (*HookFunction)(Module *module, void *argument);
+        struct Hook {
+            Module *module;
+            HookFunction fn;
+            uint32_t period_us;
+            uint32_t budget_us;
+            uint32_t last_us;
+            uint8_t priority;
+            bool skip_next;
+            bool routed; // ON_GCODE_RECEIVED only for the codes it registered
+#ifdef EVENT_PROFILE
+            uint32_t count;
+            uint32_t max_cycles;
+            uint64_t total_cycles;
+#endif
+        };
+        bool hook_is_due(Hook& h, uint8_t depth);
+        void call_hook(Hook& h, _EVENT_ENUM id_event, void *argument);
+#ifdef EVENT_PROFILE
+        uint32_t nested_cycles{0}; // cycles used by the events called from inside the handler being timed
+#endif
+        std::array<std::vector<Hook>, NUMBER_OF_DEFINED_EVENTS> hooks;
+
+        // ON_GCODE_RECEIVED goes to the hooks that registered the gcode's code, looked up in gcode_routes sorted by code,
+        // and to every hook in gcode_catch_all. Both are hook indices in order so merging them keeps the hook order
+        static uint16_t gcode_key(bool m, uint16_t code) { return (m ? 0x8000 : 0) | code; }
+        void dispatch_gcode(void *argument);
+        void build_gcode_routes();
+        struct GcodeCode {
+            Module *module;
+            uint16_t key;
+        };
+        struct GcodeRoute {
+            uint16_t key;
+            uint16_t hook;
+        };
+        std::vector<GcodeCode> gcode_codes; // what each module registered
+        std::vector<GcodeRoute> gcode_routes;
+        std::vector<uint16_t> gcode_catch_all;
+        uint8_t gcode_depth{0}; // how many ON_GCODE_RECEIVED calls are running, the routes are only rebuilt when none are
+        bool gcode_routes_stale{true};
+        uint8_t loop_depth{0}; // how deeply ON_MAIN_LOOP and ON_IDLE are nested inside each other
+        uint8_t idle_depth{0}; // how many ON_IDLE calls are running
+        uint32_t yield_time{0}; // when yield last ran idle
+#ifdef EVENT_TRACE
+        uint32_t idle_time{0}; // when ON_IDLE was last called, for the idle gaps in the trace
+#endif
+
+        // the reply to ? is formatted from idle into the back buffer and then swapped to the front
+        void refresh_status_snapshot();
+        char *status_snapshot[2]{nullptr, nullptr}; // allocated once all the core modules are loaded
+        uint32_t status_time{0};
+        volatile uint8_t status_front{0};
+        volatile bool status_stale{true}; // state changed, format it again before it is next sent
         struct {
             bool use_leds:1;
             bool halted:1;
@@ -173,6 +173,8 @@ typedef struct
   __I  uint32_t ISAR[5];                      /*!< ISA Feature Register                                     */
 } SCB_Type;
 
+#define SCB_ICSR_PENDSVSET_Msk         (1UL << 28)                    /*!< SCB ICSR: PENDSVSET, pends PendSV    */
+
 
 /* memory mapping struct for SysTick */
 typedef struct
@@ -509,6 +511,9 @@ static __INLINE void __disable_irq()              { __ASM volatile ("cpsid i");
 static __INLINE void __enable_fault_irq()         { __ASM volatile ("cpsie f"); }
 static __INLINE void __disable_fault_irq()        { __ASM volatile ("cpsid f"); }
 
+static __INLINE uint32_t __get_BASEPRI()          { uint32_t result; __ASM volatile ("mrs %0, basepri" : "=r" (result)); return result; }
+static __INLINE void __set_BASEPRI(uint32_t value) { __ASM volatile ("msr basepri, %0" : : "r" (value) : "memory"); }
+
 static __INLINE void __NOP()                      { __ASM volatile ("nop"); }
 static __INLINE void __WFI()                      { __ASM volatile ("wfi"); }
 static __INLINE void __WFE()                      { __ASM volatile ("wfe"); }
@@ -0,0 +1,77 @@
+#ifndef LINESTRING_H
+#define LINESTRING_H
+
+#include <string>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+// The text of a console line, kept inline so passing a line around does not touch the heap.
+// Lines up to size_inline characters, what the player allows, stay in the object; a longer one, which can only
+// come from a host, goes to malloc rather than being cut. It converts to a std::string for the commands
+// that want to pull it apart, everything on the way to the Gcode parser only needs data() and size().
+class LineString {
+public:
+    static const size_t size_inline= 128;
+
+    LineString() { init(); }
+    LineString(const char *s) { init(); assign(s, strlen(s)); }
+    LineString(const std::string &s) { init(); assign(s.data(), s.size()); }
+    LineString(const LineString &s) { init(); assign(s.data(), s.size()); }
+    ~LineString() { if(heap != nullptr) free(heap); }
+
+    LineString& operator= (const LineString &s) { if(this != &s) assign(s.data(), s.size()); return *this; }
+    LineString& operator= (const std::string &s) { assign(s.data(), s.size()); return *this; }
+    LineString& operator= (const char *s) { assign(s, strlen(s)); return *this; }
+
+    // if there is no memory for a long line it is cut to what fits
+    void assign(const char *s, size_t n)
+    {
+        if(n > 0xFFF0) n= 0xFFF0;
+        if(n > cap) n= reserve(n);
+        memmove(ptr(), s, n);
+        len= n;
+        ptr()[len]= '\0';
+    }
+
+    LineString& operator+= (char c)
+    {
+        if(len < cap || reserve(cap * 2) > len) {
+            ptr()[len++]= c;
+            ptr()[len]= '\0';
+        }
+        return *this;
+    }
+
+    void clear() { len= 0; ptr()[0]= '\0'; }
+
+    const char *data() const { return heap != nullptr ? heap : buf; }
+    const char *c_str() const { return data(); }
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    char operator[] (size_t i) const { return data()[i]; }
+
+    operator std::string() const { return std::string(data(), len); }
+
+private:
+    void init() { heap= nullptr; len= 0; cap= size_inline; buf[0]= '\0'; }
+    char *ptr() { return heap != nullptr ? heap : buf; }
+
+    // room for n characters on the heap, returns the capacity it has
+    size_t reserve(size_t n)
+    {
+        char *p= (char *)realloc(heap, n + 1);
+        if(p == nullptr) return cap;
+        if(heap == nullptr) memcpy(p, buf, len + 1);
+        heap= p;
+        cap= n;
+        return cap;
+    }
+
+    char *heap;
+    uint16_t len;
+    uint16_t cap;
+    char buf[size_inline + 1];
+};
+
+#endif
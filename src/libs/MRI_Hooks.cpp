@@ -25,9 +25,23 @@ extern "C" {
     };
 
     static uint32_t _previous_state[5];
+    static uint32_t _previous_pinsel[10];
 
     static LPC_GPIO_TypeDef* io;
-    static int i;
+    static int i, j;
+    static uint32_t mask;
+
+    // a heater or fan may be driven by PWM1 rather than the GPIO, so the pins are put back to GPIO while in the
+    // debugger and the FIOSET/FIOCLR applies, each PINSEL register has two bits per pin for half a port
+    static uint32_t pinsel_mask(int reg)
+    {
+        uint32_t pins = (_set_high_on_debug[reg / 2] | _set_low_on_debug[reg / 2]) >> ((reg & 1) * 16);
+        mask = 0;
+        for (j = 0; j < 16; j++) {
+            if (pins & (1 << j)) mask |= (3 << (j * 2));
+        }
+        return mask;
+    }
 
     void __mriPlatform_EnteringDebuggerHook()
     {
@@ -41,6 +55,12 @@ extern "C" {
             io->FIOSET   = _set_high_on_debug[i];
             io->FIOCLR   = _set_low_on_debug[i];
         }
+
+        for (i = 0; i < 10; i++)
+        {
+            _previous_pinsel[i] = (&LPC_PINCON->PINSEL0)[i];
+            (&LPC_PINCON->PINSEL0)[i] &= ~pinsel_mask(i);
+        }
     }
 
     void __mriPlatform_LeavingDebuggerHook()
@@ -52,6 +72,11 @@ extern "C" {
             io->FIOSET   =   _previous_state[i]  & (_set_high_on_debug[i] | _set_low_on_debug[i]);
             io->FIOCLR   = (~_previous_state[i]) & (_set_high_on_debug[i] | _set_low_on_debug[i]);
         }
+
+        for (i = 0; i < 10; i++)
+        {
+            (&LPC_PINCON->PINSEL0)[i] = _previous_pinsel[i];
+        }
     }
 
     void set_high_on_debug(int port, int pin)
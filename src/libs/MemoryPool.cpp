@@ -42,6 +42,8 @@ MemoryPool::MemoryPool(void* base, uint16_t size)
 {
     this->base = base;
     this->size = size;
+    this->used = 0;
+    this->high_water = 0;
 
     ((_poolregion*) base)->used = 0;
     ((_poolregion*) base)->next = size;
@@ -77,6 +79,10 @@ MemoryPool::~MemoryPool()
 
 void* MemoryPool::alloc(size_t nbytes)
 {
+    // too big for the pool, this also keeps nsize from overflowing
+    if (nbytes + sizeof(_poolregion) > size)
+        return NULL;
+
     // nbytes = ceil(nbytes / 4) * 4
     if (nbytes & 3)
         nbytes += 4 - (nbytes & 3);
@@ -121,6 +127,9 @@ void* MemoryPool::alloc(size_t nbytes)
                 }
             }
 
+            used += p->next;
+            if (used > high_water) high_water = used;
+
             // then return the data region for the block
             return &p->data;
         }
@@ -128,8 +137,8 @@ void* MemoryPool::alloc(size_t nbytes)
         // p = p->next
         p = (_poolregion*) (((uint8_t*) p) + p->next);
 
-        // make sure we don't walk off the end
-    } while (p <= (_poolregion*) (((uint8_t*)base) + size));
+        // make sure we don't walk off the end, the header there belongs to whatever follows the pool
+    } while (p < (_poolregion*) (((uint8_t*)base) + size));
 
     // fell off the end of the region!
     return NULL;
@@ -139,6 +148,7 @@ void MemoryPool::dealloc(void* d)
 {
     _poolregion* p = (_poolregion*) (((uint8_t*) d) - sizeof(_poolregion));
     p->used = 0;
+    used -= p->next;
 
     MDEBUG("\tdeallocating %p (%+d, %db)\n", p, offset(p), p->next);
 
@@ -242,3 +252,23 @@ uint32_t MemoryPool::free()
         p = (_poolregion*) (((uint8_t*) p) + p->next);
     } while (1);
 }
+
+uint32_t MemoryPool::largest_free()
+{
+    uint32_t largest = 0;
+
+    _poolregion* p = (_poolregion*) base;
+
+    do {
+        if (p->used == 0 && p->next > largest)
+            largest = p->next;
+        if (offset(p) + p->next >= size)
+            break;
+        if (p->next <= sizeof(_poolregion))
+            break;
+        p = (_poolregion*) (((uint8_t*) p) + p->next);
+    } while (1);
+
+    // less the header it would need
+    return largest > sizeof(_poolregion) ? largest - sizeof(_poolregion) : 0;
+}
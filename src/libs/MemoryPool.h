@@ -33,6 +33,11 @@ public:
     bool  has(void*);
 
     uint32_t free(void);
+    // the biggest single allocation that would succeed, with free() it shows how fragmented it is
+    uint32_t largest_free(void);
+    // the most that has been allocated at once, including the headers
+    uint32_t get_high_water(void) const { return high_water; }
+    uint32_t get_used(void) const { return used; }
 
     MemoryPool* next;
 
@@ -41,6 +46,8 @@ public:
 private:
     void* base;
     uint16_t size;
+    uint32_t used;
+    uint32_t high_water;
 };
 
 // this overloads "placement new"
@@ -22,13 +22,19 @@ const ModuleCallback kernel_callback_functions[NUMBER_OF_DEFINED_EVENTS] = {
     &Module::on_get_public_data,
     &Module::on_set_public_data,
     &Module::on_halt,
-    &Module::on_enable
+    &Module::on_enable,
+    &Module::on_config_reload
 
 };
 
 
-void Module::register_for_event(_EVENT_ENUM event_id){
+void Module::register_for_event(_EVENT_ENUM event_id, uint8_t priority, uint32_t period_us, uint32_t budget_us){
     // Events are the basic building blocks of Smoothie. They register for events, and then do stuff when those events are called.
     // You add things to Smoothie by making a new class that inherits the Module class. See http://smoothieware.org/moduleexample for a crude introduction
-    THEKERNEL->register_for_event(event_id, this);
+    THEKERNEL->register_for_event(event_id, this, priority, period_us, budget_us);
+}
+
+void Module::register_for_gcode(char letter, uint16_t code, uint8_t priority)
+{
+    THEKERNEL->register_for_gcode(this, letter, code, priority);
 }
@@ -8,6 +8,8 @@
 #ifndef MODULE_H
 #define MODULE_H
 
+#include <stdint.h>
+
 // See : http://smoothieware.org/listofevents
 // When adding a new event the virtual method needs to be defined in class Module and the method pointer need to be defined in
 // Module.cpp:16 in the same order
@@ -21,9 +23,18 @@ enum _EVENT_ENUM {
     ON_SET_PUBLIC_DATA,
     ON_HALT,
     ON_ENABLE,
+    ON_CONFIG_RELOAD,
     NUMBER_OF_DEFINED_EVENTS
 };
 
+// order in which the modules registered for an event are called, lower numbers first, modules with the same
+// priority are called in the order they registered. Only ON_MAIN_LOOP and ON_IDLE also honour a period and budget
+enum _EVENT_PRIORITY {
+    PRIORITY_HIGH= 0,       // feeds motion or reads commands, always called even when ON_IDLE is called from a blocking wait
+    PRIORITY_NORMAL= 128,
+    PRIORITY_LOW= 255       // user interface and housekeeping, rate limited while ON_IDLE is called from a blocking wait
+};
+
 class Module;
 typedef void (Module::*ModuleCallback)(void *argument);
 extern const ModuleCallback kernel_callback_functions[NUMBER_OF_DEFINED_EVENTS];
@@ -37,7 +48,9 @@ public:
     virtual ~Module();
     virtual void on_module_loaded() {};
 
-    void register_for_event(_EVENT_ENUM event_id);
+    void register_for_event(_EVENT_ENUM event_id, uint8_t priority= PRIORITY_NORMAL, uint32_t period_us= 0, uint32_t budget_us= 0);
+    // only get on_gcode_received for these codes, letter is G or M, see Kernel::register_for_gcode()
+    void register_for_gcode(char letter, uint16_t code, uint8_t priority= PRIORITY_NORMAL);
 
     // event callbacks, not every module will implement all of these
     // there should be one for each _EVENT_ENUM
@@ -50,6 +63,8 @@ public:
     virtual void on_set_public_data(void *) {};
     virtual void on_halt(void *) {};
     virtual void on_enable(void *) {};
+    // the config cache is loaded while this is called, re-read the settings that can be changed without a reset
+    virtual void on_config_reload(void *) {};
 
 };
 
@@ -196,6 +196,7 @@ LPC17XX_Ethernet::LPC17XX_Ethernet()
     instance = this;
 
     up = false;
+    rx_pending = false;
 }
 
 void LPC17XX_Ethernet::on_module_loaded()
@@ -359,12 +360,16 @@ void LPC17XX_Ethernet::emac_init()
     // Set Receive Filter register: enable broadcast and multicast
     LPC_EMAC->RxFilterCtrl = EMAC_RFC_BCAST_EN | EMAC_RFC_PERFECT_EN;
 
-    /* Enable Rx Done and Tx Done interrupt for EMAC */
-    LPC_EMAC->IntEnable = EMAC_INT_RX_DONE | EMAC_INT_TX_DONE;
+    /* Enable Rx Done interrupt for EMAC, it just flags that frames are waiting */
+    LPC_EMAC->IntEnable = EMAC_INT_RX_DONE;
 
     /* Reset all interrupts */
     LPC_EMAC->IntClear  = 0xFFFF;
 
+    // same priority as the other comms interrupts, below the timers
+    NVIC_SetPriority(ENET_IRQn, 5);
+    NVIC_EnableIRQ(ENET_IRQn);
+
     /* Enable receive and transmit mode of MAC Ethernet core */
     LPC_EMAC->Command  = EMAC_CR_RX_EN | EMAC_CR_TX_EN | EMAC_CR_RMII | EMAC_CR_FULL_DUP | EMAC_CR_PASS_RUNT_FRM;
     LPC_EMAC->MAC1     |= EMAC_MAC1_REC_EN;
@@ -407,16 +412,16 @@ bool LPC17XX_Ethernet::_receive_frame(void *packet, int *size)
     return false;
 }
 
+// the stack is not reentrant and the apps touch the file system, so the frames are only flagged here
+// and are processed from the main loop
 void LPC17XX_Ethernet::irq()
 {
-    // if (EMAC_IntGetStatus(EMAC_INT_RX_DONE))
-    // {
-    //     //_receive_frame();
-    // }
-
-    // if (EMAC_IntGetStatus(EMAC_INT_TX_DONE))
-    // {
-    // }
+    uint32_t st = LPC_EMAC->IntStatus;
+    LPC_EMAC->IntClear = st;
+
+    if (st & EMAC_INT_RX_DONE) {
+        rx_pending = true;
+    }
 }
 
 bool LPC17XX_Ethernet::can_read_packet()
@@ -446,10 +451,10 @@ bool LPC17XX_Ethernet::can_write_packet()
     return (r != LPC_EMAC->TxConsumeIndex);
 }
 
+// the buffer of the descriptor at TxProduceIndex is never owned by the DMA so it can always be written,
+// if buf is that buffer, as it is when the packet was built in place, there is nothing to copy
 int LPC17XX_Ethernet::write_packet(uint8_t* buf, int size)
 {
-    txbuf.txdesc[LPC_EMAC->TxProduceIndex].control = ((size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
-
     uint32_t r = LPC_EMAC->TxProduceIndex + 1;
     if (r > LPC_EMAC->TxDescriptorNumber)
         r = 0;
@@ -457,6 +462,10 @@ int LPC17XX_Ethernet::write_packet(uint8_t* buf, int size)
     if (r == LPC_EMAC->TxConsumeIndex)
         return 0;
 
+    packet_desc *desc = &txbuf.txdesc[LPC_EMAC->TxProduceIndex];
+    if (buf != desc->packet) memcpy(desc->packet, buf, size);
+    desc->control = ((size - 1) & 0x7ff) | EMAC_TCTRL_LAST | EMAC_TCTRL_CRC | EMAC_TCTRL_PAD | EMAC_TCTRL_INT;
+
     LPC_EMAC->TxProduceIndex = r;
 
     return size;
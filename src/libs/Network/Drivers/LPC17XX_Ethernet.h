@@ -11,7 +11,12 @@
 // SMSC 8720A special control/status register
 #define EMAC_PHY_REG_SCSR 0x1F
 
+// the descriptor buffers live in AHBSRAM1 and uip works in them directly, 4 + 4 full frames still fit in the 16K bank
+#ifdef NETWORK_FULL_MTU
+#define LPC17XX_MAX_PACKET 1536
+#else
 #define LPC17XX_MAX_PACKET 600
+#endif
 #define LPC17XX_TXBUFS     4
 #define LPC17XX_RXBUFS     4
 
@@ -49,6 +54,10 @@ public:
 
     void irq(void);
 
+    // set by the RX interrupt, consumed by whoever runs the stack
+    bool take_rx_pending() { bool p= rx_pending; rx_pending= false; return p; }
+    void set_rx_pending() { rx_pending= true; }
+
     bool _receive_frame(void *packet, int* size);
 
     // NetworkInterface methods
@@ -77,6 +86,8 @@ private:
     static _txbuf_t txbuf;
 
     void check_interface();
+
+    volatile bool rx_pending;
 };
 
 #endif /* _LPC17XX_ETHERNET_H */
@@ -1,31 +1,64 @@
 #include "CallbackStream.h"
 #include "Kernel.h"
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "SerialConsole.h"
+#include "Network.h"
+#include "us_ticker_api.h"
+#include "SlabPool.h"
 #define DEBUG_PRINTF THEKERNEL->serial->printf
 
-CallbackStream::CallbackStream(cb_t cb, void *u)
+CallbackStream *CallbackStream::head= nullptr;
+uint32_t CallbackStream::coalesce_us= 10000;
+
+// one per connection that is waiting on a command, and those that are waiting to be released
+static SlabPool stream_pool("CallbackStream", sizeof(CallbackStream), 4);
+
+void *CallbackStream::operator new(size_t size)
+{
+    return stream_pool.alloc(size);
+}
+
+void CallbackStream::operator delete(void *p)
+{
+    stream_pool.dealloc(p);
+}
+
+CallbackStream::CallbackStream(cb_t cb, void *u, uint16_t coalesce)
 {
     DEBUG_PRINTF("Callbackstream ctor: %p\n", this);
     callback= cb;
     user= u;
     closed= false;
+    flushing= false;
     use_count= 0;
+    olen= 0;
+    osize= 0;
+    obuf= nullptr;
+    if(coalesce > 0 && coalesce_us > 0) {
+        obuf= (char *)malloc(coalesce + 1);
+        if(obuf != nullptr) osize= coalesce;
+    }
+    next= head;
+    head= this;
 }
 
 CallbackStream::~CallbackStream()
 {
     DEBUG_PRINTF("Callbackstream dtor: %p\n", this);
+    for (CallbackStream **p = &head; *p != nullptr; p = &(*p)->next) {
+        if(*p == this) {
+            *p= next;
+            break;
+        }
+    }
+    free(obuf);
 }
 
-int CallbackStream::puts(const char *s)
+// hands s to the callback, if wait is false it gives up when the callback is stalled
+bool CallbackStream::deliver(const char *s, bool wait)
 {
-    if(closed) return 0;
-
-    if(s == NULL) return (*callback)(NULL, user);
-
-    int len = strlen(s);
     int n;
     do {
         // call this streams result callback
@@ -34,18 +67,71 @@ int CallbackStream::puts(const char *s)
         // if closed just pretend we sent it
         if(n == -1) {
             closed= true;
-            return len;
+            return true;
 
         }else if(n == 0) {
+            if(!wait) return false;
             // if output queue is full
             // call idle until we can output more
             THEKERNEL->call_event(ON_IDLE);
         }
     } while(n == 0);
 
+    // get it sent now rather than on the next periodic poll
+    Network::request_poll();
+    return true;
+}
+
+bool CallbackStream::flush(bool wait)
+{
+    // flushing is set when we got here again from the idle call in deliver
+    if(olen == 0 || flushing) return true;
+    if(closed) {
+        olen= 0;
+        return true;
+    }
+
+    flushing= true;
+    obuf[olen]= '\0';
+    bool ok= deliver(obuf, wait);
+    if(ok) olen= 0;
+    flushing= false;
+    return ok;
+}
+
+int CallbackStream::puts(const char *s)
+{
+    if(closed) return 0;
+
+    if(s == NULL) {
+        flush(true);
+        return (*callback)(NULL, user);
+    }
+
+    int len = strlen(s);
+    if(obuf != nullptr) {
+        if(olen + len > osize) flush(true);
+        if(olen + len <= osize) {
+            if(olen == 0) otime= us_ticker_read();
+            memcpy(&obuf[olen], s, len);
+            olen += len;
+            return len;
+        }
+        // too big to buffer, it goes straight out after what was buffered
+    }
+
+    deliver(s, true);
     return len;
 }
 
+void CallbackStream::flush_idle()
+{
+    uint32_t now= us_ticker_read();
+    for (CallbackStream *p = head; p != nullptr; p = p->next) {
+        if(p->olen > 0 && now - p->otime >= coalesce_us) p->flush(false);
+    }
+}
+
 void CallbackStream::mark_closed()
 {
     closed= true;
@@ -54,6 +140,8 @@ void CallbackStream::mark_closed()
 void CallbackStream::dec()
 {
     use_count--;
+    // nothing more is coming from this connection for now, so do not make it wait for the timer
+    if(use_count <= 0) flush(true);
     if(closed && use_count <= 0) delete this;
 }
 
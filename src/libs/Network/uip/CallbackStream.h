@@ -9,18 +9,39 @@ typedef int (*cb_t)(const char *, void *);
 
 class CallbackStream : public StreamOutput {
     public:
-        CallbackStream(cb_t cb, void *u);
+        // if coalesce is not 0 output is collected in a buffer of that size and handed to the callback
+        // when it is full, when flush is called, when no more commands from it are queued,
+        // or when it is older than coalesce_us, so chatty output goes out in fewer, bigger segments
+        CallbackStream(cb_t cb, void *u, uint16_t coalesce= 0);
         virtual ~CallbackStream();
+        // from a SlabPool, one is made for every network command
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
         int puts(const char*);
+        // if wait is false it gives up when the callback is stalled, and returns false
+        bool flush(bool wait= true);
         void inc() { use_count++; }
         void dec();
         int get_count() { return use_count; }
         void mark_closed();
 
+        // flushes the buffers that have waited long enough, without waiting on a stalled callback
+        static void flush_idle();
+        static uint32_t coalesce_us;
+
     private:
+        bool deliver(const char *s, bool wait);
+
         cb_t callback;
         void *user;
-        bool closed;
+        char *obuf;
+        CallbackStream *next; // all streams, for flush_idle
+        static CallbackStream *head;
+        uint32_t otime; // when the oldest byte in obuf was written
+        uint16_t osize;
+        uint16_t olen;
+        bool closed:1;
+        bool flushing:1;
         int use_count;
 };
 
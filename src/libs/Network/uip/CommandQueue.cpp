@@ -5,8 +5,12 @@
 #include "stdlib.h"
 
 #include "Kernel.h"
+#include "Robot.h"
 #include "libs/SerialMessage.h"
 #include "CallbackStream.h"
+#include "platform_memory.h"
+
+#include <new>
 
 static CommandQueue *command_queue_instance;
 CommandQueue *CommandQueue::instance = NULL;
@@ -16,6 +20,8 @@ CommandQueue::CommandQueue()
 {
     command_queue_instance = this;
     null_stream= &(StreamOutput::NullStream);
+    bulk= nullptr;
+    last_stream= nullptr;
 }
 
 CommandQueue* CommandQueue::getInstance()
@@ -31,38 +37,160 @@ extern "C" {
     }
 }
 
+// a line that is just one of the real time characters, surrounding white space is ignored
+bool CommandQueue::is_realtime(const char *cmd, char &c)
+{
+    while(*cmd == ' ' || *cmd == '\t') cmd++;
+    c= *cmd;
+    if(c != '?' && c != '!' && c != '~' && c != 'X' - 'A' + 1 && c != (char)0x85) return false;
+    cmd++;
+    while(*cmd == ' ' || *cmd == '\t' || *cmd == '\r' || *cmd == '\n') cmd++;
+    return *cmd == '\0';
+}
+
 int CommandQueue::add(const char *cmd, StreamOutput *pstream)
 {
-    cmd_t c= {strdup(cmd), pstream==NULL?null_stream:pstream};
-    q.push(c);
+    StreamOutput *s= pstream == NULL ? null_stream : pstream;
+
+    char c;
+    if(is_realtime(cmd, c)) {
+        rt_t r= {s, c};
+        if(!priority.push(r)) return -1;
+
+    } else {
+        if(bulk == nullptr) {
+            void *m= AHB0.alloc(sizeof(*bulk));
+            if(m == nullptr) m= malloc(sizeof(*bulk));
+            if(m == nullptr) return -1;
+            bulk= new(m) bulk_t;
+            for (auto &e : bulk->slot) e.pstream= nullptr;
+            bulk->count= 0;
+            bulk->seq= 0;
+        }
+
+        size_t len= strlen(cmd);
+        if(len >= max_line || bulk->count == k_slots) return -1;
+        if(pstream != NULL && k_slots - bulk->count <= k_reserved && static_cast<CallbackStream *>(pstream)->get_count() >= k_reserved) return -1;
+
+        cmd_t *e= bulk->slot;
+        while(e->pstream != nullptr) e++;
+        e->pstream= s;
+        e->seq= bulk->seq++;
+        memcpy(e->str, cmd, len + 1);
+        bulk->count++;
+    }
+
     if(pstream != NULL) {
         // count how many times this is on the queue
+        CallbackStream *cs= static_cast<CallbackStream *>(pstream);
+        cs->inc();
+    }
+    return size();
+}
+
+void CommandQueue::done(StreamOutput *pstream)
+{
+    if(pstream != null_stream) {
+        // decrement usage count
         CallbackStream *s= static_cast<CallbackStream *>(pstream);
-        s->inc();
+        s->dec();
     }
-    return q.size();
+}
+
+// same handling as the serial streams give these characters
+void CommandQueue::run_realtime(const rt_t &r)
+{
+    switch(r.c) {
+        case '?':
+            r.pstream->puts(THEKERNEL->get_status_snapshot());
+            if(r.pstream != null_stream) static_cast<CallbackStream *>(r.pstream)->flush(false);
+            break;
+
+        case (char)0x85: // jog cancel
+            THEROBOT->cancel_jog();
+            break;
+
+        case '!':
+        case '~':
+            if(THEKERNEL->is_grbl_mode() || THEKERNEL->is_feed_hold_enabled()) {
+                THEKERNEL->set_feed_hold(r.c == '!');
+            }
+            break;
+
+        default: { // ^X
+            // what was sent before it is thrown away, like the serial streams flush their receive buffer
+            flush_bulk();
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            if(THEKERNEL->is_grbl_mode()) {
+                r.pstream->puts("ALARM: Abort during cycle\r\n");
+            } else {
+                r.pstream->puts("HALTED, M999 or $X to exit HALT state\r\n");
+            }
+            break;
+        }
+    }
+    done(r.pstream);
+}
+
+// runs the queued real time commands, called from idle so they do not wait for the main loop
+void CommandQueue::pop_priority()
+{
+    rt_t r;
+    while(priority.pop(r)) {
+        run_realtime(r);
+    }
+}
+
+void CommandQueue::flush_bulk()
+{
+    if(bulk == nullptr) return;
+    for (auto &e : bulk->slot) {
+        if(e.pstream == nullptr) continue;
+        StreamOutput *s= e.pstream;
+        e.pstream= nullptr;
+        done(s);
+    }
+    bulk->count= 0;
+}
+
+// the slot of the line to run next, the oldest one of a stream other than the one that had the last turn if there is one.
+// The sessions take turns and each one's lines stay in order, -1 if there are none
+int CommandQueue::next_slot() const
+{
+    int oldest= -1, other= -1;
+    for (int i = 0; i < k_slots; i++) {
+        const cmd_t &e= bulk->slot[i];
+        if(e.pstream == nullptr) continue;
+        // the sequence numbers can wrap, so they are compared by difference
+        if(oldest < 0 || (int32_t)(e.seq - bulk->slot[oldest].seq) < 0) oldest= i;
+        if(e.pstream != last_stream && (other < 0 || (int32_t)(e.seq - bulk->slot[other].seq) < 0)) other= i;
+    }
+    return other >= 0 ? other : oldest;
 }
 
 // pops the next command off the queue and submits it.
 bool CommandQueue::pop()
 {
-    if (q.size() == 0) return false;
+    pop_priority();
 
-    cmd_t c= q.pop();
-    char *cmd= c.str;
+    if (bulk == nullptr || bulk->count == 0) return false;
+    int i= next_slot();
+    if(i < 0) return false;
 
+    // the slot is free before the command runs, it may wait in idle and the network can add more then
+    cmd_t &c= bulk->slot[i];
     struct SerialMessage message;
-    message.message = cmd;
+    message.message = c.str;
     message.stream = c.pstream;
+    c.pstream= nullptr;
+    bulk->count--;
+    last_stream= message.stream;
 
-    free(cmd);
     THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
 
     if(message.stream != null_stream) {
         message.stream->puts(NULL); // indicates command is done
-        // decrement usage count
-        CallbackStream *s= static_cast<CallbackStream *>(message.stream);
-        s->dec();
     }
+    done(message.stream);
     return true;
 }
@@ -3,26 +3,50 @@
 
 #ifdef __cplusplus
 
-#include "fifo.h"
+#include "SPSCQueue.h"
 #include <string>
 
 class StreamOutput;
 
+// commands from the network services waiting for the main loop
+// lines are copied into fixed slots so nothing is allocated per command, add returns -1 when there is no room
+// the real time commands ? ! ~ and ^X go in their own lane and are run from idle ahead of any queued lines
+// the lines of each stream are run in order, but the streams take turns so one streaming a job does not hold up the others
 class CommandQueue
 {
 public:
     CommandQueue();
     ~CommandQueue();
     bool pop();
+    void pop_priority();
     int add(const char* cmd, StreamOutput *pstream);
-    int size() {return q.size();}
+    int size() { return bulk == nullptr ? 0 : bulk->count; }
     static CommandQueue* getInstance();
 
+    static const size_t max_line= 132;
+    // a stream with this many lines waiting can not have the last of the slots, they are kept for the others
+    static const int k_reserved= 8;
+
 private:
-    typedef struct {char* str; StreamOutput *pstream; } cmd_t;
-    Fifo<cmd_t> q;
+    typedef struct {StreamOutput *pstream; uint32_t seq; char str[max_line]; } cmd_t; // a free slot has no pstream
+    typedef struct {StreamOutput *pstream; char c; } rt_t;
+    static bool is_realtime(const char *cmd, char &c);
+    void run_realtime(const rt_t &r);
+    void done(StreamOutput *pstream);
+    int next_slot() const;
+    void flush_bulk();
+
+    static const int k_slots= 32;
+    struct bulk_t {
+        cmd_t slot[k_slots];
+        int count;
+        uint32_t seq; // of the next line added, the lines of a stream are run in this order
+    };
+    bulk_t *bulk; // allocated on first use, 4K
+    SPSCQueue<rt_t, 8> priority;
     static CommandQueue *instance;
     StreamOutput *null_stream;
+    StreamOutput *last_stream; // whose line was run last
 };
 
 #else
@@ -3,6 +3,8 @@
 #pragma GCC diagnostic ignored "-Wcast-align"
 
 #include "CommandQueue.h"
+#include "CallbackStream.h"
+#include "Robot.h"
 
 #include "Kernel.h"
 #include "Config.h"
@@ -10,6 +12,7 @@
 
 #include "Network.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "PlayerPublicAccess.h"
 #include "net_util.h"
 #include "uip_arp.h"
@@ -23,11 +26,17 @@
 #include "webserver.h"
 #include "dhcpc.h"
 #include "sftpd.h"
+#include "streamd.h"
+#include "telemetry.h"
+#include "multinode.h"
+#include "WriteBehind.h"
 
 #ifndef NOPLAN9
 #include "plan9.h"
 #endif
 
+#include "us_ticker_api.h"
+
 #include <mri.h>
 
 #define BUF ((struct uip_eth_hdr *)&uip_buf[0])
@@ -36,11 +45,23 @@
 #define network_webserver_checksum CHECKSUM("webserver")
 #define network_telnet_checksum CHECKSUM("telnet")
 #define network_plan9_checksum CHECKSUM("plan9")
+#define network_stream_checksum CHECKSUM("stream")
+#define network_port_checksum CHECKSUM("port")
+#define network_telemetry_checksum CHECKSUM("telemetry")
+#define network_address_checksum CHECKSUM("address")
+#define network_interval_checksum CHECKSUM("interval")
+#define network_coalesce_ms_checksum CHECKSUM("coalesce_ms")
+
+// how long the main loop may spend issuing queued network commands in one pass
+#define command_budget_us 2000
 #define network_mac_override_checksum CHECKSUM("mac_override")
 #define network_ip_address_checksum CHECKSUM("ip_address")
 #define network_hostname_checksum CHECKSUM("hostname")
 #define network_ip_gateway_checksum CHECKSUM("ip_gateway")
 #define network_ip_mask_checksum CHECKSUM("ip_mask")
+#define network_dhcp_lease_cache_checksum CHECKSUM("dhcp_lease_cache")
+
+#define lease_filename "/sd/dhcp.lease"
 
 extern "C" void uip_log(char *m)
 {
@@ -49,13 +70,21 @@ extern "C" void uip_log(char *m)
 
 static Network* theNetwork;
 
+// the buffer uIP works in, always the TX buffer of the next EMAC descriptor to be sent
+extern "C" u8_t *uip_buf;
+u8_t *uip_buf;
+
 Network::Network()
 {
     theNetwork= this;
     ethernet = new LPC17XX_Ethernet();
     tickcnt= 0;
+    poll_requested= false;
     sftpd= NULL;
+    telemetry= nullptr;
+    multinode= nullptr;
     hostname = NULL;
+    last_lease = NULL;
     plan9_enabled= false;
     command_q= CommandQueue::getInstance();
 }
@@ -63,9 +92,12 @@ Network::Network()
 Network::~Network()
 {
     delete ethernet;
+    delete telemetry;
+    delete multinode;
     if (hostname != NULL) {
         delete hostname;
     }
+    delete [] last_lease;
     theNetwork= nullptr;
 }
 
@@ -132,6 +164,19 @@ void Network::on_module_loaded()
     webserver_enabled = THEKERNEL->config->value( network_checksum, network_webserver_checksum, network_enable_checksum )->by_default(false)->as_bool();
     telnet_enabled = THEKERNEL->config->value( network_checksum, network_telnet_checksum, network_enable_checksum )->by_default(false)->as_bool();
     plan9_enabled = THEKERNEL->config->value( network_checksum, network_plan9_checksum, network_enable_checksum )->by_default(false)->as_bool();
+    CallbackStream::coalesce_us = THEKERNEL->config->value( network_checksum, network_telnet_checksum, network_coalesce_ms_checksum )->by_default(10)->as_int() * 1000;
+    stream_enabled = THEKERNEL->config->value( network_checksum, network_stream_checksum, network_enable_checksum )->by_default(false)->as_bool();
+    stream_port = THEKERNEL->config->value( network_checksum, network_stream_checksum, network_port_checksum )->by_default(7070)->as_int();
+    if (THEKERNEL->config->value( network_checksum, network_telemetry_checksum, network_enable_checksum )->by_default(false)->as_bool()) {
+        string a = THEKERNEL->config->value( network_checksum, network_telemetry_checksum, network_address_checksum )->by_default("255.255.255.255")->as_string();
+        if (parse_ip_str(a, telemetry_ip, 4)) {
+            telemetry= new Telemetry;
+            telemetry_port = THEKERNEL->config->value( network_checksum, network_telemetry_checksum, network_port_checksum )->by_default(6060)->as_int();
+            telemetry_interval = THEKERNEL->config->value( network_checksum, network_telemetry_checksum, network_interval_checksum )->by_default(500)->as_int();
+        } else {
+            printf("Invalid telemetry address: %s\n", a.c_str());
+        }
+    }
     string mac = THEKERNEL->config->value( network_checksum, network_mac_override_checksum )->by_default("")->as_string();
     if (mac.size() == 17 ) { // parse mac address
         if (!parse_ip_str(mac, mac_address, 6, 16, ':')) {
@@ -156,6 +201,7 @@ void Network::on_module_loaded()
     string s = THEKERNEL->config->value( network_checksum, network_ip_address_checksum )->by_default("auto")->as_string();
     if (s == "auto") {
         use_dhcp = true;
+        cache_lease = THEKERNEL->config->value( network_checksum, network_dhcp_lease_cache_checksum )->by_default(true)->as_bool();
         s = THEKERNEL->config->value( network_checksum, network_hostname_checksum )->as_string();
         if (!s.empty()) {
             if(parse_hostname(s)){
@@ -191,14 +237,29 @@ void Network::on_module_loaded()
     THEKERNEL->add_module( ethernet );
     THEKERNEL->slow_ticker->attach( 100, this, &Network::tick );
 
+#if UIP_CONF_UDP
+    multinode= new MultiNode;
+    if (multinode->configure()) {
+        this->register_for_event(ON_HALT);
+    } else {
+        delete multinode;
+        multinode= nullptr;
+    }
+#endif
+
     // Register for events
     this->register_for_event(ON_IDLE);
     this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    PublicData::register_get(network_checksum, this);
 
     this->init();
 }
 
+void Network::on_halt(void *argument)
+{
+    if (multinode != nullptr) multinode->on_halt(argument != nullptr);
+}
+
 void Network::on_get_public_data(void* argument) {
     PublicDataRequest* pdr = static_cast<PublicDataRequest*>(argument);
 
@@ -233,14 +294,60 @@ uint32_t Network::tick(uint32_t dummy)
 
 void Network::on_idle(void *argument)
 {
+    // it halts when a follower stops answering, which it has to do with the network down as well
+    if (multinode != nullptr) multinode->on_idle();
+
     if (!ethernet->isUp()) return;
 
-    int len= sizeof(uip_buf); // set maximum size
-    if (ethernet->_receive_frame(uip_buf, &len)) {
-        uip_len = len;
-        this->handlePacket();
+    // handle everything that is queued in the RX ring, the peer may have several segments in flight
+    // the RX interrupt flags new frames, the periodic timer picks up any that were missed
+    bool got= false;
+    if (ethernet->take_rx_pending() || timer_expired(&periodic_timer)) {
+        for (int n = 0; n < LPC17XX_RXBUFS; n++) {
+            int len= UIP_BUFSIZE + 4; // set maximum size
+            if (!ethernet->_receive_frame(uip_buf, &len)) break;
+            uip_len = len;
+            this->handlePacket();
+            got= true;
+        }
+        // more arrived than we take in one go, or there was no TX room for the reply
+        if (ethernet->can_read_packet()) ethernet->set_rx_pending();
+    }
 
-    } else {
+    // real time commands that came in with those frames
+    command_q->pop_priority();
+
+    // output that has been coalesced for long enough
+    CallbackStream::flush_idle();
+
+    if (poll_requested) {
+        poll_requested= false;
+        poll_connections();
+    }
+
+#if UIP_CONF_UDP
+    // it has its own rate, so it is polled when due rather than on the periodic timer
+    if (telemetry != nullptr && telemetry->due()) {
+        uip_udp_periodic_conn(telemetry->get_conn());
+        if (uip_len > 0) {
+            uip_arp_out();
+            tapdev_send(uip_buf, uip_len);
+        }
+    }
+    // the blocks go out as soon as they are frozen rather than on the periodic timer
+    if (multinode != nullptr) {
+        for (int i = 0; i < multinode->get_conn_count(); i++) {
+            if (!multinode->due(i)) continue;
+            uip_udp_periodic_conn(multinode->get_conn(i));
+            if (uip_len > 0) {
+                uip_arp_out();
+                tapdev_send(uip_buf, uip_len);
+            }
+        }
+    }
+#endif
+
+    if(!got) {
 
         if (timer_expired(&periodic_timer)) { /* no packet but periodic_timer time out (0.1s)*/
             timer_reset(&periodic_timer);
@@ -292,6 +399,29 @@ void Network::on_idle(void *argument)
     }
 }
 
+void Network::request_poll()
+{
+    if (theNetwork != nullptr) theNetwork->poll_requested= true;
+}
+
+extern "C" void network_request_poll(void)
+{
+    Network::request_poll();
+}
+
+// lets the apps send what they have queued, and restart stopped connections, now rather than on the next periodic poll
+void Network::poll_connections()
+{
+    for (int i = 0; i < UIP_CONNS; i++) {
+        if (uip_conns[i].tcpstateflags == UIP_CLOSED) continue;
+        uip_poll_conn(&uip_conns[i]);
+        if (uip_len > 0) {
+            uip_arp_out();
+            tapdev_send(uip_buf, uip_len);
+        }
+    }
+}
+
 void Network::setup_servers()
 {
     if (webserver_enabled) {
@@ -314,6 +444,30 @@ void Network::setup_servers()
     }
 #endif
 
+    if (stream_enabled) {
+        // raw G-code streaming
+        Streamd::init(stream_port);
+        printf("G-code stream on port %u\n", stream_port);
+    }
+
+#if UIP_CONF_UDP
+    if (telemetry != nullptr && telemetry->get_conn() == nullptr) {
+        if (telemetry->init(telemetry_ip, telemetry_port, telemetry_interval)) {
+            printf("Telemetry to %d.%d.%d.%d:%u every %ums\n", telemetry_ip[0], telemetry_ip[1], telemetry_ip[2], telemetry_ip[3], telemetry_port, telemetry_interval);
+        } else {
+            printf("Telemetry not started, no free UDP connection\n");
+        }
+    }
+
+    if (multinode != nullptr && multinode->get_conn_count() == 0) {
+        if (multinode->init()) {
+            printf("Multinode %s on port %u\n", multinode->is_master() ? "master" : "follower", multinode->get_port());
+        } else {
+            printf("Multinode not started, no free UDP connection\n");
+        }
+    }
+#endif
+
     // sftpd service, which is lazily created on reciept of first packet
     uip_listen(HTONS(115));
 }
@@ -334,10 +488,10 @@ extern "C" void dhcpc_configured(const struct dhcpc_state *s)
            uip_ipaddr3(&s->default_router), uip_ipaddr4(&s->default_router));
     printf("Lease expires in %ld seconds\n", ntohl(s->lease_time));
 
-    theNetwork->dhcpc_configured(s->ipaddr, s->netmask, s->default_router);
+    theNetwork->dhcpc_configured(s->ipaddr, s->netmask, s->default_router, ntohl(s->lease_time));
 }
 
-void Network::dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw)
+void Network::dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw, uint32_t lease_secs)
 {
     memcpy(this->ipaddr, &ipaddr, 4);
     memcpy(this->ipmask, &ipmask, 4);
@@ -347,11 +501,45 @@ void Network::dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw)
     uip_setnetmask((u16_t*)this->ipmask);
     uip_setdraddr((u16_t*)this->ipgw);
 
+    if (cache_lease) {
+        // renewals give the same lease again, so the card is only written when it has changed
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%d.%d.%d.%d %d.%d.%d.%d %d.%d.%d.%d %lu\n",
+                 this->ipaddr[0], this->ipaddr[1], this->ipaddr[2], this->ipaddr[3],
+                 this->ipmask[0], this->ipmask[1], this->ipmask[2], this->ipmask[3],
+                 this->ipgw[0], this->ipgw[1], this->ipgw[2], this->ipgw[3], lease_secs);
+        if (last_lease == NULL || strcmp(last_lease, buf) != 0) WriteBehind::queue(lease_filename, std::string(buf));
+        delete [] last_lease;
+        last_lease = new char [strlen(buf) + 1];
+        strcpy(last_lease, buf);
+    }
+
     setup_servers();
 }
 
+// reads the lease that was saved last time, returns its address or 0 if there is none
+uint32_t Network::load_lease()
+{
+    FILE *fp = fopen(lease_filename, "r");
+    if (fp == NULL) return 0;
+
+    char buf[64];
+    uint32_t addr = 0;
+    if (fgets(buf, sizeof(buf), fp) != NULL) {
+        string s(buf);
+        uint8_t a[4];
+        if (parse_ip_str(s.substr(0, s.find(' ')), a, 4)) memcpy(&addr, a, 4);
+        last_lease = new char [s.length() + 1];
+        strcpy(last_lease, buf);
+    }
+    fclose(fp);
+    return addr;
+}
+
 void Network::init(void)
 {
+    uip_buf= (u8_t *)ethernet->request_packet_buffer();
+
     // two timers for tcp/ip
     timer_set(&periodic_timer, CLOCK_SECOND / 2); /* 0.5s */
     timer_set(&arp_timer, CLOCK_SECOND * 10);   /* 10s */
@@ -379,6 +567,8 @@ void Network::init(void)
     }else{
     #if UIP_CONF_UDP
         dhcpc_init(mac_address, sizeof(mac_address), hostname);
+        uint32_t last = cache_lease ? load_lease() : 0;
+        if (last != 0) dhcpc_init_reboot(last);
         dhcpc_request();
         printf("Getting IP address....\n");
     #endif
@@ -387,13 +577,13 @@ void Network::init(void)
 
 void Network::on_main_loop(void *argument)
 {
-    // issue commands here if any available
-    // while(command_q->pop()) {
-    //     // keep feeding them until empty
-    // }
-
-    // issue one comamnd per iteration of main loop like USB serial does
-    command_q->pop();
+    // issue commands until the budget is used up, a command that has to wait for room in the planner ends it anyway
+    // the replies and any restart of a stopped connection go out on the next idle
+    uint32_t t= us_ticker_read();
+    while (!THEROBOT->is_segmenting() && command_q->pop()) {
+        poll_requested= true;
+        if (us_ticker_read() - t >= command_budget_us) break;
+    }
 
 }
 
@@ -425,15 +615,41 @@ extern "C" void app_select_appcall(void)
             break;
 
         default:
+            // its port is configurable so it can not be a case
+            if (theNetwork->stream_enabled && uip_conn->lport == HTONS(theNetwork->stream_port)) {
+                Streamd::appcall();
+                break;
+            }
             printf("unknown app for port: %d\n", uip_conn->lport);
 
     }
 }
 
+// select between dhcp, the telemetry publisher and the multinode connections
+extern "C" void app_select_udp_appcall(void)
+{
+    if (theNetwork->telemetry != nullptr && theNetwork->telemetry->is_conn(uip_udp_conn)) {
+        theNetwork->telemetry->appcall();
+        return;
+    }
+    if (theNetwork->multinode != nullptr && theNetwork->multinode->is_conn(uip_udp_conn)) {
+        theNetwork->multinode->appcall();
+        return;
+    }
+    dhcpc_appcall();
+}
+
 void Network::tapdev_send(void *pPacket, unsigned int size)
 {
-    memcpy(ethernet->request_packet_buffer(), pPacket, size);
-    ethernet->write_packet((uint8_t *) pPacket, size);
+    // a split segment goes out as two frames back to back, wait for the DMA to free a descriptor rather than drop one
+    uint32_t t= us_ticker_read();
+    while(!ethernet->can_write_packet() && us_ticker_read() - t < 2000) ;
+
+    // the packet is normally uip_buf which is already the descriptors buffer, so it is handed over without a copy
+    // and uip carries on in the buffer of the next descriptor, the DMA hands the old one back when it has been sent
+    if (ethernet->write_packet((uint8_t *) pPacket, size) > 0) {
+        uip_buf= (u8_t *)ethernet->request_packet_buffer();
+    }
 }
 
 // define this to split full frames into two to illicit an ack from the endpoint
@@ -6,6 +6,8 @@
 #include "Module.h"
 
 class Sftpd;
+class Telemetry;
+class MultiNode;
 class CommandQueue;
 
 class Network : public Module
@@ -17,18 +19,27 @@ public:
     void on_module_loaded();
     void on_idle(void* argument);
     void on_main_loop(void* argument);
+    void on_halt(void* argument);
     void on_get_public_data(void* argument);
-    void dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw);
+    void dhcpc_configured(uint32_t ipaddr, uint32_t ipmask, uint32_t ipgw, uint32_t lease_secs);
     void tapdev_send(void *pPacket, unsigned int size);
 
+    // have the connections polled on the next idle so queued output goes out without waiting for the periodic timer
+    static void request_poll();
+
     // accessed from C
     Sftpd *sftpd;
     struct {
         bool webserver_enabled:1;
         bool telnet_enabled:1;
         bool plan9_enabled:1;
+        bool stream_enabled:1;
         bool use_dhcp:1;
+        bool cache_lease:1;
     };
+    uint16_t stream_port;
+    Telemetry *telemetry;
+    MultiNode *multinode;
 
 
 private:
@@ -36,17 +47,24 @@ private:
     void setup_servers();
     uint32_t tick(uint32_t dummy);
     void handlePacket();
+    void poll_connections();
+    uint32_t load_lease();
 
     CommandQueue *command_q;
     LPC17XX_Ethernet *ethernet;
 
     struct timer periodic_timer, arp_timer;
     char *hostname;
+    char *last_lease; // as it is in the lease file, until the new one is compared with it
     volatile uint32_t tickcnt;
+    volatile bool poll_requested;
     uint8_t mac_address[6];
     uint8_t ipaddr[4];
     uint8_t ipmask[4];
     uint8_t ipgw[4];
+    uint8_t telemetry_ip[4];
+    uint16_t telemetry_port;
+    uint16_t telemetry_interval;
 };
 
 #endif
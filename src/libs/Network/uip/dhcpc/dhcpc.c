@@ -45,6 +45,7 @@
 #define STATE_SENDING         1
 #define STATE_OFFER_RECEIVED  2
 #define STATE_CONFIG_RECEIVED 3
+#define STATE_REBOOTING       4
 
 #define ntohl(a) ((((a) >> 24) & 0x000000FF) | (((a) >> 8) & 0x0000FF00) | (((a) << 8) & 0x00FF0000) | (((a) << 24) & 0xFF000000))
 static struct dhcpc_state s __attribute__ ((section ("AHBSRAM1")));
@@ -219,6 +220,24 @@ send_request(int rea)
     uip_send(uip_appdata, end - (u8_t *)uip_appdata);
 }
 /*---------------------------------------------------------------------------*/
+/* INIT-REBOOT, RFC 2131 4.3.2, no server id and no ciaddr, just the address we want back */
+static void
+send_reboot_request(void)
+{
+    u8_t *end;
+    struct dhcp_msg *m = (struct dhcp_msg *)uip_appdata;
+
+    create_msg(m, 1);
+
+    end = add_msg_type(&m->options[4], DHCPREQUEST);
+    end = add_req_ipaddr(end);
+    end = add_req_options(end);
+    end = add_hostname(end);
+    end = add_end(end);
+
+    uip_send(uip_appdata, end - (u8_t *)uip_appdata);
+}
+/*---------------------------------------------------------------------------*/
 static u8_t
 parse_options(u8_t *optptr, int len)
 {
@@ -273,56 +292,90 @@ PT_THREAD(handle_dhcp(void))
 {
     PT_BEGIN(&s.pt);
 
-    /* try_again:*/
     s.state = STATE_SENDING;
-    s.ticks = CLOCK_SECOND;
-    xid++;
-
-    send_discover();
-    do {
-        timer_set(&s.timer, s.ticks);
-        PT_WAIT_UNTIL(&s.pt, uip_newdata() || timer_expired(&s.timer));
-        // if we timed out then increase time out and send discover again
-        if (timer_expired(&s.timer)) {
-            if (s.ticks < CLOCK_SECOND * 60) {
+    if (s.reboot_ipaddr != 0) {
+        // ask for the last address back, which needs one round trip and none of the offer delay some servers have
+        s.state = STATE_REBOOTING;
+        s.ipaddr = s.reboot_ipaddr;
+        s.ticks = CLOCK_SECOND;
+        xid++;
+        send_reboot_request();
+        do {
+            timer_set(&s.timer, s.ticks);
+            PT_WAIT_UNTIL(&s.pt, uip_newdata() || timer_expired(&s.timer));
+            if (timer_expired(&s.timer)) {
+                // nobody answered twice, the link may not have been up for the first one, so discover as usual
+                if (s.ticks > CLOCK_SECOND) break;
                 s.ticks *= 2;
+                s.ipaddr = s.reboot_ipaddr;
+                send_reboot_request();
+            }else{
+                u8_t type = uip_newdata() ? parse_msg() : 0;
+                if (type == DHCPACK) {
+                    s.state = STATE_CONFIG_RECEIVED;
+                } else if (type == DHCPNAK) {
+                    break;
+                }
             }
-            send_discover();
-        }else{
-            // we may have gotten some other UDP packet in which case just wait some more for the right packet
-            if (uip_newdata() && parse_msg() == DHCPOFFER) {
-                s.state = STATE_OFFER_RECEIVED;
-                break;
-            }
-        }
-        PT_YIELD(&s.pt);
+            PT_YIELD(&s.pt);
+        } while (s.state != STATE_CONFIG_RECEIVED);
 
-    } while (s.state != STATE_OFFER_RECEIVED);
+        // only at boot, a restart after a lost lease starts from a discover
+        s.reboot_ipaddr = 0;
+    }
 
-    s.ticks = CLOCK_SECOND;
-    xid++;
+    if (s.state != STATE_CONFIG_RECEIVED) {
+        /* try_again:*/
+        s.state = STATE_SENDING;
+        s.ticks = CLOCK_SECOND;
+        xid++;
 
-    send_request(0);
-    do {
-        timer_set(&s.timer, s.ticks);
-        PT_WAIT_UNTIL(&s.pt, uip_newdata() || timer_expired(&s.timer));
-
-        if (timer_expired(&s.timer)) {
-            if (s.ticks <= CLOCK_SECOND * 10) {
-                s.ticks += CLOCK_SECOND;
-                send_request(0); // resend only on timeout
-            } else {
-                PT_RESTART(&s.pt);
+        send_discover();
+        do {
+            timer_set(&s.timer, s.ticks);
+            PT_WAIT_UNTIL(&s.pt, uip_newdata() || timer_expired(&s.timer));
+            // if we timed out then increase time out and send discover again
+            if (timer_expired(&s.timer)) {
+                if (s.ticks < CLOCK_SECOND * 60) {
+                    s.ticks *= 2;
+                }
+                send_discover();
+            }else{
+                // we may have gotten some other UDP packet in which case just wait some more for the right packet
+                if (uip_newdata() && parse_msg() == DHCPOFFER) {
+                    s.state = STATE_OFFER_RECEIVED;
+                    break;
+                }
             }
-        }else{
-            if (uip_newdata() && parse_msg() == DHCPACK) {
-                s.state = STATE_CONFIG_RECEIVED;
-                break;
+            PT_YIELD(&s.pt);
+
+        } while (s.state != STATE_OFFER_RECEIVED);
+
+        s.ticks = CLOCK_SECOND;
+        xid++;
+
+        send_request(0);
+        do {
+            timer_set(&s.timer, s.ticks);
+            PT_WAIT_UNTIL(&s.pt, uip_newdata() || timer_expired(&s.timer));
+
+            if (timer_expired(&s.timer)) {
+                if (s.ticks <= CLOCK_SECOND * 10) {
+                    s.ticks += CLOCK_SECOND;
+                    send_request(0); // resend only on timeout
+                } else {
+                    PT_RESTART(&s.pt);
+                }
+            }else{
+                if (uip_newdata() && parse_msg() == DHCPACK) {
+                    s.state = STATE_CONFIG_RECEIVED;
+                    break;
+                }
             }
-        }
-        PT_YIELD(&s.pt);
+            PT_YIELD(&s.pt);
 
-    } while (s.state != STATE_CONFIG_RECEIVED);
+        } while (s.state != STATE_CONFIG_RECEIVED);
+    }
 
     dhcpc_configured(&s);
 
@@ -377,6 +430,7 @@ dhcpc_init(const void *mac_addr, int mac_len, char *hostname)
     s.hostname = hostname;
 
     s.state = STATE_INITIAL;
+    s.reboot_ipaddr = 0;
     uip_ipaddr(addr, 255, 255, 255, 255);
     s.conn = uip_udp_new(&addr, HTONS(DHCPC_SERVER_PORT));
     if (s.conn != NULL) {
@@ -386,6 +440,12 @@ dhcpc_init(const void *mac_addr, int mac_len, char *hostname)
 }
 /*---------------------------------------------------------------------------*/
 void
+dhcpc_init_reboot(uint32_t ipaddr)
+{
+    s.reboot_ipaddr = ipaddr;
+}
+/*---------------------------------------------------------------------------*/
+void
 dhcpc_appcall(void)
 {
     handle_dhcp();
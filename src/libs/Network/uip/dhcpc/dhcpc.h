@@ -52,6 +52,7 @@ struct dhcpc_state {
   uint32_t netmask;
   uint32_t dnsaddr;
   uint32_t default_router;
+  uint32_t reboot_ipaddr; /* asked for again at boot, 0 for none */
 };
 
 #ifdef __cplusplus
@@ -60,6 +61,8 @@ extern "C" {
 
 void dhcpc_init(const void *mac_addr, int mac_len, char *hostname);
 void dhcpc_request(void);
+/* start with an INIT-REBOOT request for the address of the last lease instead of a discover */
+void dhcpc_init_reboot(uint32_t ipaddr);
 
 void dhcpc_appcall(void);
 
@@ -70,7 +73,7 @@ void dhcpc_configured(const struct dhcpc_state *s);
 #endif
 
 typedef struct dhcpc_state uip_udp_appstate_t;
-#define UIP_UDP_APPCALL dhcpc_appcall
+#define UIP_UDP_APPCALL app_select_udp_appcall
 
 
 #endif /* __DHCPC_H__ */
@@ -1,18 +1,23 @@
-// c accessibllity to the c++ fifo class
-#include "fifo.h"
+// c accessibllity to a queue of strings, the results of a command for each http connection
 #include "c-fifo.h"
+#include "SPSCQueue.h"
+
+#include <stdlib.h>
+
+// httpd stops queuing results at 10 and then adds the NULL that marks the end
+typedef SPSCQueue<char *, 16> StringFifo;
 
 void *new_fifo()
 {
-    return new Fifo<char*>;
+    return new StringFifo;
 }
 
 void delete_fifo(void *fifo)
 {
     if(fifo == NULL) return;
-    Fifo<char *> *f= static_cast<Fifo<char *> *>(fifo);
-    while(f->size() > 0) {
-        char *s= f->pop();
+    StringFifo *f= static_cast<StringFifo *>(fifo);
+    char *s;
+    while(f->pop(s)) {
         if (s != NULL) {
             free(s);
         }
@@ -22,18 +27,20 @@ void delete_fifo(void *fifo)
 
 char *fifo_pop(void *fifo)
 {
-    Fifo<char *> *f= static_cast<Fifo<char *> *>(fifo);
-    return f->pop();
+    StringFifo *f= static_cast<StringFifo *>(fifo);
+    char *s= NULL;
+    f->pop(s);
+    return s;
 }
 
 void fifo_push(void *fifo, char *str)
 {
-    Fifo<char *> *f= static_cast<Fifo<char *> *>(fifo);
-    f->push(str);
+    StringFifo *f= static_cast<StringFifo *>(fifo);
+    if(!f->push(str) && str != NULL) free(str);
 }
 
 int fifo_size(void *fifo)
 {
-    Fifo<char *> *f= static_cast<Fifo<char *> *>(fifo);
+    StringFifo *f= static_cast<StringFifo *>(fifo);
     return f->size();
 }
@@ -0,0 +1,526 @@
+#include "uip.h"
+#include "multinode.h"
+
+#include "Kernel.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "NetworkPublicAccess.h"
+#include "StreamOutputPool.h"
+#include "StepTicker.h"
+#include "Conveyor.h"
+#include "Planner.h"
+#include "Block.h"
+#include "Robot.h"
+#include "Pin.h"
+#include "InterruptIn.h" // mbed
+#include "us_ticker_api.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <algorithm>
+
+#define multinode_checksum          CHECKSUM("multinode")
+#define enable_checksum             CHECKSUM("enable")
+#define role_checksum               CHECKSUM("role")
+#define followers_checksum          CHECKSUM("followers")
+#define master_checksum             CHECKSUM("master")
+#define port_checksum               CHECKSUM("port")
+#define sync_pin_checksum           CHECKSUM("sync_pin")
+#define first_actuator_checksum     CHECKSUM("first_actuator")
+#define ahead_checksum              CHECKSUM("ahead")
+#define timeout_ms_checksum         CHECKSUM("timeout_ms")
+
+// datagram types
+enum { k_block= 1, k_ack, k_halt, k_reset, k_reset_ack };
+
+#define header_size 8
+#define block_size(n) (4 * (n) + 9 * 4)
+// how soon blocks a follower has not acked, or a reset, are sent again
+#define retry_us 20000
+
+MultiNode *MultiNode::instance= nullptr;
+
+static bool parse_ip(const std::string &s, uint8_t *ip)
+{
+    unsigned int a[4];
+    if (sscanf(s.c_str(), "%u.%u.%u.%u", &a[0], &a[1], &a[2], &a[3]) != 4) return false;
+    for (int i = 0; i < 4; i++) {
+        if (a[i] > 255) return false;
+        ip[i] = a[i];
+    }
+    return true;
+}
+
+MultiNode::MultiNode()
+{
+    instance= this;
+    n_followers= 0;
+    n_conns= 0;
+    committed= 0;
+    sync_pin= nullptr;
+    sync_state= false;
+    conn= nullptr;
+    first_actuator= 0;
+    expected= 1;
+    edges= 0;
+    sync_in= nullptr;
+    master= false;
+    halt_pending= false;
+    reset_pending= false;
+    bad_frequency= false;
+    refused= false;
+    memset(followers, 0, sizeof(followers));
+}
+
+MultiNode::~MultiNode()
+{
+    THECONVEYOR->hold_blocks(false);
+    delete sync_in;
+    delete sync_pin;
+    instance= nullptr;
+}
+
+bool MultiNode::configure()
+{
+    if (!THEKERNEL->config->value(network_checksum, multinode_checksum, enable_checksum)->by_default(false)->as_bool()) return false;
+
+    master = THEKERNEL->config->value(network_checksum, multinode_checksum, role_checksum)->by_default("master")->as_string() != "follower";
+    port = THEKERNEL->config->value(network_checksum, multinode_checksum, port_checksum)->by_default(6070)->as_int();
+    std::string pin = THEKERNEL->config->value(network_checksum, multinode_checksum, sync_pin_checksum)->by_default("nc")->as_string();
+
+    if (master) {
+        std::string list = THEKERNEL->config->value(network_checksum, multinode_checksum, followers_checksum)->by_default("")->as_string();
+        size_t p = 0;
+        while (p < list.size() && n_followers < k_max_followers) {
+            size_t e = list.find(',', p);
+            std::string a = list.substr(p, e == std::string::npos ? std::string::npos : e - p);
+            if (!parse_ip(a, followers[n_followers].ip)) {
+                printf("multinode: invalid follower address %s\n", a.c_str());
+                return false;
+            }
+            n_followers++;
+            if (e == std::string::npos) break;
+            p = e + 1;
+        }
+        if (n_followers == 0) {
+            printf("multinode: no followers set\n");
+            return false;
+        }
+
+        ahead = std::max(2, THEKERNEL->config->value(network_checksum, multinode_checksum, ahead_checksum)->by_default(8)->as_int());
+        timeout_us = THEKERNEL->config->value(network_checksum, multinode_checksum, timeout_ms_checksum)->by_default(1000)->as_int() * 1000;
+
+        sync_pin = new Pin();
+        sync_pin->from_string(pin)->as_output();
+        if (!sync_pin->connected()) {
+            printf("multinode: sync_pin has to be set\n");
+            return false;
+        }
+        sync_pin->set(false);
+        THECONVEYOR->hold_blocks(true, on_block_started);
+
+    } else {
+        std::string a = THEKERNEL->config->value(network_checksum, multinode_checksum, master_checksum)->by_default("")->as_string();
+        if (!parse_ip(a, master_ip)) {
+            printf("multinode: invalid master address %s\n", a.c_str());
+            return false;
+        }
+        first_actuator = THEKERNEL->config->value(network_checksum, multinode_checksum, first_actuator_checksum)->by_default(0)->as_int();
+
+        Pin p;
+        p.from_string(pin);
+        sync_in = p.interrupt_pin();
+        if (sync_in == nullptr) {
+            printf("multinode: sync_pin has to be on port 0 or 2\n");
+            return false;
+        }
+        // each edge is the master starting a block
+        sync_in->rise(this, &MultiNode::on_sync_edge);
+        sync_in->fall(this, &MultiNode::on_sync_edge);
+        THECONVEYOR->hold_blocks(true);
+    }
+
+    return true;
+}
+
+bool MultiNode::init()
+{
+    uip_ipaddr_t addr;
+    if (master) {
+        for (int i = 0; i < n_followers; i++) {
+            follower_t &f = followers[i];
+            uip_ipaddr(addr, f.ip[0], f.ip[1], f.ip[2], f.ip[3]);
+            f.conn = uip_udp_new(&addr, HTONS(port));
+            if (f.conn == nullptr) return false;
+            uip_udp_bind(f.conn, HTONS(port));
+            f.reset = true;
+            n_conns++;
+        }
+
+    } else {
+        uip_ipaddr(addr, master_ip[0], master_ip[1], master_ip[2], master_ip[3]);
+        conn = uip_udp_new(&addr, HTONS(port));
+        if (conn == nullptr) return false;
+        uip_udp_bind(conn, HTONS(port));
+        n_conns = 1;
+    }
+    return true;
+}
+
+struct uip_udp_conn *MultiNode::get_conn(int i) const
+{
+    return master ? followers[i].conn : conn;
+}
+
+bool MultiNode::is_conn(const struct uip_udp_conn *c) const
+{
+    for (int i = 0; i < n_conns; i++) {
+        if (get_conn(i) == c) return true;
+    }
+    return false;
+}
+
+// the follower only replies to what it is sent
+bool MultiNode::due(int i) const
+{
+    if (!master) return false;
+
+    const follower_t &f = followers[i];
+    if (f.halt) return true;
+    if (THEKERNEL->is_halted()) return false;
+
+    uint32_t now = us_ticker_read();
+    if (f.reset) return now - f.sent_us >= retry_us;
+    if (f.acked != f.sent && now - f.sent_us >= retry_us) return true;
+    return f.sent != committed;
+}
+
+void MultiNode::on_idle()
+{
+    if (!master) {
+        if (halt_pending || refused) {
+            if (!THEKERNEL->is_halted()) {
+                if (halt_pending) THEKERNEL->streams->printf("Error: multinode master halted\n");
+                THEKERNEL->call_event(ON_HALT, nullptr);
+            }
+            halt_pending = refused = false;
+        }
+        if (reset_pending) {
+            // the next reset it sends is acked once the queue has been flushed and the halt cleared
+            reset_pending = false;
+            if (!THEKERNEL->is_halted() && !THECONVEYOR->is_queue_empty()) THEKERNEL->call_event(ON_HALT, nullptr);
+            if (THEKERNEL->is_halted()) THEKERNEL->call_event(ON_HALT, (void *)1);
+        }
+        return;
+    }
+
+    if (THEKERNEL->is_halted()) return;
+
+    commit();
+    if (THEKERNEL->is_halted()) return;
+
+    // a block can start once every follower has it
+    uint32_t now = us_ticker_read();
+    uint32_t release = committed;
+    for (int i = 0; i < n_followers; i++) {
+        follower_t &f = followers[i];
+        if ((int32_t)(f.acked - release) < 0) release = f.acked;
+        if (f.acked == committed) {
+            f.wait_us = now;
+
+        } else if (now - f.wait_us >= timeout_us) {
+            // rather than wait for it for ever
+            THEKERNEL->streams->printf("Error: multinode follower %d.%d.%d.%d is not answering\n", f.ip[0], f.ip[1], f.ip[2], f.ip[3]);
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            return;
+        }
+    }
+    THECONVEYOR->release_held(release);
+}
+
+// the blocks from the one running to ahead of it are frozen and sent, so they can not be changed by the blocks planned
+// after them once a follower has them, as the one running can not be
+void MultiNode::commit()
+{
+    Conveyor *c = THECONVEYOR;
+
+    // while the conveyor is collecting blocks to plan them well they do not need to be sent yet
+    if (!c->allow_fetch) return;
+
+    unsigned int i = c->queue.isr_tail_i;
+    for (uint8_t n = 0; n < ahead && i != c->queue.head_i; n++, i = c->queue.next(i)) {
+        Block *b = c->queue.item_ref(i);
+        if (!b->held || (int32_t)(b->sync_seq - committed) <= 0) continue;
+
+        b->update_trapezoid();
+        if (b->is_scurve) {
+            THEKERNEL->streams->printf("Error: multinode can not send s-curve blocks, set scurve_jerk 0\n");
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            return;
+        }
+        b->preplanned = true;
+        b->recalculate_flag = false;
+        committed = b->sync_seq;
+    }
+}
+
+void MultiNode::on_halt(bool clear)
+{
+    if (!master) return;
+
+    if (!clear) {
+        for (int i = 0; i < n_followers; i++) followers[i].halt = true;
+        return;
+    }
+
+    // the queue has been flushed, every board starts numbering the blocks again
+    committed = 0;
+    THECONVEYOR->set_held_seq(0);
+    THECONVEYOR->release_held(0);
+    uint32_t now = us_ticker_read();
+    for (int i = 0; i < n_followers; i++) {
+        follower_t &f = followers[i];
+        f.acked = f.sent = 0;
+        f.sent_us = now - retry_us;
+        f.wait_us = now;
+        f.reset = true;
+        f.halt = false;
+    }
+}
+
+void MultiNode::appcall()
+{
+    if (!master) {
+        follower_appcall();
+        return;
+    }
+
+    for (int i = 0; i < n_followers; i++) {
+        if (followers[i].conn == uip_udp_conn) {
+            master_appcall(followers[i]);
+            return;
+        }
+    }
+}
+
+void MultiNode::send_header(uint8_t type, uint8_t count, uint32_t seq, int len)
+{
+    uint8_t *buf = (uint8_t *)uip_appdata;
+    buf[0] = type;
+    buf[1] = count;
+    buf[2] = THEROBOT->get_number_registered_motors();
+    buf[3] = 0;
+    memcpy(&buf[4], &seq, 4);
+    uip_udp_send(len);
+}
+
+void MultiNode::master_appcall(follower_t &f)
+{
+    uint32_t now = us_ticker_read();
+
+    if (uip_newdata()) {
+        const uint8_t *d = (const uint8_t *)uip_appdata;
+        if (uip_datalen() < header_size) return;
+        uint32_t seq;
+        memcpy(&seq, &d[4], 4);
+        if (d[0] == k_ack && !f.reset) {
+            if ((int32_t)(seq - f.acked) > 0 && (int32_t)(seq - f.sent) <= 0) {
+                f.acked = seq;
+                f.wait_us = now;
+            }
+        } else if (d[0] == k_reset_ack && f.reset) {
+            f.reset = false;
+            f.acked = f.sent = 0;
+            f.wait_us = now;
+        }
+        return;
+    }
+
+    if (!uip_poll()) return;
+
+    if (f.halt) {
+        f.halt = false;
+        send_header(k_halt, 0, 0, header_size);
+        return;
+    }
+    if (THEKERNEL->is_halted()) return;
+
+    if (f.reset) {
+        if (now - f.sent_us < retry_us) return;
+        f.sent_us = now;
+        // the blocks only take the same time on both if the ticks do
+        float frequency = THEKERNEL->step_ticker->get_frequency();
+        memcpy((uint8_t *)uip_appdata + header_size, &frequency, 4);
+        send_header(k_reset, 0, 0, header_size + 4);
+        return;
+    }
+
+    // go back to the first one it has not acked when it is taking too long, otherwise send what it has not had yet
+    uint32_t first;
+    if (f.acked != f.sent && now - f.sent_us >= retry_us) first = f.acked + 1;
+    else if (f.sent != committed) first = f.sent + 1;
+    else return;
+
+    uint8_t count;
+    const int size = UIP_BUFSIZE - UIP_LLH_LEN - UIP_IPUDPH_LEN;
+    int len = encode_blocks((uint8_t *)uip_appdata + header_size, size - header_size, first, committed, count);
+    if (count == 0) return;
+
+    if (f.acked == f.sent) f.wait_us = now;
+    f.sent = first + count - 1;
+    f.sent_us = now;
+    send_header(k_block, count, first, header_size + len);
+}
+
+const Block *MultiNode::find_block(uint32_t seq) const
+{
+    Conveyor *c = THECONVEYOR;
+    for (unsigned int i = c->queue.isr_tail_i; i != c->queue.head_i; i = c->queue.next(i)) {
+        const Block *b = c->queue.item_ref(i);
+        if (b->held && b->sync_seq == seq) return b;
+    }
+    return nullptr;
+}
+
+// as many of the blocks from first to last as fit
+int MultiNode::encode_blocks(uint8_t *buf, int size, uint32_t first, uint32_t last, uint8_t &count) const
+{
+    const uint8_t n = THEROBOT->get_number_registered_motors();
+    int len = 0;
+    count = 0;
+    for (uint32_t s = first; (int32_t)(last - s) >= 0 && count < 255 && len + block_size(n) <= size; s++) {
+        const Block *b = find_block(s);
+        if (b == nullptr) break; // it has not been held since it was sent, it can not have been run
+
+        uint8_t *p = &buf[len];
+        for (uint8_t m = 0; m < n; m++) {
+            int32_t steps = b->direction_bits[m] ? -(int32_t)b->steps[m] : (int32_t)b->steps[m];
+            memcpy(p, &steps, 4); p += 4;
+        }
+        float final_rate = b->nominal_speed > 0.0F ? b->nominal_rate * (b->exit_speed / b->nominal_speed) : 0.0F;
+        memcpy(p, &b->accelerate_until, 4); p += 4;
+        memcpy(p, &b->decelerate_after, 4); p += 4;
+        memcpy(p, &b->total_move_ticks, 4); p += 4;
+        memcpy(p, &b->initial_rate, 4); p += 4;
+        memcpy(p, &b->maximum_rate, 4); p += 4;
+        memcpy(p, &final_rate, 4); p += 4;
+        memcpy(p, &b->millimeters, 4); p += 4;
+        memcpy(p, &b->nominal_speed, 4); p += 4;
+        memcpy(p, &b->acceleration, 4); p += 4;
+
+        len += block_size(n);
+        count++;
+    }
+    return len;
+}
+
+void MultiNode::follower_appcall()
+{
+    if (!uip_newdata() || uip_datalen() < header_size) return;
+
+    const uint8_t *d = (const uint8_t *)uip_appdata;
+    const int len = uip_datalen();
+    const uint8_t count = d[1], n = d[2];
+    uint32_t seq;
+    memcpy(&seq, &d[4], 4);
+
+    switch (d[0]) {
+        case k_halt:
+            halt_pending = true;
+            return;
+
+        case k_reset: {
+            float frequency = 0;
+            if (len >= header_size + 4) memcpy(&frequency, &d[header_size], 4);
+            if (frequency != THEKERNEL->step_ticker->get_frequency()) {
+                if (!bad_frequency) THEKERNEL->streams->printf("Error: multinode master steps at %1.0fHz, set the same step frequency\n", frequency);
+                bad_frequency = true;
+                return;
+            }
+            bad_frequency = false;
+            if (THEKERNEL->is_halted() || !THECONVEYOR->is_queue_empty()) {
+                reset_pending = true;
+                return;
+            }
+            expected = 1;
+            edges = 0;
+            THECONVEYOR->release_held(0);
+            send_header(k_reset_ack, 0, 0, header_size);
+            return;
+        }
+
+        case k_block:
+            if (len < header_size + count * block_size(n)) return;
+            for (uint8_t i = 0; i < count && !THEKERNEL->is_halted() && !refused; i++) {
+                uint32_t s = seq + i;
+                if ((int32_t)(s - expected) < 0) continue; // had it already
+                if (s != expected || THECONVEYOR->is_queue_full()) break; // the master sends it again
+                if (!queue_block(s, &d[header_size + i * block_size(n)], n)) {
+                    THEKERNEL->streams->printf("Error: multinode block %lu can not be run on this board\n", s);
+                    refused = true;
+                    break;
+                }
+                expected++;
+            }
+            send_header(k_ack, 0, expected - 1, header_size);
+            return;
+    }
+}
+
+// queues our motors' part of a block, it is held until the master starts it
+bool MultiNode::queue_block(uint32_t seq, const uint8_t *p, uint8_t n)
+{
+    Planner::planned_block_t b;
+    memset(&b, 0, sizeof(b));
+
+    const uint8_t motors = THEROBOT->get_number_registered_motors();
+    uint32_t most = 0, ours = 0;
+    for (uint8_t m = 0; m < n; m++) {
+        int32_t steps;
+        memcpy(&steps, p, 4); p += 4;
+        uint32_t a = labs(steps);
+        most = std::max(most, a);
+        if (m >= first_actuator && m - first_actuator < motors) {
+            b.steps[m - first_actuator] = steps;
+            ours = std::max(ours, a);
+        }
+    }
+    memcpy(&b.accelerate_until, p, 4); p += 4;
+    memcpy(&b.decelerate_after, p, 4); p += 4;
+    memcpy(&b.total_move_ticks, p, 4); p += 4;
+    memcpy(&b.initial_rate, p, 4); p += 4;
+    memcpy(&b.maximum_rate, p, 4); p += 4;
+    memcpy(&b.final_rate, p, 4); p += 4;
+    memcpy(&b.millimeters, p, 4); p += 4;
+    memcpy(&b.nominal_speed, p, 4); p += 4;
+    memcpy(&b.acceleration, p, 4);
+
+    // none of our motors move in it, only its sync edge is counted
+    if (ours == 0) return true;
+
+    // the rates are for the master's motor with the most steps and have to be for ours
+    float scale = (float)ours / most;
+    b.initial_rate *= scale;
+    b.maximum_rate *= scale;
+    b.final_rate *= scale;
+
+    THECONVEYOR->set_held_seq(seq - 1);
+    if (!THEKERNEL->planner->append_planned_block(b, motors)) return false;
+    // it has to be able to start as soon as the master does
+    THECONVEYOR->release_queue();
+    return true;
+}
+
+void MultiNode::on_block_started(uint32_t)
+{
+    instance->sync_state = !instance->sync_state;
+    instance->sync_pin->set(instance->sync_state);
+}
+
+void MultiNode::on_sync_edge()
+{
+    THECONVEYOR->release_held(++edges);
+}
@@ -0,0 +1,113 @@
+#ifndef __MULTINODE_H__
+#define __MULTINODE_H__
+
+/*
+ * Runs one job on several boards, for a machine with more motors than one board can drive. The master plans every
+ * actuator, the ones on other boards are configured on it with nc pins, and sends each block to the followers a few
+ * blocks before it runs. Each follower runs the steps of its own motors from it, so the path is planned once.
+ *
+ * A block starts on every board together. The master holds it in its queue until every follower has acked it, and
+ * toggles the sync pin as it starts it, each edge lets a follower start the next of the blocks it holds.
+ * Each block runs for the same ticks on every board, so the sync only has to take up the drift of the crystals.
+ *
+ * The datagrams are little endian, a header of the type, a count, the number of motors and a pad byte, then the
+ * sequence number. A block frame is followed by count blocks, from that number on, each of
+ *   int32 steps of each motor, negative is reverse
+ *   uint32 accelerate_until, decelerate_after, total_move_ticks
+ *   float initial_rate, maximum_rate, final_rate, millimeters, nominal_speed, acceleration
+ * the rates are for the motor with the most steps. The follower replies to each with an ack of the last block it has
+ * queued. A reset frame starts the numbers again at 1 and clears a halt, halt halts the follower.
+ */
+
+#include <stdint.h>
+
+struct uip_udp_conn;
+class Block;
+class Pin;
+
+namespace mbed {
+    class InterruptIn;
+}
+
+class MultiNode
+{
+public:
+    MultiNode();
+    ~MultiNode();
+
+    // reads network.multinode, false if it is not enabled or the config is wrong
+    bool configure();
+    // makes the UDP connections once the network is up
+    bool init();
+
+    bool is_master() const { return master; }
+    uint16_t get_port() const { return port; }
+    int get_conn_count() const { return n_conns; }
+    struct uip_udp_conn *get_conn(int i) const;
+    bool is_conn(const struct uip_udp_conn *c) const;
+    // something has to be sent on connection i now
+    bool due(int i) const;
+
+    // called at the start of each Network::on_idle, before uIP is used, so it is safe to halt from
+    void on_idle();
+    void on_halt(bool clear);
+    // the UDP appcall of one of our connections
+    void appcall();
+
+private:
+    static const int k_max_followers= 4;
+
+    struct follower_t {
+        struct uip_udp_conn *conn;
+        uint8_t ip[4];
+        uint32_t acked;    // the last block it has queued
+        uint32_t sent;     // the last block sent to it
+        uint32_t sent_us;  // when the blocks it has not acked were last sent
+        uint32_t wait_us;  // when it last acked, while it has some to ack
+        bool reset:1;      // it has not acked a reset yet
+        bool halt:1;       // it has to be told the master halted
+    };
+
+    void commit();
+    void master_appcall(follower_t &f);
+    void follower_appcall();
+    int encode_blocks(uint8_t *buf, int size, uint32_t first, uint32_t last, uint8_t &count) const;
+    bool queue_block(uint32_t seq, const uint8_t *p, uint8_t n);
+    const Block *find_block(uint32_t seq) const;
+    void send_header(uint8_t type, uint8_t count, uint32_t seq, int len);
+
+    static void on_block_started(uint32_t seq);
+    void on_sync_edge();
+
+    static MultiNode *instance;
+
+    follower_t followers[k_max_followers];
+    int n_followers;
+    int n_conns;
+
+    // master
+    uint32_t committed;     // the last block that has been frozen to be sent
+    uint32_t timeout_us;    // how long a follower can take to ack before the master halts
+    uint8_t ahead;          // how many blocks from the one running are frozen and sent
+    Pin *sync_pin;
+    bool sync_state;
+
+    // follower
+    struct uip_udp_conn *conn;
+    uint8_t master_ip[4];
+    uint8_t first_actuator;  // the master's actuator our first motor is
+    uint32_t expected;       // the next block to queue
+    volatile uint32_t edges; // sync edges since the reset
+    mbed::InterruptIn *sync_in;
+
+    uint16_t port;
+    struct {
+        bool master:1;
+        bool halt_pending:1;     // told to halt, follower
+        bool reset_pending:1;    // told to reset, follower
+        bool bad_frequency:1;    // the master steps at another frequency, follower
+        bool refused:1;          // a block could not be queued, follower
+    };
+};
+
+#endif
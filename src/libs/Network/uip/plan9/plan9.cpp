@@ -11,6 +11,9 @@
 #include "Kernel.h"
 #include "utils.h"
 #include "uip.h"
+#include "platform_memory.h"
+
+#include <stdlib.h>
 
 //#define DEBUG_PRINTF(...) printf("9p " __VA_ARGS__)
 #define DEBUG_PRINTF(...)
@@ -81,7 +84,7 @@ enum {
     MAXWELEM    = 16,
     MAXENTRIES  = 32,
     MAXFIDS     = 32,
-    MAXREQUESTS = 4,
+    MAXREQUESTS = 8,
 };
 
 // TODO: Maybe this should be moved to utils?
@@ -366,16 +369,80 @@ std::string join_path(const std::string& a, const std::string& b)
 } // anonymous namespace
 
 Plan9::Plan9()
-: msize(INITIAL_MSIZE), queue_bytes(0)
+: msize(INITIAL_MSIZE), queue_bytes(0), cache_fp(nullptr), cache_pos(0), cache_write(false), cache_writing(false)
 {
-    PSOCK_INIT(&sin, bufin + 4, sizeof(bufin) - 4);
-    PSOCK_INIT(&sout, bufout + 4, sizeof(bufout) - 4);
+    bufin = alloc_buffer(MAX_MSIZE);
+    bufout = alloc_buffer(MAX_MSIZE);
+    cache = alloc_buffer(CACHE_SIZE);
+    PSOCK_INIT(&sin, bufin + 4, MAX_MSIZE - 4);
+    PSOCK_INIT(&sout, bufout + 4, MAX_MSIZE - 4);
 }
 
 Plan9::~Plan9()
 {
     PSOCK_CLOSE(&sin);
     PSOCK_CLOSE(&sout);
+    close_file();
+    free_buffer(bufin);
+    free_buffer(bufout);
+    free_buffer(cache);
+}
+
+char* Plan9::alloc_buffer(size_t size)
+{
+    void* p = AHB0.alloc(size);
+    if (!p)
+        p = malloc(size);
+    return static_cast<char*>(p);
+}
+
+void Plan9::free_buffer(char* p)
+{
+    if (!p)
+        return;
+    if (AHB0.has(p))
+        AHB0.dealloc(p);
+    else
+        free(p);
+}
+
+FILE* Plan9::open_file(const std::string& path, bool write, uint32_t offset)
+{
+    if (cache_fp && (cache_path != path || (write && !cache_write)))
+        close_file();
+
+    if (!cache_fp) {
+        cache_fp = fopen(path.c_str(), write ? "r+" : "r");
+        if (!cache_fp)
+            return nullptr;
+        if (cache)
+            setvbuf(cache_fp, cache, _IOFBF, CACHE_SIZE);
+        cache_path = path;
+        cache_write = write;
+        cache_writing = false;
+        cache_pos = 0;
+    }
+
+    // only seek when the request does not continue where the last one ended,
+    // switching between reading and writing always needs one
+    if (offset != cache_pos || write != cache_writing) {
+        if (fseek(cache_fp, offset, SEEK_SET)) {
+            close_file();
+            return nullptr;
+        }
+        cache_pos = offset;
+        cache_writing = write;
+    }
+    return cache_fp;
+}
+
+void Plan9::close_file()
+{
+    if (cache_fp) {
+        fclose(cache_fp);
+        cache_fp = nullptr;
+    }
+    cache_path.clear();
 }
 
 Plan9::Entry Plan9::add_entry(uint32_t fid, uint8_t type, const std::string& path)
@@ -445,8 +512,10 @@ void Plan9::appcall()
         return;
     }
 
-    if (!instance) {
+    if (!instance || !instance->bufin || !instance->bufout) {
         DEBUG_PRINTF("null instance\n");
+        delete instance;
+        uip_conn->appstate = nullptr;
         uip_abort();
         return;
     }
@@ -477,7 +546,8 @@ int Plan9::receive()
             DEBUG_PRINTF("receive size=%lu type=%u tag=%d\n", request->size, request->type, request->tag);
         }
 
-        PSOCK_WAIT_UNTIL(&sin, queue_bytes < MAXREQUESTS * INITIAL_MSIZE);
+        // keep accepting requests while earlier ones are processed, so several tags are serviced back-to-back
+        PSOCK_WAIT_UNTIL(&sin, queue.empty() || (queue.size() < MAXREQUESTS && queue_bytes + request->size <= MAX_QUEUE_BYTES));
 
         Message* copy = reinterpret_cast<Message*>(new char[request->size]);
         memcpy(copy, request, request->size);
@@ -525,11 +595,15 @@ bool Plan9::process(Message* request, Message* response)
 {
     Entry entry;
 
+    // anything else may look at or change the file, so it must see what was written
+    if (request->type != Tread && request->type != Twrite)
+        close_file();
+
     switch (request->type) {
     case Tversion:
         DEBUG_PRINTF("Tversion\n");
         RESPONSE(Rversion);
-        msize = response->Rversion.msize = min(INITIAL_MSIZE, request->Tversion.msize);
+        msize = response->Rversion.msize = min(MAX_MSIZE, request->Tversion.msize);
         response->size = putstr(response->buf + response->size, response->buf + msize, "9P2000") - response->buf;
         break;
 
@@ -660,11 +734,14 @@ bool Plan9::process(Message* request, Message* response)
                 }
             }
         } else {
-            File fp(entry->first, "r");
+            FILE* fp = open_file(entry->first, false, request->Tread.offset);
             CHECK(fp, P9_EIO);
-            CHECK(!fseek(fp, request->Tread.offset, SEEK_SET), P9_EIO);
             response->Rread.count = fread(response->buf + response->size, 1, request->Tread.count, fp);
-            CHECK(response->Rread.count == request->Tread.count || !ferror(fp), P9_EIO);
+            cache_pos += response->Rread.count;
+            if (response->Rread.count != request->Tread.count && ferror(fp)) {
+                close_file();
+                ERROR(P9_EIO);
+            }
             response->size += response->Rread.count;
         }
         break;
@@ -701,13 +778,16 @@ bool Plan9::process(Message* request, Message* response)
                   request->Twrite.count <= IOUNIT, P9_EBADMSG);
             CHECK(entry = get_entry(request->fid));
 
-            File fp(entry->first, "r+");
+            FILE* fp = open_file(entry->first, true, request->Twrite.offset);
             CHECK(fp, P9_EIO);
-            CHECK(!fseek(fp, request->Twrite.offset, SEEK_SET), P9_EIO);
 
             RESPONSE(Rwrite);
             response->Rwrite.count = fwrite(request->buf + sizeof (request->Twrite), 1, request->Twrite.count, fp);
-            CHECK(response->Rwrite.count == request->Twrite.count || !ferror(fp), P9_EIO);
+            cache_pos += response->Rwrite.count;
+            if (response->Rwrite.count != request->Twrite.count && ferror(fp)) {
+                close_file();
+                ERROR(P9_EIO);
+            }
         }
         break;
 
@@ -23,6 +23,7 @@
 #include <queue>
 #include <string>
 #include <stdint.h>
+#include <stdio.h>
 
 extern "C" {
 #include "psock.h"
@@ -61,13 +62,38 @@ private:
     bool add_fid(uint32_t, Entry);
     void remove_fid(uint32_t);
 
+    FILE* open_file(const std::string&, bool, uint32_t);
+    void close_file();
+
+    static char* alloc_buffer(size_t);
+    static void free_buffer(char*);
+
+    // A message larger than a segment is received and sent in several by psock,
+    // so msize is not bounded by the uIP buffer
+#ifdef NETWORK_FULL_MTU
+    static const uint32_t MAX_MSIZE  = 2048 + 24;
+    static const uint32_t CACHE_SIZE = 2048;
+#else
+    static const uint32_t MAX_MSIZE  = 1024 + 24;
+    static const uint32_t CACHE_SIZE = 1024;
+#endif
     static const uint32_t INITIAL_MSIZE = 300;
+    static const uint32_t MAX_QUEUE_BYTES = 2 * MAX_MSIZE;
+
     EntryMap             entries;
     FidMap               fids;
     psock                sin, sout;
-    char                 bufin[INITIAL_MSIZE], bufout[INITIAL_MSIZE];
+    char                 *bufin, *bufout;
     std::queue<Message*> queue;
     uint32_t             msize, queue_bytes;
+
+    // The file of the last Tread/Twrite is kept open with cache as its stdio buffer,
+    // so sequential reads are served from the read-ahead and writes go out in whole sectors
+    FILE*                cache_fp;
+    char*                cache;
+    std::string          cache_path;
+    uint32_t             cache_pos;
+    bool                 cache_write, cache_writing;
 };
 
 #endif
@@ -16,7 +16,6 @@ extern "C" {
 
 Sftpd::Sftpd()
 {
-    fd = NULL;
     state = STATE_NORMAL;
     outbuf = NULL;
     filename= NULL;
@@ -24,9 +23,7 @@ Sftpd::Sftpd()
 
 Sftpd::~Sftpd()
 {
-    if (fd != NULL) {
-        fclose(fd);
-    }
+    writer.close();
 }
 
 int Sftpd::senddata()
@@ -77,16 +74,14 @@ int Sftpd::handle_command()
                     // get { NEW|OLD|APP }
                     if (strncmp(&buf[5], "OLD", 3) == 0) {
                         DEBUG_PRINTF("sftp: Opening file: %s\n", fn);
-                        fd = fopen(fn, "w");
-                        if (fd != NULL) {
+                        if (writer.open(fn, "w", true)) {
                             outbuf = "+ new file\n";
                             state = STATE_GET_LENGTH;
                         } else {
                             outbuf = "- failed\n";
                         }
                     } else if (strncmp(&buf[5], "APP", 3) == 0) {
-                        fd = fopen(fn, "a");
-                        if (fd != NULL) {
+                        if (writer.open(fn, "a", true)) {
                             outbuf = "+ append file\n";
                             state = STATE_GET_LENGTH;
                         } else {
@@ -103,8 +98,7 @@ int Sftpd::handle_command()
 
         } else if (state == STATE_GET_LENGTH) {
             if (len < 6 || strncmp(buf, "SIZE", 4) != 0) {
-                fclose(fd);
-                fd = NULL;
+                writer.close();
                 outbuf = "- Expected size\n";
                 state = STATE_CONNECTED;
 
@@ -114,8 +108,7 @@ int Sftpd::handle_command()
                     outbuf = "+ ok, waiting for file\n";
                     state = STATE_DOWNLOAD;
                 } else {
-                    fclose(fd);
-                    fd = NULL;
+                    writer.close();
                     outbuf = "- bad filesize\n";
                     state = STATE_CONNECTED;
                 }
@@ -139,22 +132,28 @@ int Sftpd::handle_download()
 
     if (filesize > 0 && readlen > 0) {
         if (readlen > filesize) readlen = filesize;
-        if (fwrite(readptr, 1, readlen, fd) != readlen) {
+        // staged and written out a whole number of sectors at a time, a buffer that fills is only written on the next
+        // poll so the ack for this segment goes out first and the client carries on sending into the other one
+        if (!writer.write(readptr, readlen)) {
             DEBUG_PRINTF("sftp: Error writing file\n");
-            fclose(fd);
-            fd = NULL;
+            writer.close();
             outbuf = "- Error saving file\n";
             state = STATE_CONNECTED;
             return 0;
         }
         filesize -= readlen;
         DEBUG_PRINTF("sftp: saved %d bytes %d left\n", readlen, filesize);
+        if (filesize > 0 && writer.has_pending()) network_request_poll();
     }
     if (filesize == 0) {
         DEBUG_PRINTF("sftp: download complete\n");
-        fclose(fd);
-        fd = NULL;
-        outbuf = "+ Saved file\n";
+        if (writer.close()) {
+            // the client can check the crc32 of what was saved
+            snprintf(reply, sizeof(reply), "+ Saved file crc32 %08lx\n", writer.get_crc());
+            outbuf = reply;
+        } else {
+            outbuf = "- Error saving file\n";
+        }
         state = STATE_CONNECTED;
         return 0;
     }
@@ -186,9 +185,7 @@ void Sftpd::appcall(void)
 
     if (uip_closed() || uip_aborted() || uip_timedout()) {
         DEBUG_PRINTF("sftp: closed\n");
-        if (fd != NULL)
-            fclose(fd);
-        fd = NULL;
+        writer.close();
         state = STATE_NORMAL;
         return;
     }
@@ -198,6 +195,14 @@ void Sftpd::appcall(void)
         this->acked();
     }
 
+    if (uip_poll() && state == STATE_DOWNLOAD && writer.has_pending() && !writer.write_pending()) {
+        DEBUG_PRINTF("sftp: Error writing file\n");
+        writer.close();
+        outbuf = "- Error saving file\n";
+        state = STATE_CONNECTED;
+        PSOCK_INIT(&sin, buf, sizeof(buf));
+    }
+
     if (uip_newdata()) {
         DEBUG_PRINTF("sftp: newdata\n");
         if (state == STATE_DOWNLOAD) {
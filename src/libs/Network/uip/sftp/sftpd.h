@@ -7,6 +7,7 @@
 
 
 #include <stdio.h>
+#include "FileWriter.h"
 extern "C" {
 #include "psock.h"
 }
@@ -21,7 +22,7 @@ public:
     void init(void);
 
 private:
-    FILE *fd;
+    FileWriter writer;
     enum STATES { STATE_NORMAL, STATE_CONNECTED, STATE_GET_LENGTH, STATE_DOWNLOAD, STATE_CLOSE };
     STATES state;
     int acked();
@@ -32,6 +33,7 @@ private:
     struct psock sin;
     char buf[80];
     const char *outbuf;
+    char reply[32];
     unsigned int filesize;
     char *filename;
 };
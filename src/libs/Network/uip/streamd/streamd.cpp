@@ -0,0 +1,166 @@
+#include "uip.h"
+#include "streamd.h"
+#include "CallbackStream.h"
+#include "CommandQueue.h"
+
+#include <string.h>
+#include <stdio.h>
+
+//#define DEBUG_PRINTF(...)
+#define DEBUG_PRINTF printf
+
+Streamd::Streamd()
+{
+    DEBUG_PRINTF("Streamd: ctor %p\n", this);
+    pstream= new CallbackStream(command_result, this);
+    linelen= olen= nsent= oks= 0;
+    discarding= false;
+}
+
+Streamd::~Streamd()
+{
+    // it may still be in command queue entries, so it deletes itself when it is no longer being used
+    pstream->mark_closed();
+    DEBUG_PRINTF("Streamd: dtor %p\n", this);
+}
+
+// this callback gets the results of a command, line by line, NULL means the command completed
+// static
+int Streamd::command_result(const char *str, void *p)
+{
+    if(str == NULL) return 0; // its ok was counted already
+    return static_cast<Streamd *>(p)->output(str);
+}
+
+int Streamd::output(const char *str)
+{
+    if(strcmp(str, "ok\r\n") == 0 || strcmp(str, "ok\n") == 0) {
+        oks++;
+        return 1;
+    }
+
+    // anything else is sent as is, after the oks of the lines before it, 12 leaves room for those
+    size_t len= strlen(str);
+    if(olen + len + 12 > sizeof(obuf)) {
+        if(olen > 0) return 0; // stalled until what is there is acked
+        len= sizeof(obuf) - 12; // would never fit, send what does
+    }
+    flush_oks();
+    memcpy(&obuf[olen], str, len);
+    olen += len;
+    return 1;
+}
+
+void Streamd::flush_oks()
+{
+    if(oks == 0 || (size_t)olen + 12 > sizeof(obuf)) return;
+    olen += snprintf(&obuf[olen], sizeof(obuf) - olen, "ok %u\n", oks);
+    oks= 0;
+}
+
+void Streamd::newdata()
+{
+    const char *p= (const char *)uip_appdata;
+    for (u16_t i = 0; i < uip_datalen(); i++) {
+        char c= p[i];
+        if(c == '\r') continue;
+        if(c != '\n') {
+            if(linelen < max_line - 1) line[linelen++]= c;
+            else discarding= true;
+            continue;
+        }
+
+        line[linelen]= '\0';
+        if(discarding) {
+            output("error: line too long\n");
+            oks++;
+        } else if(linelen == 0) {
+            // nothing to run, but the client counts every line it sent
+            oks++;
+        } else if(CommandQueue::getInstance()->add(line, pstream) < 0) {
+            output("error: command queue full\n");
+            oks++;
+        }
+        linelen= 0;
+        discarding= false;
+    }
+
+    // close the window while there are enough lines waiting, poll opens it again
+    if(pstream->get_count() >= max_queued) {
+        uip_stop();
+    }
+}
+
+void Streamd::senddata()
+{
+    // new output can only be added when nothing is in flight, a retransmit must send the same bytes again
+    if(nsent == 0) {
+        flush_oks();
+        nsent= olen > uip_mss() ? uip_mss() : olen;
+    }
+    if(nsent > 0) uip_send(obuf, nsent);
+}
+
+void Streamd::acked()
+{
+    olen -= nsent;
+    memmove(obuf, &obuf[nsent], olen);
+    nsent= 0;
+}
+
+void Streamd::poll()
+{
+    if(uip_stopped(uip_conn) && pstream->get_count() < max_queued / 2) {
+        uip_restart();
+    }
+}
+
+// static
+void Streamd::appcall(void)
+{
+    Streamd *instance= reinterpret_cast<Streamd *>(uip_conn->appstate);
+
+    if (uip_connected()) {
+        instance= new Streamd;
+        uip_conn->appstate= instance;
+        instance->rport= uip_conn->rport;
+    }
+
+    if (uip_closed() || uip_aborted() || uip_timedout()) {
+        DEBUG_PRINTF("Streamd: closed: %p\n", instance);
+        if(instance != NULL) {
+            delete instance;
+            uip_conn->appstate= NULL;
+        }
+        return;
+    }
+
+    // sanity check
+    if(instance == NULL || instance->rport != uip_conn->rport) {
+        DEBUG_PRINTF("Streamd: ERROR Null instance or rport is wrong: %p - %u, %d\n", instance, HTONS(uip_conn->rport), uip_flags);
+        uip_abort();
+        return;
+    }
+
+    if (uip_acked()) {
+        instance->acked();
+    }
+
+    if (uip_newdata()) {
+        instance->newdata();
+    }
+
+    if (uip_rexmit() || uip_newdata() || uip_acked() || uip_connected() || uip_poll()) {
+        instance->senddata();
+    }
+
+    if (uip_poll()) {
+        instance->poll();
+    }
+}
+
+// static
+void Streamd::init(uint16_t port)
+{
+    uip_listen(HTONS(port));
+}
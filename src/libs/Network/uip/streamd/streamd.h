@@ -0,0 +1,50 @@
+#ifndef __STREAMD_H__
+#define __STREAMD_H__
+
+/*
+ * Raw TCP G-code streaming service
+ *
+ * The client sends G-code as a continuous stream of lines, there is no shell and no prompt.
+ * Lines go to the same CommandQueue as telnet, when too many from this connection are waiting
+ * the connection is stopped so the TCP window closes, and it is restarted when they drain.
+ * A plain ok for each line is not sent, instead "ok N" says N more lines have completed,
+ * any other output (errors, replies to M105 etc) is sent as is, after any oks counted before it.
+ */
+
+#include <stdint.h>
+
+class CallbackStream;
+
+class Streamd
+{
+public:
+    Streamd();
+    ~Streamd();
+
+    static void init(uint16_t port);
+    static void appcall(void);
+
+private:
+    static int command_result(const char *str, void *p);
+    int output(const char *str);
+    void flush_oks();
+    void newdata();
+    void senddata();
+    void acked();
+    void poll();
+
+    static const int max_line= 132;
+    static const int max_queued= 16; // lines from this connection waiting in the command queue before we stop
+
+    CallbackStream *pstream;
+    char line[max_line];
+    char obuf[512];
+    uint16_t linelen;
+    uint16_t olen;  // bytes in obuf
+    uint16_t nsent; // bytes at the start of obuf sent and not acked yet
+    uint16_t oks;   // oks not yet put in obuf
+    uint16_t rport;
+    bool discarding:1; // skipping the rest of a line that was too long
+};
+
+#endif
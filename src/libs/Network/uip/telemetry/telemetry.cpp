@@ -0,0 +1,60 @@
+#include "uip.h"
+#include "telemetry.h"
+
+#include "Kernel.h"
+#include "PublicData.h"
+#include "TemperatureControlPublicAccess.h"
+#include "us_ticker_api.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <vector>
+
+// the fastest we will publish, a frame takes a few hundred us to build
+#define min_interval_ms 50
+
+bool Telemetry::init(const uint8_t *ipaddr, uint16_t port, uint32_t interval_ms)
+{
+    uip_ipaddr_t addr;
+    uip_ipaddr(addr, ipaddr[0], ipaddr[1], ipaddr[2], ipaddr[3]);
+    conn = uip_udp_new(&addr, HTONS(port));
+    if (conn == nullptr) return false;
+
+    if (interval_ms < min_interval_ms) interval_ms = min_interval_ms;
+    interval_us = interval_ms * 1000;
+    last_us = us_ticker_read();
+    return true;
+}
+
+bool Telemetry::due() const
+{
+    return conn != nullptr && us_ticker_read() - last_us >= interval_us;
+}
+
+void Telemetry::appcall()
+{
+    if (!uip_poll() || !due()) return;
+    last_us = us_ticker_read();
+
+    char *buf = (char *)uip_appdata;
+    const int size = UIP_BUFSIZE - UIP_LLH_LEN - UIP_IPUDPH_LEN;
+
+    // the status snapshot without its closing >
+    const char *s = THEKERNEL->get_status_snapshot();
+    int n = strlen(s);
+    while (n > 0 && (s[n - 1] == '\n' || s[n - 1] == '>')) n--;
+    if (n > size - 32) n = size - 32;
+    memcpy(buf, s, n);
+
+    std::vector<struct pad_temperature> controllers;
+    if (PublicData::get_value(temperature_control_checksum, poll_controls_checksum, &controllers)) {
+        for (auto &c : controllers) {
+            int l = snprintf(&buf[n], size - 32 - n, "|%s:%1.1f,%1.1f", c.designator.c_str(), c.current_temperature, c.target_temperature);
+            if (l >= size - 32 - n) break; // no room for the rest
+            n += l;
+        }
+    }
+
+    n += snprintf(&buf[n], size - n, "|N:%lu>\n", ++seq);
+    uip_udp_send(n);
+}
@@ -0,0 +1,36 @@
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+/*
+ * Publishes the status at a fixed rate as a UDP datagram, unicast, broadcast or multicast,
+ * so a dashboard does not have to poll with ? and M105 over a TCP session.
+ * The frame is the same text as the reply to ?, with |T:current,target for each temperature
+ * control and |N:sequence added before the closing >, eg
+ * <Idle|MPos:0.0000,0.0000,0.0000|WPos:0.0000,0.0000,0.0000|T:21.3,0.0|B:20.9,60.0|N:1234>
+ */
+
+#include <stdint.h>
+
+struct uip_udp_conn;
+
+class Telemetry
+{
+public:
+    Telemetry() : conn(nullptr), interval_us(0), last_us(0), seq(0) {}
+
+    bool init(const uint8_t *ipaddr, uint16_t port, uint32_t interval_ms);
+    bool due() const;
+    bool is_conn(const struct uip_udp_conn *c) const { return c == conn; }
+    struct uip_udp_conn *get_conn() const { return conn; }
+
+    // called from the UDP appcall when the connection is polled, sends a frame if one is due
+    void appcall();
+
+private:
+    struct uip_udp_conn *conn;
+    uint32_t interval_us;
+    uint32_t last_us;
+    uint32_t seq;
+};
+
+#endif
@@ -78,6 +78,7 @@ static void help(char *str, Shell *sh)
     sh->output("h           - show network help\n");
     sh->output("help        - show command help\n");
     sh->output("exit, quit  - exit shell\n");
+    sh->output("quiet [off] - do not show temperature and progress reports\n");
 }
 
 /*---------------------------------------------------------------------------*/
@@ -120,6 +121,14 @@ static void connections(char *str, Shell *sh)
     }
 }
 
+static void quiet(char *str, Shell *sh)
+{
+    // temperature reports and the like still go to the other streams
+    bool off= strstr(str, "off") != nullptr;
+    THEKERNEL->streams->set_stream_mask(sh->getStream(), off ? STREAM_OUTPUT_ALL : STREAM_OUTPUT_NORMAL);
+    sh->output(off ? "reports on\n" : "reports off\n");
+}
+
 static void quit(char *str, Shell *sh)
 {
     sh->close();
@@ -182,7 +191,9 @@ static void unknown(char *str, Shell *sh)
 {
     // its some other command, so queue it for mainloop to find
     if (strlen(str) > 0) {
-        CommandQueue::getInstance()->add(str, sh->getStream());
+        if (CommandQueue::getInstance()->add(str, sh->getStream()) < 0) {
+            sh->output("error: command queue full or line too long\n");
+        }
     }
 }
 /*---------------------------------------------------------------------------*/
@@ -190,6 +201,7 @@ static const struct ptentry parsetab[] = {
     {"netstat", connections},
     {"exit", quit},
     {"quit", quit},
+    {"quiet", quiet},
     {"ntest", ntest},
     {"h", help},
 
@@ -230,13 +242,16 @@ void Shell::start()
     telnet->output_prompt(SHELL_PROMPT);
 }
 
+// the lines from this session waiting on the command queue
 int Shell::queue_size()
 {
-    return CommandQueue::getInstance()->size();
+    return static_cast<CallbackStream*>(pstream)->get_count();
 }
 /*---------------------------------------------------------------------------*/
 void Shell::input(char *cmd)
 {
+    // the built in commands output directly, so anything buffered has to go first
+    static_cast<CallbackStream*>(pstream)->flush(false);
     if (parse(cmd, parsetab)) {
         telnet->output_prompt(SHELL_PROMPT);
     }
@@ -262,8 +277,8 @@ Shell::Shell(Telnetd *telnet)
 {
     DEBUG_PRINTF("Shell: ctor %p - %p\n", this, telnet);
     this->telnet= telnet;
-    // create a callback StreamOutput for this connection
-    pstream = new CallbackStream(command_result, this);
+    // create a callback StreamOutput for this connection, output is coalesced into lines that fit in one telnet chunk
+    pstream = new CallbackStream(command_result, this, 255);
     isConsole= false;
 }
 
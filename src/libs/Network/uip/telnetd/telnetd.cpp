@@ -310,8 +310,8 @@ void Telnetd::newdata(void)
         }
     }
 
-    // if the command queue is getting too big we stop TCP
-    if(shell->queue_size() > 20) {
+    // if this session has too many lines waiting we stop its TCP, the other sessions still get their lines in
+    if(shell->queue_size() > 12) {
         DEBUG_PRINTF("Telnet: stopped: %d\n", shell->queue_size());
         uip_stop();
     }
@@ -395,7 +395,7 @@ void Telnetd::appcall(void)
         instance->senddata();
     }
 
-    if(uip_poll() && uip_stopped(uip_conn) && instance->shell->queue_size() < 5) {
+    if(uip_poll() && uip_stopped(uip_conn) && instance->shell->queue_size() < 4) {
         DEBUG_PRINTF("restarted %d - %p\n", instance->shell->queue_size(), instance);
         uip_restart();
     }
@@ -102,12 +102,30 @@ typedef unsigned short uip_stats_t;
 /**
  * uIP buffer size.
  *
+ * With NETWORK_FULL_MTU it holds a whole ethernet frame, so segments are 1460 bytes,
+ * and the receive window is two segments so the peer can have a second one in the RX ring
+ * while the first is processed.
+ *
  * \hideinitializer
  */
+#ifdef NETWORK_FULL_MTU
+#define UIP_CONF_BUFFER_SIZE     1514
+#define UIP_CONF_RECEIVE_WINDOW  (2 * (UIP_CONF_BUFFER_SIZE - 14 - 40))
+#else
 #define UIP_CONF_BUFFER_SIZE     400
+#endif
 
 #define UIP_CONF_BROADCAST 1
 
+/**
+ * uip_buf is the TX DMA buffer of the next free EMAC descriptor, packets are
+ * received into it and replies are built in place, so sending is just handing
+ * the descriptor to the DMA. It is set up by Network.
+ *
+ * \hideinitializer
+ */
+#define UIP_CONF_EXTERNAL_BUFFER 1
+
 /**
  * CPU byte order.
  *
@@ -128,7 +146,7 @@ typedef unsigned short uip_stats_t;
  * \hideinitializer
  */
 #define UIP_CONF_UDP             1
-#define UIP_CONF_UDP_CONNS 4
+#define UIP_CONF_UDP_CONNS 6 // dhcp, telemetry and up to 4 multinode followers
 /**
  * UDP checksums on or off
  *
@@ -145,8 +163,12 @@ typedef unsigned short uip_stats_t;
 
 #ifdef __cplusplus
 extern "C" void app_select_appcall(void);
+extern "C" void app_select_udp_appcall(void);
+extern "C" void network_request_poll(void);
 #else
 extern void app_select_appcall(void);
+extern void app_select_udp_appcall(void);
+extern void network_request_poll(void);
 #endif
 
 #define UIP_APPCALL app_select_appcall
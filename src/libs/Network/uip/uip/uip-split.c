@@ -61,6 +61,7 @@ void tcpip_output();
 void uip_split_output(void)
 {
     u16_t tcplen, len1, len2;
+    u8_t *first;
 
 
     /* We only try to split maximum sized TCP segments. */
@@ -102,6 +103,7 @@ void uip_split_output(void)
 
         /* Transmit the first packet. */
         /*    uip_fw_output();*/
+        first = uip_buf;
         tcpip_output();
 
         /* Now, create the second packet. To do this, it is not enough to
@@ -121,7 +123,15 @@ void uip_split_output(void)
 #endif /* UIP_CONF_IPV6 */
 
         /*    uip_appdata += len1;*/
-        memcpy(uip_appdata, (u8_t *)uip_appdata + len1, len2);
+        if (uip_buf != first) {
+            /* the first packet went out in place and uip_buf is now the next TX buffer,
+               so the second one is built there from the headers and the rest of the data */
+            memcpy(uip_buf, first, UIP_LLH_LEN + UIP_TCPIP_HLEN);
+            memcpy(&uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN], &first[UIP_LLH_LEN + UIP_TCPIP_HLEN + len1], len2);
+            uip_appdata = &uip_buf[UIP_LLH_LEN + UIP_TCPIP_HLEN];
+        } else {
+            memmove(uip_appdata, (u8_t *)uip_appdata + len1, len2);
+        }
 
         uip_add32(BUF->seqno, len1);
         BUF->seqno[0] = uip_acc32[0];
@@ -427,11 +427,20 @@ void uip_setipid(u16_t id);
  \endcode
  */
 
+#ifdef UIP_CONF_EXTERNAL_BUFFER
+/* the driver owns the buffer and moves this to a new one each time a packet is sent */
+#ifdef __cplusplus
+extern "C" u8_t *uip_buf;
+#else
+extern u8_t *uip_buf;
+#endif
+#else
 #ifdef __cplusplus
 extern "C" u8_t uip_buf[UIP_BUFSIZE+4];
 #else
 extern u8_t uip_buf[UIP_BUFSIZE+4];
 #endif
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,11 +69,13 @@
 #include "http-strings.h"
 
 #include <string.h>
+#include <strings.h>
 #include "stdio.h"
 #include "stdlib.h"
 
 #include "CommandQueue.h"
 #include "CallbackStream.h"
+#include "FileWriter.h"
 
 #include "c-fifo.h"
 
@@ -140,45 +142,95 @@ static void create_callback_stream(struct httpd_state *s)
     s->pstream = new_callback_stream(command_result, s);
 }
 
-// Used to save files to SDCARD during upload
-static FILE *fd;
-static char *output_filename = NULL;
-static int file_cnt = 0;
-static int open_file(const char *fn)
+// Used to save files to SDCARD during upload, there is only one at a time
+static void *upload_writer = NULL;
+static struct httpd_state *upload_owner = NULL;
+static char upload_path[64];
+static int upload_received = 0, upload_total = 0;
+
+// firmware.bin is flashed by the bootloader on the next reset, it is written as firmware.tmp and only renamed once all
+// of it is on the card and its checksum matched, so a failed or cut off upload is never flashed
+#define FIRMWARE_PATH "/sd/firmware.bin"
+#define FIRMWARE_TEMP "/sd/firmware.tmp"
+#define FIRMWARE_MAX  (512 * 1024 - 16 * 1024) // the flash less the bootloader
+static int upload_firmware = 0;
+
+static int open_file(struct httpd_state *s)
 {
-    if (output_filename != NULL) free(output_filename);
-    output_filename = malloc(strlen(fn) + 5);
-    strcpy(output_filename, "/sd/");
-    strcat(output_filename, fn);
-    fd = fopen(output_filename, "w");
-    if (fd == NULL) {
-        free(output_filename);
-        output_filename = NULL;
-        return 0;
+    if (upload_writer != NULL) return 0;
+    upload_firmware = strcasecmp(s->upload_name, "firmware.bin") == 0;
+    if (upload_firmware) {
+        // it has to come with X-Checksum
+        if (!s->check_crc || s->content_length <= 0 || s->content_length > FIRMWARE_MAX) return 0;
+        strcpy(upload_path, FIRMWARE_TEMP);
+    } else {
+        snprintf(upload_path, sizeof(upload_path), "/sd/%s", s->upload_name);
     }
+    // a full sector buffer is written on the next poll, so the ack for the segment that filled it
+    // is not held up by the card and the client carries on sending into the other buffer
+    upload_writer = file_writer_open(upload_path, 1);
+    if (upload_writer == NULL) return 0;
+    upload_owner = s;
+    upload_received = 0;
+    upload_total = s->content_length;
     return 1;
 }
 
-static int close_file()
+static int close_file(uint32_t *crc)
+{
+    int ok = file_writer_close(upload_writer, crc);
+    upload_writer = NULL;
+    upload_owner = NULL;
+    return ok;
+}
+
+// a partly written or corrupt file is not left behind to be played
+static void abort_file()
+{
+    if (upload_writer != NULL) close_file(NULL);
+    remove(upload_path);
+}
+
+// the vector table at the start has the initial stack pointer in the main ram and the reset vector in the flash, if it
+// does not it is not a firmware for this board
+static int install_firmware()
 {
-    free(output_filename);
-    output_filename = NULL;
-    fclose(fd);
+    uint32_t v[2];
+    FILE *fp = fopen(FIRMWARE_TEMP, "r");
+    if (fp == NULL) return 0;
+    int n = fread(v, sizeof(v[0]), 2, fp);
+    fclose(fp);
+    if (n != 2 || v[0] <= 0x10000000 || v[0] > 0x10008000 || (v[1] & 1) == 0 || v[1] >= 512 * 1024) {
+        DEBUG_PRINTF("not a firmware %08lx %08lx\n", v[0], v[1]);
+        return 0;
+    }
+
+    remove(FIRMWARE_PATH);
+    if (rename(FIRMWARE_TEMP, FIRMWARE_PATH) != 0) return 0;
+    strcpy(upload_path, FIRMWARE_PATH);
     return 1;
 }
 
 static int save_file(uint8_t *buf, unsigned int len)
 {
-    if (fwrite(buf, 1, len, fd) == len) {
-        file_cnt += len;
+    if (file_writer_write(upload_writer, buf, len)) {
+        upload_received += len;
+        if (file_writer_has_pending(upload_writer)) network_request_poll();
         return 1;
 
     } else {
-        close_file();
+        abort_file();
         return 0;
     }
 }
 
+static int write_pending()
+{
+    if (file_writer_write_pending(upload_writer)) return 1;
+    abort_file();
+    return 0;
+}
+
 static int fs_open(struct httpd_state *s)
 {
     if (strncmp(s->filename, "/sd/", 4) == 0) {
@@ -289,6 +341,10 @@ static PT_THREAD(send_headers_3(struct httpd_state *s, const char *statushdr, ch
 
     PSOCK_SEND_STR(&s->sout, statushdr);
     PSOCK_SEND_STR(&s->sout, http_header_all);
+    if (s->fs_headers && s->file.headers != NULL) {
+        // Content-Encoding, ETag and Cache-Control of a file in flash
+        PSOCK_SEND_STR(&s->sout, s->file.headers);
+    }
 
     if (send_content_type) {
         ptr = strrchr(s->filename, ISO_period);
@@ -353,6 +409,18 @@ PT_THREAD(handle_output(struct httpd_state *s))
             PT_WAIT_THREAD(&s->outputpt, send_file(s));
         }
 
+    } else if (strcmp(s->filename, "/upload") == 0) {
+        // progress of the current or last upload
+        PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
+        s->strbuf = malloc(sizeof(upload_path) + 32);
+        if (s->strbuf != NULL) {
+            if (upload_total == 0) strcpy(s->strbuf, "idle\r\n");
+            else snprintf(s->strbuf, sizeof(upload_path) + 32, "%s %d %d%s\r\n", upload_path, upload_received, upload_total, upload_writer != NULL ? "" : " done");
+            PSOCK_SEND_STR(&s->sout, s->strbuf);
+            free(s->strbuf);
+            s->strbuf = NULL;
+        }
+
     } else {
         // Presume method GET
         if (!fs_open(s)) { // Note this has the side effect of opening the file
@@ -370,10 +438,17 @@ PT_THREAD(handle_output(struct httpd_state *s))
             }
             // tell it it has not changed
             DEBUG_PRINTF("304 Not Modified\n");
-            PT_WAIT_THREAD(&s->outputpt, send_headers_3(s, http_header_304, 0));
+            if (s->cache_page == 2) {
+                // it keeps the etag and max-age the file was sent with
+                s->fs_headers = 1;
+                PT_WAIT_THREAD(&s->outputpt, send_headers_3(s, http_header_304_etag, 0));
+            } else {
+                PT_WAIT_THREAD(&s->outputpt, send_headers_3(s, http_header_304, 0));
+            }
 
         } else {
             DEBUG_PRINTF("sending file %s\n", s->filename);
+            s->fs_headers = s->fd == NULL;
             PT_WAIT_THREAD(&s->outputpt, send_headers(s, http_header_200));
             if (s->fd != NULL) {
                 // send from sd card
@@ -418,7 +493,7 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
     DEBUG_PRINTF("Uploading file: %s, %d\n", s->upload_name, s->content_length);
 
     // The body is the raw data to be stored to the file
-    if (!open_file(s->upload_name)) {
+    if (!open_file(s)) {
         DEBUG_PRINTF("failed to open file\n");
         s->uploadok = 0;
         PT_EXIT(&s->inputpt);
@@ -440,7 +515,15 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
 
     // save the entire input buffer
     while (s->content_length > 0) {
-        PT_WAIT_UNTIL(&s->inputpt, has_newdata(s));
+        PT_WAIT_UNTIL(&s->inputpt, has_newdata(s) || (uip_poll() && file_writer_has_pending(upload_writer)));
+        if (!uip_newdata()) {
+            if (!write_pending()) {
+                DEBUG_PRINTF("write failed\n");
+                s->uploadok = 0;
+                PT_EXIT(&s->inputpt);
+            }
+            continue;
+        }
         s->upload_state = 1;
 
         u8_t *readptr = (u8_t *)uip_appdata;
@@ -457,8 +540,16 @@ static PT_THREAD(handle_uploaded_data(struct httpd_state *s, uint8_t *buf, int l
         }
     }
 
-    close_file();
-    s->uploadok = 1;
+    {
+        uint32_t crc;
+        s->uploadok = close_file(&crc);
+        if (s->uploadok && s->check_crc && crc != s->upload_crc) {
+            DEBUG_PRINTF("checksum mismatch %08lx %08lx\n", crc, s->upload_crc);
+            s->uploadok = 0;
+        }
+        if (s->uploadok && upload_firmware) s->uploadok = install_firmware();
+        if (!s->uploadok) abort_file();
+    }
     DEBUG_PRINTF("finished upload\n");
 
     PT_END(&s->inputpt);
@@ -504,6 +595,8 @@ PT_THREAD(handle_input(struct httpd_state *s))
     s->state = STATE_HEADERS;
     s->content_length = 0;
     s->cache_page = 0;
+    s->fs_headers = 0;
+    s->check_crc = 0;
     while (1) {
         if (s->state == STATE_HEADERS) {
             // read the headers of the request
@@ -537,10 +630,24 @@ PT_THREAD(handle_input(struct httpd_state *s))
                     strncpy(s->upload_name, &s->inputbuf[12], sizeof(s->upload_name) - 1);
                     DEBUG_PRINTF("Upload name= %s\n", s->upload_name);
 
+                } else if (strncmp(s->inputbuf, "X-Checksum: ", 12) == 0) {
+                    // optional crc32 of the whole body in hex, the upload fails if it does not match
+                    s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
+                    s->upload_crc = strtoul(&s->inputbuf[12], NULL, 16);
+                    s->check_crc = 1;
+
                 } else if (strncmp(s->inputbuf, http_cache_control, sizeof(http_cache_control) - 1) == 0) {
                     s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
                     s->cache_page = strncmp(http_no_cache, &s->inputbuf[sizeof(http_cache_control) - 1], sizeof(http_no_cache) - 1) != 0;
                     DEBUG_PRINTF("cache page= %d\n", s->cache_page);
+
+                } else if (strncmp(s->inputbuf, http_if_none_match, sizeof(http_if_none_match) - 1) == 0) {
+                    // files in flash have an etag, if the browser already has this one it gets a 304
+                    s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
+                    if (httpd_fs_open(s->filename, &s->file) && strstr(&s->inputbuf[sizeof(http_if_none_match) - 1], s->file.etag) != NULL) {
+                        s->cache_page = 2;
+                    }
+                    DEBUG_PRINTF("etag match= %d\n", s->cache_page == 2);
                 }
             }
 
@@ -655,7 +762,8 @@ httpd_appcall(void)
 
     if (uip_closed() || uip_aborted() || uip_timedout()) {
         DEBUG_PRINTF("Closing connection: %d\n", HTONS(uip_conn->rport));
-        if (s->fd != NULL) fclose(fd); // clean up
+        if (s->fd != NULL) fclose(s->fd); // clean up
+        if (upload_owner == s) abort_file();
         if (s->strbuf != NULL) free(s->strbuf);
         if (s->pstream != NULL) {
             // free these if they were allocated
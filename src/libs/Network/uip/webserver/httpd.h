@@ -57,6 +57,9 @@ struct httpd_state {
   uint8_t uploadok;
   uint8_t upload_state;
   uint8_t cache_page;
+  uint8_t fs_headers;
+  uint8_t check_crc;
+  uint32_t upload_crc;
   void *pstream;
   void *fifo;
   uint16_t command_count;
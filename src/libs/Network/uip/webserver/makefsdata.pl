@@ -1,78 +1,106 @@
-#!/usr/bin/perl
-
-open(OUTPUT, "> httpd-fsdata2.h");
-
-chdir("httpd-fs");
-
-opendir(DIR, ".");
-@files =  grep { !/^\./ && !/(CVS|~)/ } readdir(DIR);
-closedir(DIR);
-
-foreach $file (@files) {
-
-    if(-d $file && $file !~ /^\./) {
-	print "Processing directory $file\n";
-	opendir(DIR, $file);
-	@newfiles =  grep { !/^\./ && !/(CVS|~)/ } readdir(DIR);
-	closedir(DIR);
-	printf "Adding files @newfiles\n";
-	@files = (@files, map { $_ = "$file/$_" } @newfiles);
-	next;
-    }
-}
-
-foreach $file (@files) {
-    if(-f $file) {
-
-	print "Adding file $file\n";
-
-	open(FILE, $file) || die "Could not open file $file\n";
-
-	$file =~ s-^-/-;
-	$fvar = $file;
-	$fvar =~ s-/-_-g;
-	$fvar =~ s-\.-_-g;
-	# for AVR, add PROGMEM here
-	print(OUTPUT "static const unsigned char data".$fvar."[] = {\n");
-	print(OUTPUT "\t/* $file */\n\t");
-	for($j = 0; $j < length($file); $j++) {
-	    printf(OUTPUT "%#02x, ", unpack("C", substr($file, $j, 1)));
-	}
-	printf(OUTPUT "0,\n");
-
-
-	$i = 0;
-	while(read(FILE, $data, 1)) {
-	    if($i == 0) {
-		print(OUTPUT "\t");
-	    }
-	    printf(OUTPUT "%#02x, ", unpack("C", $data));
-	    $i++;
-	    if($i == 10) {
-		print(OUTPUT "\n");
-		$i = 0;
-	    }
-	}
-	print(OUTPUT "0};\n\n");
-	close(FILE);
-	push(@fvars, $fvar);
-	push(@pfiles, $file);
-    }
-}
-
-for($i = 0; $i < @fvars; $i++) {
-    $file = $pfiles[$i];
-    $fvar = $fvars[$i];
-
-    if($i == 0) {
-        $prevfile = "NULL";
-    } else {
-        $prevfile = "file" . $fvars[$i - 1];
-    }
-    print(OUTPUT "const struct httpd_fsdata_file file".$fvar."[] = {{$prevfile, data$fvar, ");
-    print(OUTPUT "data$fvar + ". (length($file) + 1) .", ");
-    print(OUTPUT "sizeof(data$fvar) - ". (length($file) + 2) ."}};\n\n"); # don't include the terminating nul
-}
-
-print(OUTPUT "#define HTTPD_FS_ROOT file$fvars[$i - 1]\n\n");
-print(OUTPUT "#define HTTPD_FS_NUMFILES $i\n");
+#!/usr/bin/perl
+
+use Digest::MD5 qw(md5_hex);
+
+# files at least this big are stored gzipped when that makes them smaller, smaller ones fit in a
+# segment or two anyway, and the 404 page must stay plain as it is sent without the extra headers
+$mingzip = 1024;
+
+open(OUTPUT, "> httpd-fsdata2.h");
+
+chdir("httpd-fs");
+
+opendir(DIR, ".");
+@files =  grep { !/^\./ && !/(CVS|~)/ } readdir(DIR);
+closedir(DIR);
+
+foreach $file (@files) {
+
+    if(-d $file && $file !~ /^\./) {
+	print "Processing directory $file\n";
+	opendir(DIR, $file);
+	@newfiles =  grep { !/^\./ && !/(CVS|~)/ } readdir(DIR);
+	closedir(DIR);
+	printf "Adding files @newfiles\n";
+	@files = (@files, map { $_ = "$file/$_" } @newfiles);
+	next;
+    }
+}
+
+foreach $file (@files) {
+    if(-f $file) {
+
+	print "Adding file $file\n";
+
+	open(FILE, $file) || die "Could not open file $file\n";
+	binmode(FILE);
+	local $/;
+	$content = <FILE>;
+	close(FILE);
+
+	$headers = "";
+	if(length($content) >= $mingzip) {
+	    # -n so the output and so the etag only change when the file does
+	    open(GZIP, "-|", "gzip", "-9", "-n", "-c", $file) || die "Could not gzip file $file\n";
+	    binmode(GZIP);
+	    $gzipped = <GZIP>;
+	    close(GZIP);
+	    if(length($gzipped) < length($content)) {
+		print "Compressed $file " . length($content) . " -> " . length($gzipped) . "\n";
+		$content = $gzipped;
+		$headers = "Content-Encoding: gzip\\r\\n";
+	    }
+	}
+	$etag = substr(md5_hex($content), 0, 8);
+	$headers .= "ETag: \\\"$etag\\\"\\r\\nCache-Control: max-age=600\\r\\n";
+
+	$file =~ s-^-/-;
+	$fvar = $file;
+	$fvar =~ s-/-_-g;
+	$fvar =~ s-\.-_-g;
+	# for AVR, add PROGMEM here
+	print(OUTPUT "static const unsigned char data".$fvar."[] = {\n");
+	print(OUTPUT "\t/* $file */\n\t");
+	for($j = 0; $j < length($file); $j++) {
+	    printf(OUTPUT "%#02x, ", unpack("C", substr($file, $j, 1)));
+	}
+	printf(OUTPUT "0,\n");
+
+
+	$i = 0;
+	foreach $data (split(//, $content)) {
+	    if($i == 0) {
+		print(OUTPUT "\t");
+	    }
+	    printf(OUTPUT "%#02x, ", unpack("C", $data));
+	    $i++;
+	    if($i == 10) {
+		print(OUTPUT "\n");
+		$i = 0;
+	    }
+	}
+	print(OUTPUT "0};\n\n");
+	push(@fvars, $fvar);
+	push(@pfiles, $file);
+	push(@pheaders, $headers);
+	push(@petags, $etag);
+    }
+}
+
+for($i = 0; $i < @fvars; $i++) {
+    $file = $pfiles[$i];
+    $fvar = $fvars[$i];
+
+    if($i == 0) {
+        $prevfile = "NULL";
+    } else {
+        $prevfile = "file" . $fvars[$i - 1];
+    }
+    print(OUTPUT "const struct httpd_fsdata_file file".$fvar."[] = {{$prevfile, data$fvar, ");
+    print(OUTPUT "data$fvar + ". (length($file) + 1) .", ");
+    print(OUTPUT "sizeof(data$fvar) - ". (length($file) + 2) .", "); # don't include the terminating nul
+    print(OUTPUT "\"$pheaders[$i]\", \"$petags[$i]\"}};\n\n");
+}
+
+print(OUTPUT "#define HTTPD_FS_ROOT file$fvars[$i - 1]\n\n");
+print(OUTPUT "#define HTTPD_FS_NUMFILES $i\n");
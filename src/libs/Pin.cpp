@@ -7,6 +7,8 @@
 #include "PinNames.h"
 #include "port_api.h"
 
+volatile uint32_t FastPin::nowhere;
+
 Pin::Pin(){
     this->inverting= false;
     this->valid= false;
@@ -192,6 +194,26 @@ mbed::PwmOut* Pin::hardware_pwm()
     return nullptr;
 }
 
+int Pin::pwm1_channel() const
+{
+    if(port_number == 1) {
+        switch(pin) {
+            case 18: return 1;
+            case 20: return 2;
+            case 21: return 3;
+            case 23: return 4;
+            case 24: return 5;
+            case 26: return 6;
+        }
+    } else if(port_number == 2) {
+        if(pin <= 5) return pin + 1;
+    } else if(port_number == 3) {
+        if(pin == 25) return 2;
+        if(pin == 26) return 3;
+    }
+    return 0;
+}
+
 mbed::InterruptIn* Pin::interrupt_pin()
 {
     if(!this->valid) return nullptr;
@@ -200,8 +222,15 @@ mbed::InterruptIn* Pin::interrupt_pin()
     as_input();
 
     if (port_number == 0 || port_number == 2) {
+        // InterruptIn sets the pin up with a pull down, put back the pull up or none this pin was configured with
+        volatile uint32_t *pinmode = &LPC_PINCON->PINMODE0 + (port_number * 2) + (pin >> 4);
+        uint32_t shift = (pin & 0x0F) * 2;
+        uint32_t mode = *pinmode & (3 << shift);
+
         PinName pinname = port_pin((PortName)port_number, pin);
-        return new mbed::InterruptIn(pinname);
+        mbed::InterruptIn *irq = new mbed::InterruptIn(pinname);
+        *pinmode = (*pinmode & ~(3 << shift)) | mode;
+        return irq;
 
     }else{
         this->valid= false;
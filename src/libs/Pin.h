@@ -19,7 +19,7 @@ class Pin {
 
         Pin* from_string(std::string value);
 
-        inline bool connected(){
+        inline bool connected() const {
             return this->valid;
         }
 
@@ -64,6 +64,8 @@ class Pin {
         }
 
         mbed::PwmOut *hardware_pwm();
+        // the PWM1 channel (1-6) of this pin, 0 if it does not have one
+        int pwm1_channel() const;
 
         mbed::InterruptIn *interrupt_pin();
 
@@ -83,6 +85,35 @@ class Pin {
         };
 };
 
+// A pin written from an ISR, what it needs is resolved when it is made from a configured Pin, so a write is one store
+// of its mask to FIOSET or FIOCLR, with no valid or inverting test. One that is not connected writes to a dummy.
+// Later changes to the Pin, like set_inverting(), are not seen, make it again after them.
+class FastPin {
+    public:
+        FastPin() : on(&nowhere), off(&nowhere), mask(0) {}
+        explicit FastPin(const Pin& p)
+        {
+            if(!p.connected()) {
+                on= off= &nowhere;
+                mask= 0;
+                return;
+            }
+            on= p.is_inverting() ? &p.port->FIOCLR : &p.port->FIOSET;
+            off= p.is_inverting() ? &p.port->FIOSET : &p.port->FIOCLR;
+            mask= 1 << p.pin;
+        }
+
+        inline void set(bool value) const { *(value ? on : off)= mask; }
+        inline void high() const { *on= mask; }
+        inline void low() const { *off= mask; }
+
+    private:
+        volatile uint32_t *on;
+        volatile uint32_t *off;
+        uint32_t mask;
+        static volatile uint32_t nowhere;
+};
+
 
 
 
@@ -2,12 +2,49 @@
 #include "PublicData.h"
 #include "PublicDataRequest.h"
 
+// the registered handlers, hashed on csa
+struct PublicDataHandler {
+    Module *module;
+    PublicDataHandler *next;
+    uint16_t csa;
+    uint16_t csb;
+    bool set;
+};
+
+static const int n_buckets= 16; // checksums are well spread so the low bits will do
+static PublicDataHandler *handlers[n_buckets];
+
+void PublicData::register_handler(uint16_t csa, uint16_t csb, Module *module, bool set)
+{
+    PublicDataHandler *h= new PublicDataHandler;
+    h->module= module;
+    h->csa= csa;
+    h->csb= csb;
+    h->set= set;
+    // in the order they registered, like the event
+    PublicDataHandler **p= &handlers[csa % n_buckets];
+    while(*p != nullptr) p= &(*p)->next;
+    h->next= nullptr;
+    *p= h;
+}
+
+// call every module registered for the request
+static void dispatch(PublicDataRequest &pdr, uint16_t csa, uint16_t csb, bool set)
+{
+    for(PublicDataHandler *h= handlers[csa % n_buckets]; h != nullptr; h= h->next) {
+        if(h->csa != csa || h->set != set || (h->csb != 0 && h->csb != csb)) continue;
+        if(set) h->module->on_set_public_data(&pdr);
+        else h->module->on_get_public_data(&pdr);
+    }
+}
+
 bool PublicData::get_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data) {
     PublicDataRequest pdr(csa, csb, csc);
     // the caller may have created the storage for the returned data so we clear the flag,
     // if it gets set by the callee setting the data ptr that means the data is a pointer to a pointer and is set to a pointer to the returned data
     pdr.set_data_ptr(data, false);
-    THEKERNEL->call_event(ON_GET_PUBLIC_DATA, &pdr );
+    dispatch(pdr, csa, csb, false);
+    if(!pdr.is_taken()) THEKERNEL->call_event(ON_GET_PUBLIC_DATA, &pdr );
     if(pdr.is_taken() && pdr.has_returned_data()) {
         // the callee set the returned data pointer
         *(void**)data= pdr.get_data_ptr();
@@ -18,6 +55,7 @@ bool PublicData::get_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data)
 bool PublicData::set_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data) {
     PublicDataRequest pdr(csa, csb, csc);
     pdr.set_data_ptr(data);
-    THEKERNEL->call_event(ON_SET_PUBLIC_DATA, &pdr );
+    dispatch(pdr, csa, csb, true);
+    if(!pdr.is_taken()) THEKERNEL->call_event(ON_SET_PUBLIC_DATA, &pdr );
     return pdr.is_taken();
 }
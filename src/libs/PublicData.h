@@ -8,8 +8,18 @@
 #ifndef PUBLICDATA_H
 #define PUBLICDATA_H
 
+#include <stdint.h>
+
+class Module;
+
 class PublicData {
     public:
+        // a module that answers requests starting with csa registers for it here instead of for ON_GET/SET_PUBLIC_DATA,
+        // it is then called directly for just those requests, a csb of 0 is any csb. It still checks the request as before.
+        // Requests nobody registered for, or that a registered module did not take, still go to the event
+        static void register_get(uint16_t csa, Module *module, uint16_t csb= 0) { register_handler(csa, csb, module, false); }
+        static void register_set(uint16_t csa, Module *module, uint16_t csb= 0) { register_handler(csa, csb, module, true); }
+
         // there are two ways to get data from a module
         // 1. pass in a pointer to a data storage area that the caller creates, the callee module will put the returned data in that pointer
         // 2. pass in a pointer to a pointer, the callee will set that pointer to some storage the callee has control over, with the requested data
@@ -23,6 +33,9 @@ class PublicData {
         static bool set_value(uint16_t csa, uint16_t csb, void *data) { return set_value(csa, csb, 0, data); }
         static bool set_value(uint16_t cs[3], void *data) { return set_value(cs[0], cs[1], cs[2], data); }
         static bool set_value(uint16_t csa, uint16_t csb, uint16_t csc, void *data);
+
+    private:
+        static void register_handler(uint16_t csa, uint16_t csb, Module *module, bool set);
 };
 
 #endif
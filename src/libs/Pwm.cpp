@@ -1,13 +1,51 @@
 #include "Pwm.h"
 
 #include "utils.h"
+#include "Kernel.h"
+#include "SlowTicker.h"
+#include "PwmOut.h" // mbed.h lib
+
+#include <vector>
+#include <math.h>
 
 #define PID_PWM_MAX 256
 
-// What ?
+// the shared PWM1 period must not be faster than this for a heater or fan to be put on it
+#define MIN_HARDWARE_PERIOD_US 1000
+
+namespace {
+    // the software pwm outputs all share one slow ticker hook running at the fastest frequency asked for,
+    // each output is ticked every divider calls
+    struct Output {
+        Pwm *pwm;
+        uint32_t frequency;
+        uint16_t divider;
+        uint16_t countdown;
+        bool allow_hardware;
+    };
+
+    struct SoftwarePwm {
+        uint32_t tick(uint32_t dummy)
+        {
+            for(auto &o : outputs) {
+                if(--o.countdown == 0) {
+                    o.countdown= o.divider;
+                    o.pwm->on_tick(0);
+                }
+            }
+            return 0;
+        }
+
+        std::vector<Output> outputs;
+    };
+
+    SoftwarePwm *software= nullptr;
+    bool started= false;
+}
 
 Pwm::Pwm()
 {
+    _hw = nullptr;
     _max = PID_PWM_MAX - 1;
     _pwm = -1;
     _sd_direction= false;
@@ -17,12 +55,14 @@ Pwm::Pwm()
 void Pwm::pwm(int new_pwm)
 {
     _pwm = confine(new_pwm, 0, _max);
+    if (_hw != nullptr) write_hardware();
 }
 
 Pwm* Pwm::max_pwm(int new_max)
 {
     _max = confine(new_max, 0, PID_PWM_MAX - 1);
     _pwm = confine(   _pwm, 0, _max);
+    if (_hw != nullptr) write_hardware();
     return this;
 }
 
@@ -34,7 +74,85 @@ int Pwm::max_pwm()
 void Pwm::set(bool value)
 {
     _pwm = -1;
-    Pin::set(value);
+    if (_hw != nullptr) {
+        _hw->write((value ^ is_inverting()) ? 1.0F : 0.0F);
+    } else {
+        Pin::set(value);
+    }
+}
+
+// the duty cycle is the fraction of the period the output is on, so it is flipped for an inverted pin
+void Pwm::write_hardware()
+{
+    if (_pwm < 0) return; // set() wrote it already
+    float duty = (float)_pwm / (PID_PWM_MAX - 1);
+    _hw->write(is_inverting() ? 1.0F - duty : duty);
+}
+
+bool Pwm::use_hardware()
+{
+    int ch = pwm1_channel();
+    if (!connected() || ch == 0) return false;
+
+    // another output may already have the channel, eg 1.18 and 2.0 are both PWM1.1
+    if (LPC_PWM1->PCR & (1 << (8 + ch))) return false;
+
+    // all the channels share MR0, keep the period if something already set one, PwmOut sets 20ms otherwise
+    uint32_t period = (LPC_PWM1->TCR & (1 << 3)) ? LPC_PWM1->MR0 : 0;
+    uint32_t ticks_per_us = SystemCoreClock / 4000000; // PwmOut runs PWM1 at cclk/4
+    if (period > 0 && period < MIN_HARDWARE_PERIOD_US * ticks_per_us) return false;
+
+    bool on = Pin::get();
+    _hw = hardware_pwm();
+    if (_hw == nullptr) return false;
+    if (period > 0) _hw->period_us(period / ticks_per_us);
+
+    if (_pwm < 0) set(on);
+    else write_hardware();
+    return true;
+}
+
+void Pwm::attach(uint32_t frequency, bool allow_hardware)
+{
+    _out = FastPin(*this);
+    if (started) {
+        // too late to share the hook or look for a channel
+        THEKERNEL->slow_ticker->attach(frequency, this, &Pwm::on_tick);
+        return;
+    }
+
+    if (software == nullptr) software = new SoftwarePwm;
+    software->outputs.push_back({this, frequency, 1, 1, allow_hardware});
+}
+
+void Pwm::start_all()
+{
+    started = true;
+    if (software == nullptr) return;
+
+    auto &outputs = software->outputs;
+    uint32_t max_frequency = 0;
+    for (auto o = outputs.begin(); o != outputs.end(); ) {
+        if (o->allow_hardware && o->pwm->use_hardware()) {
+            o = outputs.erase(o);
+        } else {
+            if (o->frequency > max_frequency) max_frequency = o->frequency;
+            ++o;
+        }
+    }
+
+    if (outputs.empty()) {
+        delete software;
+        software = nullptr;
+        return;
+    }
+
+    for (auto &o : outputs) {
+        long d = lroundf((float)max_frequency / o.frequency);
+        o.divider = d < 1 ? 1 : d;
+        o.countdown = o.divider;
+    }
+    THEKERNEL->slow_ticker->attach(max_frequency, software, &SoftwarePwm::tick);
 }
 
 uint32_t Pwm::on_tick(uint32_t dummy)
@@ -43,11 +161,11 @@ uint32_t Pwm::on_tick(uint32_t dummy)
         return dummy;
     }
     else if (_pwm == 0) {
-        Pin::set(false);
+        _out.low();
         return dummy;
     }
     else if (_pwm == PID_PWM_MAX - 1) {
-        Pin::set(true);
+        _out.high();
         return dummy;
     }
 
@@ -129,7 +247,7 @@ uint32_t Pwm::on_tick(uint32_t dummy)
         if (_sd_accumulator <= 0)
             _sd_direction = false;
     }
-    Pin::set(_sd_direction);
+    _out.set(_sd_direction);
 
     return dummy;
 }
@@ -6,6 +6,10 @@
 #include "Pin.h"
 #include "Module.h"
 
+namespace mbed {
+    class PwmOut;
+}
+
 class Pwm : public Module, public Pin {
 public:
     Pwm();
@@ -20,7 +24,20 @@ public:
     int      get_pwm() const { return _pwm; }
     void     set(bool);
 
+    // adds this output to the shared software pwm hook at frequency, when start_all() runs it is handed over
+    // to a PWM1 channel instead if allow_hardware is set and the pin has a free one
+    void     attach(uint32_t frequency, bool allow_hardware);
+    bool     is_hardware() const { return _hw != nullptr; }
+
+    // called once all the modules are loaded, so any fixed PWM1 period (laser, spindle, hwpwm switch) is known
+    static void start_all();
+
 private:
+    bool     use_hardware();
+    void     write_hardware();
+
+    mbed::PwmOut *_hw;
+    FastPin _out; // what on_tick() writes, made when it is attached
     int  _max;
     int  _pwm;
     int  _sd_accumulator;
@@ -0,0 +1,202 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SPIBus.h"
+#include "libs/Pin.h"
+
+#include "mbed.h" // for SPI
+#include "system_LPC17xx.h" // for SystemCoreClock
+
+// SSP register bits
+#define SSP_CR1_SSE   (1 << 1)
+#define SSP_SR_RNE    (1 << 2)
+#define SSP_SR_BSY    (1 << 4)
+#define SSP_IM_RT     (1 << 1)
+#define SSP_IM_RX     (1 << 2)
+
+// mbed::SPI only sets its format again when another mbed::SPI was used last, this lets the bus
+// make the next one do so after it has changed the registers itself
+class BusSPI : public mbed::SPI
+{
+public:
+    BusSPI(PinName mosi, PinName miso, PinName sclk) : mbed::SPI(mosi, miso, sclk) {}
+    static void forget_owner() { _owner = nullptr; }
+};
+
+SPIBus *SPIBus::buses[2]= {nullptr, nullptr};
+
+SPIBus *SPIBus::get(int channel)
+{
+    if(channel < 0 || channel > 1) return nullptr;
+    if(buses[channel] == nullptr) buses[channel]= new SPIBus(channel);
+    return buses[channel];
+}
+
+SPIBus::SPIBus(int channel)
+{
+    current= nullptr;
+    holds= 0;
+    head= tail= 0;
+    received= 0;
+
+    IRQn_Type irq;
+    if(channel == 0) {
+        spi= new BusSPI(P0_18, P0_17, P0_15);
+        ssp= LPC_SSP0;
+        irq= SSP0_IRQn;
+        NVIC_SetVector(irq, (uint32_t)&SPIBus::ssp0_isr);
+    } else {
+        spi= new BusSPI(P0_9, P0_8, P0_7);
+        ssp= LPC_SSP1;
+        irq= SSP1_IRQn;
+        NVIC_SetVector(irq, (uint32_t)&SPIBus::ssp1_isr);
+    }
+    ssp->IMSC= 0;
+    NVIC_EnableIRQ(irq);
+}
+
+void SPIBus::hold(int channel)
+{
+    if(channel >= 0 && channel <= 1 && buses[channel] != nullptr) buses[channel]->hold();
+}
+
+void SPIBus::release(int channel)
+{
+    if(channel >= 0 && channel <= 1 && buses[channel] != nullptr) buses[channel]->release();
+}
+
+void SPIBus::hold()
+{
+    __disable_irq();
+    holds++;
+    __enable_irq();
+
+    // at most a few bytes, and the SSP interrupt is above everything that holds the bus
+    while(current != nullptr) ;
+    BusSPI::forget_owner();
+}
+
+void SPIBus::release()
+{
+    __disable_irq();
+    if(holds > 0) holds--;
+    start();
+    __enable_irq();
+}
+
+// same search as mbed spi_frequency(), PCLK is cclk which mbed::SPI set up
+void SPIBus::setup(Device &device, Pin *cs, uint32_t frequency, int mode)
+{
+    uint32_t prescaler, divider= 256;
+    for (prescaler = 2; prescaler <= 254; prescaler += 2) {
+        divider= (SystemCoreClock / prescaler + frequency / 2) / frequency;
+        if(divider < 256) break;
+    }
+    if(divider < 1) divider= 1;
+    if(divider > 256) divider= 256;
+
+    device.cs= cs;
+    device.cpsr= prescaler > 254 ? 254 : prescaler;
+    device.cr0= 7 | ((mode & 2) << 5) | ((mode & 1) << 7) | ((divider - 1) << 8); // 8 bits, cpol, cpha, scr
+}
+
+bool SPIBus::queue(Transaction *t)
+{
+    if(t->busy || t->len == 0 || t->len > max_len) return false;
+
+    __disable_irq();
+    uint8_t next= (head + 1) % queue_size;
+    if(next == tail) {
+        __enable_irq();
+        return false;
+    }
+    t->busy= true;
+    pending[head]= t;
+    head= next;
+    start();
+    __enable_irq();
+    return true;
+}
+
+// the chip select goes first, the register writes give it the setup time a max31855 needs
+void SPIBus::select(Device *device)
+{
+    device->cs->set(false);
+    ssp->CR1= 0;
+    ssp->CR0= device->cr0;
+    ssp->CPSR= device->cpsr;
+    ssp->CR1= SSP_CR1_SSE;
+    while(ssp->SR & SSP_SR_RNE) (void)ssp->DR; // anything a previous user left behind
+}
+
+// called with interrupts disabled, starts the next transaction if the bus is free
+void SPIBus::start()
+{
+    if(current != nullptr || holds > 0 || head == tail) return;
+
+    Transaction *t= pending[tail];
+    tail= (tail + 1) % queue_size;
+    current= t;
+    received= 0;
+
+    select(t->device);
+    for (int i = 0; i < t->len; ++i) {
+        ssp->DR= t->tx[i];
+    }
+    // half full for the longer ones, the timeout for the rest of them
+    ssp->IMSC= SSP_IM_RT | SSP_IM_RX;
+}
+
+void SPIBus::isr()
+{
+    ssp->ICR= SSP_IM_RT;
+    Transaction *t= current;
+    if(t == nullptr) {
+        ssp->IMSC= 0;
+        return;
+    }
+
+    while((ssp->SR & SSP_SR_RNE) && received < t->len) {
+        t->rx[received++]= ssp->DR;
+    }
+    if(received < t->len) return;
+
+    ssp->IMSC= 0;
+    t->device->cs->set(true);
+    t->busy= false;
+    current= nullptr;
+    if(t->done != nullptr) t->done(t);
+
+    __disable_irq();
+    start();
+    __enable_irq();
+}
+
+void SPIBus::ssp0_isr()
+{
+    buses[0]->isr();
+}
+
+void SPIBus::ssp1_isr()
+{
+    buses[1]->isr();
+}
+
+int SPIBus::transfer(Device &device, const uint8_t *tx, uint8_t *rx, int len)
+{
+    hold();
+    select(&device);
+    for (int i = 0; i < len; ++i) {
+        ssp->DR= tx[i];
+        while(!(ssp->SR & SSP_SR_RNE)) ;
+        rx[i]= ssp->DR;
+    }
+    while(ssp->SR & SSP_SR_BSY) ;
+    device.cs->set(true);
+    release();
+    return len;
+}
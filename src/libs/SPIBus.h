@@ -0,0 +1,82 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SPIBUS_H
+#define SPIBUS_H
+
+#include <stdint.h>
+
+#include "libs/LPC17xx/sLPC17xx.h"
+
+class Pin;
+class BusSPI;
+
+// One of the two SSPs, shared by devices that each have their own chip select, clock and mode.
+// Transactions are queued and run from the SSP interrupt, the bytes go into the fifo in one go and the
+// callback is called from the interrupt once the answer is in, so a sensor read does not wait for the bus.
+// transfer() is the same thing but waits, for drivers that need the answer straight away.
+// Code that drives the bus with its own mbed::SPI (the sdcard, the panels, the digipot) must hold the bus
+// while its chip select is active, hold waits for the transaction in progress and nothing new starts until
+// it is released. These are all called from the main loop or the USB interrupt, never from above the SSP.
+class SPIBus
+{
+public:
+    static const int max_len= 8; // the SSP fifo depth, a queued transaction never needs refilling
+
+    struct Device {
+        Pin *cs;
+        uint32_t cr0;
+        uint32_t cpsr;
+    };
+
+    struct Transaction {
+        Device *device;
+        uint8_t len;
+        uint8_t tx[max_len];
+        uint8_t rx[max_len];
+        void (*done)(Transaction *t); // called from the SSP interrupt, may queue it again
+        void *arg;
+        volatile bool busy;           // queued or in progress
+    };
+
+    // the bus for SSP channel 0 or 1, created on first use
+    static SPIBus *get(int channel);
+
+    // for code that uses its own mbed::SPI on the channel, does nothing if the bus was never created
+    static void hold(int channel);
+    static void release(int channel);
+
+    // turns the frequency and mode (0-3) into the register settings, 8 bit frames
+    void setup(Device &device, Pin *cs, uint32_t frequency, int mode);
+    // returns false if it is already queued, too long or the queue is full
+    bool queue(Transaction *t);
+    int transfer(Device &device, const uint8_t *tx, uint8_t *rx, int len);
+
+private:
+    SPIBus(int channel);
+
+    void hold();
+    void release();
+    void start();
+    void select(Device *device);
+    void isr();
+    static void ssp0_isr();
+    static void ssp1_isr();
+
+    static SPIBus *buses[2];
+    static const int queue_size= 8;
+
+    LPC_SSP_TypeDef *ssp;
+    BusSPI *spi; // sets up the pins and the power, and tells the other mbed::SPI users to set theirs again
+    Transaction *pending[queue_size];
+    Transaction *volatile current;
+    volatile uint8_t holds;
+    uint8_t head, tail;
+    uint8_t received;
+};
+
+#endif
@@ -0,0 +1,180 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sLPC17xx.h"
+
+// Lock free fixed size queue, safe for a single producer and a single consumer which may be in different contexts
+// (eg an ISR and the main loop) without disabling interrupts.
+// Each index is only ever written by one side, the producer owns head and the consumer owns tail.
+// The slot is written before head is moved (release) and read after head is loaded (acquire), and the same for tail,
+// the dmb makes sure the data access and the index update can not be reordered by the compiler or the core.
+// Capacity must be a power of 2, one slot is kept free so capacity-1 items can be queued.
+template <class T, size_t capacity>
+class SPSCQueue
+{
+    static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0, "SPSCQueue capacity must be a power of 2");
+
+public:
+    SPSCQueue() : head(0), tail(0) {}
+
+    bool empty() const { return head == tail; }
+    bool full() const { return next(head) == tail; }
+    size_t size() const { return (head - tail) & mask; }
+    size_t free() const { return (mask - size()); }
+    static constexpr size_t max_size() { return capacity - 1; }
+
+    // producer side, returns false if full
+    bool push(const T &item)
+    {
+        size_t h= head;
+        if(next(h) == tail) return false;
+        buffer[h]= item;
+        __DMB(); // item must be written before it is published
+        head= next(h);
+        return true;
+    }
+
+    // producer side, queues as many of the n items as fit, returns how many were queued
+    size_t push(const T *items, size_t n)
+    {
+        size_t h= head;
+        size_t f= (tail - h - 1) & mask;
+        if(n > f) n= f;
+        for (size_t i = 0; i < n; i++) {
+            buffer[h]= items[i];
+            h= next(h);
+        }
+        __DMB();
+        head= h;
+        return n;
+    }
+
+    // consumer side, returns false if empty
+    bool pop(T &item)
+    {
+        size_t t= tail;
+        if(t == head) return false;
+        __DMB(); // do not read the item before we have seen head
+        item= buffer[t];
+        __DMB(); // item must be read before the slot is handed back to the producer
+        tail= next(t);
+        return true;
+    }
+
+    // consumer side, removes up to n items into items, returns how many were removed
+    size_t pop(T *items, size_t n)
+    {
+        size_t t= tail;
+        size_t s= (head - t) & mask;
+        if(n > s) n= s;
+        __DMB();
+        for (size_t i = 0; i < n; i++) {
+            items[i]= buffer[t];
+            t= next(t);
+        }
+        __DMB();
+        tail= t;
+        return n;
+    }
+
+    // producer side, where the next items can be written in place without a copy, returns how many in a row can be
+    // (up to the end of the buffer) and they are published with commit()
+    size_t write_span(T *&items)
+    {
+        size_t h= head;
+        size_t f= (tail - h - 1) & mask;
+        items= &buffer[h];
+        return f < capacity - h ? f : capacity - h;
+    }
+
+    // producer side, publishes n items written through write_span()
+    void commit(size_t n)
+    {
+        __DMB();
+        head= (head + n) & mask;
+    }
+
+    // producer side, takes back the last item pushed if it has not been consumed yet (eg for a backspace)
+    // only safe if the consumer can not run in the middle of it, ie the producer is an ISR or the consumer is stopped
+    bool unpush()
+    {
+        size_t h= head;
+        if(h == tail) return false;
+        head= (h - 1) & mask;
+        return true;
+    }
+
+    // consumer side, where the next items can be read in place without a copy, returns how many in a row can be
+    // (up to the end of the buffer) and they are handed back with consume()
+    size_t read_span(const T *&items) const
+    {
+        size_t t= tail;
+        size_t s= (head - t) & mask;
+        __DMB();
+        items= &buffer[t];
+        return s < capacity - t ? s : capacity - t;
+    }
+
+    // consumer side, hands back n items read through read_span()
+    void consume(size_t n)
+    {
+        __DMB();
+        tail= (tail + n) & mask;
+    }
+
+    // consumer side, looks at the item n places from the tail without removing it, n must be < size()
+    const T& peek(size_t n= 0) const
+    {
+        __DMB();
+        return buffer[(tail + n) & mask];
+    }
+
+    // consumer side, how many of the queued items are v, eg how many complete lines there are
+    size_t count(const T &v) const
+    {
+        size_t t= tail;
+        size_t h= head;
+        __DMB();
+        size_t c= 0;
+        for (; t != h; t= next(t)) {
+            if(buffer[t] == v) c++;
+        }
+        return c;
+    }
+
+    // consumer side, how far from the tail the first v is, or max_size() if there is none
+    size_t find(const T &v) const
+    {
+        size_t t= tail;
+        size_t h= head;
+        __DMB();
+        for (size_t n= 0; t != h; t= next(t), n++) {
+            if(buffer[t] == v) return n;
+        }
+        return max_size();
+    }
+
+    // consumer side, discards everything currently queued
+    void flush()
+    {
+        __DMB();
+        tail= head;
+    }
+
+private:
+    static const size_t mask= capacity - 1;
+    static size_t next(size_t n) { return (n + 1) & mask; }
+
+    T buffer[capacity];
+    volatile size_t head; // only written by the producer
+    volatile size_t tail; // only written by the consumer
+};
@@ -1,12 +1,12 @@
 #ifndef SERIALMESSAGE_H
 #define SERIALMESSAGE_H
 
-#include <string>
+#include "LineString.h"
 
 class StreamOutput;
 
 struct SerialMessage {
         StreamOutput* stream;
-        std::string message;
+        LineString message;
 };
 #endif
@@ -0,0 +1,80 @@
+#include "SlabPool.h"
+
+#include "platform_memory.h"
+#include "StreamOutput.h"
+
+SlabPool* SlabPool::first = NULL;
+
+SlabPool::SlabPool(const char *name, size_t size, uint16_t count)
+{
+    // each free block holds the pointer to the next free one
+    if (size < sizeof(void*)) size = sizeof(void*);
+    this->size = (size + 3) & ~3;
+    this->name = name;
+    this->count = count;
+    base = NULL;
+    free_list = NULL;
+    in_use = 0;
+    high_water = 0;
+    fallbacks = 0;
+
+    next = first;
+    first = this;
+}
+
+void* SlabPool::alloc(size_t nbytes)
+{
+    if (base == NULL && count > 0) {
+        // first use, _AHB0 is set up by then
+        size_t n = (size_t)size * count;
+        base = (_AHB0 != NULL) ? (uint8_t*)AHB0.alloc(n) : NULL;
+        if (base == NULL) base = (uint8_t*)malloc(n);
+        if (base == NULL) {
+            count = 0;
+        } else {
+            for (uint16_t i = 0; i < count; i++) {
+                void **b = (void**)(base + i * size);
+                *b = (i + 1 < count) ? base + (i + 1) * size : NULL;
+            }
+            free_list = base;
+        }
+    }
+
+    if (nbytes > size || free_list == NULL) {
+        fallbacks++;
+        return malloc(nbytes);
+    }
+
+    void *p = free_list;
+    free_list = *(void**)p;
+    if (++in_use > high_water) high_water = in_use;
+    return p;
+}
+
+void SlabPool::dealloc(void* p)
+{
+    if (p == NULL) return;
+    if (!has(p)) {
+        free(p);
+        return;
+    }
+
+    *(void**)p = free_list;
+    free_list = p;
+    in_use--;
+}
+
+bool SlabPool::has(void* p) const
+{
+    return base != NULL && (uint8_t*)p >= base && (uint8_t*)p < base + (size_t)size * count;
+}
+
+void SlabPool::debug(StreamOutput* str)
+{
+    str->printf("%s: %u x %ub, in use: %u, most used: %u, to malloc: %lu\n", name, count, size, in_use, high_water, fallbacks);
+}
+
+void SlabPool::debug_all(StreamOutput* str)
+{
+    for (SlabPool *s = first; s != NULL; s = s->next) s->debug(str);
+}
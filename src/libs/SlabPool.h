@@ -0,0 +1,43 @@
+#ifndef _SLABPOOL_H
+#define _SLABPOOL_H
+
+#include <cstdint>
+#include <cstdlib>
+
+class StreamOutput;
+
+/*
+ * A fixed number of fixed size blocks for the small objects that are made and deleted all the time, like Gcodes
+ * and the network streams. Alloc and dealloc just pop and push a free list so they are O(1), and as the blocks
+ * never go back to the heap the churn cannot fragment it. When they are all in use it falls back to malloc.
+ * The blocks are taken from AHB0 the first time one is needed, or from the heap if it has no room.
+ */
+class SlabPool
+{
+public:
+    SlabPool(const char *name, size_t size, uint16_t count);
+
+    void* alloc(size_t);
+    void  dealloc(void* p);
+
+    void  debug(StreamOutput*);
+
+    static void debug_all(StreamOutput*);
+
+private:
+    bool  has(void*) const;
+
+    SlabPool* next;
+    static SlabPool* first;
+
+    const char *name;
+    uint8_t *base;
+    void *free_list;
+    uint16_t size;
+    uint16_t count;
+    uint16_t in_use;
+    uint16_t high_water;
+    uint32_t fallbacks; // allocations that went to malloc because all the blocks were in use
+};
+
+#endif /* _SLABPOOL_H */
@@ -20,6 +20,10 @@ using namespace std;
 
 // This module uses a Timer to periodically call hooks
 // Modules register with a function ( callback ) and a frequency, and we then call that function at the given frequency.
+// The timer runs freely and its match is set for whichever hook is due next, so each interrupt only costs the hooks it calls.
+
+// the ISP button and the second flag are done five times a second, as the old base rate was
+#define HOUSEKEEPING_INTERVAL ((SystemCoreClock >> 2) / 5)
 
 SlowTicker* global_slow_ticker;
 
@@ -30,18 +34,28 @@ SlowTicker::SlowTicker(){
     ispbtn.from_string("2.10")->as_input()->pull_up();
 
     LPC_SC->PCONP |= (1 << 22);     // Power Ticker ON
-    LPC_TIM2->MCR = 3;              // Match on MR0, reset on MR0
+    LPC_TIM2->MCR = 1;              // Interrupt on MR0, the counter is not reset
     // do not enable interrupt until setup is complete
-    LPC_TIM2->TCR = 0;              // Disable interrupt
+    LPC_TIM2->TCR = 2;              // Reset
+    LPC_TIM2->TCR = 1;              // Count, SystemCoreClock/4 a second
 
-    max_frequency = 5;  // initial max frequency is set to 5Hz
-    set_frequency(max_frequency);
+    started = false;
+    flag_1s_count = 0;
     flag_1s_flag = 0;
 }
 
 void SlowTicker::start()
 {
-    LPC_TIM2->TCR = 1;              // Enable interrupt
+    // the hooks were attached while booting, start them all from now
+    __disable_irq();
+    uint32_t now = LPC_TIM2->TC;
+    for (Hook* hook : this->hooks) hook->due = now + hook->interval;
+    std::make_heap(this->hooks.begin(), this->hooks.end(), later);
+    housekeeping_due = now + HOUSEKEEPING_INTERVAL;
+    started = true;
+    schedule();
+    __enable_irq();
+
     NVIC_EnableIRQ(TIMER2_IRQn);    // Enable interrupt handler
 }
 
@@ -49,44 +63,48 @@ void SlowTicker::on_module_loaded(){
     register_for_event(ON_IDLE);
 }
 
-// Set the base frequency we use for all sub-frequencies
-void SlowTicker::set_frequency( int frequency ){
-    this->interval = (SystemCoreClock >> 2) / frequency;   // SystemCoreClock/4 = Timer increments in a second
-    LPC_TIM2->MR0 = this->interval;
-    LPC_TIM2->TCR = 3;  // Reset
-    LPC_TIM2->TCR = 1;  // Reset
-    flag_1s_count= SystemCoreClock>>2;
+// Set the match for the soonest of the next hook and the housekeeping, must be called with interrupts off
+void SlowTicker::schedule()
+{
+    uint32_t next = housekeeping_due;
+    if (!this->hooks.empty() && (int32_t)(this->hooks[0]->due - next) < 0) next = this->hooks[0]->due;
+    LPC_TIM2->MR0 = next;
 }
 
 // The actual interrupt being called by the timer, this is where work is done
 void SlowTicker::tick(){
-
-    // Call all hooks that need to be called
-    for (Hook* hook : this->hooks){
-        hook->countdown -= this->interval;
-        if (hook->countdown < 0)
-        {
-            hook->countdown += hook->interval;
+    uint32_t now = LPC_TIM2->TC;
+
+    do {
+        // Call the hooks that are due, each goes back in the heap at its next time
+        while (!this->hooks.empty() && (int32_t)(now - this->hooks[0]->due) >= 0) {
+            std::pop_heap(this->hooks.begin(), this->hooks.end(), later);
+            Hook* hook = this->hooks.back();
+            hook->due += hook->interval;
+            // if it has fallen a whole interval behind do not call it again to catch up
+            if ((int32_t)(now - hook->due) >= 0) hook->due = now + hook->interval;
+            std::push_heap(this->hooks.begin(), this->hooks.end(), later);
             hook->call();
         }
-    }
 
-    // deduct tick time from second counter
-    flag_1s_count -= this->interval;
-    // if a whole second has elapsed,
-    if (flag_1s_count < 0)
-    {
-        // add a second to our counter
-        flag_1s_count += SystemCoreClock >> 2;
-        // and set a flag for idle event to pick up
-        flag_1s_flag++;
-    }
-
-    // Enter MRI mode if the ISP button is pressed
-    // TODO: This should have it's own module
-    if (ispbtn.get() == 0)
-        __debugbreak();
+        if ((int32_t)(now - housekeeping_due) >= 0) {
+            housekeeping_due += HOUSEKEEPING_INTERVAL;
+            // if a whole second has elapsed set a flag for idle event to pick up
+            if (++flag_1s_count >= 5) {
+                flag_1s_count = 0;
+                flag_1s_flag++;
+            }
+
+            // Enter MRI mode if the ISP button is pressed
+            // TODO: This should have it's own module
+            if (ispbtn.get() == 0)
+                __debugbreak();
+        }
 
+        schedule();
+        // the match only fires when the counter equals it, so if the hooks took us up to or past it go round again
+        now = LPC_TIM2->TC;
+    } while ((int32_t)(LPC_TIM2->MR0 - now) <= 0);
 }
 
 bool SlowTicker::flag_1s(){
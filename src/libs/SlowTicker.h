@@ -14,6 +14,7 @@
 
 using namespace std;
 #include <vector>
+#include <algorithm>
 
 #include "libs/Hook.h"
 #include "libs/Pin.h"
@@ -28,7 +29,6 @@ class SlowTicker : public Module{
         void on_module_loaded(void);
         void on_idle(void*);
         void start();
-        void set_frequency( int frequency );
         void tick();
         // For some reason this can't go in the .cpp, see :  http://mbed.org/forum/mbed/topic/2774/?page=1#comment-14221
         // TODO replace this with std::function()
@@ -36,25 +36,28 @@ class SlowTicker : public Module{
             Hook* hook = new Hook();
             hook->interval = floorf((SystemCoreClock/4)/frequency);
             hook->attach(optr, fptr);
-            hook->countdown = hook->interval;
 
             // to avoid race conditions we must stop the interupts before updating this non thread safe vector
             __disable_irq();
-            if( frequency > this->max_frequency ){
-                this->max_frequency = frequency;
-                this->set_frequency(frequency);
-            }
+            hook->due = LPC_TIM2->TC + hook->interval;
             this->hooks.push_back(hook);
+            std::push_heap(this->hooks.begin(), this->hooks.end(), later);
+            if(this->started) this->schedule();
             __enable_irq();
             return hook;
         }
 
     private:
         bool flag_1s();
+        void schedule();
+        // the order of the heap, soonest due first, the timer wraps so compare the difference
+        static bool later(const Hook *a, const Hook *b) { return (int32_t)(a->due - b->due) > 0; }
 
+        // a heap on due, only the hooks that are due are looked at in the interrupt and the timer
+        // is set for the next one rather than ticking at the rate of the fastest hook
         vector<Hook*> hooks;
-        uint32_t max_frequency;
-        uint32_t interval;
+        uint32_t housekeeping_due;
+        bool started;
 
         Pin ispbtn;
 protected:
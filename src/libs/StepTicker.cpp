@@ -15,9 +15,11 @@
 #include "StreamOutputPool.h"
 #include "Block.h"
 #include "Conveyor.h"
+#include "Trace.h"
 
 #include "system_LPC17xx.h" // mbed.h lib
 #include <math.h>
+#include <algorithm>
 #include <mri.h>
 
 #ifdef STEPTICKER_DEBUG_PIN
@@ -29,6 +31,24 @@ GPIO stepticker_debug_pin(STEPTICKER_DEBUG_PIN);
 #define SET_STEPTICKER_DEBUG_PIN(n)
 #endif
 
+#ifdef STEPTICKER_PROFILE
+// cycle count profiling of the ISRs, only used if defined in src/makefile
+#include "CycleCounter.h"
+#define PROFILE_START(v) uint32_t v= cycle_counter_read()
+#define PROFILE_CYCLES(v) (cycle_counter_read() - (v))
+#else
+#define PROFILE_START(v)
+#define PROFILE_CYCLES(v) 0
+#endif
+
+#ifdef STEPTICKER_STEP_HOOK
+// every step is passed to the simulator of the host build, see src/testframework/host
+extern void stepticker_step_hook(uint8_t motor, bool dir);
+#define STEP_HOOK(m, dir) stepticker_step_hook(m, dir)
+#else
+#define STEP_HOOK(m, dir)
+#endif
+
 StepTicker *StepTicker::instance;
 
 StepTicker::StepTicker()
@@ -37,6 +57,7 @@ StepTicker::StepTicker()
 
     // Configure the timer
     LPC_TIM0->MR0 = 10000000;       // Initial dummy value for Match Register
+    LPC_TIM0->MR1 = k_unstep_parked; // only used in single timer mode
     LPC_TIM0->MCR = 3;              // Match on MR0, reset on MR0
     LPC_TIM0->TCR = 0;              // Disable interrupt
 
@@ -49,10 +70,16 @@ StepTicker::StepTicker()
     this->set_frequency(100000);
     this->set_unstep_time(100);
 
-    this->unstep.reset();
+    this->unstep_mask.fill(0);
+    this->advance_ticks.fill(0);
     this->num_motors = 0;
+    select_motor_loop();
 
     this->running = false;
+    this->variable_interval = false;
+    this->skipping = false;
+    this->single_timer = false;
+    this->finish_pending = false;
     this->current_block = nullptr;
 
     #ifdef STEPTICKER_DEBUG_PIN
@@ -60,6 +87,11 @@ StepTicker::StepTicker()
     stepticker_debug_pin.output();
     stepticker_debug_pin= 0;
     #endif
+
+    #ifdef STEPTICKER_PROFILE
+    cycle_counter_enable();
+    reset_profile();
+    #endif
 }
 
 StepTicker::~StepTicker()
@@ -70,7 +102,8 @@ StepTicker::~StepTicker()
 void StepTicker::start()
 {
     NVIC_EnableIRQ(TIMER0_IRQn);     // Enable interrupt handler
-    NVIC_EnableIRQ(TIMER1_IRQn);     // Enable interrupt handler
+    if(!single_timer) NVIC_EnableIRQ(TIMER1_IRQn); // Enable interrupt handler
+    NVIC_EnableIRQ(RIT_IRQn);        // only ever pended by step_tick() for the secondary tick, the RIT itself is not used
     current_tick= 0;
 }
 
@@ -79,7 +112,7 @@ void StepTicker::set_frequency( float frequency )
 {
     this->frequency = frequency;
     this->period = floorf((SystemCoreClock / 4.0F) / frequency); // SystemCoreClock/4 = Timer increments in a second
-    LPC_TIM0->MR0 = this->period;
+    LPC_TIM0->MR0 = this->period - 1; // it resets on the count after the match, so a tick is MR0+1 counts
     LPC_TIM0->TCR = 3;  // Reset
     LPC_TIM0->TCR = 1;  // start
 }
@@ -89,33 +122,104 @@ void StepTicker::set_unstep_time( float microseconds )
 {
     uint32_t delay = floorf((SystemCoreClock / 4.0F) * (microseconds / 1000000.0F)); // SystemCoreClock/4 = Timer increments in a second
     LPC_TIM1->MR0 = delay;
+    this->unstep_delay = delay;
 
     // TODO check that the unstep time is less than the step period, if not slow down step ticker
 }
 
-// Reset step pins on any motor that was stepped
+// Set the direction setup time, must be called after set_frequency
+void StepTicker::set_dir_setup_time( float microseconds )
+{
+    this->dir_setup_ticks = microseconds > 0 ? ceilf(frequency * (microseconds / 1000000.0F)) : 0;
+}
+
+// in single timer mode MR1 of TIMER0 is set to the end of the step pulse whenever there is a step, and parked where the
+// count never gets to otherwise. TIMER1 is not used at all, must be called before start()
+void StepTicker::set_single_timer(bool f)
+{
+    single_timer= f;
+    LPC_TIM0->MR1 = k_unstep_parked;
+    LPC_TIM0->MCR = f ? 3 | (1 << 3) : 3; // Match on MR0, reset on MR0, and interrupt on MR1 in single timer mode
+}
+
+// Reset step pins on any motor that was stepped, one write per port
 void StepTicker::unstep_tick()
 {
-    for (int i = 0; i < num_motors; i++) {
-        if(this->unstep[i]) {
-            this->motor[i]->unstep();
-        }
+    for (uint8_t p = 0; p < num_step_ports; p++) {
+        uint32_t mask= unstep_mask[p];
+        if(mask == 0) continue;
+        unstep_mask[p]= 0;
+
+        uint32_t inv= mask & step_port[p].inverted;
+        if(mask != inv) step_port[p].port->FIOCLR = mask & ~inv;
+        if(inv != 0) step_port[p].port->FIOSET = inv;
+    }
+}
+
+// MR1 of TIMER0 has come round in single timer mode, the pulse is over
+void StepTicker::end_step_pulse()
+{
+    LPC_TIM0->MR1 = k_unstep_parked;
+    unstep_tick();
+}
+
+// only called with interrupts off or from the step tick ISR in single timer mode, stepped_at is the count when the step pins were set.
+// A pulse that does not fit in what is left of this tick is ended at the start of the next one, before anything is stepped
+inline void StepTicker::schedule_unstep(uint32_t stepped_at)
+{
+    uint32_t at= stepped_at + unstep_delay;
+    if(at >= LPC_TIM0->MR0) {
+        LPC_TIM0->MR1 = k_unstep_parked;
+        return;
     }
-    this->unstep.reset();
+    LPC_TIM0->MR1 = at;
+    // it only matches on the count becoming equal, so if that has already gone by the pulse is long enough already
+    if(LPC_TIM0->TC >= at) end_step_pulse();
 }
 
 extern "C" void TIMER1_IRQHandler (void)
 {
+    PROFILE_START(t);
     LPC_TIM1->IR |= 1 << 0;
     StepTicker::getInstance()->unstep_tick();
+    #ifdef STEPTICKER_PROFILE
+    StepTicker::getInstance()->profile_unstep(PROFILE_CYCLES(t));
+    #endif
 }
 
 // The actual interrupt handler where we do all the work
 extern "C" void TIMER0_IRQHandler (void)
 {
-    // Reset interrupt register
-    LPC_TIM0->IR |= 1 << 0;
+    PROFILE_START(t);
+    // Reset interrupt register, each flag is cleared by writing a one to it so only clear the ones being handled
+    uint32_t ir= LPC_TIM0->IR & 3;
+    LPC_TIM0->IR = ir;
+    if(ir & 2) { // MR1 in single timer mode
+        StepTicker::getInstance()->end_step_pulse();
+        #ifdef STEPTICKER_PROFILE
+        StepTicker::getInstance()->profile_unstep(PROFILE_CYCLES(t));
+        #endif
+        if(!(ir & 1)) return;
+    }
+    #ifdef STEPTICKER_PROFILE
+    StepTicker *st= StepTicker::getInstance();
+    bool active= st->is_running();
+    st->step_tick();
+    // idle ticks are not interesting, only count ticks that were, or became, active
+    if(active || st->is_running()) st->profile_tick(PROFILE_CYCLES(t));
+    #else
     StepTicker::getInstance()->step_tick();
+    #endif
+    #ifdef EVENT_TRACE
+    // the match flag is set again if the next tick came round while this one was still running
+    if(LPC_TIM0->IR & 1) TRACE(Trace::TICK_OVERRUN);
+    #endif
+}
+
+// the secondary tick, a priority below TIMER0 so the step tick can interrupt it but it can not hold up the step tick
+extern "C" void RIT_IRQHandler (void)
+{
+    StepTicker::getInstance()->secondary_tick();
 }
 
 extern "C" void PendSV_Handler(void)
@@ -123,20 +227,212 @@ extern "C" void PendSV_Handler(void)
     StepTicker::getInstance()->handle_finish();
 }
 
-// slightly lower priority than TIMER0, the whole end of block/start of block is done here allowing the timer to continue ticking
+// a priority below TIMER0, pended by step_tick() when it went straight on to the staged block, the queue catches up with
+// it here rather than in the step tick. TIMER0 is kept out while it does so the step tick can not see the queue part way
+// through, the unstep timer is above it and still runs
 void StepTicker::handle_finish (void)
 {
+    uint32_t basepri= __get_BASEPRI();
+    __set_BASEPRI(NVIC_GetPriority(TIMER0_IRQn) << (8 - __NVIC_PRIO_BITS));
+    if(finish_pending) {
+        finish_pending= false;
+        THECONVEYOR->following_block_started();
+    }
+    __set_BASEPRI(basepri);
+
     // all moves finished signal block is finished
     if(finished_fnc) finished_fnc();
 }
 
+// the rate pressure advance adds for an acceleration of ac per tick, saturated at half a step per tick which is far more than
+// any sane setting will ask for, and keeps the sum with the rate in range
+static inline stepticker_fp_t advance_rate(stepticker_fp_t ac, uint32_t ticks)
+{
+#ifdef STEPTICKER_FP32
+    int64_t r= (int64_t)ac * ticks;
+    const int64_t lim= STEPTICKER_FPSCALE / 2;
+    if(r > lim) r= lim;
+    else if(r < -lim) r= -lim;
+    return r;
+#else
+    // drop some of the 62 fraction bits first so the product can't overflow
+    int64_t r= (ac >> 20) * (int64_t)ticks;
+    const int64_t lim= (STEPTICKER_FPSCALE / 2) >> 20;
+    if(r > lim) r= lim;
+    else if(r < -lim) r= -lim;
+    return r << 20;
+#endif
+}
+
+// issues the step for motor m if it is due this tick, and returns true if it is still moving and holds up the end of the block
+inline bool StepTicker::tick_motor(uint8_t m, bool scurve, uint8_t advanced, step_masks_t &step_mask)
+{
+    auto& ti= current_block->tick_info[m];
+    if(ti.steps_to_move == 0) return false; // finished
+
+    if(scurve) {
+        // the acceleration changes by the jerk each tick, and the rate by the acceleration
+        if(apply_jerk) ti.acceleration_change += ti.jerk;
+        ti.steps_per_tick += ti.acceleration_change;
+
+    } else {
+        ti.steps_per_tick += ti.acceleration_change;
+    }
+
+    if(current_tick == ti.next_accel_event) {
+        if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
+            ti.acceleration_change = 0;
+            if(current_block->decelerate_after < current_block->total_move_ticks) {
+                ti.next_accel_event = current_block->decelerate_after;
+                if(current_tick != current_block->decelerate_after) { // We are plateauing
+                    // steps/sec / tick frequency to get steps per tick
+                    ti.steps_per_tick = ti.plateau_rate;
+                }
+            }
+        }
+
+        if(current_tick == current_block->decelerate_after) { // We start decelerating
+            ti.acceleration_change = ti.deceleration_change;
+        }
+    }
+
+    // protect against rounding errors and such
+    if(ti.steps_per_tick <= 0) {
+        ti.counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
+        ti.steps_per_tick = 0;
+    }
+
+    if(m == advanced) {
+        // pressure advance adds k times the acceleration to the rate, so it runs ahead when speeding up and drops back when
+        // slowing down. It never reverses within a block, and never goes over a step per tick
+        stepticker_fp_t rate= ti.steps_per_tick + advance_rate(ti.acceleration_change, advance_ticks[m]);
+        if(rate < 0) rate= 0;
+        else if(rate >= STEPTICKER_FPSCALE) rate= STEPTICKER_FPSCALE - 1;
+        ti.counter += rate;
+
+    } else {
+        ti.counter += ti.steps_per_tick;
+    }
+
+    MotorState &ms= motor_state[m];
+    if(ti.counter >= STEPTICKER_FPSCALE || ms.step_owed) { // >= 1.0 step time
+        if(current_tick < ms.step_after) {
+            // its direction pin changed too recently for the driver, the step waits for the setup time. It is owed and the
+            // counter carries on, so the steps that fall due in the hold are made up after it, up to one more than that
+            if(ti.counter >= STEPTICKER_FPSCALE) {
+                if(ms.step_owed) {
+                    ti.counter= STEPTICKER_FPSCALE;
+                } else {
+                    ti.counter -= STEPTICKER_FPSCALE;
+                    ms.step_owed= true;
+                }
+            }
+            return m != advanced && ms.moving;
+        }
+        if(ti.counter >= STEPTICKER_FPSCALE) {
+            ti.counter -= STEPTICKER_FPSCALE; // -= 1.0F;
+        } else {
+            ms.step_owed= false;
+        }
+        ++ti.step_count;
+
+        // step the motor
+        ms.position_steps += ms.direction ? -1 : 1;
+        STEP_HOOK(m, ms.direction);
+        // the step pin is set after all the motors have been processed
+        step_mask[ms.step_port] |= ms.step_mask;
+
+        // the moving flag may have been cleared externally (probes, endstops etc)
+        if(!ms.moving || ti.step_count == ti.steps_to_move) {
+            // done
+            ti.steps_to_move = 0;
+            ms.moving= false; // let motor know it is no longer moving
+            ms.step_owed= false;
+        }
+    }
+
+    // an advanced motor does not hold up the end of the block
+    return m != advanced && ms.moving;
+}
+
+// motors 0 to N-1 that are on the active list, the recursion is all inlined so each motor is a straight run of code
+template<uint8_t N> inline bool StepTicker::step_motors(bool scurve, uint8_t advanced, step_masks_t &step_mask)
+{
+    bool moving= step_motors<N - 1>(scurve, advanced, step_mask);
+    if(active_mask & (1 << (N - 1))) {
+        if(tick_motor(N - 1, scurve, advanced, step_mask)) moving= true;
+    }
+    return moving;
+}
+
+template<> inline bool StepTicker::step_motors<0>(bool, uint8_t, step_masks_t&)
+{
+    return false;
+}
+
+// picks the smallest unrolled loop that covers the registered motors
+void StepTicker::select_motor_loop()
+{
+    switch(num_motors) {
+        case 0: case 1: case 2: case 3: step_motors_fnc= &StepTicker::step_motors<3>; break;
+#if MAX_ROBOT_ACTUATORS >= 4
+        case 4: step_motors_fnc= &StepTicker::step_motors<4>; break;
+#endif
+#if MAX_ROBOT_ACTUATORS >= 5
+        case 5: step_motors_fnc= &StepTicker::step_motors<5>; break;
+#endif
+#if MAX_ROBOT_ACTUATORS >= 6
+        case 6: step_motors_fnc= &StepTicker::step_motors<6>; break;
+#endif
+        default: step_motors_fnc= &StepTicker::step_motors<k_max_actuators>; break;
+    }
+}
+
 // step clock
 void StepTicker::step_tick (void)
 {
     //SET_STEPTICKER_DEBUG_PIN(running ? 1 : 0);
 
+    // the last tick skipped ahead, so go back to the normal tick period. The timer has just reset so TC is still well below it
+    if(skipping) {
+        LPC_TIM0->MR0 = period - 1;
+        skipping= false;
+    }
+
+    // a step pulse too long to end within the last tick ends here, so it is always over before the next step
+    if(single_timer) unstep_tick();
+
+    if(abort_pending) {
+        // a cancelled jog, it has been held to a stop first so dropping it here loses no steps
+        for (uint8_t m = 0; m < num_motors; m++) {
+            motor_state[m].moving= false;
+        }
+        running= false;
+        current_tick= 0;
+        current_block= nullptr;
+        next_block= nullptr;
+        dir_ahead_mask= 0;
+        num_active_motors= 0;
+        active_mask= 0;
+        num_secondary_motors= 0;
+        secondary_moving= 0;
+        for (auto& ms : motor_state) ms.advance_state= 0;
+        hold_active= false;
+        feed_hold= false;
+        hold_scale= 0xFFFFFFFFUL;
+        abort_pending= false;
+        return;
+    }
+
+    // the tick came round again before handle_finish() ran, the queue has to catch up before anything here looks at it
+    if(finish_pending) {
+        finish_pending= false;
+        THECONVEYOR->following_block_started();
+    }
+
     // if nothing has been setup we ignore the ticks
     if(!running){
+        if(estop) return;
         // check if anything new available
         if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
             running= start_next_block(); // returns true if there is at least one motor with steps to issue
@@ -146,63 +442,121 @@ void StepTicker::step_tick (void)
         }
     }
 
-    if(THEKERNEL->is_halted()) {
+    if(THEKERNEL->is_halted() || estop) {
         running= false;
+        sync_tpp= 0;
         current_tick = 0;
         current_block= nullptr;
+        next_block= nullptr;
+        dir_ahead_mask= 0;
+        num_active_motors= 0;
+        active_mask= 0;
+        num_secondary_motors= 0;
+        secondary_moving= 0;
+        for (auto& ms : motor_state) ms.advance_state= 0;
         return;
     }
 
-    bool still_moving= false;
-    // foreach motor, if it is active see if time to issue a step to that motor
-    for (uint8_t m = 0; m < num_motors; m++) {
-        if(current_block->tick_info[m].steps_to_move == 0) continue; // not active
-
-        current_block->tick_info[m].steps_per_tick += current_block->tick_info[m].acceleration_change;
-
-        if(current_tick == current_block->tick_info[m].next_accel_event) {
-            if(current_tick == current_block->accelerate_until) { // We are done accelerating, deceleration becomes 0 : plateau
-                current_block->tick_info[m].acceleration_change = 0;
-                if(current_block->decelerate_after < current_block->total_move_ticks) {
-                    current_block->tick_info[m].next_accel_event = current_block->decelerate_after;
-                    if(current_tick != current_block->decelerate_after) { // We are plateauing
-                        // steps/sec / tick frequency to get steps per tick
-                        current_block->tick_info[m].steps_per_tick = current_block->tick_info[m].plateau_rate;
-                    }
+    // real time speed override, only override_rate of the ticks are run so time passes more slowly for the step generator.
+    // The whole motion is stretched out, rates scale by the override and accelerations by its square, so it is always within the plan
+    uint32_t tpp= sync_tpp;
+    if((override_active || hold_active) && tpp == 0) {
+        uint32_t rate= override_active ? override_rate : 0xFFFFFFFFUL;
+        if(hold_active) {
+            // feed hold slows time down to a stop in the middle of the block, the block state just stays where it is
+            // until the hold is released and time is ramped back up again
+            if(feed_hold) {
+                if(hold_scale > hold_step) {
+                    hold_scale -= hold_step;
+                } else if(hold_scale != 0) {
+                    hold_scale= 0;
+                    // there are no more ticks to tell it the rate, so it is told now that it has stopped
+                    if(rate_fnc) rate_fnc(current_block, 0);
                 }
+            } else if(hold_scale < 0xFFFFFFFFUL - hold_step) {
+                hold_scale += hold_step;
+            } else {
+                hold_scale= 0xFFFFFFFFUL;
+                hold_active= false;
             }
+            rate= ((uint64_t)rate * hold_scale) >> 32;
+        }
 
-            if(current_tick == current_block->decelerate_after) { // We start decelerating
-                current_block->tick_info[m].acceleration_change = current_block->tick_info[m].deceleration_change;
-            }
+        uint32_t a= override_accum + rate;
+        bool carry= a < override_accum; // overflowed past 1.0 so run this tick
+        override_accum= a;
+        if(!carry) return;
+    }
+
+    // spindle sync, the tick is only run if the spindle is far enough ahead, a pulse puts it exactly a pulse further on and
+    // in between it is taken to be turning at the rate of the last pulse, up to where the next is due
+    if(tpp != 0) {
+        uint32_t e= sync_edges;
+        if(e != sync_seen) {
+            sync_ahead += (e - sync_seen) * tpp;
+            sync_seen= e;
+            sync_frac= 0;
+        } else if(sync_frac < tpp) {
+            sync_frac= std::min(sync_frac + sync_step, tpp);
         }
+        if(sync_ahead + (int32_t)sync_frac < 256) return;
+        sync_ahead -= 256;
+    }
+
+    // the motors that reverse in the staged block and are done in this one
+    if(dir_ahead_mask != 0) change_directions_ahead();
 
-        // protect against rounding errors and such
-        if(current_block->tick_info[m].steps_per_tick <= 0) {
-            current_block->tick_info[m].counter = STEPTICKER_FPSCALE; // we force completion this step by setting to 1.0
-            current_block->tick_info[m].steps_per_tick = 0;
+    bool scurve= current_block->is_scurve;
+    if(scurve) {
+        // move on to the next phase of the s-curve, zero length phases are passed straight through
+        while(scurve_phase < 6 && current_tick == current_block->scurve_phase_end[scurve_phase]) {
+            next_scurve_phase();
         }
+    }
 
-        current_block->tick_info[m].counter += current_block->tick_info[m].steps_per_tick;
+    // the secondary motors get this tick every secondary_divider ticks, it runs as soon as this interrupt returns
+    if(current_tick >= next_secondary_tick && secondary_due()) {
+        if(secondary_busy) TRACE(Trace::TICK_OVERRUN); // it did not get to run since the last time
+        secondary_block= current_block;
+        secondary_at= current_tick;
+        next_secondary_tick= current_tick + secondary_divider;
+        secondary_busy= true;
+        NVIC_SetPendingIRQ(RIT_IRQn);
+    }
 
-        if(current_block->tick_info[m].counter >= STEPTICKER_FPSCALE) { // >= 1.0 step time
-            current_block->tick_info[m].counter -= STEPTICKER_FPSCALE; // -= 1.0F;
-            ++current_block->tick_info[m].step_count;
+    bool still_moving= secondary_moving > 0;
+    uint8_t advanced= current_block->advance_motor;
+    step_masks_t step_mask{}; // step pins to set on each port this tick
+    // each motor that has steps in this block sees if it is time to issue a step, and if any are still moving after this tick
+    if((this->*step_motors_fnc)(scurve, advanced, step_mask)) still_moving= true;
 
-            // step the motor
-            bool ismoving= motor[m]->step(); // returns false if the moving flag was set to false externally (probes, endstops etc)
-            // we stepped so schedule an unstep
-            unstep.set(m);
+    // set the step pins for all the motors that stepped, one write per port so the edges happen together
+    bool stepped= false;
+    uint32_t stepped_at= LPC_TIM0->TC;
+    for (uint8_t p = 0; p < num_step_ports; p++) {
+        uint32_t mask= step_mask[p];
+        if(mask == 0) continue;
 
-            if(!ismoving || current_block->tick_info[m].step_count == current_block->tick_info[m].steps_to_move) {
-                // done
-                current_block->tick_info[m].steps_to_move = 0;
-                motor[m]->stop_moving(); // let motor know it is no longer moving
-            }
-        }
+        uint32_t inv= mask & step_port[p].inverted;
+        if(mask != inv) step_port[p].port->FIOSET = mask & ~inv;
+        if(inv != 0) step_port[p].port->FIOCLR = inv;
+        // we stepped so schedule an unstep
+        unstep_mask[p] |= mask;
+        stepped= true;
+    }
 
-        // see if any motors are still moving after this tick
-        if(motor[m]->is_moving()) still_moving= true;
+    if(rate_fnc && ++rate_count >= rate_divider) {
+        rate_count= 0;
+        // the rate as 2.30 whichever fixed point is in use, scaled to the nominal rate by the planner
+#ifdef STEPTICKER_FP32
+        uint32_t r= current_block->tick_info[current_block->primary_motor].steps_per_tick;
+#else
+        uint32_t r= current_block->tick_info[current_block->primary_motor].steps_per_tick >> 32;
+#endif
+        r= ((uint64_t)r * current_block->rate_scale) >> 32;
+        // the override and a feed hold stretch time, so the actual rate is that much lower than the planned one
+        if((override_active || hold_active) && tpp == 0) r= ((uint64_t)r * get_time_rate()) >> 32;
+        rate_fnc(current_block, r);
     }
 
     // do this after so we start at tick 0
@@ -212,36 +566,173 @@ void StepTicker::step_tick (void)
     // Note there could be a race here if we run another tick before the unsteps have happened,
     // right now it takes about 3-4us but if the unstep were near 10uS or greater it would be an issue
     // also it takes at least 2us to get here so even when set to 1us pulse width it will still be about 3us
-    if( unstep.any()) {
+    if(stepped && !single_timer) {
         LPC_TIM1->TCR = 3;
         LPC_TIM1->TCR = 1;
     }
 
+    // get the next block ready while we still have time, so there is less to do when this one finishes
+    if(still_moving && next_block == nullptr && current_tick >= stage_tick) {
+        stage_next_block();
+    }
+
+    if(variable_interval && still_moving && !override_active && !hold_active && tpp == 0) {
+        skip_idle_ticks(scurve);
+    }
+
+    // in single timer mode the end of the pulse is set once MR0 is known for this tick, a skip gives it longer to fit
+    if(stepped && single_timer) schedule_unstep(stepped_at);
 
     // see if any motors are still moving
     if(!still_moving) {
         //SET_STEPTICKER_DEBUG_PIN(0);
 
         // all moves finished
+        uint32_t ended_at= current_tick;
         current_tick = 0;
 
-        // get next block
-        // do it here so there is no delay in ticks
-        THECONVEYOR->block_finished();
+        if(advanced < num_motors) {
+            // whatever the advanced motor did not get to, or did beyond its planned steps, is carried into the next block
+            motor_state[advanced].advance_state += (int32_t)current_block->tick_info[advanced].step_count - (int32_t)current_block->steps[advanced];
+            motor_state[advanced].moving= false;
+        }
 
-        if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
-            running= start_next_block(); // returns true if there is at least one motor with steps to issue
+        if(next_block != nullptr && num_next_active_motors > 0 && !THECONVEYOR->is_flushing()) {
+            // go straight on to the block that was prepared while this one ran, the queue is told in handle_finish()
+            current_block= next_block;
+            running= start_staged_block(ended_at);
+            finish_pending= true;
+            SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+            TRACE(Trace::BLOCK_END, true);
 
-        }else{
-            current_block= nullptr;
-            running= false;
+        } else {
+            // get next block
+            // do it here so there is no delay in ticks
+            THECONVEYOR->block_finished();
+            TRACE(Trace::BLOCK_END, !THECONVEYOR->is_queue_empty());
+
+            if(THECONVEYOR->get_next_block(&current_block)) { // returns false if no new block is available
+                running= start_next_block(); // returns true if there is at least one motor with steps to issue
+            }else{
+                current_block= nullptr;
+                running= false;
+            }
         }
+        next_block= nullptr;
+        dir_ahead_mask= 0;
+    }
+}
 
-        // all moves finished
-        // we delegate the slow stuff to the pendsv handler which will run as soon as this interrupt exits
-        //NVIC_SetPendingIRQ(PendSV_IRQn); this doesn't work
-        //SCB->ICSR = 0x10000000; // SCB_ICSR_PENDSVSET_Msk;
+// steps the secondary motors of the current block, pended by step_tick() every secondary_divider ticks.
+// It is the same as the loop in step_tick() except the rates are per secondary tick, and as it does not see every tick
+// the accelerate and decelerate events are taken on the first secondary tick at or after them
+void StepTicker::secondary_tick()
+{
+    Block *b= current_block;
+    uint32_t tick= secondary_at;
+    if(b == nullptr || b != secondary_block) { // the block it was asked for has ended, only the advanced motor was left
+        secondary_busy= false;
+        return;
     }
+
+    uint8_t advanced= b->advance_motor;
+    std::array<uint32_t, k_max_step_ports> step_mask{};
+    bool stepped= false;
+    for (uint8_t i = 0; i < num_secondary_motors; i++) {
+        uint8_t m= secondary_motor[i];
+        Block::tickinfo_t &ti= b->tick_info[m];
+        if(ti.steps_to_move == 0) continue; // finished
+
+        ti.steps_per_tick += ti.acceleration_change;
+        if(tick >= ti.next_accel_event) {
+            if(ti.next_accel_event == b->accelerate_until) { // done accelerating
+                ti.acceleration_change= 0;
+                ti.next_accel_event= b->decelerate_after < b->total_move_ticks ? b->decelerate_after : b->total_move_ticks + 1;
+                if(tick < b->decelerate_after) ti.steps_per_tick= ti.plateau_rate;
+            }
+            if(tick >= b->decelerate_after && ti.next_accel_event == b->decelerate_after) { // start decelerating
+                ti.acceleration_change= ti.deceleration_change;
+                ti.next_accel_event= b->total_move_ticks + 1;
+            }
+        }
+
+        if(ti.steps_per_tick <= 0) {
+            ti.counter= STEPTICKER_FPSCALE;
+            ti.steps_per_tick= 0;
+        }
+
+        if(m == advanced) {
+            stepticker_fp_t rate= ti.steps_per_tick + advance_rate(ti.acceleration_change, advance_ticks[m] / secondary_divider);
+            if(rate < 0) rate= 0;
+            else if(rate >= STEPTICKER_FPSCALE) rate= STEPTICKER_FPSCALE - 1;
+            ti.counter += rate;
+        } else {
+            ti.counter += ti.steps_per_tick;
+        }
+
+        MotorState &ms= motor_state[m];
+        if(ti.counter >= STEPTICKER_FPSCALE || ms.step_owed) {
+            if(tick < ms.step_after) { // waiting for the direction setup time, the step is owed as in tick_motor()
+                if(ti.counter >= STEPTICKER_FPSCALE) {
+                    if(ms.step_owed) {
+                        ti.counter= STEPTICKER_FPSCALE;
+                    } else {
+                        ti.counter -= STEPTICKER_FPSCALE;
+                        ms.step_owed= true;
+                    }
+                }
+                continue;
+            }
+            if(ti.counter >= STEPTICKER_FPSCALE) {
+                ti.counter -= STEPTICKER_FPSCALE;
+            } else {
+                ms.step_owed= false;
+            }
+            ++ti.step_count;
+
+            ms.position_steps += ms.direction ? -1 : 1;
+            STEP_HOOK(m, ms.direction);
+            step_mask[ms.step_port] |= ms.step_mask;
+            stepped= true;
+
+            if(!ms.moving || ti.step_count == ti.steps_to_move) {
+                ti.steps_to_move= 0;
+                ms.moving= false;
+                ms.step_owed= false;
+                if(m != advanced) --secondary_moving;
+            }
+        }
+    }
+
+    if(stepped) {
+        // the step tick and the unstep can both come in between, so the pins and the unstep are done together
+        __disable_irq();
+        for (uint8_t p = 0; p < num_step_ports; p++) {
+            uint32_t mask= step_mask[p];
+            if(mask == 0) continue;
+            uint32_t inv= mask & step_port[p].inverted;
+            if(mask != inv) step_port[p].port->FIOSET = mask & ~inv;
+            if(inv != 0) step_port[p].port->FIOCLR = inv;
+            unstep_mask[p] |= mask;
+        }
+        if(single_timer) {
+            schedule_unstep(LPC_TIM0->TC);
+        } else {
+            LPC_TIM1->TCR = 3;
+            LPC_TIM1->TCR = 1;
+        }
+        __enable_irq();
+    }
+
+    secondary_busy= false;
+}
+
+// records the start of current_block in the trace, with how many blocks are queued behind it
+inline void StepTicker::trace_block_start()
+{
+#ifdef EVENT_TRACE
+    TRACE(Trace::BLOCK_START, std::min<uint32_t>(THECONVEYOR->queue_count(), 255), std::min<uint32_t>(current_block->steps_event_count, 65535));
+#endif
 }
 
 // only called from the step tick ISR (single consumer)
@@ -249,23 +740,45 @@ bool StepTicker::start_next_block()
 {
     if(current_block == nullptr) return false;
 
+    PROFILE_START(t);
+
+    start_advance();
+
     bool ok= false;
+    num_active_motors= 0;
+    num_secondary_motors= 0;
     // need to prepare each active motor
     for (uint8_t m = 0; m < num_motors; m++) {
         if(current_block->tick_info[m].steps_to_move == 0) continue;
 
         ok= true; // mark at least one motor is moving
-        // set direction bit here
-        // NOTE this would be at least 10us before first step pulse.
-        // TODO does this need to be done sooner, if so how without delaying next tick
-        motor[m]->set_direction(current_block->direction_bits[m]);
-        motor[m]->start_moving(); // also let motor know it is moving now
+        add_active_motor(current_block, m, active_motor, num_active_motors, secondary_motor, num_secondary_motors);
+        // set direction bit here, the first step is at least a tick later. With a setup time it waits for that if the
+        // direction changed now or was changed for a staged block that was not started
+        bool dir= current_block->direction_bits[m];
+        motor_state[m].step_after= (motor_state[m].direction != dir || (dir_set_mask & (1 << m))) ? dir_setup_ticks : 0;
+        motor_state[m].step_owed= false;
+        motor_state[m].set_direction(dir);
+        if(current_block->backlash_motors & (1 << m)) motor[m]->discount_backlash();
+        motor_state[m].moving= true; // also let motor know it is moving now
     }
+    set_active_mask();
+    dir_ahead_mask= 0;
+    dir_set_mask= 0;
 
     current_tick= 0;
+    stage_tick= current_block->total_move_ticks > k_stage_ticks ? current_block->total_move_ticks - k_stage_ticks : 0;
+    scurve_phase= 0;
+    apply_jerk= true;
+    start_secondary();
+
+    #ifdef STEPTICKER_PROFILE
+    block_stats.record(PROFILE_CYCLES(t), get_period_cycles());
+    #endif
 
     if(ok) {
         //SET_STEPTICKER_DEBUG_PIN(1);
+        trace_block_start();
         return true;
 
     }else{
@@ -277,10 +790,367 @@ bool StepTicker::start_next_block()
     return false;
 }
 
+// only called from the step tick ISR, claims the next block and works out which motors it moves
+void StepTicker::stage_next_block()
+{
+    if(!THECONVEYOR->get_following_block(&next_block)) return; // nothing available yet, try again next tick
+
+    num_next_active_motors= 0;
+    num_next_secondary_motors= 0;
+    uint8_t reversing= 0;
+    for (uint8_t m = 0; m < num_motors; m++) {
+        if(next_block->tick_info[m].steps_to_move != 0) {
+            add_active_motor(next_block, m, next_active_motor, num_next_active_motors, next_secondary_motor, num_next_secondary_motors);
+            if(motor_state[m].direction != next_block->direction_bits[m]) reversing |= 1 << m;
+        }
+    }
+    if(dir_setup_ticks > 0) dir_ahead_mask= reversing;
+}
+
+// only called from the step tick ISR at the start of a tick while the staged block has motors that reverse. Those that
+// have finished in the current block get their new direction now, so the setup time runs while the current block ends.
+// The step pulses of the last tick are over by now, the secondary tick may be about to step one so it has to be done first
+void StepTicker::change_directions_ahead()
+{
+    if(secondary_busy) return;
+    for (uint8_t m = 0; m < num_motors; m++) {
+        uint8_t bit= 1 << m;
+        MotorState &ms= motor_state[m];
+        if(!(dir_ahead_mask & bit) || ms.moving) continue;
+        ms.set_direction(next_block->direction_bits[m]);
+        ms.step_after= current_tick + dir_setup_ticks;
+        dir_ahead_mask &= ~bit;
+        dir_set_mask |= bit;
+    }
+}
+
+// puts m on the list of the motors step_tick() steps, or on the secondary list if the block has it on the secondary tick
+inline void StepTicker::add_active_motor(const Block *block, uint8_t m, std::array<uint8_t, k_max_actuators> &active, uint8_t &n_active,
+    std::array<uint8_t, k_max_actuators> &secondary, uint8_t &n_secondary)
+{
+    if(block->secondary && is_secondary_motor(m)) secondary[n_secondary++]= m;
+    else active[n_active++]= m; // so step_tick only needs to look at the motors that move in this block
+}
+
+// the motors on the active list as the bits step_motors() checks
+inline void StepTicker::set_active_mask()
+{
+    uint8_t mask= 0;
+    for (uint8_t i = 0; i < num_active_motors; i++) {
+        mask |= 1 << active_motor[i];
+    }
+    active_mask= mask;
+}
+
+// only called from the step tick ISR, true while the secondary tick has a motor to step
+inline bool StepTicker::secondary_due() const
+{
+    if(secondary_moving > 0) return true;
+    uint8_t advanced= current_block->advance_motor;
+    return num_secondary_motors > 0 && advanced < num_motors && current_block->secondary && is_secondary_motor(advanced) && motor_state[advanced].moving;
+}
+
+// the secondary tick starts on the first tick of the block, the advanced motor does not hold up the end of the block
+void StepTicker::start_secondary()
+{
+    uint8_t n= 0;
+    for (uint8_t i = 0; i < num_secondary_motors; i++) {
+        if(secondary_motor[i] != current_block->advance_motor) ++n;
+    }
+    secondary_moving= n;
+    next_secondary_tick= 0;
+}
+
+// only called from the step tick ISR, starts the block that was prepared by stage_next_block(), the one before ran until
+// tick ended_at
+bool StepTicker::start_staged_block(uint32_t ended_at)
+{
+    PROFILE_START(t);
+
+    start_advance();
+
+    active_motor= next_active_motor;
+    num_active_motors= num_next_active_motors;
+    secondary_motor= next_secondary_motor;
+    num_secondary_motors= num_next_secondary_motors;
+    set_active_mask();
+    for (uint8_t i = 0; i < num_active_motors + num_secondary_motors; i++) {
+        uint8_t m= i < num_active_motors ? active_motor[i] : secondary_motor[i - num_active_motors];
+        if(current_block->tick_info[m].steps_to_move == 0) continue; // the advanced motor may have nothing to do after all
+        // only change the direction pins that need changing, one changed ahead has had some of its setup time already
+        MotorState &ms= motor_state[m];
+        bool dir= current_block->direction_bits[m];
+        if(ms.direction != dir) {
+            ms.set_direction(dir);
+            ms.step_after= dir_setup_ticks;
+        } else if(dir_set_mask & (1 << m)) {
+            ms.step_after= ms.step_after > ended_at ? ms.step_after - ended_at : 0;
+        } else {
+            ms.step_after= 0;
+        }
+        ms.step_owed= false;
+        if(current_block->backlash_motors & (1 << m)) motor[m]->discount_backlash();
+        motor_state[m].moving= true; // also let motor know it is moving now
+    }
+    dir_set_mask= 0;
+
+    current_tick= 0;
+    stage_tick= current_block->total_move_ticks > k_stage_ticks ? current_block->total_move_ticks - k_stage_ticks : 0;
+    scurve_phase= 0;
+    apply_jerk= true;
+    start_secondary();
+    trace_block_start();
+
+    #ifdef STEPTICKER_PROFILE
+    block_stats.record(PROFILE_CYCLES(t), get_period_cycles());
+    #endif
+
+    return true;
+}
+
+// only called from the step tick ISR at the start of a block, the advanced motor moves its planned steps plus however many it
+// takes to get from where it is now to the pressure advance wanted at the end of the block
+void StepTicker::start_advance()
+{
+    uint8_t m= current_block->advance_motor;
+    if(m >= num_motors) return;
+
+    int32_t n= (int32_t)current_block->steps[m] + current_block->advance_steps - motor_state[m].advance_state;
+    current_block->tick_info[m].steps_to_move= n > 0 ? n : 0;
+}
+
+// sets the real time speed override, takes effect on the next tick. Only slowing down can be done here as speeding up would
+// exceed the planned accelerations, 1.0 or more turns it off
+void StepTicker::set_speed_override(float f)
+{
+    if(f >= 1.0F) {
+        override_active= false;
+        return;
+    }
+    if(f < 0.01F) f= 0.01F;
+    override_rate= f * 4294967296.0F; // 0.32 fixed point
+    override_active= true;
+}
+
+void StepTicker::set_spindle_sync(float ticks_per_pulse)
+{
+    sync_tpp= 0;
+    if(ticks_per_pulse <= 0) return;
+
+    sync_ticks_per_us= frequency * 0.065536F;
+    sync_step= 0;
+    sync_seen= sync_edges;
+    sync_ahead= 0;
+    sync_frac= 0;
+    // the ISR starts using it from here
+    sync_tpp= ticks_per_pulse * 256;
+}
+
+void StepTicker::spindle_edge(uint32_t period_us)
+{
+    StepTicker *st= instance;
+    uint32_t tpp= st->sync_tpp;
+    if(tpp == 0) return;
+
+    uint32_t ticks= ((uint64_t)period_us * st->sync_ticks_per_us) >> 16;
+    st->sync_step= ticks > 0 ? tpp / ticks : tpp;
+    st->sync_edges++;
+}
+
+// starts or releases a feed hold, can be called from any context.
+// The stop is done by ramping time down rather than replanning so it happens within the block that is running, the ramp
+// is as long as the current block would take to decelerate from its nominal speed, which adds at most about that same
+// deceleration on top of whatever the block is doing. The resume ramps back up at the same rate.
+void StepTicker::set_feed_hold(bool f)
+{
+    if(f && !hold_active) {
+        const Block *b= current_block;
+        float t= 0.1F; // nothing running, so any moves that start during the hold just stay stopped
+        if(b != nullptr && b->acceleration > 0.0F) t= b->nominal_speed / b->acceleration;
+        uint32_t ticks= t * frequency;
+        if(ticks < 1) ticks= 1;
+        hold_step= 0xFFFFFFFFUL / ticks;
+        hold_scale= 0xFFFFFFFFUL;
+        feed_hold= true;
+        hold_active= true;
+    } else {
+        feed_hold= f;
+    }
+}
+
+// only called from the step tick ISR in variable interval mode.
+// When no motor is accelerating the rates are constant, so we can work out exactly how many ticks until the next step and
+// advance the counters over those ticks in one go, then set the timer to fire when that step is due instead of every tick.
+// This makes the interrupt load follow the step rate instead of the tick rate during slow moves.
+void StepTicker::skip_idle_ticks(bool scurve)
+{
+    if(scurve && apply_jerk) return; // acceleration is changing
+
+    uint32_t skip= k_max_skip_ticks;
+
+    // do not skip past anything that needs to happen on a particular tick
+    if(scurve && scurve_phase < 6 && current_block->scurve_phase_end[scurve_phase] > current_tick) {
+        skip= std::min(skip, current_block->scurve_phase_end[scurve_phase] - current_tick);
+    }
+    if(next_block == nullptr && stage_tick > current_tick) {
+        skip= std::min(skip, stage_tick - current_tick);
+    }
+    if(secondary_due()) {
+        if(next_secondary_tick <= current_tick) return;
+        skip= std::min(skip, next_secondary_tick - current_tick);
+    }
+
+    for (uint8_t i = 0; i < num_active_motors; i++) {
+        uint8_t m= active_motor[i];
+        const Block::tickinfo_t &ti= current_block->tick_info[m];
+        if(ti.steps_to_move == 0) continue;
+        if(ti.acceleration_change != 0 || ti.steps_per_tick <= 0) return;
+        if(ti.steps_per_tick >= STEPTICKER_FPSCALE / 2) return; // there can't be more than one idle tick between steps
+        if(motor_state[m].step_owed) return; // it steps as soon as its direction setup time is over
+
+        if(ti.next_accel_event > current_tick) {
+            skip= std::min(skip, ti.next_accel_event - current_tick);
+        }
+
+        // the next step happens after ceil((1.0 - counter) / steps_per_tick) ticks, the ones before it do nothing
+        stepticker_fp_t n= (STEPTICKER_FPSCALE - ti.counter + ti.steps_per_tick - 1) / ti.steps_per_tick;
+        if(n < 2) return;
+        if(n - 1 < skip) skip= n - 1;
+    }
+
+    if(skip < 2) return; // not worth it
+
+    for (uint8_t i = 0; i < num_active_motors; i++) {
+        uint8_t m= active_motor[i];
+        if(current_block->tick_info[m].steps_to_move == 0) continue;
+        current_block->tick_info[m].counter += current_block->tick_info[m].steps_per_tick * skip;
+    }
+    current_tick += skip;
+
+    // the timer reset on the match that got us here, so the next interrupt will be skip+1 periods from then
+    LPC_TIM0->MR0 = period * (skip + 1) - 1;
+    skipping= true;
+}
+
+// only called from the step tick ISR, moves an s-curve block on to its next phase
+// the phases are jerk+, constant acceleration, jerk-, plateau, jerk-, constant deceleration, jerk+
+void StepTicker::next_scurve_phase()
+{
+    ++scurve_phase;
+    switch(scurve_phase) {
+        case 1: // constant acceleration
+        case 5: // constant deceleration
+            apply_jerk= false;
+            break;
+
+        case 2: // acceleration ramps back down to zero
+        case 6: // deceleration ramps back down to zero
+            apply_jerk= true;
+            for (uint8_t i = 0; i < num_active_motors; i++) {
+                uint8_t m= active_motor[i];
+                current_block->tick_info[m].jerk = -current_block->tick_info[m].jerk;
+            }
+            break;
+
+        case 3: // plateau, take out any rounding errors in the rate
+            apply_jerk= false;
+            for (uint8_t i = 0; i < num_active_motors; i++) {
+                uint8_t m= active_motor[i];
+                current_block->tick_info[m].acceleration_change = 0;
+                current_block->tick_info[m].steps_per_tick = current_block->tick_info[m].plateau_rate;
+                current_block->tick_info[m].jerk = -current_block->tick_info[m].decel_jerk;
+            }
+            break;
+
+        case 4: // deceleration ramps up
+            apply_jerk= true;
+            break;
+    }
+}
+
+
+#ifdef STEPTICKER_PROFILE
+void StepTicker::cycle_stats_t::reset()
+{
+    min= UINT32_MAX;
+    max= 0;
+    count= 0;
+    overruns= 0;
+    total= 0;
+    histogram.fill(0);
+}
+
+// called from ISR, budget is the number of cycles in one tick period
+void StepTicker::cycle_stats_t::record(uint32_t cycles, uint32_t budget)
+{
+    if(cycles < min) min= cycles;
+    if(cycles > max) max= cycles;
+    total += cycles;
+    ++count;
+    if(cycles > budget) ++overruns;
+
+    // bucket in 1/8ths of the period, so bucket 8 and above are overruns
+    uint32_t b= (budget > 0) ? (cycles * 8) / budget : 0;
+    if(b >= histogram.size()) b= histogram.size() - 1;
+    ++histogram[b];
+}
+
+void StepTicker::reset_profile()
+{
+    __disable_irq();
+    tick_stats.reset();
+    block_stats.reset();
+    unstep_stats.reset();
+    __enable_irq();
+}
+#endif
 
 // returns index of the stepper motor in the array and bitset
 int StepTicker::register_motor(StepperMotor* m)
 {
-    motor[num_motors++] = m;
+    motor[num_motors] = m;
+
+    MotorState &ms= motor_state[num_motors];
+    ms.position_steps= 0;
+    ms.moving= false;
+    ms.step_after= 0;
+    ms.step_owed= false;
+    ms.advance_state= 0;
+    ms.dir_pin= FastPin(m->get_dir_pin());
+    ms.set_direction(false);
+
+    // find or add the GPIO port the step pin is on so it can be set along with any other step pins on that port
+    const Pin& pin= m->get_step_pin();
+    ms.step_port= 0;
+    ms.step_mask= 0;
+    if(pin.connected()) {
+        uint8_t p;
+        for (p = 0; p < num_step_ports; p++) {
+            if(step_port[p].port == pin.port) break;
+        }
+        if(p == num_step_ports) {
+            step_port[p].port= pin.port;
+            step_port[p].inverted= 0;
+            unstep_mask[p]= 0;
+            num_step_ports++;
+        }
+        if(pin.is_inverting()) step_port[p].inverted |= (1 << pin.pin);
+        ms.step_port= p;
+        ms.step_mask= 1 << pin.pin;
+    }
+    m->set_state(&ms);
+
+    num_motors++;
+    select_motor_loop();
     return num_motors - 1;
 }
+
+// the step tick drops everything as it does for a halt while this is set, the enables are just pin writes so they are
+// safe to do from here whatever interrupt this is called from
+void StepTicker::emergency_stop()
+{
+    estop= true;
+    for (uint8_t m = 0; m < num_motors; m++) {
+        motor[m]->enable(false);
+    }
+}
@@ -14,52 +14,266 @@
 #include <bitset>
 #include <functional>
 #include <atomic>
+#include <algorithm>
 
 #include "ActuatorCoordinates.h"
-#include "TSRingBuffer.h"
+#include "libs/LPC17xx/sLPC17xx.h" // smoothed mbed.h lib
+#include "Pin.h"
 
 class StepperMotor;
 class Block;
 
+#ifdef STEPTICKER_FP32
+// handle 2.30 Fixed point, all the per tick maths is done in 32 bits which is a lot cheaper on the M3.
+// one lsb of rate is f/2^30 steps/sec and one lsb of acceleration is f²/2^30 steps/sec², at the default 100KHz
+// that is ~0.0001 steps/sec and ~9.3 steps/sec², so the acceleration of an axis is within 1% as long as it is
+// over ~470 steps/sec² (quadruples for every doubling of the step frequency). Typical machines are well over that
+// but very short minor axis moves in long blocks may see a small timing error, the step count is always exact.
+// Rates must stay under 2 steps per tick, which is already the limit as only one step per tick can be issued.
+using stepticker_fp_t= int32_t;
+#define STEPTICKER_FPSCALE ((stepticker_fp_t)1<<30)
+#else
 // handle 2.62 Fixed point
+using stepticker_fp_t= int64_t;
 #define STEPTICKER_FPSCALE (1LL<<62)
+#endif
 #define STEPTICKER_FROMFP(x) ((float)(x)/STEPTICKER_FPSCALE)
 
+// the state of a motor that the step tick reads and changes, StepTicker keeps them packed together in one array so the
+// ISR does not go through each StepperMotor for it. The StepperMotor keeps the configuration and gets at these through
+// the pointer register_motor() gives it
+struct MotorState {
+    volatile int32_t position_steps; // counted by the step tick
+    FastPin dir_pin;
+    uint32_t step_mask;              // step pin bit, 0 if there is no step pin
+    uint8_t step_port;               // index into StepTicker::step_port
+    volatile bool direction;
+    volatile bool moving;
+    bool step_owed;                  // a step fell due before step_after, it is made up once the hold is over
+    uint32_t step_after;             // the tick of the block it may step from, after its direction pin changed
+    int32_t advance_state;           // steps it is actually ahead of its planned position from pressure advance
+
+    // called from step ticker ISR
+    inline void set_direction(bool f)
+    {
+        dir_pin.set(f);
+        direction= f;
+    }
+};
+
 class StepTicker{
     public:
         StepTicker();
         ~StepTicker();
         void set_frequency( float frequency );
         void set_unstep_time( float microseconds );
+        // how long a direction change must come before the next step, rounded up to whole ticks, 0 does not wait
+        void set_dir_setup_time( float microseconds );
+        void set_variable_interval(bool f) { variable_interval= f; }
+        // ends the step pulse with a second match on TIMER0 instead of starting TIMER1, so there is one interrupt per step
+        void set_single_timer(bool f);
+        bool is_single_timer() const { return single_timer; }
+        // the motors after XYZ (extruders and ABC) are stepped every n ticks from their own lower priority interrupt, 1 turns it off
+        void set_secondary_divider(uint8_t n) { secondary_divider= n < 1 ? 1 : n; }
+        uint8_t get_secondary_divider() const { return secondary_divider; }
+        static bool is_secondary_motor(uint8_t m) { return m >= N_PRIMARY_AXIS; }
+        void set_speed_override(float f);
+        float get_speed_override() const { return override_active ? override_rate / 4294967296.0F : 1.0F; }
+        // the fraction of real time the step generator runs at in 0.32, from the speed override and a feed hold, the rates of
+        // the block are scaled by it
+        uint32_t get_time_rate() const
+        {
+            if(sync_tpp != 0) return 0xFFFFFFFFUL;
+            uint32_t rate= override_active ? override_rate : 0xFFFFFFFFUL;
+            if(hold_active) rate= ((uint64_t)rate * hold_scale) >> 32;
+            return rate;
+        }
+        void set_feed_hold(bool f);
+        bool is_held() const { return hold_active && hold_scale == 0; } // true once the hold has come to a stop
+        // spindle sync, time only passes for the step generator while it is behind the spindle, ticks_per_pulse ticks of it
+        // for each pulse of the spindle's tachometer, so the motors keep with the spindle however it turns. The override and
+        // feed hold do not apply while it is on, 0 turns it off
+        void set_spindle_sync(float ticks_per_pulse);
+        bool is_spindle_synced() const { return sync_tpp != 0; }
+        // called from the tachometer's capture interrupt with the time since its last pulse
+        static void spindle_edge(uint32_t period_us);
+        // drops the block being run on the next tick wherever it is, and any hold, the conveyor must already be flushing
+        void abort_block() { abort_pending= true; }
+        bool is_aborting() const { return abort_pending; }
+        // can be called from an interrupt, stops stepping on the next tick and turns the motors off without waiting for
+        // the main loop, whoever calls it then raises the halt from the main loop, which keeps them stopped
+        void emergency_stop();
+        bool is_emergency_stopped() const { return estop; }
+        void clear_emergency_stop() { estop= false; }
         int register_motor(StepperMotor* motor);
         float get_frequency() const { return frequency; }
         void unstep_tick();
+        void end_step_pulse();
         const Block *get_current_block() const { return current_block; }
+        uint32_t get_current_tick() const { return current_tick; }
 
         void step_tick (void);
+        void secondary_tick(void);
         void handle_finish (void);
         void start();
 
         // whatever setup the block should register this to know when it is done
         std::function<void()> finished_fnc{nullptr};
 
+        // called from the step ISR every divider ticks while a block runs, with the rate of its primary motor as a
+        // fraction of the nominal rate in 0.16 fixed point, so the laser power can follow the speed
+        void set_rate_fnc(std::function<void(const Block*, uint32_t)> fnc, uint32_t divider) { rate_divider= divider; rate_count= 0; rate_fnc= fnc; }
+
+        // pressure advance, motor m (an extruder) runs ahead of its planned position by k seconds worth of its speed, 0 turns it off.
+        // Only blocks that move it forwards along with some other motor are advanced, see Block::prepare_advance()
+        void set_pressure_advance(uint8_t m, float k) { advance_ticks[m]= k > 0 ? (uint32_t)(std::min(k, 1.0F) * frequency + 0.5F) : 0; }
+        float get_pressure_advance(uint8_t m) const { return advance_ticks[m] / frequency; }
+
+#ifdef STEPTICKER_PROFILE
+        // DWT cycle counter statistics for the step ISRs, only compiled in if STEPTICKER_PROFILE is set in src/makefile
+        struct cycle_stats_t {
+            void reset();
+            void record(uint32_t cycles, uint32_t budget);
+            uint32_t min, max, count, overruns;
+            uint64_t total;
+            std::array<uint32_t, 10> histogram; // in 1/8ths of the tick period, the last bucket catches anything longer
+        };
+        const cycle_stats_t& get_tick_stats() const { return tick_stats; }
+        const cycle_stats_t& get_block_stats() const { return block_stats; }
+        const cycle_stats_t& get_unstep_stats() const { return unstep_stats; }
+        uint32_t get_period_cycles() const { return period * 4; } // timer runs at SystemCoreClock/4
+        void reset_profile();
+        // called from the ISRs with the number of cycles they took
+        void profile_tick(uint32_t cycles) { tick_stats.record(cycles, get_period_cycles()); }
+        void profile_unstep(uint32_t cycles) { unstep_stats.record(cycles, get_period_cycles()); }
+#endif
+
+        bool is_running() const { return running; }
         static StepTicker *getInstance() { return instance; }
 
     private:
         static StepTicker *instance;
 
         bool start_next_block();
+        void add_active_motor(const Block *block, uint8_t m, std::array<uint8_t, k_max_actuators> &active, uint8_t &n_active,
+            std::array<uint8_t, k_max_actuators> &secondary, uint8_t &n_secondary);
+        void start_secondary();
+        bool secondary_due() const;
+        void stage_next_block();
+        bool start_staged_block(uint32_t ended_at);
+        void change_directions_ahead();
+        void next_scurve_phase();
+        void skip_idle_ticks(bool scurve);
+        void start_advance();
+        void schedule_unstep(uint32_t stepped_at);
+        void trace_block_start();
 
         float frequency;
         uint32_t period;
+        uint32_t unstep_delay; // step pulse length in timer counts
+        uint32_t dir_setup_ticks{0}; // ticks from a direction change to the first step it may have
         std::array<StepperMotor*, k_max_actuators> motor;
-        std::bitset<k_max_actuators> unstep;
+        std::array<MotorState, k_max_actuators> motor_state; // the part of each motor the step tick uses, setup by register_motor()
+
+        // the step pins are grouped by GPIO port so each step edge is a single FIOSET/FIOCLR write per port, setup by register_motor()
+        static const uint8_t k_max_step_ports= 5; // the LPC1768 has 5 GPIO ports
+        struct step_port_t {
+            LPC_GPIO_TypeDef *port;
+            uint32_t inverted; // step pins on this port that are active low
+        };
+        std::array<step_port_t, k_max_step_ports> step_port;
+        std::array<uint32_t, k_max_step_ports> unstep_mask; // step pins on each port that unstep_tick() needs to reset
+        uint8_t num_step_ports{0};
+        // indices of the motors that have steps in the current block, built by start_next_block()
+        std::array<uint8_t, k_max_actuators> active_motor;
+        uint8_t num_active_motors{0};
+        uint8_t active_mask{0}; // a bit for each motor in active_motor
+
+        // the motors step_tick() steps are run by step_motors<N>() with N the number registered rounded up to 3, the
+        // recursion unrolls into a straight run with each motor's tick_info and MotorState at fixed offsets
+        using step_masks_t= std::array<uint32_t, k_max_step_ports>; // step pins to set on each port this tick
+        bool tick_motor(uint8_t m, bool scurve, uint8_t advanced, step_masks_t &step_mask);
+        template<uint8_t N> bool step_motors(bool scurve, uint8_t advanced, step_masks_t &step_mask);
+        void select_motor_loop();
+        void set_active_mask();
+        bool (StepTicker::*step_motors_fnc)(bool scurve, uint8_t advanced, step_masks_t &step_mask);
 
         Block *current_block;
         uint32_t current_tick{0};
 
+        std::function<void(const Block*, uint32_t)> rate_fnc{nullptr};
+        uint32_t rate_divider{1};
+        uint32_t rate_count{0};
+
+        // pressure advance constant of each motor in ticks. How many steps each is actually ahead of its planned position is
+        // in its MotorState, carried from block to block so rounding and the steps it could not make never add up, and one
+        // extruder's lag is never taken off another's after a tool change
+        std::array<uint32_t, k_max_actuators> advance_ticks;
+
+        // the next block is claimed and prepared a few ticks before the current one ends, so the block boundary is cheap
+        static const uint32_t k_stage_ticks= 10; // how many ticks before the end of the current block to stage the next one
+        Block *next_block{nullptr};
+        uint32_t stage_tick{0}; // tick of the current block at which to stage the next one
+        std::array<uint8_t, k_max_actuators> next_active_motor;
+        uint8_t num_next_active_motors{0};
+        // with a direction setup time the motors that reverse in the staged block have their direction pin changed as soon
+        // as they are done in the current one, dir_set_mask once that has been done and their step_after is in its ticks
+        uint8_t dir_ahead_mask{0};
+        uint8_t dir_set_mask{0};
+
+        // the motors of the current block that secondary_tick() steps, it gets the tick number every secondary_divider ticks.
+        // Their rates are per secondary tick, the accelerate and decelerate events are still in ticks, see Block::prepare()
+        std::array<uint8_t, k_max_actuators> secondary_motor;
+        uint8_t num_secondary_motors{0};
+        std::array<uint8_t, k_max_actuators> next_secondary_motor;
+        uint8_t num_next_secondary_motors{0};
+        uint8_t secondary_divider{1};
+        uint32_t next_secondary_tick{0};
+        Block * volatile secondary_block{nullptr}; // the block and tick it was last asked to run for
+        volatile uint32_t secondary_at{0};
+        volatile uint8_t secondary_moving{0};  // its motors still to finish, the advanced one is not counted
+        volatile bool secondary_busy{false};   // set from asking it to run until it has
+
+        // real time speed override, the fraction of ticks that are actually run in 0.32 fixed point
+        uint32_t override_rate{0};
+        uint32_t override_accum{0};
+        volatile bool override_active{false}; // set when the speed override is below 100%
+
+        // feed hold ramps the time scale of the step generator down to zero and back, in 0.32 fixed point
+        uint32_t hold_scale{0xFFFFFFFFUL};
+        uint32_t hold_step{0}; // change in hold_scale per tick
+        volatile bool feed_hold{false}; // set when a hold is requested, cleared to resume
+        volatile bool hold_active{false}; // set from the start of a hold until it is back up to full speed
+        volatile bool abort_pending{false}; // set by abort_block() until the next tick has dropped the block
+
+        // spindle sync in ticks 24.8 fixed point, see set_spindle_sync()
+        volatile uint32_t sync_tpp{0};   // ticks per pulse, 0 when it is off
+        uint32_t sync_ticks_per_us{0};   // 16.16
+        volatile uint32_t sync_edges{0}; // pulses counted by spindle_edge()
+        volatile uint32_t sync_step{0};  // ticks per tick at the rate of the last pulse, until the next one comes
+        uint32_t sync_seen{0};           // sync_edges the ISR has added to sync_ahead
+        int32_t sync_ahead{0};           // the pulses less the ticks run
+        uint32_t sync_frac{0};           // how far the spindle is thought to have turned since its last pulse
+        volatile bool estop{false}; // set by emergency_stop() until the halt has caught up
+
+        // in variable interval mode the timer is reprogrammed to skip over ticks where no motor can step
+        static const uint32_t k_max_skip_ticks= 1000; // so halts and the like are still seen reasonably quickly
+        static const uint32_t k_unstep_parked= 0xFFFFFFFFUL; // MR1 when no step pulse is waiting to end, the count never gets there
+
+#ifdef STEPTICKER_PROFILE
+        cycle_stats_t tick_stats;
+        cycle_stats_t block_stats;
+        cycle_stats_t unstep_stats;
+#endif
+
         struct {
             volatile bool running:1;
             uint8_t num_motors:4;
+            uint8_t scurve_phase:3; // which of the 7 phases of an s-curve block we are in
+            bool apply_jerk:1;      // set in the s-curve phases where the acceleration is changing
+            bool variable_interval:1; // set to skip ticks when no motor will step
+            volatile bool skipping:1; // set when the timer has been set to more than one tick
+            bool single_timer:1;      // set when MR1 of TIMER0 ends the step pulse rather than TIMER1
+            volatile bool finish_pending:1; // went on to the staged block, handle_finish() has to tell the conveyor
         };
 };
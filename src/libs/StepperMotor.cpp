@@ -13,7 +13,7 @@
 #include <math.h>
 #include "mbed.h"
 
-StepperMotor::StepperMotor(Pin &step, Pin &dir, Pin &en) : step_pin(step), dir_pin(dir), en_pin(en)
+StepperMotor::StepperMotor(Pin &step, Pin &dir, Pin &en) : step_pin(step), dir_pin(dir), en_pin(en), step_out(step)
 {
     if(en.connected()) {
         set_high_on_debug(en.port_number, en.pin);
@@ -24,15 +24,16 @@ StepperMotor::StepperMotor(Pin &step, Pin &dir, Pin &en) : step_pin(step), dir_p
 
     last_milestone_steps = 0;
     last_milestone_mm    = 0.0F;
-    current_position_steps= 0;
-    moving= false;
+    backlash_mm          = 0.0F;
+    backlash_steps       = 0;
+    planned_direction    = 0;
     acceleration= NAN;
     selected= true;
     extruder= false;
 
     enable(false);
     unstep(); // initialize step pin
-    set_direction(false); // initialize dir pin
+    dir_pin.set(false); // initialize dir pin
 
     this->register_for_event(ON_HALT);
     this->register_for_event(ON_ENABLE);
@@ -48,7 +49,9 @@ void StepperMotor::on_halt(void *argument)
 {
     if(argument == nullptr) {
         enable(false);
-        moving= false;
+        state->moving= false;
+        // it may have been moved by hand, so which side of the backlash it is on is no longer known
+        planned_direction= 0;
     }
 }
 
@@ -56,7 +59,7 @@ void StepperMotor::on_enable(void *argument)
 {
     // argument is a uin32_t where bit0 is on or off, and bit 1:X, 2:Y, 3:Z, 4:A, 5:B, 6:C etc
     // for now if bit0 is 1 we turn all on, if 0 we turn all off otherwise we turn selected axis off
-    uint32_t bm= (uint32_t)argument;
+    uint32_t bm= (uint32_t)(uintptr_t)argument;
     if(bm == 0x01) {
         enable(true);
 
@@ -69,21 +72,46 @@ void StepperMotor::change_steps_per_mm(float new_steps)
 {
     steps_per_mm = new_steps;
     last_milestone_steps = lroundf(last_milestone_mm * steps_per_mm);
-    current_position_steps = last_milestone_steps;
+    state->position_steps = last_milestone_steps;
+    backlash_steps = lroundf(backlash_mm * steps_per_mm);
+}
+
+void StepperMotor::set_backlash(float mm)
+{
+    backlash_mm = mm > 0.0F ? mm : 0.0F;
+    backlash_steps = lroundf(backlash_mm * steps_per_mm);
+}
+
+uint32_t StepperMotor::backlash_for(bool dir)
+{
+    int8_t d = dir ? -1 : 1;
+    // the first move after a reset or halt just sets which side it is on
+    bool reversed = planned_direction != 0 && planned_direction != d;
+    planned_direction = d;
+    return reversed ? backlash_steps : 0;
 }
 
 void StepperMotor::change_last_milestone(float new_milestone)
 {
     last_milestone_mm = new_milestone;
     last_milestone_steps = lroundf(last_milestone_mm * steps_per_mm);
-    current_position_steps = last_milestone_steps;
+    state->position_steps = last_milestone_steps;
+}
+
+void StepperMotor::correct_position(int32_t steps)
+{
+    // last_milestone_mm is where it is going, so the steps to it change but not the path
+    last_milestone_steps += steps;
+    __disable_irq();
+    state->position_steps += steps;
+    __enable_irq();
 }
 
 void StepperMotor::set_last_milestones(float mm, int32_t steps)
 {
     last_milestone_mm= mm;
     last_milestone_steps= steps;
-    current_position_steps= last_milestone_steps;
+    state->position_steps= last_milestone_steps;
 }
 
 void StepperMotor::update_last_milestones(float mm, int32_t steps)
@@ -106,18 +134,17 @@ void StepperMotor::manual_step(bool dir)
     if(!is_enabled()) enable(true);
 
     // set direction if needed
-    if(this->direction != dir) {
-        this->direction= dir;
-        this->dir_pin.set(dir);
+    if(state->direction != dir) {
+        state->set_direction(dir);
         wait_us(1);
     }
 
     // pulse step pin
-    this->step_pin.set(1);
+    step_out.high();
     wait_us(3);
-    this->step_pin.set(0);
+    step_out.low();
 
 
     // keep track of actuators actual position in steps
-    this->current_position_steps += (dir ? -1 : 1);
+    state->position_steps += (dir ? -1 : 1);
 }
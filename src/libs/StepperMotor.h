@@ -9,6 +9,7 @@
 
 #include "Module.h"
 #include "Pin.h"
+#include "StepTicker.h"
 
 class StepperMotor  : public Module {
     public:
@@ -18,22 +19,24 @@ class StepperMotor  : public Module {
         void set_motor_id(uint8_t id) { motor_id= id; }
         uint8_t get_motor_id() const { return motor_id; }
 
-        // called from step ticker ISR
-        inline bool step() { step_pin.set(1); current_position_steps += (direction?-1:1); return moving; }
-        // called from unstep ISR
-        inline void unstep() { step_pin.set(0); }
-        // called from step ticker ISR
-        inline void set_direction(bool f) { dir_pin.set(f); direction= f; }
+        // the position, direction and moving flag are kept by the step ticker, called by StepTicker::register_motor()
+        void set_state(MotorState *s) { state= s; }
+
+        // resets the step pin, the step ticker normally does this for all motors at once
+        inline void unstep() { step_out.low(); }
+        const Pin& get_step_pin() const { return step_pin; }
+        const Pin& get_dir_pin() const { return dir_pin; }
+        inline void set_direction(bool f) { state->set_direction(f); }
 
         void enable(bool state) { en_pin.set(!state); };
         bool is_enabled() const { return !en_pin.get(); };
-        bool is_moving() const { return moving; };
-        void start_moving() { moving= true; }
-        void stop_moving() { moving= false; }
+        bool is_moving() const { return state->moving; };
+        void start_moving() { state->moving= true; }
+        void stop_moving() { state->moving= false; }
 
         void manual_step(bool dir);
 
-        bool which_direction() const { return direction; }
+        bool which_direction() const { return state->direction; }
 
         float get_steps_per_second()  const { return steps_per_second; }
         float get_steps_per_mm()  const { return steps_per_mm; }
@@ -41,10 +44,12 @@ class StepperMotor  : public Module {
         void change_last_milestone(float);
         void set_last_milestones(float, int32_t);
         void update_last_milestones(float mm, int32_t steps);
+        // the motor is steps from where it was stepped to, the next block planned for it makes them up
+        void correct_position(int32_t steps);
         float get_last_milestone(void) const { return last_milestone_mm; }
         int32_t get_last_milestone_steps(void) const { return last_milestone_steps; }
-        float get_current_position(void) const { return (float)current_position_steps/steps_per_mm; }
-        uint32_t get_current_step(void) const { return current_position_steps; }
+        float get_current_position(void) const { return (float)state->position_steps/steps_per_mm; }
+        uint32_t get_current_step(void) const { return state->position_steps; }
         float get_max_rate(void) const { return max_rate; }
         void set_max_rate(float mr) { max_rate= mr; }
         void set_acceleration(float a) { acceleration= a; }
@@ -56,6 +61,15 @@ class StepperMotor  : public Module {
 
         int32_t steps_to_target(float);
 
+        // backlash is taken up by extra steps added to the block that reverses the motor, see Planner::append_block()
+        void set_backlash(float mm);
+        float get_backlash() const { return backlash_mm; }
+        // the extra steps a block moving in dir needs, only called by the planner as it keeps track of the last direction planned
+        uint32_t backlash_for(bool dir);
+        // called from step ticker ISR at the start of a block with backlash steps for this motor, after its direction is set,
+        // so the position comes out where it was planned once they have been taken too
+        inline void discount_backlash() { state->position_steps += state->direction ? backlash_steps : -backlash_steps; }
+
 
     private:
         void on_halt(void *argument);
@@ -64,20 +78,22 @@ class StepperMotor  : public Module {
         Pin step_pin;
         Pin dir_pin;
         Pin en_pin;
+        FastPin step_out;
+        MotorState *state{nullptr};
 
         float steps_per_second;
         float steps_per_mm;
         float max_rate; // this is not really rate it is in mm/sec, misnamed used in Robot and Extruder
         float acceleration;
 
-        volatile int32_t current_position_steps;
         int32_t last_milestone_steps;
         float   last_milestone_mm;
+        float   backlash_mm;
+        int32_t backlash_steps;
+        int8_t  planned_direction; // of the last block planned that moves this motor, 0 if not known
 
-        volatile struct {
+        struct {
             uint8_t motor_id:8;
-            volatile bool direction:1;
-            volatile bool moving:1;
             bool selected:1;
             bool extruder:1;
         };
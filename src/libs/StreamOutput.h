@@ -11,6 +11,7 @@
 #include <cstdarg>
 #include <cstring>
 #include <stdio.h>
+#include <stdint.h>
 
 // This is a base class for all StreamOutput objects.
 // StreamOutputs are basically "things you can sent strings to". They are passed along with gcodes for example so modules can answer to those gcodes.
@@ -28,6 +29,13 @@ class StreamOutput {
         virtual int _getc(void) { return 0; }
         virtual int puts(const char* str) = 0;
         virtual bool ready() { return true; };
+        // bytes free in the receive buffer of the stream, -1 if it does not have one
+        virtual int rx_space() { return -1; }
+        // for binary transfers, while raw every byte received is passed to read_raw without being interpreted,
+        // set_raw returns false if the stream can not do that
+        virtual bool set_raw(bool) { return false; }
+        // copies up to len received bytes into buf, returns how many, 0 if there are none waiting
+        virtual int read_raw(uint8_t *buf, int len) { return 0; }
 
         static NullStreamOutput NullStream;
 };
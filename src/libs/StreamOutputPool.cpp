@@ -0,0 +1,89 @@
+#include "StreamOutputPool.h"
+
+int StreamOutputPool::send(uint8_t cls, const char *s)
+{
+    int r = 0;
+    for (uint8_t i = 0; i < n_streams; i++) {
+        if((masks[i] & cls) == 0) continue;
+        int k = streams[i]->puts(s);
+        if (k > r)
+            r = k;
+    }
+    return r;
+}
+
+int StreamOutputPool::broadcast(uint8_t cls, const char *format, ...)
+{
+    // nobody wants it so do not bother formatting it
+    uint8_t all= 0;
+    for (uint8_t i = 0; i < n_streams; i++) all |= masks[i];
+    if((all & cls) == 0) return 0;
+
+    // the buffer is on the stack as a stream may call idle while it waits for room and something else may broadcast then
+    char b[64];
+    char *buffer;
+    va_list args;
+    va_start(args, format);
+    int size = vsnprintf(b, sizeof(b), format, args) + 1; // we add one to take into account space for the terminating \0
+    va_end(args);
+
+    if (size <= (int)sizeof(b)) {
+        buffer = b;
+    } else {
+        buffer = new char[size];
+        va_start(args, format);
+        vsnprintf(buffer, size, format, args);
+        va_end(args);
+    }
+
+    send(cls, buffer);
+
+    if (buffer != b)
+        delete[] buffer;
+
+    return size - 1;
+}
+
+bool StreamOutputPool::append_stream(StreamOutput* stream, uint8_t mask)
+{
+    for (uint8_t i = 0; i < n_streams; i++) {
+        if(streams[i] == stream) {
+            masks[i]= mask;
+            return true;
+        }
+    }
+    if(n_streams >= max_streams) return false;
+    masks[n_streams]= mask;
+    streams[n_streams++]= stream;
+    return true;
+}
+
+void StreamOutputPool::remove_stream(StreamOutput* stream)
+{
+    for (uint8_t i = 0; i < n_streams; i++) {
+        if(streams[i] == stream) {
+            // keep the order the streams were added in
+            for (uint8_t j = i + 1; j < n_streams; j++) {
+                streams[j - 1]= streams[j];
+                masks[j - 1]= masks[j];
+            }
+            --n_streams;
+            return;
+        }
+    }
+}
+
+bool StreamOutputPool::has_stream(const StreamOutput* stream) const
+{
+    for (uint8_t i = 0; i < n_streams; i++) {
+        if(streams[i] == stream) return true;
+    }
+    return false;
+}
+
+void StreamOutputPool::set_stream_mask(StreamOutput* stream, uint8_t mask)
+{
+    for (uint8_t i = 0; i < n_streams; i++) {
+        if(streams[i] == stream) masks[i]= mask;
+    }
+}
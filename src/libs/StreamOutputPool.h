@@ -9,43 +9,45 @@
 #define STREAMOUTPUTPOOL_H
 
 using namespace std;
-#include <set>
 #include <string>
+#include <stdint.h>
 #include <cstdio>
 #include <cstdarg>
 
 #include "libs/StreamOutput.h"
 
+// what kind of output a broadcast is, each stream has a mask of the kinds it wants
+enum STREAM_OUTPUT_CLASS {
+    STREAM_OUTPUT_NORMAL=  0x01, // replies, errors and alarms, everything printf and puts send
+    STREAM_OUTPUT_VERBOSE= 0x02, // periodic reports and progress that a host can do without
+    STREAM_OUTPUT_ALL=     0xFF
+};
+
+// Sends everything to all the streams that have been added, eg serial, USB and telnet connections
 class StreamOutputPool : public StreamOutput {
 
 public:
-    StreamOutputPool(){
-    }
-
-    int puts(const char* s)
-    {
-        int r = 0;
-        for(set<StreamOutput*>::iterator i = this->streams.begin(); i != this->streams.end(); i++)
-        {
-            int k = (*i)->puts(s);
-            if (k > r)
-                r = k;
-        }
-        return r;
-    }
-
-    void append_stream(StreamOutput* stream)
-    {
-        this->streams.insert(stream);
-    }
-
-    void remove_stream(StreamOutput* stream)
-    {
-        this->streams.erase(stream);
-    }
+    StreamOutputPool() : n_streams(0) {}
+
+    int puts(const char* s) { return send(STREAM_OUTPUT_NORMAL, s); }
+
+    // formats the message once then sends it to the streams whose mask includes cls
+    int broadcast(uint8_t cls, const char *format, ...) __attribute__ ((format(printf, 3, 4)));
+
+    // returns false if there are already max_streams streams
+    bool append_stream(StreamOutput* stream, uint8_t mask= STREAM_OUTPUT_ALL);
+    void remove_stream(StreamOutput* stream);
+    void set_stream_mask(StreamOutput* stream, uint8_t mask);
+    // a connection removes its stream when it closes, so a reply held on to for later can check it is still there
+    bool has_stream(const StreamOutput* stream) const;
 
 private:
-    set<StreamOutput*> streams;
+    int send(uint8_t cls, const char *s);
+
+    static const uint8_t max_streams= 8;
+    StreamOutput *streams[max_streams];
+    uint8_t masks[max_streams];
+    uint8_t n_streams;
 };
 
 #endif
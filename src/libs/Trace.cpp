@@ -0,0 +1,64 @@
+#include "Trace.h"
+
+#include "StreamOutput.h"
+#include "platform_memory.h"
+#include "us_ticker_api.h"
+#include "libs/LPC17xx/sLPC17xx.h"
+
+Trace::Record *Trace::ring= nullptr;
+std::atomic<uint32_t> Trace::head(0);
+volatile bool Trace::enabled= false;
+
+static const char *event_names[Trace::NUMBER_OF_EVENTS]= {
+    "block_start", "block_end", "idle_gap", "tick_overrun", "halt", "halt_clear", "mark"
+};
+
+void Trace::init()
+{
+    if(ring != nullptr) return;
+    ring= (Record *)AHB0.alloc(size * sizeof(Record));
+    if(ring == nullptr) return;
+    us_ticker_read(); // make sure TIMER3 is running, add() reads it directly
+    clear();
+    enabled= true;
+}
+
+void Trace::add(Event event, uint8_t a, uint16_t b)
+{
+    if(!enabled) return;
+    // the us_ticker is TIMER3 counting us, reading it directly saves the call from the interrupts
+    uint32_t i= head.fetch_add(1, std::memory_order_relaxed) & (size - 1);
+    ring[i]= {LPC_TIM3->TC, event, a, b};
+}
+
+void Trace::clear()
+{
+    bool was= enabled;
+    enabled= false;
+    head= 0;
+    enabled= was;
+}
+
+void Trace::print(StreamOutput *stream)
+{
+    if(ring == nullptr) {
+        stream->printf("no trace, not enough AHB0\n");
+        return;
+    }
+
+    bool was= enabled;
+    enabled= false;
+    uint32_t n= head;
+    uint32_t first= n > size ? n - size : 0;
+    stream->printf("%lu records%s\n      at ms   took ms event a b\n", n - first, n > size ? ", older ones lost" : "");
+
+    uint32_t start= ring[first & (size - 1)].us;
+    uint32_t prev= start;
+    for (uint32_t i = first; i < n; ++i) {
+        const Record& r= ring[i & (size - 1)];
+        stream->printf("%11.3f %9.3f %s %u %u\n", (r.us - start) / 1000.0F, (r.us - prev) / 1000.0F,
+            r.event < NUMBER_OF_EVENTS ? event_names[r.event] : "?", r.a, r.b);
+        prev= r.us;
+    }
+    enabled= was;
+}
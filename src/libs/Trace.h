@@ -0,0 +1,55 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <atomic>
+
+class StreamOutput;
+
+// A timeline of block starts and finishes, queue fill, main loop stalls and step ticker overruns, to find stutters on
+// a running machine without a debugger. Fixed size records are written into a ring in AHB0 from the interrupts and the
+// main loop alike, each writer claims its slot with an atomic increment so one interrupted by another never shares it.
+// Only compiled in with EVENT_TRACE=1 in src/makefile, otherwise TRACE() is nothing. The trace command prints it, and
+// with trace_save_on_halt it is written to /sd/trace.log when the machine halts.
+class Trace {
+public:
+    enum Event : uint8_t {
+        BLOCK_START,  // a blocks queued including this one, b steps of its primary motor
+        BLOCK_END,    // a 1 if the next block was ready to start
+        IDLE_GAP,     // the main loop did not idle for b ms
+        TICK_OVERRUN, // the step ticker took longer than a tick
+        HALT,
+        HALT_CLEAR,
+        MARK,         // from the trace -m command
+        NUMBER_OF_EVENTS
+    };
+
+    struct Record {
+        uint32_t us; // us_ticker time
+        uint8_t event;
+        uint8_t a;
+        uint16_t b;
+    };
+
+    static const uint32_t size= 512; // records, must be a power of 2
+
+    // takes the ring from AHB0, nothing is recorded before this
+    static void init();
+    static void add(Event event, uint8_t a= 0, uint16_t b= 0);
+    static void clear();
+    // oldest first, recording stops while it prints
+    static void print(StreamOutput *stream);
+
+private:
+    static Record *ring;
+    static std::atomic<uint32_t> head; // total records ever added, the slot is head % size
+    static volatile bool enabled;
+};
+
+#ifdef EVENT_TRACE
+#define TRACE(...) Trace::add(__VA_ARGS__)
+#else
+#define TRACE(...) do {} while(0)
+#endif
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef MSDPUBLICACCESS_H
+#define MSDPUBLICACCESS_H
+
+#define msd_checksum              CHECKSUM("msd")
+// get returns a bool that is true once the host has written the card over USB, set clears it again
+#define host_written_checksum     CHECKSUM("host_written")
+// set with a bool, true shows the card to the host as write protected and false writable again
+#define read_only_checksum        CHECKSUM("read_only")
+
+#endif
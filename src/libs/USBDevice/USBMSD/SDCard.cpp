@@ -119,8 +119,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
 
 #include "SDCard.h"
+#include "SPIBus.h"
 
 static const uint8_t OXFF = 0xFF;
 
@@ -130,8 +132,13 @@ SDCard::SDCard(PinName mosi, PinName miso, PinName sclk, PinName cs) :
   _spi(mosi, miso, sclk), _cs(cs) {
     _cs.output();
     _cs = 1;
+    _selected = false;
+    _channel = (mosi == P0_18) ? 0 : 1;
     busyflag = false;
     _sectors = 0;
+    _max_frequency = 12500000;
+    _card_frequency = 25000000;
+    _frequency = 0;
 }
 
 #define R1_IDLE_STATE           (1 << 0)
@@ -261,9 +268,12 @@ int SDCard::disk_initialize()
 
     _sectors = 0;
 
+    // the clock changes and the idle clocking are done with the card deselected, nothing else may run meanwhile
+    SPIBus::hold(_channel);
     CARD_TYPE i = initialise_card();
 
     if (i == SDCARD_FAIL) {
+        SPIBus::release(_channel);
         busyflag = false;
         return 1;
     }
@@ -273,11 +283,15 @@ int SDCard::disk_initialize()
     // Set block length to 512 (CMD16)
     if(_cmd(SDCMD_SET_BLOCKLEN, 512) != 0) {
         fprintf(stderr, "Set 512-byte block timed out\n");
+        SPIBus::release(_channel);
         busyflag = false;
         return 1;
     }
 
-    _spi.frequency(2500000); // Set to 2.5MHz for data transfer
+    // as fast as the card and we allow for data transfer, the SSP rounds down to what it can do
+    _frequency = std::min(_max_frequency, _card_frequency);
+    _spi.frequency(_frequency);
+    SPIBus::release(_channel);
 
     busyflag = false;
 
@@ -328,6 +342,97 @@ int SDCard::disk_read(char *buffer, uint32_t block_number)
     return 0;
 }
 
+int SDCard::disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count)
+{
+    if (count == 1)
+        return disk_read(buffer, block_number);
+
+    if (busyflag)
+        return 0;
+
+    if (cardtype == SDCARD_FAIL)
+        return -1;
+
+    busyflag = true;
+
+    // CMD18 sends one block after another until it is stopped with CMD12, cs stays low throughout
+    if(_cmdx(SDCMD_READ_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        _deselect();
+        busyflag = false;
+        return 1;
+    }
+
+    int r = 0;
+    for (uint32_t i = 0; i < count && r == 0; i++) {
+        r = _read_data(buffer + (i << 9), 512);
+    }
+
+    // CMD12, the byte after it is a stuff byte and the response is R1b
+    _spi.write(0x40 | SDCMD_STOP_TRANSMISSION);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x00);
+    _spi.write(0x61);
+    _spi.write(0xFF);
+    for(int i=0; i<SD_COMMAND_TIMEOUT; i++) {
+        if(!(_spi.write(0xFF) & 0x80)) break;
+    }
+    if(_wait_ready() != 0) r = 1;
+
+    _deselect();
+    busyflag = false;
+
+    return r;
+}
+
+int SDCard::disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count)
+{
+    if (count == 1)
+        return disk_write(buffer, block_number);
+
+    if (busyflag)
+        return 0;
+
+    if (cardtype == SDCARD_FAIL)
+        return -1;
+
+    busyflag = true;
+
+    // CMD25 takes blocks until the stop token
+    if(_cmdx(SDCMD_WRITE_MULTIPLE_BLOCK, BLOCK2ADDR(block_number)) != 0) {
+        _deselect();
+        busyflag = false;
+        return 1;
+    }
+    _spi.write(0xFF);
+
+    int r = 0;
+    for (uint32_t n = 0; n < count; n++) {
+        const char *p = buffer + (n << 9);
+        _spi.write(0xFC); // start of a block of a multiple block write
+        for(int i=0; i<512; i++) {
+            _spi.write(p[i]);
+        }
+        _spi.write(0xFF); // checksum
+        _spi.write(0xFF);
+
+        if((_spi.write(0xFF) & 0x1F) != 0x05 || _wait_ready() != 0) {
+            r = 1;
+            break;
+        }
+    }
+
+    _spi.write(0xFD); // stop token, the card is then busy until it has written everything
+    _spi.write(0xFF);
+    if(_wait_ready() != 0) r = 1;
+
+    _deselect();
+    busyflag = false;
+
+    return r;
+}
+
 int SDCard::disk_status() { return (_sectors > 0)?0:1; }
 int SDCard::disk_sync() {
     // TODO: wait for DMA, wait for card not busy
@@ -345,8 +450,27 @@ SDCard::CARD_TYPE SDCard::card_type()
 
 // PRIVATE FUNCTIONS
 
-int SDCard::_cmd(int cmd, uint32_t arg) {
+// the bus is held while the card is selected, so nothing queued on it by another device runs in between,
+// deselecting clocks one more byte so the card lets go of miso
+void SDCard::_select() {
+    if(!_selected) {
+        SPIBus::hold(_channel);
+        _selected = true;
+    }
     _cs = 0;
+}
+
+void SDCard::_deselect() {
+    _cs = 1;
+    _spi.write(0xFF);
+    if(_selected) {
+        _selected = false;
+        SPIBus::release(_channel);
+    }
+}
+
+int SDCard::_cmd(int cmd, uint32_t arg) {
+    _select();
 
     // send a command
     _spi.write(0x40 | cmd);
@@ -360,17 +484,15 @@ int SDCard::_cmd(int cmd, uint32_t arg) {
     for(int i=0; i<SD_COMMAND_TIMEOUT; i++) {
         int response = _spi.write(0xFF);
         if(!(response & 0x80)) {
-            _cs = 1;
-            _spi.write(0xFF);
+            _deselect();
             return response;
         }
     }
-    _cs = 1;
-    _spi.write(0xFF);
+    _deselect();
     return -1; // timeout
 }
 int SDCard::_cmdx(int cmd, uint32_t arg) {
-    _cs = 0;
+    _select();
 
     // send a command
     _spi.write(0x40 | cmd);
@@ -387,14 +509,13 @@ int SDCard::_cmdx(int cmd, uint32_t arg) {
             return response;
         }
     }
-    _cs = 1;
-    _spi.write(0xFF);
+    _deselect();
     return -1; // timeout
 }
 
 
 int SDCard::_cmd58(uint32_t *ocr) {
-    _cs = 0;
+    _select();
     int arg = 0;
 
     // send a command
@@ -414,18 +535,16 @@ int SDCard::_cmd58(uint32_t *ocr) {
             *ocr |= _spi.write(0xFF) << 8;
             *ocr |= _spi.write(0xFF) << 0;
 //            printf("OCR = 0x%08X\n", ocr);
-            _cs = 1;
-            _spi.write(0xFF);
+            _deselect();
             return response;
         }
     }
-    _cs = 1;
-    _spi.write(0xFF);
+    _deselect();
     return -1; // timeout
 }
 
 int SDCard::_cmd8() {
-    _cs = 0;
+    _select();
 
     // send a command
     _spi.write(0x40 | SDCMD_SEND_IF_COND); // CMD8
@@ -443,18 +562,16 @@ int SDCard::_cmd8() {
                 for(int j=1; j<5; j++) {
                     response[i] = _spi.write(0xFF);
                 }
-                _cs = 1;
-                _spi.write(0xFF);
+                _deselect();
                 return response[0];
         }
     }
-    _cs = 1;
-    _spi.write(0xFF);
+    _deselect();
     return -1; // timeout
 }
 
 int SDCard::_read(char *buffer, int length) {
-    _cs = 0;
+    _select();
 
     // read until start byte (0xFF)
     while(_spi.write(0xFF) != 0xFE);
@@ -474,13 +591,39 @@ int SDCard::_read(char *buffer, int length) {
     _spi.write(0xFF); // checksum
     _spi.write(0xFF);
 
-    _cs = 1;
+    _deselect();
+    return 0;
+}
+
+// read one data block of a multiple block read, cs is already low and stays low
+int SDCard::_read_data(char *buffer, int length) {
+    // wait for the start token, anything else that is not 0xFF is an error token
+    int token = 0xFF;
+    for(int i=0; i<SD_COMMAND_TIMEOUT * 100 && token == 0xFF; i++) {
+        token = _spi.write(0xFF);
+    }
+    if(token != 0xFE)
+        return 1;
+
+    for(int i=0; i<length; i++) {
+        buffer[i] = _spi.write(0xFF);
+    }
+    _spi.write(0xFF); // checksum
     _spi.write(0xFF);
     return 0;
 }
 
+// the card holds MISO low while it is busy
+int SDCard::_wait_ready() {
+    for(int i=0; i<SD_COMMAND_TIMEOUT * 100; i++) {
+        if(_spi.write(0xFF) == 0xFF)
+            return 0;
+    }
+    return 1;
+}
+
 int SDCard::_write(const char *buffer, int length) {
-    _cs = 0;
+    _select();
 
     // indicate start of block
     _spi.write(0xFE);
@@ -496,16 +639,14 @@ int SDCard::_write(const char *buffer, int length) {
 
     // check the repsonse token
     if((_spi.write(0xFF) & 0x1F) != 0x05) {
-        _cs = 1;
-        _spi.write(0xFF);
+        _deselect();
         return 1;
     }
 
     // wait for write to finish
     while(_spi.write(0xFF) == 0);
 
-    _cs = 1;
-    _spi.write(0xFF);
+    _deselect();
     return 0;
 }
 
@@ -543,6 +684,13 @@ uint32_t SDCard::_sd_sectors() {
 
     int csd_structure = ext_bits(csd, 127, 126);
 
+    // tran_speed : csd[103:96], the maximum clock as a time value times a rate unit
+    static const uint8_t time_value[16] = {0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80};
+    static const uint32_t rate_unit[4] = {10000, 100000, 1000000, 10000000}; // 100kbit/s to 100Mbit/s, divided by 10
+    int tran_speed = ext_bits(csd, 103, 96);
+    if ((tran_speed & 0x07) < 4 && time_value[(tran_speed >> 3) & 0x0F] != 0)
+        _card_frequency = time_value[(tran_speed >> 3) & 0x0F] * rate_unit[tran_speed & 0x07];
+
     if (csd_structure == 0)
     {
         if (cardtype == SDCARD_V2HC)
@@ -71,6 +71,8 @@ public:
     virtual int disk_initialize();
     virtual int disk_write(const char *buffer, uint32_t block_number);
     virtual int disk_read(char *buffer, uint32_t block_number);
+    virtual int disk_read_blocks(char *buffer, uint32_t block_number, uint32_t count);
+    virtual int disk_write_blocks(const char *buffer, uint32_t block_number, uint32_t count);
     virtual int disk_status();
     virtual int disk_sync();
     virtual uint32_t disk_sectors();
@@ -80,6 +82,10 @@ public:
 
     CARD_TYPE card_type(void);
 
+    // the SPI clock used for data transfers is the lower of this and what the card says it can do, set before disk_initialize
+    void set_max_frequency(uint32_t hz) { _max_frequency = hz; }
+    uint32_t frequency() const { return _frequency; }
+
     bool busy();
 
 protected:
@@ -92,14 +98,23 @@ protected:
     CARD_TYPE initialise_card_v1();
     CARD_TYPE initialise_card_v2();
 
+    void _select();
+    void _deselect();
     int _read(char *buffer, int length);
     int _write(const char *buffer, int length);
+    int _read_data(char *buffer, int length);
+    int _wait_ready();
 
     uint32_t _sd_sectors();
     uint32_t _sectors;
+    uint32_t _max_frequency;
+    uint32_t _card_frequency; // from the TRAN_SPEED field of the CSD
+    uint32_t _frequency;
 
     mbed::SPI _spi;
     GPIO _cs;
+    bool _selected;
+    uint8_t _channel; // SSP, for holding the bus it shares
 
     volatile bool busyflag;
 
@@ -26,6 +26,12 @@
 #include "descriptor_msc.h"
 
 #include "Kernel.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "PublicData.h"
+#include "PublicDataRequest.h"
+#include "MSDPublicAccess.h"
 
 #include "platform_memory.h"
 
@@ -70,6 +76,22 @@
 // max packet size
 #define MAX_PACKET  MAX_PACKET_SIZE_EPBULK
 
+// the most blocks moved in one disk transfer, fewer are used if there is not the memory for them
+#define MAX_CACHE_BLOCKS           8
+
+#define read_only_while_playing_checksum CHECKSUM("msd_read_only_while_playing")
+
+// sense keys and additional sense codes
+#define SENSE_NOT_READY            0x02
+#define SENSE_ILLEGAL_REQUEST      0x05
+#define SENSE_UNIT_ATTENTION       0x06
+#define SENSE_DATA_PROTECT         0x07
+#define ASC_INVALID_OPCODE         0x20
+#define ASC_INVALID_FIELD          0x24
+#define ASC_WRITE_PROTECTED        0x27
+#define ASC_MEDIUM_CHANGED         0x28
+#define ASC_MEDIUM_NOT_PRESENT     0x3A
+
 // #define iprintf(...) THEKERNEL->streams->printf(__VA_ARGS__)
 #define iprintf(...) do { } while (0)
 
@@ -191,9 +213,17 @@ bool USBMSD::connect()
     BlockSize = disk->disk_blocksize();
 
     if ((BlockCount > 0) && (BlockSize != 0)) {
-        page = (uint8_t*) AHB0.alloc(BlockSize);
-        if (page == NULL)
+        // AHB1 first, AHB0 has the planner queue and the serial buffers
+        for (cache_blocks = MAX_CACHE_BLOCKS; ; cache_blocks /= 2) {
+            cache = (uint8_t*) AHB1.alloc(BlockSize * cache_blocks);
+            if (cache == NULL)
+                cache = (uint8_t*) AHB0.alloc(BlockSize * cache_blocks);
+            if (cache != NULL || cache_blocks == 1)
+                break;
+        }
+        if (cache == NULL)
             return false;
+        cache_count = 0;
     } else {
         return false;
     }
@@ -309,16 +339,10 @@ void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
         usb->stallEndpoint(MSC_BulkOut.bEndpointAddress);
     }
 
-    // we fill an array in RAM of 1 block before writing it in memory
+    // the blocks are collected in the cache and written together once it is full or the transfer has ended
+    uint8_t *p = &cache[cache_count * BlockSize + addr_in_block];
     for (int i = 0; i < size; i++)
-        page[addr_in_block + i] = buf[i];
-
-    // if the array is filled, write it in memory
-    if ((addr_in_block + size) >= BlockSize) {
-        if (!(disk->disk_status() & WRITE_PROTECT)) {
-            disk->disk_write((const char *)page, lba);
-        }
-    }
+        p[i] = buf[i];
 
     addr_in_block += size;
     length -= size;
@@ -327,6 +351,11 @@ void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
     {
         addr_in_block = 0;
         lba++;
+        cache_count++;
+        if ((cache_count >= cache_blocks || !length) && !flushCache()) {
+            stage = ERROR;
+            usb->stallEndpoint(MSC_BulkOut.bEndpointAddress);
+        }
     }
 
     if ((!length) || (stage != PROCESS_CBW)) {
@@ -335,6 +364,17 @@ void USBMSD::memoryWrite (uint8_t * buf, uint16_t size) {
     }
 }
 
+// writes the blocks collected by memoryWrite(), they start at lba - cache_count
+bool USBMSD::flushCache (void) {
+    int r = 0;
+    if (cache_count > 0 && !(disk->disk_status() & WRITE_PROTECT)) {
+        r = disk->disk_write_blocks((const char *)cache, lba - cache_count, cache_count);
+        host_written = true;
+    }
+    cache_count = 0;
+    return r == 0;
+}
+
 void USBMSD::memoryVerify (uint8_t * buf, uint16_t size) {
     uint32_t n;
 
@@ -346,11 +386,11 @@ void USBMSD::memoryVerify (uint8_t * buf, uint16_t size) {
 
     // beginning of a new block -> load a whole block in RAM
     if (addr_in_block == 0)
-        disk->disk_read((char *)page, lba);
+        disk->disk_read((char *)cache, lba);
 
     // info are in RAM -> no need to re-read memory
     for (n = 0; n < size; n++) {
-        if (page[addr_in_block + n] != buf[n]) {
+        if (cache[addr_in_block + n] != buf[n]) {
             memOK = false;
             break;
         }
@@ -453,6 +493,8 @@ bool USBMSD::write (uint8_t * buf, uint16_t size) {
 
 bool USBMSD::modeSense6 (void) {
     uint8_t sense6[] = { 0x03, 0x00, 0x00, 0x00 };
+    if (read_only || (disk->disk_status() & WRITE_PROTECT))
+        sense6[2] = 0x80; // WP
     if (!write(sense6, sizeof(sense6))) {
         return false;
     }
@@ -471,7 +513,7 @@ bool USBMSD::requestSense (void) {
     uint8_t request_sense[] = {
         0x70,
         0x00,
-        0x05,   // Sense Key: illegal request
+        sense_key,
         0x00,
         0x00,
         0x00,
@@ -481,8 +523,8 @@ bool USBMSD::requestSense (void) {
         0x00,
         0x00,
         0x00,
-        0x30,
-        0x01,
+        sense_asc,
+        0x00,
         0x00,
         0x00,
         0x00,
@@ -491,10 +533,11 @@ bool USBMSD::requestSense (void) {
 
     if (BlockCount == 0)
     {
-        request_sense[ 2] = 0x02; // Not Ready
-        request_sense[12] = 0x3A; // Medium not present
-        request_sense[13] = 0x00; // No known reason
+        request_sense[ 2] = SENSE_NOT_READY;
+        request_sense[12] = ASC_MEDIUM_NOT_PRESENT;
     }
+    // what the commands that fail without setting a sense of their own report
+    setSense(SENSE_ILLEGAL_REQUEST, ASC_INVALID_FIELD);
 
     if (!write(request_sense, sizeof(request_sense))) {
         return false;
@@ -503,6 +546,11 @@ bool USBMSD::requestSense (void) {
     return true;
 }
 
+void USBMSD::setSense (uint8_t key, uint8_t asc) {
+    sense_key = key;
+    sense_asc = asc;
+}
+
 void USBMSD::fail() {
     csw.Status = CSW_FAILED;
     sendCSW();
@@ -556,7 +604,11 @@ void USBMSD::CBWDecode(uint8_t * buf, uint16_t size) {
                         break;
                     case WRITE10:
                     case WRITE12:
-                        if (infoTransfer()) {
+                        if (read_only) {
+                            setSense(SENSE_DATA_PROTECT, ASC_WRITE_PROTECTED);
+                            usb->stallEndpoint(MSC_BulkOut.bEndpointAddress);
+                            fail();
+                        } else if (infoTransfer()) {
                             if (!(cbw.Flags & 0x80)) {
                                 iprintf("MSD: Write %lu blocks from LBA %lu\n", blocks, lba);
                                 stage = PROCESS_CBW;
@@ -604,6 +656,7 @@ void USBMSD::CBWDecode(uint8_t * buf, uint16_t size) {
                     }
                     default:
                         iprintf("MSD: Unhandled SCSI CBW 0x%02X\n", cbw.CB[0]);
+                        setSense(SENSE_ILLEGAL_REQUEST, ASC_INVALID_OPCODE);
                         fail();
                         break;
                 }
@@ -628,10 +681,16 @@ void USBMSD::testUnitReady (void) {
         }
     }
 
-    if (BlockCount > 0)
-        csw.Status = CSW_PASSED;
-    else
+    if (BlockCount == 0) {
         csw.Status = CSW_ERROR;
+    } else if (media_changed) {
+        // the host asks for the sense, and then reads the card and whether it is write protected again
+        media_changed = false;
+        setSense(SENSE_UNIT_ATTENTION, ASC_MEDIUM_CHANGED);
+        csw.Status = CSW_FAILED;
+    } else {
+        csw.Status = CSW_PASSED;
+    }
 
     sendCSW();
 }
@@ -647,17 +706,25 @@ void USBMSD::memoryRead (void) {
         stage = ERROR;
     }
 
-    // we read an entire block
-    if (addr_in_block == 0)
+    // we read as many of the blocks still to send as the cache holds in one go
+    if (addr_in_block == 0 && (lba < cache_lba || lba >= cache_lba + cache_count))
     {
-        iprintf("MSD:LBA %lu:", lba);
-        disk->disk_read((char *)page, lba);
+        uint32_t count = length / BlockSize;
+        if (count > cache_blocks) count = cache_blocks;
+        if (count == 0) count = 1;
+        iprintf("MSD:LBA %lu+%lu:", lba, count);
+        cache_lba = lba;
+        cache_count = count;
+        if (disk->disk_read_blocks((char *)cache, lba, count) != 0) {
+            cache_count = 0;
+            stage = ERROR;
+        }
     }
 
     iprintf(" %u", addr_in_block / MAX_PACKET_SIZE_EPBULK);
 
     // write data which are in RAM
-    usb->writeNB(MSC_BulkIn.bEndpointAddress, &page[addr_in_block], n, MAX_PACKET_SIZE_EPBULK);
+    usb->writeNB(MSC_BulkIn.bEndpointAddress, &cache[(lba - cache_lba) * BlockSize + addr_in_block], n, MAX_PACKET_SIZE_EPBULK);
 
     addr_in_block += n;
 
@@ -726,6 +793,8 @@ bool USBMSD::infoTransfer (void) {
     }
 
     addr_in_block = 0;
+    // what is on the disk may have changed since the last command, it is written from the board as well
+    cache_count = 0;
 
 //     iprintf("MSD:transferring %lu blocks from LBA %lu.\n", blocks, lba);
 
@@ -734,7 +803,47 @@ bool USBMSD::infoTransfer (void) {
 
 void USBMSD::on_module_loaded()
 {
+    read_only = false;
+    media_changed = false;
+    host_written = false;
+    setSense(SENSE_ILLEGAL_REQUEST, ASC_INVALID_FIELD);
+
     connect();
+
+    read_only_while_playing = THEKERNEL->config->value(read_only_while_playing_checksum)->by_default(true)->as_bool();
+    register_for_event(ON_GET_PUBLIC_DATA);
+    register_for_event(ON_SET_PUBLIC_DATA);
+}
+
+void USBMSD::on_get_public_data(void *argument)
+{
+    PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
+    if (!pdr->starts_with(msd_checksum) || !pdr->second_element_is(host_written_checksum)) return;
+
+    static bool written;
+    written = host_written;
+    pdr->set_data_ptr(&written);
+    pdr->set_taken();
+}
+
+void USBMSD::on_set_public_data(void *argument)
+{
+    PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
+    if (!pdr->starts_with(msd_checksum)) return;
+
+    if (pdr->second_element_is(host_written_checksum)) {
+        host_written = false;
+        pdr->set_taken();
+
+    } else if (pdr->second_element_is(read_only_checksum)) {
+        // the file the player is reading could otherwise be changed or moved by the host under it
+        bool ro = read_only_while_playing && *static_cast<bool *>(pdr->get_data_ptr());
+        if (ro != read_only) {
+            read_only = ro;
+            media_changed = true;
+        }
+        pdr->set_taken();
+    }
 }
 
 bool USBMSD::USBEvent_busReset(void)
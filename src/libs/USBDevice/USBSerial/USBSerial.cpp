@@ -18,19 +18,40 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <cmath>
 
 #include "USBSerial.h"
 
 #include "libs/Kernel.h"
 #include "libs/SerialMessage.h"
 #include "StreamOutputPool.h"
+#include "Robot.h"
+#include "Planner.h"
+#include "Conveyor.h"
+#include "StepTicker.h"
+#include "Gcode.h"
+#include "GcodeDispatch.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "us_ticker_api.h"
+#include "PublicData.h"
+#include "TemperatureControlPublicAccess.h"
+#include "PlayerPublicAccess.h"
+
+#define usb_tx_policy_checksum                CHECKSUM("usb_tx_policy")
+#define usb_tx_timeout_ms_checksum            CHECKSUM("usb_tx_timeout_ms")
+#define second_usb_tx_policy_checksum         CHECKSUM("second_usb_tx_policy")
+#define second_usb_tx_timeout_ms_checksum     CHECKSUM("second_usb_tx_timeout_ms")
+#define second_usb_serial_monitor_checksum    CHECKSUM("second_usb_serial_monitor")
 
 // extern void setled(int, bool);
 #define setled(a, b) do {} while (0)
 
 #define iprintf(...) do { } while (0)
 
-USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256 + 8), txbuf(128 + 8)
+USBSerial::USBSerial(USB *u): USBCDC(u)
 {
     usb = u;
     nl_in_rx = 0;
@@ -39,22 +60,88 @@ USBSerial::USBSerial(USB *u): USBCDC(u), rxbuf(256 + 8), txbuf(128 + 8)
     halt_flag = false;
     query_flag = false;
     last_char_was_dollar = false;
+    at_line_start = true;
+    resend_requested = false;
+    planned = false;
+    raw = false;
+    lines_received = lines_done = 0;
+    frame_need = 0;
+    next_seq = 0;
+    pending_len = 0;
+    tx_policy = TX_BLOCK;
+    tx_timeout_us = 0;
+    tx_dropped = tx_dropped_reported = 0;
+    tx_stalled = false;
+    monitor = false;
 }
 
-void USBSerial::ensure_tx_space(int space)
+// letters set by the bits of a binary frame mask
+static const char binary_letters[8] = {'X', 'Y', 'Z', 'E', 'A', 'B', 'F', 'S'};
+
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+// returns false if the output has to be dropped, a host that does not read must not hold up the main loop
+bool USBSerial::ensure_tx_space(int space)
 {
-    while (txbuf.free() < space) {
+    if (tx_stalled) {
+        // once it has timed out it does not wait again until the host has taken a good part of what is queued
+        if (txbuf.free() < txbuf.max_size() / 2)
+            return false;
+        tx_stalled = false;
+    }
+    if (txbuf.free() >= (size_t)space)
+        return true;
+
+    switch (tx_policy) {
+        case TX_DROP_NEWEST:
+            return false;
+
+        case TX_DROP_OLDEST: {
+            // the USB interrupt is the consumer, it can not be sending from the part thrown away
+            __disable_irq();
+            size_t n = space - txbuf.free();
+            if (n > txbuf.size()) n = txbuf.size();
+            txbuf.consume(n);
+            tx_dropped += n;
+            __enable_irq();
+            return txbuf.free() >= (size_t)space;
+        }
+
+        case TX_BLOCK:
+            break;
+    }
+
+    uint32_t start = us_ticker_read();
+    while (txbuf.free() < (size_t)space) {
+        if (tx_timeout_us > 0 && us_ticker_read() - start >= tx_timeout_us) {
+            tx_stalled = true;
+            return false;
+        }
         usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
         usb->usbisr();
     }
+    return true;
 }
 
 int USBSerial::_putc(int c)
 {
     if (!attached)
         return 1;
-    ensure_tx_space(1);
-    txbuf.queue(c);
+    if (!ensure_tx_space(1)) {
+        tx_dropped++;
+        return 1;
+    }
+    txbuf.push(c);
 
     usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
     return 1;
@@ -65,8 +152,8 @@ int USBSerial::_getc()
     if (!attached)
         return 0;
     uint8_t c = 0;
-    setled(4, 1); while (rxbuf.isEmpty()); setled(4, 0);
-    rxbuf.dequeue(&c);
+    setled(4, 1); while (rxbuf.empty()); setled(4, 0);
+    rxbuf.pop(c);
     if (rxbuf.free() == MAX_PACKET_SIZE_EPBULK) {
         usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
         iprintf("rxbuf has room for another packet, interrupt enabled\n");
@@ -87,19 +174,22 @@ int USBSerial::_getc()
 
 int USBSerial::puts(const char *str)
 {
+    int n = strlen(str);
     if (!attached)
-        return strlen(str);
+        return n;
     int i = 0;
-    while (*str) {
-        ensure_tx_space(1);
-        txbuf.queue(*str);
-        if ((txbuf.available() % 64) == 0)
-            usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-        i++;
-        str++;
+    while (i < n) {
+        if (!ensure_tx_space(1)) {
+            tx_dropped += n - i;
+            break;
+        }
+        // as much as fits, a packet at a time so the host gets it while the rest goes in
+        size_t k = n - i;
+        if (k > MAX_PACKET_SIZE_EPBULK) k = MAX_PACKET_SIZE_EPBULK;
+        i += txbuf.push((const uint8_t *)str + i, k);
+        usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
     }
-    usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
-    return i;
+    return n;
 }
 
 uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
@@ -110,9 +200,7 @@ uint16_t USBSerial::writeBlock(const uint8_t * buf, uint16_t size)
         size = txbuf.free();
     }
     if (size > 0) {
-        for (uint8_t i = 0; i < size; i++) {
-            txbuf.queue(buf[i]);
-        }
+        txbuf.push(buf, size);
         usb->endpointSetInterrupt(CDC_BulkIn.bEndpointAddress, true);
     }
     return size;
@@ -133,21 +221,18 @@ bool USBSerial::USBEvent_EPIn(uint8_t bEP, uint8_t bEPStatus)
 
     iprintf("USBSerial:EpIn: 0x%02X\n", bEPStatus);
 
-    uint8_t b[MAX_PACKET_SIZE_EPBULK];
-
-    int l = txbuf.available();
+    // sent straight out of txbuf, a packet is cut short where the buffer wraps and the rest goes in the next one
+    const uint8_t *b;
+    int l = txbuf.read_span(b);
     if (l > 0) {
         // Use MAX_PACKET_SIZE_EPBULK-1 below instead of MAX_PACKET_SIZE_EPBULK
         // to work around a problem sending packets that are exactly MAX_PACKET_SIZE_EPBULK
         // bytes in length. The problem is that these packets don't flush properly.
         if (l > MAX_PACKET_SIZE_EPBULK-1)
             l = MAX_PACKET_SIZE_EPBULK-1;
-        int i;
-        for (i = 0; i < l; i++) {
-            txbuf.dequeue(&b[i]);
-        }
-        send(b, l);
-        if (txbuf.available() == 0)
+        send((uint8_t *)b, l);
+        txbuf.consume(l);
+        if (txbuf.empty())
             r = false;
     } else {
         r = false;
@@ -168,7 +253,21 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     if (bEP != CDC_BulkOut.bEndpointAddress)
         return false;
 
-    if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK) {
+    // a packet held back earlier must go in before anything newer
+    if (pending_len > 0) {
+        if (!has_room(pending_len))
+            return false;
+        receive_packet(pending, pending_len);
+        pending_len = 0;
+    }
+
+    if (!has_room(MAX_PACKET_SIZE_EPBULK)) {
+        // no room, but take the packet out of the endpoint anyway and hold it, so the hardware has both its
+        // buffers free to keep accepting from the host while the main loop catches up
+        uint32_t size = MAX_PACKET_SIZE_EPBULK;
+        readEP(pending, &size);
+        pending_len = size;
+        usb->readStart(CDC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
 //         usb->endpointSetInterrupt(bEP, false);
         return false;
     }
@@ -179,98 +278,341 @@ bool USBSerial::USBEvent_EPOut(uint8_t bEP, uint8_t bEPStatus)
     //we read the packet received and put it on the circular buffer
     readEP(c, &size);
     iprintf("Read %ld bytes:\n\t", size);
-    for (uint8_t i = 0; i < size; i++) {
+    receive_packet(c, size);
+    iprintf("\nQueued, %d empty\n", rxbuf.free());
+
+    if (frames.free() < 7) {
+        // no room for the frames another packet may hold, stall until the main loop has used some
+        r = false;
+
+    } else if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK) {
+        // if buffer is full, stall endpoint, do not accept more data
+        r = false;
+    }
+
+    usb->readStart(CDC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
+    iprintf("USBSerial:EpOut Complete\n");
+    return r;
+}
+
+// a packet can hold up to 6 frames as each has at least one value
+bool USBSerial::has_room(uint16_t n)
+{
+    return rxbuf.free() >= n && frames.free() >= 7;
+}
+
+// put a received packet into rxbuf, runs of ordinary characters are copied in one go and the characters that
+// need handling on arrival break the runs
+void USBSerial::receive_packet(const uint8_t *c, uint32_t size)
+{
+    if (raw) {
+        queue_run(c, 0, size);
+        return;
+    }
+
+    uint32_t run = 0; // start of the characters not queued yet
+    for (uint32_t i = 0; i < size; i++) {
+
+        // bytes of a binary frame are not interpreted as characters
+        if(frame_need > 0 || (c[i] == USBSERIAL_BINARY_SYNC && at_line_start && !flush_to_nl)) {
+            queue_run(c, run, i);
+            run = i + 1;
+            receive_binary(c[i]);
+            continue;
+        }
 
         // handle backspace and delete by deleting the last character in the buffer if there is one
         if(c[i] == 0x08 || c[i] == 0x7F) {
-            if(!rxbuf.isEmpty()) rxbuf.pop();
+            queue_run(c, run, i);
+            run = i + 1;
+            rxbuf.unpush();
             continue;
         }
 
         if(c[i] == 'X' - 'A' + 1) { // ^X
+            queue_run(c, run, i);
+            run = i + 1;
             //THEKERNEL->set_feed_hold(false); // required to free stuff up
             halt_flag = true;
             continue;
         }
 
         if(c[i] == '?') { // ?
+            queue_run(c, run, i);
+            run = i + 1;
             query_flag = true;
             continue;
         }
 
+        if(c[i] == 0x85) { // jog cancel
+            queue_run(c, run, i);
+            run = i + 1;
+            THEROBOT->cancel_jog();
+            continue;
+        }
+
         if(THEKERNEL->is_grbl_mode() || THEKERNEL->is_feed_hold_enabled()) {
             if(c[i] == '!') { // safe pause
+                queue_run(c, run, i);
+                run = i + 1;
                 THEKERNEL->set_feed_hold(true);
                 continue;
             }
 
             if(c[i] == '~') { // safe resume
+                queue_run(c, run, i);
+                run = i + 1;
                 THEKERNEL->set_feed_hold(false);
                 continue;
             }
         }
 
         last_char_was_dollar = (c[i] == '$');
+        at_line_start = (c[i] == '\n' || c[i] == '\r');
 
-        if (flush_to_nl == false)
-            rxbuf.queue(c[i]);
+        if (flush_to_nl) {
+            // discarding the tail of a line that was too long, up to and including its newline
+            run = i + 1;
+            if (at_line_start)
+                flush_to_nl = false;
+            continue;
+        }
 
-        // if (c[i] >= 32 && c[i] < 128)
-        // {
-        //     iprintf("%c", c[i]);
-        // }
-        // else
-        // {
-        //     iprintf("\\x%02X", c[i]);
-        // }
+        if (at_line_start) {
+            nl_in_rx++;
+            lines_received++;
+        }
+    }
+    queue_run(c, run, size);
 
-        if (c[i] == '\n' || c[i] == '\r') {
-            if (flush_to_nl)
-                flush_to_nl = false;
-            else
-                nl_in_rx++;
-        } else if (rxbuf.isFull() && (nl_in_rx == 0)) {
-            // to avoid a deadlock with very long lines, we must dump the buffer
-            // and continue flushing to the next newline
-            rxbuf.flush();
-            flush_to_nl = true;
+    if ((rxbuf.free() < MAX_PACKET_SIZE_EPBULK) && (nl_in_rx == 0)) {
+        // to avoid a deadlock with very long lines, we must dump the buffer
+        // and continue flushing to the next newline, and since our buffer is empty we can accept more data
+        rxbuf.flush();
+        flush_to_nl = true;
+    }
+}
+
+void USBSerial::queue_run(const uint8_t *c, uint32_t from, uint32_t to)
+{
+    if (to > from)
+        rxbuf.push(&c[from], to - from);
+}
+
+// called in main loop context, anything received before is discarded, the host should wait for a reply to the
+// command that starts a binary transfer before it sends
+bool USBSerial::set_raw(bool on)
+{
+    __disable_irq();
+    if (on) flush_rx();
+    raw = on;
+    __enable_irq();
+    usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+    return true;
+}
+
+int USBSerial::read_raw(uint8_t *buf, int len)
+{
+    if (!attached)
+        return 0;
+    drain_pending();
+    int n = rxbuf.pop(buf, len);
+    if (n > 0 && rxbuf.free() >= MAX_PACKET_SIZE_EPBULK)
+        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+    return n;
+}
+
+// called in main loop context, a held back packet goes in as soon as there is room for it
+void USBSerial::drain_pending()
+{
+    if (pending_len == 0)
+        return;
+
+    __disable_irq();
+    bool done = false;
+    if (pending_len > 0 && has_room(pending_len)) {
+        receive_packet(pending, pending_len);
+        pending_len = 0;
+        done = true;
+    }
+    __enable_irq();
+
+    if (done)
+        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+}
+
+// called in ISR context for every byte of a binary frame including the sync byte
+void USBSerial::receive_binary(uint8_t c)
+{
+    if(frame_need == 0) {
+        // sync, the header comes next
+        frame.len = 0;
+        frame_need = 3;
+        return;
+    }
+
+    frame.data[frame.len++] = c;
+    if(frame.len == 3) {
+        // now the mask is known so is the size of the frame
+        frame_need = 3 + (frame.data[1] == 2 ? USBSERIAL_PLANNED_SIZE : 0) + 4 * __builtin_popcount(frame.data[2]) + 2;
+    }
+
+    if(frame.len == frame_need) {
+        frame_need = 0;
+        frame.line = lines_received;
+        // if there is no room it is dropped and the sequence gap asks for a resend
+        frames.push(frame);
+    }
+}
+
+// called in main loop context to run a frame once all the lines received before it have been
+void USBSerial::process_frame(const BinaryFrame& f)
+{
+    uint8_t seq = f.data[0];
+    uint16_t crc = f.data[f.len - 2] | (f.data[f.len - 1] << 8);
+
+    if(seq != next_seq || crc != crc16(f.data, f.len - 2) || f.data[1] > 4 || (f.data[1] <= 1 && f.data[2] == 0)) {
+        // ask once for everything from the frame we wanted, and drop all frames until it arrives
+        if(!resend_requested) {
+            printf("rs b%u\r\n", next_seq);
+            resend_requested = true;
         }
+        return;
     }
-    iprintf("\nQueued, %d empty\n", rxbuf.free());
+    resend_requested = false;
+    next_seq++;
 
-    if (rxbuf.free() < MAX_PACKET_SIZE_EPBULK) {
-        // if buffer is full, stall endpoint, do not accept more data
-        r = false;
+    if(THEKERNEL->is_halted()) {
+        // we ignore all commands until M999 just like text ones
+        puts(THEKERNEL->is_grbl_mode() ? "error:Alarm lock\n" : "!!\r\n");
+        return;
+    }
 
-        if (nl_in_rx == 0) {
-            // we have to check for long line deadlock here too
-            flush_to_nl = true;
-            rxbuf.flush();
+    if(f.data[1] >= 2) {
+        process_planned(f);
+        return;
+    }
 
-            // and since our buffer is empty, we can accept more data
-            r = true;
+    Gcode gcode(f.data[1] == 0 ? "G0" : "G1", this);
+    const uint8_t *p = &f.data[3];
+    for (int i = 0; i < 8; i++) {
+        if(f.data[2] & (1 << i)) {
+            float v;
+            memcpy(&v, p, sizeof(v));
+            p += sizeof(v);
+            gcode.set_value(binary_letters[i], v);
         }
     }
 
-    usb->readStart(CDC_BulkOut.bEndpointAddress, MAX_PACKET_SIZE_EPBULK);
-    iprintf("USBSerial:EpOut Complete\n");
-    return r;
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode);
+
+    if(gcode.is_error) {
+        printf("%s%s\r\nEntering Alarm/Halt state\n", THEKERNEL->is_grbl_mode() ? "error:" : "Error: ",
+               gcode.txt_after_ok.empty() ? "unknown" : gcode.txt_after_ok.c_str());
+        THEKERNEL->call_event(ON_HALT, nullptr);
+    } else {
+        THEKERNEL->gcode_dispatch->send_ok(this);
+    }
+}
+
+// called in main loop context for the host planning frames, once their sequence and crc have been checked
+void USBSerial::process_planned(const BinaryFrame& f)
+{
+    uint8_t mask = f.data[2];
+    const uint8_t *p = &f.data[3];
+    const char *error = nullptr;
+
+    if(f.data[1] == 3) {
+        float frequency;
+        memcpy(&frequency, p, sizeof(frequency));
+        if(mask != 1) error = "Bad planned begin";
+        else if(fabsf(frequency - THEKERNEL->step_ticker->get_frequency()) > 0.5F) error = "Blocks were planned for a different step frequency";
+        else planned = true;
+
+    } else if(f.data[1] == 4) {
+        if(planned) {
+            // the robot only knows where the motors were told to go by the planned blocks once they are done
+            THECONVEYOR->wait_for_idle();
+            THEROBOT->reset_position_from_current_actuator_position();
+        }
+        planned = false;
+
+    } else if(!planned) {
+        error = "Planned block without a begin";
+
+    } else {
+        Planner::planned_block_t b;
+        memcpy(&b.accelerate_until, p, 4);
+        memcpy(&b.decelerate_after, p + 4, 4);
+        memcpy(&b.total_move_ticks, p + 8, 4);
+        memcpy(&b.initial_rate, p + 12, 4);
+        memcpy(&b.maximum_rate, p + 16, 4);
+        memcpy(&b.final_rate, p + 20, 4);
+        memcpy(&b.millimeters, p + 24, 4);
+        memcpy(&b.nominal_speed, p + 28, 4);
+        memcpy(&b.acceleration, p + 32, 4);
+        memcpy(&b.s_value, p + 36, 4);
+        b.g123 = p[40] & 1;
+        p += USBSERIAL_PLANNED_SIZE;
+
+        uint8_t n_motors = THEROBOT->get_number_registered_motors();
+        for (uint8_t m = 0; m < k_max_actuators; m++) {
+            b.steps[m] = 0;
+            if(!(mask & (1 << m))) continue;
+            memcpy(&b.steps[m], p, 4);
+            p += 4;
+        }
+        if((mask >> n_motors) != 0) error = "Planned block for a motor we do not have";
+        else if(!THEKERNEL->planner->append_planned_block(b, n_motors)) error = "Bad planned block";
+    }
+
+    if(error != nullptr) {
+        planned = false;
+        printf("%s%s\r\nEntering Alarm/Halt state\n", THEKERNEL->is_grbl_mode() ? "error:" : "Error: ", error);
+        THEKERNEL->call_event(ON_HALT, nullptr);
+    } else {
+        THEKERNEL->gcode_dispatch->send_ok(this);
+    }
+}
+
+// discard everything received, text lines and binary frames
+void USBSerial::flush_rx()
+{
+    rxbuf.flush();
+    nl_in_rx = 0;
+    frames.flush();
+    frame_need = 0;
+    planned = false;
+    pending_len = 0;
+    lines_done = lines_received;
+    at_line_start = true;
 }
 
-uint8_t USBSerial::available()
+uint16_t USBSerial::available()
 {
-    return rxbuf.available();
+    return rxbuf.size();
 }
 
 bool USBSerial::ready()
 {
-    return rxbuf.available();
+    return !rxbuf.empty();
 }
 
 void USBSerial::on_module_loaded()
 {
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_IDLE);
+    // the first one loaded is the usb serial port, the next the second one
+    static uint8_t loaded = 0;
+    bool second = loaded++ > 0;
+
+    // block waits for the host to read for up to the timeout, then drops output until it does, 0 waits for ever
+    std::string policy = THEKERNEL->config->value(second ? second_usb_tx_policy_checksum : usb_tx_policy_checksum)->by_default("block")->as_string();
+    tx_policy = policy == "drop_oldest" ? TX_DROP_OLDEST : policy == "drop_newest" ? TX_DROP_NEWEST : TX_BLOCK;
+    tx_timeout_us = THEKERNEL->config->value(second ? second_usb_tx_timeout_ms_checksum : usb_tx_timeout_ms_checksum)->by_default(100)->as_number() * 1000;
+    // a port for a panel or monitor that keeps answering while the other one streams a job
+    monitor = second && THEKERNEL->config->value(second_usb_serial_monitor_checksum)->by_default(false)->as_bool();
+
+    this->register_for_event(ON_MAIN_LOOP, PRIORITY_HIGH);
+    this->register_for_event(ON_IDLE, PRIORITY_HIGH);
 }
 
 void USBSerial::on_idle(void *argument)
@@ -283,15 +625,82 @@ void USBSerial::on_idle(void *argument)
         } else {
             puts("HALTED, M999 or $X to exit HALT state\r\n");
         }
-        rxbuf.flush(); // flush the recieve buffer, hopefully upstream has stopped sending
-        nl_in_rx = 0;
+        flush_rx(); // flush the recieve buffer, hopefully upstream has stopped sending
     }
 
     if(query_flag) {
         query_flag = false;
-        puts(THEKERNEL->get_query_string().c_str());
+        puts(THEKERNEL->get_status_snapshot());
+    }
+
+    // say what was lost once the host is reading again
+    if(tx_dropped != tx_dropped_reported && txbuf.free() >= txbuf.max_size() / 2) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "// %lu characters of output dropped\r\n", tx_dropped - tx_dropped_reported);
+        tx_dropped_reported = tx_dropped;
+        puts(buf);
+    }
+
+    if(monitor && attached) read_monitor_lines();
+}
+
+// the monitor port's lines are read here, idle is called while the main loop waits for room in the planner so a query is
+// not held up behind whatever the other port is streaming. A line that is not a query is kept for on_main_loop(), the
+// lines after it wait until it has been run
+void USBSerial::read_monitor_lines()
+{
+    while (monitor_held.empty() && nl_in_rx > 0) {
+        std::string line;
+        while (available()) {
+            char c = _getc();
+            if(c == '\n' || c == '\r') break;
+            line += c;
+        }
+        lines_done++;
+        if(!answer_query(line)) monitor_held.swap(line);
+    }
+}
+
+static bool is_query(const std::string& line, const char *cmd)
+{
+    size_t n = strlen(cmd);
+    return line.compare(0, n, cmd) == 0 && (line.size() == n || line[n] == ' ');
+}
+
+// M105 and progress are answered from what the temperature controls and the player have now, as they would be on the
+// other port but without going through the command handlers, ? is a realtime character answered from the status snapshot
+bool USBSerial::answer_query(const std::string& line)
+{
+    if(line.empty()) return true;
+
+    if(is_query(line, "M105")) {
+        std::vector<struct pad_temperature> controllers;
+        std::string s("ok");
+        if(PublicData::get_value(temperature_control_checksum, poll_controls_checksum, &controllers)) {
+            char buf[32];
+            for (auto &c : controllers) {
+                size_t n = snprintf(buf, sizeof(buf), " %s:%3.1f /%3.1f @%d", c.designator.c_str(), c.current_temperature, c.target_temperature <= 0 ? 0.0F : c.target_temperature, c.pwm);
+                s.append(buf, std::min(n, sizeof(buf) - 1));
+            }
+        }
+        s.append("\r\n");
+        puts(s.c_str());
+        return true;
+    }
+
+    if(is_query(line, "progress")) {
+        void *returned_data;
+        if(PublicData::get_value(player_checksum, get_progress_checksum, &returned_data)) {
+            const struct pad_progress *p = static_cast<const struct pad_progress *>(returned_data);
+            printf("file: %s, %u %% complete, elapsed time: %02lu:%02lu:%02lu\r\n", p->filename.c_str(), p->percent_complete,
+                p->elapsed_secs / 3600, (p->elapsed_secs % 3600) / 60, p->elapsed_secs % 60);
+        } else {
+            puts("Not currently playing\r\n");
+        }
+        return true;
     }
 
+    return false;
 }
 
 void USBSerial::on_main_loop(void *argument)
@@ -303,33 +712,59 @@ void USBSerial::on_main_loop(void *argument)
     if (attach != attached) {
         if (attach) {
             attached = true;
-            THEKERNEL->streams->append_stream(this);
+            if(!monitor) THEKERNEL->streams->append_stream(this);
+            tx_dropped = tx_dropped_reported = 0;
+            tx_stalled = false;
             puts("Smoothie\r\nok\r\n");
         } else {
             attached = false;
-            THEKERNEL->streams->remove_stream(this);
+            if(!monitor) THEKERNEL->streams->remove_stream(this);
             txbuf.flush();
-            rxbuf.flush();
-            nl_in_rx = 0;
+            flush_rx();
+            monitor_held.clear();
         }
     }
 
     // if we are in feed hold we do not process anything
     //if(THEKERNEL->get_feed_hold()) return;
 
+    // the next line waits until the last segmented move has been fed to the planner
+    if(THEROBOT->is_segmenting()) return;
+
+    drain_pending();
+
+    if (monitor) {
+        if(!monitor_held.empty()) {
+            struct SerialMessage message;
+            message.stream = this;
+            message.message = monitor_held;
+            monitor_held.clear();
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+        }
+        return;
+    }
+
+    if (!frames.empty() && frames.peek().line == lines_done) {
+        BinaryFrame f;
+        frames.pop(f);
+        // there may be room for another packet now
+        usb->endpointSetInterrupt(CDC_BulkOut.bEndpointAddress, true);
+        process_frame(f);
+        return;
+    }
+
     if (nl_in_rx) {
-        string received;
+        struct SerialMessage message;
+        message.stream = this;
         while (available()) {
             char c = _getc();
             if( c == '\n' || c == '\r') {
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
+                lines_done++;
                 iprintf("USBSerial Received: %s\n", message.message.c_str());
                 THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
                 return;
             } else {
-                received += c;
+                message.message += c;
             }
         }
     }
@@ -21,11 +21,28 @@
 
 #include "USBCDC.h"
 // #include "Stream.h"
-#include "CircBuffer.h"
+#include "SPSCQueue.h"
 
 #include "Module.h"
 #include "StreamOutput.h"
 
+#include <string>
+
+// Optional binary framing for G0/G1, a frame may only start at the beginning of a line and is
+// sync(0xA5) seq opcode mask value... crc16
+// opcode 0 is G0 and 1 is G1, bit n of mask says the nth of X Y Z E A B F S follows as a little endian float,
+// the crc is CRC-16/CCITT (0x1021, initial 0xFFFF) of seq through the last value, sent low byte first.
+// Each frame is answered with ok, or rs b<seq> to ask for everything from seq to be sent again.
+//
+// Host planning, blocks the host has planned itself (motionsim -p, see src/testframework/host) are queued as they are.
+// opcode 3 begins them, its mask is 1 and the value is the step frequency they were planned for, which must be ours.
+// opcode 2 is a block, after the mask are accelerate_until decelerate_after total_move_ticks as uint32, then
+// initial_rate maximum_rate final_rate millimeters nominal_speed acceleration s_value as floats and a flags byte
+// (bit 0 for G1/G2/G3), bit n of the mask then says the signed steps of motor n follow as an int32.
+// opcode 4 with mask 0 ends them, once they are done the robot takes its position from where the motors got to.
+#define USBSERIAL_BINARY_SYNC 0xA5
+#define USBSERIAL_PLANNED_SIZE (3 * 4 + 7 * 4 + 1) // the fixed part of a planned block
+
 class USBSerial_Receiver {
 protected:
     virtual bool SerialEvent_RX(void) = 0;
@@ -39,13 +56,20 @@ public:
     int _getc();
     int puts(const char *);
 
-    uint8_t available();
+    uint16_t available();
     bool ready();
+    int rx_space() { return rxbuf.free(); }
+    bool set_raw(bool on);
+    int read_raw(uint8_t *buf, int len);
 
     uint16_t writeBlock(const uint8_t * buf, uint16_t size);
 
-    CircBuffer<uint8_t> rxbuf;
-    CircBuffer<uint8_t> txbuf;
+    SPSCQueue<uint8_t, 1024> rxbuf;
+    SPSCQueue<uint8_t, 512> txbuf;
+
+    // what happens to output when the host stops reading and txbuf is full
+    enum TX_POLICY { TX_BLOCK, TX_DROP_OLDEST, TX_DROP_NEWEST };
+    uint32_t get_tx_dropped() const { return tx_dropped; }
 
     void on_module_loaded(void);
     void on_main_loop(void *);
@@ -61,12 +85,50 @@ protected:
     virtual void on_attach(void);
     virtual void on_detach(void);
 
-    void ensure_tx_space(int);
+    bool ensure_tx_space(int);
+
+    // the most a frame can be, seq, opcode, mask, a planned block with 8 motors and the crc
+    static const uint8_t max_frame_size= 3 + USBSERIAL_PLANNED_SIZE + 8 * 4 + 2;
+    struct BinaryFrame {
+        uint32_t line; // lines received before this frame, so it is run in order with them
+        uint8_t len;
+        uint8_t data[max_frame_size];
+    };
+    void receive_binary(uint8_t c);
+    void process_frame(const BinaryFrame& f);
+    void process_planned(const BinaryFrame& f);
+    void flush_rx();
+    bool has_room(uint16_t n);
+    void receive_packet(const uint8_t *c, uint32_t size);
+    void queue_run(const uint8_t *c, uint32_t from, uint32_t to);
+    void drain_pending();
+    void read_monitor_lines();
+    bool answer_query(const std::string& line);
+
+    // a packet taken out of the endpoint when rxbuf had no room for it, it goes in before any later packet
+    uint8_t pending[MAX_PACKET_SIZE_EPBULK];
+    volatile uint8_t pending_len;
+
+    // frames are decoded in the ISR and run from the main loop
+    SPSCQueue<BinaryFrame, 16> frames;
+    BinaryFrame frame;
+    volatile uint32_t lines_received;
+    uint32_t lines_done;
+    uint8_t frame_need; // bytes of the current frame still wanted, 0 when not in a frame
+    uint8_t next_seq;
 
     // keep track of number of newlines in the buffer
     // this makes it trivial to detect if there's a new line available
     volatile int nl_in_rx;
 
+    TX_POLICY tx_policy;
+    uint32_t tx_timeout_us;   // how long TX_BLOCK waits for room before it drops output
+    uint32_t tx_dropped;      // characters dropped since attach
+    uint32_t tx_dropped_reported;
+
+    // a line the monitor port can not answer itself, run from the main loop as it would be on any other port
+    std::string monitor_held;
+
 
     volatile struct {
         volatile bool attach:1;
@@ -80,6 +142,12 @@ protected:
         // flushing until we find a newline.
         // this flag asserts when we are doing this
         bool flush_to_nl:1;
+        bool at_line_start:1;
+        bool resend_requested:1;
+        bool planned:1; // between the begin and end of blocks planned by the host
+        bool raw:1; // received bytes go into rxbuf as they are for read_raw
+        bool tx_stalled:1; // TX_BLOCK timed out, output is dropped without waiting until the host reads again
+        bool monitor:1; // the second port answers queries from idle and gets none of the output broadcast to all
     };
 
 private:
@@ -1,27 +1,38 @@
 #ifndef _VECTOR3_H
 #define _VECTOR3_H
 
+#include <math.h>
+
+// all inline so the kinematics and levelling math compiles down to the float operations with no calls or copies
 class Vector3
 {
 public:
     Vector3() = default;
-    Vector3(float a, float b, float c) : elem{a,b,c} {}
+    constexpr Vector3(float a, float b, float c) : elem{a,b,c} {}
     Vector3(const Vector3& to_copy) = default;
+    Vector3& operator=(const Vector3& to_copy) = default;
+
+    constexpr float operator[](int i) const { return (i >= 0 && i <= 2) ? elem[i] : NAN; }
 
-    float    operator[](int) const;
-    Vector3  cross(const Vector3&) const;
+    constexpr Vector3 cross(const Vector3& v) const
+    {
+        return Vector3(elem[1] * v.elem[2] - elem[2] * v.elem[1],
+                       elem[2] * v.elem[0] - elem[0] * v.elem[2],
+                       elem[0] * v.elem[1] - elem[1] * v.elem[0]);
+    }
 
-    float    dot(const Vector3&) const;
+    constexpr float dot(const Vector3& v) const { return elem[0] * v.elem[0] + elem[1] * v.elem[1] + elem[2] * v.elem[2]; }
 
-    float    magsq() const;
-    float    mag() const;
+    constexpr float magsq() const { return dot(*this); }
+    float mag() const { return sqrtf(magsq()); }
 
-    Vector3  add(const Vector3&) const;
-    Vector3  sub(const Vector3&) const;
+    constexpr Vector3 add(const Vector3& v) const { return Vector3(elem[0] + v.elem[0], elem[1] + v.elem[1], elem[2] + v.elem[2]); }
+    constexpr Vector3 sub(const Vector3& v) const { return Vector3(elem[0] - v.elem[0], elem[1] - v.elem[1], elem[2] - v.elem[2]); }
 
-    Vector3  mul(float) const;
+    constexpr Vector3 mul(float s) const { return Vector3(elem[0] * s, elem[1] * s, elem[2] * s); }
 
-    Vector3  unit(void) const;
+    // one divide for the three elements
+    Vector3 unit(void) const { return mul(1.0F / mag()); }
 
     float      * data()       { return elem; }
     float const* data() const { return elem; }
@@ -29,12 +40,4 @@ private:
     float  elem[3]{};
 };
 
-// typedef float Vector3[3];
-
-// float* cross_product(Vector3 vec1, Vector3 vec2, Vector3 out);
-// float dot_product(Vector3 vec1, Vector3 vec2);
-// float magsq(Vector3 vec);
-// float* vecsub(Vector3 vec1, Vector3 vec2, Vector3 out)
-// float* scalar_mul(Vector3 vec, float scalar, Vector3 out)
-
 #endif /* _VECTOR3_H */
@@ -30,7 +30,7 @@ void Watchdog::feed()
 
 void Watchdog::on_module_loaded()
 {
-    register_for_event(ON_IDLE);
+    register_for_event(ON_IDLE, PRIORITY_HIGH);
     feed();
 }
 
@@ -15,7 +15,8 @@ class Watchdog : public Module
 {
 public:
     Watchdog(uint32_t timeout, WDT_ACTION action);
-    void feed();
+    // harmless when the watchdog was never started
+    static void feed();
 
     void on_module_loaded();
     void on_idle(void*);
@@ -0,0 +1,58 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "WriteBehind.h"
+#include "Kernel.h"
+#include "StreamOutputPool.h"
+
+#include <stdio.h>
+
+std::vector<WriteBehind::file_t> WriteBehind::files;
+
+void WriteBehind::queue(const char *filename, std::string &&data)
+{
+    for(auto &f : files) {
+        if(f.name == filename) {
+            f.data= std::move(data);
+            return;
+        }
+    }
+    files.push_back({filename, std::move(data)});
+}
+
+// with stdio buffering off the whole file goes to f_write in one call, so it is written in as few sector transfers as it can be
+bool WriteBehind::write(const file_t &f)
+{
+    // this truncates the existing file, removing it first seems to cause a hang every now and then
+    FILE *fp= fopen(f.name.c_str(), "w");
+    bool ok= fp != nullptr;
+    if(ok) {
+        setvbuf(fp, nullptr, _IONBF, 0);
+        if(fwrite(f.data.data(), 1, f.data.size(), fp) != f.data.size()) ok= false;
+        if(fclose(fp) != 0) ok= false;
+    }
+    // whoever queued it has had its reply long ago
+    if(!ok) THEKERNEL->streams->printf("error:Failed to write %s\n", f.name.c_str());
+    return ok;
+}
+
+void WriteBehind::write_pending()
+{
+    if(files.empty()) return;
+    write(files.front());
+    files.erase(files.begin());
+}
+
+bool WriteBehind::sync()
+{
+    bool ok= true;
+    for(auto &f : files) {
+        if(!write(f)) ok= false;
+    }
+    files.clear();
+    return ok;
+}
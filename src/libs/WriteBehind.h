@@ -0,0 +1,35 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Files that are made whole in RAM, like the config-override and the saved grids, are handed over here and written
+// later from idle, each in a single unbuffered write, so the command that made one does not wait on the card.
+// A file queued again before it has been written just replaces what was waiting. Anything that reads one of these
+// files back, or is about to reset, needs to sync() first.
+class WriteBehind {
+    public:
+        // replaces the contents of filename with data, which is taken over
+        static void queue(const char *filename, std::string &&data);
+        // writes the oldest file waiting, called from idle
+        static void write_pending();
+        // writes everything waiting now, returns false if any of them failed
+        static bool sync();
+        static bool is_pending() { return !files.empty(); }
+
+    private:
+        struct file_t {
+            std::string name;
+            std::string data;
+        };
+        static bool write(const file_t &f);
+
+        static std::vector<file_t> files;
+};
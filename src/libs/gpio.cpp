@@ -29,6 +29,9 @@ GPIO::GPIO(uint8_t port, uint8_t pin, uint8_t direction) {
 // GPIO::~GPIO() {}
 
 void GPIO::setup() {
+	gpio = (LPC_GPIO_TypeDef *)(LPC_GPIO0_BASE + port * (LPC_GPIO1_BASE - LPC_GPIO0_BASE));
+	mask = 1UL << pin;
+
 	PINSEL_CFG_Type PinCfg;
 	PinCfg.Funcnum = 0;
 	PinCfg.OpenDrain = PINSEL_PINMODE_NORMAL;
@@ -58,16 +61,8 @@ void GPIO::write(uint8_t value) {
 		clear();
 }
 
-void GPIO::set() {
-	FIO_SetValue(port, 1UL << pin);
-}
-
-void GPIO::clear() {
-	FIO_ClearValue(port, 1UL << pin);
-}
-
 uint8_t GPIO::get() {
-	return (FIO_ReadValue(port) & (1UL << pin))?255:0;
+	return (gpio->FIOPIN & mask)?255:0;
 }
 
 int GPIO::operator=(int value) {
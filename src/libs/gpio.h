@@ -7,6 +7,7 @@
 #define	GPIO_DIR_OUTPUT 1
 
 #include <PinNames.h>
+#include "LPC17xx.h"
 
 class GPIO {
 public:
@@ -21,11 +22,16 @@ public:
 	void output();
 	void input();
 	void write(uint8_t value);
-	void set();
-	void clear();
+	// a single store to the port found by setup()
+	inline void set() { gpio->FIOSET = mask; }
+	inline void clear() { gpio->FIOCLR = mask; }
 	uint8_t get();
 
     int operator=(int);
+
+private:
+    LPC_GPIO_TypeDef *gpio;
+    uint32_t mask;
 };
 
 #endif /* _GPIO_HPP */
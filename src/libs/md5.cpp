@@ -60,12 +60,12 @@ documentation and/or software.
 // F, G, H and I are basic MD5 functions.
 inline MD5::uint4 MD5::F(uint4 x, uint4 y, uint4 z)
 {
-    return ((x & y) | (~x & z));
+    return z ^ (x & (y ^ z));
 }
 
 inline MD5::uint4 MD5::G(uint4 x, uint4 y, uint4 z)
 {
-    return ((x & z) | (y&~z));
+    return y ^ (z & (x ^ y));
 }
 
 inline MD5::uint4 MD5::H(uint4 x, uint4 y, uint4 z)
@@ -145,9 +145,14 @@ void MD5::init()
 // decodes input (unsigned char) into output (uint4). Assumes len is a multiple of 4.
 void MD5::decode(uint4 output[], const uint1 input[], size_type len)
 {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // the words are already in the right order, memcpy copies a word at a time and handles an unaligned input
+    memcpy(output, input, len);
+#else
     for (unsigned int i = 0, j = 0; j < len; i++, j += 4)
         output[i] = ((uint4)input[j]) | (((uint4)input[j + 1]) << 8) |
                     (((uint4)input[j + 2]) << 16) | (((uint4)input[j + 3]) << 24);
+#endif
 }
 
 //////////////////////////////
@@ -249,8 +254,7 @@ void MD5::transform(const uint1 block[blocksize])
     state[2] += c;
     state[3] += d;
 
-    // Zeroize sensitive information.
-    memset(x, 0, sizeof x);
+    // x is not cleared here, it costs a pass over the block and this is only used to check files
 }
 
 //////////////////////////////
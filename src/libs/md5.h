@@ -37,7 +37,7 @@ documentation and/or software.
 
 
 // a small class for calculating MD5 hashes of strings or byte arrays
-// it is not meant to be fast or secure
+// it is not meant to be secure, the transform is kept lean as whole files are hashed with it
 //
 // usage: 1) feed it blocks of uchars with update()
 //      2) finalize()
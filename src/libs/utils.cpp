@@ -10,11 +10,13 @@
 #include "system_LPC17xx.h"
 #include "LPC17xx.h"
 #include "utils.h"
+#include "WriteBehind.h"
 
 #include <string>
 #include <cstring>
 #include <stdio.h>
 #include <cstdlib>
+#include <math.h>
 
 #include "mbed.h"
 
@@ -39,6 +41,23 @@ uint16_t get_checksum(const char *to_check)
     return (sum2 << 8) | sum1;
 }
 
+// CRC-32 as used by zip and ethernet, pass the previous result as crc to continue over more data
+uint32_t crc32(const void *data, size_t len, uint32_t crc)
+{
+    // a nibble at a time keeps the table small enough to not matter
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while(len--) {
+        crc = table[(crc ^ *p) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (*p++ >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
 void get_checksums(uint16_t check_sums[], const string &key)
 {
     check_sums[0] = 0x0000;
@@ -157,6 +176,7 @@ bool file_exists( const string file_name )
 // Prepares and executes a watchdog reset for dfu or reboot
 void system_reset( bool dfu )
 {
+    WriteBehind::sync(); // anything saved but not yet written would be lost
     if(dfu) {
         LPC_WDT->WDCLKSEL = 0x1;                // Set CLK src to PCLK
         uint32_t clk = SystemCoreClock / 16;    // WD has a fixed /4 prescaler, PCLK default is /4
@@ -263,6 +283,31 @@ string wcs2gcode(int wcs) {
     return str;
 }
 
+// widens lo and hi to take in the points at 0, 90, 180 and 270 degrees on the circle that an arc from start_angle
+// through angular_travel (radians, positive is counter clockwise) passes through, the arc lies in the box of them and its ends
+void arc_extremes(float center0, float center1, float radius, float start_angle, float angular_travel, float lo[2], float hi[2])
+{
+    const float quarter = 3.14159265358979323846F / 2;
+    bool ccw = angular_travel >= 0;
+    float sweep = fabsf(angular_travel);
+
+    // how far round from the start the first of them is in the direction of travel, then each quarter turn after it
+    float a = fmodf(ccw ? -start_angle : start_angle, quarter);
+    if(a < 0) a += quarter;
+    for (; a <= sweep; a += quarter) {
+        int q = (int)roundf((ccw ? start_angle + a : start_angle - a) / quarter) & 3;
+        float p[2] = {center0, center1};
+        if(q == 0) p[0] += radius;
+        else if(q == 1) p[1] += radius;
+        else if(q == 2) p[0] -= radius;
+        else p[1] -= radius;
+        for (int i = 0; i < 2; i++) {
+            if(p[i] < lo[i]) lo[i] = p[i];
+            if(p[i] > hi[i]) hi[i] = p[i];
+        }
+    }
+}
+
 void safe_delay_ms(uint32_t delay)
 {
     safe_delay_us(delay*1000);
@@ -272,6 +317,6 @@ void safe_delay_us(uint32_t dus)
 {
     uint32_t start = us_ticker_read();
     while ((us_ticker_read() - start) < dus) {
-        THEKERNEL->call_event(ON_IDLE);
+        THEKERNEL->yield();
     }
 }
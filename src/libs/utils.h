@@ -20,6 +20,7 @@ std::string remove_non_number( std::string str );
 
 uint16_t get_checksum(const std::string& to_check);
 uint16_t get_checksum(const char* to_check);
+uint32_t crc32(const void *data, size_t len, uint32_t crc= 0);
 
 void get_checksums(uint16_t check_sums[], const std::string& key);
 
@@ -37,6 +38,7 @@ int append_parameters(char *buf, std::vector<std::pair<char,float>> params, size
 std::string wcs2gcode(int wcs);
 void safe_delay_us(uint32_t delay);
 void safe_delay_ms(uint32_t delay);
+void arc_extremes(float center0, float center1, float radius, float start_angle, float angular_travel, float lo[2], float hi[2]);
 
 #define confine(value, min, max) (((value) < (min))?(min):(((value) > (max))?(max):(value)))
 
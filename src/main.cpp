@@ -19,6 +19,7 @@
 #include "modules/tools/temperatureswitch/TemperatureSwitch.h"
 #include "modules/tools/drillingcycles/Drillingcycles.h"
 #include "FilamentDetector.h"
+#include "Encoder.h"
 #include "MotorDriverControl.h"
 
 #include "modules/robot/Conveyor.h"
@@ -35,6 +36,7 @@
 #include "ConfigValue.h"
 #include "StepTicker.h"
 #include "SlowTicker.h"
+#include "Pwm.h"
 #include "Robot.h"
 
 // #include "libs/ChaNFSSD/SDFileSystem.h"
@@ -54,6 +56,9 @@
 #include "ToolManager.h"
 
 #include "libs/Watchdog.h"
+#include "libs/BootTrace.h"
+#include "libs/Trace.h"
+#include "libs/FileStream.h"
 
 #include "version.h"
 #include "system_LPC17xx.h"
@@ -65,6 +70,9 @@
 #define disable_msd_checksum  CHECKSUM("msd_disable")
 #define dfu_enable_checksum  CHECKSUM("dfu_enable")
 #define watchdog_timeout_checksum  CHECKSUM("watchdog_timeout")
+#define sd_spi_frequency_checksum  CHECKSUM("sd_spi_frequency")
+#define boot_log_checksum  CHECKSUM("boot_log")
+#define enable_checksum  CHECKSUM("enable")
 
 
 // USB Stuff
@@ -90,6 +98,12 @@ GPIO leds[5] = {
     GPIO(P4_28)
 };
 
+// the optional modules are only made when they are enabled, rather than made to find out they are not and delete themselves
+static bool module_enabled(uint16_t family)
+{
+    return THEKERNEL->config->value( family, enable_checksum )->by_default(false)->as_bool();
+}
+
 void init() {
 
     // Default pins to low status
@@ -99,12 +113,18 @@ void init() {
     }
 
     Kernel* kernel = new Kernel();
+#ifdef EVENT_TRACE
+    Trace::init();
+#endif
 
     kernel->streams->printf("Smoothie Running @%ldMHz\r\n", SystemCoreClock / 1000000);
     SimpleShell::version_command("", kernel->streams);
 
+    // the config has already been read off the card at the default clock by now, this is for everything after it
+    sd.set_max_frequency(kernel->config->value( sd_spi_frequency_checksum )->by_default(12500000)->as_number());
     bool sdok= (sd.disk_initialize() == 0);
     if(!sdok) kernel->streams->printf("SDCard failed to initialize\r\n");
+    BootTrace::mark("sd init");
 
     #ifdef NONETWORK
         kernel->streams->printf("NETWORK is disabled\r\n");
@@ -163,16 +183,16 @@ void init() {
     //kernel->add_module( new(AHB0) Spindle() );
     #endif
     #ifndef NO_UTILS_PANEL
-    kernel->add_module( new(AHB0) Panel() );
+    if(module_enabled(CHECKSUM("panel"))) kernel->add_module( new(AHB0) Panel() );
     #endif
     #ifndef NO_TOOLS_ZPROBE
-    kernel->add_module( new(AHB0) ZProbe() );
+    if(module_enabled(CHECKSUM("zprobe"))) kernel->add_module( new(AHB0) ZProbe() );
     #endif
     #ifndef NO_TOOLS_SCARACAL
-    kernel->add_module( new(AHB0) SCARAcal() );
+    if(module_enabled(CHECKSUM("scaracal"))) kernel->add_module( new(AHB0) SCARAcal() );
     #endif
     #ifndef NO_TOOLS_ROTARYDELTACALIBRATION
-    kernel->add_module( new(AHB0) RotaryDeltaCalibration() );
+    if(module_enabled(CHECKSUM("rotary_delta_calibration"))) kernel->add_module( new(AHB0) RotaryDeltaCalibration() );
     #endif
     #ifndef NONETWORK
     kernel->add_module( new Network() );
@@ -182,16 +202,25 @@ void init() {
     kernel->add_module( new(AHB0) TemperatureSwitch() );
     #endif
     #ifndef NO_TOOLS_DRILLINGCYCLES
-    kernel->add_module( new(AHB0) Drillingcycles() );
+    if(module_enabled(CHECKSUM("drillingcycles"))) kernel->add_module( new(AHB0) Drillingcycles() );
     #endif
     #ifndef NO_TOOLS_FILAMENTDETECTOR
-    kernel->add_module( new(AHB0) FilamentDetector() );
+    if(module_enabled(CHECKSUM("filament_detector"))) kernel->add_module( new(AHB0) FilamentDetector() );
+    #endif
+    #ifndef NO_TOOLS_ENCODER
+    if(module_enabled(CHECKSUM("encoder"))) kernel->add_module( new(AHB0) Encoder() );
     #endif
     #ifndef NO_UTILS_MOTORDRIVERCONTROL
     kernel->add_module( new MotorDriverControl(0) );
     #endif
+
+    // after the modules so any PWM1 period they set is known before heaters and fans are put on it
+    Pwm::start_all();
+    BootTrace::mark("pwm start");
+
     // Create and initialize USB stuff
     u.init();
+    BootTrace::mark("usb init");
 
 #ifdef DISABLEMSD
     if(sdok && msc != NULL){
@@ -226,8 +255,12 @@ void init() {
     // memory before cache is cleared
     //SimpleShell::print_mem(kernel->streams);
 
+    // optionally write the boot trace to the sdcard once booted
+    bool boot_log= kernel->config->value( boot_log_checksum )->by_default(false)->as_bool();
+
     // clear up the config cache to save some memory
     kernel->config->config_cache_clear();
+    BootTrace::mark("config clear");
 
     if(kernel->is_using_leds()) {
         // set some leds to indicate status... led0 init done, led1 mainloop running, led2 idle loop running, led3 sdcard ok
@@ -236,20 +269,12 @@ void init() {
     }
 
     if(sdok) {
-        // load config override file if present
+        // load config override file if present, quietly as there may be big tables in it, only errors are shown
         // NOTE only Mxxx commands that set values should be put in this file. The file is generated by M500
-        FILE *fp= fopen(kernel->config_override_filename(), "r");
-        if(fp != NULL) {
-            char buf[132];
-            kernel->streams->printf("Loading config override file: %s...\n", kernel->config_override_filename());
-            while(fgets(buf, sizeof buf, fp) != NULL) {
-                kernel->streams->printf("  %s", buf);
-                if(buf[0] == ';') continue; // skip the comments
-                struct SerialMessage message= {&(StreamOutput::NullStream), buf};
-                kernel->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
-            }
-            kernel->streams->printf("config override file executed\n");
-            fclose(fp);
+        int errors= SimpleShell::replay_gcodes(kernel->config_override_filename(), kernel->streams, false);
+        if(errors >= 0) {
+            if(errors == 0) kernel->streams->printf("config override file executed\n");
+            BootTrace::mark("config override");
         }
     }
 
@@ -257,6 +282,12 @@ void init() {
     THEKERNEL->conveyor->start(THEROBOT->get_number_registered_motors());
     THEKERNEL->step_ticker->start();
     THEKERNEL->slow_ticker->start();
+    BootTrace::done();
+
+    if(sdok && boot_log) {
+        FileStream fs("/sd/boot.log");
+        BootTrace::print(&fs);
+    }
 }
 
 int main()
@@ -15,8 +15,9 @@
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "libs/StreamOutputPool.h"
-#include "libs/FileStream.h"
-#include "libs/AppendFileStream.h"
+#include "libs/StringStream.h"
+#include "libs/WriteBehind.h"
+#include "libs/FileTail.h"
 #include "Config.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
@@ -27,6 +28,9 @@
 #include "LPC17xx.h"
 #include "version.h"
 
+#include <algorithm>
+#include <string.h>
+
 #define panel_display_message_checksum CHECKSUM("display_message")
 #define panel_checksum             CHECKSUM("panel")
 
@@ -42,8 +46,50 @@ static bool is_allowed_mcode(int m) {
 GcodeDispatch::GcodeDispatch()
 {
     uploading = false;
+    upload_shared = false;
+    ok_report = false;
+    ok_count = 0;
     currentline = -1;
     modal_group_1= 0;
+    resend_pending = false;
+    resend_dropped = 0;
+    clear_recent_lines();
+}
+
+void GcodeDispatch::clear_recent_lines()
+{
+    for (auto &r : recent_lines) {
+        r.line = -1;
+    }
+}
+
+// a numbered line that passed its checksum and is the next one, it is run
+void GcodeDispatch::accept_line(int ln, int chksum)
+{
+    currentline = ln;
+    auto &r = recent_lines[ln % k_recent_lines];
+    r.line = ln;
+    r.checksum = chksum;
+    resend_pending = false;
+}
+
+// true if line ln with that checksum is one of the last few that were run
+bool GcodeDispatch::is_recent_line(int ln, int chksum) const
+{
+    if(ln < 0 || ln <= currentline - k_recent_lines) return false;
+    const auto &r = recent_lines[ln % k_recent_lines];
+    return r.line == ln && r.checksum == (uint8_t)chksum;
+}
+
+// the ok sent at the end of every line, when M576 has turned on reporting it also tells a streaming host how many
+// planner blocks (Q) and receive buffer bytes (B) are free and how many oks have been sent (N) so it can keep the pipeline full
+void GcodeDispatch::send_ok(StreamOutput *stream)
+{
+    if(!ok_report) {
+        stream->printf("ok\r\n");
+        return;
+    }
+    stream->printf("ok Q:%u B:%d N:%lu\r\n", THEKERNEL->conveyor->queue_free(), stream->rx_space(), ++ok_count);
 }
 
 // Called when the module has just been loaded
@@ -52,25 +98,45 @@ void GcodeDispatch::on_module_loaded()
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
 }
 
+// find the first of any of the characters in set in [p, end), returns end if there are none
+static const char *find_first_of(const char *p, const char *end, const char *set)
+{
+    for (; p < end; p++) {
+        if(*p != '\0' && strchr(set, *p) != nullptr) return p;
+    }
+    return end;
+}
+
 // When a command is received, if it is a Gcode, dispatch it as an object via an event
 void GcodeDispatch::on_console_line_received(void *line)
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(line);
-    string possible_command = new_message.message;
+    SerialMessage& new_message = *static_cast<SerialMessage *>(line);
+    dispatch(new_message.message.data(), new_message.message.size(), new_message.stream);
+}
+
+// parse the line in place, the Gcodes are built straight from the line buffer and only the few commands that
+// take the rest of the line as text (M28, M117, M501, M1000) make a string of it
+void GcodeDispatch::dispatch(const char *line, size_t len, StreamOutput *stream)
+{
+    // possible_command is what is left of the line to process
+    const char *possible_command = line;
+    const char *end = line + len;
+    string pycam_line;
 
     int ln = 0;
     int cs = 0;
+    int chksum = 0;
 
     // just reply ok to empty lines
-    if(possible_command.empty()) {
-        new_message.stream->printf("ok\r\n");
+    if(possible_command == end) {
+        send_ok(stream);
         return;
     }
 
 try_again:
 
     char first_char = possible_command[0];
-    unsigned int n;
+    const char *n;
 
     if(first_char == '$') {
         // ignore as simpleshell will handle it
@@ -85,39 +151,37 @@ try_again:
 
         //Get linenumber
         if ( first_char == 'N' ) {
-            Gcode full_line = Gcode(possible_command, new_message.stream, false);
+            Gcode full_line(possible_command, end - possible_command, stream, false);
             ln = (int) full_line.get_value('N');
-            int chksum = (int) full_line.get_value('*');
+            chksum = (int) full_line.get_value('*');
 
             //Catch message if it is M110: Set Current Line Number
             if ( full_line.has_m ) {
                 if ( full_line.m == 110 ) {
                     currentline = ln;
-                    new_message.stream->printf("ok\r\n");
+                    resend_pending = false;
+                    clear_recent_lines();
+                    send_ok(stream);
                     return;
                 }
             }
 
             //Strip checksum value from possible_command
-            size_t chkpos = possible_command.find_first_of("*");
+            const char *chkpos = find_first_of(possible_command, end, "*");
 
-			//Calculate checksum
-            if ( chkpos != string::npos ) {
-				possible_command = possible_command.substr(0, chkpos);
-                for (auto c = possible_command.cbegin(); *c != '*' && c != possible_command.cend(); c++)
+            //Calculate checksum
+            if ( chkpos != end ) {
+                end = chkpos;
+                for (const char *c = possible_command; c != end; c++)
                     cs = cs ^ *c;
                 cs &= 0xff;  // Defensive programming...
                 cs -= chksum;
-			}
+            }
 
-            //Strip line number value from possible_command
-			size_t lnsize = possible_command.find_first_not_of("N0123456789.,- ");
-			if(lnsize != string::npos) {
-				possible_command = possible_command.substr(lnsize);
-			}else{
-				// it is a blank line
-				possible_command.clear();
-			}
+            //Strip line number value from possible_command, if there is nothing else it is a blank line
+            while(possible_command != end && *possible_command != '\0' && strchr("N0123456789.,- ", *possible_command) != nullptr) {
+                possible_command++;
+            }
 
         } else {
             //Assume checks succeeded
@@ -126,53 +190,45 @@ try_again:
         }
 
         //Remove comments
-        size_t comment = possible_command.find_first_of(";(");
-        if( comment != string::npos ) {
-            possible_command = possible_command.substr(0, comment);
-        }
+        end = find_first_of(possible_command, end, ";(");
 
         //If checksum passes then process message, else request resend
         int nextline = currentline + 1;
         if( cs == 0x00 && ln == nextline ) {
             if( first_char == 'N' ) {
-                currentline = nextline;
+                accept_line(ln, chksum);
+                THEROBOT->set_source_line(ln);
             }
 
-            while(possible_command.size() > 0) {
+            while(possible_command != end) {
                 // assumes G or M are always the first on the line
-                size_t nextcmd = possible_command.find_first_of("GM", 2);
-                string single_command;
-                if(nextcmd == string::npos) {
-                    single_command = possible_command;
-                    possible_command = "";
-                } else {
-                    single_command = possible_command.substr(0, nextcmd);
-                    possible_command = possible_command.substr(nextcmd);
-                }
+                const char *single_command = possible_command;
+                possible_command = (end - single_command > 2) ? find_first_of(single_command + 2, end, "GM") : end;
+                size_t single_len = possible_command - single_command;
 
 
-                if(!uploading || upload_stream != new_message.stream) {
+                if(!uploading || upload_stream != stream) {
                     // Prepare gcode for dispatch
-                    Gcode *gcode = new Gcode(single_command, new_message.stream);
+                    Gcode *gcode = new Gcode(single_command, single_len, stream);
 
                     if(THEKERNEL->is_halted()) {
                         // we ignore all commands until M999, unless it is in the exceptions list (like M105 get temp)
                         if(gcode->has_m && gcode->m == 999) {
                             if(THEKERNEL->is_halted()) {
                                 THEKERNEL->call_event(ON_HALT, (void *)1); // clears on_halt
-                                new_message.stream->printf("WARNING: After HALT you should HOME as position is currently unknown\n");
+                                stream->printf("WARNING: After HALT you should HOME as position is currently unknown\n");
                             }
-                            new_message.stream->printf("ok\n");
+                            stream->printf("ok\n");
                             delete gcode;
                             continue;
 
                         }else if(!is_allowed_mcode(gcode->m)) {
                             // ignore everything, return error string to host
                             if(THEKERNEL->is_grbl_mode()) {
-                                new_message.stream->printf("error:Alarm lock\n");
+                                stream->printf("error:Alarm lock\n");
 
                             }else{
-                                new_message.stream->printf("!!\r\n");
+                                stream->printf("!!\r\n");
                             }
                             delete gcode;
                             return;
@@ -183,12 +239,12 @@ try_again:
                         if(gcode->g == 53) { // G53 makes next movement command use machine coordinates
                             // this is ugly to implement as there may or may not be a G0/G1 on the same line
                             // valid version seem to include G53 G0 X1 Y2 Z3 G53 X1 Y2
-                            if(possible_command.empty()) {
+                            if(possible_command == end) {
                                 // use last gcode G1 or G0 if none on the line, and pass through as if it was a G0/G1
                                 // TODO it is really an error if the last is not G0 thru G3
                                 if(modal_group_1 > 3) {
                                     delete gcode;
-                                    new_message.stream->printf("ok - Invalid G53\r\n");
+                                    stream->printf("ok - Invalid G53\r\n");
                                     return;
                                 }
                                 // use last G0 or G1
@@ -197,12 +253,12 @@ try_again:
                             }else{
                                 delete gcode;
                                 // extract next G0/G1 from the rest of the line, ignore if it is not one of these
-                                gcode = new Gcode(possible_command, new_message.stream);
-                                possible_command= "";
+                                gcode = new Gcode(possible_command, end - possible_command, stream);
+                                possible_command= end;
                                 if(!gcode->has_g || gcode->g > 1) {
                                     // not G0 or G1 so ignore it as it is invalid
                                     delete gcode;
-                                    new_message.stream->printf("ok - Invalid G53\r\n");
+                                    stream->printf("ok - Invalid G53\r\n");
                                     return;
                                 }
                             }
@@ -222,18 +278,19 @@ try_again:
                             case 28: // start upload command
                                 delete gcode;
 
-                                this->upload_filename = "/sd/" + single_command.substr(4); // rest of line is filename
+                                this->upload_filename = "/sd/" + string(single_command + std::min<size_t>(4, single_len), possible_command); // rest of line is filename
                                 // open file
                                 upload_fd = fopen(this->upload_filename.c_str(), "w");
                                 if(upload_fd != NULL) {
                                     this->uploading = true;
-                                    new_message.stream->printf("Writing to file: %s\r\nok\r\n", this->upload_filename.c_str());
+                                    this->upload_shared = FileTail::begin(this->upload_filename.c_str());
+                                    stream->printf("Writing to file: %s\r\nok\r\n", this->upload_filename.c_str());
                                 } else {
-                                    new_message.stream->printf("open failed, File: %s.\r\nok\r\n", this->upload_filename.c_str());
+                                    stream->printf("open failed, File: %s.\r\nok\r\n", this->upload_filename.c_str());
                                 }
 
                                 // only save stuff from this stream
-                                upload_stream= new_message.stream;
+                                upload_stream= stream;
 
                                 //printf("Start Uploading file: %s, %p\n", upload_filename.c_str(), upload_fd);
                                 continue;
@@ -263,102 +320,106 @@ try_again:
                             case 115: // M115 Get firmware version and capabilities
                                 Version vers;
 
-                                new_message.stream->printf("FIRMWARE_NAME:Smoothieware, FIRMWARE_URL:http%%3A//smoothieware.org, X-SOURCE_CODE_URL:https://github.com/Smoothieware/Smoothieware, FIRMWARE_VERSION:%s, X-FIRMWARE_BUILD_DATE:%s, X-SYSTEM_CLOCK:%ldMHz, X-AXES:%d", vers.get_build(), vers.get_build_date(), SystemCoreClock / 1000000, MAX_ROBOT_ACTUATORS);
+                                stream->printf("FIRMWARE_NAME:Smoothieware, FIRMWARE_URL:http%%3A//smoothieware.org, X-SOURCE_CODE_URL:https://github.com/Smoothieware/Smoothieware, FIRMWARE_VERSION:%s, X-FIRMWARE_BUILD_DATE:%s, X-SYSTEM_CLOCK:%ldMHz, X-AXES:%d", vers.get_build(), vers.get_build_date(), SystemCoreClock / 1000000, MAX_ROBOT_ACTUATORS);
 
                                 #ifdef CNC
-                                new_message.stream->printf(", X-CNC:1");
+                                stream->printf(", X-CNC:1");
                                 #else
-                                new_message.stream->printf(", X-CNC:0");
+                                stream->printf(", X-CNC:0");
                                 #endif
 
                                 #ifdef DISABLEMSD
-                                new_message.stream->printf(", X-MSD:0");
+                                stream->printf(", X-MSD:0");
                                 #else
-                                new_message.stream->printf(", X-MSD:1");
+                                stream->printf(", X-MSD:1");
                                 #endif
 
-                                new_message.stream->printf("\nok\n");
+                                stream->printf("\nok\n");
                                 return;
 
                             case 117: // M117 is a special non compliant Gcode as it allows arbitrary text on the line following the command
                             {    // concatenate the command again and send to panel if enabled
-                                string str= single_command.substr(4) + possible_command;
+                                string str(single_command + std::min<size_t>(4, single_len), end);
                                 PublicData::set_value( panel_checksum, panel_display_message_checksum, &str );
                                 delete gcode;
-                                new_message.stream->printf("ok\r\n");
+                                send_ok(stream);
                                 return;
                             }
 
                             case 1000: // M1000 is a special command that will pass thru the raw lowercased command to the simpleshell (for hosts that do not allow such things)
                             {
                                 // reconstruct entire command line again
-                                string str= single_command.substr(5) + possible_command;
-                                while(is_whitespace(str.front())){ str= str.substr(1); } // strip leading whitespace
+                                const char *p= single_command + std::min<size_t>(5, single_len);
+                                while(p != end && is_whitespace(*p)) p++; // strip leading whitespace
+                                string str(p, end);
 
                                 delete gcode;
 
                                 if(str.empty()) {
-                                    SimpleShell::parse_command("help", "", new_message.stream);
+                                    SimpleShell::parse_command("help", "", stream);
 
                                 }else{
                                     string args= lc(str);
                                     string cmd = shift_parameter(args);
                                     // find command and execute it
-                                    if(!SimpleShell::parse_command(cmd.c_str(), args, new_message.stream)) {
-                                        new_message.stream->printf("Command not found: %s\n", cmd.c_str());
+                                    if(!SimpleShell::parse_command(cmd.c_str(), args, stream)) {
+                                        stream->printf("Command not found: %s\n", cmd.c_str());
                                     }
                                 }
 
-                                new_message.stream->printf("ok\r\n");
+                                send_ok(stream);
                                 return;
                             }
 
+                            case 576: // M576 S1 turn on planner and buffer space in every ok, S0 turns it off
+                                ok_report = !gcode->has_letter('S') || gcode->get_value('S') != 0;
+                                ok_count = 0;
+                                break;
+
                             case 500: // M500 save volatile settings to config-override
-                                THEKERNEL->conveyor->wait_for_idle(); //just to be safe as it can take a while to run
-                                //remove(THEKERNEL->config_override_filename()); // seems to cause a hang every now and then
-                                __disable_irq();
                                 {
-                                    FileStream fs(THEKERNEL->config_override_filename());
-                                    fs.printf("; DO NOT EDIT THIS FILE\n");
-                                    // this also will truncate the existing file instead of deleting it
+                                    THEKERNEL->conveyor->wait_for_idle(); //just to be safe as it can take a while to run
+                                    // the settings are collected in RAM and the config-override is written from idle in one go
+                                    StringStream ss;
+                                    ss.printf("; DO NOT EDIT THIS FILE\n");
+                                    gcode->stream = &ss;
+                                    __disable_irq();
+                                    // dispatch the M500 here so the stream is only used while it is there
+                                    THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
+                                    __enable_irq();
+                                    delete gcode;
+                                    WriteBehind::queue(THEKERNEL->config_override_filename(), ss.getOutput());
                                 }
-                                // replace stream with one that writes to config-override file
-                                gcode->stream = new AppendFileStream(THEKERNEL->config_override_filename());
-                                // dispatch the M500 here so we can free up the stream when done
-                                THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
-                                delete gcode->stream;
-                                delete gcode;
-                                __enable_irq();
-                                new_message.stream->printf("Settings Stored to %s\r\nok\r\n", THEKERNEL->config_override_filename());
+                                stream->printf("Settings Stored to %s\r\nok\r\n", THEKERNEL->config_override_filename());
                                 continue;
 
                             case 501: // load config override
                             case 504: // save to specific config override file
                                 {
-                                    string arg= get_arguments(single_command + possible_command); // rest of line is filename
+                                    string arg= get_arguments(string(single_command, end)); // rest of line is filename
                                     if(arg.empty()) arg= "/sd/config-override";
                                     else arg= "/sd/config-override." + arg;
-                                    //new_message.stream->printf("args: <%s>\n", arg.c_str());
-                                    SimpleShell::parse_command((gcode->m == 501) ? "load_command" : "save_command", arg, new_message.stream);
+                                    //stream->printf("args: <%s>\n", arg.c_str());
+                                    SimpleShell::parse_command((gcode->m == 501) ? "load" : "save", arg, stream);
                                 }
                                 delete gcode;
-                                new_message.stream->printf("ok\r\n");
+                                send_ok(stream);
                                 return;
 
                             case 502: // M502 deletes config-override so everything defaults to what is in config
                                 remove(THEKERNEL->config_override_filename());
                                 delete gcode;
-                                new_message.stream->printf("config override file deleted %s, reboot needed\r\nok\r\n", THEKERNEL->config_override_filename());
+                                stream->printf("config override file deleted %s, reboot needed\r\nok\r\n", THEKERNEL->config_override_filename());
                                 continue;
 
                             case 503: { // M503 display live settings and indicates if there is an override file
                                 FILE *fd = fopen(THEKERNEL->config_override_filename(), "r");
                                 if(fd != NULL) {
                                     fclose(fd);
-                                    new_message.stream->printf("; config override present: %s\n",  THEKERNEL->config_override_filename());
+                                    stream->printf("; config override present: %s\n",  THEKERNEL->config_override_filename());
 
                                 } else {
-                                    new_message.stream->printf("; No config override\n");
+                                    stream->printf("; No config override\n");
                                 }
                                 gcode->add_nl= true;
                                 break; // fall through to process by modules
@@ -374,40 +435,40 @@ try_again:
                     if (gcode->is_error) {
                         // report error
                         if(THEKERNEL->is_grbl_mode()) {
-                            new_message.stream->printf("error:");
+                            stream->printf("error:");
                         }else{
-                            new_message.stream->printf("Error: ");
+                            stream->printf("Error: ");
                         }
 
                         if(!gcode->txt_after_ok.empty()) {
-                            new_message.stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
+                            stream->printf("%s\r\n", gcode->txt_after_ok.c_str());
                             gcode->txt_after_ok.clear();
 
                         }else{
-                            new_message.stream->printf("unknown\r\n");
+                            stream->printf("unknown\r\n");
                         }
 
                         // we cannot continue safely after an error so we enter HALT state
-                        new_message.stream->printf("Entering Alarm/Halt state\n");
+                        stream->printf("Entering Alarm/Halt state\n");
                         THEKERNEL->call_event(ON_HALT, nullptr);
 
                     }else{
 
                         if(gcode->add_nl)
-                            new_message.stream->printf("\r\n");
+                            stream->printf("\r\n");
 
                         if(!gcode->txt_after_ok.empty()) {
-                            new_message.stream->printf("ok %s\r\n", gcode->txt_after_ok.c_str());
+                            stream->printf("ok %s\r\n", gcode->txt_after_ok.c_str());
                             gcode->txt_after_ok.clear();
 
                         } else {
                             if(THEKERNEL->is_ok_per_line() || THEKERNEL->is_grbl_mode()) {
                                 // only send ok once per line if this is a multi g code line send ok on the last one
-                                if(possible_command.empty())
-                                    new_message.stream->printf("ok\r\n");
+                                if(possible_command == end)
+                                    send_ok(stream);
                             } else {
                                 // maybe should do the above for all hosts?
-                                new_message.stream->printf("ok\r\n");
+                                send_ok(stream);
                             }
                         }
                     }
@@ -416,53 +477,82 @@ try_again:
 
                 } else {
                     // we are uploading and it is the upload stream so so save it
-                    if(single_command.substr(0, 3) == "M29") {
+                    if(single_len >= 3 && strncmp(single_command, "M29", 3) == 0) {
                         // done uploading, close file
-                        fclose(upload_fd);
+                        bool ok = upload_fd != NULL && fclose(upload_fd) == 0;
+                        if(upload_shared) FileTail::end(ok);
+                        upload_shared = false;
                         upload_fd = NULL;
                         uploading = false;
                         upload_filename.clear();
                         upload_stream= nullptr;
-                        new_message.stream->printf("Done saving file.\r\nok\r\n");
+                        stream->printf("Done saving file.\r\nok\r\n");
                         continue;
                     }
 
                     if(upload_fd == NULL) {
                         // error detected writing to file so discard everything until it stops
-                        new_message.stream->printf("ok\r\n");
+                        send_ok(stream);
                         continue;
                     }
 
-                    single_command.append("\n");
-                    if(fwrite(single_command.c_str(), 1, single_command.size(), upload_fd) != single_command.size()) {
+                    if(fwrite(single_command, 1, single_len, upload_fd) != single_len || fputc('\n', upload_fd) == EOF) {
                         // error writing to file
-                        new_message.stream->printf("Error:error writing to file.\r\n");
+                        stream->printf("Error:error writing to file.\r\n");
                         fclose(upload_fd);
                         upload_fd = NULL;
+                        if(upload_shared) FileTail::end(false);
+                        upload_shared = false;
                         continue;
 
                     } else {
-                         new_message.stream->printf("ok\r\n");
+                        if(upload_shared) {
+                            FileTail::write(single_command, single_len);
+                            if(FileTail::write("\n", 1)) {
+                                // something playing the file has fallen behind what is kept in RAM, so put it all on the card
+                                fclose(upload_fd);
+                                upload_fd = fopen(this->upload_filename.c_str(), "a");
+                                FileTail::synced();
+                                if(upload_fd == NULL) {
+                                    stream->printf("Error:error writing to file.\r\n");
+                                    FileTail::end(false);
+                                    upload_shared = false;
+                                    continue;
+                                }
+                            }
+                        }
+                         send_ok(stream);
                         //printf("uploading file write ok\n");
                     }
                 }
             }
 
+        } else if( cs == 0x00 && ln < nextline && is_recent_line(ln, chksum) ) {
+            // the host sent it again before it saw the ok, it has already been run so it just gets another
+            send_ok(stream);
+
+        } else if( cs == 0x00 && ln > nextline && resend_pending && ++resend_dropped < k_resend_repeat ) {
+            // sent before the host got the resend request, it sends them all again from the missing one
+
         } else {
-            //Request resend
-            new_message.stream->printf("rs N%d\r\n", nextline);
+            //Request resend, once for all the lines the host already had on the way after it
+            stream->printf("rs N%d\r\n", nextline);
+            resend_pending = true;
+            resend_dropped = 0;
         }
 
-    } else if( (n=possible_command.find_first_of("XYZF")) == 0 || (first_char == ' ' && n != string::npos) ) {
+    } else if( (n=find_first_of(possible_command, end, "XYZF")) == possible_command || (first_char == ' ' && n != end) ) {
         // handle pycam syntax, use last modal group 1 command and resubmit if an X Y Z or F is found on its own line
         char buf[6];
         snprintf(buf, sizeof(buf), "G%d ", modal_group_1);
-        possible_command.insert(0, buf);
+        pycam_line= string(buf) + string(possible_command, end);
+        possible_command= pycam_line.data();
+        end= possible_command + pycam_line.size();
         goto try_again;
 
         // Ignore comments and blank lines
     } else if ( first_char == ';' || first_char == '(' || first_char == ' ' || first_char == '\n' || first_char == '\r' ) {
-        new_message.stream->printf("ok\r\n");
+        send_ok(stream);
     }
 }
 
@@ -21,15 +21,34 @@ public:
 
     virtual void on_module_loaded();
     virtual void on_console_line_received(void *line);
+    void dispatch(const char *line, size_t len, StreamOutput *stream);
+    void send_ok(StreamOutput *stream);
 
     uint8_t get_modal_command() const { return modal_group_1<4 ? modal_group_1 : 0; }
 private:
+    void accept_line(int ln, int chksum);
+    bool is_recent_line(int ln, int chksum) const;
+    void clear_recent_lines();
+
     int currentline;
+    // the last few numbered lines that were run and their checksums, so one the host sends again can be told from a new one
+    static const int k_recent_lines= 16;
+    struct {
+        int line;
+        uint8_t checksum;
+    } recent_lines[k_recent_lines];
+    // lines after a missing one are dropped until the host goes back to it, it is asked again every k_resend_repeat of them
+    static const uint8_t k_resend_repeat= 8;
+    uint8_t resend_dropped;
     std::string upload_filename;
     FILE *upload_fd;
     StreamOutput* upload_stream{nullptr};
+    uint32_t ok_count;
     uint8_t modal_group_1;
     struct {
         bool uploading: 1;
+        bool ok_report: 1;
+        bool upload_shared: 1; // Player may be playing the file as it is uploaded
+        bool resend_pending: 1; // asked the host to resend from currentline + 1
     };
 };
@@ -12,10 +12,21 @@ using std::string;
 #include "libs/Kernel.h"
 #include "libs/nuts_bolts.h"
 #include "SerialConsole.h"
-#include "libs/RingBuffer.h"
+#include "libs/SPSCQueue.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
 #include "libs/StreamOutputPool.h"
+#include "Robot.h"
+#include "Config.h"
+#include "ConfigValue.h"
+#include "checksumm.h"
+#include "platform_memory.h"
+#include "LPC17xx.h"
+
+#define uart0_checksum             CHECKSUM("uart0")
+
+// channel 7 is the lowest priority, rx dma only needs a byte at a time
+#define RX_DMA_CHANNEL LPC_GPDMACH7
 
 // Serial reading module
 // Treats every received line as a command and passes it ( via event call ) to the command dispatcher.
@@ -23,18 +34,28 @@ using std::string;
 SerialConsole::SerialConsole( PinName rx_pin, PinName tx_pin, int baud_rate ){
     this->serial = new mbed::Serial( rx_pin, tx_pin );
     this->serial->baud(baud_rate);
+    this->rx_pin = tx_pin; // mbed Serial takes tx then rx, so despite its name the second pin is the rx one
 }
 
 // Called when the module has just been loaded
 void SerialConsole::on_module_loaded() {
-    // We want to be called every time a new char is received
-    this->serial->attach(this, &SerialConsole::on_serial_char_received, mbed::Serial::RxIrq);
     query_flag= false;
     halt_flag= false;
+    dma_rx= false;
+
+    // optionally receive by dma into a bigger buffer, so high baud rates do not cost an interrupt per character
+    if(THEKERNEL->config->value(uart0_checksum, rx_dma_checksum)->by_default(false)->as_bool()) {
+        uint16_t size= THEKERNEL->config->value(uart0_checksum, rx_buffer_size_checksum)->by_default(1024)->as_number();
+        dma_rx= enable_dma_rx(size);
+        if(!dma_rx) THEKERNEL->streams->printf("Error: uart0 rx dma could not be enabled, using interrupts\n");
+    }
+
+    // We want to be called every time a new char is received
+    if(!dma_rx) this->serial->attach(this, &SerialConsole::on_serial_char_received, mbed::Serial::RxIrq);
 
     // We only call the command dispatcher in the main loop, nowhere else
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_IDLE);
+    this->register_for_event(ON_MAIN_LOOP, PRIORITY_HIGH);
+    this->register_for_event(ON_IDLE, PRIORITY_HIGH);
 
     // Add to the pack of streams kernel can call to, for example for broadcasting
     THEKERNEL->streams->append_stream(this);
@@ -52,17 +73,24 @@ void SerialConsole::on_serial_char_received(){
             halt_flag= true;
             continue;
         }
+        if(received == (char)0x85) { // jog cancel
+            THEROBOT->cancel_jog();
+            continue;
+        }
         // convert CR to NL (for host OSs that don't send NL)
         if( received == '\r' ){ received = '\n'; }
-        this->buffer.push_back(received);
+        this->buffer.push(received); // dropped if the buffer is full
     }
 }
 
 void SerialConsole::on_idle(void * argument)
 {
+    // look for ^X and ? even while the main loop is blocked
+    if(dma_rx) dma_scan();
+
     if(query_flag) {
         query_flag= false;
-        puts(THEKERNEL->get_query_string().c_str());
+        puts(THEKERNEL->get_status_snapshot());
     }
     if(halt_flag) {
         halt_flag= false;
@@ -72,20 +100,26 @@ void SerialConsole::on_idle(void * argument)
 
 // Actual event calling must happen in the main loop because if it happens in the interrupt we will loose data
 void SerialConsole::on_main_loop(void * argument){
+    // the next line waits until the last segmented move has been fed to the planner
+    if(THEROBOT->is_segmenting()) return;
+
+    if(dma_rx) {
+        dma_scan();
+        if(dma_lines > 0) dma_read_line();
+        return;
+    }
+
     if( this->has_char('\n') ){
-        string received;
-        received.reserve(20);
+        struct SerialMessage message;
+        message.stream = this;
         while(1){
            char c;
-           this->buffer.pop_front(c);
+           this->buffer.pop(c);
            if( c == '\n' ){
-                struct SerialMessage message;
-                message.message = received;
-                message.stream = this;
                 THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
                 return;
             }else{
-                received += c;
+                message.message += c;
             }
         }
     }
@@ -107,14 +141,104 @@ int SerialConsole::_getc()
     return this->serial->getc();
 }
 
-// Does the queue have a given char ?
-bool SerialConsole::has_char(char letter){
-    int index = this->buffer.tail;
-    while( index != this->buffer.head ){
-        if( this->buffer.buffer[index] == letter ){
-            return true;
+int SerialConsole::rx_space()
+{
+    if(dma_rx) return dma_size - 1 - ((dma_head() - dma_tail + dma_size) % dma_size);
+    return buffer.free();
+}
+
+// map the rx pin to its uart and dma request, and start a circular peripheral to memory transfer that never ends
+bool SerialConsole::enable_dma_rx(uint16_t size)
+{
+    LPC_UART_TypeDef *uart;
+    uint32_t request;
+    switch(rx_pin) {
+        case USBRX: uart= (LPC_UART_TypeDef *)LPC_UART0; request= 9; break;
+        case p14:   uart= (LPC_UART_TypeDef *)LPC_UART1; request= 11; break;
+        case p27:   uart= (LPC_UART_TypeDef *)LPC_UART2; request= 13; break;
+        case p10:   uart= (LPC_UART_TypeDef *)LPC_UART3; request= 15; break;
+        default: return false;
+    }
+    if(size < 64 || size > 4095) return false;
+
+    // the dma can not reach the cpu local ram so both go in AHB ram
+    dma_buf= (char *)AHB0.alloc(size);
+    dma_lli= (uint32_t *)AHB0.alloc(4 * sizeof(uint32_t));
+    if(dma_buf == nullptr || dma_lli == nullptr) return false;
+    dma_size= size;
+    dma_tail= dma_scanned= dma_lines= 0;
+
+    // byte wide single transfers from the uart to an incrementing destination, the descriptor links
+    // to itself so when the buffer is full the transfer restarts at the beginning
+    uint32_t control= size | (1 << 27);
+    dma_lli[0]= (uint32_t)&uart->RBR;
+    dma_lli[1]= (uint32_t)dma_buf;
+    dma_lli[2]= (uint32_t)dma_lli;
+    dma_lli[3]= control;
+
+    LPC_SC->PCONP |= (1 << 29);                 // power up the GPDMA
+    LPC_SC->DMAREQSEL &= ~(1 << (request - 8)); // uart rather than timer match for the shared requests
+    LPC_GPDMA->DMACConfig= 1;
+
+    RX_DMA_CHANNEL->DMACCConfig= 0;
+    LPC_GPDMA->DMACIntTCClear= (1 << 7);
+    LPC_GPDMA->DMACIntErrClr= (1 << 7);
+    RX_DMA_CHANNEL->DMACCSrcAddr= dma_lli[0];
+    RX_DMA_CHANNEL->DMACCDestAddr= dma_lli[1];
+    RX_DMA_CHANNEL->DMACCLLI= dma_lli[2];
+    RX_DMA_CHANNEL->DMACCControl= control;
+
+    // fifo on with dma requests, rx trigger at one character
+    uart->FCR= (1 << 0) | (1 << 3);
+
+    // enabled, source is the uart rx request, peripheral to memory
+    RX_DMA_CHANNEL->DMACCConfig= 1 | (request << 1) | (2 << 11);
+    return true;
+}
+
+// where the dma will write the next character
+uint16_t SerialConsole::dma_head() const
+{
+    return (RX_DMA_CHANNEL->DMACCDestAddr - (uint32_t)dma_buf) % dma_size;
+}
+
+// check what has arrived since the last scan, the realtime characters take effect straight away
+void SerialConsole::dma_scan()
+{
+    uint16_t head= dma_head();
+    while(dma_scanned != head) {
+        char c= dma_buf[dma_scanned];
+        if(c == '?') {
+            query_flag= true;
+        } else if(c == 'X'-'A'+1) { // ^X
+            halt_flag= true;
+        } else if(c == (char)0x85) { // jog cancel
+            THEROBOT->cancel_jog();
+        } else if(c == '\n' || c == '\r') {
+            dma_lines++;
         }
-        index = this->buffer.next_block_index(index);
+        if(++dma_scanned == dma_size) dma_scanned= 0;
+    }
+}
+
+// take the oldest complete line out of the dma buffer and dispatch it
+void SerialConsole::dma_read_line()
+{
+    struct SerialMessage message;
+    message.stream = this;
+    while(1) {
+        char c= dma_buf[dma_tail];
+        if(++dma_tail == dma_size) dma_tail= 0;
+        if(c == '\n' || c == '\r') break;
+        if(c == '?' || c == 'X'-'A'+1 || c == (char)0x85) continue; // already handled by the scan
+        message.message += c;
     }
-    return false;
+    dma_lines--;
+
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
+}
+
+// Does the queue have a given char ?
+bool SerialConsole::has_char(char letter){
+    return this->buffer.find(letter) != this->buffer.max_size();
 }
@@ -14,11 +14,13 @@
 #include <vector>
 #include <string>
 using std::string;
-#include "libs/RingBuffer.h"
+#include "libs/SPSCQueue.h"
 #include "libs/StreamOutput.h"
 
 
 #define baud_rate_setting_checksum CHECKSUM("baud_rate")
+#define rx_dma_checksum            CHECKSUM("rx_dma")
+#define rx_buffer_size_checksum    CHECKSUM("rx_buffer_size")
 
 class SerialConsole : public Module, public StreamOutput {
     public:
@@ -33,14 +35,33 @@ class SerialConsole : public Module, public StreamOutput {
         int _putc(int c);
         int _getc(void);
         int puts(const char*);
+        int rx_space();
 
         //string receive_buffer;                 // Received chars are stored here until a newline character is received
         //vector<std::string> received_lines;    // Received lines are stored here until they are requested
-        RingBuffer<char,256> buffer;             // Receive buffer
+        SPSCQueue<char,256> buffer;              // Receive buffer, filled in the rx ISR and emptied in the main loop
         mbed::Serial* serial;
+
+    private:
+        bool enable_dma_rx(uint16_t size);
+        uint16_t dma_head() const;
+        void dma_scan();
+        void dma_read_line();
+
+        // when rx dma is on the uart fills dma_buf in a circle with no interrupts, the main loop scans what has
+        // arrived since the last look for control characters and newlines and dispatches complete lines from it
+        PinName rx_pin;
+        char *dma_buf{nullptr};
+        uint32_t *dma_lli{nullptr};
+        uint16_t dma_size{0};
+        uint16_t dma_tail{0};                    // start of the next line to dispatch
+        uint16_t dma_scanned{0};                 // everything before this has been checked for control characters
+        uint16_t dma_lines{0};                   // complete lines between dma_tail and dma_scanned
+
         struct {
           bool query_flag:1;
           bool halt_flag:1;
+          bool dma_rx:1;
         };
 };
 
@@ -9,14 +9,39 @@
 #include "Gcode.h"
 #include "libs/StreamOutput.h"
 #include "utils.h"
+#include "SlabPool.h"
 #include <stdlib.h>
+#include <string.h>
 #include <algorithm>
 
 // This is a gcode object. It represents a GCode string/command, and caches some important values about that command for the sake of performance.
 // It gets passed around in events, and attached to the queue ( that'll change )
-Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
+
+// a line being dispatched and the few it makes on the way, like homing or the config-override replay
+static SlabPool gcode_pool("Gcode", sizeof(Gcode), 6);
+
+void *Gcode::operator new(size_t size)
+{
+    return gcode_pool.alloc(size);
+}
+
+void Gcode::operator delete(void *p)
+{
+    gcode_pool.dealloc(p);
+}
+
+Gcode::Gcode(const string &command, StreamOutput *stream, bool strip) : Gcode(command.data(), command.size(), stream, strip)
+{
+}
+
+Gcode::Gcode(const char *command, StreamOutput *stream, bool strip) : Gcode(command, strlen(command), stream, strip)
 {
-    this->command= strdup(command.c_str());
+}
+
+// build in place from len characters of a line buffer, which need not be nul terminated
+Gcode::Gcode(const char *command, size_t len, StreamOutput *stream, bool strip)
+{
+    set_command(command, len);
     this->m= 0;
     this->g= 0;
     this->subcode= 0;
@@ -29,15 +54,12 @@ Gcode::Gcode(const string &command, StreamOutput *stream, bool strip)
 
 Gcode::~Gcode()
 {
-    if(command != nullptr) {
-        // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
-        free(command);
-    }
+    release_command();
 }
 
 Gcode::Gcode(const Gcode &to_copy)
 {
-    this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+    copy_command(to_copy);
     this->has_m                 = to_copy.has_m;
     this->has_g                 = to_copy.has_g;
     this->m                     = to_copy.m;
@@ -45,6 +67,7 @@ Gcode::Gcode(const Gcode &to_copy)
     this->subcode               = to_copy.subcode;
     this->add_nl                = to_copy.add_nl;
     this->is_error              = to_copy.is_error;
+    this->stripped              = to_copy.stripped;
     this->stream                = to_copy.stream;
     this->txt_after_ok.assign( to_copy.txt_after_ok );
 }
@@ -52,7 +75,8 @@ Gcode::Gcode(const Gcode &to_copy)
 Gcode &Gcode::operator= (const Gcode &to_copy)
 {
     if( this != &to_copy ) {
-        this->command               = strdup(to_copy.command); // TODO we can reference count this so we share copies, may save more ram than the extra count we need to store
+        release_command();
+        copy_command(to_copy);
         this->has_m                 = to_copy.has_m;
         this->has_g                 = to_copy.has_g;
         this->m                     = to_copy.m;
@@ -60,27 +84,53 @@ Gcode &Gcode::operator= (const Gcode &to_copy)
         this->subcode               = to_copy.subcode;
         this->add_nl                = to_copy.add_nl;
         this->is_error              = to_copy.is_error;
+        this->stripped              = to_copy.stripped;
         this->stream                = to_copy.stream;
         this->txt_after_ok.assign( to_copy.txt_after_ok );
     }
     return *this;
 }
 
+void Gcode::set_command(const char *line, size_t len)
+{
+    command= (len < inline_size) ? inline_command : (char *)malloc(len + 1);
+    memcpy(command, line, len);
+    command[len]= '\0';
+}
+
+// also copies the parsed letter table so the copy does not need to parse again
+void Gcode::copy_command(const Gcode &to_copy)
+{
+    set_command(to_copy.command, strlen(to_copy.command));
+    this->letters= to_copy.letters;
+    this->valid= to_copy.valid;
+    memcpy(this->values, to_copy.values, sizeof(this->values));
+}
+
+void Gcode::release_command()
+{
+    if(command != nullptr && command != inline_command) {
+        free(command);
+    }
+    command= nullptr;
+}
 
 // Whether or not a Gcode has a letter
 bool Gcode::has_letter( char letter ) const
 {
-    for (size_t i = 0; i < strlen(this->command); ++i) {
-        if( command[i] == letter ) {
-            return true;
-        }
-    }
-    return false;
+    if(letter >= 'A' && letter <= 'Z') return (letters & (1 << (letter - 'A'))) != 0;
+    return strchr(command, letter) != nullptr;
 }
 
 // Retrieve the value for a given letter
+// A-Z come from the table built on construction unless the caller wants to know where the value ends
 float Gcode::get_value( char letter, char **ptr ) const
 {
+    if(ptr == nullptr && letter >= 'A' && letter <= 'Z') {
+        int i= letter - 'A';
+        return (valid & (1 << i)) ? values[i] : 0;
+    }
+
     const char *cs = command;
     char *cn = NULL;
     for (; *cs; cs++) {
@@ -97,6 +147,15 @@ float Gcode::get_value( char letter, char **ptr ) const
 }
 
 int Gcode::get_int( char letter, char **ptr ) const
+{
+    if(ptr == nullptr && letter >= 'A' && letter <= 'Z') {
+        int i= letter - 'A';
+        return (valid & (1 << i)) ? (int)values[i] : 0;
+    }
+    return scan_int(letter, ptr);
+}
+
+int Gcode::scan_int( char letter, char **ptr ) const
 {
     const char *cs = command;
     char *cn = NULL;
@@ -172,17 +231,17 @@ std::map<char,int> Gcode::get_args_int() const
 void Gcode::prepare_cached_values(bool strip)
 {
     char *p= nullptr;
-    if( this->has_letter('G') ) {
+    if( strchr(command, 'G') != nullptr ) {
         this->has_g = true;
-        this->g = this->get_int('G', &p);
+        this->g = scan_int('G', &p);
 
     } else {
         this->has_g = false;
     }
 
-    if( this->has_letter('M') ) {
+    if( strchr(command, 'M') != nullptr ) {
         this->has_m = true;
-        this->m = this->get_int('M', &p);
+        this->m = scan_int('M', &p);
 
     } else {
         this->has_m = false;
@@ -198,29 +257,59 @@ void Gcode::prepare_cached_values(bool strip)
         }
     }
 
-    if(!strip) return;
+    // remove the Gxxx or Mxxx from string, the rest of it is moved down in place
+    if (strip && p != nullptr) {
+        memmove(command, p, strlen(p) + 1);
+    }
 
-    // remove the Gxxx or Mxxx from string
-    if (p != nullptr) {
-        char *n= strdup(p); // create new string starting at end of the numeric value
-        free(command);
-        command= n;
+    parse_values();
+}
+
+// parse the value following every letter once, the first occurrence with a number wins as it always did
+void Gcode::parse_values()
+{
+    letters= 0;
+    valid= 0;
+    for (const char *cs = command; *cs; cs++) {
+        char c= *cs;
+        if(c < 'A' || c > 'Z') continue;
+        uint32_t bit= 1 << (c - 'A');
+        letters |= bit;
+        if(valid & bit) continue;
+
+        char *cn;
+        float r= strtof(cs + 1, &cn);
+        if(cn > cs + 1) {
+            values[c - 'A']= r;
+            valid |= bit;
+        }
     }
 }
 
+// set a letter directly in the table without it being on the line, used by commands that do not come as text
+void Gcode::set_value( char letter, float value )
+{
+    if(letter < 'A' || letter > 'Z') return;
+    uint32_t bit= 1 << (letter - 'A');
+    letters |= bit;
+    valid |= bit;
+    values[letter - 'A']= value;
+}
+
 // strip off X Y Z I J K parameters if G0/1/2/3
 void Gcode::strip_parameters()
 {
     if(has_g && g < 4){
-        // strip the command of the XYZIJK parameters
-        string newcmd;
+        // strip the command of the XYZIJK parameters, the result is never longer so it is done in place
+        char *out= command;
         char *cn= command;
         // find the start of each parameter
         char *pch= strpbrk(cn, "XYZIJK");
         while (pch != nullptr) {
             if(pch > cn) {
-                // copy non parameters to new string
-                newcmd.append(cn, pch-cn);
+                // copy non parameters down
+                memmove(out, cn, pch-cn);
+                out += pch-cn;
             }
             // find the end of the parameter and its value
             char *eos;
@@ -229,14 +318,8 @@ void Gcode::strip_parameters()
             pch= strpbrk(cn, "XYZIJK"); // find next parameter
         }
         // append anything left on the line
-        newcmd.append(cn);
+        memmove(out, cn, strlen(cn) + 1);
 
-        // strip whitespace to save even more, this causes problems so don't do it
-        //newcmd.erase(std::remove_if(newcmd.begin(), newcmd.end(), ::isspace), newcmd.end());
-
-        // release the old one
-        free(command);
-        // copy the new shortened one
-        command= strdup(newcmd.c_str());
+        parse_values();
     }
 }
@@ -10,6 +10,8 @@
 #define GCODE_H
 #include <string>
 #include <map>
+#include <stdint.h>
+#include <stddef.h>
 
 using std::string;
 
@@ -19,10 +21,16 @@ class StreamOutput;
 class Gcode {
     public:
         Gcode(const string&, StreamOutput*, bool strip=true);
+        Gcode(const char*, StreamOutput*, bool strip=true);
+        Gcode(const char*, size_t len, StreamOutput*, bool strip=true);
         Gcode(const Gcode& to_copy);
         Gcode& operator= (const Gcode& to_copy);
         ~Gcode();
 
+        // from a SlabPool, one is made and deleted for every line
+        static void *operator new(size_t size);
+        static void operator delete(void *p);
+
         const char* get_command() const { return command; }
         bool has_letter ( char letter ) const;
         float get_value ( char letter, char **ptr= nullptr ) const;
@@ -32,6 +40,7 @@ class Gcode {
         std::map<char,float> get_args() const;
         std::map<char,int> get_args_int() const;
         void strip_parameters();
+        void set_value( char letter, float value );
 
         // FIXME these should be private
         unsigned int m;
@@ -50,7 +59,23 @@ class Gcode {
         string txt_after_ok;
 
     private:
+        void set_command(const char *line, size_t len);
+        void copy_command(const Gcode& to_copy);
+        void release_command();
         void prepare_cached_values(bool strip=true);
+        void parse_values();
+        int scan_int( char letter, char **ptr ) const;
+
+        // short lines (nearly every G0/G1) are kept in the object itself, longer ones go on the heap
+        static const size_t inline_size= 48;
+
         char *command;
+        char inline_command[inline_size];
+
+        // each letter A-Z is parsed once on construction, letters has a bit set for every letter on the line,
+        // valid has a bit set for those followed by a number which is then held in values
+        uint32_t letters;
+        uint32_t valid;
+        float values[26];
 };
 #endif
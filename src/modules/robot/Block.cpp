@@ -27,6 +27,7 @@ using std::string;
 #define STEP_TICKER_FREQUENCY THEKERNEL->step_ticker->get_frequency()
 
 uint8_t Block::n_actuators= 0;
+bool Block::lazy_prepare= false;
 double Block::fp_scale= 0;
 
 // A block represents a movement, it's length for each stepper motor, and the corresponding acceleration curves.
@@ -40,6 +41,12 @@ Block::Block()
     clear();
 }
 
+Block::Block(tickinfo_t *ti)
+{
+    tick_info= ti;
+    clear();
+}
+
 void Block::init(uint8_t n)
 {
     n_actuators= n;
@@ -53,12 +60,24 @@ void Block::clear()
     this->steps.fill(0);
 
     steps_event_count   = 0;
+    rate_scale          = 0;
+    primary_motor       = 0;
+    raster_count        = 0;
+    raster_start        = 0;
+    advance_steps       = 0;
+    advance_motor       = 0xFF;
+    backlash_motors     = 0;
+    sync_seq            = 0;
+    source_line         = 0;
     nominal_rate        = 0.0F;
     nominal_speed       = 0.0F;
     millimeters         = 0.0F;
     entry_speed         = 0.0F;
     exit_speed          = 0.0F;
     acceleration        = 100.0F; // we don't want to get divide by zeroes if this is not set
+    jerk                = 0.0F;
+    is_scurve           = false;
+    secondary           = false;
     initial_rate        = 0.0F;
     accelerate_until    = 0;
     decelerate_after    = 0;
@@ -69,6 +88,9 @@ void Block::clear()
     is_ticking          = false;
     is_g123             = false;
     locked              = false;
+    needs_prepare       = false;
+    preplanned          = false;
+    held                = false;
     s_value             = 0.0F;
 
     total_move_ticks= 0;
@@ -87,6 +109,8 @@ void Block::clear()
         tick_info[i].acceleration_change= 0;
         tick_info[i].deceleration_change= 0;
         tick_info[i].plateau_rate= 0;
+        tick_info[i].jerk= 0;
+        tick_info[i].decel_jerk= 0;
         tick_info[i].steps_to_move= 0;
         tick_info[i].step_count= 0;
         tick_info[i].next_accel_event= 0;
@@ -136,7 +160,32 @@ void Block::debug() const
 void Block::calculate_trapezoid( float entryspeed, float exitspeed )
 {
     // if block is currently executing, don't touch anything!
-    if (is_ticking) return;
+    if (is_ticking || preplanned) return;
+
+    if(lazy_prepare) {
+        // the planner may well change this block again before it gets anywhere near the step ticker, so just remember the
+        // exit speed (entry speed is already set) and let the Conveyor call update_trapezoid() when this block is about to be used
+        this->exit_speed = exitspeed;
+        this->needs_prepare= true;
+        return;
+    }
+
+    compute_trapezoid(entryspeed, exitspeed);
+}
+
+// does the work calculate_trapezoid() deferred in lazy_prepare mode, called from the main loop
+void Block::update_trapezoid()
+{
+    if(!needs_prepare || is_ticking) return;
+    compute_trapezoid(this->entry_speed, this->exit_speed);
+    this->needs_prepare= false;
+}
+
+void Block::compute_trapezoid( float entryspeed, float exitspeed )
+{
+    // use the jerk limited profile if it is enabled and this move is long enough for it, otherwise fall back to a trapezoid
+    if(this->jerk > 0.0F && compute_scurve(entryspeed, exitspeed)) return;
+    this->is_scurve= false;
 
     float initial_rate = this->nominal_rate * (entryspeed / this->nominal_speed); // steps/sec
     float final_rate = this->nominal_rate * (exitspeed / this->nominal_speed);
@@ -225,6 +274,130 @@ void Block::calculate_trapezoid( float entryspeed, float exitspeed )
     this->locked= false;
 }
 
+// works out the jerk ramp time and the constant acceleration time needed to change rate by dv steps/sec without going over
+// the acceleration or the jerk. If dv is too small to ever reach full acceleration the constant acceleration time is zero
+static void scurve_ramp(float dv, float acceleration, float jerk, float &jerk_time, float &constant_time)
+{
+    jerk_time = std::min(acceleration / jerk, sqrtf(dv / jerk));
+    constant_time = jerk_time > 0.0F ? std::max(0.0F, dv / (jerk * jerk_time) - jerk_time) : 0.0F;
+}
+
+// steps travelled while changing rate between from and to, the s-curve is symmetrical so the average rate is the midpoint
+static float scurve_ramp_distance(float from, float to, float acceleration, float jerk)
+{
+    float jt, ct;
+    scurve_ramp(fabsf(to - from), acceleration, jerk, jt, ct);
+    return ((from + to) / 2.0F) * (2.0F * jt + ct);
+}
+
+/*
+  Jerk limited version of compute_trapezoid(), the acceleration itself ramps up and down at the jerk rate giving 7 phases...
+  jerk+, constant acceleration, jerk-, plateau, jerk-, constant deceleration, jerk+
+  The planner still plans junction speeds with constant acceleration, so an s-curve needs more room to make the same speed change.
+  Returns false if the block is too short to get from the entry to the exit speed within the jerk limit, the caller then uses a trapezoid.
+*/
+bool Block::compute_scurve( float entryspeed, float exitspeed )
+{
+    float initial_rate = this->nominal_rate * (entryspeed / this->nominal_speed); // steps/sec
+    float final_rate = this->nominal_rate * (exitspeed / this->nominal_speed);
+    float acceleration_per_second = (this->acceleration * this->steps_event_count) / this->millimeters; // steps/sec²
+    float jerk_per_second = (this->jerk * this->steps_event_count) / this->millimeters; // steps/sec³
+
+    // see if we can reach the nominal rate, if not find the highest rate we can reach by bisection
+    float max_rate = this->nominal_rate;
+    float accel_distance = scurve_ramp_distance(initial_rate, max_rate, acceleration_per_second, jerk_per_second);
+    float decel_distance = scurve_ramp_distance(max_rate, final_rate, acceleration_per_second, jerk_per_second);
+    if(accel_distance + decel_distance > this->steps_event_count) {
+        float lo = std::max(initial_rate, final_rate);
+        float hi = this->nominal_rate;
+        if(scurve_ramp_distance(initial_rate, lo, acceleration_per_second, jerk_per_second) + scurve_ramp_distance(lo, final_rate, acceleration_per_second, jerk_per_second) > this->steps_event_count) {
+            return false; // can't be done even without a plateau
+        }
+        for (int i = 0; i < 16; ++i) {
+            float mid = (lo + hi) / 2.0F;
+            if(scurve_ramp_distance(initial_rate, mid, acceleration_per_second, jerk_per_second) + scurve_ramp_distance(mid, final_rate, acceleration_per_second, jerk_per_second) > this->steps_event_count) {
+                hi = mid;
+            } else {
+                lo = mid;
+            }
+        }
+        max_rate = lo;
+        accel_distance = scurve_ramp_distance(initial_rate, max_rate, acceleration_per_second, jerk_per_second);
+        decel_distance = scurve_ramp_distance(max_rate, final_rate, acceleration_per_second, jerk_per_second);
+    }
+    if(max_rate <= 0.0F) return false;
+
+    float plateau_time = (this->steps_event_count - accel_distance - decel_distance) / max_rate;
+
+    // round each phase to ticks, then work out the jerk that hits the rates exactly in that many ticks
+    // with j=jerk per tick, n1 jerk ticks and n2 constant ticks the rate changes by j*n1*(n1+n2)
+    float jt, ct;
+    scurve_ramp(max_rate - initial_rate, acceleration_per_second, jerk_per_second, jt, ct);
+    uint32_t accel_jerk_ticks = roundf(jt * STEP_TICKER_FREQUENCY);
+    uint32_t accel_constant_ticks = roundf(ct * STEP_TICKER_FREQUENCY);
+    if(accel_jerk_ticks == 0 && max_rate > initial_rate) accel_jerk_ticks = 1;
+
+    scurve_ramp(max_rate - final_rate, acceleration_per_second, jerk_per_second, jt, ct);
+    uint32_t decel_jerk_ticks = roundf(jt * STEP_TICKER_FREQUENCY);
+    uint32_t decel_constant_ticks = roundf(ct * STEP_TICKER_FREQUENCY);
+    if(decel_jerk_ticks == 0 && max_rate > final_rate) decel_jerk_ticks = 1;
+
+    uint32_t plateau_ticks = floorf(plateau_time * STEP_TICKER_FREQUENCY);
+
+    // steps/tick³ for the primary axis
+    float accel_jerk = accel_jerk_ticks > 0 ? ((max_rate - initial_rate) / STEP_TICKER_FREQUENCY) / ((float)accel_jerk_ticks * (accel_jerk_ticks + accel_constant_ticks)) : 0;
+    float decel_jerk = decel_jerk_ticks > 0 ? ((max_rate - final_rate) / STEP_TICKER_FREQUENCY) / ((float)decel_jerk_ticks * (decel_jerk_ticks + decel_constant_ticks)) : 0;
+    if((accel_jerk_ticks > 0 && accel_jerk * STEPTICKER_FPSCALE < 1.0F) || (decel_jerk_ticks > 0 && decel_jerk * STEPTICKER_FPSCALE < 1.0F)) {
+        return false; // too small to represent in fixed point
+    }
+
+    // we have a potential race condition here as we could get interrupted anywhere in the middle of this call, we need to lock
+    // the updates to the blocks to get around it
+    this->locked= true;
+    this->scurve_phase_end[0] = accel_jerk_ticks;
+    this->scurve_phase_end[1] = this->scurve_phase_end[0] + accel_constant_ticks;
+    this->scurve_phase_end[2] = this->scurve_phase_end[1] + accel_jerk_ticks;
+    this->scurve_phase_end[3] = this->scurve_phase_end[2] + plateau_ticks;
+    this->scurve_phase_end[4] = this->scurve_phase_end[3] + decel_jerk_ticks;
+    this->scurve_phase_end[5] = this->scurve_phase_end[4] + decel_constant_ticks;
+    this->accelerate_until = this->scurve_phase_end[2];
+    this->decelerate_after = this->scurve_phase_end[3];
+    this->total_move_ticks = this->scurve_phase_end[5] + decel_jerk_ticks;
+
+    this->maximum_rate = max_rate;
+    this->initial_rate = initial_rate;
+    this->exit_speed = exitspeed;
+    this->is_scurve = true;
+
+    // prepare the block for stepticker
+    this->prepare_scurve(accel_jerk, decel_jerk);
+
+    this->locked= false;
+    return true;
+}
+
+// the time in seconds a move takes with the same trapezoid compute_trapezoid() works out, but in mm rather than steps
+// and without rounding to ticks, for estimating how long moves will take without planning them for real
+float Block::trapezoid_time(float millimeters, float acceleration, float nominal_speed, float entry_speed, float exit_speed)
+{
+    if(millimeters <= 0.0F || nominal_speed <= 0.0F) return 0.0F;
+
+    float maximum_possible_speed = sqrtf( ( millimeters * acceleration ) + ( ( powf(entry_speed, 2) + powf(exit_speed, 2) ) / 2.0F ) );
+    float maximum_speed = std::min(maximum_possible_speed, nominal_speed);
+
+    float time_to_accelerate = std::max(0.0F, ( maximum_speed - entry_speed ) / acceleration);
+    float time_to_decelerate = std::max(0.0F, ( maximum_speed - exit_speed ) / acceleration);
+
+    float plateau_time = 0;
+    if(maximum_possible_speed > nominal_speed) {
+        float acceleration_distance = ( ( entry_speed + maximum_speed ) / 2.0F ) * time_to_accelerate;
+        float deceleration_distance = ( ( maximum_speed + exit_speed ) / 2.0F ) * time_to_decelerate;
+        plateau_time = std::max(0.0F, millimeters - acceleration_distance - deceleration_distance) / maximum_speed;
+    }
+
+    return time_to_accelerate + time_to_decelerate + plateau_time;
+}
+
 // Calculates the maximum allowable speed at this point when you must be able to reach target_velocity using the
 // acceleration within the allotted distance.
 float Block::max_allowable_speed(float acceleration, float target_velocity, float distance)
@@ -276,6 +449,10 @@ float Block::forward_pass(float prev_max_exit_speed)
         // since we're now acceleration or cruise limited
         // we don't need to recalculate our entry speed anymore
         recalculate_flag = false;
+
+    } else if (entry_speed == max_entry_speed) {
+        // we are already at our maximum entry speed, adding more blocks can only raise entry speeds so this can never change
+        recalculate_flag = false;
     }
     // else
     // // decel limited, do nothing
@@ -287,7 +464,7 @@ float Block::max_exit_speed()
 {
     // if block is currently executing, return cached exit speed from calculate_trapezoid
     // this ensures that a block following a currently executing block will have correct entry speed
-    if(is_ticking)
+    if(is_ticking || preplanned)
         return this->exit_speed;
 
     // if nominal_length_flag is asserted
@@ -302,6 +479,25 @@ float Block::max_exit_speed()
     return min(max, nominal_speed);
 }
 
+// a block planned by the host, with the ticks and rates compute_trapezoid() would have worked out on the same step frequency
+void Block::set_planned_trapezoid(uint32_t accelerate_until, uint32_t decelerate_after, uint32_t total_move_ticks, float initial_rate, float maximum_rate, float final_rate)
+{
+    float acceleration_time = accelerate_until / STEP_TICKER_FREQUENCY;
+    float deceleration_time = (total_move_ticks - decelerate_after) / STEP_TICKER_FREQUENCY;
+    float acceleration_in_steps = (acceleration_time > 0.0F ) ? ( maximum_rate - initial_rate ) / acceleration_time : 0;
+    float deceleration_in_steps = (deceleration_time > 0.0F ) ? ( maximum_rate - final_rate ) / deceleration_time : 0;
+
+    this->preplanned = true;
+    this->is_scurve = false;
+    this->accelerate_until = accelerate_until;
+    this->decelerate_after = decelerate_after;
+    this->total_move_ticks = total_move_ticks;
+    this->initial_rate = initial_rate;
+    this->maximum_rate = maximum_rate;
+
+    this->prepare(acceleration_in_steps, deceleration_in_steps);
+}
+
 // prepare block for the step ticker, called everytime the block changes
 // this is done during planning so does not delay tick generation and step ticker can simply grab the next block during the interrupt
 void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
@@ -314,9 +510,16 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
     // was....
     // float acceleration_per_tick = acceleration_in_steps / STEP_TICKER_FREQUENCY_2; // that is 100,000² too big for a float
     // float deceleration_per_tick = deceleration_in_steps / STEP_TICKER_FREQUENCY_2;
-    double acceleration_per_tick = acceleration_in_steps * fp_scale; // this is now scaled to fit a 2.30 fixed point number
+    double acceleration_per_tick = acceleration_in_steps * fp_scale; // this is now scaled to fit the fixed point number
     double deceleration_per_tick = deceleration_in_steps * fp_scale;
 
+    // the motors after XYZ go on the secondary tick if they never need more than a step every secondary tick in this block
+    uint8_t divider = StepTicker::getInstance()->get_secondary_divider();
+    this->secondary = divider > 1;
+    for (uint8_t m = 0; m < n_actuators && this->secondary; m++) {
+        if(StepTicker::is_secondary_motor(m) && this->maximum_rate * inv * this->steps[m] * divider >= STEP_TICKER_FREQUENCY) this->secondary = false;
+    }
+
     for (uint8_t m = 0; m < n_actuators; m++) {
         uint32_t steps = this->steps[m];
         this->tick_info[m].steps_to_move = steps;
@@ -324,8 +527,16 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
 
         float aratio = inv * steps;
 
-        this->tick_info[m].steps_per_tick = (int64_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE); // steps/sec / tick frequency to get steps per tick in 2.62 fixed point
-        this->tick_info[m].counter = 0; // 2.62 fixed point
+        // on the secondary tick the rates are per secondary tick and it accelerates by divider² as much each tick
+        double frequency = STEP_TICKER_FREQUENCY;
+        double accel_scale = 1;
+        if(this->secondary && StepTicker::is_secondary_motor(m)) {
+            frequency /= divider;
+            accel_scale = (double)divider * divider;
+        }
+
+        this->tick_info[m].steps_per_tick = (stepticker_fp_t)round((((double)this->initial_rate * aratio) / frequency) * STEPTICKER_FPSCALE); // steps/sec / tick frequency to get steps per tick in fixed point
+        this->tick_info[m].counter = 0;
         this->tick_info[m].step_count = 0;
         this->tick_info[m].next_accel_event = this->total_move_ticks + 1;
 
@@ -344,24 +555,74 @@ void Block::prepare(float acceleration_in_steps, float deceleration_in_steps)
         }
 
         // already converted to fixed point just needs scaling by ratio
-        //#define STEPTICKER_TOFP(x) ((int64_t)round((double)(x)*STEPTICKER_FPSCALE))
-        this->tick_info[m].acceleration_change= (int64_t)round(acceleration_change * aratio);
-        this->tick_info[m].deceleration_change= -(int64_t)round(deceleration_per_tick * aratio);
-        this->tick_info[m].plateau_rate= (int64_t)round(((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        //#define STEPTICKER_TOFP(x) ((stepticker_fp_t)round((double)(x)*STEPTICKER_FPSCALE))
+        this->tick_info[m].acceleration_change= (stepticker_fp_t)round(acceleration_change * aratio * accel_scale);
+        this->tick_info[m].deceleration_change= -(stepticker_fp_t)round(deceleration_per_tick * aratio * accel_scale);
+        this->tick_info[m].plateau_rate= (stepticker_fp_t)round(((this->maximum_rate * aratio) / frequency) * STEPTICKER_FPSCALE);
 
         #if 0
         THEKERNEL->streams->printf("spt: %08lX %08lX, ac: %08lX %08lX, dc: %08lX %08lX, pr: %08lX %08lX\n",
-            (uint32_t)(this->tick_info[m].steps_per_tick>>32), // 2.62 fixed point
-            (uint32_t)(this->tick_info[m].steps_per_tick&0xFFFFFFFF), // 2.62 fixed point
-            (uint32_t)(this->tick_info[m].acceleration_change>>32), // 2.62 fixed point signed
-            (uint32_t)(this->tick_info[m].acceleration_change&0xFFFFFFFF), // 2.62 fixed point signed
-            (uint32_t)(this->tick_info[m].deceleration_change>>32), // 2.62 fixed point
-            (uint32_t)(this->tick_info[m].deceleration_change&0xFFFFFFFF), // 2.62 fixed point
-            (uint32_t)(this->tick_info[m].plateau_rate>>32), // 2.62 fixed point
-            (uint32_t)(this->tick_info[m].plateau_rate&0xFFFFFFFF) // 2.62 fixed point
+            (uint32_t)((int64_t)this->tick_info[m].steps_per_tick>>32), // 2.62 fixed point
+            (uint32_t)((int64_t)this->tick_info[m].steps_per_tick&0xFFFFFFFF), // 2.62 fixed point
+            (uint32_t)((int64_t)this->tick_info[m].acceleration_change>>32), // 2.62 fixed point signed
+            (uint32_t)((int64_t)this->tick_info[m].acceleration_change&0xFFFFFFFF), // 2.62 fixed point signed
+            (uint32_t)((int64_t)this->tick_info[m].deceleration_change>>32), // 2.62 fixed point
+            (uint32_t)((int64_t)this->tick_info[m].deceleration_change&0xFFFFFFFF), // 2.62 fixed point
+            (uint32_t)((int64_t)this->tick_info[m].plateau_rate>>32), // 2.62 fixed point
+            (uint32_t)((int64_t)this->tick_info[m].plateau_rate&0xFFFFFFFF) // 2.62 fixed point
         );
         #endif
     }
+
+    prepare_advance();
+}
+
+// prepare an s-curve block for the step ticker, the jerks are in steps/tick³ for the primary axis
+// the step ticker handles the phase changes, acceleration_change starts at zero and gets jerk added to it every tick in the jerk phases
+void Block::prepare_scurve(float accel_jerk, float decel_jerk)
+{
+    float inv = 1.0F / this->steps_event_count;
+    this->secondary = false; // the phases are not worked out for the secondary tick
+
+    for (uint8_t m = 0; m < n_actuators; m++) {
+        uint32_t steps = this->steps[m];
+        this->tick_info[m].steps_to_move = steps;
+        if(steps == 0) continue;
+
+        float aratio = inv * steps;
+
+        this->tick_info[m].steps_per_tick = (stepticker_fp_t)round((((double)this->initial_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+        this->tick_info[m].counter = 0;
+        this->tick_info[m].step_count = 0;
+        this->tick_info[m].next_accel_event = this->total_move_ticks + 1; // the trapezoid events are not used
+        this->tick_info[m].acceleration_change = 0;
+        this->tick_info[m].deceleration_change = 0;
+        this->tick_info[m].jerk = (stepticker_fp_t)round((double)accel_jerk * aratio * STEPTICKER_FPSCALE);
+        this->tick_info[m].decel_jerk = (stepticker_fp_t)round((double)decel_jerk * aratio * STEPTICKER_FPSCALE);
+        this->tick_info[m].plateau_rate = (stepticker_fp_t)round(((this->maximum_rate * aratio) / STEP_TICKER_FREQUENCY) * STEPTICKER_FPSCALE);
+    }
+
+    prepare_advance();
+}
+
+// pressure advance keeps the extruder k seconds of its speed ahead of the plan, so at the end of the block it wants to be
+// k * its exit rate steps ahead. Retracts and moves where it is the only (or the primary) motor are left alone
+void Block::prepare_advance()
+{
+    this->advance_motor = 0xFF;
+    this->advance_steps = 0;
+    if(this->nominal_speed <= 0.0F) return;
+
+    for (uint8_t m = 0; m < n_actuators; m++) {
+        if(this->steps[m] == 0 || this->direction_bits[m] || m == this->primary_motor) continue;
+        float k = StepTicker::getInstance()->get_pressure_advance(m);
+        if(k <= 0.0F) continue;
+
+        float final_rate = this->nominal_rate * (this->exit_speed / this->nominal_speed) * this->steps[m] / this->steps_event_count;
+        this->advance_motor = m;
+        this->advance_steps = lroundf(k * final_rate);
+        break;
+    }
 }
 
 // returns current rate (steps/sec) for the given actuator
@@ -369,5 +630,7 @@ float Block::get_trapezoid_rate(int i) const
 {
     // convert steps per tick from fixed point to float and convert to steps/sec
     // FIXME steps_per_tick can change at any time, potential race condition if it changes while being read here
-    return STEPTICKER_FROMFP(tick_info[i].steps_per_tick) * STEP_TICKER_FREQUENCY;
+    float f = STEP_TICKER_FREQUENCY;
+    if(this->secondary && StepTicker::is_secondary_motor(i)) f /= StepTicker::getInstance()->get_secondary_divider();
+    return STEPTICKER_FROMFP(tick_info[i].steps_per_tick) * f;
 }
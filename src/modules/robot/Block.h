@@ -10,6 +10,7 @@
 #include <vector>
 #include <bitset>
 #include "ActuatorCoordinates.h"
+#include "StepTicker.h"
 
 class Block {
     public:
@@ -18,6 +19,7 @@ class Block {
         static void init(uint8_t);
 
         void calculate_trapezoid( float entry_speed, float exit_speed );
+        void update_trapezoid();
 
         float reverse_pass(float exit_speed);
         float forward_pass(float next_entry_speed);
@@ -26,22 +28,38 @@ class Block {
         void ready() { is_ready= true; }
         void clear();
         float get_trapezoid_rate(int i) const;
+        static float trapezoid_time(float millimeters, float acceleration, float nominal_speed, float entry_speed, float exit_speed);
+        void set_planned_trapezoid(uint32_t accelerate_until, uint32_t decelerate_after, uint32_t total_move_ticks, float initial_rate, float maximum_rate, float final_rate);
 
     private:
+        void compute_trapezoid( float entry_speed, float exit_speed );
+        bool compute_scurve( float entry_speed, float exit_speed );
         float max_allowable_speed( float acceleration, float target_velocity, float distance);
         void prepare(float acceleration_in_steps, float deceleration_in_steps);
+        void prepare_scurve(float accel_jerk, float decel_jerk);
+        void prepare_advance();
 
         static double fp_scale; // optimize to store this as it does not change
 
     public:
         std::array<uint32_t, k_max_actuators> steps; // Number of steps for each axis for this block
         uint32_t steps_event_count;  // Steps for the longest axis
+        uint32_t rate_scale;         // 2^18 * tick frequency / nominal_rate, turns the steps_per_tick of primary_motor into a fraction of nominal
+        uint8_t primary_motor;       // the motor with steps_event_count steps
+        uint16_t raster_count;       // laser power values spread along the steps of the primary motor, 0 if it is not a raster move
+        uint32_t raster_start;       // position in the laser raster data of the first one
+        int32_t advance_steps;       // pressure advance wanted at the end of the block, in steps of advance_motor
+        uint8_t advance_motor;       // the motor pressure advance applies to in this block, 0xFF if none
+        uint8_t backlash_motors;     // bit per motor that has its backlash steps added to steps in this block
+        uint32_t sync_seq;           // the sequence number of a held block, see Conveyor::hold_blocks()
+        uint32_t source_line;        // the line it was queued from, see Robot::set_source_line(), 0 if not known
         float nominal_rate;       // Nominal rate in steps per second
         float nominal_speed;      // Nominal speed in mm per second
         float millimeters;        // Distance for this move
         float entry_speed;
         float exit_speed;
         float acceleration;       // the acceleration for this block
+        float jerk;               // the jerk for this block in mm/sec³, 0 for a constant acceleration trapezoid
         float initial_rate;       // Initial rate in steps per second
         float maximum_rate;
 
@@ -51,15 +69,20 @@ class Block {
         uint32_t accelerate_until;
         uint32_t decelerate_after;
         uint32_t total_move_ticks;
+        // ticks at which each phase of an s-curve ends: jerk+, constant accel, jerk-, plateau, jerk-, constant decel (jerk+ ends at total_move_ticks)
+        std::array<uint32_t, 6> scurve_phase_end;
         std::bitset<k_max_actuators> direction_bits;     // Direction for each axis in bit form, relative to the direction port's mask
 
         // this is the data needed to determine when each motor needs to be issued a step
+        // stepticker_fp_t is 2.62 fixed point, or 2.30 when built with STEPTICKER_FP32
         using tickinfo_t= struct {
-            int64_t steps_per_tick; // 2.62 fixed point
-            int64_t counter; // 2.62 fixed point
-            int64_t acceleration_change; // 2.62 fixed point signed
-            int64_t deceleration_change; // 2.62 fixed point
-            int64_t plateau_rate; // 2.62 fixed point
+            stepticker_fp_t steps_per_tick;
+            stepticker_fp_t counter;
+            stepticker_fp_t acceleration_change; // signed
+            stepticker_fp_t deceleration_change;
+            stepticker_fp_t plateau_rate;
+            stepticker_fp_t jerk; // signed change in acceleration_change per tick, s-curve only
+            stepticker_fp_t decel_jerk; // jerk used for deceleration, s-curve only
             uint32_t steps_to_move;
             uint32_t step_count;
             uint32_t next_accel_event;
@@ -68,7 +91,11 @@ class Block {
         // need info for each active motor
         tickinfo_t *tick_info;
 
+        // use the given tick info instead of allocating it, used by BlockQueue which allocates it for all the blocks in one go
+        explicit Block(tickinfo_t *ti);
+
         static uint8_t n_actuators;
+        static bool lazy_prepare; // if set calculate_trapezoid() only records the speeds and update_trapezoid() does the work later
 
         struct {
             bool recalculate_flag:1;             // Planner flag to recalculate trapezoids on entry junction
@@ -78,6 +105,11 @@ class Block {
             bool is_g123:1;                      // set if this is a G1, G2 or G3
             volatile bool is_ticking:1;          // set when this block is being actively ticked by the stepticker
             volatile bool locked:1;              // set to true when the critical data is being updated, stepticker will have to skip if this is set
+            bool is_scurve:1;                    // set if the block uses the jerk limited s-curve profile
+            bool secondary:1;                    // set if the motors after XYZ are stepped by the secondary tick, see StepTicker
+            volatile bool needs_prepare:1;       // set when the trapezoid and tick info are out of date (lazy_prepare), stepticker will have to skip if this is set
+            bool preplanned:1;                   // set if the trapezoid came from the host, the planner leaves it as it is
+            volatile bool held:1;                // set if the stepticker has to wait for the conveyor to release sync_seq before it can have this
             uint16_t s_value:12;                 // for laser 1.11 Fixed point
         };
 };
@@ -2,6 +2,7 @@
 #include "Block.h"
 
 #include <cstdlib>
+#include <new>
 #include "cmsis.h"
 #include "platform_memory.h"
 
@@ -11,19 +12,19 @@
 
 BlockQueue::BlockQueue()
 {
-    head_i = tail_i = length = 0;
+    head_i = tail_i = length = capacity = 0;
     isr_tail_i = tail_i;
     ring = nullptr;
+    pool = &AHB0;
 }
 
 BlockQueue::BlockQueue(unsigned int length)
 {
     head_i = tail_i = 0;
     isr_tail_i = tail_i;
-    void *v= AHB0.alloc(sizeof(Block) * length);
-    ring = new(v) Block[length];
-    // TODO: handle allocation failure
-    this->length = length;
+    pool = &AHB0;
+    ring = create_ring(length);
+    this->length = capacity = ring == nullptr ? 0 : length;
 }
 
 /*
@@ -32,13 +33,46 @@ BlockQueue::BlockQueue(unsigned int length)
 
 BlockQueue::~BlockQueue()
 {
-    head_i = tail_i = length = 0;
+    head_i = tail_i = length = capacity = 0;
     isr_tail_i = tail_i;
     if(ring != nullptr)
-        AHB0.dealloc(ring); // delete [] ring;
+        destroy_ring(ring);
     ring = nullptr;
 }
 
+/*
+ * the blocks and the tick info for all of them are allocated as one contiguous arena,
+ * the tick info follows the blocks as one array so all the step ticker data for the queue is kept together
+ */
+
+Block* BlockQueue::create_ring(unsigned int length)
+{
+    size_t blocks_size = (sizeof(Block) * length + 7) & ~7; // keep the tick info 64 bit aligned
+    size_t size = blocks_size + sizeof(Block::tickinfo_t) * Block::n_actuators * length;
+
+    void *v = nullptr;
+    if (pool != nullptr) v = pool->alloc(size);
+    if (v == nullptr && pool != &AHB0) v = AHB0.alloc(size);
+    if (v == nullptr && pool != &AHB1) v = AHB1.alloc(size);
+    if (v == nullptr) v = malloc(size);
+    if (v == nullptr) return nullptr;
+
+    Block *r = (Block *)v;
+    Block::tickinfo_t *ti = (Block::tickinfo_t *)((uint8_t *)v + blocks_size);
+    for (unsigned int i = 0; i < length; ++i) {
+        new(&r[i]) Block(&ti[i * Block::n_actuators]);
+    }
+
+    return r;
+}
+
+void BlockQueue::destroy_ring(Block *r)
+{
+    if (AHB0.has(r)) AHB0.dealloc(r);
+    else if (AHB1.has(r)) AHB1.dealloc(r);
+    else free(r);
+}
+
 /*
  * index accessors (protected)
  */
@@ -116,16 +150,20 @@ Block* BlockQueue::item_ref(unsigned int i)
     return &ring[i];
 }
 
+// the block must be completely written before the step ticker can see the new head
 void BlockQueue::produce_head()
 {
     while (is_full());
+    __DMB();
     head_i = next(head_i);
 }
 
 void BlockQueue::consume_tail()
 {
-    if (!is_empty())
+    if (!is_empty()) {
+        __DMB();
         tail_i = next(tail_i);
+    }
 }
 
 /*
@@ -150,6 +188,16 @@ bool BlockQueue::is_empty() const
     return r;
 }
 
+unsigned int BlockQueue::count() const
+{
+    return (head_i + length - tail_i) % length;
+}
+
+unsigned int BlockQueue::space() const
+{
+    return length - 1 - count();
+}
+
 /*
  * resize
  */
@@ -164,12 +212,12 @@ bool BlockQueue::resize(unsigned int length)
 
             if (is_empty()) // check again in case something was pushed
             {
-                head_i = tail_i = this->length = 0;
+                head_i = tail_i = isr_tail_i = this->length = capacity = 0;
 
                 __enable_irq();
 
                 if (ring != nullptr)
-                    AHB0.dealloc(ring); // delete [] ring;
+                    destroy_ring(ring);
                 ring = nullptr;
 
                 return true;
@@ -180,9 +228,28 @@ bool BlockQueue::resize(unsigned int length)
             return false;
         }
 
+        // the ring already has room, the blocks past the new length are left as they are, all cleared once the queue emptied
+        if (length <= capacity)
+        {
+            __disable_irq();
+
+            if (is_empty())
+            {
+                this->length = length;
+                head_i = tail_i = isr_tail_i = 0;
+
+                __enable_irq();
+
+                return true;
+            }
+
+            __enable_irq();
+
+            return false;
+        }
+
         // Note: we don't use realloc so we can fall back to the existing ring if allocation fails
-        void *v= AHB0.alloc(sizeof(Block) * length);
-        Block* newring = new(v) Block[length];
+        Block* newring = create_ring(length);
 
         if (newring != nullptr)
         {
@@ -193,20 +260,20 @@ bool BlockQueue::resize(unsigned int length)
             if (is_empty()) // check again in case something was pushed while malloc did its thing
             {
                 ring = newring;
-                this->length = length;
-                head_i = tail_i = 0;
+                this->length = capacity = length;
+                head_i = tail_i = isr_tail_i = 0;
 
                 __enable_irq();
 
                 if (oldring != nullptr)
-                    AHB0.dealloc(oldring); // delete [] oldring;
+                    destroy_ring(oldring);
 
                 return true;
             }
 
             __enable_irq();
 
-            AHB0.dealloc(newring); // delete [] newring;
+            destroy_ring(newring);
         }
     }
 
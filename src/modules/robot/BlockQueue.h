@@ -1,12 +1,14 @@
 #pragma once
 
 class Block;
+class MemoryPool;
 
 class BlockQueue {
 
     // friend classes
     friend class Planner;
     friend class Conveyor;
+    friend class MultiNode;
 
 public:
     BlockQueue();
@@ -37,13 +39,23 @@ public:
      */
     bool is_empty(void) const;
     bool is_full(void) const;
+    unsigned int count(void) const; // number of blocks queued including the one being executed
+    unsigned int space(void) const; // number of blocks that can be queued before it is full
 
     /*
      * resize
      *
+     * a length up to the one already allocated uses the same ring, so a queue can be reserved once and its depth changed later
      * returns true on success, or false if queue is not empty or not enough memory available
      */
     bool resize(unsigned int);
+    unsigned int get_capacity() const { return capacity; } // the most blocks the allocated ring can hold
+
+    /*
+     * set the memory pool the queue is allocated from on the next resize,
+     * falls back to the other AHB pool and then the heap if it does not fit
+     */
+    void set_pool(MemoryPool *p) { pool= p; }
 
     /*
      * provide
@@ -77,5 +89,10 @@ protected:
     volatile unsigned int isr_tail_i;
 
 private:
+    Block* create_ring(unsigned int length);
+    static void destroy_ring(Block *);
+
     Block* ring;
+    unsigned int capacity;
+    MemoryPool *pool;
 };
@@ -22,14 +22,21 @@
 #include "StepTicker.h"
 #include "Robot.h"
 #include "StepperMotor.h"
+#include "platform_memory.h"
 
 #include <functional>
 #include <vector>
+#include <string>
+#include <algorithm>
 
 #include "mbed.h"
 
 #define planner_queue_size_checksum CHECKSUM("planner_queue_size")
+#define planner_queue_max_size_checksum CHECKSUM("planner_queue_max_size")
 #define queue_delay_time_ms_checksum CHECKSUM("queue_delay_time_ms")
+#define planner_adaptive_release_checksum CHECKSUM("planner_adaptive_release")
+#define planner_lazy_prepare_blocks_checksum CHECKSUM("planner_lazy_prepare_blocks")
+#define planner_queue_memory_checksum CHECKSUM("planner_queue_memory")
 
 /*
  * The conveyor holds the queue of blocks, takes care of creating them, and starting the executing chain of blocks
@@ -64,27 +71,63 @@ Conveyor::Conveyor()
     running = false;
     allow_fetch = false;
     flush= false;
+    block_ended= false;
+    starving= false;
+    last_append= 0;
+    append_interval_us= 0;
+    held_mm= held_seconds= held_needed_mm= 0;
+    hold= false;
+    held_seq= released_seq= 0;
+    held_started= nullptr;
+    reset_stats();
 }
 
 void Conveyor::on_module_loaded()
 {
-    register_for_event(ON_IDLE);
+    register_for_event(ON_IDLE, PRIORITY_HIGH);
     register_for_event(ON_HALT);
 
     // Attach to the end_of_move stepper event
     //THEKERNEL->step_ticker->finished_fnc = std::bind( &Conveyor::all_moves_finished, this);
     queue_size = THEKERNEL->config->value(planner_queue_size_checksum)->by_default(32)->as_number();
+    if(queue_size < 2) queue_size= 2;
+    // the blocks reserved at boot, M579 can change the queue size up to this without allocating anything
+    queue_max_size = THEKERNEL->config->value(planner_queue_max_size_checksum)->by_default((int)queue_size)->as_number();
+    if(queue_max_size < queue_size) queue_max_size= queue_size;
     queue_delay_time_ms = THEKERNEL->config->value(queue_delay_time_ms_checksum)->by_default(100)->as_number();
+    // release the blocks to the step ticker once there are enough to plan them well, or nothing more is coming, see ready_to_release()
+    // otherwise they are held until the queue is full or for queue_delay_time_ms, which is still the longest they are held for
+    adaptive_release = THEKERNEL->config->value(planner_adaptive_release_checksum)->by_default(true)->as_bool();
+    // defer the trapezoid and tick info maths until a block is this close to being executed, 0 does it every time the block is planned
+    // NOTE if the main loop stalls for longer than it takes to execute this many blocks then the motion will stop abruptly
+    lazy_prepare_blocks = THEKERNEL->config->value(planner_lazy_prepare_blocks_checksum)->by_default(0)->as_number();
+
+    // which AHB bank the queue and its tick info are allocated in, ahb0 or ahb1. If it does not fit it goes in the other one or the main heap
+    std::string mem = THEKERNEL->config->value(planner_queue_memory_checksum)->by_default("ahb0")->as_string();
+    queue.set_pool(mem == "ahb1" ? &AHB1 : &AHB0);
 }
 
 // we allocate the queue here after config is completed so we do not run out of memory during config
 void Conveyor::start(uint8_t n)
 {
     Block::init(n); // set the number of motors which determines how big the tick info vector is
+    Block::lazy_prepare= lazy_prepare_blocks > 0;
+    queue.resize(queue_max_size);
     queue.resize(queue_size);
     running = true;
 }
 
+// changes how many blocks the planner queue holds, for instance a deep one for a job of short segments and a short one
+// for interactive use, waits for the queue to empty first. Only the blocks reserved at boot can be used so it never allocates
+bool Conveyor::set_queue_size(size_t n)
+{
+    if(n < 2 || n > queue.get_capacity()) return false;
+    wait_for_idle();
+    if(!queue.resize(n)) return false;
+    queue_size= n;
+    return true;
+}
+
 void Conveyor::on_halt(void* argument)
 {
     if(argument == nullptr) {
@@ -97,6 +140,7 @@ void Conveyor::on_idle(void*)
     if (running) {
         check_queue();
     }
+    run_idle_actions();
 
     // we can garbage collect the block queue here
     if (queue.tail_i != queue.isr_tail_i) {
@@ -130,6 +174,11 @@ bool Conveyor::is_idle() const
 // Wait for the queue to be empty and for all the jobs to finish in step ticker
 void Conveyor::wait_for_idle(bool wait_for_motors)
 {
+    // a merged line or part of a segmented move may still be waiting to be queued
+    THEROBOT->finish_pending_moves();
+    // a cancelled jog is held stopped in the queue until Robot drops it
+    THEROBOT->wait_for_jogs();
+
     // wait for the job queue to empty, this means cycling everything on the block queue into the job queue
     // forcing them to be jobs
     running = false; // stops on_idle calling check_queue
@@ -144,6 +193,7 @@ void Conveyor::wait_for_idle(bool wait_for_motors)
             THEKERNEL->call_event(ON_IDLE, this);
         }
     }
+    run_idle_actions();
 
     running = true;
     // returning now means that everything has totally finished
@@ -154,44 +204,145 @@ void Conveyor::wait_for_idle(bool wait_for_motors)
  */
 void Conveyor::queue_head_block()
 {
+    // the main loop time since the last block was queued is what it took to make this one, unless it was idle for a while
+    uint32_t now= us_ticker_read();
+    if(last_append != 0 && now - last_append < 1000000) {
+        stats.appends++;
+        stats.append_us += now - last_append;
+        append_interval_us= append_interval_us == 0 ? now - last_append : (append_interval_us * 7 + now - last_append) / 8;
+    } else {
+        append_interval_us= 0;
+    }
+
     // upstream caller will block on this until there is room in the queue
-    while (queue.is_full() && !THEKERNEL->is_halted()) {
+    while (queue.is_full() && !THEKERNEL->is_halted() && !THEROBOT->is_jog_cancelled()) {
         //check_queue();
         THEKERNEL->call_event(ON_IDLE, this); // will call check_queue();
     }
+    last_append= us_ticker_read();
 
-    if(THEKERNEL->is_halted()) {
-        // we do not want to stick more stuff on the queue if we are in halt state
+    if(THEKERNEL->is_halted() || THEROBOT->is_jog_cancelled()) {
+        // we do not want to stick more stuff on the queue if we are in halt state, or the jog it is part of is being cancelled
         // clear and release the block on the head
         queue.head_ref()->clear();
         return; // if we got a halt then we are done here
     }
 
+    if(!allow_fetch) {
+        // add it to the blocks being held, see ready_to_release()
+        const Block *b= queue.head_ref();
+        if(b->millimeters > 0 && b->nominal_speed > 0) {
+            held_mm += b->millimeters;
+            held_seconds += b->millimeters / b->nominal_speed;
+            if(b->acceleration > 0) held_needed_mm= std::max(held_needed_mm, b->nominal_speed * b->nominal_speed / b->acceleration);
+        }
+    }
+
+    if(hold) {
+        // the step ticker can not see it until it is produced, so it is never run before it is held
+        Block *b= queue.head_ref();
+        b->sync_seq= ++held_seq;
+        b->held= true;
+    }
+
     queue.produce_head();
+    prepare_blocks(); // the append may have changed the blocks near the front of the queue
 
     // not sure if this is the correct place but we need to turn on the motors if they were not already on
     THEKERNEL->call_event(ON_ENABLE, (void*)1); // turn all enable pins on
 }
 
+// in lazy prepare mode make sure the blocks the step ticker will need next have their trapezoids calculated
+// blocks that are already ticking are not counted, so lazy_prepare_blocks is the number of blocks of lookahead
+void Conveyor::prepare_blocks()
+{
+    if(!Block::lazy_prepare) return;
+
+    unsigned int i= queue.isr_tail_i;
+    for (uint8_t n = 0; n < lazy_prepare_blocks && i != queue.head_i; i= queue.next(i)) {
+        Block *b= queue.item_ref(i);
+        if(b->is_ticking) continue;
+        b->update_trapezoid();
+        n++;
+    }
+}
+
 void Conveyor::check_queue(bool force)
 {
     static uint32_t last_time_check = us_ticker_read();
 
+    prepare_blocks();
+
     if(queue.is_empty()) {
         allow_fetch = false;
         last_time_check = us_ticker_read(); // reset timeout
+        held_mm= held_seconds= held_needed_mm= 0;
         return;
     }
 
     // if we have been waiting for more than the required waiting time and the queue is not empty, or the queue is full, then allow stepticker to get the tail
     // we do this to allow an idle system to pre load the queue a bit so the first few blocks run smoothly.
-    if(force || queue.is_full() || (us_ticker_read() - last_time_check) >= (queue_delay_time_ms * 1000)) {
-        last_time_check = us_ticker_read(); // reset timeout
+    uint32_t now= us_ticker_read();
+    if(force || queue.is_full() || (now - last_time_check) >= (queue_delay_time_ms * 1000) || (!allow_fetch && adaptive_release && ready_to_release(now))) {
+        last_time_check = now; // reset timeout
         if(!flush) allow_fetch = true;
+        held_mm= held_seconds= held_needed_mm= 0;
         return;
     }
 }
 
+// The held blocks are planned as well as they ever would be once they are long enough to get up to the fastest
+// speed in them and stop again, so waiting for more only delays the start. They also have to run for long enough
+// for the main loop to add more at the rate it has been, so a stream does not run dry at once.
+// Nothing queued for a few times the usual interval is a single command, or the end of some, and goes at once.
+bool Conveyor::ready_to_release(uint32_t now) const
+{
+    if(now - last_append >= std::max<uint32_t>(2000, 4 * append_interval_us)) return true;
+    return held_mm >= held_needed_mm && held_seconds * 1000000.0F >= 4 * append_interval_us;
+}
+
+// the action runs as the block now on the head starts, the one the next move will be queued in
+void Conveyor::queue_action(action_fnc_t fnc, void *obj, uint32_t value)
+{
+    // they run in order so wait for one to run if there is no room
+    uint8_t next= (action_head + 1) % k_max_actions;
+    while (next == action_tail && !THEKERNEL->is_halted()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+    }
+    if(THEKERNEL->is_halted()) return;
+
+    actions[action_head]= action_t{fnc, obj, value, queue.head_i};
+    __DMB(); // it must be complete before the step ticker can see it
+    action_head= next;
+
+    // nothing is running so it happens now
+    run_idle_actions();
+}
+
+// runs the actions that come before the given block, called by the step ticker ISR as the block starts
+void Conveyor::run_actions(unsigned int block)
+{
+    uint8_t t= action_tail;
+    while (t != action_head && actions[t].block == block) {
+        actions[t].fnc(actions[t].obj, actions[t].value);
+        t= (t + 1) % k_max_actions;
+    }
+    action_tail= t;
+}
+
+// the actions after the last move are run once the step ticker has finished every block, it can not be running any then
+void Conveyor::run_idle_actions()
+{
+    if(action_tail == action_head || flush || THEKERNEL->is_halted()) return;
+    if(queue.isr_tail_i == queue.head_i) run_actions(queue.head_i);
+}
+
+// a held block waits until its sequence number has been released, the difference copes with the numbers wrapping
+inline bool Conveyor::is_held(const Block *b) const
+{
+    return b->held && (int32_t)(b->sync_seq - released_seq) > 0;
+}
+
 // called from step ticker ISR
 bool Conveyor::get_next_block(Block **block)
 {
@@ -205,31 +356,133 @@ bool Conveyor::get_next_block(Block **block)
     // default the feerate to zero if there is no block available
     this->current_feedrate= 0;
 
-    if(THEKERNEL->is_halted() || queue.isr_tail_i == queue.head_i) return false; // we do not have anything to give
+    if(THEKERNEL->is_halted() || queue.isr_tail_i == queue.head_i) return no_block_ready(); // we do not have anything to give
 
     // wait for queue to fill up, optimizes planning
-    if(!allow_fetch) return false;
+    if(!allow_fetch) return no_block_ready();
 
     Block *b= queue.item_ref(queue.isr_tail_i);
-    // we cannot use this now if it is being updated
-    if(!b->locked) {
+    // we cannot use this now if it is being updated, or has not been prepared yet
+    if(!b->locked && !b->needs_prepare && !is_held(b)) {
         if(!b->is_ready) __debugbreak(); // should never happen
 
         b->is_ticking= true;
         b->recalculate_flag= false;
-        this->current_feedrate= b->nominal_speed;
         *block= b;
+        block_started(b);
         return true;
     }
 
+    return no_block_ready();
+}
+
+// the step ticker has started the block at isr_tail_i, its actions are run and it is counted
+void Conveyor::block_started(Block *b)
+{
+    this->current_feedrate= b->nominal_speed;
+    if(action_tail != action_head) run_actions(queue.isr_tail_i);
+    if(b->held && held_started != nullptr) held_started(b->sync_seq);
+
+    if(starving) {
+        // a wait of over a second is the job pausing or ending rather than the queue running dry
+        uint32_t waited= us_ticker_read() - starve_start;
+        if(waited < 1000000) {
+            stats.underruns++;
+            stats.starved_us += waited;
+        }
+        starving= false;
+    }
+    block_ended= false;
+    uint32_t depth= (queue.head_i + queue.length - queue.isr_tail_i) % queue.length;
+    if(depth < stats.min_depth) stats.min_depth= depth;
+    stats.depth_sum += depth;
+    stats.block_ticks += b->total_move_ticks;
+    stats.blocks++;
+}
+
+// called from the step ticker's PendSV after it has gone straight on from the block that finished to the one it had
+// from get_following_block(), so the queue catches up with it outside of the step tick
+void Conveyor::following_block_started()
+{
+    block_finished();
+    block_started(queue.item_ref(queue.isr_tail_i));
+}
+
+// the step ticker asks every tick while it has nothing to run, the first time after a block is when it started waiting
+bool Conveyor::no_block_ready()
+{
+    if(block_ended) {
+        block_ended= false;
+        starving= true;
+        starve_start= us_ticker_read();
+    }
     return false;
 }
 
+// called from step ticker ISR, claims the block that comes after the one currently being ticked (at isr_tail_i)
+// it is marked as ticking so the planner will no longer change it, get_next_block() will return it once block_finished() is called
+bool Conveyor::get_following_block(Block **block)
+{
+    if(flush || !allow_fetch || THEKERNEL->is_halted() || queue.isr_tail_i == queue.head_i) return false;
+
+    unsigned int i= queue.next(queue.isr_tail_i);
+    if(i == queue.head_i) return false; // nothing queued after the current block yet
+
+    Block *b= queue.item_ref(i);
+    // we cannot use this now if it is being updated, or has not been prepared yet
+    if(b->locked || b->needs_prepare || is_held(b)) return false;
+
+    if(!b->is_ready) __debugbreak(); // should never happen
+
+    b->is_ticking= true;
+    b->recalculate_flag= false;
+    *block= b;
+    return true;
+}
+
 // called from step ticker ISR when block is finished, do not do anything slow here
 void Conveyor::block_finished()
 {
     // we increment the isr_tail_i so we can get the next block
+    __DMB(); // finish with the block before the main loop can reclaim it
     queue.isr_tail_i= queue.next(queue.isr_tail_i);
+    block_ended= true;
+}
+
+void Conveyor::reset_stats()
+{
+    __disable_irq();
+    stats= {};
+    stats.min_depth= UINT32_MAX;
+    __enable_irq();
+}
+
+Conveyor::stats_t Conveyor::get_stats()
+{
+    // the step ticker updates most of it
+    __disable_irq();
+    stats_t s= stats;
+    __enable_irq();
+    return s;
+}
+
+void Conveyor::print_stats(StreamOutput *stream)
+{
+    stats_t s= get_stats();
+    if(s.blocks == 0) {
+        stream->printf("planner: no blocks run\n");
+        return;
+    }
+
+    stream->printf("planner: %lu blocks, queue depth min %lu avg %1.1f, %lu underruns, starved for %1.3f s\n",
+        s.blocks, s.min_depth, (float)s.depth_sum / s.blocks, s.underruns, s.starved_us / 1000000.0F);
+    if(s.appends > 0) {
+        // when the queue runs dry and the main loop takes longer to make a block than it takes to run, it is the parsing or I/O holding it up
+        float main_ms= s.append_us / 1000.0F / s.appends;
+        float run_ms= s.block_ticks * 1000.0F / THEKERNEL->step_ticker->get_frequency() / s.blocks;
+        stream->printf("planner: main loop %1.3f ms per block, blocks run for %1.3f ms%s\n", main_ms, run_ms,
+            s.underruns > 0 && main_ms > run_ms ? ", feed limited" : "");
+    }
 }
 
 /*
@@ -238,16 +491,19 @@ void Conveyor::block_finished()
     queue_head_block() so after this flush, once main_loop runs again one more
     gcode gets stuck in the queue, this is bad. Current work around is to call
     this when the queue in not full and streaming has stopped
+    With abort_running the block being run is dropped as well, it must have been brought to a stop first
 */
-void Conveyor::flush_queue()
+void Conveyor::flush_queue(bool abort_running)
 {
     allow_fetch = false;
     flush= true;
-
-    // TODO force deceleration of last block
+    starving= false;
+    if(abort_running) THEKERNEL->step_ticker->abort_block();
 
     // now wait until the block queue has been flushed
     wait_for_idle(false);
+    // the actions go with the moves they were queued between
+    action_tail= action_head;
 
     flush= false;
 }
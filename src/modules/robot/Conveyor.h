@@ -10,7 +10,10 @@
 #include "libs/Module.h"
 #include "BlockQueue.h"
 
+#include <array>
+
 class Block;
+class StreamOutput;
 
 class Conveyor : public Module
 {
@@ -25,33 +28,116 @@ public:
     void wait_for_idle(bool wait_for_motors=true);
     bool is_queue_empty() { return queue.is_empty(); };
     bool is_queue_full() { return queue.is_full(); };
+    unsigned int queue_count() const { return queue.count(); };
+    unsigned int queue_free() const { return queue.space(); };
+    size_t get_queue_size() const { return queue_size; }
+    size_t get_queue_capacity() const { return queue.get_capacity(); }
+    bool set_queue_size(size_t n);
     bool is_idle() const;
+    // lets the step ticker have what is queued now rather than waiting for more, for moves that have to start at once
+    void release_queue() { check_queue(true); }
+
+    // an output change that happens where the path has got to when it is queued, rather than waiting for the queue to empty.
+    // fnc is called from the step ticker interrupts as the next move starts, or from on_idle once the moves before it are done
+    // if no move follows, so it has to be quick. Actions still waiting are dropped when the queue is flushed
+    using action_fnc_t= void (*)(void *obj, uint32_t value);
+    void queue_action(action_fnc_t fnc, void *obj, uint32_t value);
+
+    // blocks queued while holding get the next sequence number and the step ticker can not have one until release_held()
+    // has been given that number or a later one, so they start no earlier than the same block on another board.
+    // started is called from the step ticker interrupt with the number of each one as it starts, so it has to be quick
+    using started_fnc_t= void (*)(uint32_t seq);
+    void hold_blocks(bool on, started_fnc_t started= nullptr) { hold= on; held_started= started; }
+    void set_held_seq(uint32_t seq) { held_seq= seq; } // the next block queued gets seq + 1
+    uint32_t get_held_seq() const { return held_seq; }
+    void release_held(uint32_t seq) { released_seq= seq; }
 
     // returns next available block writes it to block and returns true
     bool get_next_block(Block **block);
+    // returns the block after the one being ticked so it can be prepared before the current one finishes
+    bool get_following_block(Block **block);
     void block_finished();
+    void following_block_started();
+    bool is_flushing() const { return flush; }
 
     void dump_queue(void);
-    void flush_queue(void);
+    void flush_queue(bool abort_running= false);
     float get_current_feedrate() const { return current_feedrate; }
 
+    // how well the queue was kept fed since the last reset, to tell a job limited by parsing or I/O from one limited by the planner
+    struct stats_t {
+        uint32_t blocks;        // blocks started by the step ticker
+        uint32_t min_depth;     // fewest blocks queued when one started, including it
+        uint64_t depth_sum;
+        uint64_t block_ticks;   // planned step ticks of the blocks started
+        uint32_t underruns;     // times a block finished with none ready to follow and more came within a second
+        uint64_t starved_us;    // time the step ticker waited in those
+        uint32_t appends;       // blocks queued by the main loop one after another
+        uint64_t append_us;     // main loop time between them, not counting waiting for room in the queue
+    };
+    void reset_stats();
+    void print_stats(StreamOutput *stream);
+    stats_t get_stats();
+    // changes each time the step ticker starts a block
+    uint32_t get_blocks_started() const { return stats.blocks; }
+
     friend class Planner; // for queue
+    friend class MultiNode; // for queue
 
 private:
     void check_queue(bool force= false);
+    void prepare_blocks();
     void queue_head_block(void);
+    bool no_block_ready();
+    void block_started(Block *b);
+    bool is_held(const Block *b) const;
+    bool ready_to_release(uint32_t now) const;
+    void run_actions(unsigned int block);
+    void run_idle_actions();
 
     using  Queue_t= BlockQueue;
     Queue_t queue;  // Queue of Blocks
 
-    uint32_t queue_delay_time_ms;
+    uint32_t queue_delay_time_ms; // the longest blocks are held before the step ticker is given them
     size_t queue_size;
+    size_t queue_max_size;
+    uint8_t lazy_prepare_blocks; // if non zero only this many blocks at the front of the queue have their trapezoids calculated
     float current_feedrate{0}; // actual nominal feedrate that current block is running at in mm/sec
 
+    uint32_t held_seq;              // given to the last block queued while holding
+    volatile uint32_t released_seq; // held blocks up to this one can be run
+    started_fnc_t held_started;
+
+    stats_t stats;
+    uint32_t starve_start;  // when the step ticker first found nothing to run after a block
+    uint32_t last_append;   // when the main loop last queued a block, 0 once it has been idle
+    uint32_t append_interval_us; // average time between the blocks the main loop queues one after another, 0 when it was idle
+
+    // the queued actions in order, each with the queue index of the block it comes before
+    struct action_t {
+        action_fnc_t fnc;
+        void *obj;
+        uint32_t value;
+        unsigned int block;
+    };
+    static const uint8_t k_max_actions= 16;
+    std::array<action_t, k_max_actions> actions;
+    volatile uint8_t action_head{0}; // written by the main loop
+    volatile uint8_t action_tail{0}; // by whichever runs them
+
+    // the blocks held until there are enough of them to plan well, see ready_to_release()
+    float held_mm;          // their length
+    float held_seconds;     // and time at their nominal speeds
+    float held_needed_mm;   // the distance it takes to get to the fastest of them and stop again
+
     struct {
         volatile bool running:1;
         volatile bool allow_fetch:1;
         bool flush:1;
+        volatile bool block_ended:1; // a block finished and the next has not been asked for yet
+        volatile bool starving:1;    // the step ticker has been waiting since starve_start
+        bool adaptive_release:1;
+        bool hold:1;                 // see hold_blocks()
     };
 
 };
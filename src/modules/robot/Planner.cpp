@@ -10,7 +10,6 @@ using namespace std;
 
 #include "mri.h"
 #include "nuts_bolts.h"
-#include "RingBuffer.h"
 #include "Gcode.h"
 #include "Module.h"
 #include "Kernel.h"
@@ -29,6 +28,11 @@ using namespace std;
 #define junction_deviation_checksum    CHECKSUM("junction_deviation")
 #define z_junction_deviation_checksum  CHECKSUM("z_junction_deviation")
 #define minimum_planner_speed_checksum CHECKSUM("minimum_planner_speed")
+#define scurve_jerk_checksum           CHECKSUM("scurve_jerk")
+#define junction_per_actuator_checksum CHECKSUM("junction_per_actuator")
+#define input_shaping_checksum         CHECKSUM("input_shaping")
+#define frequency_checksum             CHECKSUM("frequency")
+#define damping_checksum               CHECKSUM("damping")
 
 // The Planner does the acceleration math for the queue of Blocks ( movements ).
 // It makes sure the speed stays within the configured constraints ( acceleration, junction_deviation, etc )
@@ -37,6 +41,8 @@ using namespace std;
 Planner::Planner()
 {
     memset(this->previous_unit_vec, 0, sizeof this->previous_unit_vec);
+    memset(this->previous_actuator_unit, 0, sizeof this->previous_actuator_unit);
+    this->arc_junction_speed = 0.0F;
     config_load();
 }
 
@@ -46,19 +52,50 @@ void Planner::config_load()
     this->junction_deviation = THEKERNEL->config->value(junction_deviation_checksum)->by_default(0.05F)->as_number();
     this->z_junction_deviation = THEKERNEL->config->value(z_junction_deviation_checksum)->by_default(NAN)->as_number(); // disabled by default
     this->minimum_planner_speed = THEKERNEL->config->value(minimum_planner_speed_checksum)->by_default(0.0f)->as_number();
+    this->jerk = THEKERNEL->config->value(scurve_jerk_checksum)->by_default(0.0f)->as_number(); // mm/sec³, 0 uses constant acceleration
+    this->per_actuator_junction = THEKERNEL->config->value(junction_per_actuator_checksum)->by_default(false)->as_bool();
+
+    // input_shaping.x.frequency etc
+    static const uint16_t axis_checksums[3] = { CHECKSUM("x"), CHECKSUM("y"), CHECKSUM("z") };
+    for (int i = 0; i < 3; ++i) {
+        this->shaper_frequency[i] = THEKERNEL->config->value(input_shaping_checksum, axis_checksums[i], frequency_checksum)->by_default(0.0F)->as_number();
+        this->shaper_damping[i] = THEKERNEL->config->value(input_shaping_checksum, axis_checksums[i], damping_checksum)->by_default(0.1F)->as_number();
+    }
+}
+
+// Input shaping, a block whose acceleration ramps up over exactly one period of a resonance does not excite it: the
+// ramp is the constant acceleration convolved with a box as long as the period, which has no energy at that frequency.
+// That is what the s-curve does with jerk = acceleration / period, so the shaping is done by picking the jerk.
+// Returns the longest period of the damped resonances of the axes the block moves, 0 if none of them are shaped.
+// For a change of speed too small to reach full acceleration the ramp is shorter and only partly cancels it.
+float Planner::shaper_ramp_time(const float *unit_vec) const
+{
+    float t = 0.0F;
+    if(unit_vec == nullptr) return t;
+    for (int i = 0; i < 3; ++i) {
+        if(shaper_frequency[i] <= 0.0F || unit_vec[i] == 0.0F) continue;
+        float z = shaper_damping[i] < 1.0F ? shaper_damping[i] : 0.99F;
+        float period = 1.0F / (shaper_frequency[i] * sqrtf(1.0F - z * z));
+        if(period > t) t = period;
+    }
+    return t;
 }
 
 
 // Append a block to the queue, compute it's speed factors
-bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123)
+bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123, uint16_t raster_count, uint32_t raster_start)
 {
     // Create ( recycle ) a new block
     Block* block = THECONVEYOR->queue.head_ref();
 
     // Direction bits
     bool has_steps = false;
+    float actuator_unit[k_max_actuators]{0};
+    float backlash_scale = 1.0F;
+    block->backlash_motors = 0;
     for (size_t i = 0; i < n_motors; i++) {
         int32_t steps = THEROBOT->actuators[i]->steps_to_target(actuator_pos[i]);
+        if(distance > 0.0F) actuator_unit[i] = steps / (THEROBOT->actuators[i]->get_steps_per_mm() * distance);
         // Update current position
         if(steps != 0) {
             THEROBOT->actuators[i]->update_last_milestones(actuator_pos[i], steps);
@@ -69,6 +106,15 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
         block->direction_bits[i] = (steps < 0) ? 1 : 0;
         // save actual steps in block
         block->steps[i] = labs(steps);
+
+        // a motor that reverses takes up its backlash with extra steps spread over this block, so there is no separate
+        // move to stop for. The step ticker takes them back off the position when it starts the block
+        uint32_t backlash = steps != 0 ? THEROBOT->actuators[i]->backlash_for(steps < 0) : 0;
+        if(backlash > 0) {
+            backlash_scale = std::min(backlash_scale, (float)block->steps[i] / (block->steps[i] + backlash));
+            block->steps[i] += backlash;
+            block->backlash_motors |= (1 << i);
+        }
     }
 
     // sometimes even though there is a detectable movement it turns out there are no steps to be had from such a small move
@@ -77,8 +123,15 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
         return false;
     }
 
+    // slow the block by as much as the extra steps speed that motor up, so it stays within its planned speed and acceleration
+    if(backlash_scale < 1.0F) {
+        rate_mm_s *= backlash_scale;
+        acceleration *= backlash_scale;
+    }
+
     // info needed by laser
     block->s_value = roundf(s_value*(1<<11)); // 1.11 fixed point
+    block->source_line = THEROBOT->get_source_line();
     block->is_g123 = g123;
 
     // use default JD
@@ -107,10 +160,20 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     }
 
     block->acceleration = acceleration; // save in block
+    block->jerk = jerk; // if set the block will use a jerk limited s-curve when it can
+    float shaper_time = shaper_ramp_time(unit_vec);
+    if(shaper_time > 0.0F) {
+        // the lower jerk of the two so the shaping is not undone by a configured s-curve or the other way around
+        float j = acceleration / shaper_time;
+        if(block->jerk <= 0.0F || j < block->jerk) block->jerk = j;
+    }
 
     // Max number of steps, for all axes
     auto mi = std::max_element(block->steps.begin(), block->steps.end());
     block->steps_event_count = *mi;
+    block->raster_start = raster_start;
+    block->raster_count = raster_count < block->steps_event_count ? raster_count : block->steps_event_count;
+    block->primary_motor = mi - block->steps.begin();
 
     block->millimeters = distance;
 
@@ -118,6 +181,9 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     if( distance > 0.0F ) {
         block->nominal_speed = rate_mm_s;           // (mm/s) Always > 0
         block->nominal_rate = block->steps_event_count * rate_mm_s / distance; // (step/s) Always > 0
+        // for StepTicker::rate_fnc, saturates for moves under about 6 steps/sec at 100KHz
+        float scale = 262144.0F * THEKERNEL->step_ticker->get_frequency() / block->nominal_rate;
+        block->rate_scale = scale < 4294967295.0F ? scale : 0xFFFFFFFFUL;
     } else {
         block->nominal_speed = 0.0F;
         block->nominal_rate  = 0;
@@ -147,7 +213,14 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
         Block *prev_block = THECONVEYOR->queue.item_ref(THECONVEYOR->queue.prev(THECONVEYOR->queue.head_i));
         float previous_nominal_speed = prev_block->primary_axis ? prev_block->nominal_speed : 0;
 
-        if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F) {
+        if (arc_junction_speed > 0.0F && previous_nominal_speed > 0.0F) {
+            // between two chords of an arc, its centripetal limit is the speed the angle between them stands in for
+            vmax_junction = std::min(arc_junction_speed, std::min(previous_nominal_speed, block->nominal_speed));
+
+        } else if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F && per_actuator_junction) {
+            vmax_junction = actuator_junction_speed(actuator_unit, n_motors, junction_deviation, acceleration, std::min(previous_nominal_speed, block->nominal_speed));
+
+        } else if (junction_deviation > 0.0F && previous_nominal_speed > 0.0F) {
             // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
             // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
             float cos_theta = - this->previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
@@ -194,8 +267,10 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     // Update previous path unit_vector and nominal speed
     if(unit_vec != nullptr) {
         memcpy(previous_unit_vec, unit_vec, sizeof(previous_unit_vec)); // previous_unit_vec[] = unit_vec[]
+        memcpy(previous_actuator_unit, actuator_unit, sizeof(previous_actuator_unit));
     } else {
         memset(previous_unit_vec, 0, sizeof(previous_unit_vec));
+        memset(previous_actuator_unit, 0, sizeof(previous_actuator_unit));
     }
 
     // Math-heavy re-computing of the whole queue to take the new
@@ -209,6 +284,84 @@ bool Planner::append_block( ActuatorCoordinates &actuator_pos, uint8_t n_motors,
     return true;
 }
 
+// Queue a block planned by the host as it is, returns false if it does not make sense.
+// It is never replanned, and a block appended after it starts from the exit speed it was planned with, so the host
+// should end its last block at minimum_planner_speed before any other moves are sent
+bool Planner::append_planned_block(const planned_block_t &p, uint8_t n_motors)
+{
+    if(p.total_move_ticks == 0 || p.accelerate_until > p.decelerate_after || p.decelerate_after > p.total_move_ticks) return false;
+    if(!(p.initial_rate >= 0.0F && p.final_rate >= 0.0F && p.maximum_rate >= 0.0F)) return false;
+    if(std::max(p.maximum_rate, std::max(p.initial_rate, p.final_rate)) >= THEKERNEL->step_ticker->get_frequency()) return false; // more than a step per tick
+
+    Block* block = THECONVEYOR->queue.head_ref();
+
+    bool has_steps = false;
+    block->backlash_motors = 0;
+    for (size_t i = 0; i < n_motors; i++) {
+        int32_t steps = p.steps[i];
+        if(steps != 0) {
+            StepperMotor *a = THEROBOT->actuators[i];
+            a->update_last_milestones((a->get_last_milestone_steps() + steps) / a->get_steps_per_mm(), steps);
+            has_steps = true;
+        }
+        block->direction_bits[i] = (steps < 0) ? 1 : 0;
+        block->steps[i] = labs(steps);
+    }
+
+    if(!has_steps) {
+        block->clear();
+        return false;
+    }
+
+    auto mi = std::max_element(block->steps.begin(), block->steps.end());
+    block->steps_event_count = *mi;
+    block->primary_motor = mi - block->steps.begin();
+    block->s_value = roundf(p.s_value*(1<<11)); // 1.11 fixed point
+    block->is_g123 = p.g123;
+    block->primary_axis = false; // so the next block the planner appends junctions from a stop
+    block->millimeters = p.millimeters;
+    block->acceleration = p.acceleration;
+    block->nominal_speed = p.nominal_speed;
+    if(p.millimeters > 0.0F && p.nominal_speed > 0.0F) {
+        block->nominal_rate = block->steps_event_count * p.nominal_speed / p.millimeters;
+        float scale = 262144.0F * THEKERNEL->step_ticker->get_frequency() / block->nominal_rate;
+        block->rate_scale = scale < 4294967295.0F ? scale : 0xFFFFFFFFUL;
+        block->entry_speed = p.nominal_speed * p.initial_rate / block->nominal_rate;
+        block->exit_speed = p.nominal_speed * p.final_rate / block->nominal_rate;
+    } else {
+        block->nominal_rate = p.maximum_rate;
+        block->entry_speed = block->exit_speed = 0.0F;
+    }
+    block->max_entry_speed = block->entry_speed;
+    block->recalculate_flag = false;
+    block->set_planned_trapezoid(p.accelerate_until, p.decelerate_after, p.total_move_ticks, p.initial_rate, p.maximum_rate, p.final_rate);
+
+    memset(previous_unit_vec, 0, sizeof(previous_unit_vec));
+    memset(previous_actuator_unit, 0, sizeof(previous_actuator_unit));
+
+    block->ready();
+    THECONVEYOR->queue_head_block();
+    return true;
+}
+
+// Junction speed limited by how much the velocity of each actuator has to change at the junction rather than by the
+// path as a whole. Each actuator may change velocity by as much as it could with its own acceleration over a distance
+// of junction deviation, but never by more than its max rate, so independent axis can take corners that only involve
+// a fast axis much faster and a slow leadscrew axis is not asked for more than it can do.
+float Planner::actuator_junction_speed(const float *actuator_unit, uint8_t n_motors, float junction_deviation, float acceleration, float vmax) const
+{
+    for (size_t i = 0; i < n_motors; i++) {
+        float du = fabsf(actuator_unit[i] - previous_actuator_unit[i]); // velocity change of this actuator per mm/sec of path speed
+        if(du < 0.0001F) continue;
+
+        float a = THEROBOT->actuators[i]->get_acceleration();
+        if(isnan(a) || a <= 0.0F) a = acceleration; // actuator uses the default
+        float dv = std::min(sqrtf(2.0F * a * junction_deviation), THEROBOT->actuators[i]->get_max_rate());
+        vmax = std::min(vmax, dv / du);
+    }
+    return vmax;
+}
+
 void Planner::recalculate()
 {
     Conveyor::Queue_t &queue = THECONVEYOR->queue;
@@ -256,8 +409,15 @@ void Planner::recalculate()
 
     if (!queue.is_empty()) {
         while ((block_index != queue.tail_i) && current->recalculate_flag) {
+            float previous_entry_speed = current->entry_speed;
             entry_speed = current->reverse_pass(entry_speed);
 
+            // if the entry speed did not change then nothing before this block can change either, so the rest of the
+            // queue is still optimally planned and we can start the forward pass from here.
+            // This keeps the cost of appending a block down to the few blocks it actually affects rather than the whole queue.
+            // The head block is new so the block before it always needs its exit recalculated
+            if (entry_speed == previous_entry_speed && block_index != queue.head_i) break;
+
             block_index = queue.prev(block_index);
             current     = queue.item_ref(block_index);
         }
@@ -265,8 +425,8 @@ void Planner::recalculate()
         /*
          * Step 2:
          * now current points to either tail or first non-recalculate block
-         * and has not had its reverse_pass called
-         * or its calculate_trapezoid
+         * and has not had its reverse_pass called, or to the block where the reverse pass stopped changing entry speeds,
+         * neither has had its calculate_trapezoid
          * entry_speed is set to the *exit* speed of current.
          * each block from current to head has its entry speed set to its max entry speed- limited by decel or nominal_rate
          */
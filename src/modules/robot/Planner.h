@@ -16,17 +16,46 @@ class Planner
 public:
     Planner();
     float max_allowable_speed( float acceleration, float target_velocity, float distance);
+    float get_junction_deviation() const { return junction_deviation; }
+    float get_minimum_planner_speed() const { return minimum_planner_speed; }
+    // read the settings again, by config-load reload
+    void config_load();
+
+    // a block the host has already planned, see the host planning frames in USBSerial.h. The rates are for the motor
+    // with the most steps, on the same step frequency as ours
+    struct planned_block_t {
+        int32_t steps[k_max_actuators]; // negative steps are the reverse direction
+        uint32_t accelerate_until;
+        uint32_t decelerate_after;
+        uint32_t total_move_ticks;
+        float initial_rate;
+        float maximum_rate;
+        float final_rate;
+        float millimeters;
+        float nominal_speed;
+        float acceleration;
+        float s_value;
+        bool g123;
+    };
+    bool append_planned_block(const planned_block_t &p, uint8_t n_motors);
 
     friend class Robot; // for acceleration, junction deviation, minimum_planner_speed
 
 private:
-    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123);
+    bool append_block(ActuatorCoordinates &target, uint8_t n_motors, float rate_mm_s, float distance, float unit_vec[], float accleration, float s_value, bool g123, uint16_t raster_count, uint32_t raster_start);
     void recalculate();
-    void config_load();
+    float actuator_junction_speed(const float *actuator_unit, uint8_t n_motors, float junction_deviation, float acceleration, float vmax) const;
+    float shaper_ramp_time(const float *unit_vec) const;
     float previous_unit_vec[N_PRIMARY_AXIS];
+    float previous_actuator_unit[k_max_actuators]; // actuator mm per path mm of the previous block, for the per actuator junction model
     float junction_deviation;    // Setting
     float z_junction_deviation;  // Setting
     float minimum_planner_speed; // Setting
+    float jerk;                  // Setting
+    bool per_actuator_junction;  // Setting
+    float arc_junction_speed;    // set by Robot for the chords of an arc after its first, the junction speed the arc allows
+    float shaper_frequency[3];   // Setting, XYZ resonance in Hz, 0 disables shaping for that axis
+    float shaper_damping[3];     // Setting, damping ratio of that resonance
 };
 
 
@@ -30,7 +30,6 @@
 #include "ConfigValue.h"
 #include "libs/StreamOutput.h"
 #include "StreamOutputPool.h"
-#include "ExtruderPublicAccess.h"
 #include "GcodeDispatch.h"
 #include "ActuatorCoordinates.h"
 #include "EndstopsPublicAccess.h"
@@ -48,11 +47,13 @@
 #define  delta_segments_per_second_checksum  CHECKSUM("delta_segments_per_second")
 #define  mm_per_arc_segment_checksum         CHECKSUM("mm_per_arc_segment")
 #define  mm_max_arc_error_checksum           CHECKSUM("mm_max_arc_error")
+#define  mm_max_segment_error_checksum       CHECKSUM("mm_max_segment_error")
 #define  arc_correction_checksum             CHECKSUM("arc_correction")
 #define  x_axis_max_speed_checksum           CHECKSUM("x_axis_max_speed")
 #define  y_axis_max_speed_checksum           CHECKSUM("y_axis_max_speed")
 #define  z_axis_max_speed_checksum           CHECKSUM("z_axis_max_speed")
 #define  segment_z_moves_checksum            CHECKSUM("segment_z_moves")
+#define  merge_tolerance_checksum            CHECKSUM("collinear_merge_tolerance")
 #define  save_g92_checksum                   CHECKSUM("save_g92")
 #define  set_g92_checksum                    CHECKSUM("set_g92")
 
@@ -113,24 +114,39 @@ Robot::Robot()
     memset(this->compensated_machine_position, 0, sizeof compensated_machine_position);
     this->arm_solution = NULL;
     seconds_per_minute = 60.0F;
+    raster_position = 0;
+    raster_pixels = 0;
     this->clearToolOffset();
     this->compensationTransform = nullptr;
     this->get_e_scale_fnc= nullptr;
+    this->check_e_max_speeds_fnc= nullptr;
     this->wcs_offsets.fill(wcs_t(0.0F, 0.0F, 0.0F));
     this->g92_offset = wcs_t(0.0F, 0.0F, 0.0F);
     this->next_command_is_MCS = false;
     this->disable_segmentation= false;
     this->disable_arm_solution= false;
     this->n_motors= 0;
+    this->merge_pending= false;
+    this->segmenting= false;
+    this->queuing_segments= false;
+    this->spline_continues= false;
+    this->move_checked= false;
 }
 
 //Called when the module has just been loaded
 void Robot::on_module_loaded()
 {
     this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_event(ON_MAIN_LOOP, PRIORITY_HIGH);
+    this->register_for_event(ON_HALT);
+    this->register_for_event(ON_CONFIG_RELOAD);
 
     // Configuration
     this->load_config();
+
+    if(this->merge_tolerance > 0.0F) {
+        this->register_for_event(ON_IDLE, PRIORITY_HIGH);
+    }
 }
 
 #define ACTUATOR_CHECKSUMS(X) {     \
@@ -139,9 +155,26 @@ void Robot::on_module_loaded()
     CHECKSUM(X "_en_pin"),          \
     CHECKSUM(X "_steps_per_mm"),    \
     CHECKSUM(X "_max_rate"),        \
-    CHECKSUM(X "_acceleration")     \
+    CHECKSUM(X "_acceleration"),    \
+    CHECKSUM(X "_backlash")         \
 }
 
+// Make our Primary XYZ StepperMotors, and potentially A B C
+static uint16_t const motor_checksums[][7] = {
+    ACTUATOR_CHECKSUMS("alpha"), // X
+    ACTUATOR_CHECKSUMS("beta"),  // Y
+    ACTUATOR_CHECKSUMS("gamma"), // Z
+    #if MAX_ROBOT_ACTUATORS > 3
+    ACTUATOR_CHECKSUMS("delta"),   // A
+    #if MAX_ROBOT_ACTUATORS > 4
+    ACTUATOR_CHECKSUMS("epsilon"), // B
+    #if MAX_ROBOT_ACTUATORS > 5
+    ACTUATOR_CHECKSUMS("zeta")     // C
+    #endif
+    #endif
+    #endif
+};
+
 void Robot::load_config()
 {
     // Arm solutions are used to convert positions in millimeters into position in steps for each stepper motor.
@@ -149,6 +182,11 @@ void Robot::load_config()
     // To make adding those solution easier, they have their own, separate object.
     // Here we read the config to find out which arm solution to use
     if (this->arm_solution) delete this->arm_solution;
+    position_cache.valid= false;
+#ifndef ARM_SOLUTION_FROM_CONFIG
+    // fixed by the build
+    this->arm_solution = new ArmSolution(THEKERNEL->config);
+#else
     int solution_checksum = get_checksum(THEKERNEL->config->value(arm_solution_checksum)->by_default("cartesian")->as_string());
     // Note checksums are not const expressions when in debug mode, so don't use switch
     if(solution_checksum == hbot_checksum || solution_checksum == corexy_checksum) {
@@ -175,53 +213,25 @@ void Robot::load_config()
     } else {
         this->arm_solution = new CartesianSolution(THEKERNEL->config);
     }
+#endif
 
     this->feed_rate           = THEKERNEL->config->value(default_feed_rate_checksum   )->by_default(  100.0F)->as_number();
     this->seek_rate           = THEKERNEL->config->value(default_seek_rate_checksum   )->by_default(  100.0F)->as_number();
-    this->mm_per_line_segment = THEKERNEL->config->value(mm_per_line_segment_checksum )->by_default(    0.0F)->as_number();
-    this->delta_segments_per_second = THEKERNEL->config->value(delta_segments_per_second_checksum )->by_default(0.0f   )->as_number();
-    this->mm_per_arc_segment  = THEKERNEL->config->value(mm_per_arc_segment_checksum  )->by_default(    0.0f)->as_number();
-    this->mm_max_arc_error    = THEKERNEL->config->value(mm_max_arc_error_checksum    )->by_default(   0.01f)->as_number();
-    this->arc_correction      = THEKERNEL->config->value(arc_correction_checksum      )->by_default(    5   )->as_number();
-
-    // in mm/sec but specified in config as mm/min
-    this->max_speeds[X_AXIS]  = THEKERNEL->config->value(x_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
-    this->max_speeds[Y_AXIS]  = THEKERNEL->config->value(y_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
-    this->max_speeds[Z_AXIS]  = THEKERNEL->config->value(z_axis_max_speed_checksum    )->by_default(  300.0F)->as_number() / 60.0F;
-
-    this->segment_z_moves     = THEKERNEL->config->value(segment_z_moves_checksum     )->by_default(true)->as_bool();
-    this->save_g92            = THEKERNEL->config->value(save_g92_checksum            )->by_default(false)->as_bool();
+    // not reloaded as it decides whether on_idle is registered
+    this->merge_tolerance     = THEKERNEL->config->value(merge_tolerance_checksum     )->by_default(    0.0F)->as_number();
     string g92                = THEKERNEL->config->value(set_g92_checksum             )->by_default("")->as_string();
     if(!g92.empty()) {
         // optional setting for a fixed G92 offset
         std::vector<float> t= parse_number_list(g92.c_str());
         if(t.size() == 3) {
             g92_offset = wcs_t(t[0], t[1], t[2]);
+            update_wcs_offset();
         }
     }
 
     // default s value for laser
     this->s_value             = THEKERNEL->config->value(laser_module_default_power_checksum)->by_default(0.8F)->as_number();
 
-     // Make our Primary XYZ StepperMotors, and potentially A B C
-    uint16_t const motor_checksums[][6] = {
-        ACTUATOR_CHECKSUMS("alpha"), // X
-        ACTUATOR_CHECKSUMS("beta"),  // Y
-        ACTUATOR_CHECKSUMS("gamma"), // Z
-        #if MAX_ROBOT_ACTUATORS > 3
-        ACTUATOR_CHECKSUMS("delta"),   // A
-        #if MAX_ROBOT_ACTUATORS > 4
-        ACTUATOR_CHECKSUMS("epsilon"), // B
-        #if MAX_ROBOT_ACTUATORS > 5
-        ACTUATOR_CHECKSUMS("zeta")     // C
-        #endif
-        #endif
-        #endif
-    };
-
-    // default acceleration setting, can be overriden with newer per axis settings
-    this->default_acceleration= THEKERNEL->config->value(acceleration_checksum)->by_default(100.0F )->as_number(); // Acceleration is in mm/s^2
-
     // make each motor
     for (size_t a = 0; a < MAX_ROBOT_ACTUATORS; a++) {
         Pin pins[3]; //step, dir, enable
@@ -246,31 +256,60 @@ void Robot::load_config()
             THEKERNEL->streams->printf("FATAL: motor %d does not match index %d\n", n, a);
             return;
         }
+    }
+
+    on_config_reload(this);
+
+    // initialise actuator positions to current cartesian position (X0 Y0 Z0)
+    // so the first move can be correct if homing is not performed
+    ActuatorCoordinates actuator_pos;
+    arm_solution->cartesian_to_actuator(machine_position, actuator_pos);
+    for (size_t i = 0; i < n_motors; i++)
+        actuators[i]->change_last_milestone(actuator_pos[i]);
+
+    //this->clearToolOffset();
+}
+
+// the settings that can be changed while running, from load_config and again by config-load reload
+// the arm solution and the motors it made are left as they are
+void Robot::on_config_reload(void *argument)
+{
+    this->mm_per_line_segment = THEKERNEL->config->value(mm_per_line_segment_checksum )->by_default(    0.0F)->as_number();
+    this->delta_segments_per_second = THEKERNEL->config->value(delta_segments_per_second_checksum )->by_default(0.0f   )->as_number();
+    this->mm_per_arc_segment  = THEKERNEL->config->value(mm_per_arc_segment_checksum  )->by_default(    0.0f)->as_number();
+    this->mm_max_arc_error    = THEKERNEL->config->value(mm_max_arc_error_checksum    )->by_default(   0.01f)->as_number();
+    this->mm_max_segment_error= THEKERNEL->config->value(mm_max_segment_error_checksum)->by_default(    0.0f)->as_number();
+    this->arc_correction      = THEKERNEL->config->value(arc_correction_checksum      )->by_default(    5   )->as_number();
+
+    // in mm/sec but specified in config as mm/min
+    this->max_speeds[X_AXIS]  = THEKERNEL->config->value(x_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
+    this->max_speeds[Y_AXIS]  = THEKERNEL->config->value(y_axis_max_speed_checksum    )->by_default(60000.0F)->as_number() / 60.0F;
+    this->max_speeds[Z_AXIS]  = THEKERNEL->config->value(z_axis_max_speed_checksum    )->by_default(  300.0F)->as_number() / 60.0F;
+
+    this->segment_z_moves     = THEKERNEL->config->value(segment_z_moves_checksum     )->by_default(true)->as_bool();
+    this->save_g92            = THEKERNEL->config->value(save_g92_checksum            )->by_default(false)->as_bool();
+
+    // default acceleration setting, can be overriden with newer per axis settings
+    this->default_acceleration= THEKERNEL->config->value(acceleration_checksum)->by_default(100.0F )->as_number(); // Acceleration is in mm/s^2
 
+    for (size_t a = 0; a < n_motors && a < MAX_ROBOT_ACTUATORS; a++) {
+        if(actuators[a]->is_extruder()) break; // the extruders come after the axis motors
         actuators[a]->change_steps_per_mm(THEKERNEL->config->value(motor_checksums[a][3])->by_default(a == 2 ? 2560.0F : 80.0F)->as_number());
         actuators[a]->set_max_rate(THEKERNEL->config->value(motor_checksums[a][4])->by_default(30000.0F)->as_number()/60.0F); // it is in mm/min and converted to mm/sec
         actuators[a]->set_acceleration(THEKERNEL->config->value(motor_checksums[a][5])->by_default(NAN)->as_number()); // mm/secs²
+        actuators[a]->set_backlash(THEKERNEL->config->value(motor_checksums[a][6])->by_default(0.0F)->as_number()); // mm
     }
 
     check_max_actuator_speeds(); // check the configs are sane
 
     // if we have not specified a z acceleration see if the legacy config was set
-    if(isnan(actuators[Z_AXIS]->get_acceleration())) {
+    if(n_motors > Z_AXIS && isnan(actuators[Z_AXIS]->get_acceleration())) {
         float acc= THEKERNEL->config->value(z_acceleration_checksum)->by_default(NAN)->as_number(); // disabled by default
         if(!isnan(acc)) {
             actuators[Z_AXIS]->set_acceleration(acc);
         }
     }
 
-    // initialise actuator positions to current cartesian position (X0 Y0 Z0)
-    // so the first move can be correct if homing is not performed
-    ActuatorCoordinates actuator_pos;
-    arm_solution->cartesian_to_actuator(machine_position, actuator_pos);
-    for (size_t i = 0; i < n_motors; i++)
-        actuators[i]->change_last_milestone(actuator_pos[i]);
-
-    //this->clearToolOffset();
-
     soft_endstop_enabled= THEKERNEL->config->value(soft_endstop_checksum, enable_checksum)->by_default(false)->as_bool();
     soft_endstop_halt= THEKERNEL->config->value(soft_endstop_checksum, halt_checksum)->by_default(true)->as_bool();
 
@@ -316,6 +355,7 @@ void Robot::pop_state()
         this->e_absolute_mode = std::get<3>(s);
         this->inch_mode = std::get<4>(s);
         this->current_wcs = std::get<5>(s);
+        update_wcs_offset();
     }
 }
 
@@ -340,8 +380,18 @@ void Robot::get_current_machine_position(float *pos) const
         actuators[Z_AXIS]->get_current_position()
     };
 
+    if(position_cache.valid && current_position[X_AXIS] == position_cache.actuator[X_AXIS] &&
+       current_position[Y_AXIS] == position_cache.actuator[Y_AXIS] && current_position[Z_AXIS] == position_cache.actuator[Z_AXIS]) {
+        memcpy(pos, position_cache.machine, sizeof(position_cache.machine));
+        return;
+    }
+
     // get machine position from the actuator position using FK
     arm_solution->actuator_to_cartesian(current_position, pos);
+
+    memcpy(position_cache.actuator, &current_position[0], sizeof(position_cache.actuator));
+    memcpy(position_cache.machine, pos, sizeof(position_cache.machine));
+    position_cache.valid= true;
 }
 
 void Robot::print_position(uint8_t subcode, std::string& res, bool ignore_extruders) const
@@ -417,12 +467,21 @@ void Robot::print_position(uint8_t subcode, std::string& res, bool ignore_extrud
 Robot::wcs_t Robot::mcs2wcs(const Robot::wcs_t& pos) const
 {
     return std::make_tuple(
-        std::get<X_AXIS>(pos) - std::get<X_AXIS>(wcs_offsets[current_wcs]) + std::get<X_AXIS>(g92_offset) - std::get<X_AXIS>(tool_offset),
-        std::get<Y_AXIS>(pos) - std::get<Y_AXIS>(wcs_offsets[current_wcs]) + std::get<Y_AXIS>(g92_offset) - std::get<Y_AXIS>(tool_offset),
-        std::get<Z_AXIS>(pos) - std::get<Z_AXIS>(wcs_offsets[current_wcs]) + std::get<Z_AXIS>(g92_offset) - std::get<Z_AXIS>(tool_offset)
+        std::get<X_AXIS>(pos) - wcs_offset[X_AXIS],
+        std::get<Y_AXIS>(pos) - wcs_offset[Y_AXIS],
+        std::get<Z_AXIS>(pos) - wcs_offset[Z_AXIS]
     );
 }
 
+// the wcs, g92 and tool offsets only change with G10, G54-G59, G92, M2 and tool changes, so they are added together
+// then rather than for every move and position report
+void Robot::update_wcs_offset()
+{
+    wcs_offset[X_AXIS] = std::get<X_AXIS>(wcs_offsets[current_wcs]) - std::get<X_AXIS>(g92_offset) + std::get<X_AXIS>(tool_offset);
+    wcs_offset[Y_AXIS] = std::get<Y_AXIS>(wcs_offsets[current_wcs]) - std::get<Y_AXIS>(g92_offset) + std::get<Y_AXIS>(tool_offset);
+    wcs_offset[Z_AXIS] = std::get<Z_AXIS>(wcs_offsets[current_wcs]) - std::get<Z_AXIS>(g92_offset) + std::get<Z_AXIS>(tool_offset);
+}
+
 // this does a sanity check that actuator speeds do not exceed steps rate capability
 // we will override the actuator max_rate if the combination of max_rate and steps/sec exceeds base_stepping_frequency
 void Robot::check_max_actuator_speeds()
@@ -444,6 +503,13 @@ void Robot::on_gcode_received(void *argument)
 {
     Gcode *gcode = static_cast<Gcode *>(argument);
 
+    // moves start from wherever the jogs stop
+    if(jogging && gcode->has_g) wait_for_jogs();
+
+    // anything other than a G1 has to see all the moves before it queued
+    if(merge_pending && !(gcode->has_g && gcode->g == 1)) flush_merged_line();
+    finish_segments();
+
     enum MOTION_MODE_T motion_mode= NONE;
 
     if( gcode->has_g) {
@@ -452,6 +518,7 @@ void Robot::on_gcode_received(void *argument)
             case 1:  motion_mode = LINEAR;  break;
             case 2:  motion_mode = CW_ARC;  break;
             case 3:  motion_mode = CCW_ARC; break;
+            case 5:  motion_mode = gcode->subcode == 1 ? QUADRATIC_SPLINE : CUBIC_SPLINE; break;
             case 4: { // G4 Dwell
                 uint32_t delay_ms = 0;
                 if (gcode->has_letter('P')) {
@@ -518,6 +585,7 @@ void Robot::on_gcode_received(void *argument)
                             }
                         }
                         wcs_offsets[n] = wcs_t(x, y, z);
+                        update_wcs_offset();
                     }
                 }
                 break;
@@ -535,6 +603,7 @@ void Robot::on_gcode_received(void *argument)
                     current_wcs += gcode->subcode;
                     if(current_wcs >= MAX_WCS) current_wcs = MAX_WCS - 1;
                 }
+                update_wcs_offset();
                 break;
 
             case 90: this->absolute_mode = true; this->e_absolute_mode = true; break;
@@ -572,6 +641,7 @@ void Robot::on_gcode_received(void *argument)
                     }
                     g92_offset = wcs_t(x, y, z);
                 }
+                update_wcs_offset();
 
                 #if MAX_ROBOT_ACTUATORS > 3
                 if(gcode->subcode == 0 && (gcode->has_letter('E') || gcode->get_num_args() == 0)){
@@ -601,6 +671,7 @@ void Robot::on_gcode_received(void *argument)
                 // fall through to M2
             case 2: // M2 end of program
                 current_wcs = 0;
+                update_wcs_offset();
                 absolute_mode = true;
                 break;
             case 17:
@@ -625,7 +696,7 @@ void Robot::on_gcode_received(void *argument)
                     }
 
                     THEKERNEL->conveyor->wait_for_idle();
-                    THEKERNEL->call_event(ON_ENABLE, (void *)bm);
+                    THEKERNEL->call_event(ON_ENABLE, (void *)(uintptr_t)bm);
                     break;
                 }
                 // fall through
@@ -789,9 +860,17 @@ void Robot::on_gcode_received(void *argument)
                     if (factor > 1000.0F)
                         factor = 1000.0F;
 
-                    seconds_per_minute = 6000.0F / factor;
+                    // slowing down is done in real time by the step ticker so it takes effect on the moves already queued,
+                    // speeding up has to be planned so it only applies to new moves
+                    if(factor <= 100.0F) {
+                        THEKERNEL->step_ticker->set_speed_override(factor / 100.0F);
+                        seconds_per_minute = 60.0F;
+                    } else {
+                        THEKERNEL->step_ticker->set_speed_override(1.0F);
+                        seconds_per_minute = 6000.0F / factor;
+                    }
                 } else {
-                    gcode->stream->printf("Speed factor at %6.2f %%\n", 6000.0F / seconds_per_minute);
+                    gcode->stream->printf("Speed factor at %6.2f %%\n", 6000.0F / get_seconds_per_minute());
                 }
                 break;
 
@@ -799,6 +878,58 @@ void Robot::on_gcode_received(void *argument)
                 THEKERNEL->conveyor->wait_for_idle();
                 break;
 
+            case 578: // M578 report how well the planner queue kept up since the job started, M578 R to start again
+                THEKERNEL->conveyor->print_stats(gcode->stream);
+                if(gcode->has_letter('R')) THEKERNEL->conveyor->reset_stats();
+                break;
+
+            case 579: // M579 Snnn set how many blocks the planner queue holds, up to planner_queue_max_size, waits until idle
+                if(gcode->has_letter('S')) {
+                    int n= gcode->get_int('S');
+                    if(n < 2 || !THEKERNEL->conveyor->set_queue_size(n)) {
+                        gcode->stream->printf("error:planner queue size must be 2 to %u\n", (unsigned)THEKERNEL->conveyor->get_queue_capacity());
+                        break;
+                    }
+                }
+                gcode->stream->printf("planner queue size %u, max %u\n", (unsigned)THEKERNEL->conveyor->get_queue_size(), (unsigned)THEKERNEL->conveyor->get_queue_capacity());
+                break;
+
+            case 425: // M425 Xnnn Ynnn Znnn set the backlash in mm taken up when an axis reverses
+                if(gcode->get_num_args() > 0) {
+                    // the step ticker takes the backlash of the motor off blocks that were planned with it
+                    THEKERNEL->conveyor->wait_for_idle();
+                }
+                for (int i = 0; i < n_motors; ++i) {
+                    if(actuators[i]->is_extruder()) continue;
+                    char axis= (i <= Z_AXIS ? 'X'+i : 'A'+(i-A_AXIS));
+                    if(gcode->has_letter(axis)) {
+                        actuators[i]->set_backlash(this->to_millimeters(gcode->get_value(axis)));
+                    }
+                    gcode->stream->printf("%c:%1.4f ", axis, actuators[i]->get_backlash());
+                }
+                gcode->add_nl = true;
+                break;
+
+            case 593: { // M593 [X] [Y] [Z] Fnnn Dnnn set the input shaping resonance in Hz and its damping for the given axes, X and Y if none are given, F0 turns it off
+                bool axes[3];
+                bool any= false;
+                for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+                    axes[i]= gcode->has_letter('X'+i);
+                    if(axes[i]) any= true;
+                }
+                if(!any) axes[X_AXIS]= axes[Y_AXIS]= true;
+
+                Planner *planner= THEKERNEL->planner;
+                for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+                    if(!axes[i]) continue;
+                    if(gcode->has_letter('F')) planner->shaper_frequency[i]= std::max(0.0F, gcode->get_value('F'));
+                    if(gcode->has_letter('D')) planner->shaper_damping[i]= std::max(0.0F, std::min(gcode->get_value('D'), 0.99F));
+                    gcode->stream->printf("%c: F%1.2f D%1.3f ", 'X'+i, planner->shaper_frequency[i], planner->shaper_damping[i]);
+                }
+                gcode->add_nl= true;
+                break;
+            }
+
             case 500: // M500 saves some volatile settings to config override file
             case 503: { // M503 just prints the settings
                 gcode->stream->printf(";Steps per unit:\nM92 ");
@@ -820,6 +951,11 @@ void Robot::on_gcode_received(void *argument)
 
                 gcode->stream->printf(";X- Junction Deviation, Z- Z junction deviation, S - Minimum Planner speed mm/sec:\nM205 X%1.5f Z%1.5f S%1.5f\n", THEKERNEL->planner->junction_deviation, isnan(THEKERNEL->planner->z_junction_deviation)?-1:THEKERNEL->planner->z_junction_deviation, THEKERNEL->planner->minimum_planner_speed);
 
+                for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+                    if(THEKERNEL->planner->shaper_frequency[i] <= 0.0F) continue;
+                    gcode->stream->printf(";Input shaping Hz and damping:\nM593 %c F%1.5f D%1.5f\n", 'X'+i, THEKERNEL->planner->shaper_frequency[i], THEKERNEL->planner->shaper_damping[i]);
+                }
+
                 gcode->stream->printf(";Max cartesian feedrates in mm/sec:\nM203 X%1.5f Y%1.5f Z%1.5f\n", this->max_speeds[X_AXIS], this->max_speeds[Y_AXIS], this->max_speeds[Z_AXIS]);
 
                 gcode->stream->printf(";Max actuator feedrates in mm/sec:\nM203.1 ");
@@ -830,6 +966,21 @@ void Robot::on_gcode_received(void *argument)
                 }
                 gcode->stream->printf("\n");
 
+                // only if any axis has backlash set
+                bool backlash= false;
+                for (int i = 0; i < n_motors; ++i) {
+                    if(!actuators[i]->is_extruder() && actuators[i]->get_backlash() > 0.0F) backlash= true;
+                }
+                if(backlash) {
+                    gcode->stream->printf(";Backlash mm:\nM425 ");
+                    for (int i = 0; i < n_motors; ++i) {
+                        if(actuators[i]->is_extruder()) continue;
+                        char axis= (i <= Z_AXIS ? 'X'+i : 'A'+(i-A_AXIS));
+                        gcode->stream->printf("%c%1.5f ", axis, actuators[i]->get_backlash());
+                    }
+                    gcode->stream->printf("\n");
+                }
+
                 // get or save any arm solution specific optional values
                 BaseSolution::arm_options_t options;
                 if(arm_solution->get_optional(options) && !options.empty()) {
@@ -873,6 +1024,7 @@ void Robot::on_gcode_received(void *argument)
                 if(options.size() > 0) {
                     // set the specified options
                     arm_solution->set_optional(options);
+                    arm_solution_changed();
                 }
                 options.clear();
                 if(arm_solution->get_optional(options)) {
@@ -948,16 +1100,8 @@ void Robot::process_move(Gcode *gcode, enum MOTION_MODE_T motion_mode)
     if(!next_command_is_MCS) {
         if(this->absolute_mode) {
             // apply wcs offsets and g92 offset and tool offset
-            if(!isnan(param[X_AXIS])) {
-                target[X_AXIS]= param[X_AXIS] + std::get<X_AXIS>(wcs_offsets[current_wcs]) - std::get<X_AXIS>(g92_offset) + std::get<X_AXIS>(tool_offset);
-            }
-
-            if(!isnan(param[Y_AXIS])) {
-                target[Y_AXIS]= param[Y_AXIS] + std::get<Y_AXIS>(wcs_offsets[current_wcs]) - std::get<Y_AXIS>(g92_offset) + std::get<Y_AXIS>(tool_offset);
-            }
-
-            if(!isnan(param[Z_AXIS])) {
-                target[Z_AXIS]= param[Z_AXIS] + std::get<Z_AXIS>(wcs_offsets[current_wcs]) - std::get<Z_AXIS>(g92_offset) + std::get<Z_AXIS>(tool_offset);
+            for(int i= X_AXIS; i <= Z_AXIS; ++i) {
+                if(!isnan(param[i])) target[i] = param[i] + wcs_offset[i];
             }
 
         }else{
@@ -1021,16 +1165,54 @@ void Robot::process_move(Gcode *gcode, enum MOTION_MODE_T motion_mode)
 
     bool moved= false;
 
+    // a firmware retract z lift is ramped in over the start of the travel move after it, so the lift and the travel are
+    // planned as blocks that blend rather than a stop for the lift on its own
+    float ramp_end[n_motors];
+    bool ramp= false;
+    if(zlift_pending != 0 && (motion_mode == SEEK || motion_mode == LINEAR)) {
+        if(!isnan(param[Z_AXIS])) {
+            // a move to a Z of its own takes the place of the lift
+            zlift_pending= 0;
+
+        }else if(isnan(delta_e)) {
+            float xy= hypotf(target[X_AXIS] - machine_position[X_AXIS], target[Y_AXIS] - machine_position[Y_AXIS]);
+            if(xy > 0.00001F) {
+                float f= std::min(1.0F, zlift_ramp_length / xy);
+                for (size_t i = 0; i < n_motors; ++i) {
+                    ramp_end[i]= machine_position[i] + (target[i] - machine_position[i]) * f;
+                }
+                ramp_end[Z_AXIS] += zlift_pending;
+                target[Z_AXIS] += zlift_pending;
+                zlift_pending= 0;
+                ramp= f < 1.0F;
+            }
+        }
+    }
+
+    // the soft endstops are checked for the whole of a line here, and of an arc in append_arc(), the path lies
+    // within them if its end does
+    bool ok= true;
+    if(soft_endstop_enabled && (motion_mode == SEEK || motion_mode == LINEAR)) {
+        ok= check_soft_endstops(target, target);
+        move_checked= true;
+    }
+
     // Perform any physical actions
-    switch(motion_mode) {
+    if(ok) switch(motion_mode) {
         case NONE: break;
 
         case SEEK:
+            if(ramp) this->append_line(gcode, ramp_end, this->seek_rate / seconds_per_minute, NAN);
             moved= this->append_line(gcode, target, this->seek_rate / seconds_per_minute, delta_e );
             break;
 
         case LINEAR:
-            moved= this->append_line(gcode, target, this->feed_rate / seconds_per_minute, delta_e );
+            if(ramp) this->append_line(gcode, ramp_end, this->feed_rate / seconds_per_minute, NAN);
+            if(gcode->has_letter('P') && gcode->has_letter('O')) {
+                moved= this->append_raster_line(gcode, target, this->feed_rate / seconds_per_minute);
+            }else{
+                moved= this->append_line(gcode, target, this->feed_rate / seconds_per_minute, delta_e );
+            }
             break;
 
         case CW_ARC:
@@ -1038,7 +1220,16 @@ void Robot::process_move(Gcode *gcode, enum MOTION_MODE_T motion_mode)
             // Note arcs are not currently supported by extruder based machines, as 3D slicers do not use arcs (G2/G3)
             moved= this->compute_arc(gcode, offset, target, motion_mode);
             break;
+
+        case CUBIC_SPLINE:
+        case QUADRATIC_SPLINE:
+            moved= this->append_spline(gcode, target, offset, motion_mode == QUADRATIC_SPLINE);
+            break;
     }
+    move_checked= false;
+
+    // a G5 without I and J continues smoothly from the previous one
+    spline_continues= moved && motion_mode == CUBIC_SPLINE;
 
     // needed to act as start of next arc command
     memcpy(arc_milestone, target, sizeof(arc_milestone));
@@ -1144,9 +1335,10 @@ void Robot::reset_position_from_current_actuator_position()
 // all transforms and is what we actually convert to actuator positions
 bool Robot::append_milestone(const float target[], float rate_mm_s)
 {
-    float deltas[n_motors];
+    // any move that does not go through the merging or segmenting has to come after them
+    finish_pending_moves();
+
     float transformed_target[n_motors]; // adjust target for bed compensation
-    float unit_vec[N_PRIMARY_AXIS];
 
     // unity transform by default
     memcpy(transformed_target, target, n_motors*sizeof(float));
@@ -1157,40 +1349,31 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         compensationTransform(transformed_target, false);
     }
 
-    // check soft endstops only for homed axis that are enabled
-    if(soft_endstop_enabled) {
-        for (int i = 0; i <= Z_AXIS; ++i) {
-            if(!is_homed(i)) continue;
-            if( (!isnan(soft_endstop_min[i]) && transformed_target[i] < soft_endstop_min[i]) || (!isnan(soft_endstop_max[i]) && transformed_target[i] > soft_endstop_max[i]) ) {
-                if(soft_endstop_halt) {
-                    if(THEKERNEL->is_grbl_mode()) {
-                        THEKERNEL->streams->printf("error:");
-                    }else{
-                        THEKERNEL->streams->printf("Error: ");
-                    }
-
-                    THEKERNEL->streams->printf("Soft Endstop %c was exceeded - reset or $X or M999 required\n", i+'X');
-                    THEKERNEL->call_event(ON_HALT, nullptr);
-                    return false;
+    // check soft endstops only for homed axis that are enabled, unless it was done for the whole move
+    if(soft_endstop_enabled && !move_checked && !check_soft_endstops(transformed_target, transformed_target)) return false;
 
-                //} else if(soft_endstop_truncate) {
-                    // TODO VERY hard to do need to go back and change the target, and calculate intercept with the edge
-                    // and store all preceding vectors that have on eor more points ourtside of bounds so we can create a propper clip against the boundaries
+    // find actuator position given the machine position, use actual adjusted target
+    ActuatorCoordinates actuator_pos;
+    if(!disable_arm_solution) {
+        arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
 
-                } else {
-                    // ignore it
-                    if(THEKERNEL->is_grbl_mode()) {
-                        THEKERNEL->streams->printf("error:");
-                    }else{
-                        THEKERNEL->streams->printf("Error: ");
-                    }
-                    THEKERNEL->streams->printf("Soft Endstop %c was exceeded - entire move ignored\n", i+'X');
-                    return false;
-                }
-            }
+    }else{
+        // basically the same as cartesian, would be used for special homing situations like for scara
+        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+            actuator_pos[i] = transformed_target[i];
         }
     }
 
+    return append_transformed_milestone(transformed_target, actuator_pos, rate_mm_s);
+}
+
+// The rest of append_milestone, for a target that has already been through the compensation transform and the arm solution
+// so segmented moves can do those for several segments at a time
+bool Robot::append_transformed_milestone(const float transformed_target[], ActuatorCoordinates &actuator_pos, float rate_mm_s)
+{
+    float deltas[n_motors];
+    float unit_vec[N_PRIMARY_AXIS];
+
 
     bool move= false;
     float sos= 0; // sum of squares for just primary axis (XYZ usually)
@@ -1241,18 +1424,6 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
         }
     }
 
-    // find actuator position given the machine position, use actual adjusted target
-    ActuatorCoordinates actuator_pos;
-    if(!disable_arm_solution) {
-        arm_solution->cartesian_to_actuator( transformed_target, actuator_pos );
-
-    }else{
-        // basically the same as cartesian, would be used for special homing situations like for scara
-        for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
-            actuator_pos[i] = transformed_target[i];
-        }
-    }
-
 #if MAX_ROBOT_ACTUATORS > 3
     sos= 0;
     // for the extruders just copy the position, and possibly scale it from mm³ to mm
@@ -1315,7 +1486,7 @@ bool Robot::append_milestone(const float target[], float rate_mm_s)
     // Append the block to the planner
     // NOTE that distance here should be either the distance travelled by the XYZ axis, or the E mm travel if a solo E move
     // NOTE this call will bock until there is room in the block queue, on_idle will continue to be called
-    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123)) {
+    if(THEKERNEL->planner->append_block( actuator_pos, n_motors, rate_mm_s, distance, auxilliary_move ? nullptr : unit_vec, acceleration, s_value, is_g123, raster_pixels, raster_position)) {
         // this is the new compensated machine position
         memcpy(this->compensated_machine_position, transformed_target, n_motors*sizeof(float));
         return true;
@@ -1353,11 +1524,91 @@ bool Robot::delta_move(const float *delta, float rate_mm_s, uint8_t naxis)
     return false;
 }
 
+// A G1 P<n> O[<mm>] is a raster line that runs up to speed and back down off the image with the laser off, so only the
+// line and its power values need to be sent. It starts at I J, in the same coordinates as X Y, or where it is if they
+// are not given. O is how far it runs up before the start and on after the end, O0 or no value is what the acceleration
+// needs to reach the feed rate. It is left at the end of the run on, which target is set to.
+bool Robot::append_raster_line(Gcode *gcode, float target[], float rate_mm_s)
+{
+    float start[n_motors];
+    memcpy(start, target, sizeof(start));
+    for (int i = X_AXIS; i <= Y_AXIS; ++i) {
+        char letter= 'I' + i;
+        if(!gcode->has_letter(letter)) {
+            start[i]= machine_position[i];
+            continue;
+        }
+        float p= this->to_millimeters(gcode->get_value(letter));
+        start[i]= next_command_is_MCS ? p : this->absolute_mode ? p + wcs_offset[i] : p + machine_position[i];
+    }
+
+    float dx= target[X_AXIS] - start[X_AXIS], dy= target[Y_AXIS] - start[Y_AXIS];
+    float len= hypotf(dx, dy);
+    if(rate_mm_s <= 0.0F || len < 0.00001F) {
+        // nothing to run up along, append_line() reports a bad feed rate
+        return append_line(gcode, target, rate_mm_s, NAN);
+    }
+    float u[2]{dx / len, dy / len};
+
+    // the acceleration it will be planned with, as append_transformed_milestone() limits it
+    float run= this->to_millimeters(gcode->get_value('O'));
+    if(run <= 0) {
+        float acceleration= default_acceleration;
+        for (int i = X_AXIS; i <= Y_AXIS; ++i) {
+            float ma= actuators[i]->get_acceleration();
+            float ca= fabsf(u[i] * acceleration);
+            if(!isnan(ma) && ca > ma) acceleration *= ma / ca;
+        }
+        run= rate_mm_s * rate_mm_s / (2.0F * acceleration);
+    }
+
+    float before[n_motors], after[n_motors];
+    memcpy(before, start, sizeof(before));
+    memcpy(after, target, sizeof(after));
+    for (int i = X_AXIS; i <= Y_AXIS; ++i) {
+        before[i] -= u[i] * run;
+        after[i] += u[i] * run;
+    }
+
+    // only the end was checked, the run up and run on may go past the soft endstops
+    if(soft_endstop_enabled) {
+        float lo[3], hi[3];
+        for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+            lo[i]= std::min(std::min(before[i], after[i]), std::min(start[i], machine_position[i]));
+            hi[i]= std::max(std::max(before[i], after[i]), std::max(start[i], machine_position[i]));
+        }
+        if(!check_soft_endstops(lo, hi)) {
+            raster_position += std::min(gcode->get_uint('P'), (uint32_t)0xFFFF);
+            return false;
+        }
+    }
+
+    // the laser is off for all but the line itself
+    if(merge_pending) flush_merged_line();
+    finish_segments();
+    bool g123= is_g123;
+    is_g123= false;
+    bool moved= append_milestone(before, this->seek_rate / seconds_per_minute);
+    moved= append_milestone(start, rate_mm_s) || moved;
+    is_g123= g123;
+    moved= append_line(gcode, target, rate_mm_s, NAN) || moved;
+    is_g123= false;
+    moved= append_milestone(after, rate_mm_s) || moved;
+    is_g123= g123;
+
+    memcpy(target, after, sizeof(after));
+    return moved;
+}
+
 // Append a move to the queue ( cutting it into segments if needed )
 bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, float delta_e)
 {
+    // a G1 P<n> spreads the next n laser power values sent with M649 evenly along the move, they are used up even if it does not move
+    uint16_t raster= (gcode->has_g && gcode->g == 1 && gcode->has_letter('P')) ? std::min(gcode->get_uint('P'), (uint32_t)0xFFFF) : 0;
+
     // catch negative or zero feed rates and return the same error as GRBL does
     if(rate_mm_s <= 0.0F) {
+        raster_position += raster;
         gcode->is_error= true;
         gcode->txt_after_ok= (rate_mm_s == 0 ? "Undefined feed rate" : "feed rate < 0");
         return false;
@@ -1366,6 +1617,18 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
     // Find out the distance for this move in XYZ in MCS
     float millimeters_of_travel = sqrtf(powf( target[X_AXIS] - machine_position[X_AXIS], 2 ) +  powf( target[Y_AXIS] - machine_position[Y_AXIS], 2 ) +  powf( target[Z_AXIS] - machine_position[Z_AXIS], 2 ));
 
+    if(raster > 0) {
+        // raster moves are never merged or segmented, the values are spread over the steps of a single block
+        if(merge_pending) flush_merged_line();
+        finish_segments();
+        raster_pixels= raster;
+        bool moved= this->append_milestone(target, rate_mm_s);
+        raster_pixels= 0;
+        raster_position += raster;
+        this->next_command_is_MCS = false;
+        return moved;
+    }
+
     if(millimeters_of_travel < 0.00001F) {
         // we have no movement in XYZ, probably E only extrude or retract
         return this->append_milestone(target, rate_mm_s);
@@ -1374,29 +1637,53 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
     /*
         For extruders, we need to do some extra work to limit the volumetric rate if specified...
         If using volumetric limts we need to be using volumetric extrusion for this to work as Ennn needs to be in mm³ not mm
-        We ask Extruder to do all the work but we need to pass in the relevant data.
+        We ask the selected Extruder to do all the work through the function it set when selected.
         NOTE we need to do this before we segment the line (for deltas)
     */
-    if(!isnan(delta_e) && gcode->has_g && gcode->g == 1) {
-        float data[2]= {delta_e, rate_mm_s / millimeters_of_travel};
-        if(PublicData::set_value(extruder_checksum, target_checksum, data)) {
-            rate_mm_s *= data[1]; // adjust the feedrate
-        }
+    if(!isnan(delta_e) && gcode->has_g && gcode->g == 1 && check_e_max_speeds_fnc) {
+        rate_mm_s *= check_e_max_speeds_fnc(delta_e, rate_mm_s / millimeters_of_travel); // adjust the feedrate
+    }
+
+    bool segment= !(this->disable_segmentation || (!segment_z_moves && !gcode->has_letter('X') && !gcode->has_letter('Y')));
+
+    bool moved;
+    if(this->merge_tolerance > 0.0F && gcode->has_g && gcode->g == 1 && isnan(delta_e)) {
+        // dense nearly collinear G1 segments are combined into one line before they get planned
+        moved= merge_line(target, rate_mm_s, segment);
+    } else {
+        moved= append_segmented_line(machine_position, target, rate_mm_s, segment);
     }
 
+    this->next_command_is_MCS = false; // always reset this
+
+    return moved;
+}
+
+// Append a line from start to target, which is normally the current machine_position ( cutting it into segments if needed )
+bool Robot::append_segmented_line(const float start[], const float target[], float rate_mm_s, bool segment)
+{
+    // queue any merged line and the rest of the last segmented move first
+    if(merge_pending) flush_merged_line();
+    finish_segments();
+
     // We cut the line into smaller segments. This is only needed on a cartesian robot for zgrid, but always necessary for robots with rotational axes like Deltas.
     // In delta robots either mm_per_line_segment can be used OR delta_segments_per_second
     // The latter is more efficient and avoids splitting fast long lines into very small segments, like initial z move to 0, it is what Johanns Marlin delta port does
     uint16_t segments;
 
-    if(this->disable_segmentation || (!segment_z_moves && !gcode->has_letter('X') && !gcode->has_letter('Y'))) {
+    if(!segment) {
         segments= 1;
 
+    } else if(this->mm_max_segment_error > 0.0F && !this->disable_arm_solution) {
+        // segment lengths are picked to keep the deviation from the straight line within a tolerance
+        return append_adaptive_line(start, target, rate_mm_s);
+
     } else if(this->delta_segments_per_second > 1.0F) {
         // enabled if set to something > 1, it is set to 0.0 by default
         // segment based on current speed and requested segments per second
         // the faster the travel speed the fewer segments needed
         // NOTE rate is mm/sec and we take into account any speed override
+        float millimeters_of_travel = sqrtf(powf( target[X_AXIS] - start[X_AXIS], 2 ) +  powf( target[Y_AXIS] - start[Y_AXIS], 2 ) +  powf( target[Z_AXIS] - start[Z_AXIS], 2 ));
         float seconds = millimeters_of_travel / rate_mm_s;
         segments = max(1.0F, ceilf(this->delta_segments_per_second * seconds));
         // TODO if we are only moving in Z on a delta we don't really need to segment at all
@@ -1405,43 +1692,448 @@ bool Robot::append_line(Gcode *gcode, const float target[], float rate_mm_s, flo
         if(this->mm_per_line_segment == 0.0F) {
             segments = 1; // don't split it up
         } else {
+            float millimeters_of_travel = sqrtf(powf( target[X_AXIS] - start[X_AXIS], 2 ) +  powf( target[Y_AXIS] - start[Y_AXIS], 2 ) +  powf( target[Z_AXIS] - start[Z_AXIS], 2 ));
             segments = ceilf( millimeters_of_travel / this->mm_per_line_segment);
         }
     }
 
-    bool moved= false;
-    if (segments > 1) {
-        // A vector to keep track of the endpoint of each segment
-        float segment_delta[n_motors];
-        float segment_end[n_motors];
-        memcpy(segment_end, machine_position, n_motors*sizeof(float));
-
-        // How far do we move each segment?
-        for (int i = 0; i < n_motors; i++)
-            segment_delta[i] = (target[i] - machine_position[i]) / segments;
-
-        // segment 0 is already done - it's the end point of the previous move so we start at segment 1
-        // We always add another point after this loop so we stop at segments-1, ie i < segments
-        for (int i = 1; i < segments; i++) {
-            if(THEKERNEL->is_halted()) return false; // don't queue any more segments
-            for (int j = 0; j < n_motors; j++)
-                segment_end[j] += segment_delta[j];
-
-            // Append the end of this segment to the queue
-            // this can block waiting for free block queue or if in feed hold
-            bool b= this->append_milestone(segment_end, rate_mm_s);
-            moved= moved || b;
+    if (segments <= 1) {
+        return this->append_milestone(target, rate_mm_s);
+    }
+
+    // the segments are queued by queue_segments() as the queue has room for them, see on_main_loop()
+    memcpy(seg.point, start, n_motors*sizeof(float));
+    memcpy(seg.end, target, n_motors*sizeof(float));
+
+    // How far do we move each segment?
+    for (int i = 0; i < n_motors; i++)
+        seg.delta[i] = (target[i] - start[i]) / segments;
+
+    start_segments(segments, rate_mm_s, false);
+    return true;
+}
+
+// start feeding the move setup in seg to the planner, segment 0 is already done - it's the end point of the previous move
+// so we start at segment 1, and the last one goes exactly to the end
+void Robot::start_segments(uint16_t segments, float rate_mm_s, bool arc)
+{
+    seg.i= 0;
+    seg.segments= segments;
+    seg.count= 0;
+    seg.rate_mm_s= rate_mm_s;
+    seg.s_value= s_value;
+    seg.source_line= source_line;
+    seg.g123= is_g123;
+    seg.arc= arc;
+    segmenting= true;
+
+    // queue what fits now without blocking
+    on_main_loop(nullptr);
+}
+
+// work out where the next segment of the move being segmented ends
+void Robot::next_segment_point(float p[])
+{
+    seg.i++;
+    if(seg.i >= seg.segments) {
+        memcpy(p, seg.end, n_motors*sizeof(float));
+        return;
+    }
+
+    if(seg.arc) {
+        if (seg.count < this->arc_correction ) {
+            // Apply vector rotation matrix
+            float r_axisi = seg.r_axis0 * seg.sin_T + seg.r_axis1 * seg.cos_T;
+            seg.r_axis0 = seg.r_axis0 * seg.cos_T - seg.r_axis1 * seg.sin_T;
+            seg.r_axis1 = r_axisi;
+            seg.count++;
+        } else {
+            // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+            // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
+            float cos_Ti = cosf(seg.i * seg.theta_per_segment);
+            float sin_Ti = sinf(seg.i * seg.theta_per_segment);
+            seg.r_axis0 = -seg.offset0 * cos_Ti + seg.offset1 * sin_Ti;
+            seg.r_axis1 = -seg.offset0 * sin_Ti - seg.offset1 * cos_Ti;
+            seg.count = 0;
         }
+
+        // Update arc_target location
+        seg.point[this->plane_axis_0] = seg.center_axis0 + seg.r_axis0;
+        seg.point[this->plane_axis_1] = seg.center_axis1 + seg.r_axis1;
+        seg.point[this->plane_axis_2] += seg.linear_per_segment;
+
+    } else {
+        for (int j = 0; j < n_motors; j++)
+            seg.point[j] += seg.delta[j];
     }
 
-    // Append the end of this full move to the queue
-    if(this->append_milestone(target, rate_mm_s)) moved= true;
+    memcpy(p, seg.point, n_motors*sizeof(float));
+}
 
-    this->next_command_is_MCS = false; // always reset this
+// queue up to n more segments of the move being segmented, this will block if there is not room for them
+void Robot::queue_segments(uint8_t n)
+{
+    float ends[k_segment_batch][k_max_actuators];
+    ActuatorCoordinates actuator_pos[k_segment_batch];
+
+    if(n > k_segment_batch) n= k_segment_batch;
+    if(n > seg.segments - seg.i) n= seg.segments - seg.i;
+
+    uint16_t first= seg.i; // the segments queued before these
+    for (int k = 0; k < n; k++) {
+        next_segment_point(ends[k]);
+    }
+
+    // the segment ends are transformed in batches so the arm solution can share the work between them
+    if(compensationTransform) {
+        for (int k = 0; k < n; k++) compensationTransform(ends[k], false);
+    }
+    if(!disable_arm_solution) {
+        arm_solution->batch_cartesian_to_actuator(ends[0], k_max_actuators, actuator_pos, n);
+    } else {
+        for (int k = 0; k < n; k++) {
+            for (size_t i = X_AXIS; i <= Z_AXIS; i++) actuator_pos[k][i] = ends[k][i];
+        }
+    }
+
+    // anything that waits in here must not start queuing anything else, see finish_segments() and on_idle()
+    queuing_segments= true;
+
+    // it might have been started by a different command that had a different S value
+    float s= s_value;
+    bool g123= is_g123;
+    uint32_t line= source_line;
+    s_value= seg.s_value;
+    is_g123= seg.g123;
+    source_line= seg.source_line;
+
+    for (int k = 0; k < n; k++) {
+        if(THEKERNEL->is_halted()) break; // don't queue any more segments
+
+        // a chord that follows one of the same arc joins it at the arc's speed
+        THEKERNEL->planner->arc_junction_speed= (seg.arc && first + k > 0) ? seg.arc_speed : 0.0F;
+
+        // Append the end of this segment to the queue
+        // this can block waiting for free block queue or if in feed hold
+        this->append_transformed_milestone(ends[k], actuator_pos[k], seg.rate_mm_s);
+    }
+    THEKERNEL->planner->arc_junction_speed= 0.0F;
+
+    s_value= s;
+    is_g123= g123;
+    source_line= line;
+    queuing_segments= false;
+    if(THEKERNEL->is_halted() || seg.i >= seg.segments) segmenting= false;
+}
+
+// queue the rest of the move being segmented waiting for room as needed, used when something else needs to be queued after it
+void Robot::finish_segments()
+{
+    while(segmenting && !queuing_segments) {
+        queue_segments(k_segment_batch);
+    }
+}
+
+// queue anything Robot is still holding back, the rest of a segmented move and any merged line
+void Robot::finish_pending_moves()
+{
+    if(merge_pending) flush_merged_line();
+    finish_segments();
+}
+
+// feed the move being segmented to the planner as the queue has room for it, so a long arc or segmented line
+// does not keep the main loop stuck waiting for room in the queue
+void Robot::on_main_loop(void *argument)
+{
+    if(jog_cancel) finish_jog_cancel();
+    else if(jogging && THECONVEYOR->is_idle()) jogging= false;
+
+    if(!segmenting || queuing_segments || THEKERNEL->get_feed_hold()) return;
+
+    unsigned int room= THECONVEYOR->queue_free();
+    if(room > 0) queue_segments(std::min(room, (unsigned int)k_segment_batch));
+}
+
+// Cut the line into segments just short enough to keep the path within mm_max_segment_error of the straight line.
+// Each step goes through the arm solution and the compensation transform separately, so where the kinematics are close
+// to linear (eg the middle of a delta) the segments are long and where they are not they get shorter.
+// The segment length is halved until it is within the error and grown again once the error gets small,
+// as the error goes with the square of the length, mm_per_line_segment if set is the longest allowed.
+bool Robot::append_adaptive_line(const float start[], const float target[], float rate_mm_s)
+{
+    float length = sqrtf(powf( target[X_AXIS] - start[X_AXIS], 2 ) +  powf( target[Y_AXIS] - start[Y_AXIS], 2 ) +  powf( target[Z_AXIS] - start[Z_AXIS], 2 ));
+    if(length < 0.00001F) return this->append_milestone(target, rate_mm_s);
+    float max_length= this->mm_per_line_segment > 0.0F ? this->mm_per_line_segment : length;
+    float min_length= 0.1F; // so a badly behaved solution can't generate an unbounded number of segments
+
+    float segment_start[n_motors];
+    float segment_end[n_motors];
+    memcpy(segment_start, start, n_motors*sizeof(float));
+
+    ActuatorCoordinates start_actuator, end_actuator;
+    float p[k_max_actuators];
+    memcpy(p, start, n_motors*sizeof(float));
+    if(compensationTransform) compensationTransform(p, false);
+    arm_solution->cartesian_to_actuator(p, start_actuator);
+
+    bool moved= false;
+    float done= 0; // how far along the line we are
+    float seg= max_length;
+    while(done < length) {
+        if(THEKERNEL->is_halted()) return false; // don't queue any more segments
+
+        float err;
+        float next;
+        while(true) {
+            next= std::min(done + seg, length);
+            float f= next / length;
+            for (int j = 0; j < n_motors; j++) {
+                segment_end[j] = start[j] + (target[j] - start[j]) * f;
+            }
+            err= segment_error(segment_start, segment_end, start_actuator, end_actuator);
+            if(err <= this->mm_max_segment_error || seg <= min_length) break;
+            seg= std::max(seg * 0.5F, min_length);
+        }
+
+        // the last segment goes exactly to the target
+        bool b= this->append_milestone(next >= length ? target : segment_end, rate_mm_s);
+        moved= moved || b;
+
+        done= next;
+        memcpy(segment_start, segment_end, n_motors*sizeof(float));
+        start_actuator= end_actuator;
+        if(err < this->mm_max_segment_error * 0.25F) seg= std::min(seg * 2.0F, max_length);
+    }
 
     return moved;
 }
 
+// find how far the middle of a segment will be from where it should be when the actuators move linearly between its ends
+// end_actuator is set to the actuator position of the end so it can be used as the start of the next segment
+float Robot::segment_error(const float start[], const float end[], const ActuatorCoordinates &start_actuator, ActuatorCoordinates &end_actuator) const
+{
+    float p[k_max_actuators];
+    memcpy(p, end, n_motors*sizeof(float));
+    if(compensationTransform) compensationTransform(p, false);
+    arm_solution->cartesian_to_actuator(p, end_actuator);
+
+    // where the middle should be
+    float mid[k_max_actuators];
+    for (int i = 0; i < n_motors; i++) {
+        mid[i]= (start[i] + end[i]) * 0.5F;
+    }
+    if(compensationTransform) compensationTransform(mid, false);
+
+    // where it will be
+    ActuatorCoordinates mid_actuator;
+    for (size_t i = X_AXIS; i <= Z_AXIS; i++) {
+        mid_actuator[i]= (start_actuator[i] + end_actuator[i]) * 0.5F;
+    }
+    arm_solution->actuator_to_cartesian(mid_actuator, p);
+
+    return sqrtf(powf(p[X_AXIS] - mid[X_AXIS], 2) + powf(p[Y_AXIS] - mid[Y_AXIS], 2) + powf(p[Z_AXIS] - mid[Z_AXIS], 2));
+}
+
+// Extends the merged line waiting to be appended to target if the whole of it stays within merge_tolerance of the
+// new line, otherwise the waiting one is appended and this one starts a new merged line.
+// The merged line is appended when anything else is queued or the planner queue runs low (see on_idle()),
+// so it is always reported as moved.
+bool Robot::merge_line(const float target[], float rate_mm_s, bool segment)
+{
+    // only XYZ may move, the rest of the actuators must be where they are
+    bool mergeable= merge_pending && rate_mm_s == merge_rate && s_value == merge_s_value && segment == merge_segment;
+    for (int i = N_PRIMARY_AXIS; mergeable && i < n_motors; i++) {
+        if(target[i] != merge_target[i]) mergeable= false;
+    }
+
+    if(mergeable) {
+        // see how far the end of the merged line is from the line from its start to the new target
+        float d[3], e[3];
+        float dd= 0, de= 0, ee= 0;
+        for (int i = X_AXIS; i <= Z_AXIS; i++) {
+            d[i]= target[i] - merge_start[i];
+            e[i]= merge_target[i] - merge_start[i];
+            dd += d[i] * d[i];
+            de += d[i] * e[i];
+            ee += e[i] * e[i];
+        }
+
+        // it must not turn back on itself, and the deviation of every point merged so far adds up to at most the tolerance
+        if(de > 0.0F && de < dd) {
+            float deviation= sqrtf(std::max(0.0F, ee - de * de / dd));
+            if(merge_deviation + deviation <= merge_tolerance) {
+                merge_deviation += deviation;
+                merge_source_line= source_line;
+                memcpy(merge_target, target, n_motors*sizeof(float));
+                return true;
+            }
+        }
+    }
+
+    flush_merged_line();
+
+    memcpy(merge_start, machine_position, n_motors*sizeof(float));
+    memcpy(merge_target, target, n_motors*sizeof(float));
+    merge_rate= rate_mm_s;
+    merge_s_value= s_value;
+    merge_source_line= source_line;
+    merge_segment= segment;
+    merge_deviation= 0;
+    merge_pending= true;
+    return true;
+}
+
+// append the merged line that is waiting, if there is one
+void Robot::flush_merged_line()
+{
+    if(!merge_pending) return;
+    merge_pending= false;
+    if(THEKERNEL->is_halted()) return; // it is thrown away along with the queue
+
+    // it is a G1 with the S value it had when it was merged, whatever the current command is
+    float s= s_value;
+    bool g123= is_g123;
+    uint32_t line= source_line;
+    s_value= merge_s_value;
+    is_g123= true;
+    source_line= merge_source_line;
+    append_segmented_line(merge_start, merge_target, merge_rate, merge_segment);
+    s_value= s;
+    is_g123= g123;
+    source_line= line;
+}
+
+// when the planner queue is running low append the merged line so it does not starve
+void Robot::on_idle(void *argument)
+{
+    if(merge_pending && !segmenting && THECONVEYOR->queue_count() < 4) flush_merged_line();
+}
+
+void Robot::on_halt(void *argument)
+{
+    if(argument == nullptr) {
+        // the merged line and the rest of any segmented move are discarded along with the queue
+        merge_pending= false;
+        segmenting= false;
+        zlift_pending= 0;
+        jogging= false;
+        jog_cancel= false;
+    }
+}
+
+// $J= jog, a G1 with only the axis, F and G20/G21/G53/G90/G91 words which are for this move only, F is required.
+// A jog is taken when nothing else is moving or after other jogs, it goes to the step ticker at once rather than
+// waiting for the queue to fill. A pendant holding a key down sends short jogs one after another and cancels them
+// when the key is released. Returns the error, empty if it was queued.
+std::string Robot::jog(const char *line)
+{
+    if(jog_cancel) finish_jog_cancel();
+    if(THEKERNEL->is_halted()) return "Alarm lock";
+    if(THEKERNEL->get_feed_hold()) return "Feed hold";
+    if(!jogging && !THECONVEYOR->is_idle()) return "Busy";
+
+    bool absolute= absolute_mode, inch= inch_mode, mcs= false, has_f= false;
+    string g1= "G1";
+    const char *p= line;
+    while(*p != '\0') {
+        if(*p == ' ' || *p == '\t') {
+            ++p;
+            continue;
+        }
+        char letter= toupper(*p++);
+        char *e;
+        float v= strtof(p, &e);
+        if(e == p) return "Invalid jog command";
+        switch(letter) {
+            case 'G':
+                if(v == 90) absolute= true;
+                else if(v == 91) absolute= false;
+                else if(v == 20) inch= true;
+                else if(v == 21) inch= false;
+                else if(v == 53) mcs= true;
+                else return "Invalid jog command";
+                break;
+            case 'F':
+                has_f= true;
+                // fall through
+            case 'X': case 'Y': case 'Z': case 'A': case 'B': case 'C':
+                g1 += ' ';
+                g1 += letter;
+                g1.append(p, e - p);
+                break;
+            default:
+                return "Invalid jog command";
+        }
+        p= e;
+    }
+    if(!has_f) return "Undefined feed rate";
+
+    // the modes and feed rate of the program are left as they were, and a laser stays off
+    bool was_absolute= absolute_mode, was_inch= inch_mode;
+    float was_feed_rate= feed_rate;
+    absolute_mode= absolute;
+    inch_mode= inch;
+    next_command_is_MCS= mcs;
+    is_g123= false;
+    jogging= true;
+
+    Gcode gcode(g1, &StreamOutput::NullStream);
+    process_move(&gcode, LINEAR);
+    finish_pending_moves();
+    THECONVEYOR->release_queue();
+
+    absolute_mode= was_absolute;
+    inch_mode= was_inch;
+    feed_rate= was_feed_rate;
+    next_command_is_MCS= false;
+
+    // it may have been cancelled while waiting for room in the queue
+    if(jog_cancel) finish_jog_cancel();
+    return gcode.is_error ? gcode.txt_after_ok : "";
+}
+
+// starts the jogs decelerating to a stop with the feed hold of the step ticker, they are dropped once stopped
+void Robot::cancel_jog()
+{
+    if(jogging && !jog_cancel) {
+        jog_cancel= true;
+        THEKERNEL->step_ticker->set_feed_hold(true);
+    }
+}
+
+// waits until the jogs have finished or been cancelled, so whatever is queued next is not thrown away with them
+void Robot::wait_for_jogs()
+{
+    if(!jogging) return;
+    while(!jog_cancel && !THECONVEYOR->is_idle() && !THEKERNEL->is_halted()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+    }
+    if(jog_cancel) finish_jog_cancel();
+    jogging= false;
+}
+
+// called from the main loop once a jog has been cancelled, waits for the stop then throws away what is left of the
+// jogs and takes the position from where the actuators actually are
+void Robot::finish_jog_cancel()
+{
+    StepTicker *st= THEKERNEL->step_ticker;
+    while(st->is_running() && !st->is_held() && !THEKERNEL->is_halted()) {
+        THEKERNEL->call_event(ON_IDLE, this);
+    }
+
+    jogging= false; // jog_cancel stays set until the flush is done so nothing more gets queued
+    merge_pending= false;
+    segmenting= false;
+    if(!THEKERNEL->is_halted()) {
+        THECONVEYOR->flush_queue(true);
+        reset_position_from_current_actuator_position();
+        // a hold asked for with ! still stands
+        if(THEKERNEL->get_feed_hold()) st->set_feed_hold(true);
+    }
+    jogging= false;
+    jog_cancel= false;
+}
+
 
 // Append an arc to the queue ( cutting it into segments as needed )
 // TODO does not support any E parameters so cannot be used for 3D printing.
@@ -1455,6 +2147,9 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
         return false;
     }
 
+    // queue any merged line and the rest of the last segmented move first
+    finish_pending_moves();
+
     // Scary math.
     // We need to use arc_milestone here to get accurate arcs as previous machine_position may have been skipped due to small movements
     float center_axis0 = this->arc_milestone[this->plane_axis_0] + offset[this->plane_axis_0];
@@ -1493,6 +2188,33 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
         return false;
     }
 
+    // check the soft endstops once against the box around the whole arc, that is its start and end in the linear axis,
+    // and its end and whichever of the four points on the circle at 0, 90, 180 and 270 degrees it sweeps through in the plane
+    if(soft_endstop_enabled) {
+        float lo[3], hi[3];
+        memcpy(lo, target, sizeof(lo));
+        memcpy(hi, target, sizeof(hi));
+        float plo[2]= {lo[plane_axis_0], lo[plane_axis_1]};
+        float phi[2]= {hi[plane_axis_0], hi[plane_axis_1]};
+        arc_extremes(center_axis0, center_axis1, radius, atan2f(r_axis1, r_axis0), angular_travel, plo, phi);
+        lo[plane_axis_0]= plo[0]; lo[plane_axis_1]= plo[1];
+        hi[plane_axis_0]= phi[0]; hi[plane_axis_1]= phi[1];
+        if(!check_soft_endstops(lo, hi)) return false;
+        move_checked= true;
+    }
+
+    // the speed centripetal acceleration limits it to, v² = a·r, is both the speed of the chords and the speed at the
+    // junctions between them, rather than what the planner would make of the small angles between the chords
+    float arc_acceleration = default_acceleration;
+    const uint8_t plane_axes[2] = {plane_axis_0, plane_axis_1};
+    for (uint8_t axis : plane_axes) {
+        if(axis >= n_motors) continue;
+        float ma = actuators[axis]->get_acceleration();
+        if(!isnan(ma) && ma < arc_acceleration) arc_acceleration = ma;
+    }
+    seg.arc_speed = sqrtf(arc_acceleration * radius);
+    if(seg.arc_speed < rate_mm_s) rate_mm_s = seg.arc_speed;
+
     // limit segments by maximum arc error
     float arc_segment = this->mm_per_arc_segment;
     if ((this->mm_max_arc_error > 0) && (2 * radius > this->mm_max_arc_error)) {
@@ -1510,87 +2232,56 @@ bool Robot::append_arc(Gcode * gcode, const float target[], const float offset[]
     // Figure out how many segments for this gcode
     // TODO for deltas we need to make sure we are at least as many segments as requested, also if mm_per_line_segment is set we need to use the
     uint16_t segments = floorf(millimeters_of_travel / arc_segment);
-    bool moved= false;
-
-    if(segments > 1) {
-        float theta_per_segment = angular_travel / segments;
-        float linear_per_segment = linear_travel / segments;
-
-        /* Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
-        and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
-        r_T = [cos(phi) -sin(phi);
-        sin(phi) cos(phi] * r ;
-        For arc generation, the center of the circle is the axis of rotation and the radius vector is
-        defined from the circle center to the initial position. Each line segment is formed by successive
-        vector rotations. This requires only two cos() and sin() computations to form the rotation
-        matrix for the duration of the entire arc. Error may accumulate from numerical round-off, since
-        all float numbers are single precision on the Arduino. (True float precision will not have
-        round off issues for CNC applications.) Single precision error can accumulate to be greater than
-        tool precision in some cases. Therefore, arc path correction is implemented.
-
-        Small angle approximation may be used to reduce computation overhead further. This approximation
-        holds for everything, but very small circles and large mm_per_arc_segment values. In other words,
-        theta_per_segment would need to be greater than 0.1 rad and N_ARC_CORRECTION would need to be large
-        to cause an appreciable drift error. N_ARC_CORRECTION~=25 is more than small enough to correct for
-        numerical drift error. N_ARC_CORRECTION may be on the order a hundred(s) before error becomes an
-        issue for CNC machines with the single precision Arduino calculations.
-        This approximation also allows mc_arc to immediately insert a line segment into the planner
-        without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
-        a correction, the planner should have caught up to the lag caused by the initial mc_arc overhead.
-        This is important when there are successive arc motions.
-        */
-        // Vector rotation matrix values
-        float cos_T = 1 - 0.5F * theta_per_segment * theta_per_segment; // Small angle approximation
-        float sin_T = theta_per_segment;
-
-        // TODO we need to handle the ABC axis here by segmenting them
-        float arc_target[n_motors];
-        float sin_Ti;
-        float cos_Ti;
-        float r_axisi;
-        uint16_t i;
-        int8_t count = 0;
-
-        // init array for all axis
-        memcpy(arc_target, machine_position, n_motors*sizeof(float));
-
-        // Initialize the linear axis
-        arc_target[this->plane_axis_2] = this->machine_position[this->plane_axis_2];
-
-        for (i = 1; i < segments; i++) { // Increment (segments-1)
-            if(THEKERNEL->is_halted()) return false; // don't queue any more segments
-
-            if (count < this->arc_correction ) {
-                // Apply vector rotation matrix
-                r_axisi = r_axis0 * sin_T + r_axis1 * cos_T;
-                r_axis0 = r_axis0 * cos_T - r_axis1 * sin_T;
-                r_axis1 = r_axisi;
-                count++;
-            } else {
-                // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-                // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-                cos_Ti = cosf(i * theta_per_segment);
-                sin_Ti = sinf(i * theta_per_segment);
-                r_axis0 = -offset[this->plane_axis_0] * cos_Ti + offset[this->plane_axis_1] * sin_Ti;
-                r_axis1 = -offset[this->plane_axis_0] * sin_Ti - offset[this->plane_axis_1] * cos_Ti;
-                count = 0;
-            }
-
-            // Update arc_target location
-            arc_target[this->plane_axis_0] = center_axis0 + r_axis0;
-            arc_target[this->plane_axis_1] = center_axis1 + r_axis1;
-            arc_target[this->plane_axis_2] += linear_per_segment;
-
-            // Append this segment to the queue
-            bool b= this->append_milestone(arc_target, rate_mm_s);
-            moved= moved || b;
-        }
+    if(segments <= 1) {
+        // Ensure last segment arrives at target location.
+        return this->append_milestone(target, rate_mm_s);
     }
 
-    // Ensure last segment arrives at target location.
-    if(this->append_milestone(target, rate_mm_s)) moved= true;
-
-    return moved;
+    seg.theta_per_segment = angular_travel / segments;
+    seg.linear_per_segment = linear_travel / segments;
+
+    /* Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
+    and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
+    r_T = [cos(phi) -sin(phi);
+    sin(phi) cos(phi] * r ;
+    For arc generation, the center of the circle is the axis of rotation and the radius vector is
+    defined from the circle center to the initial position. Each line segment is formed by successive
+    vector rotations. This requires only two cos() and sin() computations to form the rotation
+    matrix for the duration of the entire arc. Error may accumulate from numerical round-off, since
+    all float numbers are single precision on the Arduino. (True float precision will not have
+    round off issues for CNC applications.) Single precision error can accumulate to be greater than
+    tool precision in some cases. Therefore, arc path correction is implemented.
+
+    Small angle approximation may be used to reduce computation overhead further. This approximation
+    holds for everything, but very small circles and large mm_per_arc_segment values. In other words,
+    theta_per_segment would need to be greater than 0.1 rad and N_ARC_CORRECTION would need to be large
+    to cause an appreciable drift error. N_ARC_CORRECTION~=25 is more than small enough to correct for
+    numerical drift error. N_ARC_CORRECTION may be on the order a hundred(s) before error becomes an
+    issue for CNC machines with the single precision Arduino calculations.
+    This approximation also allows mc_arc to immediately insert a line segment into the planner
+    without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
+    a correction, the planner should have caught up to the lag caused by the initial mc_arc overhead.
+    This is important when there are successive arc motions.
+    */
+    // Vector rotation matrix values
+    seg.cos_T = 1 - 0.5F * seg.theta_per_segment * seg.theta_per_segment; // Small angle approximation
+    seg.sin_T = seg.theta_per_segment;
+
+    seg.center_axis0 = center_axis0;
+    seg.center_axis1 = center_axis1;
+    seg.r_axis0 = r_axis0;
+    seg.r_axis1 = r_axis1;
+    seg.offset0 = offset[this->plane_axis_0];
+    seg.offset1 = offset[this->plane_axis_1];
+
+    // TODO we need to handle the ABC axis here by segmenting them
+    // init array for all axis, this also initializes the linear axis
+    memcpy(seg.point, machine_position, n_motors*sizeof(float));
+    memcpy(seg.end, target, n_motors*sizeof(float));
+
+    // the segments are queued by queue_segments() as the queue has room for them, see on_main_loop()
+    start_segments(segments, rate_mm_s, true);
+    return true;
 }
 
 // Do the math for an arc and add it to the queue
@@ -1610,6 +2301,124 @@ bool Robot::compute_arc(Gcode * gcode, const float offset[], const float target[
     return this->append_arc(gcode, target, offset,  radius, is_clockwise );
 }
 
+// Append a G5 cubic or G5.1 quadratic Bézier spline in the XY plane to the queue, as line segments.
+// G5 control points are I J from the start and P Q from the end, if I J are not given it continues smoothly from the
+// last G5 by reflecting its second control point. G5.1 has one control point at I J from the start.
+// The curve is split in half until each piece is within mm_max_arc_error of a straight line, so gentle curves get
+// very few segments and tight ones get as many as they need. Any other axis moves in proportion along the curve.
+bool Robot::append_spline(Gcode *gcode, const float target[], const float offset[], bool quadratic)
+{
+    float rate_mm_s= this->feed_rate / seconds_per_minute;
+    // catch negative or zero feed rates and return the same error as GRBL does
+    if(rate_mm_s <= 0.0F) {
+        gcode->is_error= true;
+        gcode->txt_after_ok= (rate_mm_s == 0 ? "Undefined feed rate" : "feed rate < 0");
+        return false;
+    }
+
+    if(plane_axis_0 != X_AXIS || plane_axis_1 != Y_AXIS) {
+        gcode->is_error= true;
+        gcode->txt_after_ok= "G5 is only supported in the XY plane";
+        return false;
+    }
+
+    // control points
+    float p[4][2];
+    p[0][0]= machine_position[X_AXIS]; p[0][1]= machine_position[Y_AXIS];
+    p[3][0]= target[X_AXIS]; p[3][1]= target[Y_AXIS];
+
+    bool has_ij= gcode->has_letter('I') || gcode->has_letter('J');
+    if(quadratic) {
+        if(!has_ij) {
+            gcode->is_error= true;
+            gcode->txt_after_ok= "G5.1 requires I and J";
+            return false;
+        }
+        // raise to a cubic
+        float qx= p[0][0] + offset[X_AXIS], qy= p[0][1] + offset[Y_AXIS];
+        p[1][0]= p[0][0] + (qx - p[0][0]) * (2.0F / 3.0F); p[1][1]= p[0][1] + (qy - p[0][1]) * (2.0F / 3.0F);
+        p[2][0]= p[3][0] + (qx - p[3][0]) * (2.0F / 3.0F); p[2][1]= p[3][1] + (qy - p[3][1]) * (2.0F / 3.0F);
+
+    } else {
+        if(!gcode->has_letter('P') || !gcode->has_letter('Q') || (!has_ij && !spline_continues)) {
+            gcode->is_error= true;
+            gcode->txt_after_ok= "G5 requires P and Q, and I and J unless it follows a G5";
+            return false;
+        }
+        if(has_ij) {
+            p[1][0]= p[0][0] + offset[X_AXIS]; p[1][1]= p[0][1] + offset[Y_AXIS];
+        } else {
+            p[1][0]= p[0][0] - spline_last_pq[0]; p[1][1]= p[0][1] - spline_last_pq[1];
+        }
+        spline_last_pq[0]= this->to_millimeters(gcode->get_value('P'));
+        spline_last_pq[1]= this->to_millimeters(gcode->get_value('Q'));
+        p[2][0]= p[3][0] + spline_last_pq[0]; p[2][1]= p[3][1] + spline_last_pq[1];
+    }
+
+    float tolerance= this->mm_max_arc_error > 0.0F ? this->mm_max_arc_error : 0.01F;
+    float limit= 16.0F * tolerance * tolerance;
+
+    // subdivide depth first with an explicit stack so the pieces come out in order
+    const int max_depth= 10; // at most 1024 segments
+    struct piece_t { float c[4][2]; float t0, t1; uint8_t depth; } stack[max_depth + 1];
+    int sp= 0;
+    memcpy(stack[0].c, p, sizeof(p));
+    stack[0].t0= 0; stack[0].t1= 1; stack[0].depth= 0;
+
+    float segment_end[n_motors];
+    memcpy(segment_end, machine_position, n_motors*sizeof(float));
+    bool moved= false;
+
+    while(sp >= 0) {
+        if(THEKERNEL->is_halted()) return false; // don't queue any more segments
+
+        piece_t pc= stack[sp--];
+
+        // flatness bound on how far the curve can be from the chord
+        float ux= 3.0F * pc.c[1][0] - 2.0F * pc.c[0][0] - pc.c[3][0];
+        float uy= 3.0F * pc.c[1][1] - 2.0F * pc.c[0][1] - pc.c[3][1];
+        float vx= 3.0F * pc.c[2][0] - pc.c[0][0] - 2.0F * pc.c[3][0];
+        float vy= 3.0F * pc.c[2][1] - pc.c[0][1] - 2.0F * pc.c[3][1];
+        float flat= std::max(ux * ux, vx * vx) + std::max(uy * uy, vy * vy);
+
+        if(flat > limit && pc.depth < max_depth) {
+            // split in half (de Casteljau), push the second half first so the first comes off the stack next
+            piece_t l, r;
+            float m01[2], m12[2], m23[2], a[2], b[2], m[2];
+            for (int k = 0; k < 2; k++) {
+                m01[k]= (pc.c[0][k] + pc.c[1][k]) * 0.5F;
+                m12[k]= (pc.c[1][k] + pc.c[2][k]) * 0.5F;
+                m23[k]= (pc.c[2][k] + pc.c[3][k]) * 0.5F;
+                a[k]= (m01[k] + m12[k]) * 0.5F;
+                b[k]= (m12[k] + m23[k]) * 0.5F;
+                m[k]= (a[k] + b[k]) * 0.5F;
+                l.c[0][k]= pc.c[0][k]; l.c[1][k]= m01[k]; l.c[2][k]= a[k]; l.c[3][k]= m[k];
+                r.c[0][k]= m[k]; r.c[1][k]= b[k]; r.c[2][k]= m23[k]; r.c[3][k]= pc.c[3][k];
+            }
+            float tm= (pc.t0 + pc.t1) * 0.5F;
+            l.t0= pc.t0; l.t1= tm; r.t0= tm; r.t1= pc.t1;
+            l.depth= r.depth= pc.depth + 1;
+            stack[++sp]= r;
+            stack[++sp]= l;
+            continue;
+        }
+
+        // flat enough, this piece is one segment
+        if(pc.t1 >= 1.0F) break; // the last one goes exactly to the target below
+        for (int i = 0; i < n_motors; i++) {
+            segment_end[i]= machine_position[i] + (target[i] - machine_position[i]) * pc.t1;
+        }
+        segment_end[X_AXIS]= pc.c[3][0];
+        segment_end[Y_AXIS]= pc.c[3][1];
+        bool b= this->append_milestone(segment_end, rate_mm_s);
+        moved= moved || b;
+    }
+
+    // Ensure last segment arrives at target location.
+    if(this->append_milestone(target, rate_mm_s)) moved= true;
+
+    return moved;
+}
 
 float Robot::theta(float x, float y)
 {
@@ -1635,11 +2444,13 @@ void Robot::select_plane(uint8_t axis_0, uint8_t axis_1, uint8_t axis_2)
 void Robot::clearToolOffset()
 {
     this->tool_offset= wcs_t(0,0,0);
+    update_wcs_offset();
 }
 
 void Robot::setToolOffset(const float offset[3])
 {
     this->tool_offset= wcs_t(offset[0], offset[1], offset[2]);
+    update_wcs_offset();
 }
 
 float Robot::get_feed_rate() const
@@ -1647,18 +2458,63 @@ float Robot::get_feed_rate() const
     return THEKERNEL->gcode_dispatch->get_modal_command() == 0 ? seek_rate : feed_rate;
 }
 
+// the effective seconds per minute, speeds below 100% are done in real time by the step ticker
+float Robot::get_seconds_per_minute() const
+{
+    return seconds_per_minute / THEKERNEL->step_ticker->get_speed_override();
+}
+
 bool Robot::is_homed(uint8_t i) const
 {
     if(i >= 3) return false; // safety
 
-    // if we are homing we ignore soft endstops so return false
+    bool homed[3];
+    if(!get_homed(homed)) return false;
+    return homed[i];
+}
+
+// fills in which of XYZ are homed, returns false while homing so soft endstops are ignored then
+bool Robot::get_homed(bool homed[3]) const
+{
     bool homing;
     bool ok = PublicData::get_value(endstops_checksum, get_homing_status_checksum, 0, &homing);
     if(!ok || homing) return false;
 
     // check individual axis homing status
+    return PublicData::get_value(endstops_checksum, get_homed_status_checksum, 0, homed);
+}
+
+// checks the box from lo to hi in machine coordinates against the soft endstops of the homed axis, and reports
+// and halts or ignores the move as configured if it goes past one
+bool Robot::check_soft_endstops(const float lo[], const float hi[])
+{
     bool homed[3];
-    ok = PublicData::get_value(endstops_checksum, get_homed_status_checksum, 0, homed);
-    if(!ok) return false;
-    return homed[i];
+    if(!get_homed(homed)) return true;
+
+    for (int i = 0; i <= Z_AXIS; ++i) {
+        if(!homed[i]) continue;
+        if( (!isnan(soft_endstop_min[i]) && lo[i] < soft_endstop_min[i]) || (!isnan(soft_endstop_max[i]) && hi[i] > soft_endstop_max[i]) ) {
+            if(THEKERNEL->is_grbl_mode()) {
+                THEKERNEL->streams->printf("error:");
+            }else{
+                THEKERNEL->streams->printf("Error: ");
+            }
+
+            if(soft_endstop_halt) {
+                THEKERNEL->streams->printf("Soft Endstop %c was exceeded - reset or $X or M999 required\n", i+'X');
+                THEKERNEL->call_event(ON_HALT, nullptr);
+
+            //} else if(soft_endstop_truncate) {
+                // TODO VERY hard to do need to go back and change the target, and calculate intercept with the edge
+                // and store all preceding vectors that have on eor more points ourtside of bounds so we can create a propper clip against the boundaries
+
+            } else {
+                // ignore it
+                THEKERNEL->streams->printf("Soft Endstop %c was exceeded - entire move ignored\n", i+'X');
+            }
+            return false;
+        }
+    }
+
+    return true;
 }
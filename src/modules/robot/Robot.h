@@ -17,10 +17,10 @@ using std::string;
 
 #include "libs/Module.h"
 #include "ActuatorCoordinates.h"
+#include "ArmSolution.h"
 #include "nuts_bolts.h"
 
 class Gcode;
-class BaseSolution;
 class StepperMotor;
 
 // 9 WCS offsets
@@ -32,18 +32,28 @@ class Robot : public Module {
         Robot();
         void on_module_loaded();
         void on_gcode_received(void* argument);
+        void on_idle(void* argument);
+        void on_main_loop(void* argument);
+        void on_halt(void* argument);
+        void on_config_reload(void* argument);
 
         void reset_axis_position(float position, int axis);
         void reset_axis_position(float x, float y, float z);
         void reset_actuator_position(const ActuatorCoordinates &ac);
         void reset_position_from_current_actuator_position();
-        float get_seconds_per_minute() const { return seconds_per_minute; }
+        float get_seconds_per_minute() const; // includes the real time speed override
         float get_z_maxfeedrate() const { return this->max_speeds[Z_AXIS]; }
         float get_default_acceleration() const { return default_acceleration; }
+        float get_seek_rate() const { return seek_rate; }
+        float get_max_speed(int axis) const { return max_speeds[axis]; }
         void setToolOffset(const float offset[N_PRIMARY_AXIS]);
         float get_feed_rate() const;
         float get_s_value() const { return s_value; }
         void set_s_value(float s) { s_value= s; }
+        // the line the moves being queued come from, the line of the file being played or the N it was sent with,
+        // each block carries it so the status can say which line is running
+        void set_source_line(uint32_t line) { source_line= line; }
+        uint32_t get_source_line() const { return source_line; }
         void  push_state();
         void  pop_state();
         void check_max_actuator_speeds();
@@ -53,16 +63,30 @@ class Robot : public Module {
         void get_axis_position(float position[], size_t n= 3) const { memcpy(position, this->machine_position, n*sizeof(float)); }
         wcs_t get_axis_position() const { return wcs_t(machine_position[X_AXIS], machine_position[Y_AXIS], machine_position[Z_AXIS]); }
         void get_current_machine_position(float *pos) const;
+        void arm_solution_changed() { position_cache.valid= false; } // call after changing the arm solution settings
         void print_position(uint8_t subcode, std::string& buf, bool ignore_extruders=false) const;
         uint8_t get_current_wcs() const { return current_wcs; }
         std::vector<wcs_t> get_wcs_state() const;
         std::tuple<float, float, float, uint8_t> get_last_probe_position() const { return last_probe_position; }
         void set_last_probe_position(std::tuple<float, float, float, uint8_t> p) { last_probe_position = p; }
         bool delta_move(const float delta[], float rate_mm_s, uint8_t naxis);
+        void finish_pending_moves();
+        // the next travel move raises Z by dz over its first ramp_length mm of XY, for a firmware retract z lift
+        void lift_z_on_next_move(float dz, float ramp_length) { zlift_pending= dz; zlift_ramp_length= ramp_length; }
+        // drops a lift that has not been done yet, returns true if there was one
+        bool cancel_z_lift() { bool b= zlift_pending != 0; zlift_pending= 0; return b; }
+        bool is_segmenting() const { return segmenting; } // set while a segmented move is still being fed to the planner
+        // Grbl style $J= jogging, cancel_jog() can be called from any context and stops the jogs as quickly as they can decelerate
+        std::string jog(const char *line);
+        void cancel_jog();
+        bool is_jogging() const { return jogging; }
+        bool is_jog_cancelled() const { return jog_cancel; }
+        void wait_for_jogs();
+        uint32_t get_raster_position() const { return raster_position; } // raster power values used by all the G1 P<n> so far
         uint8_t register_motor(StepperMotor*);
         uint8_t get_number_registered_motors() const {return n_motors; }
 
-        BaseSolution* arm_solution;                           // Selected Arm solution ( millimeters to step calculation )
+        ArmSolution* arm_solution;                            // Selected Arm solution ( millimeters to step calculation )
 
         // gets accessed by Panel, Endstops, ZProbe
         std::vector<StepperMotor*> actuators;
@@ -71,6 +95,9 @@ class Robot : public Module {
         std::function<void(float*, bool)> compensationTransform;
         // set by an active extruder, returns the amount to scale the E parameter by (to convert mm³ to mm)
         std::function<float(void)> get_e_scale_fnc;
+        // set by an active extruder, given the E delta and the inverse of the move time returns what to scale the feedrate by
+        // to stay within its volumetric rate limit
+        std::function<float(float, float)> check_e_max_speeds_fnc;
 
         // Workspace coordinate systems
         wcs_t mcs2wcs(const wcs_t &pos) const;
@@ -88,6 +115,12 @@ class Robot : public Module {
             bool is_g123:1;
             bool soft_endstop_enabled:1;
             bool soft_endstop_halt:1;
+            bool merge_pending:1;                             // set when there is a merged line waiting to be appended
+            bool merge_segment:1;                             // set if the merged line is to be segmented
+            bool segmenting:1;                                // set while the segments in seg are being queued
+            bool queuing_segments:1;                          // set while in queue_segments()
+            bool spline_continues:1;                          // set if the last move was a G5
+            bool move_checked:1;                              // set while the move being queued has had its soft endstops checked as a whole
             uint8_t plane_axis_0:2;                           // Current plane ( XY, XZ, YZ )
             uint8_t plane_axis_1:2;
             uint8_t plane_axis_2:2;
@@ -99,31 +132,62 @@ class Robot : public Module {
             SEEK, // G0
             LINEAR, // G1
             CW_ARC, // G2
-            CCW_ARC // G3
+            CCW_ARC, // G3
+            CUBIC_SPLINE, // G5
+            QUADRATIC_SPLINE // G5.1
         };
 
         void load_config();
         bool append_milestone(const float target[], float rate_mm_s);
+        bool append_transformed_milestone(const float transformed_target[], ActuatorCoordinates &actuator_pos, float rate_mm_s);
+        static const uint8_t k_segment_batch= 8; // how many line segments go through the arm solution at a time
         bool append_line( Gcode* gcode, const float target[], float rate_mm_s, float delta_e);
+        bool append_raster_line(Gcode *gcode, float target[], float rate_mm_s);
+        bool append_segmented_line(const float start[], const float target[], float rate_mm_s, bool segment);
+        bool merge_line(const float target[], float rate_mm_s, bool segment);
+        void flush_merged_line();
+        void start_segments(uint16_t segments, float rate_mm_s, bool arc);
+        void next_segment_point(float p[]);
+        void queue_segments(uint8_t n);
+        void finish_segments();
+        bool append_adaptive_line(const float start[], const float target[], float rate_mm_s);
+        float segment_error(const float start[], const float end[], const ActuatorCoordinates &start_actuator, ActuatorCoordinates &end_actuator) const;
         bool append_arc( Gcode* gcode, const float target[], const float offset[], float radius, bool is_clockwise );
         bool compute_arc(Gcode* gcode, const float offset[], const float target[], enum MOTION_MODE_T motion_mode);
+        bool append_spline(Gcode* gcode, const float target[], const float offset[], bool quadratic);
         void process_move(Gcode *gcode, enum MOTION_MODE_T);
         bool is_homed(uint8_t i) const;
+        bool get_homed(bool homed[3]) const;
+        bool check_soft_endstops(const float lo[], const float hi[]);
+        void finish_jog_cancel();
 
         float theta(float x, float y);
         void select_plane(uint8_t axis_0, uint8_t axis_1, uint8_t axis_2);
         void clearToolOffset();
         int get_active_extruder() const;
+        void update_wcs_offset();
 
         std::array<wcs_t, MAX_WCS> wcs_offsets; // these are persistent once saved with M500
         uint8_t current_wcs{0}; // 0 means G54 is enabled this is persistent once saved with M500
         wcs_t g92_offset;
         wcs_t tool_offset; // used for multiple extruders, sets the tool offset for the current extruder applied first
+        float wcs_offset[3]{0,0,0}; // the three above together, added to a WCS position to get the MCS one, update_wcs_offset() after changing any of them
         std::tuple<float, float, float, uint8_t> last_probe_position{0,0,0,0};
 
         using saved_state_t= std::tuple<float, float, bool, bool, bool, uint8_t>; // save current feedrate and absolute mode, e absolute mode, inch mode, current_wcs
         std::stack<saved_state_t> state_stack;               // saves state from M120
 
+        bool jogging{false};                                 // set while the moves queued are jogs
+        volatile bool jog_cancel{false};                     // set by cancel_jog() until the jogs have been dropped
+
+        // the last actuator position get_current_machine_position() worked out the machine position of, so polling
+        // the position of an idle machine does not keep doing the forward kinematics
+        mutable struct {
+            float actuator[3];
+            float machine[3];
+            bool valid;
+        } position_cache;
+
         float machine_position[k_max_actuators]; // Last requested position, in millimeters, which is what we were requested to move to in the gcode after offsets applied but before compensation transform
         float compensated_machine_position[k_max_actuators]; // Last machine position, which is the position before converting to actuator coordinates (includes compensation transform)
 
@@ -132,11 +196,46 @@ class Robot : public Module {
         float mm_per_line_segment;                           // Setting : Used to split lines into segments
         float mm_per_arc_segment;                            // Setting : Used to split arcs into segments
         float mm_max_arc_error;                              // Setting : Used to limit total arc segments to max error
+        float mm_max_segment_error;                          // Setting : Used to size line segments by the error of the arm solution, 0 to disable
         float delta_segments_per_second;                     // Setting : Used to split lines into segments for delta based on speed
+        float merge_tolerance;                               // Setting : max deviation allowed when merging collinear G1 segments, 0 disables
+        float merge_start[k_max_actuators];                  // start of the merged line waiting to be appended
+        float merge_target[k_max_actuators];                 // end of the merged line waiting to be appended
+        float merge_rate;                                    // rate and S value of the merged line
+        float merge_s_value;
+        uint32_t merge_source_line;                          // the last line merged into it
+        float merge_deviation;                               // the part of merge_tolerance used up so far
+
+        // the segmented line or arc that is being fed to the planner a few segments at a time
+        struct {
+            float point[k_max_actuators];                    // end of the last segment queued
+            float end[k_max_actuators];                      // where the move ends
+            float delta[k_max_actuators];                    // how far each segment of a line moves
+            float center_axis0, center_axis1;                // for arcs
+            float r_axis0, r_axis1;
+            float offset0, offset1;
+            float theta_per_segment, linear_per_segment;
+            float cos_T, sin_T;
+            float rate_mm_s;
+            float arc_speed;                                 // the centripetal speed limit of the arc
+            float s_value;
+            uint32_t source_line;
+            uint16_t i;                                      // segments queued so far
+            uint16_t segments;
+            int8_t count;                                    // segments since the last arc correction
+            bool g123:1;
+            bool arc:1;
+        } seg;
         float seconds_per_minute;                            // for realtime speed change
         float default_acceleration;                          // the defualt accleration if not set for each axis
         float s_value;                                       // modal S value
+        uint32_t source_line{0};
+        float zlift_pending{0};                              // Z still to be raised by the next travel move
+        float zlift_ramp_length;
+        uint32_t raster_position;                            // where the next raster move starts in the laser raster data
+        uint16_t raster_pixels;                              // raster power values spread along the move being appended
         float arc_milestone[3];                              // used as start of an arc command
+        float spline_last_pq[2];                             // P Q of the last G5, for a following G5 without I J
 
         // Number of arc generation iterations by small angle approximation before exact arc trajectory
         // correction. This parameter may be decreased if there are issues with the accuracy of the arc
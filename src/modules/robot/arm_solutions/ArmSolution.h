@@ -0,0 +1,31 @@
+// The type Robot holds its arm solution as. Normally that is BaseSolution and the one named by arm_solution in config
+// is picked at run time, but a build can fix it with ARM_SOLUTION=<name> (see src/makefile). Robot then holds the
+// final class itself so every call to it is direct rather than through the vtable, and arm_solution in config is ignored.
+#pragma once
+
+#if defined(FIXED_ARM_SOLUTION_cartesian)
+#include "CartesianSolution.h"
+typedef CartesianSolution ArmSolution;
+#elif defined(FIXED_ARM_SOLUTION_rotatable_cartesian)
+#include "RotatableCartesianSolution.h"
+typedef RotatableCartesianSolution ArmSolution;
+#elif defined(FIXED_ARM_SOLUTION_linear_delta)
+#include "LinearDeltaSolution.h"
+typedef LinearDeltaSolution ArmSolution;
+#elif defined(FIXED_ARM_SOLUTION_rotary_delta)
+#include "RotaryDeltaSolution.h"
+typedef RotaryDeltaSolution ArmSolution;
+#elif defined(FIXED_ARM_SOLUTION_hbot)
+#include "HBotSolution.h"
+typedef HBotSolution ArmSolution;
+#elif defined(FIXED_ARM_SOLUTION_corexz)
+#include "CoreXZSolution.h"
+typedef CoreXZSolution ArmSolution;
+#elif defined(FIXED_ARM_SOLUTION_morgan)
+#include "MorganSCARASolution.h"
+typedef MorganSCARASolution ArmSolution;
+#else
+class BaseSolution;
+typedef BaseSolution ArmSolution;
+#define ARM_SOLUTION_FROM_CONFIG
+#endif
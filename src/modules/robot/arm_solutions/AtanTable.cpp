@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "AtanTable.h"
+
+#include <math.h>
+
+const static float pi     = 3.14159265358979323846F;
+const static float half_pi= pi / 2;
+
+// step^2/8 times the largest second derivative of atan over 0..1, 3*sqrt(3)/8
+const float AtanTable::max_error= 0.6495F / (8.0F * size * size);
+
+AtanTable::AtanTable()
+{
+    for (int i = 0; i <= size; ++i) {
+        table[i]= atanf((float)i / size);
+    }
+}
+
+float AtanTable::at(float t) const
+{
+    float f= t * size;
+    int i= (int)f;
+    if(i >= size) return table[size];
+    return table[i] + (f - i) * (table[i + 1] - table[i]);
+}
+
+float AtanTable::atan(float t) const
+{
+    if(isnan(t)) return t;
+    bool negative= t < 0;
+    if(negative) t= -t;
+    // atan(t) = pi/2 - atan(1/t), 1/inf is 0 so that one comes out right too
+    float a= t > 1.0F ? half_pi - at(1.0F / t) : at(t);
+    return negative ? -a : a;
+}
+
+float AtanTable::atan2(float y, float x) const
+{
+    float ax= fabsf(x), ay= fabsf(y);
+    if(ax == 0 && ay == 0) return 0;
+
+    // the ratio is always the smaller over the larger so it stays in the table
+    float a= ay > ax ? half_pi - at(ax / ay) : at(ay / ax);
+    if(x < 0) a= pi - a;
+    return y < 0 ? -a : a;
+}
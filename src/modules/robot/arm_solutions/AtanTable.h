@@ -0,0 +1,31 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ATANTABLE_H
+#define ATANTABLE_H
+
+// atan and atan2 from a table of atan over 0..1 with linear interpolation, for the arm solutions
+// that call them for every segment, the soft float atan2f is several times slower.
+// With 128 steps the error is under 5e-6 radians (0.0003 degrees) anywhere.
+class AtanTable
+{
+public:
+    static const int size= 128;
+    static const float max_error; // radians
+
+    AtanTable();
+
+    float atan(float t) const;
+    float atan2(float y, float x) const;
+
+private:
+    float at(float t) const; // 0 <= t <= 1
+
+    float table[size + 1];
+};
+
+#endif
@@ -14,6 +14,12 @@ class BaseSolution {
         virtual ~BaseSolution() {};
         virtual void cartesian_to_actuator(const float[], ActuatorCoordinates &) const = 0;
         virtual void actuator_to_cartesian(const ActuatorCoordinates &, float[]) const = 0;
+        // converts n points at once, point i is XYZ at cartesian_mm[i*stride], solutions that can share work across the
+        // points override this, the default just converts them one at a time
+        virtual void batch_cartesian_to_actuator(const float cartesian_mm[], size_t stride, ActuatorCoordinates actuator_mm[], size_t n) const
+        {
+            for (size_t i = 0; i < n; i++) cartesian_to_actuator(&cartesian_mm[i * stride], actuator_mm[i]);
+        }
         typedef std::map<char, float> arm_options_t;
         virtual bool set_optional(const arm_options_t& options) { return false; };
         virtual bool get_optional(arm_options_t& options, bool force_all= false) const { return false; };
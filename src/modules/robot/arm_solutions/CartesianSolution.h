@@ -7,7 +7,7 @@
 
 #include "libs/Config.h"
 
-class CartesianSolution : public BaseSolution {
+class CartesianSolution final : public BaseSolution {
     public:
         CartesianSolution(){};
         CartesianSolution(Config*){};
@@ -7,7 +7,7 @@
 
 #include "libs/Config.h"
 
-class CoreXZSolution : public BaseSolution {
+class CoreXZSolution final : public BaseSolution {
     public:
         CoreXZSolution(Config*);
         void cartesian_to_actuator(const float[], ActuatorCoordinates & ) const override;
@@ -7,7 +7,7 @@
 
 #include "libs/Config.h"
 
-class HBotSolution : public BaseSolution {
+class HBotSolution final : public BaseSolution {
     public:
         HBotSolution();
         HBotSolution(Config*){};
@@ -24,6 +24,11 @@
 #define ROUND(x, y) (roundf(x * (float)(1e ## y)) / (float)(1e ## y))
 #define PIOVER180   0.01745329251994329576923690768489F
 
+// the most a tracked arm height may be out before it is worked out with sqrtf again, in mm
+#define TRACK_TOLERANCE 0.0001F
+// an exact sqrtf for all the towers at least this often
+#define TRACK_RESYNC    32
+
 LinearDeltaSolution::LinearDeltaSolution(Config* config)
 {
     // arm_length is the length of the arm from hinge to hinge
@@ -54,6 +59,32 @@ void LinearDeltaSolution::init()
     delta_tower2_y = (delta_radius + tower2_offset) * sinf((330.0F + tower2_angle) * PIOVER180);
     delta_tower3_x = (delta_radius + tower3_offset) * cosf((90.0F  + tower3_angle) * PIOVER180); // back middle tower
     delta_tower3_y = (delta_radius + tower3_offset) * sinf((90.0F  + tower3_angle) * PIOVER180);
+
+    track.known = 0;
+    track.since_exact = 0;
+}
+
+// sqrtf(q) for one tower of a segment end, where q is the arm length squared less the squared horizontal distance
+// to the tower. Along a line or an arc the heights of consecutive segment ends lie on a smooth curve, so the next
+// one is predicted from the last two and a Newton step from there gets it to well under a step. The step moves the
+// guess by about as much as the guess was out, and what is left over is that squared over twice the height, so
+// when that could be over TRACK_TOLERANCE (a corner, the first ends of a move after a stop) it uses sqrtf.
+// One division instead of a soft float sqrtf for most segments.
+float LinearDeltaSolution::arm_height(int tower, float q) const
+{
+    float *p = track.previous[tower];
+    float h;
+    float guess = 2.0F * p[0] - p[1];
+    if(track.known < 2 || track.since_exact == 0 || q <= 0.0F || !(guess > 0.0F)) {
+        h = sqrtf(q);
+    } else {
+        h = 0.5F * (guess + q / guess);
+        float moved = guess - h;
+        if(moved * moved > 2.0F * TRACK_TOLERANCE * h) h = sqrtf(q);
+    }
+    p[1] = p[0];
+    p[0] = h;
+    return h;
 }
 
 void LinearDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const
@@ -73,6 +104,30 @@ void LinearDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], Actu
                                       ) + cartesian_mm[Z_AXIS];
 }
 
+// same as cartesian_to_actuator but the tower positions and arm length are only loaded once for all the points
+// and the arm heights are tracked from one segment end to the next, see arm_height()
+void LinearDeltaSolution::batch_cartesian_to_actuator(const float cartesian_mm[], size_t stride, ActuatorCoordinates actuator_mm[], size_t n) const
+{
+    const float l2 = arm_length_squared;
+    const float t1x = delta_tower1_x, t1y = delta_tower1_y;
+    const float t2x = delta_tower2_x, t2y = delta_tower2_y;
+    const float t3x = delta_tower3_x, t3y = delta_tower3_y;
+
+    for (size_t i = 0; i < n; i++) {
+        const float *c = &cartesian_mm[i * stride];
+        float x = c[X_AXIS], y = c[Y_AXIS], z = c[Z_AXIS];
+        float dx1 = t1x - x, dy1 = t1y - y;
+        float dx2 = t2x - x, dy2 = t2y - y;
+        float dx3 = t3x - x, dy3 = t3y - y;
+        actuator_mm[i][ALPHA_STEPPER] = arm_height(0, l2 - dx1 * dx1 - dy1 * dy1) + z;
+        actuator_mm[i][BETA_STEPPER ] = arm_height(1, l2 - dx2 * dx2 - dy2 * dy2) + z;
+        actuator_mm[i][GAMMA_STEPPER] = arm_height(2, l2 - dx3 * dx3 - dy3 * dy3) + z;
+
+        if(track.known < 2) track.known++;
+        if(++track.since_exact >= TRACK_RESYNC) track.since_exact = 0;
+    }
+}
+
 void LinearDeltaSolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_mm, float cartesian_mm[] ) const
 {
     // from http://en.wikipedia.org/wiki/Circumscribed_circle#Barycentric_coordinates_from_cross-_and_dot-products
@@ -5,17 +5,19 @@
 
 class Config;
 
-class LinearDeltaSolution : public BaseSolution {
+class LinearDeltaSolution final : public BaseSolution {
     public:
         LinearDeltaSolution(Config*);
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
+        void batch_cartesian_to_actuator(const float[], size_t, ActuatorCoordinates[], size_t) const override;
 
         bool set_optional(const arm_options_t& options) override;
-        bool get_optional(arm_options_t& options, bool force_all) const override;
+        bool get_optional(arm_options_t& options, bool force_all= false) const override;
 
     private:
         void init();
+        float arm_height(int tower, float q) const;
 
         float arm_length;
         float arm_radius;
@@ -33,4 +35,11 @@ class LinearDeltaSolution : public BaseSolution {
         float tower1_angle;
         float tower2_angle;
         float tower3_angle;
+
+        // the last two arm heights batch_cartesian_to_actuator worked out for each tower, see arm_height()
+        mutable struct {
+            float previous[3][2];
+            uint8_t known;
+            uint8_t since_exact;
+        } track;
 };
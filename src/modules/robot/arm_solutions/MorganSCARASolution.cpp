@@ -1,4 +1,5 @@
 #include "MorganSCARASolution.h"
+#include "AtanTable.h"
 #include <fastmath.h>
 #include "checksumm.h"
 #include "ActuatorCoordinates.h"
@@ -19,6 +20,7 @@
 #define morgan_homing_checksum        CHECKSUM("morgan_homing")
 #define morgan_undefined_min_checksum CHECKSUM("morgan_undefined_min")
 #define morgan_undefined_max_checksum CHECKSUM("morgan_undefined_max")
+#define morgan_atan_table_checksum    CHECKSUM("morgan_atan_table")
 
 #define SQ(x) powf(x, 2)
 #define ROUND(x, y) (roundf(x * 1e ## y) / 1e ## y)
@@ -42,13 +44,26 @@ MorganSCARASolution::MorganSCARASolution(Config* config)
     morgan_undefined_min  = config->value(morgan_undefined_min_checksum)->by_default(0.95f)->as_number();
     // max: head on maximum reach
     morgan_undefined_max  = config->value(morgan_undefined_max_checksum)->by_default(0.95f)->as_number();
+    // table lookup instead of atan2f, see AtanTable.h for the error
+    use_atan_table        = config->value(morgan_atan_table_checksum)->by_default(false)->as_bool();
+    atan_table            = nullptr;
 
     init();
 }
 
+MorganSCARASolution::~MorganSCARASolution()
+{
+    delete atan_table;
+}
+
 void MorganSCARASolution::init()
 {
+    if(use_atan_table && atan_table == nullptr) atan_table= new AtanTable;
+}
 
+float MorganSCARASolution::arctan2(float y, float x) const
+{
+    return atan_table != nullptr ? atan_table->atan2(y, x) : atan2f(y, x);
 }
 
 float MorganSCARASolution::to_degrees(float radians) const
@@ -90,8 +105,8 @@ void MorganSCARASolution::cartesian_to_actuator(const float cartesian_mm[], Actu
     SCARA_K1 = this->arm1_length + this->arm2_length * SCARA_C2;
     SCARA_K2 = this->arm2_length * SCARA_S2;
 
-    SCARA_theta = (atan2f(SCARA_pos[X_AXIS], SCARA_pos[Y_AXIS]) - atan2f(SCARA_K1, SCARA_K2)) * -1.0f; // Morgan Thomas turns Theta in oposite direction
-    SCARA_psi   = atan2f(SCARA_S2, SCARA_C2);
+    SCARA_theta = (arctan2(SCARA_pos[X_AXIS], SCARA_pos[Y_AXIS]) - arctan2(SCARA_K1, SCARA_K2)) * -1.0f; // Morgan Thomas turns Theta in oposite direction
+    SCARA_psi   = arctan2(SCARA_S2, SCARA_C2);
 
 
     actuator_mm[ALPHA_STEPPER] = to_degrees(SCARA_theta);             // Multiply by 180/Pi  -  theta is support arm angle
@@ -101,6 +116,35 @@ void MorganSCARASolution::cartesian_to_actuator(const float cartesian_mm[], Actu
 
 }
 
+// same as cartesian_to_actuator with the terms that only depend on the settings worked out once for all the points
+void MorganSCARASolution::batch_cartesian_to_actuator(const float cartesian_mm[], size_t stride, ActuatorCoordinates actuator_mm[], size_t n) const
+{
+    const float a1 = arm1_length, a2 = arm2_length;
+    const float c2_offset = (a1 == a2) ? 2.0f * a1 * a1 : a1 * a1 + a2 * a2;
+    const float c2_scale = 1.0f / (2.0f * a1 * a1);
+    const float ox = morgan_offset_x, oy = morgan_offset_y;
+    const float sx = morgan_scaling_x, sy = morgan_scaling_y;
+    const float c2_max = morgan_undefined_max, c2_min = -morgan_undefined_min;
+
+    for (size_t i = 0; i < n; i++) {
+        const float *c = &cartesian_mm[i * stride];
+        float px = (c[X_AXIS] - ox) * sx;
+        float py = c[Y_AXIS] * sy - oy;
+
+        float c2 = (px * px + py * py - c2_offset) * c2_scale;
+        if (c2 > c2_max) c2 = c2_max;
+        else if (c2 < c2_min) c2 = c2_min;
+
+        float s2 = sqrtf(1.0f - c2 * c2);
+        float theta = (arctan2(px, py) - arctan2(a1 + a2 * c2, a2 * s2)) * -1.0f; // Morgan Thomas turns Theta in oposite direction
+        float psi = arctan2(s2, c2);
+
+        actuator_mm[i][ALPHA_STEPPER] = to_degrees(theta);
+        actuator_mm[i][BETA_STEPPER ] = to_degrees(theta + psi);
+        actuator_mm[i][GAMMA_STEPPER] = c[Z_AXIS];
+    }
+}
+
 void MorganSCARASolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_mm, float cartesian_mm[] ) const
 {
     // Perform forward kinematics, and place results in cartesian_mm[]
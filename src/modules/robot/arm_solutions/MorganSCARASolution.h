@@ -4,19 +4,23 @@
 #include "BaseSolution.h"
 
 class Config;
+class AtanTable;
 
-class MorganSCARASolution : public BaseSolution {
+class MorganSCARASolution final : public BaseSolution {
     public:
         MorganSCARASolution(Config*);
+        ~MorganSCARASolution();
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
+        void batch_cartesian_to_actuator(const float[], size_t, ActuatorCoordinates[], size_t) const override;
 
         bool set_optional(const arm_options_t& options) override;
-        bool get_optional(arm_options_t& options, bool force_all) const override;
+        bool get_optional(arm_options_t& options, bool force_all= false) const override;
 
     private:
         void init();
         float to_degrees(float radians) const;
+        float arctan2(float y, float x) const;
 
         float arm1_length;
         float arm2_length;
@@ -27,6 +31,8 @@ class MorganSCARASolution : public BaseSolution {
         float morgan_undefined_min;
         float morgan_undefined_max;
         float slow_rate;
+        AtanTable *atan_table;
+        bool use_atan_table;
 };
 
 #endif // MORGANSCARASOLUTION_H
@@ -1,4 +1,5 @@
 #include "RotaryDeltaSolution.h"
+#include "AtanTable.h"
 #include "ActuatorCoordinates.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
@@ -20,6 +21,7 @@
 #define tool_offset_checksum            CHECKSUM("delta_tool_offset")
 
 #define delta_mirror_xy_checksum        CHECKSUM("delta_mirror_xy")
+#define delta_atan_table_checksum       CHECKSUM("delta_atan_table")
 
 const static float pi     = 3.14159265358979323846;    // PI
 const static float two_pi = 2 * pi;
@@ -56,10 +58,19 @@ RotaryDeltaSolution::RotaryDeltaSolution(Config *config)
     // mirror the XY axis
     mirror_xy= config->value(delta_mirror_xy_checksum)->by_default(true)->as_bool();
 
+    // table lookup instead of atanf, see AtanTable.h for the error
+    use_atan_table= config->value(delta_atan_table_checksum)->by_default(false)->as_bool();
+    atan_table= nullptr;
+
     debug_flag= false;
     init();
 }
 
+RotaryDeltaSolution::~RotaryDeltaSolution()
+{
+    delete atan_table;
+}
+
 // inverse kinematics
 // helper functions, calculates angle theta1 (for YZ-pane)
 int RotaryDeltaSolution::delta_calcAngleYZ(float x0, float y0, float z0, float &theta) const
@@ -76,7 +87,8 @@ int RotaryDeltaSolution::delta_calcAngleYZ(float x0, float y0, float z0, float &
     float yj = (y1 - a * b - sqrtf(d)) / (b * b + 1.0F);               // choosing outer point
     float zj = a + b * yj;
 
-    theta = 180.0F * atanf(-zj / (y1 - yj)) / pi + ((yj > y1) ? 180.0F : 0.0F);
+    float t = -zj / (y1 - yj);
+    theta = 180.0F * (atan_table != nullptr ? atan_table->atan(t) : atanf(t)) / pi + ((yj > y1) ? 180.0F : 0.0F);
     return 0;
 }
 
@@ -138,6 +150,8 @@ void RotaryDeltaSolution::init()
 {
     //these are calculated here and not in the config() as these variables can be fine tuned by the user.
     z_calc_offset  = -(delta_z_offset - tool_offset - delta_ee_offs);
+
+    if(use_atan_table && atan_table == nullptr) atan_table= new AtanTable;
 }
 
 void RotaryDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], ActuatorCoordinates &actuator_mm ) const
@@ -196,6 +210,39 @@ void RotaryDeltaSolution::cartesian_to_actuator(const float cartesian_mm[], Actu
 
 }
 
+// same as cartesian_to_actuator with the settings only loaded once, any point that fails goes through
+// cartesian_to_actuator so it gets the same handling and debug output
+void RotaryDeltaSolution::batch_cartesian_to_actuator(const float cartesian_mm[], size_t stride, ActuatorCoordinates actuator_mm[], size_t n) const
+{
+    if(debug_flag) {
+        BaseSolution::batch_cartesian_to_actuator(cartesian_mm, stride, actuator_mm, n);
+        return;
+    }
+
+    const bool mirror = mirror_xy;
+    const float z_offset = z_calc_offset;
+
+    for (size_t i = 0; i < n; i++) {
+        const float *c = &cartesian_mm[i * stride];
+        float x0 = mirror ? -c[X_AXIS] : c[X_AXIS];
+        float y0 = mirror ? -c[Y_AXIS] : c[Y_AXIS];
+        float z_with_offset = c[Z_AXIS] + z_offset;
+        float xc = x0 * cos120, xs = x0 * sin120;
+        float yc = y0 * cos120, ys = y0 * sin120;
+
+        float alpha_theta, beta_theta, gamma_theta;
+        if(delta_calcAngleYZ(x0, y0, z_with_offset, alpha_theta) == 0 &&
+           delta_calcAngleYZ(xc + ys, yc - xs, z_with_offset, beta_theta) == 0 && // rotate co-ordinates to +120 deg
+           delta_calcAngleYZ(xc - ys, yc + xs, z_with_offset, gamma_theta) == 0) { // rotate co-ordinates to -120 deg
+            actuator_mm[i][ALPHA_STEPPER] = alpha_theta;
+            actuator_mm[i][BETA_STEPPER ] = beta_theta;
+            actuator_mm[i][GAMMA_STEPPER] = gamma_theta;
+        } else {
+            cartesian_to_actuator(c, actuator_mm[i]);
+        }
+    }
+}
+
 void RotaryDeltaSolution::actuator_to_cartesian(const ActuatorCoordinates &actuator_mm, float cartesian_mm[] ) const
 {
     float x, y, z;
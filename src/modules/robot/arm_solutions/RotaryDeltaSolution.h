@@ -4,15 +4,18 @@
 #include "BaseSolution.h"
 
 class Config;
+class AtanTable;
 
-class RotaryDeltaSolution : public BaseSolution {
+class RotaryDeltaSolution final : public BaseSolution {
     public:
         RotaryDeltaSolution(Config*);
+        ~RotaryDeltaSolution();
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
         void actuator_to_cartesian(const ActuatorCoordinates &, float[] ) const override;
+        void batch_cartesian_to_actuator(const float[], size_t, ActuatorCoordinates[], size_t) const override;
 
         bool set_optional(const arm_options_t& options) override;
-        bool get_optional(arm_options_t& options, bool force_all) const override;
+        bool get_optional(arm_options_t& options, bool force_all= false) const override;
 
     private:
         void init();
@@ -29,9 +32,11 @@ class RotaryDeltaSolution : public BaseSolution {
         float delta_ee_offs;		// Ball joint plane to bottom of end effector surface
         float tool_offset;		// Distance between end effector ball joint plane and tip of tool
         float z_calc_offset;
+        AtanTable *atan_table;
 
         struct {
             bool debug_flag:1;
             bool mirror_xy:1;
+            bool use_atan_table:1;
         };
 };
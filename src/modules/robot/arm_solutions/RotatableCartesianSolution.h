@@ -9,7 +9,7 @@
 
 #define alpha_angle_checksum        CHECKSUM("alpha_angle")
 
-class RotatableCartesianSolution : public BaseSolution {
+class RotatableCartesianSolution final : public BaseSolution {
     public:
         RotatableCartesianSolution(Config*);
         void cartesian_to_actuator(const float[], ActuatorCoordinates &) const override;
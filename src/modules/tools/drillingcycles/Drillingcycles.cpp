@@ -16,9 +16,14 @@
 #include "SlowTicker.h"
 #include "StepperMotor.h"
 #include "StreamOutputPool.h"
+#include "StepTicker.h"
+#include "PublicData.h"
+#include "SpindlePublicAccess.h"
 #include "nuts_bolts.h"
 
-#include <math.h> /* fmod */
+#include "us_ticker_api.h"
+
+#include <math.h>
 
 
 
@@ -26,6 +31,10 @@
 #define RETRACT_TO_Z 0
 #define RETRACT_TO_R 1
 
+// a rigid tap is planned this much faster than the spindle turns, so the step generator slaved to it can keep up when
+// it runs a little faster than it was set to
+#define TAP_HEADROOM 1.25F
+
 // dwell units
 #define DWELL_UNITS_S 0 // seconds
 #define DWELL_UNITS_P 1 // millis
@@ -34,6 +43,8 @@
 #define drillingcycles_checksum CHECKSUM("drillingcycles")
 #define enable_checksum         CHECKSUM("enable")
 #define dwell_units_checksum    CHECKSUM("dwell_units")
+#define peck_clearance_checksum CHECKSUM("peck_clearance")
+#define tap_overshoot_checksum  CHECKSUM("tap_overshoot")
 
 Drillingcycles::Drillingcycles() {}
 
@@ -51,6 +62,7 @@ void Drillingcycles::on_module_loaded()
 
     // events
     this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_event(ON_CONFIG_RELOAD);
 
     // reset values
     this->cycle_started = false;
@@ -67,6 +79,8 @@ void Drillingcycles::on_config_reload(void *argument)
     // take the dwell units configured by user, or select S (seconds) by default
     string dwell_units = THEKERNEL->config->value(drillingcycles_checksum, dwell_units_checksum)->by_default("S")->as_string();
     this->dwell_units  = (dwell_units == "P") ? DWELL_UNITS_P : DWELL_UNITS_S;
+    this->peck_clearance = THEKERNEL->config->value(drillingcycles_checksum, peck_clearance_checksum)->by_default(0.5F)->as_number();
+    this->tap_overshoot = THEKERNEL->config->value(drillingcycles_checksum, tap_overshoot_checksum)->by_default(1.0F)->as_number();
 }
 
 /*
@@ -75,7 +89,7 @@ http://www.tormach.com/g81_g89_backgroung.html
 
 /!\ This code expects a clean gcode, no fail safe at this time.
 
-Implemented     : G80-83, G98, G99
+Implemented     : G80-84, G98, G99
 Absolute mode   : yes
 Relative mode   : no
 Incremental (L) : no
@@ -132,11 +146,14 @@ void Drillingcycles::peck_hole()
     // start values
     float depth  = this->sticky_r - this->sticky_z; // travel depth
     float cycles = depth / this->sticky_q;          // cycles count
-    float rest   = fmod(depth, this->sticky_q);     // final pass
     float z_pos  = this->sticky_r;                  // current z position
+    float clear  = THEROBOT->from_millimeters(this->peck_clearance);
 
     // for each cycle
     for (int i = 1; i < cycles; i++) {
+        // rapids back down to just above the last peck, the hole above it is already cut
+        if (z_pos + clear < this->sticky_r)
+            this->send_gcode("G0 Z%1.4f", z_pos + clear);
         // decrement depth
         z_pos -= this->sticky_q;
         // feed down to depth at feedrate (F and Z)
@@ -146,12 +163,116 @@ void Drillingcycles::peck_hole()
     }
 
     // final depth not reached
-    if (rest > 0) {
+    if (z_pos > this->sticky_z) {
+        if (z_pos + clear < this->sticky_r)
+            this->send_gcode("G0 Z%1.4f", z_pos + clear);
         // feed down to final depth at feedrate (F and Z)
         this->send_gcode("G1 F%1.4f Z%1.4f", this->sticky_f, this->sticky_z);
     }
 }
 
+/* Z follows the pulses of the spindle's tachometer, see StepTicker::set_spindle_sync(), 0 ends it */
+void Drillingcycles::set_tap_sync(float ticks_per_pulse)
+{
+    bool on = ticks_per_pulse > 0;
+    if (on) THEKERNEL->step_ticker->set_spindle_sync(ticks_per_pulse);
+    PublicData::set_value(spindle_checksum, sync_checksum, &on);
+    if (!on) THEKERNEL->step_ticker->set_spindle_sync(0);
+}
+
+/* run the main loop until the spindle has stopped, or is back up to speed, false if it went wrong and has halted */
+bool Drillingcycles::wait_for_spindle(bool stopped, float target_rpm)
+{
+    uint32_t start = us_ticker_read();
+    while (true) {
+        struct pad_spindle s;
+        if (!PublicData::get_value(spindle_checksum, rigid_tap_checksum, &s) || THEKERNEL->is_halted()) return false;
+        if (stopped ? s.rpm <= 0 : s.rpm >= target_rpm * 0.9F) return true;
+        if (us_ticker_read() - start > 10000000) {
+            THEKERNEL->streams->printf("Error: G84 spindle did not %s. HALT asserted - reset or M999 required\n", stopped ? "stop" : "get up to speed");
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            return false;
+        }
+        THEKERNEL->call_event(ON_IDLE, this);
+    }
+}
+
+/* G84: rigid tapping, Z is slaved to the spindle down to depth and back up it reversed, F is the pitch times the rpm.
+   The tachometer does not tell which way the spindle turns, so it is stopped at the bottom and the top and Z follows
+   it until it has, which takes about a second each time, the tap goes a little past depth as the spindle runs down */
+bool Drillingcycles::tap_hole()
+{
+    struct pad_spindle s;
+    if (!PublicData::get_value(spindle_checksum, rigid_tap_checksum, &s) || !s.can_sync || !s.can_reverse) {
+        THEKERNEL->streams->printf("Drillingcycles: G84 needs a spindle with a feedback_pin on P0.23 or P0.24 and a reverse_pin\r\n");
+        return false;
+    }
+    if (!s.on || s.reverse || s.target_rpm <= 0) {
+        THEKERNEL->streams->printf("Drillingcycles: G84 needs the spindle on with M3\r\n");
+        return false;
+    }
+
+    THECONVEYOR->wait_for_idle();
+    if (!wait_for_spindle(false, s.target_rpm)) return true;
+
+    StepperMotor *z = THEROBOT->actuators[Z_AXIS];
+    float bottom = z->get_current_position() - THEROBOT->to_millimeters(this->sticky_r - this->sticky_z);
+    float feed = this->sticky_f * TAP_HEADROOM;
+    float ticks = 60.0F * THEKERNEL->step_ticker->get_frequency() / (s.target_rpm * TAP_HEADROOM * s.pulses_per_rev);
+
+    // down to depth with the spindle
+    set_tap_sync(ticks);
+    this->send_gcode("G1 F%1.4f Z%1.4f", feed, this->sticky_z - THEROBOT->from_millimeters(this->tap_overshoot));
+    THEROBOT->finish_pending_moves();
+    THECONVEYOR->release_queue();
+    while (z->get_current_position() > bottom) {
+        THEKERNEL->call_event(ON_IDLE, this);
+        if (!PublicData::get_value(spindle_checksum, rigid_tap_checksum, &s) || s.rpm <= 0) {
+            THEKERNEL->streams->printf("Error: G84 spindle stopped. HALT asserted - reset or M999 required\n");
+            THEKERNEL->call_event(ON_HALT, nullptr);
+        }
+        if (THEKERNEL->is_halted()) {
+            set_tap_sync(0);
+            return true;
+        }
+    }
+
+    // then the spindle is stopped, and Z follows it until it has
+    int dir = 0;
+    PublicData::set_value(spindle_checksum, direction_checksum, &dir);
+    bool ok = wait_for_spindle(true, 0);
+    if (ok && THECONVEYOR->is_idle()) {
+        THEKERNEL->streams->printf("Error: G84 spindle took more than tap_overshoot to stop. HALT asserted - reset or M999 required\n");
+        THEKERNEL->call_event(ON_HALT, nullptr);
+        ok = false;
+    }
+    // what is left of the move is not needed
+    z->stop_moving();
+    set_tap_sync(0);
+    if (!ok) return true;
+    THECONVEYOR->wait_for_idle();
+    THEROBOT->reset_position_from_current_actuator_position();
+
+    // back up to R with the spindle in reverse
+    set_tap_sync(ticks);
+    this->send_gcode("G1 F%1.4f Z%1.4f", feed, this->sticky_r);
+    THEROBOT->finish_pending_moves();
+    THECONVEYOR->release_queue();
+    dir = -1;
+    PublicData::set_value(spindle_checksum, direction_checksum, &dir);
+    THECONVEYOR->wait_for_idle();
+    set_tap_sync(0);
+    if (THEKERNEL->is_halted()) return true;
+
+    // and forward again for the next hole
+    dir = 0;
+    PublicData::set_value(spindle_checksum, direction_checksum, &dir);
+    if (!wait_for_spindle(true, 0)) return true;
+    dir = 1;
+    PublicData::set_value(spindle_checksum, direction_checksum, &dir);
+    return true;
+}
+
 void Drillingcycles::make_hole(Gcode *gcode)
 {
     // compile X and Y values
@@ -167,15 +288,20 @@ void Drillingcycles::make_hole(Gcode *gcode)
     // rapids to retract position (R)
     this->send_gcode("G0 Z%1.4f", this->sticky_r);
 
+    // if rigid tapping
+    if (gcode->g == 84) {
+        if (!this->tap_hole())
+            THEKERNEL->streams->printf("Drillingcycles: skip hole...\r\n");
+    }
     // if peck drilling
-    if (this->sticky_q > 0)
+    else if (this->sticky_q > 0)
         this->peck_hole();
     else
         // feed down to depth at feedrate (F and Z)
         this->send_gcode("G1 F%1.4f Z%1.4f", this->sticky_f, this->sticky_z);
 
     // if dwell, wait for x seconds
-    if (this->sticky_p > 0) {
+    if (this->sticky_p > 0 && gcode->g != 84) {
         // dwell exprimed in seconds
         if (this->dwell_units == DWELL_UNITS_S)
             this->send_gcode("G4 S%u", this->sticky_p);
@@ -202,17 +328,18 @@ void Drillingcycles::on_gcode_received(void* argument)
 
     // cycle start
     if (code == 98 || code == 99) {
-        // wait for any moves left and current position is update
-        THEKERNEL->conveyor->wait_for_idle();
-        // get actual position from robot
+        // set retract type
+        this->retract_type = (code == 98) ? RETRACT_TO_Z : RETRACT_TO_R;
+        // a G98/G99 on every hole only changes the retract type, Initial-Z stays where the cycle started
+        if (this->cycle_started)
+            return;
+        // get the last planned position from robot, so the queue does not have to be drained
         float pos[3];
         THEROBOT->get_axis_position(pos);
         // convert to WCS
         Robot::wcs_t wpos= THEROBOT->mcs2wcs(pos);
         // backup Z position as Initial-Z value
         this->initial_z = std::get<Z_AXIS>(wpos); // must use the work coordinate position
-        // set retract type
-        this->retract_type = (code == 98) ? RETRACT_TO_Z : RETRACT_TO_R;
         // reset sticky values
         this->reset_sticky();
         // mark cycle started and gcode taken
@@ -239,7 +366,7 @@ void Drillingcycles::on_gcode_received(void* argument)
             return;
         }
         // implemented cycles
-        if (code == 81 || code == 82 || code == 83) {
+        if (code == 81 || code == 82 || code == 83 || code == 84) {
             this->update_sticky(gcode);
             this->make_hole(gcode);
         }
@@ -27,6 +27,9 @@ class Drillingcycles : public Module
         int  send_gcode(const char* format, ...);
         void make_hole(Gcode *gcode);
         void peck_hole();
+        bool tap_hole();
+        void set_tap_sync(float ticks_per_pulse);
+        bool wait_for_spindle(bool stopped, float target_rpm);
 
         bool cycle_started; // cycle status
         int  retract_type;  // rretract type
@@ -42,6 +45,8 @@ class Drillingcycles : public Module
         int   sticky_p;     // dwell pause
 
         int   dwell_units;  // units for dwell
+        float peck_clearance; // mm above the last peck to rapid back down to
+        float tap_overshoot;  // mm past depth the tap can follow the spindle as it stops
 };
 
 #endif
@@ -0,0 +1,179 @@
+/*
+    Checks a motor against a quadrature encoder on its shaft or axis, counted by the QEI in hardware so a count costs
+    nothing. PhA is P1.20 and PhB P1.23, every edge of both is counted.
+    The counts are compared with the steps the motor was given each time a block starts and once it has stopped, a
+    difference over max_error_mm is reported, halts, or is corrected by the next block planned for it.
+*/
+
+#include "Encoder.h"
+#include "Kernel.h"
+#include "Config.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "StreamOutputPool.h"
+#include "StreamOutput.h"
+#include "Gcode.h"
+#include "Robot.h"
+#include "Conveyor.h"
+#include "StepperMotor.h"
+
+#include "mbed.h"
+
+#include <math.h>
+#include <string>
+
+#define encoder_checksum            CHECKSUM("encoder")
+#define enable_checksum             CHECKSUM("enable")
+#define actuator_checksum           CHECKSUM("actuator")
+#define counts_per_mm_checksum      CHECKSUM("counts_per_mm")
+#define invert_checksum             CHECKSUM("invert")
+#define max_error_mm_checksum       CHECKSUM("max_error_mm")
+#define action_checksum             CHECKSUM("action")
+
+Encoder::Encoder()
+{
+    action= REPORT;
+    was_moving= false;
+    over= false;
+}
+
+void Encoder::on_module_loaded()
+{
+    if(!THEKERNEL->config->value( encoder_checksum, enable_checksum )->by_default(false)->as_bool()) {
+        delete this;
+        return;
+    }
+
+    std::string a= THEKERNEL->config->value( encoder_checksum, actuator_checksum )->by_default("alpha")->as_string();
+    static const char *names[]= {"alpha", "beta", "gamma", "delta", "epsilon", "zeta"};
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]) && i < THEROBOT->actuators.size(); i++) {
+        if(a == names[i]) motor= THEROBOT->actuators[i];
+    }
+    counts_per_mm= THEKERNEL->config->value( encoder_checksum, counts_per_mm_checksum )->by_default(0)->as_number();
+    if(motor == nullptr || counts_per_mm <= 0) {
+        THEKERNEL->streams->printf("Error: encoder needs an actuator that is configured and counts_per_mm\n");
+        delete this;
+        return;
+    }
+
+    // the filament detector counts on the QEI when its encoder is on P1.23
+    if(LPC_SC->PCONP & (1 << 18)) {
+        THEKERNEL->streams->printf("Error: encoder can not be used, the QEI is in use\n");
+        delete this;
+        return;
+    }
+
+    max_error_mm= THEKERNEL->config->value( encoder_checksum, max_error_mm_checksum )->by_default(0.1F)->as_number();
+    std::string act= THEKERNEL->config->value( encoder_checksum, action_checksum )->by_default("report")->as_string();
+    action= act == "halt" ? HALT : act == "correct" ? CORRECT : REPORT;
+
+    setup_qei(THEKERNEL->config->value( encoder_checksum, invert_checksum )->by_default(false)->as_bool());
+    zero(motor->get_current_step(), LPC_QEI->QEIPOS);
+    last_blocks= THECONVEYOR->get_blocks_started();
+
+    register_for_event(ON_IDLE);
+    register_for_event(ON_GCODE_RECEIVED);
+}
+
+// quadrature on PhA and PhB counting the edges of both, no interrupts
+void Encoder::setup_qei(bool invert)
+{
+    LPC_SC->PCONP |= (1 << 18);     // Power QEI ON
+    LPC_PINCON->PINSEL3 = (LPC_PINCON->PINSEL3 & ~((3 << 8) | (3 << 14))) | (1 << 8) | (1 << 14); // P1.20 is PhA, P1.23 PhB
+    LPC_QEI->QEICONF = (1 << 2) | (invert ? 1 : 0); // CapMode x4, DirInv
+    LPC_QEI->FILTER = 100;          // ignore glitches shorter than 100 PCLK
+    LPC_QEI->QEIMAXPOS = 0xFFFFFFFF;
+    LPC_QEI->QEICON = 1;            // reset the position
+}
+
+void Encoder::zero(int32_t steps, uint32_t counts)
+{
+    zero_steps= last_steps= steps;
+    zero_counts= counts;
+    over= false;
+}
+
+// where the motor was stepped to less where the encoder says it is
+float Encoder::error_mm(int32_t steps, uint32_t counts) const
+{
+    return (steps - zero_steps) / motor->get_steps_per_mm() - (int32_t)(counts - zero_counts) / counts_per_mm;
+}
+
+void Encoder::on_idle(void *)
+{
+    if(THEKERNEL->is_halted()) return;
+
+    // checked as each block starts, and once when the motor stops when it is where it will stay
+    uint32_t blocks= THECONVEYOR->get_blocks_started();
+    bool moving= motor->is_moving();
+    bool started= blocks != last_blocks;
+    bool stopped= was_moving && !moving;
+    last_blocks= blocks;
+    was_moving= moving;
+
+    // both at the same moment, no step can come in between
+    __disable_irq();
+    int32_t steps= motor->get_current_step();
+    uint32_t counts= LPC_QEI->QEIPOS;
+    __enable_irq();
+
+    if(!started && !stopped) {
+        // it has not been stepped, the position was set by homing or G92
+        if(!moving && steps != last_steps) zero(steps, counts);
+        return;
+    }
+    last_steps= steps;
+
+    float e= error_mm(steps, counts);
+    if(fabsf(e) > fabsf(worst_mm)) worst_mm= e;
+
+    if(fabsf(e) <= max_error_mm) {
+        if(fabsf(e) < max_error_mm / 2) over= false;
+        return;
+    }
+
+    switch(action) {
+        case HALT:
+            THEKERNEL->streams->printf("Error: encoder following error of %1.4fmm, the motor lost steps\n", e);
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            break;
+
+        case CORRECT: {
+            // it is where the encoder says, so the next block planned for it makes up the difference
+            int32_t d= lroundf(-e * motor->get_steps_per_mm());
+            motor->correct_position(d);
+            corrected_steps += d;
+            last_steps += d;
+            if(!over) THEKERNEL->streams->printf("// encoder following error of %1.4fmm, corrected\n", e);
+            break;
+        }
+
+        case REPORT:
+            if(!over) THEKERNEL->streams->printf("// encoder following error of %1.4fmm\n", e);
+            break;
+    }
+    over= true;
+}
+
+void Encoder::report(StreamOutput *stream) const
+{
+    __disable_irq();
+    int32_t steps= motor->get_current_step();
+    uint32_t counts= LPC_QEI->QEIPOS;
+    __enable_irq();
+    stream->printf("encoder: counts %ld, error %1.4fmm, worst %1.4fmm, corrected %ld steps\n",
+        (int32_t)(counts - zero_counts), error_mm(steps, counts), worst_mm, corrected_steps);
+}
+
+void Encoder::on_gcode_received(void *argument)
+{
+    Gcode *gcode = static_cast<Gcode *>(argument);
+    if(!gcode->has_m || gcode->m != 860) return;
+
+    // M860 reports, M860 R also clears the worst error and the corrections
+    report(gcode->stream);
+    if(gcode->has_letter('R')) {
+        worst_mm= 0;
+        corrected_steps= 0;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Module.h"
+
+#include <stdint.h>
+
+class StepperMotor;
+class StreamOutput;
+
+class Encoder: public Module
+{
+public:
+    Encoder();
+    void on_module_loaded();
+    void on_idle(void* argument);
+    void on_gcode_received(void* argument);
+
+private:
+    void setup_qei(bool invert);
+    void zero(int32_t steps, uint32_t counts);
+    float error_mm(int32_t steps, uint32_t counts) const;
+    void report(StreamOutput *stream) const;
+
+    StepperMotor *motor{nullptr};
+    float counts_per_mm{0};
+    float max_error_mm{0};
+
+    // the step position and encoder count that were the same place
+    int32_t zero_steps{0};
+    uint32_t zero_counts{0};
+    // the last check, a change of position with no block started since is the position being set
+    int32_t last_steps{0};
+    uint32_t last_blocks{0};
+
+    float worst_mm{0};
+    int32_t corrected_steps{0};
+
+    enum ACTION { REPORT, HALT, CORRECT };
+    struct {
+        ACTION action:2;
+        bool was_moving:1;
+        bool over:1; // reported, until the error drops back under half max_error_mm
+    };
+};
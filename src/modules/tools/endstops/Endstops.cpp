@@ -24,11 +24,13 @@
 #include "ConfigValue.h"
 #include "libs/StreamOutput.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "EndstopsPublicAccess.h"
 #include "StreamOutputPool.h"
 #include "StepTicker.h"
 #include "BaseSolution.h"
 #include "SerialMessage.h"
+#include "InterruptIn.h" // mbed
 
 #include <ctype.h>
 #include <algorithm>
@@ -60,9 +62,11 @@ enum DEFNS {MIN_PIN, MAX_PIN, MAX_TRAVEL, FAST_RATE, SLOW_RATE, RETRACT, DIRECTI
 
 #define endstop_debounce_count_checksum  CHECKSUM("endstop_debounce_count")
 #define endstop_debounce_ms_checksum     CHECKSUM("endstop_debounce_ms")
+#define endstop_interrupt_checksum       CHECKSUM("endstop_interrupt_enable")
 
 #define home_z_first_checksum            CHECKSUM("home_z_first")
 #define homing_order_checksum            CHECKSUM("homing_order")
+#define homing_parallel_checksum         CHECKSUM("homing_parallel")
 #define move_to_origin_checksum          CHECKSUM("move_to_origin_after_home")
 
 #define alpha_trim_checksum              CHECKSUM("alpha_trim_mm")
@@ -86,6 +90,7 @@ enum DEFNS {MIN_PIN, MAX_PIN, MAX_TRAVEL, FAST_RATE, SLOW_RATE, RETRACT, DIRECTI
 #define max_travel_checksum                CHECKSUM("max_travel")
 #define retract_checksum                   CHECKSUM("retract")
 #define limit_checksum                     CHECKSUM("limit_enable")
+#define sensorless_checksum                CHECKSUM("sensorless")
 
 #define STEPPER THEROBOT->actuators
 #define STEPS_PER_MM(a) (STEPPER[a]->get_steps_per_mm())
@@ -126,13 +131,84 @@ void Endstops::on_module_loaded()
     }
 
     register_for_event(ON_GCODE_RECEIVED);
-    register_for_event(ON_GET_PUBLIC_DATA);
-    register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_get(endstops_checksum, this);
+    PublicData::register_set(endstops_checksum, this);
 
+    setup_interrupts();
 
+    // this still checks any endstops that have no interrupt, and catches ones that were already on when the move started
     THEKERNEL->slow_ticker->attach(1000, this, &Endstops::read_endstops);
 }
 
+// optionally have the endstops on ports 0 and 2 stop the motor from the pin interrupt as soon as they trigger, rather than
+// waiting for the next 1ms poll, so the position they stop at does not depend on how fast they were going
+void Endstops::setup_interrupts()
+{
+    bool enable= THEKERNEL->config->value(endstop_interrupt_checksum)->by_default(false)->as_bool();
+
+    for(auto& e : endstops) {
+        e->irq= nullptr;
+        e->latched= false;
+        e->trigger_step= 0;
+        if(!enable || e->sensorless) continue;
+
+        Pin p= e->pin; // interrupt_pin() marks a pin it can't use as invalid, and it still needs to be polled
+        e->irq= p.interrupt_pin();
+        if(e->irq == nullptr) {
+            THEKERNEL->streams->printf("WARNING: endstop %c on P%d.%d can't use an interrupt, only pins on ports 0 and 2 can\n", e->axis, e->pin.port_number, e->pin.pin);
+            continue;
+        }
+
+        // interrupt on the edge where it becomes active
+        if(e->pin.is_inverting()) {
+            e->irq->fall(this, &Endstops::endstop_edge);
+        } else {
+            e->irq->rise(this, &Endstops::endstop_edge);
+        }
+    }
+}
+
+// called from the pin interrupt when any of the endstops with an interrupt become active, the pin is read again
+// debounce_count times so a glitch does not stop anything
+void Endstops::endstop_edge()
+{
+    if(this->status == MOVING_TO_ENDSTOP_SLOW || this->status == MOVING_TO_ENDSTOP_FAST) {
+        for(auto& e : homing_axis) {
+            if(e.pin_info == nullptr || e.pin_info->irq == nullptr) continue;
+            int m= e.axis_index;
+            if(is_corexy && (m == X_AXIS || m == Y_AXIS) && !axis_to_home[m]) continue;
+            if(!STEPPER[m]->is_moving() || !debounced_get(&e.pin_info->pin)) continue;
+
+            e.pin_info->trigger_step= STEPPER[m]->get_current_step();
+            e.pin_info->latched= true;
+            e.pin_info->triggered= true;
+            stop_homing_axis(m);
+        }
+
+    } else if(this->status == NOT_HOMING) {
+        // hard limit, stop the motor right now and leave the halt and the message to on_idle
+        for(auto& i : endstops) {
+            if(i->limit_enable && i->irq != nullptr && STEPPER[i->axis_index]->is_moving() && debounced_get(&i->pin)) {
+                STEPPER[i->axis_index]->stop_moving();
+                i->triggered= true;
+            }
+        }
+    }
+}
+
+// we signal the motor to stop, which will preempt any moves on that axis
+void Endstops::stop_homing_axis(int m)
+{
+    if(is_corexy && (m == X_AXIS || m == Y_AXIS)) {
+        // corexy when moving in X or Y we need to stop both the X and Y motors
+        STEPPER[X_AXIS]->stop_moving();
+        STEPPER[Y_AXIS]->stop_moving();
+
+    }else{
+        STEPPER[m]->stop_moving();
+    }
+}
+
 // Get config using old deprecated syntax Does not support ABC
 bool Endstops::load_old_config()
 {
@@ -188,6 +264,8 @@ bool Endstops::load_old_config()
 
             // init struct
             info->debounce= 0;
+            info->stall= nullptr;
+            info->sensorless= false;
             info->axis= 'X'+i;
             info->axis_index= i;
 
@@ -205,7 +283,7 @@ bool Endstops::load_old_config()
     get_global_configs();
 
     if(limit_enabled) {
-        register_for_event(ON_IDLE);
+        register_for_event(ON_IDLE, PRIORITY_HIGH);
     }
 
     // sanity check for deltas
@@ -247,7 +325,9 @@ bool Endstops::load_config()
 
         endstop_info_t *pin_info= new endstop_info_t;
         pin_info->pin.from_string(THEKERNEL->config->value(endstop_checksum, cs, pin_checksum)->by_default("nc" )->as_string())->as_input();
-        if(!pin_info->pin.connected()){
+        pin_info->sensorless= THEKERNEL->config->value(endstop_checksum, cs, sensorless_checksum)->by_default(false)->as_bool();
+        pin_info->stall= nullptr;
+        if(!pin_info->pin.connected() && !pin_info->sensorless){
             // no pin defined try next
             delete pin_info;
             continue;
@@ -278,8 +358,8 @@ bool Endstops::load_config()
         pin_info->axis= toupper(axis[0]);
         pin_info->axis_index= i;
 
-        // are limits enabled
-        pin_info->limit_enable= THEKERNEL->config->value(endstop_checksum, cs, limit_checksum)->by_default(false)->as_bool();
+        // are limits enabled, a stall is not a limit switch
+        pin_info->limit_enable= !pin_info->sensorless && THEKERNEL->config->value(endstop_checksum, cs, limit_checksum)->by_default(false)->as_bool();
         limit_enabled |= pin_info->limit_enable;
 
         // enter into endstop array
@@ -351,7 +431,7 @@ bool Endstops::load_config()
     get_global_configs();
 
     if(limit_enabled) {
-        register_for_event(ON_IDLE);
+        register_for_event(ON_IDLE, PRIORITY_HIGH);
     }
 
     return true;
@@ -369,6 +449,8 @@ void Endstops::get_global_configs()
     this->is_scara=  THEKERNEL->config->value(scara_homing_checksum)->by_default(false)->as_bool();
 
     this->home_z_first= THEKERNEL->config->value(home_z_first_checksum)->by_default(false)->as_bool();
+    // cartesians can run the fast approach of every axis in one move, each stops at its own endstop
+    this->homing_parallel= THEKERNEL->config->value(homing_parallel_checksum)->by_default(false)->as_bool() && !(is_corexy || is_delta || is_rdelta || is_scara);
 
     this->trim_mm[0] = THEKERNEL->config->value(alpha_trim_checksum)->by_default(0)->as_number();
     this->trim_mm[1] = THEKERNEL->config->value(beta_trim_checksum)->by_default(0)->as_number();
@@ -436,9 +518,10 @@ void Endstops::on_idle(void *argument)
     }
 
     for(auto& i : endstops) {
-        if(i->limit_enable && STEPPER[i->axis_index]->is_moving()) {
+        // the interrupt has already stopped the motor if it saw it, so it is not moving any more
+        if(i->limit_enable && (i->triggered || STEPPER[i->axis_index]->is_moving())) {
             // check min and max endstops
-            if(debounced_get(&i->pin)) {
+            if(i->triggered || debounced_get(&i->pin)) {
                 // endstop triggered
                 if(!THEKERNEL->is_grbl_mode()) {
                     THEKERNEL->streams->printf("Limit switch %c%c was hit - reset or M999 required\n", STEPPER[i->axis_index]->which_direction() ? '-' : '+', i->axis);
@@ -447,6 +530,7 @@ void Endstops::on_idle(void *argument)
                 }
                 this->status = LIMIT_TRIGGERED;
                 i->debounce= 0;
+                i->triggered= false;
                 // disables heaters and motors, ignores incoming Gcode and flushes block queue
                 THEKERNEL->call_event(ON_HALT, nullptr);
                 return;
@@ -544,20 +628,13 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
 
         if(STEPPER[m]->is_moving()) {
             // if it is moving then we check the associated endstop, and debounce it
-            if(e.pin_info->pin.get()) {
+            bool hit= e.pin_info->sensorless ? (e.pin_info->stall != nullptr && e.pin_info->stall->stalled) : e.pin_info->pin.get();
+            if(hit) {
                 if(e.pin_info->debounce < debounce_ms) {
                     e.pin_info->debounce++;
 
                 } else {
-                    if(is_corexy && (m == X_AXIS || m == Y_AXIS)) {
-                        // corexy when moving in X or Y we need to stop both the X and Y motors
-                        STEPPER[X_AXIS]->stop_moving();
-                        STEPPER[Y_AXIS]->stop_moving();
-
-                    }else{
-                        // we signal the motor to stop, which will preempt any moves on that axis
-                        STEPPER[m]->stop_moving();
-                    }
+                    stop_homing_axis(m);
                     e.pin_info->triggered= true;
                 }
 
@@ -571,6 +648,24 @@ uint32_t Endstops::read_endstops(uint32_t dummy)
     return 0;
 }
 
+// tell the drivers of the sensorless endstops whether we are homing, this also clears any stall they saw before
+void Endstops::set_sensorless(bool homing)
+{
+    for(auto& e : endstops) {
+        if(!e->sensorless) continue;
+        if(e->stall == nullptr) {
+            pad_stall p{e->axis, nullptr};
+            if(PublicData::get_value(motor_driver_control_checksum, stall_state_checksum, &p)) e->stall= p.state;
+            if(e->stall == nullptr) {
+                if(homing) THEKERNEL->streams->printf("WARNING: endstop %c is sensorless but its driver does not have sensorless_homing set\n", e->axis);
+                continue;
+            }
+        }
+        e->stall->homing= homing;
+        e->stall->stalled= false;
+    }
+}
+
 void Endstops::home_xy()
 {
     if(axis_to_home[X_AXIS] && axis_to_home[Y_AXIS]) {
@@ -598,12 +693,43 @@ void Endstops::home_xy()
     THECONVEYOR->wait_for_idle();
 }
 
+// the feed rate for delta that has each axis going no faster than its own fast or slow rate, with them all taking as
+// long as the slowest one does, rather than the whole move going at the slowest of the rates
+float Endstops::parallel_rate(const float *delta, bool fast) const
+{
+    float t= 0, primary= 0, other= 0;
+    for (auto& i : homing_axis) {
+        float d= fabsf(delta[i.axis_index]);
+        if(d == 0) continue;
+        t= std::max(t, d / (fast ? i.fast_rate : i.slow_rate));
+        if(i.axis_index < N_PRIMARY_AXIS) primary += d * d;
+        else other += d * d;
+    }
+    if(t <= 0) return 0;
+    // the rate of a move is along the primary axes, or the others if it has none of those
+    return sqrtf(primary > 0 ? primary : other) / t;
+}
+
+// every axis approaches its endstop in the one move, they stop one at a time as each is hit
+void Endstops::home_parallel()
+{
+    float delta[homing_axis.size()];
+    for (auto& i : homing_axis) {
+        int c= i.axis_index;
+        delta[c]= axis_to_home[c] ? i.max_travel : 0;
+        if(i.home_direction) delta[c]= -delta[c];
+    }
+    THEROBOT->delta_move(delta, parallel_rate(delta, true), homing_axis.size());
+    THECONVEYOR->wait_for_idle();
+}
+
 void Endstops::home(axis_bitmap_t a)
 {
     // reset debounce counts for all endstops
     for(auto& e : endstops) {
        e->debounce= 0;
        e->triggered= false;
+       e->latched= false;
     }
 
     if (is_scara) {
@@ -611,37 +737,43 @@ void Endstops::home(axis_bitmap_t a)
     }
 
     this->axis_to_home= a;
+    set_sensorless(true);
 
     // Start moving the axes to the origin
     this->status = MOVING_TO_ENDSTOP_FAST;
 
     THEROBOT->disable_segmentation= true; // we must disable segmentation as this won't work with it enabled
 
-    if(!home_z_first) home_xy();
-
-    if(axis_to_home[Z_AXIS]) {
-        // now home z
-        float delta[3] {0, 0, homing_axis[Z_AXIS].max_travel}; // we go the max z
-        if(homing_axis[Z_AXIS].home_direction) delta[Z_AXIS]= -delta[Z_AXIS];
-        THEROBOT->delta_move(delta, homing_axis[Z_AXIS].fast_rate, 3);
-        // wait for Z
-        THECONVEYOR->wait_for_idle();
-    }
+    if(homing_parallel) {
+        home_parallel();
 
-    if(home_z_first) home_xy();
+    } else {
+        if(!home_z_first) home_xy();
+
+        if(axis_to_home[Z_AXIS]) {
+            // now home z
+            float delta[3] {0, 0, homing_axis[Z_AXIS].max_travel}; // we go the max z
+            if(homing_axis[Z_AXIS].home_direction) delta[Z_AXIS]= -delta[Z_AXIS];
+            THEROBOT->delta_move(delta, homing_axis[Z_AXIS].fast_rate, 3);
+            // wait for Z
+            THECONVEYOR->wait_for_idle();
+        }
 
-    // potentially home A B and C individually
-    if(homing_axis.size() > 3){
-        for (size_t i = A_AXIS; i < homing_axis.size(); ++i) {
-            if(axis_to_home[i]) {
-                // now home A B or C
-                float delta[i+1];
-                for (size_t j = 0; j <= i; ++j) delta[j]= 0;
-                delta[i]= homing_axis[i].max_travel; // we go the max
-                if(homing_axis[i].home_direction) delta[i]= -delta[i];
-                THEROBOT->delta_move(delta, homing_axis[i].fast_rate, i+1);
-                // wait for it
-                THECONVEYOR->wait_for_idle();
+        if(home_z_first) home_xy();
+
+        // potentially home A B and C individually
+        if(homing_axis.size() > 3){
+            for (size_t i = A_AXIS; i < homing_axis.size(); ++i) {
+                if(axis_to_home[i]) {
+                    // now home A B or C
+                    float delta[i+1];
+                    for (size_t j = 0; j <= i; ++j) delta[j]= 0;
+                    delta[i]= homing_axis[i].max_travel; // we go the max
+                    if(homing_axis[i].home_direction) delta[i]= -delta[i];
+                    THEROBOT->delta_move(delta, homing_axis[i].fast_rate, i+1);
+                    // wait for it
+                    THECONVEYOR->wait_for_idle();
+                }
             }
         }
     }
@@ -652,6 +784,7 @@ void Endstops::home(axis_bitmap_t a)
     if(axis_to_home[X_AXIS] || axis_to_home[Y_AXIS] || axis_to_home[Z_AXIS]) {
         for (size_t i = X_AXIS; i <= Z_AXIS; ++i) {
             if((axis_to_home[i] || this->is_delta || this->is_rdelta) && !homing_axis[i].pin_info->triggered) {
+                set_sensorless(false);
                 this->status = NOT_HOMING;
                 THEKERNEL->call_event(ON_HALT, nullptr);
                 return;
@@ -663,6 +796,7 @@ void Endstops::home(axis_bitmap_t a)
     if(homing_axis.size() > 3){
         for (size_t i = A_AXIS; i < homing_axis.size(); ++i) {
             if(axis_to_home[i] && !homing_axis[i].pin_info->triggered) {
+                set_sensorless(false);
                 this->status = NOT_HOMING;
                 THEKERNEL->call_event(ON_HALT, nullptr);
                 return;
@@ -693,11 +827,14 @@ void Endstops::home(axis_bitmap_t a)
         }
     }
 
+    if(homing_parallel) feed_rate= parallel_rate(delta, false);
     THEROBOT->delta_move(delta, feed_rate, homing_axis.size());
     // wait until finished
     THECONVEYOR->wait_for_idle();
 
-    // Start moving the axes towards the endstops slowly
+    // Start moving the axes towards the endstops slowly, only a trigger seen on this approach counts
+    for(auto& e : endstops) e->latched= false;
+    set_sensorless(true);
     this->status = MOVING_TO_ENDSTOP_SLOW;
     for (auto& i : homing_axis) {
         int c= i.axis_index;
@@ -708,6 +845,7 @@ void Endstops::home(axis_bitmap_t a)
             delta[c]= 0;
         }
     }
+    if(homing_parallel) feed_rate= parallel_rate(delta, false);
     THEROBOT->delta_move(delta, feed_rate, homing_axis.size());
     // wait until finished
     THECONVEYOR->wait_for_idle();
@@ -715,6 +853,7 @@ void Endstops::home(axis_bitmap_t a)
     // we did not complete movement the full distance if we hit the endstops
     // TODO Maybe only reset axis involved in the homing cycle
     THEROBOT->reset_position_from_current_actuator_position();
+    set_sensorless(false);
 
     THEROBOT->disable_segmentation= false;
     if (is_scara) {
@@ -892,7 +1031,12 @@ void Endstops::process_home_command(Gcode* gcode)
         // so XY are at a known consistent position.  (especially true if using a proximity probe)
         for (auto &p : homing_axis) {
             if (haxis[p.axis_index]) { // if we requested this axis to home
-                THEROBOT->reset_axis_position(p.homing_position + p.home_offset, p.axis_index);
+                float overshoot= 0;
+                if(!is_corexy && p.pin_info != nullptr && p.pin_info->latched) {
+                    // the interrupt saw exactly where it triggered, anything the motor did after that is past the home position
+                    overshoot= (int32_t)(STEPPER[p.axis_index]->get_current_step() - p.pin_info->trigger_step) / STEPS_PER_MM(p.axis_index);
+                }
+                THEROBOT->reset_axis_position(p.homing_position + p.home_offset + overshoot, p.axis_index);
                 // set flag indicating axis was homed, it stays set once set until H/W reset or unhomed
                 p.homed= true;
             }
@@ -9,6 +9,7 @@
 
 #include "libs/Module.h"
 #include "Pin.h"
+#include "MotorDriverControlPublicAccess.h"
 
 #include <bitset>
 #include <array>
@@ -17,6 +18,9 @@
 class StepperMotor;
 class Gcode;
 class Pin;
+namespace mbed {
+    class InterruptIn;
+}
 
 class Endstops : public Module{
     public:
@@ -31,6 +35,8 @@ class Endstops : public Module{
         using axis_bitmap_t = std::bitset<6>;
         void home(axis_bitmap_t a);
         void home_xy();
+        void home_parallel();
+        float parallel_rate(const float *delta, bool fast) const;
         void back_off_home(axis_bitmap_t axis);
         void move_to_origin(axis_bitmap_t axis);
         void on_get_public_data(void* argument);
@@ -40,6 +46,10 @@ class Endstops : public Module{
         void process_home_command(Gcode* gcode);
         void set_homing_offset(Gcode* gcode);
         uint32_t read_endstops(uint32_t dummy);
+        void setup_interrupts();
+        void endstop_edge();
+        void stop_homing_axis(int m);
+        void set_sensorless(bool homing);
         void handle_park(Gcode * gcode);
 
         // global settings
@@ -53,12 +63,17 @@ class Endstops : public Module{
         // per endstop settings
         using endstop_info_t = struct {
             Pin pin;
+            mbed::InterruptIn *irq; // set if the pin has an edge interrupt, only pins on ports 0 and 2 can
+            int32_t trigger_step;   // actuator position the interrupt saw it trigger at
+            struct stall_state *stall; // the driver's StallGuard state for a sensorless endstop, found when first homing
             struct {
                 uint16_t debounce:16;
                 char axis:8; // one of XYZABC
                 uint8_t axis_index:3;
                 bool limit_enable:1;
                 bool triggered:1;
+                bool latched:1; // trigger_step was set by the interrupt during the current approach
+                bool sensorless:1; // the driver reporting a stall is the endstop, it has no pin
             };
         };
 
@@ -95,5 +110,6 @@ class Endstops : public Module{
             bool is_scara:1;
             bool home_z_first:1;
             bool move_to_origin_after_home:1;
+            bool homing_parallel:1;
         };
 };
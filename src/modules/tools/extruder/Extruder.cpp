@@ -22,10 +22,13 @@
 #include "Gcode.h"
 #include "libs/StreamOutput.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "StreamOutputPool.h"
 #include "ExtruderPublicAccess.h"
+#include "StepTicker.h"
 
 #include <mri.h>
+#include <algorithm>
 
 #define default_feed_rate_checksum           CHECKSUM("default_feed_rate")
 #define steps_per_mm_checksum                CHECKSUM("steps_per_mm")
@@ -45,6 +48,10 @@
 #define retract_recover_feedrate_checksum    CHECKSUM("retract_recover_feedrate")
 #define retract_zlift_length_checksum        CHECKSUM("retract_zlift_length")
 #define retract_zlift_feedrate_checksum      CHECKSUM("retract_zlift_feedrate")
+#define retract_zlift_ramp_length_checksum   CHECKSUM("retract_zlift_ramp_length")
+#define pressure_advance_checksum            CHECKSUM("pressure_advance")
+#define select_gcode_checksum                CHECKSUM("select_gcode")
+#define deselect_gcode_checksum              CHECKSUM("deselect_gcode")
 
 #define PI 3.14159265358979F
 
@@ -80,8 +87,8 @@ void Extruder::on_module_loaded()
 
     // We work on the same Block as Stepper, so we need to know when it gets a new one and drops one
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_get(extruder_checksum, this);
+    PublicData::register_set(extruder_checksum, this);
 }
 
 // Get config
@@ -100,6 +107,11 @@ void Extruder::config_load()
     this->offset[Y_AXIS] = THEKERNEL->config->value(extruder_checksum, this->identifier, y_offset_checksum          )->by_default(0)->as_number();
     this->offset[Z_AXIS] = THEKERNEL->config->value(extruder_checksum, this->identifier, z_offset_checksum          )->by_default(0)->as_number();
 
+    this->select_gcode   = THEKERNEL->config->value(extruder_checksum, this->identifier, select_gcode_checksum      )->by_default("")->as_string();
+    this->deselect_gcode = THEKERNEL->config->value(extruder_checksum, this->identifier, deselect_gcode_checksum    )->by_default("")->as_string();
+    std::replace(select_gcode.begin(), select_gcode.end(), '_', ' '); // replace _ with space
+    std::replace(deselect_gcode.begin(), deselect_gcode.end(), '_', ' ');
+
     this->filament_diameter        = THEKERNEL->config->value(extruder_checksum, this->identifier, filament_diameter_checksum )->by_default(0)->as_number();
     this->retract_length           = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_length_checksum)->by_default(3)->as_number();
     this->retract_feedrate         = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_feedrate_checksum)->by_default(45)->as_number();
@@ -107,6 +119,7 @@ void Extruder::config_load()
     this->retract_recover_feedrate = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_recover_feedrate_checksum)->by_default(8)->as_number();
     this->retract_zlift_length     = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_length_checksum)->by_default(0)->as_number();
     this->retract_zlift_feedrate   = THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_feedrate_checksum)->by_default(100 * 60)->as_number() / 60.0F; // mm/min
+    this->retract_zlift_ramp_length= THEKERNEL->config->value(extruder_checksum, this->identifier, retract_zlift_ramp_length_checksum)->by_default(0)->as_number();
 
     if(filament_diameter > 0.01F) {
         this->volumetric_multiplier = 1.0F / (powf(this->filament_diameter / 2, 2) * PI);
@@ -121,6 +134,8 @@ void Extruder::config_load()
     stepper_motor->change_steps_per_mm(steps_per_millimeter);
     stepper_motor->set_selected(false); // not selected by default
     stepper_motor->set_extruder(true);  // indicates it is an extruder
+
+    THEKERNEL->step_ticker->set_pressure_advance(motor_id, THEKERNEL->config->value(extruder_checksum, this->identifier, pressure_advance_checksum)->by_default(0)->as_number());
 }
 
 void Extruder::select()
@@ -129,6 +144,8 @@ void Extruder::select()
     stepper_motor->set_selected(true);
     // set the function pointer to return the current scaling
     THEROBOT->get_e_scale_fnc = std::bind(&Extruder::get_e_scale, this);
+    // and the one that keeps moves within its volumetric rate
+    THEROBOT->check_e_max_speeds_fnc = std::bind(&Extruder::check_max_speeds, this, std::placeholders::_1, std::placeholders::_2);
 }
 
 void Extruder::deselect()
@@ -136,6 +153,7 @@ void Extruder::deselect()
     selected = false;
     stepper_motor->set_selected(false);
     THEROBOT->get_e_scale_fnc = nullptr;
+    THEROBOT->check_e_max_speeds_fnc = nullptr;
 }
 
 void Extruder::on_get_public_data(void *argument)
@@ -154,6 +172,7 @@ void Extruder::on_get_public_data(void *argument)
     e->accleration = stepper_motor->get_acceleration();
     e->retract_length = this->retract_length;
     e->current_position = stepper_motor->get_current_position();
+    e->current_step = stepper_motor->get_current_step();
     pdr->set_taken();
 }
 
@@ -163,21 +182,6 @@ void Extruder::on_set_public_data(void *argument)
 
     if(!pdr->starts_with(extruder_checksum)) return;
 
-    // handle extrude rates request from robot
-    if(pdr->second_element_is(target_checksum)) {
-        // disabled extruders do not reply NOTE only one enabled extruder supported
-        if(!this->selected) return;
-
-        float *d = static_cast<float *>(pdr->get_data_ptr());
-        float delta = d[0]; // the E passed in on Gcode is the delta volume in mm³
-        float isecs = d[1]; // inverted secs
-
-        // check against maximum speeds and return rate modifier
-        d[1] = check_max_speeds(delta, isecs);
-        pdr->set_taken();
-        return;
-    }
-
     // save or restore extruder state
     if(pdr->second_element_is(save_state_checksum)) {
         save_position();
@@ -301,17 +305,26 @@ void Extruder::on_gcode_received(void *argument)
             stepper_motor->set_acceleration(gcode->get_value('E'));
 
         } else if (gcode->m == 207 && ( (this->selected && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
-            // M207 - set retract length S[positive mm] F[feedrate mm/min] Z[additional zlift/hop] Q[zlift feedrate mm/min]
+            // M207 - set retract length S[positive mm] F[feedrate mm/min] Z[additional zlift/hop] Q[zlift feedrate mm/min] R[zlift ramp length mm]
             if(gcode->has_letter('S')) retract_length = gcode->get_value('S');
             if(gcode->has_letter('F')) retract_feedrate = gcode->get_value('F') / 60.0F; // specified in mm/min converted to mm/sec
             if(gcode->has_letter('Z')) retract_zlift_length = gcode->get_value('Z'); // specified in mm
             if(gcode->has_letter('Q')) retract_zlift_feedrate = gcode->get_value('Q') / 60.0F; // specified in mm/min converted to mm/sec
+            if(gcode->has_letter('R')) retract_zlift_ramp_length = gcode->get_value('R'); // specified in mm
 
         } else if (gcode->m == 208 && ( (this->selected && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
             // M208 - set retract recover length S[positive mm surplus to the M207 S*] F[feedrate mm/min]
             if(gcode->has_letter('S')) retract_recover_length = gcode->get_value('S');
             if(gcode->has_letter('F')) retract_recover_feedrate = gcode->get_value('F') / 60.0F; // specified in mm/min converted to mm/sec
 
+        } else if (gcode->m == 900 && ( (this->selected && !gcode->has_letter('P')) || (gcode->has_letter('P') && gcode->get_value('P') == this->identifier)) ) {
+            // M900 K[seconds] - set pressure advance, 0 turns it off, takes effect on moves planned after it
+            if(gcode->has_letter('K')) {
+                THEKERNEL->step_ticker->set_pressure_advance(motor_id, gcode->get_value('K'));
+            } else {
+                gcode->stream->printf("Pressure advance: %1.4f\n", THEKERNEL->step_ticker->get_pressure_advance(motor_id));
+            }
+
         } else if (gcode->m == 221 && this->selected) { // M221 S100 change flow rate by percentage
             if(gcode->has_letter('S')) {
                 float last_scale = this->extruder_multiplier;
@@ -330,13 +343,14 @@ void Extruder::on_gcode_received(void *argument)
         } else if (gcode->m == 500 || gcode->m == 503) { // M500 saves some volatile settings to config override file, M503 just prints the settings
             gcode->stream->printf(";E Steps per mm:\nM92 E%1.4f P%d\n", stepper_motor->get_steps_per_mm(), this->identifier);
             gcode->stream->printf(";E Filament diameter:\nM200 D%1.4f P%d\n", this->filament_diameter, this->identifier);
-            gcode->stream->printf(";E retract length, feedrate:\nM207 S%1.4f F%1.4f Z%1.4f Q%1.4f P%d\n", this->retract_length, this->retract_feedrate * 60.0F, this->retract_zlift_length, this->retract_zlift_feedrate * 60.0F, this->identifier);
+            gcode->stream->printf(";E retract length, feedrate:\nM207 S%1.4f F%1.4f Z%1.4f Q%1.4f R%1.4f P%d\n", this->retract_length, this->retract_feedrate * 60.0F, this->retract_zlift_length, this->retract_zlift_feedrate * 60.0F, this->retract_zlift_ramp_length, this->identifier);
             gcode->stream->printf(";E retract recover length, feedrate:\nM208 S%1.4f F%1.4f P%d\n", this->retract_recover_length, this->retract_recover_feedrate * 60.0F, this->identifier);
             gcode->stream->printf(";E acceleration mm/sec²:\nM204 E%1.4f P%d\n", stepper_motor->get_acceleration(), this->identifier);
             gcode->stream->printf(";E max feed rate mm/sec:\nM203 E%1.4f P%d\n", stepper_motor->get_max_rate(), this->identifier);
             if(this->max_volumetric_rate > 0) {
                 gcode->stream->printf(";E max volumetric rate mm³/sec:\nM203 V%1.4f P%d\n", this->max_volumetric_rate, this->identifier);
             }
+            gcode->stream->printf(";E pressure advance seconds:\nM900 K%1.4f P%d\n", THEKERNEL->step_ticker->get_pressure_advance(motor_id), this->identifier);
         }
 
     } else if( gcode->has_g && this->selected ) {
@@ -364,16 +378,21 @@ void Extruder::on_gcode_received(void *argument)
                 THEROBOT->delta_move(delta, retract_feedrate, motor_id + 1);
 
                 // zlift
-                if(retract_zlift_length > 0) {
+                if(retract_zlift_length > 0 && retract_zlift_ramp_length > 0) {
+                    // raised over the start of the next travel move instead, which is planned together with it
+                    THEROBOT->lift_z_on_next_move(retract_zlift_length, retract_zlift_ramp_length);
+
+                } else if(retract_zlift_length > 0) {
                     float delta[3] {0, 0, retract_zlift_length};
                     THEROBOT->delta_move(delta, retract_zlift_feedrate, 3);
                 }
 
             } else if(gcode->g == 11) {
                 // unretract
-                if(retract_zlift_length > 0 && !this->cancel_zlift_restore) {
+                if(retract_zlift_length > 0 && !this->cancel_zlift_restore && !THEROBOT->cancel_z_lift()) {
                     // reverse zlift happens before unretract
                     // NOTE we do not do this if cancel_zlift_restore is set to true, which happens if there is an absolute Z move inbetween G10 and G11
+                    // nor if a ramped zlift never got a travel move to be done on
                     float delta[3] {0, 0, -retract_zlift_length};
                     THEROBOT->delta_move(delta, retract_zlift_feedrate, 3);
                 }
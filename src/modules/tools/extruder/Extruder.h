@@ -51,6 +51,7 @@ class Extruder : public Tool {
         float retract_recover_length;
         float retract_zlift_length;
         float retract_zlift_feedrate;
+        float retract_zlift_ramp_length;    // XY travel the zlift is ramped over, 0 lifts straight up
 
         // for saving and restoring extruder position
         std::tuple<float, float, int32_t> saved_position;
@@ -3,7 +3,6 @@
 #define extruder_checksum                    CHECKSUM("extruder")
 #define save_state_checksum                  CHECKSUM("save_state")
 #define restore_state_checksum               CHECKSUM("restore_state")
-#define target_checksum                      CHECKSUM("target")
 
 using pad_extruder_t = struct pad_extruder {
     float steps_per_mm;
@@ -12,4 +11,5 @@ using pad_extruder_t = struct pad_extruder {
     float accleration;
     float retract_length;
     float current_position;
+    int32_t current_step;
 };
@@ -2,6 +2,8 @@
 /*
     Handles a filament detector that has an optical encoder wheel, that generates pulses as the filament
     moves through it.
+    The pulses are counted by a pin interrupt, or by the QEI in hardware when the encoder is on P1.23,
+    which keeps a fine encoder from flooding the interrupts during fast extrusion.
     It also supports a "bulge" detector that triggers if the filament has a bulge in it
 */
 
@@ -31,6 +33,7 @@
 #define bulge_pin_checksum          CHECKSUM("bulge_pin")
 #define seconds_per_check_checksum  CHECKSUM("seconds_per_check")
 #define pulses_per_mm_checksum      CHECKSUM("pulses_per_mm")
+#define jam_window_checksum         CHECKSUM("jam_window")
 
 FilamentDetector::FilamentDetector()
 {
@@ -38,6 +41,8 @@ FilamentDetector::FilamentDetector()
     filament_out_alarm= false;
     bulge_detected= false;
     active= true;
+    hw_counter= false;
+    window_valid= false;
     e_last_moved= NAN;
 }
 
@@ -55,10 +60,14 @@ void FilamentDetector::on_module_loaded()
         return;
     }
 
-    // encoder pin has to be interrupt enabled pin like 0.26, 0.27, 0.28
+    // encoder pin has to be interrupt enabled pin like 0.26, 0.27, 0.28, or 1.23 to count in hardware
     Pin dummy_pin;
     dummy_pin.from_string( THEKERNEL->config->value(filament_detector_checksum, encoder_pin_checksum)->by_default("nc" )->as_string());
-    this->encoder_pin= dummy_pin.interrupt_pin();
+    if(dummy_pin.connected() && dummy_pin.port_number == 1 && dummy_pin.pin == 23) {
+        setup_counter();
+    } else {
+        this->encoder_pin= dummy_pin.interrupt_pin();
+    }
 
     // optional bulge detector
     bulge_pin.from_string( THEKERNEL->config->value(filament_detector_checksum, bulge_pin_checksum)->by_default("nc" )->as_string())->as_input();
@@ -69,7 +78,7 @@ void FilamentDetector::on_module_loaded()
 
     //Valid configurations contain an encoder pin, a bulge pin or both.
     //free the module if not a valid configuration
-    if(this->encoder_pin == nullptr && !bulge_pin.connected()) {
+    if(this->encoder_pin == nullptr && !hw_counter && !bulge_pin.connected()) {
         delete this;
         return;
     }
@@ -78,7 +87,6 @@ void FilamentDetector::on_module_loaded()
     if (this->encoder_pin != nullptr) {
         // set interrupt on rising edge
         this->encoder_pin->rise(this, &FilamentDetector::on_pin_rise);
-        NVIC_SetPriority(EINT3_IRQn, 16); // set to low priority
     }
 
 
@@ -88,8 +96,11 @@ void FilamentDetector::on_module_loaded()
     // the number of pulses per mm of filament moving through the detector, can be fractional
     pulses_per_mm= THEKERNEL->config->value(filament_detector_checksum, pulses_per_mm_checksum)->by_default(1)->as_number();
 
+    // mm of extrusion per check, 0 checks every seconds_per_check instead
+    jam_window= THEKERNEL->config->value(filament_detector_checksum, jam_window_checksum)->by_default(0)->as_number();
+
     // register event-handlers
-    if (this->encoder_pin != nullptr) {
+    if (this->encoder_pin != nullptr || hw_counter) {
         //This event is only valid if we are using the encodeer.
         register_for_event(ON_SECOND_TICK);
     }
@@ -100,6 +111,36 @@ void FilamentDetector::on_module_loaded()
 }
 
 
+// count the encoder on the QEI, it is the clock of the direction/clock mode on PhB
+// no LPC timer is free to use as a counter, they are the step, unstep, slow and us tickers
+void FilamentDetector::setup_counter()
+{
+    LPC_SC->PCONP |= (1 << 18);     // Power QEI ON
+    LPC_PINCON->PINSEL3 = (LPC_PINCON->PINSEL3 & ~(3 << 14)) | (1 << 14); // P1.23 is PhB
+    LPC_QEI->QEICONF = (1 << 1);    // SigMode, PhB is a clock, PhA (nothing) the direction
+    LPC_QEI->FILTER = 100;          // ignore glitches shorter than 100 PCLK
+    LPC_QEI->QEIMAXPOS = 0xFFFFFFFF;
+    LPC_QEI->QEICON = 1;            // reset the position
+    counter_last= 0;
+    hw_counter= true;
+}
+
+// add what the counter counted since the last read to pulses
+void FilamentDetector::read_counter()
+{
+    if(!hw_counter) return;
+    uint32_t pos= LPC_QEI->QEIPOS;
+    // the direction is whatever the unconnected PhA reads as, only the size matters
+    pulses += abs((int32_t)(pos - counter_last));
+    counter_last= pos;
+}
+
+void FilamentDetector::reset_window()
+{
+    window_valid= false;
+    window_pulses= 0;
+}
+
 void FilamentDetector::send_command(std::string msg, StreamOutput *stream)
 {
     struct SerialMessage message;
@@ -113,11 +154,13 @@ void FilamentDetector::on_console_line_received( void *argument )
 {
     if(!suspended) return;
 
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
+    SerialMessage& new_message = *static_cast<SerialMessage *>(argument);
     string possible_command = new_message.message;
     string cmd = shift_parameter(possible_command);
     if(cmd == "resume" || cmd == "M601") {
+        read_counter();
         this->pulses= 0;
+        reset_window();
         e_last_moved= NAN;
         suspended= false;
     }
@@ -142,14 +185,24 @@ void FilamentDetector::on_gcode_received(void *argument)
             if(gcode->has_letter('P')){
                 pulses_per_mm= gcode->get_value('P');
             }
-            gcode->stream->printf("// pulses per mm: %f, seconds per check: %d\n", pulses_per_mm, seconds_per_check);
+            if(gcode->has_letter('W')){
+                jam_window= gcode->get_value('W');
+                reset_window();
+            }
+            if(jam_window > 0) {
+                gcode->stream->printf("// pulses per mm: %f, mm per check: %f\n", pulses_per_mm, jam_window);
+            } else {
+                gcode->stream->printf("// pulses per mm: %f, seconds per check: %d\n", pulses_per_mm, seconds_per_check);
+            }
 
         } else if (gcode->m == 405) { // disable filament detector
             active= false;
             e_last_moved= get_emove();
 
         }else if (gcode->m == 406) { // enable filament detector
+            read_counter();
             this->pulses= 0;
+            reset_window();
             e_last_moved=  get_emove();
             active= true;
 
@@ -160,15 +213,26 @@ void FilamentDetector::on_gcode_received(void *argument)
                 gcode->stream->printf("Extruder moved: %f mm\n", delta);
             }
 
+            read_counter();
             gcode->stream->printf("Encoder pulses: %u\n", pulses.load());
+            if(jam_window > 0) gcode->stream->printf("Encoder pulses this window: %u\n", window_pulses);
             if(this->suspended) gcode->stream->printf("Filament detector triggered\n");
             gcode->stream->printf("Filament detector is %s\n", active?"enabled":"disabled");
         }
+
+    } else if (gcode->has_letter('T')) {
+        // the steps of a different extruder are no use to the window
+        reset_window();
     }
 }
 
 void FilamentDetector::on_main_loop(void *argument)
 {
+    if (jam_window > 0 && (encoder_pin != nullptr || hw_counter) && us_ticker_read() - last_window_check > 100000) {
+        last_window_check= us_ticker_read();
+        check_window();
+    }
+
     if (active && this->filament_out_alarm) {
         this->filament_out_alarm = false;
         if(bulge_detected){
@@ -188,6 +252,8 @@ void FilamentDetector::on_main_loop(void *argument)
 
 void FilamentDetector::on_second_tick(void *argument)
 {
+    if(jam_window > 0) return; // checked by check_window instead
+
     if(++seconds_passed >= seconds_per_check) {
         seconds_passed= 0;
         check_encoder();
@@ -205,6 +271,7 @@ void FilamentDetector::check_encoder()
     if(suspended) return; // already suspended
     if(!active) return;  // not enabled
 
+    read_counter();
     uint32_t pulse_cnt= this->pulses.exchange(0); // atomic load and reset
 
     // get number of E steps taken and make sure we have seen enough pulses to cover that
@@ -232,6 +299,37 @@ void FilamentDetector::check_encoder()
     }
 }
 
+// every jam_window mm the E stepper has stepped forward there must have been at least half the pulses to cover it
+void FilamentDetector::check_window()
+{
+    if(suspended || !active) return;
+
+    pad_extruder_t rd;
+    if(!PublicData::get_value( extruder_checksum, (void *)&rd )) return;
+
+    read_counter();
+    window_pulses += this->pulses.exchange(0);
+
+    int32_t moved= rd.current_step - window_start;
+    if(!window_valid || moved < 0) {
+        // start the window here, retracts are ignored for the purposes of jam detection
+        window_start= rd.current_step;
+        window_pulses= 0;
+        window_valid= true;
+        return;
+    }
+
+    if(moved < jam_window * rd.steps_per_mm) return;
+
+    float needed_pulses= moved / rd.steps_per_mm * pulses_per_mm;
+    if(window_pulses < needed_pulses / 2) {
+        this->filament_out_alarm= true;
+    }
+
+    window_start= rd.current_step;
+    window_pulses= 0;
+}
+
 uint32_t FilamentDetector::button_tick(uint32_t dummy)
 {
     if(!bulge_pin.connected() || suspended || !active) return 0;
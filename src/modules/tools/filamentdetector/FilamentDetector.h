@@ -27,6 +27,10 @@ public:
 private:
     void on_pin_rise();
     void check_encoder();
+    void check_window();
+    void setup_counter();
+    void read_counter();
+    void reset_window();
     void send_command(std::string msg, StreamOutput *stream);
     uint32_t button_tick(uint32_t dummy);
     float get_emove();
@@ -39,10 +43,20 @@ private:
     uint8_t seconds_per_check{1};
     uint8_t seconds_passed{0};
 
+    // when the encoder is on the QEI the hardware counts the pulses, read_counter adds them to pulses
+    uint32_t counter_last{0};
+    // when jam_window is set the check is done every jam_window mm of E steps instead of every seconds_per_check
+    float jam_window{0};
+    int32_t window_start{0};
+    uint32_t window_pulses{0};
+    uint32_t last_window_check{0};
+
     struct {
         bool filament_out_alarm:1;
         bool bulge_detected:1;
         bool suspended:1;
         bool active:1;
+        bool hw_counter:1;
+        bool window_valid:1;
     };
 };
@@ -23,6 +23,8 @@
 #include "Gcode.h"
 #include "PwmOut.h" // mbed.h lib
 #include "PublicDataRequest.h"
+#include "PublicData.h"
+#include "Conveyor.h"
 
 #include <algorithm>
 
@@ -37,6 +39,8 @@
 #define laser_module_tickle_power_checksum      CHECKSUM("laser_module_tickle_power")
 #define laser_module_max_power_checksum         CHECKSUM("laser_module_max_power")
 #define laser_module_maximum_s_value_checksum   CHECKSUM("laser_module_maximum_s_value")
+#define laser_module_step_sync_checksum         CHECKSUM("laser_module_step_sync")
+#define laser_module_raster_buffer_checksum     CHECKSUM("laser_module_raster_buffer")
 
 
 Laser::Laser()
@@ -45,6 +49,25 @@ Laser::Laser()
     scale = 1;
     manual_fire = false;
     fire_duration = 0;
+    step_sync = false;
+    sync_block = nullptr;
+    raster = nullptr;
+    raster_size = 0;
+    raster_write = raster_read = 0;
+}
+
+// PWM1 match register for a channel, MR4-6 are not next to MR1-3
+static volatile uint32_t *pwm1_match(int channel)
+{
+    switch(channel) {
+        case 1: return &LPC_PWM1->MR1;
+        case 2: return &LPC_PWM1->MR2;
+        case 3: return &LPC_PWM1->MR3;
+        case 4: return &LPC_PWM1->MR4;
+        case 5: return &LPC_PWM1->MR5;
+        case 6: return &LPC_PWM1->MR6;
+    }
+    return nullptr;
 }
 
 void Laser::on_module_loaded()
@@ -74,6 +97,8 @@ void Laser::on_module_loaded()
 
 
     this->pwm_inverting = dummy_pin->is_inverting();
+    this->pwm_channel = dummy_pin->pwm1_channel();
+    this->pwm_mr = pwm1_match(this->pwm_channel);
 
     delete dummy_pin;
     dummy_pin = NULL;
@@ -105,17 +130,30 @@ void Laser::on_module_loaded()
     // S value that represents maximum (default 1)
     this->laser_maximum_s_value = THEKERNEL->config->value(laser_module_maximum_s_value_checksum)->by_default(1.0f)->as_number() ;
 
+    this->raster_size = THEKERNEL->config->value(laser_module_raster_buffer_checksum)->by_default(0)->as_number();
+    if(this->raster_size > 0) {
+        this->raster = new uint8_t[this->raster_size];
+    }
+
     set_laser_power(0);
 
     //register for events
     this->register_for_event(ON_HALT);
-    this->register_for_event(ON_GCODE_RECEIVED);
+    this->register_for_gcode('M', 221);
+    this->register_for_gcode('M', 649);
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    PublicData::register_get(laser_checksum, this);
 
     // no point in updating the power more than the PWM frequency, but not faster than 1KHz
     ms_per_tick = 1000 / std::min(1000UL, 1000000 / period);
     THEKERNEL->slow_ticker->attach(std::min(1000UL, 1000000 / period), this, &Laser::set_proportional_power);
+
+    // or update it from the step ticker, once per PWM period as the match register is only latched at the end of one
+    this->step_sync = THEKERNEL->config->value(laser_module_step_sync_checksum)->by_default(false)->as_bool();
+    if(this->step_sync) {
+        uint32_t divider = std::max(1.0F, period * THEKERNEL->step_ticker->get_frequency() / 1000000.0F);
+        THEKERNEL->step_ticker->set_rate_fnc([this](const Block *block, uint32_t ratio) { rate_tick(block, ratio); }, divider);
+    }
 }
 
 void Laser::on_console_line_received( void *argument )
@@ -123,13 +161,14 @@ void Laser::on_console_line_received( void *argument )
     if(THEKERNEL->is_halted()) return; // if in halted state ignore any commands
 
     SerialMessage *msgp = static_cast<SerialMessage *>(argument);
-    string possible_command = msgp->message;
 
     // ignore anything that is not lowercase or a letter
-    if(possible_command.empty() || !islower(possible_command[0]) || !isalpha(possible_command[0])) {
+    if(msgp->message.empty() || !islower(msgp->message[0]) || !isalpha(msgp->message[0])) {
         return;
     }
 
+    string possible_command = msgp->message;
+
     string cmd = shift_parameter(possible_command);
 
     // Act depending on command
@@ -199,6 +238,9 @@ void Laser::on_gcode_received(void *argument)
             } else {
                 gcode->stream->printf("Laser power scale at %6.2f %%\n", this->scale * 100.0F);
             }
+
+        } else if (gcode->m == 649) { // M649 D<hex> raster power values for the next G1 P<n>, two hex digits each, 0 is off and FF is the S value
+            add_raster(gcode);
         }
     }
 }
@@ -206,36 +248,89 @@ void Laser::on_gcode_received(void *argument)
 // calculates the current speed ratio from the currently executing block
 float Laser::current_speed_ratio(const Block *block) const
 {
-    // find the primary moving actuator (the one with the most steps)
-    size_t pm = 0;
-    uint32_t max_steps = 0;
-    for (size_t i = 0; i < THEROBOT->get_number_registered_motors(); i++) {
-        // find the motor with the most steps
-        if(block->steps[i] > max_steps) {
-            max_steps = block->steps[i];
-            pm = i;
-        }
+    // figure out the ratio of the speed of the primary moving actuator (the one with the most steps), from 0 to 1
+    // based on where it is on the trapezoid, this is based on the fraction it is of the requested rate (nominal rate)
+    float ratio = block->get_trapezoid_rate(block->primary_motor) / block->nominal_rate;
+
+    // the speed override and a feed hold slow the step generator's time down, so the head is moving that much slower again
+    return ratio * (StepTicker::getInstance()->get_time_rate() / 4294967296.0F);
+}
+
+static uint8_t hex_digit(char c)
+{
+    if(c >= 'a') return c - 'a' + 10;
+    if(c >= 'A') return c - 'A' + 10;
+    return c - '0';
+}
+
+// queues raster data, waiting for room if the moves before it still need theirs
+void Laser::add_raster(Gcode *gcode)
+{
+    if(raster == nullptr) {
+        gcode->stream->printf("Raster is not enabled, set laser_module_raster_buffer\n");
+        return;
+    }
+
+    const char *p = strchr(gcode->get_command(), 'D');
+    if(p == nullptr) {
+        gcode->stream->printf("Raster: %lu of %lu bytes in use\n", raster_write - raster_read, raster_size);
+        return;
+    }
+    p++;
+    uint32_t n = strspn(p, "0123456789ABCDEFabcdef") / 2;
+
+    // room is only ever freed by the moves already planned running, so this has to fit alongside what is left for those
+    if(raster_write - THEROBOT->get_raster_position() + n > raster_size) {
+        gcode->is_error = true;
+        gcode->txt_after_ok = "raster data does not fit in laser_module_raster_buffer";
+        return;
     }
 
-    // figure out the ratio of its speed, from 0 to 1 based on where it is on the trapezoid,
-    // this is based on the fraction it is of the requested rate (nominal rate)
-    float ratio = block->get_trapezoid_rate(pm) / block->nominal_rate;
+    while(raster_size - (raster_write - raster_read) < n) {
+        // the last move may not have been seen right to its end
+        if(THECONVEYOR->is_idle()) raster_read = THEROBOT->get_raster_position();
+        else THEKERNEL->call_event(ON_IDLE, this);
+        if(THEKERNEL->is_halted()) return;
+    }
 
-    return ratio;
+    uint32_t w = raster_write;
+    for (uint32_t i = 0; i < n; i++, p += 2) {
+        raster[(w + i) % raster_size] = (hex_digit(p[0]) << 4) | hex_digit(p[1]);
+    }
+    __DMB(); // the values must be in the buffer before the step ticker can see them
+    raster_write = w + n;
+}
+
+// the raster value i of the block, anything before it is done with, 0 if it was never sent
+uint8_t Laser::raster_value(const Block *block, uint32_t i)
+{
+    if(i >= block->raster_count) i = block->raster_count - 1;
+    uint32_t pos = block->raster_start + i;
+    if((int32_t)(pos - raster_read) > 0) raster_read = pos;
+    if((int32_t)(pos - raster_write) >= 0) return 0;
+    return raster[pos % raster_size];
 }
 
 // get laser power for the currently executing block, returns false if nothing running or a G0
-bool Laser::get_laser_power(float& power) const
+bool Laser::get_laser_power(float& power)
 {
     const Block *block = StepTicker::getInstance()->get_current_block();
 
     // Note to avoid a race condition where the block is being cleared we check the is_ready flag which gets cleared first,
     // as this is an interrupt if that flag is not clear then it cannot be cleared while this is running and the block will still be valid (albeit it may have finished)
-    if(block != nullptr && block->is_ready && block->is_g123) {
+    // once a feed hold has stopped the head it must not fire, whatever the block says
+    if(block != nullptr && block->is_ready && block->is_g123 && !StepTicker::getInstance()->is_held()) {
         float requested_power = ((float)block->s_value / (1 << 11)) / this->laser_maximum_s_value; // s_value is 1.11 Fixed point
         float ratio = current_speed_ratio(block);
         power = requested_power * ratio * scale;
 
+        if(block->raster_count > 0 && raster != nullptr) {
+            const Block::tickinfo_t &ti = block->tick_info[block->primary_motor];
+            uint8_t v = raster_value(block, (uint64_t)ti.step_count * block->raster_count / block->steps_event_count);
+            if(v == 0) return false;
+            power = power * v / 255;
+        }
+
         return true;
     }
 
@@ -259,6 +354,12 @@ uint32_t Laser::set_proportional_power(uint32_t dummy)
         return 0;
     }
 
+    if(step_sync) {
+        // rate_tick sets the power while a block runs, it just needs turning off once nothing does
+        if(laser_on && (StepTicker::getInstance()->get_current_block() == nullptr || StepTicker::getInstance()->is_held())) set_laser_power(0);
+        return 0;
+    }
+
     float power;
     if(get_laser_power(power)) {
         // adjust power to maximum power and actual velocity
@@ -272,6 +373,49 @@ uint32_t Laser::set_proportional_power(uint32_t dummy)
     return 0;
 }
 
+// called from the step ticker ISR every PWM period while a block runs, ratio is its speed as a fraction of nominal in 0.16
+void Laser::rate_tick(const Block *block, uint32_t ratio)
+{
+    if(manual_fire) return;
+
+    uint32_t period = LPC_PWM1->MR0;
+    if(block != sync_block) {
+        // the float maths is done once per block, the same as get_laser_power but in PWM1 counts
+        sync_block = block;
+        if(block->is_g123) {
+            float requested_power = ((float)block->s_value / (1 << 11)) / this->laser_maximum_s_value * scale;
+            sync_min = confine(this->laser_minimum_power, 0.0F, 1.0F) * period;
+            sync_span = confine((this->laser_maximum_power - this->laser_minimum_power) * requested_power, 0.0F, 1.0F) * period;
+        } else {
+            sync_min = sync_span = 0;
+        }
+
+        if(block->raster_count > 0 && raster != nullptr) {
+            // there is one value per primary step at most, so this is under 1.0 unless they are equal
+            sync_raster = block->raster_count < block->steps_event_count ? ((uint64_t)block->raster_count << 32) / block->steps_event_count : 0;
+            if((int32_t)(block->raster_start - raster_read) > 0) raster_read = block->raster_start;
+        }
+    }
+
+    if(ratio > 65536) ratio = 65536;
+    // a ratio of 0 is a stop, a feed hold that has come to rest, so it is off rather than at the minimum power
+    uint32_t counts = ratio == 0 ? 0 : sync_min + ((sync_span * ratio) >> 16);
+
+    if(block->raster_count > 0 && raster != nullptr && ratio != 0) {
+        uint32_t steps = block->tick_info[block->primary_motor].step_count;
+        uint8_t v = raster_value(block, sync_raster == 0 ? steps : ((uint64_t)steps * sync_raster) >> 32);
+        counts = v == 0 ? 0 : sync_min + ((sync_span * ratio) >> 16) * v / 255;
+    }
+    if(counts > period) counts = period;
+
+    *pwm_mr = this->pwm_inverting ? period - counts : counts;
+    LPC_PWM1->LER |= 1 << pwm_channel;
+
+    bool on = counts > 0;
+    if(on != laser_on && this->ttl_used) this->ttl_pin->set(on);
+    laser_on = on;
+}
+
 bool Laser::set_laser_power(float power)
 {
     // Ensure power is >=0 and <= 1
@@ -296,6 +440,9 @@ void Laser::on_halt(void *argument)
     if(argument == nullptr) {
         set_laser_power(0);
         manual_fire = false;
+        // the queue is gone and with it the moves the raster data was for
+        sync_block = nullptr;
+        raster_read = raster_write = THEROBOT->get_raster_position();
     }
 }
 
@@ -16,6 +16,7 @@ namespace mbed {
 }
 class Pin;
 class Block;
+class Gcode;
 
 class Laser : public Module{
     public:
@@ -34,8 +35,11 @@ class Laser : public Module{
 
     private:
         uint32_t set_proportional_power(uint32_t dummy);
-        bool get_laser_power(float& power) const;
+        bool get_laser_power(float& power);
         float current_speed_ratio(const Block *block) const;
+        void rate_tick(const Block *block, uint32_t ratio);
+        void add_raster(Gcode *gcode);
+        uint8_t raster_value(const Block *block, uint32_t i);
 
         mbed::PwmOut *pwm_pin;    // PWM output to regulate the laser power
         Pin *ttl_pin;				// TTL output to fire laser
@@ -46,11 +50,27 @@ class Laser : public Module{
         int32_t fire_duration; // manual fire command duration
         int32_t ms_per_tick; // ms between each ticks, depends on PWM frequency
 
+        // step_sync, the power is written straight to the PWM1 match register from the step ticker
+        volatile uint32_t *pwm_mr;
+        const Block *sync_block;   // the block sync_min and sync_span are for
+        uint32_t sync_min;         // PWM1 counts at zero speed
+        uint32_t sync_span;        // PWM1 counts added at the nominal rate
+        uint32_t sync_raster;      // raster values per primary step of sync_block in 0.32, 0 when there is one per step
+
+        // raster data from M649, kept until the G1 P<n> blocks it is for have run, the positions count up for ever
+        // and match Robot::get_raster_position()
+        uint8_t *raster;
+        uint32_t raster_size;
+        volatile uint32_t raster_write; // after the last value received
+        volatile uint32_t raster_read;  // values before this have been used
+        uint8_t pwm_channel;
+
         struct {
             bool laser_on:1;      // set if the laser is on
             bool pwm_inverting:1; // stores whether the PWM period should be inverted
             bool ttl_used:1;        // stores whether we have a TTL output
             bool ttl_inverting:1;   // stores whether the TTL output should be inverted
             bool manual_fire:1;     // set when manually firing
+            bool step_sync:1;       // set when the step ticker sets the power
         };
 };
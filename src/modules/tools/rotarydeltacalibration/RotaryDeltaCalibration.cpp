@@ -10,6 +10,13 @@
 #include "PublicData.h"
 #include "Gcode.h"
 #include "StepperMotor.h"
+#include "BaseSolution.h"
+#include "Conveyor.h"
+#include "StreamOutputPool.h"
+#include "SerialMessage.h"
+
+#include <math.h>
+#include <tuple>
 
 #define rotarydelta_checksum CHECKSUM("rotary_delta_calibration")
 #define enable_checksum CHECKSUM("enable")
@@ -33,6 +40,162 @@ bool RotaryDeltaCalibration::get_homing_offset(float *theta_offset)
     return ok;
 }
 
+// in machine coordinates, queued without waiting for it
+static void move_to(float x, float y, float z)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), "G53 G0 X%1.3f Y%1.3f Z%1.3f", x, y, z);
+    struct SerialMessage message;
+    message.message = buf;
+    message.stream = &(StreamOutput::NullStream);
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message ); // as it is a multi G code command
+}
+
+// the height the arm solution puts the nozzle at over x, y when arm C is at angle c, G30 only says how far C turned
+static float height_for_angle(float x, float y, float z, float c)
+{
+    for (int i = 0; i < 8; ++i) {
+        float p[3]{x, y, z}, q[3]{x, y, z + 0.01F};
+        ActuatorCoordinates a, b;
+        THEROBOT->arm_solution->cartesian_to_actuator(p, a);
+        THEROBOT->arm_solution->cartesian_to_actuator(q, b);
+        float slope= (b[2] - a[2]) / 0.01F;
+        if(fabsf(slope) < 1e-6F) break;
+        float dz= (c - a[2]) / slope;
+        z += dz;
+        if(fabsf(dz) < 0.0005F) break;
+    }
+    return z;
+}
+
+// solves a x = b for x by gaussian elimination, n is at most 4
+static bool solve_linear(float a[4][4], float b[4], int n)
+{
+    for (int c = 0; c < n; ++c) {
+        int p= c;
+        for (int r = c + 1; r < n; ++r) if(fabsf(a[r][c]) > fabsf(a[p][c])) p= r;
+        if(fabsf(a[p][c]) < 1e-9F) return false;
+        for (int k = 0; k < n; ++k) std::swap(a[c][k], a[p][k]);
+        std::swap(b[c], b[p]);
+        for (int r = 0; r < n; ++r) {
+            if(r == c) continue;
+            float f= a[r][c] / a[c][c];
+            for (int k = c; k < n; ++k) a[r][k] -= f * a[c][k];
+            b[r] -= f * b[c];
+        }
+    }
+    for (int c = 0; c < n; ++c) b[c] /= a[c][c];
+    return true;
+}
+
+// adds a row to the normal equations for each point probed, the nozzle height changes with each arm angle as the arm
+// solution says, so a point with height z and believed angles t is really on the bed h when z + sum(dz/dt * d) = h,
+// d being the offsets
+bool RotaryDeltaCalibration::probe_points(Gcode *gcode, float radius, const float start[3], float ata[4][4], float atb[4])
+{
+    static const int n_points= 7;
+    for (int i = 0; i < n_points; ++i) {
+        float x= 0, y= 0;
+        if(i > 0) {
+            float angle= (90.0F + 60.0F * (i - 1)) * (float)M_PI / 180.0F;
+            x= radius * cosf(angle);
+            y= radius * sinf(angle);
+        }
+
+        move_to(x, y, start[2]);
+
+        THEROBOT->set_last_probe_position(std::make_tuple(0, 0, 0, 0));
+        Gcode probe("G30", &(StreamOutput::NullStream));
+        THEKERNEL->call_event(ON_GCODE_RECEIVED, &probe);
+        float turned;
+        uint8_t ok;
+        std::tie(std::ignore, std::ignore, turned, ok) = THEROBOT->get_last_probe_position();
+        if(ok == 0 || THEKERNEL->is_halted()) {
+            gcode->stream->printf("error:probe at X%1.3f Y%1.3f failed, nothing changed\n", x, y);
+            return false;
+        }
+
+        // where it touched by the present offsets and how much each arm moves the nozzle there
+        float p[3]{x, y, start[2]};
+        ActuatorCoordinates at;
+        THEROBOT->arm_solution->cartesian_to_actuator(p, at);
+        float z= height_for_angle(x, y, start[2], at[2] - turned);
+        p[2]= z;
+        THEROBOT->arm_solution->cartesian_to_actuator(p, at);
+        float row[4]{0, 0, 0, -1};
+        for (int j = 0; j < 3; ++j) {
+            ActuatorCoordinates moved= at;
+            moved[j] += 0.01F;
+            float q[3];
+            THEROBOT->arm_solution->actuator_to_cartesian(moved, q);
+            row[j]= (q[2] - z) / 0.01F;
+        }
+        if(gcode->has_letter('V')) gcode->stream->printf("X%1.3f Y%1.3f Z%1.4f\n", x, y, z);
+
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) ata[r][c] += row[r] * row[c];
+            atb[r] += row[r] * -z;
+        }
+    }
+
+    // the offsets adding up to zero, as a row of its own weighted like the probed ones
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) ata[r][c] += 1.0F;
+    }
+    return true;
+}
+
+// M307 R<radius> probes the center and six points around it from the height it is at, with no homing or output in
+// between, and takes the theta offsets that make them all one flat bed by least squares. One offset added to all three
+// arms looks much the same as the bed being higher, that is left to homing and the probe so they are kept adding up
+// to zero. V also shows the height of each point
+void RotaryDeltaCalibration::calibrate(Gcode *gcode)
+{
+    float radius= gcode->has_letter('R') ? gcode->get_value('R') : 50.0F;
+    float start[3];
+    THECONVEYOR->wait_for_idle();
+    THEROBOT->get_axis_position(start);
+
+    // the normal equations of the least squares, for the three offsets and the bed height
+    float ata[4][4]{}, atb[4]{};
+    THEROBOT->push_state();
+    THEROBOT->absolute_mode = true;
+    bool ok= probe_points(gcode, radius, start, ata, atb);
+    move_to(0, 0, start[2]);
+    THEROBOT->pop_state();
+    if(!ok) return;
+
+    if(!solve_linear(ata, atb, 4)) {
+        gcode->stream->printf("error:could not solve for the offsets, nothing changed\n");
+        return;
+    }
+    for (int j = 0; j < 3; ++j) {
+        if(fabsf(atb[j]) > 5.0F) {
+            gcode->stream->printf("error:offsets of A %1.3f B %1.3f C %1.3f are too big, nothing changed\n", atb[0], atb[1], atb[2]);
+            return;
+        }
+    }
+
+    float theta_offset[3];
+    if(!get_homing_offset(theta_offset)) {
+        gcode->stream->printf("error:no endstop module found\n");
+        return;
+    }
+
+    // the arms are really that much further round than believed, as M306 with all three given
+    THECONVEYOR->wait_for_idle();
+    ActuatorCoordinates current_angle;
+    for (int j = 0; j < 3; ++j) {
+        theta_offset[j] += atb[j];
+        current_angle[j]= THEROBOT->actuators[j]->get_current_position() + atb[j];
+    }
+    PublicData::set_value( endstops_checksum, home_offset_checksum, theta_offset );
+    THEROBOT->reset_actuator_position(current_angle);
+
+    gcode->stream->printf("Corrected A %8.5f B %8.5f C %8.5f, bed at Z %1.4f\n", atb[0], atb[1], atb[2], atb[3]);
+    gcode->stream->printf("Theta Offset: A %8.5f B %8.5f C %8.5f\n", theta_offset[0], theta_offset[1], theta_offset[2]);
+}
+
 void RotaryDeltaCalibration::on_gcode_received(void *argument)
 {
     Gcode *gcode = static_cast<Gcode *>(argument);
@@ -120,7 +283,12 @@ void RotaryDeltaCalibration::on_gcode_received(void *argument)
                 }
 
                 gcode->stream->printf("Theta Offset: A %8.5f B %8.5f C %8.5f\n", theta_offset[0], theta_offset[1], theta_offset[2]);
+                break;
             }
+
+            case 307:
+                calibrate(gcode);
+                break;
         }
     }
 }
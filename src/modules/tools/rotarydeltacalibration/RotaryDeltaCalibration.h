@@ -15,4 +15,6 @@ public:
 private:
     void on_gcode_received(void *argument);
     bool get_homing_offset(float*);
+    void calibrate(Gcode *gcode);
+    bool probe_points(Gcode *gcode, float radius, const float start[3], float ata[4][4], float atb[4]);
 };
@@ -22,6 +22,7 @@
 #include "PublicData.h"
 #include <algorithm>
 #include <map>
+#include <math.h>
 
 #define scaracal_checksum CHECKSUM("scaracal")
 #define enable_checksum CHECKSUM("enable")
@@ -35,6 +36,12 @@
 #define STEPPER THEROBOT->actuators
 #define STEPS_PER_MM(a) (STEPPER[a]->get_steps_per_mm())
 
+// the angles the other calibration codes move to, spread over both joints so one straight line fit finds the scale and
+// the offset of each
+const float SCARAcal::batch_target[batch_points][2]= {
+    {0.0F, 120.0F}, {45.0F, 135.0F}, {90.0F, 130.0F}, {180.0F, 225.0F}, {180.0F, 270.0F}
+};
+
 void SCARAcal::on_module_loaded()
 {
     // if the module is disabled -> do nothing
@@ -46,8 +53,11 @@ void SCARAcal::on_module_loaded()
 
     // load settings
     this->on_config_reload(this);
+    batching= false;
+    batch_count= 0;
     // register event-handlers
     register_for_event(ON_GCODE_RECEIVED);
+    register_for_event(ON_CONFIG_RELOAD);
 }
 
 void SCARAcal::on_config_reload(void *argument)
@@ -180,6 +190,50 @@ void SCARAcal::SCARA_ang_move(float theta, float psi, float z, float feedrate)
     THEROBOT->on_gcode_received(&gc); // send to robot directly
 }
 
+// moves straight on to the next target, or once they have all been taken works out and sets the new calibration
+void SCARAcal::batch_next(StreamOutput *stream)
+{
+    if(batch_count < batch_points) {
+        const float *t= batch_target[batch_count];
+        stream->printf("Target %d of %d: T %f P %f\n", batch_count + 1, batch_points, t[0], t[1]);
+        SCARA_ang_move(t[0], t[1], batch_z, slow_rate * 3.0F);
+        return;
+    }
+    batching= false;
+    batch_solve(stream);
+}
+
+// the arms were at batch_actual by the last calibration when they were really at batch_target, a least squares line
+// through them for each joint gives its steps per degree as the slope and its trim as the offset, the same as M360 to
+// M364 each work out from a single point
+void SCARAcal::batch_solve(StreamOutput *stream)
+{
+    float slope[2], offset[2];
+    for (int j = 0; j < 2; ++j) {
+        float st= 0, sa= 0, stt= 0, sta= 0;
+        for (int i = 0; i < batch_points; ++i) {
+            float t= batch_target[i][j], a= batch_actual[i][j];
+            st += t; sa += a; stt += t * t; sta += t * a;
+        }
+        float d= batch_points * stt - st * st;
+        slope[j]= (batch_points * sta - st * sa) / d;
+        offset[j]= (sa - slope[j] * st) / batch_points;
+    }
+
+    if(fabsf(slope[0] - 1.0F) > 0.2F || fabsf(slope[1] - 1.0F) > 0.2F) {
+        stream->printf("error: scales out by more than 20%% (T %f P %f), nothing changed\n", slope[0], slope[1]);
+        return;
+    }
+
+    float trim[3];
+    this->get_trim(trim[0], trim[1], trim[2]);
+    set_trim(offset[0], offset[1] - offset[0], trim[2], stream);
+    for (int j = 0; j < 2; ++j) {
+        STEPPER[j]->change_steps_per_mm(slope[j] * STEPPER[j]->get_steps_per_mm());
+    }
+    stream->printf("steps per degree T %f P %f, home again to use the trims, M500 to save\n", STEPPER[0]->get_steps_per_mm(), STEPPER[1]->get_steps_per_mm());
+}
+
 //A GCode has been received
 //See if the current Gcode line has some orders for us
 void SCARAcal::on_gcode_received(void *argument)
@@ -331,6 +385,38 @@ void SCARAcal::on_gcode_received(void *argument)
                 this->translate_trim(gcode->stream);
                 break;
 
+            case 367: {
+                // M360 to M364 in one go, M367 clears the X and Y trims, homes once and moves to the first target, each
+                // M367 P takes where the arms were put for it and moves on to the next, the last one sets the trims
+                // and the steps per degree from all of them together
+                if(gcode->has_letter('P')) {
+                    if(!batching) {
+                        gcode->stream->printf("error: no M367 calibration started\n");
+                        break;
+                    }
+                    float cartesian[3];
+                    ActuatorCoordinates actuators;
+                    THEROBOT->get_axis_position(cartesian);
+                    THEROBOT->arm_solution->cartesian_to_actuator( cartesian, actuators );
+                    batch_actual[batch_count][0]= actuators[0];
+                    batch_actual[batch_count][1]= actuators[1];
+                    ++batch_count;
+                    batch_next(gcode->stream);
+                    break;
+                }
+
+                float cartesian[3], S_trim[3];
+                this->get_trim(S_trim[0], S_trim[1], S_trim[2]);
+                set_trim(0, 0, S_trim[2], gcode->stream);
+                this->home();
+                THEROBOT->get_axis_position(cartesian);
+                batch_z= cartesian[2] + this->z_move;
+                batch_count= 0;
+                batching= true;
+                batch_next(gcode->stream);
+            }
+            break;
+
         }
     }
 }
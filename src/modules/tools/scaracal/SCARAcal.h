@@ -37,11 +37,21 @@ private:
 
     void SCARA_ang_move(float theta, float psi, float z, float feedrate);
 
+    // M367, all the calibration targets from one home, see on_gcode_received()
+    void batch_next(StreamOutput *stream);
+    void batch_solve(StreamOutput *stream);
+    static const uint8_t batch_points= 5;
+    static const float batch_target[batch_points][2];
+    float batch_actual[batch_points][2];
+    float batch_z;
+    uint8_t batch_count;
+
     float slow_rate;
     float z_move;
 
     struct {
         bool           is_scara:1;
+        bool           batching:1;
     };
 };
 
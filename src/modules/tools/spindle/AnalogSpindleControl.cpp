@@ -9,6 +9,9 @@
 #include "libs/Kernel.h"
 #include "libs/Pin.h"
 #include "AnalogSpindleControl.h"
+#include "Tachometer.h"
+#include "SlowTicker.h"
+#include "utils.h"
 #include "Config.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
@@ -21,6 +24,13 @@
 #define spindle_pwm_pin_checksum            CHECKSUM("pwm_pin")
 #define spindle_pwm_period_checksum         CHECKSUM("pwm_period")
 #define spindle_switch_on_pin_checksum      CHECKSUM("switch_on_pin")
+#define spindle_feedback_pin_checksum       CHECKSUM("feedback_pin")
+#define spindle_pulses_per_rev_checksum     CHECKSUM("pulses_per_rev")
+#define spindle_control_P_checksum          CHECKSUM("control_P")
+#define spindle_control_I_checksum          CHECKSUM("control_I")
+#define spindle_control_smoothing_checksum  CHECKSUM("control_smoothing")
+
+#define UPDATE_FREQ 100
 
 void AnalogSpindleControl::on_module_loaded()
 {
@@ -59,6 +69,63 @@ void AnalogSpindleControl::on_module_loaded()
         switch_on = new Pin();
         switch_on->from_string(switch_on_pin)->as_output()->set(false);
     }
+
+    // Optional tachometer on a timer capture pin
+    tach = NULL;
+    current_rpm = 0;
+    current_I_value = 0;
+    control_P_term = 0;
+    control_I_term = 0;
+    {
+        Pin smoothie_pin;
+        smoothie_pin.from_string(THEKERNEL->config->value(spindle_checksum, spindle_feedback_pin_checksum)->by_default("nc")->as_string());
+        if (smoothie_pin.connected()) {
+            smoothie_pin.as_input();
+            float pulses_per_rev = THEKERNEL->config->value(spindle_checksum, spindle_pulses_per_rev_checksum)->by_default(1.0f)->as_number();
+            tach = new Tachometer(pulses_per_rev);
+            if (!tach->attach(smoothie_pin)) {
+                THEKERNEL->streams->printf("Error: Analog spindle feedback pin must be P0.23 or P0.24\n");
+                delete tach;
+                tach = NULL;
+            }
+        }
+    }
+
+    if (tach != NULL) {
+        // 0 leaves it open loop, the feedback is then only reported and used to wait for speed
+        control_P_term = THEKERNEL->config->value(spindle_checksum, spindle_control_P_checksum)->by_default(0.0f)->as_number();
+        control_I_term = THEKERNEL->config->value(spindle_checksum, spindle_control_I_checksum)->by_default(0.0f)->as_number();
+        float smoothing_time = THEKERNEL->config->value(spindle_checksum, spindle_control_smoothing_checksum)->by_default(0.1f)->as_number();
+        if (smoothing_time * UPDATE_FREQ < 1.0f)
+            smoothing_decay = 1.0f;
+        else
+            smoothing_decay = 1.0f / (UPDATE_FREQ * smoothing_time);
+
+        THEKERNEL->slow_ticker->attach(UPDATE_FREQ, this, &AnalogSpindleControl::on_update_speed);
+    }
+}
+
+uint32_t AnalogSpindleControl::on_update_speed(uint32_t dummy)
+{
+    float new_rpm = tach->update();
+    if (new_rpm == 0)
+        current_rpm = 0;
+    else
+        current_rpm = smoothing_decay * new_rpm + (1.0f - smoothing_decay) * current_rpm;
+
+    if (!spindle_on || target_rpm == 0 || (control_P_term == 0 && control_I_term == 0)) {
+        current_I_value = 0;
+        return 0;
+    }
+
+    // trim the open loop value by the error, in rpm
+    float error = target_rpm - current_rpm;
+    current_I_value += control_I_term * error / UPDATE_FREQ;
+    current_I_value = confine(current_I_value, -max_rpm, max_rpm);
+    float rpm = target_rpm + control_P_term * error + current_I_value;
+    update_pwm(confine(rpm / max_rpm, 0.0f, 1.0f));
+
+    return 0;
 }
 
 void AnalogSpindleControl::turn_on() 
@@ -106,7 +173,7 @@ void AnalogSpindleControl::report_speed()
     // report the current PWM value, calculate the current RPM value and report it as well
     float current_pwm = pwm_pin->read();
     THEKERNEL->streams->printf("Current RPM: %.0f Analog value: %5.3f Target RPM: %d\n",
-                               max_rpm * current_pwm, current_pwm, target_rpm);
+                               tach != NULL ? current_rpm : max_rpm * current_pwm, current_pwm, target_rpm);
 
 }
 
@@ -121,3 +188,24 @@ void AnalogSpindleControl::update_pwm(float value)
 
 }
 
+
+void AnalogSpindleControl::set_p_term(float p)
+{
+    control_P_term = p;
+}
+
+
+void AnalogSpindleControl::set_i_term(float i)
+{
+    control_I_term = i;
+}
+
+
+void AnalogSpindleControl::report_settings()
+{
+    if (tach == NULL) {
+        THEKERNEL->streams->printf("No spindle feedback, speed is not regulated\n");
+        return;
+    }
+    THEKERNEL->streams->printf("P: %0.6f I: %0.6f\n", control_P_term, control_I_term);
+}
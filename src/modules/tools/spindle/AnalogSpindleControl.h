@@ -15,6 +15,7 @@ namespace mbed {
 }
 
 class Pin;
+class Tachometer;
 
 // This module implements control of the spindle speed by seting a PWM from 0-100% which needs
 // to be converted to 0-10V by an external circuit
@@ -34,11 +35,26 @@ class AnalogSpindleControl: public SpindleControl {
         int min_rpm;
         int max_rpm;
 
+        // optional speed feedback, it regulates the speed when either term is set
+        Tachometer *tach;
+        float current_rpm;
+        float current_I_value;
+        float control_P_term;
+        float control_I_term;
+        float smoothing_decay;
+
         void turn_on(void);
         void turn_off(void);
         void set_speed(int);
         void report_speed(void);
         void update_pwm(float); 
+        uint32_t on_update_speed(uint32_t dummy);
+        void set_p_term(float);
+        void set_i_term(float);
+        void report_settings(void);
+        float get_current_rpm(void) { return tach != nullptr ? current_rpm : -1; };
+        float get_target_rpm(void) { return target_rpm; };
+        Tachometer *get_tachometer(void) { return tach; };
 };
 
 #endif
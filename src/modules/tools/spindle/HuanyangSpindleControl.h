@@ -10,6 +10,7 @@
 
 #include "ModbusSpindleControl.h"
 #include <stdint.h>
+#include <functional>
 
 // This module implements Modbus control for spindle control over Modbus.
 class HuanyangSpindleControl: public ModbusSpindleControl {
@@ -23,6 +24,8 @@ class HuanyangSpindleControl: public ModbusSpindleControl {
         void turn_off(void);
         void set_speed(int);
         void report_speed(void);
+        void poll_status(void);
+        void read_control(char par, std::function<void(unsigned int)> fnc);
 };
 
 #endif
@@ -145,6 +145,93 @@ void Modbus::read_write_multiple_holding_registers(int slave_addr, int read_addr
     // TODO: implement this
 }
 
+bool Modbus::queue(const char *msg, int len, int reply_len, callback_t fnc)
+{
+    uint8_t next= (q_head + 1) % k_queue_size;
+    if(next == q_tail || len + 2 > k_max_frame || reply_len > k_max_frame || (reply_len > 0 && reply_len < 3)) return false;
+
+    transaction_t &t= transactions[q_head];
+    memcpy(t.frame, msg, len);
+    unsigned int crc = crc16(t.frame, len);
+    t.frame[len] = crc & 0xFF;
+    t.frame[len + 1] = (crc >> 8);
+    t.len= len + 2;
+    t.reply_len= reply_len;
+    t.fnc= fnc;
+    q_head= next;
+    return true;
+}
+
+// runs the transaction at the tail of the queue one step at a time, every step returns straight away
+void Modbus::poll()
+{
+    uint32_t now= us_ticker_read(); // mbed call
+    transaction_t &t= transactions[q_tail];
+
+    if(state == WAIT_REPLY) {
+        while(nreply < t.reply_len && serial->readable()) {
+            reply[nreply++]= serial->getc();
+        }
+        if(nreply == t.reply_len) {
+            unsigned int crc = crc16(reply, nreply - 2);
+            finish((uint8_t)reply[nreply - 2] == (crc & 0xFF) && (uint8_t)reply[nreply - 1] == (crc >> 8));
+        } else if(now - state_time >= state_duration) {
+            finish(false);
+        }
+        return;
+    }
+
+    if(state != IDLE && now - state_time < state_duration) return;
+
+    switch(state) {
+        case IDLE:
+            if(q_head == q_tail) return;
+            // throw away anything left over, then give the transmitter a moment to come on
+            while(serial->readable()) serial->getc();
+            dir_output->set();
+            state_duration= 1000;
+            state= TX_SETUP;
+            break;
+
+        case TX_SETUP:
+            serial->write(t.frame, t.len);
+            state_duration= ceilf(t.len * delay_time * 1000.0F);
+            state= SENDING;
+            break;
+
+        case SENDING:
+            dir_output->clear();
+            if(t.reply_len == 0) {
+                finish(true);
+                return;
+            }
+            nreply= 0;
+            state_duration= k_timeout_us + ceilf(t.reply_len * delay_time * 1000.0F);
+            state= WAIT_REPLY;
+            break;
+
+        case WAIT_REPLY: // handled above
+            return;
+
+        case GAP:
+            state= IDLE;
+            return;
+    }
+    state_time= now;
+}
+
+// the current transaction is done, let the caller know and leave the line quiet for a while before the next one
+void Modbus::finish(bool ok)
+{
+    transaction_t &t= transactions[q_tail];
+    if(t.fnc) t.fnc(ok, reply, nreply);
+    t.fnc= nullptr;
+    q_tail= (q_tail + 1) % k_queue_size;
+    state= GAP;
+    state_time= us_ticker_read();
+    state_duration= k_gap_us;
+}
+
 void Modbus::calculate_delay(int baudrate, int bits, int parity, int stop) {
 
     float bittime = 1000.0 / baudrate;
@@ -10,6 +10,8 @@
 
 #include "libs/Module.h"
 #include <vector>
+#include <functional>
+#include <stdint.h>
 
 class BufferedSoftSerial;
 class GPIO;
@@ -35,12 +37,44 @@ class Modbus : public Module {
         void delay(unsigned int);
         unsigned int crc16(char *data, unsigned int len); 
 
+        // Queued transactions, nothing here waits for the serial line. The CRC is added to msg, then poll() sends it, waits
+        // for reply_len bytes of reply if there is one and calls fnc with it, or with ok false if it timed out or was corrupt.
+        // poll() must be called often from the main loop, eg on_idle. queue() returns false if the queue is full
+        using callback_t= std::function<void(bool ok, const char *reply, int len)>;
+        bool queue(const char *msg, int len, int reply_len= 0, callback_t fnc= nullptr);
+        void poll();
+        bool is_idle() const { return state == IDLE && q_head == q_tail; }
+
         GPIO *dir_output;
 
         BufferedSoftSerial* serial;
         std::vector<int> buffer;
 
         float delay_time;        
+
+    private:
+        static const int k_max_frame= 12;
+        static const int k_queue_size= 8;
+        static const uint32_t k_gap_us= 50000;     // quiet time after each transaction, the Huanyang needs a lot more than the standard 3.5 chars
+        static const uint32_t k_timeout_us= 100000; // how long to wait for a reply on top of the time it takes to send
+
+        struct transaction_t {
+            char frame[k_max_frame];
+            uint8_t len;
+            uint8_t reply_len;
+            callback_t fnc;
+        };
+
+        void finish(bool ok);
+
+        transaction_t transactions[k_queue_size];
+        char reply[k_max_frame];
+        uint8_t q_head{0}, q_tail{0}; // added at head, run from tail
+        uint8_t nreply{0};
+        uint32_t state_time{0};     // us_ticker time the current state started
+        uint32_t state_duration{0}; // how long it lasts in us
+        enum STATE { IDLE, TX_SETUP, SENDING, WAIT_REPLY, GAP };
+        STATE state{IDLE};
 };
 
 #endif
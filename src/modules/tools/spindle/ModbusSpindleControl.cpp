@@ -19,6 +19,7 @@
 #define spindle_rx_pin_checksum             CHECKSUM("rx_pin")
 #define spindle_tx_pin_checksum             CHECKSUM("tx_pin")
 #define spindle_dir_pin_checksum            CHECKSUM("dir_pin")
+#define spindle_poll_interval_checksum      CHECKSUM("poll_interval")
 
 void ModbusSpindleControl::on_module_loaded()
 {
@@ -48,5 +49,22 @@ void ModbusSpindleControl::on_module_loaded()
 
     // setup the Modbus interface
     modbus = new Modbus(tx_pin, rx_pin, dir_pin);
+
+    // optionally keep reading the speed and load in the background so M957 has them straight away
+    poll_interval = THEKERNEL->config->value(spindle_checksum, spindle_poll_interval_checksum)->by_default(0)->as_number();
+
+    // the transactions are run from here so gcodes only queue them and never wait for the VFD
+    register_for_event(ON_IDLE);
+}
+
+void ModbusSpindleControl::on_idle(void *argument)
+{
+    modbus->poll();
+
+    if(poll_interval == 0 || !modbus->is_idle()) return;
+    uint32_t now = us_ticker_read(); // mbed call
+    if(now - last_poll < poll_interval * 1000) return;
+    last_poll = now;
+    poll_status();
 }
 
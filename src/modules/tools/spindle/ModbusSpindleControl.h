@@ -19,12 +19,26 @@ class ModbusSpindleControl: public SpindleControl {
         virtual ~ModbusSpindleControl() {};
         void on_module_loaded();
         
+        void on_idle(void *argument);
+
         Modbus* modbus;
         
         virtual void turn_on(void);
         virtual void turn_off(void);
         virtual void set_speed(int);
         virtual void report_speed(void);
+        // queue the reads that update current_rpm and current_load, called every poll_interval when the bus is quiet
+        virtual void poll_status(void) {};
+        // only known when it is polled
+        float get_current_rpm(void) { return poll_interval > 0 ? current_rpm : -1; };
+        float get_target_rpm(void) { return target_rpm; };
+
+    protected:
+        int current_rpm{0};
+        int target_rpm{0};
+        float current_load{0};
+        uint32_t poll_interval{0}; // ms, 0 is off
+        uint32_t last_poll{0};
 
 };
 
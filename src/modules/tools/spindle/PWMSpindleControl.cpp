@@ -8,6 +8,7 @@
 #include "libs/Module.h"
 #include "libs/Kernel.h"
 #include "PWMSpindleControl.h"
+#include "Tachometer.h"
 #include "Config.h"
 #include "checksumm.h"
 #include "ConfigValue.h"
@@ -39,6 +40,7 @@
 
 PWMSpindleControl::PWMSpindleControl()
 {
+    tach = nullptr;
 }
 
 void PWMSpindleControl::on_module_loaded()
@@ -87,16 +89,23 @@ void PWMSpindleControl::on_module_loaded()
     pwm_pin->period_us(period);
     pwm_pin->write(output_inverted ? 1 : 0);
 
-    // Get the pin for interrupt
+    // Get the pin for interrupt, or timer capture if it is one of the capture pins
     {
         Pin *smoothie_pin = new Pin();
         smoothie_pin->from_string(THEKERNEL->config->value(spindle_checksum, spindle_feedback_pin_checksum)->by_default("nc")->as_string());
         smoothie_pin->as_input();
-        if (smoothie_pin->port_number == 0 || smoothie_pin->port_number == 2) {
+        if (Tachometer::is_capture_pin(*smoothie_pin)) {
+            tach = new Tachometer(pulses_per_rev);
+            if (!tach->attach(*smoothie_pin)) {
+                THEKERNEL->streams->printf("Error: Spindle feedback pin capture is already in use.\n");
+                delete tach;
+                delete this;
+                return;
+            }
+        } else if (smoothie_pin->port_number == 0 || smoothie_pin->port_number == 2) {
             PinName pinname = port_pin((PortName)smoothie_pin->port_number, smoothie_pin->pin);
             feedback_pin = new mbed::InterruptIn(pinname);
             feedback_pin->rise(this, &PWMSpindleControl::on_pin_rise);
-            NVIC_SetPriority(EINT3_IRQn, 16);
         } else {
             THEKERNEL->streams->printf("Error: Spindle feedback pin has to be on P0 or P2.\n");
             delete this;
@@ -118,24 +127,34 @@ void PWMSpindleControl::on_pin_rise()
 
 uint32_t PWMSpindleControl::on_update_speed(uint32_t dummy)
 {
-    // If we don't get any interrupts for 1 second, set current RPM to 0
-    uint32_t new_irq = irq_count;
-    if (last_irq != new_irq)
-        time_since_update = 0;
-    else
-        time_since_update++;
-    last_irq = new_irq;
-
-    if (time_since_update > UPDATE_FREQ)
-        last_time = 0;
+    if (tach != nullptr) {
+        // the tachometer averages all the edges since the last update and goes to 0 on its own
+        float new_rpm = tach->update();
+        if (new_rpm == 0)
+            current_rpm = 0;
+        else
+            current_rpm = smoothing_decay * new_rpm + (1.0f - smoothing_decay) * current_rpm;
 
-    // Calculate current RPM
-    uint32_t t = last_time;
-    if (t == 0) {
-        current_rpm = 0;
     } else {
-        float new_rpm = 1000000 * 60.0f / (t * pulses_per_rev);
-        current_rpm = smoothing_decay * new_rpm + (1.0f - smoothing_decay) * current_rpm;
+        // If we don't get any interrupts for 1 second, set current RPM to 0
+        uint32_t new_irq = irq_count;
+        if (last_irq != new_irq)
+            time_since_update = 0;
+        else
+            time_since_update++;
+        last_irq = new_irq;
+
+        if (time_since_update > UPDATE_FREQ)
+            last_time = 0;
+
+        // Calculate current RPM
+        uint32_t t = last_time;
+        if (t == 0) {
+            current_rpm = 0;
+        } else {
+            float new_rpm = 1000000 * 60.0f / (t * pulses_per_rev);
+            current_rpm = smoothing_decay * new_rpm + (1.0f - smoothing_decay) * current_rpm;
+        }
     }
 
     if (spindle_on) {
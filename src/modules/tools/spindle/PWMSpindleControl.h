@@ -16,6 +16,8 @@ namespace mbed {
     class InterruptIn;
 }
 
+class Tachometer;
+
 // This module implements closed loop PID control for spindle RPM.
 class PWMSpindleControl: public SpindleControl {
     public:
@@ -30,6 +32,7 @@ class PWMSpindleControl: public SpindleControl {
         
         mbed::PwmOut *pwm_pin; // PWM output for spindle speed control
         mbed::InterruptIn *feedback_pin; // Interrupt pin for measuring speed
+        Tachometer *tach; // or the timer capture, when the feedback pin is P0.23 or P0.24
         bool output_inverted;
        
         bool vfd_spindle; // true if we have a VFD driven spindle
@@ -64,6 +67,9 @@ class PWMSpindleControl: public SpindleControl {
         void set_i_term(float);
         void set_d_term(float);
         void report_settings(void);
+        float get_current_rpm(void) { return current_rpm; };
+        float get_target_rpm(void) { return target_rpm; };
+        Tachometer *get_tachometer(void) { return tach; };
 };
 
 #endif
@@ -38,19 +38,19 @@ int BufferedSoftSerial::readable(void)
 
 int BufferedSoftSerial::writeable(void)
 {
-    return 1;   // buffer allows overwriting by design, always true
+    return !_txbuf.full();
 }
 
 int BufferedSoftSerial::getc(void)
 {
-    char retval;
-    _rxbuf.pop_front(retval);
+    char retval= 0;
+    _rxbuf.pop(retval);
     return (int)retval;
 }
 
 int BufferedSoftSerial::putc(int c)
 {
-    _txbuf.push_back((char)c);
+    _txbuf.push((char)c);
     BufferedSoftSerial::prime();
 
     return c;
@@ -61,9 +61,9 @@ int BufferedSoftSerial::puts(const char *s)
     const char* ptr = s;
 
     while(*(ptr) != 0) {
-        _txbuf.push_back(*(ptr++));
+        _txbuf.push(*(ptr++));
     }
-    _txbuf.push_back('\n');  // done per puts definition
+    _txbuf.push('\n');  // done per puts definition
     BufferedSoftSerial::prime();
 
     return (ptr - s) + 1;
@@ -89,7 +89,7 @@ ssize_t BufferedSoftSerial::write(const void *s, size_t length)
     const char* end = ptr + length;
 
     while (ptr != end) {
-        _txbuf.push_back(*(ptr++));
+        _txbuf.push(*(ptr++));
     }
     BufferedSoftSerial::prime();
 
@@ -101,7 +101,7 @@ void BufferedSoftSerial::rxIrq(void)
 {
     // read from the peripheral and make sure something is available
     if(SoftSerial::readable()) {
-        _rxbuf.push_back(_getc()); // if so load them into a buffer
+        _rxbuf.push(_getc()); // if so load them into a buffer, dropped if it is full
     }
 
     return;
@@ -112,8 +112,7 @@ void BufferedSoftSerial::txIrq(void)
     char retval;
     // see if there is room in the hardware fifo and if something is in the software fifo
     while(SoftSerial::writeable()) {
-        if(_txbuf.size()) {
-            _txbuf.pop_front(retval);
+        if(_txbuf.pop(retval)) {
             _putc((int)retval);
         } else {
             // disable the TX interrupt when there is nothing left to send
@@ -25,7 +25,7 @@
 #define BUFFEREDSOFTSERIAL_H
  
 #include "mbed.h"
-#include "libs/RingBuffer.h"
+#include "libs/SPSCQueue.h"
 #include "SoftSerial.h"
 
 /**
@@ -36,8 +36,8 @@ class BufferedSoftSerial : public SoftSerial
 {
 private:
 
-     RingBuffer<char,32> _rxbuf;
-     RingBuffer<char,32> _txbuf;
+     SPSCQueue<char,32> _rxbuf;
+     SPSCQueue<char,32> _txbuf;
     //Buffer <char> _rxbuf;
     //Buffer <char> _txbuf;
  
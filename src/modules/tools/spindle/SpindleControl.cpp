@@ -10,6 +10,46 @@
 #include "Gcode.h"
 #include "Conveyor.h"
 #include "SpindleControl.h"
+#include "Config.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "StreamOutputPool.h"
+#include "PublicDataRequest.h"
+#include "SpindlePublicAccess.h"
+#include "StepTicker.h"
+#include "Tachometer.h"
+#include "libs/Pin.h"
+
+#include "us_ticker_api.h"
+
+#include <math.h>
+
+#define spindle_at_speed_tolerance_checksum CHECKSUM("at_speed_tolerance")
+#define spindle_at_speed_timeout_checksum   CHECKSUM("at_speed_timeout")
+#define spindle_reverse_pin_checksum        CHECKSUM("reverse_pin")
+
+SpindleControl::SpindleControl()
+{
+    // M3 waits until the measured rpm is within this percentage of the target
+    at_speed_tolerance = THEKERNEL->config->value(spindle_checksum, spindle_at_speed_tolerance_checksum)->by_default(0.0f)->as_number() / 100.0f;
+    at_speed_timeout = THEKERNEL->config->value(spindle_checksum, spindle_at_speed_timeout_checksum)->by_default(10.0f)->as_number();
+
+    // digital out selecting reverse on the VFD, for M4
+    reverse = false;
+    reverse_pin = nullptr;
+    std::string pin = THEKERNEL->config->value(spindle_checksum, spindle_reverse_pin_checksum)->by_default("nc")->as_string();
+    if (pin.compare("nc") != 0) {
+        reverse_pin = new Pin();
+        reverse_pin->from_string(pin)->as_output()->set(false);
+    }
+}
+
+void SpindleControl::set_reverse(bool r)
+{
+    reverse = r;
+    if (reverse_pin != nullptr)
+        reverse_pin->set(r);
+}
 
 void SpindleControl::on_gcode_received(void *argument) 
 {
@@ -37,10 +77,15 @@ void SpindleControl::on_gcode_received(void *argument)
             report_settings();
           
         }
-        else if (gcode->m == 3) 
+        else if (gcode->m == 3 || gcode->m == 4)
         {
             THECONVEYOR->wait_for_idle();
-            // M3: Spindle on
+            // M3: Spindle on, M4: spindle on in reverse
+            if (gcode->m == 4 && reverse_pin == nullptr) {
+                gcode->stream->printf("Error: spindle can not reverse, set spindle.reverse_pin\n");
+                return;
+            }
+            set_reverse(gcode->m == 4);
             if(!spindle_on) {
                 turn_on();
             }
@@ -50,6 +95,10 @@ void SpindleControl::on_gcode_received(void *argument)
             {
                 set_speed(gcode->get_value('S'));
             }
+
+            if (at_speed_tolerance > 0) {
+                wait_for_speed();
+            }
         }
         else if (gcode->m == 5)
         {
@@ -63,11 +112,78 @@ void SpindleControl::on_gcode_received(void *argument)
 
 }
 
+// no more gcodes are fetched until the spindle is at speed, it halts if that takes longer than at_speed_timeout
+void SpindleControl::wait_for_speed()
+{
+    float target = get_target_rpm();
+    if (target <= 0 || get_current_rpm() < 0) return;
+
+    uint32_t start = us_ticker_read();
+    while (fabsf(get_current_rpm() - target) > target * at_speed_tolerance) {
+        THEKERNEL->call_event(ON_IDLE, this);
+        if (THEKERNEL->is_halted() || !spindle_on) {
+            THEKERNEL->streams->printf("Wait for spindle speed aborted by kill\n");
+            return;
+        }
+        if (us_ticker_read() - start > at_speed_timeout * 1000000) {
+            THEKERNEL->streams->printf("Error: spindle did not reach %1.0f RPM, it is at %1.0f RPM. HALT asserted - reset or M999 required\n", target, get_current_rpm());
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            return;
+        }
+    }
+}
+
 void SpindleControl::on_halt(void *argument)
 {
     if (argument == nullptr) {
         if(spindle_on) {
             turn_off();
         }
+        set_reverse(false);
+    }
+}
+
+void SpindleControl::on_get_public_data(void *argument)
+{
+    PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
+
+    if (!pdr->starts_with(spindle_checksum) || !pdr->second_element_is(rigid_tap_checksum)) return;
+
+    Tachometer *tach = get_tachometer();
+    struct pad_spindle *pad = static_cast<struct pad_spindle *>(pdr->get_data_ptr());
+    pad->on = spindle_on;
+    pad->reverse = reverse;
+    pad->can_reverse = reverse_pin != nullptr;
+    pad->can_sync = tach != nullptr;
+    pad->target_rpm = get_target_rpm();
+    pad->rpm = get_current_rpm();
+    pad->pulses_per_rev = tach != nullptr ? tach->get_pulses_per_rev() : 0;
+    pdr->set_taken();
+}
+
+void SpindleControl::on_set_public_data(void *argument)
+{
+    PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
+
+    if (!pdr->starts_with(spindle_checksum)) return;
+
+    if (pdr->second_element_is(direction_checksum)) {
+        int d = *static_cast<int *>(pdr->get_data_ptr());
+        if (d == 0) {
+            if (spindle_on) turn_off();
+        } else if (d > 0 || reverse_pin != nullptr) {
+            set_reverse(d < 0);
+            if (!spindle_on) turn_on();
+        } else {
+            return;
+        }
+        pdr->set_taken();
+
+    } else if (pdr->second_element_is(sync_checksum)) {
+        Tachometer *tach = get_tachometer();
+        if (tach == nullptr) return;
+        bool on = *static_cast<bool *>(pdr->get_data_ptr());
+        tach->set_edge_fnc(on ? &StepTicker::spindle_edge : nullptr);
+        pdr->set_taken();
     }
 }
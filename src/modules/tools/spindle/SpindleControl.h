@@ -10,19 +10,37 @@
 
 #include "libs/Module.h"
 
+class Pin;
+class Tachometer;
+
 class SpindleControl: public Module {
     public:
-        SpindleControl() {};
+        SpindleControl();
         virtual ~SpindleControl() {};
         virtual void on_module_loaded() {};
 
     protected:
         bool spindle_on;
 
+        // measured rpm, negative if this spindle has no feedback
+        virtual float get_current_rpm(void) { return -1; };
+        virtual float get_target_rpm(void) { return 0; };
+        // the timer capture tachometer, which rigid tapping needs
+        virtual Tachometer *get_tachometer(void) { return nullptr; };
+
     private:
         void on_gcode_received(void *argument);
         void on_halt(void *argument);
-        
+        void on_get_public_data(void *argument);
+        void on_set_public_data(void *argument);
+        void wait_for_speed(void);
+        void set_reverse(bool r);
+
+        float at_speed_tolerance; // fraction of the target, 0 is no wait
+        float at_speed_timeout;   // seconds
+        Pin *reverse_pin;         // set for M4, nullptr if it can not reverse
+        bool reverse;
+
         virtual void turn_on(void) {};
         virtual void turn_off(void) {};
         virtual void set_speed(int) {};
@@ -0,0 +1,24 @@
+#ifndef __SPINDLEPUBLICACCESS_H
+#define __SPINDLEPUBLICACCESS_H
+
+// addresses used for public data access
+#define spindle_checksum             CHECKSUM("spindle")
+#define rigid_tap_checksum           CHECKSUM("rigid_tap")
+#define direction_checksum           CHECKSUM("direction")
+#define sync_checksum                CHECKSUM("sync")
+
+// get spindle rigid_tap
+struct pad_spindle {
+    bool on;
+    bool reverse;
+    bool can_reverse;   // it has a reverse_pin
+    bool can_sync;      // it has a timer capture tachometer
+    float target_rpm;
+    float rpm;
+    float pulses_per_rev;
+};
+
+// set spindle direction takes an int, 1 forward, -1 reverse, 0 off, at once and not in order with the moves
+// set spindle sync takes a bool, the tachometer's pulses are given to StepTicker::spindle_edge() while it is on
+
+#endif // __SPINDLEPUBLICACCESS_H
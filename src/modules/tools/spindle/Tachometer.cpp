@@ -0,0 +1,120 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Tachometer.h"
+#include "libs/Pin.h"
+
+#include "cmsis.h"
+#include "cmsis_nvic.h"
+#include "pinmap.h"
+#include "port_api.h"
+#include "us_ticker_api.h"
+#include "TimerEvent.h"
+
+Tachometer *Tachometer::instance= nullptr;
+void (*Tachometer::chained)(void)= nullptr;
+
+Tachometer::Tachometer(float pulses_per_rev) : pulses_per_rev(pulses_per_rev)
+{
+    rpm= 0;
+    prev_edges= 0;
+    prev_capture= 0;
+    channel= 0;
+    running= false;
+    edge_fnc= nullptr;
+    edges= 0;
+    last_capture= 0;
+}
+
+Tachometer::~Tachometer()
+{
+    if(instance != this) return;
+    LPC_TIM3->CCR &= ~(7 << (channel * 3));
+    LPC_TIM3->IR= 0x10 << channel;
+    instance= nullptr;
+}
+
+bool Tachometer::is_capture_pin(const Pin &pin)
+{
+    return pin.port_number == 0 && (pin.pin == 23 || pin.pin == 24);
+}
+
+bool Tachometer::attach(const Pin &pin)
+{
+    if(!is_capture_pin(pin) || instance != nullptr) return false;
+
+    instance= this;
+    channel= pin.pin - 23;
+
+    // make sure the us_ticker is running and has its handler in the vector, then put ours in front of it
+    // the match interrupts are still passed on to it so Timeouts and SoftSerial keep working
+    us_ticker_read();
+    us_ticker_set_handler(&mbed::TimerEvent::irq);
+    chained= (void (*)(void))NVIC_GetVector(TIMER3_IRQn);
+    NVIC_SetVector(TIMER3_IRQn, (uint32_t)&Tachometer::on_capture);
+    // below the step and slow tickers
+    NVIC_SetPriority(TIMER3_IRQn, 5);
+
+    pin_function(port_pin(Port0, pin.pin), 3); // CAP3.x
+    // capture on the rising edge, or the falling one if the pin is inverted, with interrupt
+    LPC_TIM3->IR= 0x10 << channel;
+    LPC_TIM3->CCR |= ((pin.is_inverting() ? 2 : 1) | 4) << (channel * 3);
+    NVIC_EnableIRQ(TIMER3_IRQn);
+    return true;
+}
+
+void Tachometer::on_capture()
+{
+    uint32_t ir= LPC_TIM3->IR;
+    uint32_t flag= 0x10 << instance->channel;
+    if(ir & flag) {
+        LPC_TIM3->IR= flag;
+        uint32_t c= instance->channel == 0 ? LPC_TIM3->CR0 : LPC_TIM3->CR1;
+        uint32_t period= c - instance->last_capture;
+        instance->last_capture= c;
+        instance->edges++;
+        void (*fnc)(uint32_t)= instance->edge_fnc;
+        if(fnc != nullptr) fnc(period);
+    }
+    if(ir & 0x0F) chained();
+}
+
+float Tachometer::update()
+{
+    // a TimerEvent made after attach puts the us_ticker handler back, it does not clear the capture flag so take it back at once
+    if(NVIC_GetVector(TIMER3_IRQn) != (uint32_t)&Tachometer::on_capture) {
+        chained= (void (*)(void))NVIC_GetVector(TIMER3_IRQn);
+        NVIC_SetVector(TIMER3_IRQn, (uint32_t)&Tachometer::on_capture);
+    }
+
+    __disable_irq();
+    uint32_t e= edges;
+    uint32_t t= last_capture;
+    __enable_irq();
+
+    uint32_t n= e - prev_edges;
+    if(n > 0) {
+        // the first edge after a stop only gives us a start time
+        if(running && t != prev_capture) rpm= 60000000.0F * n / ((t - prev_capture) * pulses_per_rev);
+        running= true;
+        prev_edges= e;
+        prev_capture= t;
+
+    } else if(running) {
+        // no edge yet, so it is turning no faster than one edge in the time since the last
+        uint32_t since= us_ticker_read() - prev_capture;
+        if(since > 1000000) {
+            rpm= 0;
+            running= false;
+        } else if(since > 0) {
+            float slowest= 60000000.0F / (since * pulses_per_rev);
+            if(slowest < rpm) rpm= slowest;
+        }
+    }
+
+    return rpm;
+}
@@ -0,0 +1,52 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TACHOMETER_H
+#define TACHOMETER_H
+
+#include <stdint.h>
+
+class Pin;
+
+// Spindle speed from a TIMER3 capture input, P0.23 (CAP3.0) or P0.24 (CAP3.1).
+// TIMER3 is the free running 1MHz us_ticker, the capture register latches it on the edge itself
+// so the timestamps have no interrupt latency in them, and the interrupt only counts the edge.
+// update() averages over all the edges since the last call, so it is still right with many edges per call.
+class Tachometer {
+    public:
+        Tachometer(float pulses_per_rev);
+        ~Tachometer();
+
+        static bool is_capture_pin(const Pin &pin);
+        // start capturing on pin, false if it is not a capture pin or the capture is already in use
+        bool attach(const Pin &pin);
+        // rpm over the edges since the last call, 0 once there have been none for a second
+        float update();
+        float get_rpm() const { return rpm; }
+        float get_pulses_per_rev() const { return pulses_per_rev; }
+        // called from the capture interrupt on each edge with the us since the one before, nullptr for none
+        void set_edge_fnc(void (*fnc)(uint32_t period_us)) { edge_fnc= fnc; }
+
+    private:
+        static void on_capture();
+        static Tachometer *instance;
+        static void (*chained)(void);
+        void (* volatile edge_fnc)(uint32_t period_us);
+
+        float pulses_per_rev;
+        float rpm;
+        uint32_t prev_edges;
+        uint32_t prev_capture;
+        uint8_t channel;
+        bool running;
+
+        // These fields are updated by the interrupt
+        volatile uint32_t edges;
+        volatile uint32_t last_capture;
+};
+
+#endif
@@ -13,6 +13,7 @@
 #include "libs/Pin.h"
 #include "modules/robot/Conveyor.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
 #include "SwitchPublicAccess.h"
 #include "SlowTicker.h"
 #include "Config.h"
@@ -43,6 +44,7 @@
 #define    output_on_command_checksum   CHECKSUM("output_on_command")
 #define    output_off_command_checksum  CHECKSUM("output_off_command")
 #define    pwm_period_ms_checksum       CHECKSUM("pwm_period_ms")
+#define    use_hardware_pwm_checksum    CHECKSUM("use_hardware_pwm")
 #define    failsafe_checksum            CHECKSUM("failsafe_set_to")
 #define    ignore_onhalt_checksum       CHECKSUM("ignore_on_halt")
 
@@ -75,32 +77,24 @@ void Switch::on_module_loaded()
 {
     this->switch_changed = false;
 
-    this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_get(switch_checksum, this);
+    PublicData::register_set(switch_checksum, this);
     this->register_for_event(ON_HALT);
 
+    this->register_for_event(ON_CONFIG_RELOAD);
+
     // Settings
-    this->on_config_reload(this);
+    this->load_config();
 }
 
 // Get config
-void Switch::on_config_reload(void *argument)
+void Switch::load_config()
 {
     this->input_pin.from_string( THEKERNEL->config->value(switch_checksum, this->name_checksum, input_pin_checksum )->by_default("nc")->as_string())->as_input();
-    this->subcode = THEKERNEL->config->value(switch_checksum, this->name_checksum, command_subcode_checksum )->by_default(0)->as_number();
-    std::string input_on_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, input_on_command_checksum )->by_default("")->as_string();
-    std::string input_off_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, input_off_command_checksum )->by_default("")->as_string();
-    this->output_on_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, output_on_command_checksum )->by_default("")->as_string();
-    this->output_off_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, output_off_command_checksum )->by_default("")->as_string();
     this->switch_state = THEKERNEL->config->value(switch_checksum, this->name_checksum, startup_state_checksum )->by_default(false)->as_bool();
     string type = THEKERNEL->config->value(switch_checksum, this->name_checksum, output_type_checksum )->by_default("pwm")->as_string();
     this->failsafe= THEKERNEL->config->value(switch_checksum, this->name_checksum, failsafe_checksum )->by_default(0)->as_number();
-    this->ignore_on_halt= THEKERNEL->config->value(switch_checksum, this->name_checksum, ignore_onhalt_checksum )->by_default(false)->as_bool();
-
-    std::string ipb = THEKERNEL->config->value(switch_checksum, this->name_checksum, input_pin_behavior_checksum )->by_default("momentary")->as_string();
-    this->input_pin_behavior = (ipb == "momentary") ? momentary_checksum : toggle_checksum;
 
     if(type == "pwm"){
         this->output_type= SIGMADELTA;
@@ -180,6 +174,39 @@ void Switch::on_config_reload(void *argument)
         this->digital_pin->set(this->switch_state);
     }
 
+    this->on_config_reload(this);
+
+    if(input_pin.connected()) {
+        // set to initial state
+        this->input_pin_state = this->input_pin.get();
+        // input pin polling
+        THEKERNEL->slow_ticker->attach( 100, this, &Switch::pinpoll_tick);
+    }
+
+    if(this->output_type == SIGMADELTA) {
+        // SIGMADELTA, or a PWM1 channel if the pin has a free one
+        bool hw= THEKERNEL->config->value(switch_checksum, this->name_checksum, use_hardware_pwm_checksum )->by_default(true)->as_bool();
+        this->sigmadelta_pin->attach(1000, hw);
+    }
+}
+
+// the commands and behaviour, from load_config and again by config-load reload, the pins and output type need a reset
+void Switch::on_config_reload(void *argument)
+{
+    this->subcode = THEKERNEL->config->value(switch_checksum, this->name_checksum, command_subcode_checksum )->by_default(0)->as_number();
+    std::string input_on_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, input_on_command_checksum )->by_default("")->as_string();
+    std::string input_off_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, input_off_command_checksum )->by_default("")->as_string();
+    this->output_on_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, output_on_command_checksum )->by_default("")->as_string();
+    this->output_off_command = THEKERNEL->config->value(switch_checksum, this->name_checksum, output_off_command_checksum )->by_default("")->as_string();
+    this->ignore_on_halt= THEKERNEL->config->value(switch_checksum, this->name_checksum, ignore_onhalt_checksum )->by_default(false)->as_bool();
+
+    std::string ipb = THEKERNEL->config->value(switch_checksum, this->name_checksum, input_pin_behavior_checksum )->by_default("momentary")->as_string();
+    this->input_pin_behavior = (ipb == "momentary") ? momentary_checksum : toggle_checksum;
+
+    if(this->output_type == SIGMADELTA) {
+        this->sigmadelta_pin->max_pwm(THEKERNEL->config->value(switch_checksum, this->name_checksum, max_pwm_checksum )->by_default(255)->as_number());
+    }
+
     // Set the on/off command codes, Use GCode to do the parsing
     input_on_command_letter = 0;
     input_off_command_letter = 0;
@@ -205,17 +232,10 @@ void Switch::on_config_reload(void *argument)
         }
     }
 
-    if(input_pin.connected()) {
-        // set to initial state
-        this->input_pin_state = this->input_pin.get();
-        // input pin polling
-        THEKERNEL->slow_ticker->attach( 100, this, &Switch::pinpoll_tick);
-    }
-
-    if(this->output_type == SIGMADELTA) {
-        // SIGMADELTA
-        THEKERNEL->slow_ticker->attach(1000, this->sigmadelta_pin, &Pwm::on_tick);
-    }
+    // only the input commands come to on_gcode_received
+    THEKERNEL->unregister_for_gcodes(this);
+    if(input_on_command_letter != 0) this->register_for_gcode(input_on_command_letter, input_on_command_code);
+    if(input_off_command_letter != 0) this->register_for_gcode(input_off_command_letter, input_off_command_code);
 
     // for commands we need to replace _ for space
     std::replace(output_on_command.begin(), output_on_command.end(), '_', ' '); // replace _ with space
@@ -245,65 +265,63 @@ void Switch::on_gcode_received(void *argument)
         return;
     }
 
-    // we need to sync this with the queue, so we need to wait for queue to empty, however due to certain slicers
-    // issuing redundant swicth on calls regularly we need to optimize by making sure the value is actually changing
-    // hence we need to do the wait for queue in each case rather than just once at the start
+    // the output changes in sync with the queue, where the moves before it end, without waiting for the queue to empty
     if(match_input_on_gcode(gcode)) {
         if (this->output_type == SIGMADELTA) {
             // SIGMADELTA output pin turn on (or off if S0)
             if(gcode->has_letter('S')) {
                 int v = roundf(gcode->get_value('S') * sigmadelta_pin->max_pwm() / 255.0F); // scale by max_pwm so input of 255 and max_pwm of 128 would set value to 128
-                if(v != this->sigmadelta_pin->get_pwm()){ // optimize... ignore if already set to the same pwm
-                    // drain queue
-                    THEKERNEL->conveyor->wait_for_idle();
-                    this->sigmadelta_pin->pwm(v);
-                    this->switch_state= (v > 0);
-                }
+                if(v < 0) v= 0;
+                queue_output(v);
+                this->switch_state= (v > 0);
             } else {
-                // drain queue
-                THEKERNEL->conveyor->wait_for_idle();
-                this->sigmadelta_pin->pwm(this->switch_value);
+                queue_output(this->switch_value);
                 this->switch_state= (this->switch_value > 0);
             }
 
         } else if (this->output_type == HWPWM) {
-            // drain queue
-            THEKERNEL->conveyor->wait_for_idle();
             // PWM output pin set duty cycle 0 - 100
             if(gcode->has_letter('S')) {
                 float v = gcode->get_value('S');
                 if(v > 100) v= 100;
                 else if(v < 0) v= 0;
-                this->pwm_pin->write(v/100.0F);
+                queue_output(roundf(v * 100));
                 this->switch_state= (v != 0);
             } else {
-                this->pwm_pin->write(this->switch_value);
+                queue_output(roundf(this->switch_value * 10000));
                 this->switch_state= (this->switch_value != 0);
             }
 
         } else if (this->output_type == DIGITAL) {
-            // drain queue
-            THEKERNEL->conveyor->wait_for_idle();
             // logic pin turn on
-            this->digital_pin->set(true);
+            queue_output(1);
             this->switch_state = true;
         }
 
     } else if(match_input_off_gcode(gcode)) {
-        // drain queue
-        THEKERNEL->conveyor->wait_for_idle();
         this->switch_state = false;
-        if (this->output_type == SIGMADELTA) {
-            // SIGMADELTA output pin
-            this->sigmadelta_pin->set(false);
+        if (this->output_type != NONE) queue_output(0);
+    }
+}
 
-        } else if (this->output_type == HWPWM) {
-            this->pwm_pin->write(0);
+// value is the sigma delta pwm, the hardware pwm duty in hundredths of a percent, or 0 and 1 for a digital pin
+void Switch::queue_output(uint32_t value)
+{
+    THECONVEYOR->queue_action(&Switch::output_action, this, value);
+}
 
-        } else if (this->output_type == DIGITAL) {
-            // logic pin turn off
-            this->digital_pin->set(false);
-        }
+// called by the conveyor where the moves queued before it end, usually from the step ticker interrupt
+void Switch::output_action(void *obj, uint32_t value)
+{
+    Switch *sw= static_cast<Switch *>(obj);
+    switch(sw->output_type) {
+        case SIGMADELTA:
+            if(value == 0) sw->sigmadelta_pin->set(false);
+            else sw->sigmadelta_pin->pwm(value);
+            break;
+        case HWPWM: sw->pwm_pin->write(value / 10000.0F); break;
+        case DIGITAL: sw->digital_pin->set(value != 0); break;
+        case NONE: break;
     }
 }
 
@@ -27,6 +27,7 @@ class Switch : public Module {
         Switch(uint16_t name);
 
         void on_module_loaded();
+        void load_config();
         void on_main_loop(void *argument);
         void on_config_reload(void* argument);
         void on_gcode_received(void* argument);
@@ -40,6 +41,8 @@ class Switch : public Module {
     private:
         void flip();
         void send_gcode(std::string msg, StreamOutput* stream);
+        void queue_output(uint32_t value);
+        static void output_action(void *obj, uint32_t value);
         bool match_input_on_gcode(const Gcode* gcode) const;
         bool match_input_off_gcode(const Gcode* gcode) const;
 
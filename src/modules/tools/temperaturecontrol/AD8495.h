@@ -9,7 +9,6 @@
 #define AD8495_H
 
 #include "TempSensor.h"
-#include "RingBuffer.h"
 #include "Pin.h"
 
 #include <tuple>
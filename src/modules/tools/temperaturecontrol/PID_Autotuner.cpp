@@ -60,6 +60,36 @@ void PID_Autotuner::begin(float target, int ncycles)
     justchanged = false;
     firstPeak= false;
     output= 0;
+
+    startTemp = temp_control->get_temperature();
+    switchTemp = startTemp;
+    switchTime = offTime = 0;
+    riseSum = fallSum = 0;
+    onTicks = offTicks = 0;
+    deadSum = 0;
+    deadCount = 0;
+    maxSlope = 0;
+    slopeTemp = startTemp;
+    slopeTime = 0;
+}
+
+// phases are only counted once the first peak is past, the warmup from cold is not a relay cycle
+void PID_Autotuner::switched(float temperature, bool on)
+{
+    if (firstPeak) {
+        unsigned long dt = tickCnt - switchTime;
+        if (on) {
+            offTicks += dt;
+            fallSum += temperature - switchTemp;
+        } else {
+            onTicks += dt;
+            riseSum += temperature - switchTemp;
+        }
+    }
+
+    if (!on) offTime = tickCnt;
+    switchTime = tickCnt;
+    switchTemp = temperature;
 }
 
 void PID_Autotuner::abort()
@@ -127,11 +157,21 @@ void PID_Autotuner::on_gcode_received(void *argument)
                 nLookBack = gcode->get_value('L');
             }
 
+            // Q1 tunes from a single step response instead of relay cycles, much quicker for a big bed
+            step_mode = gcode->has_letter('Q') && gcode->get_value('Q') != 0;
+
+            // F1 loads the thermal model as well, it is also loaded if one is already in use
+            load_model = (gcode->has_letter('F') && gcode->get_value('F') != 0) || this->temp_control->model_gain > 0;
+
             gcode->stream->printf("Start PID tune for index E%d, designator: %s\n", pool_index, this->temp_control->designator.c_str());
 
             this->begin(target, ncycles);
 
-            gcode->stream->printf("%s: Starting PID Autotune, %d max cycles, M304 aborts\n", temp_control->designator.c_str(), ncycles);
+            if (step_mode) {
+                gcode->stream->printf("%s: Starting PID Autotune from a step response, M304 aborts\n", temp_control->designator.c_str());
+            } else {
+                gcode->stream->printf("%s: Starting PID Autotune, %d max cycles, M304 aborts\n", temp_control->designator.c_str(), ncycles);
+            }
         }
     }
 }
@@ -158,6 +198,11 @@ void PID_Autotuner::on_idle(void *)
     if (temp_control == NULL)
         return;
 
+    if (step_mode) {
+        step_response(temp_control->get_temperature());
+        return;
+    }
+
     if(peakCount >= requested_cycles) {
         // NOTE we output to kernel::streams becuase it is out-of-band data and original stream may be closed
         THEKERNEL->streams->printf("// WARNING: Autopid did not resolve within %d cycles, these results are probably innacurate\n", requested_cycles);
@@ -169,6 +214,7 @@ void PID_Autotuner::on_idle(void *)
 
     // oscillate the output base on the input's relation to the setpoint
     if (refVal > target_temperature + noiseBand) {
+        if (output != 0) switched(refVal, false);
         output = 0;
         //temp_control->heater_pin.pwm(output);
         temp_control->heater_pin.set(0);
@@ -179,12 +225,13 @@ void PID_Autotuner::on_idle(void *)
         }
 
     } else if (refVal < target_temperature - noiseBand) {
+        if (output == 0) switched(refVal, true);
         output = oStep;
         temp_control->heater_pin.pwm(output);
     }
 
     if ((tickCnt % 1000) == 0) {
-        THEKERNEL->streams->printf("// Autopid Status - %5.1f/%5.1f @%d %d/%d\n",  refVal, target_temperature, output, peakCount, requested_cycles);
+        THEKERNEL->streams->broadcast(STREAM_OUTPUT_VERBOSE, "// Autopid Status - %5.1f/%5.1f @%d %d/%d\n",  refVal, target_temperature, output, peakCount, requested_cycles);
     }
 
     if(!firstPeak){
@@ -228,6 +275,11 @@ void PID_Autotuner::on_idle(void *)
             peakType = -1;
             peakCount++;
             justchanged = true;
+            // how long it kept rising after the heater went off
+            if (peak1 > offTime && offTime > 0) {
+                deadSum += peak1 - offTime;
+                deadCount++;
+            }
         }
 
         if (peakCount < requested_cycles) peaks[peakCount] = refVal;
@@ -269,6 +321,8 @@ void PID_Autotuner::finishUp()
     temp_control->setPIDi(ki);
     temp_control->setPIDd(kd);
 
+    fit_model();
+
     THEKERNEL->streams->printf("PID Autotune Complete! The settings above have been loaded into memory, but not written to your config file.\n");
 
 
@@ -285,3 +339,125 @@ void PID_Autotuner::finishUp()
         delete[] lastInputs;
     lastInputs = NULL;
 }
+
+/**
+ * Around the target a heater behaves roughly as a first order system
+ *   tau * dT/dt = gain * u - (T - ambient)
+ * where u is the fraction of full power. Holding the target takes the average duty of the relay cycles, so
+ *   gain = (target - ambient) / (duty * u_on)
+ * and the difference between the rate of rise with the heater on and the rate of fall with it off gives
+ *   tau = gain * u_on / (rise - fall)
+ * The dead time is how long it keeps rising after the heater is switched off. The temperature at the start is
+ * taken as ambient, so this needs to be run from cold.
+ */
+void PID_Autotuner::fit_model()
+{
+    if (onTicks == 0 || offTicks == 0 || fallSum >= 0 || riseSum <= 0) {
+        THEKERNEL->streams->printf("\tNot enough cycles to fit a thermal model\n");
+        return;
+    }
+
+    float u = oStep / 255.0F;
+    float duty = (float)onTicks / (onTicks + offTicks);
+    float rise = riseSum * 1000 / onTicks; // °C/sec
+    float fall = fallSum * 1000 / offTicks;
+    float gain = (target_temperature - startTemp) / (duty * u);
+    float tau = gain * u / (rise - fall);
+    float dead = deadCount > 0 ? (float)deadSum / deadCount / 1000 : 0;
+
+    show_model(gain, tau, dead);
+}
+
+void PID_Autotuner::show_model(float gain, float tau, float dead)
+{
+    THEKERNEL->streams->printf("\tThermal model:\n\tGain: %1.1f°C\n\tTime constant: %1.1fs\n\tDead time: %1.1fs\n\tAmbient: %1.1f°C\n", gain, tau, dead, startTemp);
+    THEKERNEL->streams->printf("\tM306 S%d K%1.1f L%1.1f A%1.1f\n", temp_control->pool_index, gain, dead, startTemp);
+
+    if (load_model) {
+        temp_control->model_gain = gain;
+        temp_control->model_dead_time = dead;
+        temp_control->model_ambient = startTemp;
+    }
+}
+
+/**
+ * A first order plus dead time heater driven at a fixed power from cold rises fastest just after the dead time,
+ * and the rate then decays as exp(-t/tau). The tangent at the steepest point crosses the starting temperature at
+ * the dead time, and the time for the rate to fall to 80% gives tau, so it does not need to get anywhere near a
+ * steady state. It also stops if the target is reached first.
+ */
+void PID_Autotuner::step_response(float refVal)
+{
+    if (output == 0) {
+        output = oStep;
+        temp_control->heater_pin.pwm(output);
+    }
+
+    if ((tickCnt % 1000) == 0) {
+        THEKERNEL->streams->broadcast(STREAM_OUTPUT_VERBOSE, "// Autopid Status - %5.1f/%5.1f @%d rate %1.3f°C/s\n",  refVal, target_temperature, output, maxSlope);
+    }
+
+    if (refVal >= target_temperature) {
+        THEKERNEL->streams->printf("// WARNING: Autopid reached the target before the rate of rise fell, results are probably too aggressive, try a higher target\n");
+        finishStep(0);
+        return;
+    }
+
+    // the rate is taken over the look back, lastInputs[0] is the newest reading
+    for (int i = nLookBack - 1; i >= 0; i--) {
+        lastInputs[i + 1] = lastInputs[i];
+    }
+    lastInputs[0] = refVal;
+    if (lookBackCnt < nLookBack) {
+        lookBackCnt++;
+        return;
+    }
+
+    unsigned long span = nLookBack * (1000 / 20); // ms, one reading per tick
+    float slope = (refVal - lastInputs[nLookBack]) * 1000 / span;
+    unsigned long mid = tickCnt - span / 2;
+
+    if (slope > maxSlope) {
+        maxSlope = slope;
+        slopeTime = mid;
+        slopeTemp = (refVal + lastInputs[nLookBack]) / 2;
+
+    } else if (slope < 0.8F * maxSlope) {
+        finishStep((mid - slopeTime) / 1000.0F);
+    }
+}
+
+// decay is the seconds the rate took to fall to 80%, 0 if it did not
+void PID_Autotuner::finishStep(float decay)
+{
+    if (maxSlope <= 0) {
+        THEKERNEL->streams->printf("// WARNING: Autopid saw no rise in temperature, nothing changed\n");
+        abort();
+        return;
+    }
+
+    float dead = (slopeTime - (slopeTemp - startTemp) / maxSlope * 1000) / 1000.0F;
+    if (dead < 0.1F) dead = 0.1F;
+    float r = maxSlope / oStep; // °C/sec per unit of pwm
+    THEKERNEL->streams->printf("\tRate: %g, Dead time: %g\n", maxSlope, dead);
+
+    // Ziegler-Nichols reaction curve
+    float kp = 1.2F / (r * dead);
+    float ki = kp / (2 * dead);
+    float kd = kp * 0.5F * dead;
+
+    THEKERNEL->streams->printf("\tTrying:\n\tKp: %5.1f\n\tKi: %5.3f\n\tKd: %5.0f\n", kp, ki, kd);
+
+    temp_control->setPIDp(kp);
+    temp_control->setPIDi(ki);
+    temp_control->setPIDd(kd);
+
+    if (decay > 0) {
+        float tau = decay / logf(1.25F);
+        show_model(maxSlope * tau / (oStep / 255.0F), tau, dead);
+    }
+
+    THEKERNEL->streams->printf("PID Autotune Complete! The settings above have been loaded into memory, but not written to your config file.\n");
+
+    abort();
+}
@@ -25,6 +25,11 @@ private:
     void begin(float, int );
     void abort();
     void finishUp();
+    void switched(float temperature, bool on);
+    void fit_model();
+    void step_response(float temperature);
+    void finishStep(float decay);
+    void show_model(float gain, float tau, float dead);
 
     TemperatureControl *temp_control;
     float target_temperature;
@@ -43,10 +48,26 @@ private:
     float oStep;
     int output;
     volatile unsigned long tickCnt;
+
+    // what the relay cycles show of the thermal model, see fit_model()
+    float startTemp;
+    float switchTemp;
+    unsigned long switchTime, offTime;
+    float riseSum, fallSum;
+    unsigned long onTicks, offTicks;
+    unsigned long deadSum;
+    int deadCount;
+
+    // the steepest rise of a step response, see step_response()
+    float maxSlope, slopeTemp;
+    unsigned long slopeTime;
+
     struct {
         bool justchanged:1;
         volatile bool tick:1;
         bool firstPeak:1;
+        bool load_model:1;
+        bool step_mode:1;
     };
 };
 
@@ -42,6 +42,7 @@
 #define readings_per_second_checksum       CHECKSUM("readings_per_second")
 #define max_pwm_checksum                   CHECKSUM("max_pwm")
 #define pwm_frequency_checksum             CHECKSUM("pwm_frequency")
+#define use_hardware_pwm_checksum          CHECKSUM("use_hardware_pwm")
 #define bang_bang_checksum                 CHECKSUM("bang_bang")
 #define hysteresis_checksum                CHECKSUM("hysteresis")
 #define heater_pin_checksum                CHECKSUM("heater_pin")
@@ -60,6 +61,10 @@
 
 #define i_max_checksum                     CHECKSUM("i_max")
 #define windup_checksum                    CHECKSUM("windup")
+#define model_gain_checksum                CHECKSUM("model_gain")
+#define model_dead_time_checksum           CHECKSUM("model_dead_time")
+#define model_ambient_checksum             CHECKSUM("model_ambient")
+#define history_enable_checksum            CHECKSUM("history_enable")
 
 #define preset1_checksum                   CHECKSUM("preset1")
 #define preset2_checksum                   CHECKSUM("preset2")
@@ -69,6 +74,9 @@
 #define runaway_cooling_timeout_checksum   CHECKSUM("runaway_cooling_timeout")
 #define runaway_error_range_checksum       CHECKSUM("runaway_error_range")
 
+#define watts_checksum                     CHECKSUM("watts")
+#define power_priority_checksum            CHECKSUM("power_priority")
+
 TemperatureControl::TemperatureControl(uint16_t name, int index)
 {
     name_checksum= name;
@@ -76,13 +84,22 @@ TemperatureControl::TemperatureControl(uint16_t name, int index)
     waiting= false;
     temp_violated= false;
     sensor= nullptr;
+    history= nullptr;
     readonly= false;
     tick= 0;
+    i_max= 0;
+    model_gain= 0;
+    model_dead_time= 0;
+    model_ambient= 25;
+    slope= 0;
+    power_watts= 0;
+    power_priority= 0;
 }
 
 TemperatureControl::~TemperatureControl()
 {
     delete sensor;
+    delete history;
 }
 
 void TemperatureControl::on_module_loaded()
@@ -96,15 +113,23 @@ void TemperatureControl::on_module_loaded()
     this->load_config();
 
     // Register for events
-    this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
+    for (uint16_t m : {143, 301, 305, 306, 308, 500, 503}) {
+        this->register_for_gcode('M', m);
+    }
+    this->register_for_gcode('M', this->get_m_code);
+    this->register_for_gcode('M', this->set_m_code);
+    this->register_for_gcode('M', this->set_and_wait_m_code);
+    this->register_for_event(ON_CONFIG_RELOAD);
+    PublicData::register_get(temperature_control_checksum, this);
+    PublicData::register_set(temperature_control_checksum, this);
     this->register_for_event(ON_IDLE);
 
     if(!this->readonly) {
         this->register_for_event(ON_SECOND_TICK);
         this->register_for_event(ON_MAIN_LOOP);
-        this->register_for_event(ON_SET_PUBLIC_DATA);
         this->register_for_event(ON_HALT);
+    }else if(this->history != nullptr) {
+        this->register_for_event(ON_SECOND_TICK);
     }
 }
 
@@ -146,25 +171,6 @@ void TemperatureControl::load_config()
 
     this->designator          = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, designator_checksum)->by_default(string("T"))->as_string();
 
-    // Runaway parameters
-    uint32_t n= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_range_checksum)->by_default(20)->as_number();
-    if(n > 63) n= 63;
-    this->runaway_range= n;
-
-    // these need to fit in 9 bits after dividing by 8 so max is 4088 secs or 68 minutes
-    n= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_heating_timeout_checksum)->by_default(900)->as_number();
-    if(n > 4088) n= 4088;
-    this->runaway_heating_timeout = n/8; // we have 8 second ticks
-    n= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_cooling_timeout_checksum)->by_default(0)->as_number(); // disable by default
-    if(n > 4088) n= 4088;
-    this->runaway_cooling_timeout = n/8;
-
-    this->runaway_error_range= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_error_range_checksum)->by_default(1.0F)->as_number();
-
-    // Max and min temperatures we are not allowed to get over (Safety)
-    this->max_temp = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, max_temp_checksum)->by_default(300)->as_number();
-    this->min_temp = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, min_temp_checksum)->by_default(0)->as_number();
-
     // Heater pin
     this->heater_pin.from_string( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, heater_pin_checksum)->by_default("nc")->as_string());
     if(this->heater_pin.connected()){
@@ -196,30 +202,86 @@ void TemperatureControl::load_config()
     }
     sensor->UpdateConfig(temperature_control_checksum, this->name_checksum);
 
-    this->preset1 = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, preset1_checksum)->by_default(0)->as_number();
-    this->preset2 = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, preset2_checksum)->by_default(0)->as_number();
-
-
     // sigma-delta output modulation
     this->o = 0;
 
     if(!this->readonly) {
-        // used to enable bang bang control of heater
-        this->use_bangbang = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, bang_bang_checksum)->by_default(false)->as_bool();
-        this->hysteresis = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, hysteresis_checksum)->by_default(2)->as_number();
-        this->windup = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, windup_checksum)->by_default(false)->as_bool();
-        this->heater_pin.max_pwm( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, max_pwm_checksum)->by_default(255)->as_number() );
         this->heater_pin.set(0);
         set_low_on_debug(heater_pin.port_number, heater_pin.pin);
-        // activate SD-DAC timer
-        THEKERNEL->slow_ticker->attach( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, pwm_frequency_checksum)->by_default(2000)->as_number(), &heater_pin, &Pwm::on_tick);
+        // activate SD-DAC timer, or a PWM1 channel if the pin has a free one
+        uint32_t pwm_frequency= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, pwm_frequency_checksum)->by_default(2000)->as_number();
+        bool hw= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, use_hardware_pwm_checksum)->by_default(true)->as_bool();
+        this->heater_pin.attach(pwm_frequency, hw);
     }
 
 
     // reading tick
-    THEKERNEL->slow_ticker->attach( this->readings_per_second, this, &TemperatureControl::thermistor_read_tick );
+    if(TemperatureScheduler::instance != nullptr) {
+        this->readings_per_second = TemperatureScheduler::instance->add_sensor(this, this->readings_per_second);
+    } else {
+        THEKERNEL->slow_ticker->attach( this->readings_per_second, this, &TemperatureControl::thermistor_read_tick );
+    }
     this->PIDdt = 1.0 / this->readings_per_second;
 
+    // a share of heater_power_budget, if there is one
+    this->power_watts= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, watts_checksum)->by_default(0)->as_number();
+    this->power_priority= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, power_priority_checksum)->by_default(1)->as_int();
+    if(this->readonly || TemperatureScheduler::instance == nullptr || !TemperatureScheduler::instance->add_heater(this)) {
+        this->power_watts= 0;
+    }
+
+    this->on_config_reload(this);
+
+    // optional record of the last hour for M308, about 1K each
+    if(this->history == nullptr && THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, history_enable_checksum)->by_default(false)->as_bool()) {
+        this->history= new TemperatureHistory;
+    }
+
+    this->iTerm = 0.0;
+    this->lastInput = -1.0;
+    this->last_reading = 0.0;
+#ifdef TEMPERATURE_FIXED_PID
+    this->fixed.iterm= 0;
+    this->fixed.last_input= -256;
+    this->fixed.slope= 0;
+    load_fixed_pid();
+#endif
+}
+
+// the settings that can be changed while it is running, from load_config and again by config-load reload
+// the heater pin, sensor and reading rate need a reset
+void TemperatureControl::on_config_reload(void *argument)
+{
+    // Runaway parameters
+    uint32_t n= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_range_checksum)->by_default(20)->as_number();
+    if(n > 63) n= 63;
+    this->runaway_range= n;
+
+    // these need to fit in 9 bits after dividing by 8 so max is 4088 secs or 68 minutes
+    n= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_heating_timeout_checksum)->by_default(900)->as_number();
+    if(n > 4088) n= 4088;
+    this->runaway_heating_timeout = n/8; // we have 8 second ticks
+    n= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_cooling_timeout_checksum)->by_default(0)->as_number(); // disable by default
+    if(n > 4088) n= 4088;
+    this->runaway_cooling_timeout = n/8;
+
+    this->runaway_error_range= THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, runaway_error_range_checksum)->by_default(1.0F)->as_number();
+
+    // Max and min temperatures we are not allowed to get over (Safety)
+    this->max_temp = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, max_temp_checksum)->by_default(300)->as_number();
+    this->min_temp = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, min_temp_checksum)->by_default(0)->as_number();
+
+    this->preset1 = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, preset1_checksum)->by_default(0)->as_number();
+    this->preset2 = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, preset2_checksum)->by_default(0)->as_number();
+
+    if(!this->readonly) {
+        // used to enable bang bang control of heater
+        this->use_bangbang = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, bang_bang_checksum)->by_default(false)->as_bool();
+        this->hysteresis = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, hysteresis_checksum)->by_default(2)->as_number();
+        this->windup = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, windup_checksum)->by_default(false)->as_bool();
+        this->heater_pin.max_pwm( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, max_pwm_checksum)->by_default(255)->as_number() );
+    }
+
     // PID
     setPIDp( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, p_factor_checksum)->by_default(10 )->as_number() );
     setPIDi( THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, i_factor_checksum)->by_default(0.3f)->as_number() );
@@ -228,11 +290,12 @@ void TemperatureControl::load_config()
     if(!this->readonly) {
         // set to the same as max_pwm by default
         this->i_max = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, i_max_checksum   )->by_default(this->heater_pin.max_pwm())->as_number();
-    }
 
-    this->iTerm = 0.0;
-    this->lastInput = -1.0;
-    this->last_reading = 0.0;
+        // optional thermal model, see pid_process, a gain of 0 is plain PID
+        this->model_gain = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, model_gain_checksum)->by_default(0)->as_number();
+        this->model_dead_time = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, model_dead_time_checksum)->by_default(0)->as_number();
+        this->model_ambient = THEKERNEL->config->value(temperature_control_checksum, this->name_checksum, model_ambient_checksum)->by_default(25)->as_number();
+    }
 }
 
 void TemperatureControl::on_gcode_received(void *argument)
@@ -278,6 +341,24 @@ void TemperatureControl::on_gcode_received(void *argument)
             return;
         }
 
+        if (gcode->m == 308) { // dump the temperature history, P is how many seconds back it starts and E how many it ends
+            if (gcode->has_letter('S') && (gcode->get_value('S') == this->pool_index)) {
+                if(this->history == nullptr) {
+                    gcode->stream->printf("%s(S%d): no history, set history_enable\n", this->designator.c_str(), this->pool_index);
+                }else{
+                    print_history(gcode->stream, gcode->has_letter('P') ? gcode->get_int('P') : 60, gcode->has_letter('E') ? gcode->get_int('E') : 0);
+                }
+
+            }else if(!gcode->has_letter('S') && this->history != nullptr) {
+                gcode->stream->printf("%s(S%d): history", this->designator.c_str(), this->pool_index);
+                for (int l = 0; l < TemperatureHistory::levels; ++l) {
+                    gcode->stream->printf(" %dx%ds", this->history->count(l), TemperatureHistory::resolution(l));
+                }
+                gcode->stream->printf("\n");
+            }
+            return;
+        }
+
         // readonly sensors don't handle the rest
         if(this->readonly) return;
 
@@ -306,14 +387,37 @@ void TemperatureControl::on_gcode_received(void *argument)
                     this->i_max = gcode->get_value('X');
                 if (gcode->has_letter('Y'))
                     this->heater_pin.max_pwm(gcode->get_value('Y'));
+#ifdef TEMPERATURE_FIXED_PID
+                load_fixed_pid();
+#endif
 
             }else if(!gcode->has_letter('S')) {
                 gcode->stream->printf("%s(S%d): Pf:%g If:%g Df:%g X(I_max):%g Y(max pwm):%d O:%d\n", this->designator.c_str(), this->pool_index, this->p_factor, this->i_factor / this->PIDdt, this->d_factor * this->PIDdt, this->i_max, this->heater_pin.max_pwm(), o);
             }
 
+        } else if (gcode->m == 306) { // thermal model, K0 turns it off
+            if (gcode->has_letter('S') && (gcode->get_value('S') == this->pool_index)) {
+                if (gcode->has_letter('K'))
+                    this->model_gain = gcode->get_value('K');
+                if (gcode->has_letter('L'))
+                    this->model_dead_time = gcode->get_value('L');
+                if (gcode->has_letter('A'))
+                    this->model_ambient = gcode->get_value('A');
+#ifdef TEMPERATURE_FIXED_PID
+                load_fixed_pid();
+#endif
+
+            }else if(!gcode->has_letter('S')) {
+                gcode->stream->printf("%s(S%d): K(gain):%g L(dead time):%g A(ambient):%g FF:%1.1f\n", this->designator.c_str(), this->pool_index, this->model_gain, this->model_dead_time, this->model_ambient, feedforward(this->target_temperature));
+            }
+
         } else if (gcode->m == 500 || gcode->m == 503) { // M500 saves some volatile settings to config override file, M503 just prints the settings
             gcode->stream->printf(";PID settings:\nM301 S%d P%1.4f I%1.4f D%1.4f X%1.4f Y%d\n", this->pool_index, this->p_factor, this->i_factor / this->PIDdt, this->d_factor * this->PIDdt, this->i_max, this->heater_pin.max_pwm());
 
+            if(this->model_gain > 0) {
+                gcode->stream->printf(";Thermal model:\nM306 S%d K%1.4f L%1.4f A%1.4f\n", this->pool_index, this->model_gain, this->model_dead_time, this->model_ambient);
+            }
+
             gcode->stream->printf(";Max temperature setting:\nM143 S%d P%1.4f\n", this->pool_index, this->max_temp);
 
             if(this->sensor_settings) {
@@ -430,7 +534,20 @@ void TemperatureControl::on_set_public_data(void *argument)
 
     if(!pdr->starts_with(temperature_control_checksum)) return;
 
-    if(!pdr->second_element_is(this->name_checksum)) return;
+    if(pdr->second_element_is(watch_temperature_checksum)) {
+        // every controller with the designator takes a bit in the watch, read only ones included
+        pad_temperature_watch *w = static_cast<pad_temperature_watch *>(pdr->get_data_ptr());
+        if(this->designator[0] != w->designator || w->controllers >= 32) return;
+        uint32_t bit = 1 << w->controllers++;
+        if(this->last_reading >= w->threshold) w->above |= bit;
+        __disable_irq(); // the read tick goes through the list
+        this->watches.push_back(std::make_pair(w, bit));
+        __enable_irq();
+        pdr->set_taken();
+        return;
+    }
+
+    if(this->readonly || !pdr->second_element_is(this->name_checksum)) return;
 
     // ok this is targeted at us, so set the temp
     // NOTE unlike the M code this will set the temp now not when the queue is empty
@@ -460,16 +577,35 @@ void TemperatureControl::set_desired_temperature(float desired_temperature)
     }else if(last_target_temperature <= 0.0F) {
         // if it was off and we are now turning it on we need to initialize
         this->lastInput= last_reading;
+        this->slope= 0;
         // set to whatever the output currently is See http://brettbeauregard.com/blog/2011/04/improving-the-beginner%E2%80%99s-pid-initialization/
         this->iTerm= this->o;
         if (this->iTerm > this->i_max) this->iTerm = this->i_max;
         else if (this->iTerm < 0.0) this->iTerm = 0.0;
+#ifdef TEMPERATURE_FIXED_PID
+        this->fixed.iterm= this->iTerm * 65536.0F;
+        this->fixed.last_input= last_reading * 256.0F;
+        this->fixed.slope= 0;
+#endif
     }
 
     // reset the runaway state, even if it was a temp change
     this->runaway_state = NOT_HEATING;
 }
 
+// the scheduler may give a slightly different rate than configured, the PID factors are per reading
+// so they are rescaled to keep the same values per second
+void TemperatureControl::set_readings_per_second(float rps)
+{
+    if(rps == this->readings_per_second) return;
+    float i = this->i_factor / this->PIDdt;
+    float d = this->d_factor * this->PIDdt;
+    this->readings_per_second = rps;
+    this->PIDdt = 1.0F / rps;
+    setPIDi(i);
+    setPIDd(d);
+}
+
 float TemperatureControl::get_temperature()
 {
     return last_reading;
@@ -485,15 +621,31 @@ uint32_t TemperatureControl::thermistor_read_tick(uint32_t dummy)
             heater_pin.set((this->o = 0));
         } else {
             pid_process(temperature);
+            if(this->power_watts > 0) TemperatureScheduler::instance->share_power();
+            else write_heater(this->o);
         }
     }
 
     last_reading = temperature;
+
+    // this is the only place the bits are changed
+    for(auto &w : watches) {
+        if(temperature >= w.first->threshold) w.first->above |= w.second;
+        else w.first->above &= ~w.second;
+    }
     return 0;
 }
 
+// a bang bang heater is only ever on or off, unless it has a max_pwm
+void TemperatureControl::write_heater(int pwm)
+{
+    if(use_bangbang && (pwm <= 0 || pwm >= 255)) this->heater_pin.set(pwm > 0);
+    else this->heater_pin.pwm(pwm);
+}
+
 /**
  * Based on https://github.com/br3ttb/Arduino-PID-Library
+ * only works out o, thermistor_read_tick() writes it to the heater
  */
 void TemperatureControl::pid_process(float temperature)
 {
@@ -501,36 +653,83 @@ void TemperatureControl::pid_process(float temperature)
         // bang bang is very simple, if temp is < target - hysteresis turn on full else if  temp is > target + hysteresis turn heater off
         // good for relays
         if(temperature > (target_temperature + hysteresis) && this->o > 0) {
-            heater_pin.set(false);
-            this->o = 0; // for display purposes only
+            this->o = 0;
 
         } else if(temperature < (target_temperature - hysteresis) && this->o <= 0) {
-            if(heater_pin.max_pwm() >= 255) {
-                // turn on full
-                this->heater_pin.set(true);
-                this->o = 255; // for display purposes only
-            } else {
-                // only to whatever max pwm is configured
-                this->heater_pin.pwm(heater_pin.max_pwm());
-                this->o = heater_pin.max_pwm(); // for display purposes only
-            }
+            // turn on full, or only to whatever max pwm is configured
+            this->o = heater_pin.max_pwm() >= 255 ? 255 : heater_pin.max_pwm();
         }
         return;
     }
 
+#ifdef TEMPERATURE_FIXED_PID
+    // the same as below in fixed point, only the reading and the target are converted
+    int32_t t = temperature * 256.0F;
+    int32_t error = (int32_t)(target_temperature * 256.0F) - t;
+    int32_t d = t - this->fixed.last_input;
+    int32_t max_pwm = (int32_t)heater_pin.max_pwm() << 16;
+
+    int32_t ff = 0;
+    if(this->fixed.model_scale > 0) {
+        ff = ((int64_t)(error + t - this->fixed.ambient) * this->fixed.model_scale) >> 8;
+        if(ff < 0) ff = 0;
+        else if(ff > max_pwm) ff = max_pwm;
+
+        this->fixed.slope += (((((int64_t)d * this->fixed.rate) >> 16) - this->fixed.slope) * this->fixed.alpha) >> 16;
+        if(error > 0 && (((int64_t)this->fixed.slope * this->fixed.dead_time) >> 16) >= error) {
+            this->o = ff >> 16;
+            this->fixed.last_input = t;
+            return;
+        }
+    }
+
+    int32_t new_I = this->fixed.iterm + (((int64_t)error * this->fixed.i) >> 8);
+    if (new_I > this->fixed.i_max) new_I = this->fixed.i_max;
+    else if (new_I < -ff) new_I = -ff;
+    if(!this->windup) this->fixed.iterm = new_I;
+
+    int32_t out = (((int64_t)error * this->fixed.p - (int64_t)d * this->fixed.d) >> 8) + new_I + ff;
+
+    if (out >= max_pwm)
+        out = max_pwm;
+    else if (out < 0)
+        out = 0;
+    else if(this->windup)
+        this->fixed.iterm = new_I;
+
+    this->o = out >> 16;
+    this->fixed.last_input = t;
+
+#else
     // regular PID control
     float error = target_temperature - temperature;
+    float d = (temperature - this->lastInput);
+
+    // with a thermal model the power it says holds the target is fed forward, so the PID only has to correct
+    // the model error, and the integral may go negative to take some of it away
+    float ff = feedforward(target_temperature);
+    if(this->model_gain > 0) {
+        // rate of rise in °C/sec, smoothed over about a second
+        float a = this->PIDdt < 1.0F ? this->PIDdt : 1.0F;
+        this->slope += (d * this->readings_per_second - this->slope) * a;
+
+        // the heat already in the heater keeps the temperature rising for about the dead time after the power
+        // is cut, when that would reach the target only the feedforward is applied and it coasts in
+        if(error > 0 && temperature + this->slope * this->model_dead_time >= target_temperature) {
+            this->o = ff;
+            this->lastInput = temperature;
+            return;
+        }
+    }
 
     float new_I = this->iTerm + (error * this->i_factor);
     if (new_I > this->i_max) new_I = this->i_max;
-    else if (new_I < 0.0) new_I = 0.0;
+    else if (new_I < -ff) new_I = -ff;
     if(!this->windup) this->iTerm= new_I;
 
-    float d = (temperature - this->lastInput);
-
     // calculate the PID output
     // TODO does this need to be scaled by max_pwm/256? I think not as p_factor already does that
-    this->o = (this->p_factor * error) + new_I - (this->d_factor * d);
+    this->o = (this->p_factor * error) + new_I - (this->d_factor * d) + ff;
 
     if (this->o >= heater_pin.max_pwm())
         this->o = heater_pin.max_pwm();
@@ -539,16 +738,18 @@ void TemperatureControl::pid_process(float temperature)
     else if(this->windup)
         this->iTerm = new_I; // Only update I term when output is not saturated.
 
-    this->heater_pin.pwm(this->o);
     this->lastInput = temperature;
+#endif
 }
 
 void TemperatureControl::on_second_tick(void *argument)
 {
+    if(this->history != nullptr)
+        this->history->add(get_temperature(), target_temperature, this->o);
 
     // If waiting for a temperature to be reach, display it to keep host programs up to date on the progress
     if (waiting)
-        THEKERNEL->streams->printf("%s:%3.1f /%3.1f @%d\n", designator.c_str(), get_temperature(), ((target_temperature <= 0) ? 0.0 : target_temperature), o);
+        THEKERNEL->streams->broadcast(STREAM_OUTPUT_VERBOSE, "%s:%3.1f /%3.1f @%d\n", designator.c_str(), get_temperature(), ((target_temperature <= 0) ? 0.0 : target_temperature), o);
 
     // Check whether or not there is a temperature runaway issue, if so stop everything and report it
     if(THEKERNEL->is_halted()) return;
@@ -617,17 +818,70 @@ void TemperatureControl::on_second_tick(void *argument)
     }
 }
 
+// pwm the thermal model says holds the heater at temperature t, 0 if there is no model
+float TemperatureControl::feedforward(float t)
+{
+    if(this->model_gain <= 0 || t <= 0) return 0;
+    return confine((t - this->model_ambient) * 255.0F / this->model_gain, 0.0F, (float)this->heater_pin.max_pwm());
+}
+
 void TemperatureControl::setPIDp(float p)
 {
     this->p_factor = p;
+#ifdef TEMPERATURE_FIXED_PID
+    load_fixed_pid();
+#endif
 }
 
 void TemperatureControl::setPIDi(float i)
 {
     this->i_factor = i * this->PIDdt;
+#ifdef TEMPERATURE_FIXED_PID
+    load_fixed_pid();
+#endif
 }
 
 void TemperatureControl::setPIDd(float d)
 {
     this->d_factor = d / this->PIDdt;
+#ifdef TEMPERATURE_FIXED_PID
+    load_fixed_pid();
+#endif
+}
+
+#ifdef TEMPERATURE_FIXED_PID
+// converts the tuning to the fixed point pid_process uses, whenever any of it changes
+void TemperatureControl::load_fixed_pid()
+{
+    this->fixed.p = this->p_factor * 65536.0F;
+    this->fixed.i = this->i_factor * 65536.0F;
+    this->fixed.d = this->d_factor * 65536.0F;
+    this->fixed.i_max = this->i_max * 65536.0F;
+    this->fixed.rate = this->readings_per_second * 65536.0F;
+    this->fixed.alpha = (this->PIDdt < 1.0F ? this->PIDdt : 1.0F) * 65536.0F;
+    this->fixed.dead_time = this->model_dead_time * 65536.0F;
+    this->fixed.ambient = this->model_ambient * 256.0F;
+    this->fixed.model_scale = this->model_gain > 0 ? 255.0F * 65536.0F / this->model_gain : 0;
+}
+#endif
+
+// the samples between seconds and end seconds ago, from the finest level that goes back that far,
+// a header line then temperature,target,pwm per sample oldest first, temperatures in tenths of a degree
+void TemperatureControl::print_history(StreamOutput *stream, int seconds, int end)
+{
+    if(end < 0) end= 0;
+    int l= 0;
+    while(l < TemperatureHistory::levels - 1 && seconds > TemperatureHistory::size * TemperatureHistory::resolution(l)) l++;
+
+    int res= TemperatureHistory::resolution(l);
+    int first= seconds / res;
+    if(first > this->history->count(l)) first= this->history->count(l);
+    int last= end / res;
+    int n= first > last ? first - last : 0;
+
+    stream->printf("%s(S%d) R%d E%d N%d\n", this->designator.c_str(), this->pool_index, res, last * res, n);
+    for (int i = 0; i < n; ++i) {
+        const TemperatureHistory::Sample &s= this->history->get(l, first - 1 - i);
+        stream->printf("%d,%d,%d%c", s.actual, s.target, s.pwm, (i % 10 == 9 || i == n - 1) ? '\n' : ' ');
+    }
 }
@@ -11,8 +11,14 @@
 #include "Module.h"
 #include "Pwm.h"
 #include "TempSensor.h"
+#include "TemperatureHistory.h"
 #include "TemperatureControlPublicAccess.h"
 
+#include <vector>
+#include <utility>
+
+class StreamOutput;
+
 class TemperatureControl : public Module {
 
     public:
@@ -27,6 +33,7 @@ class TemperatureControl : public Module {
         void on_set_public_data(void* argument);
         void on_halt(void* argument);
         void on_idle(void* argument);
+        void on_config_reload(void* argument);
 
         void set_desired_temperature(float desired_temperature);
 
@@ -34,14 +41,22 @@ class TemperatureControl : public Module {
 
 
         friend class PID_Autotuner;
+        friend class TemperatureScheduler;
 
     private:
         void load_config();
+        void set_readings_per_second(float rps);
         uint32_t thermistor_read_tick(uint32_t dummy);
         void pid_process(float);
+        void write_heater(int pwm);
+        float feedforward(float t);
+        void print_history(StreamOutput *stream, int seconds, int end);
         void setPIDp(float p);
         void setPIDi(float i);
         void setPIDd(float d);
+#ifdef TEMPERATURE_FIXED_PID
+        void load_fixed_pid();
+#endif
 
         int pool_index;
 
@@ -52,6 +67,7 @@ class TemperatureControl : public Module {
         float preset2;
 
         TempSensor *sensor;
+        TemperatureHistory *history;
         float i_max;
         int o;
         float last_reading;
@@ -60,6 +76,8 @@ class TemperatureControl : public Module {
 
         std::string designator;
 
+        // the watches on this controller and its bit in each
+        std::vector<std::pair<struct pad_temperature_watch*, uint32_t>> watches;
 
         float hysteresis;
         float iTerm;
@@ -70,8 +88,36 @@ class TemperatureControl : public Module {
         float d_factor;
         float PIDdt;
 
+        // thermal model, the rise above ambient in °C at full power and the lag before a change in power shows
+        float model_gain;
+        float model_dead_time;
+        float model_ambient;
+        float slope;
+
         float runaway_error_range;
 
+        // full power of the heater, 0 if it is not in the power budget
+        float power_watts;
+        uint8_t power_priority;
+
+#ifdef TEMPERATURE_FIXED_PID
+        // fixed point copy of the tuning above and the PID state, temperatures are Q8 °C and pwm is Q16
+        struct {
+            int32_t p;             // pwm per °C of error
+            int32_t i;             // pwm per °C of error per reading
+            int32_t d;             // pwm per °C change per reading
+            int32_t i_max;
+            int32_t iterm;
+            int32_t last_input;
+            int32_t rate;          // readings per second, Q16
+            int32_t slope;         // °C per second
+            int32_t alpha;         // slope smoothing, Q16
+            int32_t dead_time;     // seconds, Q16
+            int32_t ambient;
+            int32_t model_scale;   // pwm per °C above ambient, 0 without a model
+        } fixed;
+#endif
+
         enum RUNAWAY_TYPE {NOT_HEATING, HEATING_UP, COOLING_DOWN, TARGET_TEMPERATURE_REACHED};
 
         // pack these to save memory
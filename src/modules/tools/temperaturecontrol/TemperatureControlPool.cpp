@@ -10,6 +10,7 @@
 #include <math.h>
 using namespace std;
 #include <vector>
+#include <algorithm>
 #include "TemperatureControlPool.h"
 #include "TemperatureControl.h"
 #include "PID_Autotuner.h"
@@ -17,14 +18,26 @@ using namespace std;
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "TemperatureControlPublicAccess.h"
+#include "SlowTicker.h"
 
 #define enable_checksum              CHECKSUM("enable")
+#define heater_power_budget_checksum CHECKSUM("heater_power_budget")
+
+// heaters this close to their target get their power before the rest, they need little to hold it and the job is
+// waiting for them
+#define POWER_NEAR_TARGET 10.0F
+
+TemperatureScheduler *TemperatureScheduler::instance= nullptr;
 
 void TemperatureControlPool::load_tools()
 {
     vector<uint16_t> modules;
     THEKERNEL->config->get_module_list( &modules, temperature_control_checksum );
     int cnt = 0;
+
+    // the controllers add themselves to this as they load their config
+    TemperatureScheduler::instance= new TemperatureScheduler();
+    TemperatureScheduler::instance->set_power_budget(THEKERNEL->config->value(heater_power_budget_checksum)->by_default(0)->as_number());
     for( auto cs : modules ) {
         // If module is enabled
         if( THEKERNEL->config->value(temperature_control_checksum, cs, enable_checksum )->as_bool() ) {
@@ -35,7 +48,94 @@ void TemperatureControlPool::load_tools()
 
     // no need to create one of these if no heaters defined
     if(cnt > 0) {
+        TemperatureScheduler::instance->start();
         PID_Autotuner *pidtuner = new PID_Autotuner();
         THEKERNEL->add_module( pidtuner );
+    } else {
+        delete TemperatureScheduler::instance;
+        TemperatureScheduler::instance= nullptr;
+    }
+}
+
+// the dividers are not final until all are added, as a faster one may come later, so this only makes a first guess
+float TemperatureScheduler::add_sensor(TemperatureControl *controller, float readings_per_second)
+{
+    if(readings_per_second > max_read_rate) max_read_rate= readings_per_second;
+    sensors.push_back({controller, readings_per_second, 1, 1});
+    return readings_per_second;
+}
+
+bool TemperatureScheduler::add_heater(TemperatureControl *controller)
+{
+    if(power_budget <= 0 || controller->power_watts <= 0) return false;
+    heaters.push_back(controller);
+    return true;
+}
+
+void TemperatureScheduler::start()
+{
+    std::stable_sort(heaters.begin(), heaters.end(), [](const TemperatureControl *a, const TemperatureControl *b) { return a->power_priority < b->power_priority; });
+
+    if(!sensors.empty()) {
+        for(auto &s : sensors) {
+            s.divider= std::max(1L, lroundf(max_read_rate / s.rate));
+            s.countdown= s.divider;
+            s.obj->set_readings_per_second(max_read_rate / s.divider);
+        }
+        THEKERNEL->slow_ticker->attach(max_read_rate * sensors.size(), this, &TemperatureScheduler::read_tick);
+    }
+}
+
+// Bang bang heaters go first as they can only be all on or off, one is not turned on unless all of it fits. Then the
+// heaters near their target, then the rest, a power_priority at a time. When the heaters of one priority ask for more than
+// is left they are all scaled down by the same amount, so they all heat up together rather than one after another
+void TemperatureScheduler::share_power()
+{
+    float left= power_budget;
+    for(int pass= 0; pass < 3; pass++) {
+        for(size_t i= 0; i < heaters.size();) {
+            size_t end= i;
+            float want= 0;
+            while(end < heaters.size() && heaters[end]->power_priority == heaters[i]->power_priority) {
+                TemperatureControl *h= heaters[end++];
+                if(pass != pass_of(h)) continue;
+                float w= h->o * h->power_watts / 255.0F;
+                if(pass == 0) {
+                    bool on= w <= left;
+                    h->write_heater(on ? h->o : 0);
+                    if(on) left -= w;
+                } else {
+                    want += w;
+                }
+            }
+
+            if(want > 0) {
+                float scale= want > left ? left / want : 1.0F;
+                for(size_t j= i; j < end; j++) {
+                    TemperatureControl *h= heaters[j];
+                    if(pass == pass_of(h)) h->write_heater(h->o * scale);
+                }
+                left -= want * scale;
+            }
+            i= end;
+        }
+    }
+}
+
+int TemperatureScheduler::pass_of(const TemperatureControl *h)
+{
+    if(h->use_bangbang) return 0;
+    return h->target_temperature > 0 && h->last_reading >= h->target_temperature - POWER_NEAR_TARGET ? 1 : 2;
+}
+
+// called in the slow ticker ISR, reads the sensor whose turn it is
+uint32_t TemperatureScheduler::read_tick(uint32_t dummy)
+{
+    auto &s= sensors[slot];
+    if(++slot >= sensors.size()) slot= 0;
+    if(--s.countdown == 0) {
+        s.countdown= s.divider;
+        s.obj->thermistor_read_tick(0);
     }
+    return 0;
 }
@@ -9,12 +9,51 @@
 #define TEMPERATURECONTROLPOOL_H
 
 #include <vector>
+#include <stdint.h>
+
+class TemperatureControl;
 
 class TemperatureControlPool {
     public:
         void load_tools();
 };
 
+// All the TemperatureControls share one slow ticker hook for reading their sensors, it runs at the highest
+// readings_per_second times the number of sensors and reads one sensor per call in turn, so their readings
+// and PID updates are spread over the period instead of landing together.
+// The heater pwm is ticked by the hook shared by all the software Pwm outputs, see Pwm::attach().
+// With heater_power_budget it also shares the supply out between the heaters that have watts set, see share_power().
+class TemperatureScheduler {
+    public:
+        // returns the readings per second it will actually get, a whole fraction of the fastest
+        float add_sensor(TemperatureControl *controller, float readings_per_second);
+        void set_power_budget(float watts) { power_budget= watts; }
+        // false if there is no power budget
+        bool add_heater(TemperatureControl *controller);
+        void start();
+        // called in the read tick after a heater in the budget has worked out its pwm, sets all their outputs
+        void share_power();
+
+        static TemperatureScheduler *instance;
+
+    private:
+        uint32_t read_tick(uint32_t dummy);
+        static int pass_of(const TemperatureControl *h);
+
+        template<typename T> struct Entry {
+            T *obj;
+            float rate;
+            uint16_t divider;
+            uint16_t countdown;
+        };
+        std::vector<Entry<TemperatureControl>> sensors;
+        // the heaters in the budget by power_priority, lowest first
+        std::vector<TemperatureControl*> heaters;
+        float power_budget{0}; // watts, 0 is no budget
+        float max_read_rate{0};
+        size_t slot{0};
+};
+
 
 
 #endif
@@ -4,6 +4,7 @@
 #include "checksumm.h"
 
 #include <string>
+#include <stdint.h>
 
 // addresses used for public data access
 #define temperature_control_checksum      CHECKSUM("temperature_control")
@@ -14,6 +15,7 @@
 #define temperature_pwm_checksum          CHECKSUM("temperature_pwm")
 #define pool_index_checksum               CHECKSUM("pool_index")
 #define poll_controls_checksum            CHECKSUM("poll_controllers")
+#define watch_temperature_checksum        CHECKSUM("watch_temperature")
 
 struct pad_temperature {
     float current_temperature;
@@ -22,4 +24,13 @@ struct pad_temperature {
     uint16_t id;
     std::string designator;
 };
+
+// set with watch_temperature, every controller with the designator keeps its bit of above up to date as it takes each
+// reading, so whoever watches sees a crossing of the threshold without asking for the temperatures
+struct pad_temperature_watch {
+    float threshold;
+    volatile uint32_t above;
+    char designator;
+    uint8_t controllers; // how many bits are in use
+};
 #endif
@@ -0,0 +1,73 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TemperatureHistory.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const int resolutions[TemperatureHistory::levels]= {1, 10, 60};
+
+TemperatureHistory::TemperatureHistory()
+{
+    memset(rings, 0, sizeof(rings));
+}
+
+int TemperatureHistory::resolution(int l)
+{
+    return resolutions[l];
+}
+
+static int16_t tenths(float t)
+{
+    if(isinf(t) || isnan(t) || t > 3276.0F) return INT16_MAX;
+    if(t < -3276.0F) return -INT16_MAX;
+    return lroundf(t * 10.0F);
+}
+
+void TemperatureHistory::add(float actual, float target, int pwm)
+{
+    Sample s;
+    s.actual= tenths(actual);
+    s.target= target > 0 ? tenths(target) : 0;
+    s.pwm= pwm < 0 ? 0 : pwm > 255 ? 255 : pwm;
+    push(0, s);
+}
+
+void TemperatureHistory::push(int l, const Sample &s)
+{
+    Ring &r= rings[l];
+    r.samples[r.head]= s;
+    r.head= (r.head + 1) % size;
+    if(r.count < size) r.count++;
+
+    if(l + 1 >= levels) return;
+
+    // fold it into the next level
+    Ring &next= rings[l + 1];
+    if(next.n == 0 || abs(s.actual - s.target) > abs(next.extreme - s.target)) next.extreme= s.actual;
+    next.target_sum += s.target;
+    next.pwm_sum += s.pwm;
+    int ratio= resolutions[l + 1] / resolutions[l];
+    if(++next.n < ratio) return;
+
+    Sample a;
+    a.actual= next.extreme;
+    a.target= next.target_sum / ratio;
+    a.pwm= next.pwm_sum / ratio;
+    next.target_sum= 0;
+    next.pwm_sum= 0;
+    next.n= 0;
+    push(l + 1, a);
+}
+
+const TemperatureHistory::Sample& TemperatureHistory::get(int l, int n) const
+{
+    const Ring &r= rings[l];
+    return r.samples[(r.head + size - 1 - n) % size];
+}
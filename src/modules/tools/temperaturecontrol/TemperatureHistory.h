@@ -0,0 +1,58 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEMPERATUREHISTORY_H
+#define TEMPERATUREHISTORY_H
+
+#include <stdint.h>
+
+// Recent temperature, target and pwm of one heater, added once a second.
+// Three rings at 1, 10 and 60 seconds per sample, each sample of a coarser ring is the average of the
+// samples of the finer one it covers, except the temperature which keeps the one furthest from the target
+// so a spike that tripped the runaway check is still there after it has been averaged away.
+// Temperatures are kept in tenths of a degree to keep a sample at 6 bytes.
+class TemperatureHistory
+{
+public:
+    struct Sample {
+        int16_t actual; // 0.1°C
+        int16_t target; // 0.1°C, 0 when off
+        uint8_t pwm;
+    };
+
+    static const int levels= 3;
+    static const int size= 60; // samples per level
+
+    TemperatureHistory();
+
+    void add(float actual, float target, int pwm);
+
+    // seconds per sample at level l
+    static int resolution(int l);
+    // samples held at level l
+    int count(int l) const { return rings[l].count; }
+    // the sample n places back from the newest at level l, n must be < count(l)
+    const Sample& get(int l, int n) const;
+
+private:
+    struct Ring {
+        Sample samples[size];
+        uint8_t head;
+        uint8_t count;
+        // running sums of the samples that will make the next one of this ring
+        int32_t target_sum;
+        int16_t pwm_sum;
+        int16_t extreme;
+        uint8_t n;
+    };
+
+    void push(int l, const Sample &s);
+
+    Ring rings[levels];
+};
+
+#endif
@@ -9,7 +9,6 @@
 #define THERMISTOR_H
 
 #include "TempSensor.h"
-#include "RingBuffer.h"
 #include "Pin.h"
 
 #include <tuple>
@@ -36,7 +35,14 @@ class Thermistor : public TempSensor
     private:
         int new_thermistor_reading();
         float adc_value_to_temperature(uint32_t adc_value);
+        float calculate_temperature(uint32_t adc_value);
         void calc_jk();
+        void build_table();
+
+        // temperatures in 1/32 °C at log spaced adc values, lut_points per half of the adc range, see build_table
+        static const int lut_points= 73;
+        int16_t *lut;
+        uint32_t open_adc; // readings above this are an open circuit
 
         // Thermistor computation settings using beta, not used if using Steinhart-Hart
         float r0;
@@ -20,14 +20,17 @@
 #define spi_channel_checksum CHECKSUM("spi_channel")
 
 Max31855::Max31855() :
-    spi(nullptr)
+    bus(nullptr)
 {
     this->read_flag=true;
+    this->data_ready=false;
+    this->transaction.busy=false;
 }
 
 Max31855::~Max31855()
 {
-    delete spi;
+    // the interrupt must be done with it before it goes
+    while(this->transaction.busy) ;
 }
 
 // Get configuration from the config file
@@ -38,24 +41,24 @@ void Max31855::UpdateConfig(uint16_t module_checksum, uint16_t name_checksum)
     this->spi_cs_pin.set(true);
     this->spi_cs_pin.as_output();
 
-    // select which SPI channel to use
+    // select which SPI channel to use, the bus is shared with anything else on it
     int spi_channel = THEKERNEL->config->value(module_checksum, name_checksum, spi_channel_checksum)->by_default(0)->as_number();
-    PinName miso;
-    PinName mosi;
-    PinName sclk;
-    if(spi_channel == 0) {
-        // Channel 0
-        mosi=P0_18; miso=P0_17; sclk=P0_15;
-    } else {
-        // Channel 1
-        mosi=P0_9; miso=P0_8; sclk=P0_7;
-    }
-
-    delete spi;
-    spi = new mbed::SPI(mosi, miso, sclk);
+    while(this->transaction.busy) ;
+    bus = SPIBus::get(spi_channel == 0 ? 0 : 1);
+
+    // Spi settings: 1MHz, mode 0, the 16 bits are read as two bytes
+    bus->setup(device, &spi_cs_pin, 1000000, 0);
+    transaction.device = &device;
+    transaction.len = 2;
+    transaction.tx[0] = transaction.tx[1] = 0;
+    transaction.done = &Max31855::read_done;
+    transaction.arg = this;
+}
 
-    // Spi settings: 1MHz (default), 16 bits, mode 0 (default)
-    spi->format(16);
+// called from the SSP interrupt
+void Max31855::read_done(SPIBus::Transaction *t)
+{
+    static_cast<Max31855 *>(t->arg)->data_ready = true;
 }
 
 // returns an average of the last few temperature values we've read
@@ -68,28 +71,28 @@ float Max31855::get_temperature()
     if(readings.size()==0) return infinityf();
 
     float sum = 0;
-    for (int i=0; i<readings.size(); i++) {
-        sum += *readings.get_ref(i);
+    for (size_t i=0; i<readings.size(); i++) {
+        sum += readings.peek(i);
     }
 
     return sum / readings.size();
 }
 
-// ask the temperature sensor hardware for a value, store it in a buffer
+// ask the temperature sensor hardware for a value, store it in a buffer when it comes back
 void Max31855::on_idle()
 {
-    // this rate limits SPI access
-    if(!this->read_flag) return;
-
-    this->spi_cs_pin.set(false);
-    wait_us(1); // Must wait for first bit valid
+    if(!this->data_ready) {
+        // this rate limits SPI access, the read runs from the SSP interrupt and is picked up by a later call
+        if(this->read_flag && bus != nullptr && bus->queue(&transaction)) {
+            this->read_flag=false;
+        }
+        return;
+    }
+    this->data_ready=false;
 
-    // Read 16 bits (writing something as well is required by the api)
-    uint16_t data = spi->write(0);
-    //  Read next 16 bits (diagnostics)
-    //	uint16_t data2 = spi->write(0);
-
-    this->spi_cs_pin.set(true);
+    // 16 bits, MSB first
+    uint16_t data = (transaction.rx[0] << 8) | transaction.rx[1];
+    //  Reading 4 bytes would give the next 16 bits (diagnostics)
 
     float temperature;
 
@@ -112,16 +115,14 @@ void Max31855::on_idle()
         }
     }
 
-    if (readings.size() >= readings.capacity()) {
-        readings.delete_tail();
+    if (readings.full()) {
+        float oldest;
+        readings.pop(oldest);
     }
 
     // Discard occasional errors...
     if(!isinf(temperature))
     {
-        readings.push_back(temperature);
+        readings.push(temperature);
     }
-
-    // don't read again until get_temperature() is called
-    this->read_flag=false;
 }
@@ -11,8 +11,8 @@
 #include "TempSensor.h"
 #include <string>
 #include <libs/Pin.h>
-#include <mbed.h>
-#include "RingBuffer.h"
+#include "SPSCQueue.h"
+#include "SPIBus.h"
 
 class Max31855 : public TempSensor
 {
@@ -24,10 +24,15 @@ public:
     void on_idle();
 
 private:
+    static void read_done(SPIBus::Transaction *t);
+
     struct { bool read_flag:1; } ; //when true, the next call to on_idle will read a new temperature value
+    volatile bool data_ready; // set from the SSP interrupt when the transaction has the next reading
     Pin spi_cs_pin;
-    mbed::SPI *spi;
-    RingBuffer<float,16> readings;
+    SPIBus *bus;
+    SPIBus::Device device;
+    SPIBus::Transaction transaction;
+    SPSCQueue<float,16> readings;
 };
 
 #endif
@@ -49,6 +49,7 @@ TemperatureSwitch::TemperatureSwitch()
 TemperatureSwitch::~TemperatureSwitch()
 {
     THEKERNEL->unregister_for_event(ON_SECOND_TICK, this);
+    THEKERNEL->unregister_for_event(ON_IDLE, this);
     THEKERNEL->unregister_for_event(ON_GCODE_RECEIVED, this);
 }
 
@@ -119,24 +120,34 @@ TemperatureSwitch* TemperatureSwitch::load_config(uint16_t modcs)
 
     ts->temperatureswitch_switch_cs= get_checksum(switchname); // checksum of the switch to use
 
-    ts->temperatureswitch_threshold_temp = THEKERNEL->config->value(temperatureswitch_checksum, modcs, temperatureswitch_threshold_temp_checksum)->by_default(50.0f)->as_number();
+    // the temperature controls with our designator tell us when they cross the threshold as they read
+    ts->watch.threshold = THEKERNEL->config->value(temperatureswitch_checksum, modcs, temperatureswitch_threshold_temp_checksum)->by_default(50.0f)->as_number();
+    ts->watch.above = 0;
+    ts->watch.designator = designator;
+    ts->watch.controllers = 0;
+    if(!PublicData::set_value(temperature_control_checksum, watch_temperature_checksum, &ts->watch)) {
+        THEKERNEL->streams->printf("WARNING TEMPERATURESWITCH: no temperature control with designator %c\n", designator);
+        delete ts;
+        return nullptr;
+    }
 
-    // these are to tune the heatup and cooldown polling frequencies
+    // these are how long the switch stays on or off before it can change again
     ts->temperatureswitch_heatup_poll = THEKERNEL->config->value(temperatureswitch_checksum, modcs, temperatureswitch_heatup_poll_checksum)->by_default(15)->as_number();
     ts->temperatureswitch_cooldown_poll = THEKERNEL->config->value(temperatureswitch_checksum, modcs, temperatureswitch_cooldown_poll_checksum)->by_default(60)->as_number();
     ts->current_delay = ts->temperatureswitch_heatup_poll;
 
     // set initial state
     ts->current_state= NONE;
-    ts->second_counter = ts->current_delay; // do test immediately on first second_tick
+    ts->second_counter = ts->current_delay; // do test immediately
     // if not defined then always armed, otherwise start out disarmed
     ts->armed= (ts->arm_mcode == 0);
 
     // Register for events
     ts->register_for_event(ON_SECOND_TICK);
+    ts->register_for_event(ON_IDLE);
 
     if(ts->arm_mcode != 0) {
-        ts->register_for_event(ON_GCODE_RECEIVED);
+        ts->register_for_gcode('M', ts->arm_mcode);
     }
     return ts;
 }
@@ -150,21 +161,20 @@ void TemperatureSwitch::on_gcode_received(void *argument)
     }
 }
 
-// Called once a second but we only need to service on the cooldown and heatup poll intervals
+// counts how long the current state has been held
 void TemperatureSwitch::on_second_tick(void *argument)
 {
-    second_counter++;
-    if (second_counter < current_delay) return;
-
-    second_counter = 0;
-    float current_temp = this->get_highest_temperature();
+    if (second_counter < current_delay) second_counter++;
+}
 
-    if (current_temp >= this->temperatureswitch_threshold_temp) {
-        set_state(HIGH_TEMP);
+// the watch is up to date with every reading so a crossing is acted on as soon as the state has been held long enough
+void TemperatureSwitch::on_idle(void *argument)
+{
+    STATE state = (this->watch.above != 0) ? HIGH_TEMP : LOW_TEMP;
+    if (state == this->current_state || second_counter < current_delay) return;
 
-    } else {
-        set_state(LOW_TEMP);
-   }
+    second_counter = 0;
+    set_state(state);
 }
 
 void TemperatureSwitch::set_state(STATE state)
@@ -193,25 +203,6 @@ void TemperatureSwitch::set_state(STATE state)
     this->current_state= state;
 }
 
-// Get the highest temperature from the set of temperature controllers
-float TemperatureSwitch::get_highest_temperature()
-{
-    float high_temp = 0.0;
-
-    std::vector<struct pad_temperature> controllers;
-    bool ok = PublicData::get_value(temperature_control_checksum, poll_controls_checksum, &controllers);
-    if (ok) {
-        for (auto &c : controllers) {
-            // check if this controller's temp is the highest and save it if so
-            if (c.designator[0] == this->designator && c.current_temperature > high_temp) {
-                high_temp = c.current_temperature;
-            }
-        }
-    }
-
-    return high_temp;
-}
-
 // Turn the switch on (true) or off (false)
 void TemperatureSwitch::set_switch(bool switch_state)
 {
@@ -19,6 +19,7 @@ Author: Michael Hackney, mhackney@eclecticangler.com
 using namespace std;
 
 #include "libs/Module.h"
+#include "TemperatureControlPublicAccess.h"
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@ class TemperatureSwitch : public Module
         ~TemperatureSwitch();
         void on_module_loaded();
         void on_second_tick(void *argument);
+        void on_idle(void *argument);
         void on_gcode_received(void *argument);
         TemperatureSwitch* load_config(uint16_t modcs);
 
@@ -38,33 +40,30 @@ class TemperatureSwitch : public Module
         enum TRIGGER_TYPE {LEVEL, RISING, FALLING};
         enum STATE {NONE, HIGH_TEMP, LOW_TEMP};
 
-        // get the highest temperature from the set of configured temperature controllers
-        float get_highest_temperature();
-
         // turn the switch on or off
         void set_switch(bool cooler_state);
 
         // temperature has changed state
         void set_state(STATE state);
 
-        // temperatureswitch.hotend.threshold_temp
-        float temperatureswitch_threshold_temp;
+        // the temperature controllers with the designator keep this up to date against temperatureswitch.hotend.threshold_temp
+        struct pad_temperature_watch watch;
 
         // temperatureswitch.hotend.switch
         uint16_t temperatureswitch_switch_cs;
 
-        // check temps on heatup every X seconds
+        // stay low for at least X seconds before switching again
         // this can be set in config: temperatureswitch.hotend.heatup_poll
         uint16_t temperatureswitch_heatup_poll;
 
-        // check temps on cooldown every X seconds
+        // stay high for at least X seconds before switching again
         // this can be set in config: temperatureswitch.hotend.cooldown_poll
         uint16_t temperatureswitch_cooldown_poll;
 
-        // our internal second counter
+        // seconds since the state last changed, up to current_delay
         uint16_t second_counter;
 
-        // we are delaying for this many seconds
+        // the state is held for this many seconds
         uint16_t current_delay;
 
         // the mcode that will arm the switch, 0 means always armed
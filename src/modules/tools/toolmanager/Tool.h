@@ -10,6 +10,7 @@
 #include "Module.h"
 
 #include <stdint.h>
+#include <string>
 
 class Tool : public Module
 {
@@ -22,8 +23,14 @@ public:
     virtual const float *get_offset() const { return offset; }
     virtual uint16_t get_name() const { return identifier; }
 
+    // | separated commands run when the tool is switched to and from, they are planned with the moves around them
+    const std::string& get_select_gcode() const { return select_gcode; }
+    const std::string& get_deselect_gcode() const { return deselect_gcode; }
+
 protected:
     float offset[3];
     uint16_t identifier;
+    std::string select_gcode;
+    std::string deselect_gcode;
 };
 
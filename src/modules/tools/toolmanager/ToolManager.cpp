@@ -36,8 +36,8 @@ void ToolManager::on_module_loaded()
 {
 
     this->register_for_event(ON_GCODE_RECEIVED);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_get(tool_manager_checksum, this);
+    PublicData::register_set(tool_manager_checksum, this);
 }
 
 void ToolManager::on_gcode_received(void *argument)
@@ -54,8 +54,13 @@ void ToolManager::on_gcode_received(void *argument)
 
         } else {
             if(new_tool != this->active_tool) {
-                // We must wait for an empty queue before we can disable the current extruder
-                THEKERNEL->conveyor->wait_for_idle();
+                // the old tool parks while it is still selected so a G10 in it retracts its own extruder
+                run_gcode(this->tools[active_tool]->get_deselect_gcode());
+
+                // which extruder is selected only matters to moves as they are planned, so this does not wait for the
+                // queue to empty, just for the robot to queue what it has left of the last move. Anything in the
+                // sequences that changes a temperature or a switch synchronises itself
+                THEROBOT->finish_pending_moves();
                 this->tools[active_tool]->deselect();
                 this->active_tool = new_tool;
                 this->current_tool_name = this->tools[active_tool]->get_name();
@@ -64,6 +69,9 @@ void ToolManager::on_gcode_received(void *argument)
                 //send new_tool_offsets to robot
                 const float *new_tool_offset = tools[new_tool]->get_offset();
                 THEROBOT->setToolOffset(new_tool_offset);
+
+                // moves to the new offset and primes
+                run_gcode(this->tools[active_tool]->get_select_gcode());
             }
         }
     }
@@ -111,6 +119,21 @@ void ToolManager::on_set_public_data(void* argument)
     //pdr->set_taken();
 }
 
+// run each of the | separated commands as if it had been sent, the moves are planned and blend with the ones around them
+void ToolManager::run_gcode(const string& commands)
+{
+    size_t pos = 0;
+    while(pos < commands.size()) {
+        size_t end = commands.find('|', pos);
+        if(end == string::npos) end = commands.size();
+        if(end > pos) {
+            Gcode gc(commands.substr(pos, end - pos), &(StreamOutput::NullStream));
+            THEKERNEL->call_event(ON_GCODE_RECEIVED, &gc);
+        }
+        pos = end + 1;
+    }
+}
+
 // Add a tool to the tool list
 void ToolManager::add_tool(Tool* tool_to_add)
 {
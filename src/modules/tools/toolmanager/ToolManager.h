@@ -10,6 +10,7 @@
 
 using namespace std;
 #include <vector>
+#include <string>
 
 class Tool;
 
@@ -26,6 +27,8 @@ public:
     int get_active_tool() const { return active_tool; }
 
 private:
+    void run_gcode(const string& commands);
+
     vector<Tool *> tools;
 
     int active_tool;
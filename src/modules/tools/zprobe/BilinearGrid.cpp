@@ -0,0 +1,108 @@
+#include "BilinearGrid.h"
+
+#include "platform_memory.h"
+
+#include <math.h>
+#include <algorithm>
+#include <stdlib.h>
+
+BilinearGrid::BilinearGrid()
+{
+    grid = nullptr;
+    cells = nullptr;
+    cells_in_ahb0 = false;
+    cells_x = cells_y = 0;
+}
+
+BilinearGrid::~BilinearGrid()
+{
+    free_cells();
+}
+
+void BilinearGrid::free_cells()
+{
+    if(cells == nullptr) return;
+    if(cells_in_ahb0) AHB0.dealloc(cells);
+    else free(cells);
+    cells = nullptr;
+}
+
+// allocate room for any grid of up to max_points points, four coefficients per cell.
+// The grid shape may change at probe time, so it is sized for the shape with up to max_points points that has the
+// most cells. It goes in AHB0 with the grid if there is room, otherwise on the heap, and if neither has room the offsets
+// are interpolated from the grid itself, so any grid that fits still works
+void BilinearGrid::allocate(uint16_t max_points)
+{
+    free_cells();
+
+    uint32_t max_cells = 0;
+    for (uint32_t nx = 2; nx <= 255 && nx * 2 <= max_points; nx++) {
+        uint32_t ny = max_points / nx;
+        if(ny > 255) ny = 255;
+        max_cells = std::max(max_cells, (nx - 1) * (ny - 1));
+    }
+    if(max_cells == 0) max_cells = 1;
+
+    size_t n = max_cells * 4;
+    cells = (float *)AHB0.alloc(n * sizeof(float));
+    cells_in_ahb0 = cells != nullptr;
+    if(cells == nullptr) cells = (float *)malloc(n * sizeof(float));
+}
+
+// grid is nx by ny points in row major order (x changes fastest), the first point is at x_start,y_start and
+// the last at x_start+x_size,y_start+y_size, sizes may be negative
+void BilinearGrid::build(const float *grid, uint8_t nx, uint8_t ny, float x_start, float y_start, float x_size, float y_size)
+{
+    this->grid = grid;
+    this->x_start = x_start;
+    this->y_start = y_start;
+    cells_x = nx - 1;
+    cells_y = ny - 1;
+    x_scale = cells_x / x_size;
+    y_scale = cells_y / y_size;
+    max_gx = cells_x;
+    max_gy = cells_y;
+    if(cells == nullptr) return;
+
+    float *c = cells;
+    for (int y = 0; y < cells_y; y++) {
+        for (int x = 0; x < cells_x; x++) {
+            float z1 = grid[x + (y * nx)];
+            float z2 = grid[x + ((y + 1) * nx)];
+            float z3 = grid[(x + 1) + (y * nx)];
+            float z4 = grid[(x + 1) + ((y + 1) * nx)];
+            *c++ = z1;
+            *c++ = z3 - z1;
+            *c++ = z2 - z1;
+            *c++ = z4 - z3 - z2 + z1;
+        }
+    }
+}
+
+// points outside the grid get the offset of the closest point on its edge
+float BilinearGrid::get_offset(float x, float y) const
+{
+    float gx = (x - x_start) * x_scale;
+    float gy = (y - y_start) * y_scale;
+    if(gx < 0) gx = 0; else if(gx > max_gx) gx = max_gx;
+    if(gy < 0) gy = 0; else if(gy > max_gy) gy = max_gy;
+
+    int ix = (int)gx; // gx is never negative here so this is floor
+    int iy = (int)gy;
+    if(ix >= cells_x) ix = cells_x - 1;
+    if(iy >= cells_y) iy = cells_y - 1;
+    float rx = gx - ix;
+    float ry = gy - iy;
+
+    if(cells == nullptr) {
+        int nx = cells_x + 1;
+        float z1 = grid[ix + (iy * nx)];
+        float z2 = grid[ix + ((iy + 1) * nx)];
+        float z3 = grid[(ix + 1) + (iy * nx)];
+        float z4 = grid[(ix + 1) + ((iy + 1) * nx)];
+        return z1 + rx * (z3 - z1 + (z4 - z3 - z2 + z1) * ry) + (z2 - z1) * ry;
+    }
+
+    const float *c = &cells[(ix + (iy * cells_x)) * 4];
+    return c[0] + rx * (c[1] + c[3] * ry) + c[2] * ry;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+// Precomputed bilinear interpolation over a rectangular grid of probed heights.
+// Each cell is stored as z = a + b*rx + c*ry + d*rx*ry where rx, ry are the 0..1 position within the cell,
+// so a lookup is one multiply per axis to find the cell, no divides, and three multiply-adds.
+// build() must be called whenever the grid it was built from changes. If there is no room for the cells it interpolates
+// from the grid, which must then stay valid.
+class BilinearGrid
+{
+public:
+    BilinearGrid();
+    ~BilinearGrid();
+
+    void allocate(uint16_t max_points);
+    void build(const float *grid, uint8_t nx, uint8_t ny, float x_start, float y_start, float x_size, float y_size);
+    float get_offset(float x, float y) const;
+
+private:
+    void free_cells();
+
+    const float *grid;
+    float *cells;
+    bool cells_in_ahb0;
+    float x_start, y_start;
+    float x_scale, y_scale; // reciprocal of the cell size
+    float max_gx, max_gy;
+    uint8_t cells_x, cells_y;
+};
@@ -64,6 +64,8 @@
     M374 Save grid to /sd/cartesian.grid
     M374.1 delete /sd/cartesian.grid
     M375 Load the grid from /sd/cartesian.grid and enable compensation
+    M374, M374.1 and M375 take Pn to use one of several saved grids, /sd/cartesian-n.grid, so each bed or fixture can
+    have its own. The grid last saved or loaded is the one M500 loads on boot
     M375.1 display the current grid
     M561 clears the grid and turns off compensation
     M565 defines the probe offsets from the nozzle or tool head
@@ -89,6 +91,7 @@
 #include "nuts_bolts.h"
 #include "utils.h"
 #include "platform_memory.h"
+#include "GridFile.h"
 
 #include <string>
 #include <algorithm>
@@ -111,12 +114,12 @@
 #define height_limit_checksum      CHECKSUM("height_limit") 
 #define dampening_start_checksum      CHECKSUM("dampening_start")
 
-#define GRIDFILE "/sd/cartesian.grid"
-#define GRIDFILE_NM "/sd/cartesian_nm.grid"
+#define GRIDFILE "cartesian"
 
 CartGridStrategy::CartGridStrategy(ZProbe *zprobe) : LevelingStrategy(zprobe)
 {
     grid = nullptr;
+    grid_slot = 0;
 }
 
 CartGridStrategy::~CartGridStrategy()
@@ -174,13 +177,14 @@ bool CartGridStrategy::handleConfig()
         THEKERNEL->streams->printf("Error: Not enough memory\n");
         return false;
     }
+    compensation.allocate(configured_grid_x_size * configured_grid_y_size);
 
     reset_bed_level();
 
     return true;
 }
 
-void CartGridStrategy::save_grid(StreamOutput *stream)
+void CartGridStrategy::save_grid(StreamOutput *stream, uint8_t slot)
 {
     if(only_by_two_corners){
         stream->printf("error:Unable to save grid in only_by_two_corners mode\n");
@@ -197,125 +201,44 @@ void CartGridStrategy::save_grid(StreamOutput *stream)
         return;
     }
 
-    FILE *fp = (configured_grid_x_size == configured_grid_y_size)?fopen(GRIDFILE, "w"):fopen(GRIDFILE_NM, "w");
-    if(fp == NULL) {
-        stream->printf("error:Failed to open grid file %s\n", GRIDFILE);
-        return;
-    }
-    uint8_t tmp_configured_grid_size = configured_grid_x_size;
-    if(fwrite(&tmp_configured_grid_size, sizeof(uint8_t), 1, fp) != 1) {
-        stream->printf("error:Failed to write grid x size\n");
-        fclose(fp);
-        return;
-    }
-
-    tmp_configured_grid_size = configured_grid_y_size;
-    if(configured_grid_y_size != configured_grid_x_size){
-        if(fwrite(&tmp_configured_grid_size, sizeof(uint8_t), 1, fp) != 1) {
-            stream->printf("error:Failed to write grid y size\n");
-            fclose(fp);
-            return;
-        }
-    }
-
-    if(fwrite(&x_size, sizeof(float), 1, fp) != 1)  {
-        stream->printf("error:Failed to write x_size\n");
-        fclose(fp);
-        return;
-    }
-
-    if(fwrite(&y_size, sizeof(float), 1, fp) != 1)  {
-        stream->printf("error:Failed to write y_size\n");
-        fclose(fp);
-        return;
-    }
-
-    for (int y = 0; y < configured_grid_y_size; y++) {
-        for (int x = 0; x < configured_grid_x_size; x++) {
-            if(fwrite(&grid[x + (configured_grid_x_size * y)], sizeof(float), 1, fp) != 1) {
-                stream->printf("error:Failed to write grid\n");
-                fclose(fp);
-                return;
-            }
-        }
-    }
-    stream->printf("grid saved to %s\n", GRIDFILE);
-    fclose(fp);
+    // the file is made up in RAM and written from idle in one go
+    float bounds[4] = {x_start, y_start, x_size, y_size};
+    std::string fn = GridFile::filename(GRIDFILE, slot);
+    GridFile::save(fn, configured_grid_x_size, configured_grid_y_size, bounds, grid);
+    grid_slot = slot;
+    stream->printf("grid saved to %s\n", fn.c_str());
 }
 
-bool CartGridStrategy::load_grid(StreamOutput *stream)
+bool CartGridStrategy::load_grid(StreamOutput *stream, uint8_t slot)
 {
     if(only_by_two_corners){
         stream->printf("error:Unable to load grid in only_by_two_corners mode\n");
         return false;
     }
 
-    FILE *fp = (configured_grid_x_size == configured_grid_y_size)?fopen(GRIDFILE, "r"):fopen(GRIDFILE_NM, "r");
-    if(fp == NULL) {
-        stream->printf("error:Failed to open grid %s\n", GRIDFILE);
-        return false;
-    }
-
-    uint8_t load_grid_x_size, load_grid_y_size;
-    float x, y;
-
-    if(fread(&load_grid_x_size, sizeof(uint8_t), 1, fp) != 1) {
-        stream->printf("error:Failed to read grid size\n");
-        fclose(fp);
-        return false;
-    }
-
-    if(load_grid_x_size != configured_grid_x_size) {
-        stream->printf("error:grid size x is different read %d - config %d\n", load_grid_x_size, configured_grid_x_size);
-        fclose(fp);
-        return false;
-    }
-
-    load_grid_y_size = load_grid_x_size;
+    GridFile gf;
+    if(!gf.open(GridFile::filename(GRIDFILE, slot), stream)) return false;
 
-    if(configured_grid_x_size != configured_grid_y_size){
-        if(fread(&load_grid_y_size, sizeof(uint8_t), 1, fp) != 1) {
-            stream->printf("error:Failed to read grid size\n");
-            fclose(fp);
-            return false;
-        }
-
-        if(load_grid_y_size != configured_grid_y_size) {
-            stream->printf("error:grid size y is different read %d - config %d\n", load_grid_y_size, configured_grid_x_size);
-            fclose(fp);
-            return false;
-        }
-    }
-
-    if(fread(&x, sizeof(float), 1, fp) != 1) {
-        stream->printf("error:Failed to read grid x size\n");
-        fclose(fp);
+    const GridFile::header_t &h = gf.get_header();
+    if(h.x_points != configured_grid_x_size || h.y_points != configured_grid_y_size) {
+        stream->printf("error:grid size is different read %d x %d - config %d x %d\n", h.x_points, h.y_points, configured_grid_x_size, configured_grid_y_size);
         return false;
     }
 
-    if(fread(&y, sizeof(float), 1, fp) != 1) {
-        stream->printf("error:Failed to read grid y size\n");
-        fclose(fp);
+    if(h.bounds[2] != x_size || h.bounds[3] != y_size) {
+        stream->printf("error:bed dimensions changed read (%f, %f) - config (%f,%f)\n", h.bounds[2], h.bounds[3], x_size, y_size);
         return false;
     }
 
-    if(x != x_size || y != y_size) {
-        stream->printf("error:bed dimensions changed read (%f, %f) - config (%f,%f)\n", x, y, x_size, y_size);
-        fclose(fp);
+    // this replaces the grid, if it fails there is no grid
+    if(!gf.read(grid, stream)) {
+        setAdjustFunction(false);
+        reset_bed_level();
         return false;
     }
 
-    for (int y = 0; y < configured_grid_y_size; y++) {
-        for (int x = 0; x < configured_grid_x_size; x++) {
-            if(fread(&grid[x + (configured_grid_x_size * y)], sizeof(float), 1, fp) != 1) {
-                stream->printf("error:Failed to read grid\n");
-                fclose(fp);
-                return false;
-            }
-        }
-    }
-    stream->printf("grid loaded, grid: (%f, %f), size: %d x %d\n", x_size, y_size, load_grid_x_size, load_grid_y_size);
-    fclose(fp);
+    grid_slot = slot;
+    stream->printf("grid loaded, grid: (%f, %f), size: %d x %d\n", x_size, y_size, h.x_points, h.y_points);
     return true;
 }
 
@@ -331,18 +254,23 @@ bool CartGridStrategy::probe_grid(int n, int m, float _x_start, float _y_start,
 
     float x_step = _x_size / n;
     float y_step = _y_size / m;
+    float row[n];
     for (int c = 0; c < m; ++c) {
         float y = _y_start + y_step * c;
-        for (int r = 0; r < n; ++r) {
+        // every other row is done backwards so it never goes back across the bed
+        for (int i = 0; i < n; ++i) {
+            int r = (c % 2) ? n - 1 - i : i;
             float x = _x_start + x_step * r;
-            float z = 0.0F;
             float mm;
-            if(!zprobe->doProbeAt(mm, x, y)) return false;
-            z = zprobe->getProbeHeight() - mm;
-            stream->printf("%1.4f ", z);
+            if(!zprobe->doProbeAt(mm, x, y, true)) return false;
+            row[r] = zprobe->getProbeHeight() - mm;
+        }
+        for (int r = 0; r < n; ++r) {
+            stream->printf("%1.4f ", row[r]);
         }
         stream->printf("\n");
     }
+    THEKERNEL->conveyor->wait_for_idle();
     return true;
 }
 
@@ -398,21 +326,24 @@ bool CartGridStrategy::handleGcode(Gcode *gcode)
             gcode->stream->printf("grid cleared and disabled\n");
             return true;
 
-        } else if(gcode->m == 374) { // M374: Save grid, M374.1: delete saved grid
+        } else if(gcode->m == 374) { // M374: Save grid, M374.1: delete saved grid, Pn picks the slot
+            uint8_t slot = gcode->has_letter('P') ? gcode->get_value('P') : 0;
             if(gcode->subcode == 1) {
-                remove(GRIDFILE);
-                gcode->stream->printf("%s deleted\n", GRIDFILE);
+                std::string fn = GridFile::filename(GRIDFILE, slot);
+                remove(fn.c_str());
+                gcode->stream->printf("%s deleted\n", fn.c_str());
             } else {
-                save_grid(gcode->stream);
+                save_grid(gcode->stream, slot);
             }
 
             return true;
 
-        } else if(gcode->m == 375) { // M375: load grid, M375.1 display grid
+        } else if(gcode->m == 375) { // M375: load grid, M375.1 display grid, Pn picks the slot
             if(gcode->subcode == 1) {
                 print_bed_level(gcode->stream);
             } else {
-                if(load_grid(gcode->stream)) setAdjustFunction(true);
+                uint8_t slot = gcode->has_letter('P') ? gcode->get_value('P') : 0;
+                if(load_grid(gcode->stream, slot)) setAdjustFunction(true);
             }
             return true;
 
@@ -429,7 +360,10 @@ bool CartGridStrategy::handleGcode(Gcode *gcode)
             std::tie(x, y, z) = probe_offsets;
             gcode->stream->printf(";Probe offsets:\nM565 X%1.5f Y%1.5f Z%1.5f\n", x, y, z);
             if(save) {
-                if(!isnan(grid[0])) gcode->stream->printf(";Load saved grid\nM375\n");
+                if(!isnan(grid[0])) {
+                    if(grid_slot == 0) gcode->stream->printf(";Load saved grid\nM375\n");
+                    else gcode->stream->printf(";Load saved grid\nM375 P%d\n", grid_slot);
+                }
                 else if(gcode->m == 503) gcode->stream->printf(";WARNING No grid to save\n");
             }
             return true;
@@ -446,6 +380,9 @@ bool CartGridStrategy::handleGcode(Gcode *gcode)
 void CartGridStrategy::setAdjustFunction(bool on)
 {
     if(on) {
+        // precompute the cell coefficients from the current grid
+        compensation.build(grid, current_grid_x_size, current_grid_y_size, x_start, y_start, x_size, y_size);
+
         // set the compensationTransform in robot
         using std::placeholders::_1;
         using std::placeholders::_2;
@@ -537,12 +474,13 @@ bool CartGridStrategy::doProbe(Gcode *gc)
         for (int xCount = xStart; xCount != xStop; xCount += xInc) {
             float xProbe = this->x_start + (this->x_size / (this->current_grid_x_size - 1)) * xCount;
 
-            if(!zprobe->doProbeAt(mm, xProbe - X_PROBE_OFFSET_FROM_EXTRUDER, yProbe - Y_PROBE_OFFSET_FROM_EXTRUDER)) return false;
+            if(!zprobe->doProbeAt(mm, xProbe - X_PROBE_OFFSET_FROM_EXTRUDER, yProbe - Y_PROBE_OFFSET_FROM_EXTRUDER, true)) return false;
             float measured_z = zprobe->getProbeHeight() - mm - z_reference; // this is the delta z from bed at 0,0
             gc->stream->printf("DEBUG: X%1.4f, Y%1.4f, Z%1.4f\n", xProbe, yProbe, measured_z);
             grid[xCount + (this->current_grid_x_size * yCount)] = measured_z;
         }
     }
+    THEKERNEL->conveyor->wait_for_idle();
 
     print_bed_level(gc->stream);
 
@@ -553,32 +491,6 @@ bool CartGridStrategy::doProbe(Gcode *gc)
 
 void CartGridStrategy::doCompensation(float *target, bool inverse)
 {
-    // Adjust print surface height by linear interpolation over the bed_level array.
-
-    // find min/maxes, and handle the case where size is negative (assuming this is possible? Legacy code supported this)
-    float min_x = std::min(this->x_start, this->x_start + this->x_size);
-    float max_x = std::max(this->x_start, this->x_start + this->x_size);
-    float min_y = std::min(this->y_start, this->y_start + this->y_size);
-    float max_y = std::max(this->y_start, this->y_start + this->y_size);
-
-    // clamp the input to the bounds of the compensation grid
-    // if a point is beyond the bounds of the grid, it will get the offset of the closest grid point
-    float x_target = std::min(std::max(target[X_AXIS], min_x), max_x);
-    float y_target = std::min(std::max(target[Y_AXIS], min_y), max_y);
-
-    float grid_x = std::max(0.001F, (x_target - this->x_start) / (this->x_size / (this->current_grid_x_size - 1)));
-    float grid_y = std::max(0.001F, (y_target - this->y_start) / (this->y_size / (this->current_grid_y_size - 1)));
-    int floor_x = floorf(grid_x);
-    int floor_y = floorf(grid_y);
-    float ratio_x = grid_x - floor_x;
-    float ratio_y = grid_y - floor_y;
-    float z1 = grid[(floor_x) + ((floor_y) * this->current_grid_x_size)];
-    float z2 = grid[(floor_x) + ((floor_y + 1) * this->current_grid_x_size)];
-    float z3 = grid[(floor_x + 1) + ((floor_y) * this->current_grid_x_size)];
-    float z4 = grid[(floor_x + 1) + ((floor_y + 1) * this->current_grid_x_size)];
-    float left = (1 - ratio_y) * z1 + ratio_y * z2;
-    float right = (1 - ratio_y) * z3 + ratio_y * z4;
-    float offset = (1 - ratio_x) * left + ratio_x * right;
     // offset scale: 1 for default (use offset as is)
     float scale = 1.0;
 
@@ -586,40 +498,23 @@ void CartGridStrategy::doCompensation(float *target, bool inverse)
         // first let's find out our 'world coordinate' positions for checking the limits:
         Robot::wcs_t world_coordinates = THEROBOT->mcs2wcs(THEROBOT->get_axis_position());
         float current_z = std::get<Z_AXIS>(world_coordinates); // no need to convert to mm, if machine is in inches; so is config!
-        // THEKERNEL->streams->printf("//DEBUG: Current Z: %f\n", current_z);
-        // if the height is below our compensation limit:
-        if(current_z <= this->height_limit) {
-            // scale the offset as necessary:
-            if( current_z >= this->dampening_start) {
-                scale = ( 1- ( (current_z - this->dampening_start ) / this->damping_interval) );
-            } // else leave scale at 1.0;
-        } else {
-            scale = 0.0; // if Z is higher than max, no compensation
-        }
+        // if Z is higher than max, no compensation so do not bother looking up the grid
+        if(current_z > this->height_limit) return;
+        // scale the offset as necessary:
+        if( current_z >= this->dampening_start) {
+            scale = ( 1- ( (current_z - this->dampening_start ) / this->damping_interval) );
+        } // else leave scale at 1.0;
     }
 
+    // Adjust print surface height by bilinear interpolation over the precomputed bed_level cells.
+    // if a point is beyond the bounds of the grid, it will get the offset of the closest grid point
+    float offset = compensation.get_offset(target[X_AXIS], target[Y_AXIS]) * scale;
+
     if (inverse) {
-        target[Z_AXIS] -= offset * scale;
+        target[Z_AXIS] -= offset;
     } else {
-        target[Z_AXIS] += offset * scale;
+        target[Z_AXIS] += offset;
     }
-
-    /*THEKERNEL->streams->printf("//DEBUG: TARGET: %f, %f, %f\n", target[0], target[1], target[2]);
-     THEKERNEL->streams->printf("//DEBUG: grid_x= %f\n", grid_x);
-     THEKERNEL->streams->printf("//DEBUG: grid_y= %f\n", grid_y);
-     THEKERNEL->streams->printf("//DEBUG: floor_x= %d\n", floor_x);
-     THEKERNEL->streams->printf("//DEBUG: floor_y= %d\n", floor_y);
-     THEKERNEL->streams->printf("//DEBUG: ratio_x= %f\n", ratio_x);
-     THEKERNEL->streams->printf("//DEBUG: ratio_y= %f\n", ratio_y);
-     THEKERNEL->streams->printf("//DEBUG: z1= %f\n", z1);
-     THEKERNEL->streams->printf("//DEBUG: z2= %f\n", z2);
-     THEKERNEL->streams->printf("//DEBUG: z3= %f\n", z3);
-     THEKERNEL->streams->printf("//DEBUG: z4= %f\n", z4);
-     THEKERNEL->streams->printf("//DEBUG: left= %f\n", left);
-     THEKERNEL->streams->printf("//DEBUG: right= %f\n", right);
-     THEKERNEL->streams->printf("//DEBUG: offset= %f\n", offset);
-     THEKERNEL->streams->printf("//DEBUG: scale= %f\n", scale);
-     */
 }
 
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "LevelingStrategy.h"
+#include "BilinearGrid.h"
 
 #include <string.h>
 #include <tuple>
@@ -26,8 +27,8 @@ private:
     void print_bed_level(StreamOutput *stream);
     void doCompensation(float *target, bool inverse);
     void reset_bed_level();
-    void save_grid(StreamOutput *stream);
-    bool load_grid(StreamOutput *stream);
+    void save_grid(StreamOutput *stream, uint8_t slot);
+    bool load_grid(StreamOutput *stream, uint8_t slot);
     bool probe_grid(int n, int m, float _x_start, float _y_start, float _x_size, float _y_size, StreamOutput *stream);
 
     float initial_height;
@@ -38,6 +39,7 @@ private:
     float damping_interval;
 	
     float *grid;
+    BilinearGrid compensation;
     std::tuple<float, float, float> probe_offsets;
     float x_start,y_start;
     float x_size,y_size;
@@ -47,6 +49,7 @@ private:
         uint8_t configured_grid_y_size:8;
         uint8_t current_grid_x_size:8;
         uint8_t current_grid_y_size:8;
+        uint8_t grid_slot:8; // of the grid last saved or loaded
     };
 
     struct {
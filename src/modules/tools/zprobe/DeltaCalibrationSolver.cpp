@@ -0,0 +1,165 @@
+#include "DeltaCalibrationSolver.h"
+#include "Vector3.h"
+
+#include <cmath>
+#include <algorithm>
+
+#define PIOVER180 0.01745329251994329576923690768489F
+
+// how far each factor is moved to see how much the heights change with it, in mm or degrees
+#define FACTOR_STEP 0.1F
+// Gauss-Newton passes over the points, a couple is normally enough as the heights are close to linear in the factors
+#define MAX_PASSES 8
+// it has converged when no factor moves more than this in a pass
+#define CONVERGED 0.0001F
+
+// the towers are at the angles LinearDeltaSolution puts them at
+void DeltaCalibrationSolver::towers(const geometry_t& g, float tx[3], float ty[3])
+{
+    static const float base[3] {210.0F, 330.0F, 90.0F};
+    for (int i = 0; i < 3; ++i) {
+        float r = g.arm_radius + g.tower_offset[i];
+        float a = (base[i] + g.tower_angle[i]) * PIOVER180;
+        tx[i] = r * cosf(a);
+        ty[i] = r * sinf(a);
+    }
+}
+
+void DeltaCalibrationSolver::inverse(const geometry_t& g, float x, float y, float z, float carriage[3])
+{
+    float tx[3], ty[3];
+    towers(g, tx, ty);
+    for (int i = 0; i < 3; ++i) {
+        float dx = tx[i] - x, dy = ty[i] - y;
+        carriage[i] = z + sqrtf(g.arm_length * g.arm_length - dx * dx - dy * dy) + g.trim[i];
+    }
+}
+
+// the same as LinearDeltaSolution::actuator_to_cartesian without the rounding
+float DeltaCalibrationSolver::forward_z(const geometry_t& g, const float carriage[3])
+{
+    float tx[3], ty[3];
+    towers(g, tx, ty);
+    float h[3];
+    for (int i = 0; i < 3; ++i) h[i] = carriage[i] - g.trim[i];
+
+    Vector3 tower1(tx[0], ty[0], h[0]);
+    Vector3 tower2(tx[1], ty[1], h[1]);
+    Vector3 tower3(tx[2], ty[2], h[2]);
+
+    Vector3 s12 = tower1.sub(tower2);
+    Vector3 s23 = tower2.sub(tower3);
+    Vector3 s13 = tower1.sub(tower3);
+    Vector3 normal = s12.cross(s23);
+
+    float magsq_s12 = s12.magsq();
+    float magsq_s23 = s23.magsq();
+    float magsq_s13 = s13.magsq();
+
+    float inv_nmag_sq = 1.0F / normal.magsq();
+    float q = 0.5F * inv_nmag_sq;
+
+    float a = q * magsq_s23 * s12.dot(s13);
+    float b = q * magsq_s13 * s12.dot(s23) * -1.0F;
+    float c = q * magsq_s12 * s13.dot(s23);
+
+    float r_sq = 0.5F * q * magsq_s12 * magsq_s23 * magsq_s13;
+    float dist = sqrtf(inv_nmag_sq * (g.arm_length * g.arm_length - r_sq));
+
+    return h[0] * a + h[1] * b + h[2] * c - normal[2] * dist;
+}
+
+void DeltaCalibrationSolver::adjust(geometry_t& g, int factor, float by)
+{
+    switch(factor) {
+        case TRIM_X: g.trim[0] += by; break;
+        case TRIM_Y: g.trim[1] += by; break;
+        case TRIM_Z: g.trim[2] += by; break;
+        case RADIUS: g.arm_radius += by; break;
+        case ANGLE_X: g.tower_angle[0] += by; break;
+        case ANGLE_Y: g.tower_angle[1] += by; break;
+        case ARM_LENGTH: g.arm_length += by; break;
+    }
+}
+
+void DeltaCalibrationSolver::add_point(float x, float y, float z)
+{
+    point_t p;
+    inverse(current, x, y, z, p.carriage);
+    points.push_back(p);
+}
+
+/*
+    The carriages were where the probe touched the bed, which does not change whatever geometry they are worked out
+    with. The geometry that is right puts the nozzle at the same height for all of them, and as moving all three trims
+    together moves the nozzle by as much that height can be zero. So this finds the factors that make forward_z() zero
+    for every point, by least squares on the change in heights for a small change in each factor, a few times over as
+    they are not quite linear. Then the trims are moved together so the highest is zero, they can only be negative.
+*/
+bool DeltaCalibrationSolver::solve(int factors, geometry_t& result) const
+{
+    const size_t n = points.size();
+    if(factors < 1 || factors > MAX_FACTORS || n < (size_t)factors) return false;
+
+    geometry_t g = current;
+    std::vector<float> residuals(n);
+    std::vector<float> derivatives(n * factors);
+    bool converged = false;
+
+    for (int pass = 0; pass < MAX_PASSES && !converged; ++pass) {
+        for (size_t i = 0; i < n; ++i) {
+            residuals[i] = forward_z(g, points[i].carriage);
+        }
+        for (int f = 0; f < factors; ++f) {
+            geometry_t up = g, down = g;
+            adjust(up, f, FACTOR_STEP);
+            adjust(down, f, -FACTOR_STEP);
+            for (size_t i = 0; i < n; ++i) {
+                derivatives[i * factors + f] = (forward_z(up, points[i].carriage) - forward_z(down, points[i].carriage)) / (2 * FACTOR_STEP);
+            }
+        }
+
+        // the normal equations with the right hand side as the last column
+        float m[MAX_FACTORS][MAX_FACTORS + 1];
+        for (int r = 0; r < factors; ++r) {
+            for (int c = 0; c < factors; ++c) {
+                float sum = 0;
+                for (size_t i = 0; i < n; ++i) sum += derivatives[i * factors + r] * derivatives[i * factors + c];
+                m[r][c] = sum;
+            }
+            float sum = 0;
+            for (size_t i = 0; i < n; ++i) sum -= derivatives[i * factors + r] * residuals[i];
+            m[r][factors] = sum;
+        }
+
+        // Gauss-Jordan elimination with partial pivoting
+        for (int c = 0; c < factors; ++c) {
+            int pivot = c;
+            for (int r = c + 1; r < factors; ++r) {
+                if(fabsf(m[r][c]) > fabsf(m[pivot][c])) pivot = r;
+            }
+            if(fabsf(m[pivot][c]) < 1e-10F) return false; // the points do not tell this factor apart from the others
+            if(pivot != c) {
+                for (int k = 0; k <= factors; ++k) std::swap(m[c][k], m[pivot][k]);
+            }
+            for (int r = 0; r < factors; ++r) {
+                if(r == c) continue;
+                float s = m[r][c] / m[c][c];
+                for (int k = c; k <= factors; ++k) m[r][k] -= s * m[c][k];
+            }
+        }
+
+        converged = true;
+        for (int f = 0; f < factors; ++f) {
+            float d = m[f][factors] / m[f][f];
+            if(!std::isfinite(d)) return false;
+            adjust(g, f, d);
+            if(fabsf(d) > CONVERGED) converged = false;
+        }
+    }
+
+    float highest = std::max({g.trim[0], g.trim[1], g.trim[2]});
+    for (int i = 0; i < 3; ++i) g.trim[i] -= highest;
+    result = g;
+    return converged;
+}
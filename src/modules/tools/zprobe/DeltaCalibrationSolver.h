@@ -0,0 +1,54 @@
+#ifndef _DELTACALIBRATIONSOLVER
+#define _DELTACALIBRATIONSOLVER
+
+#include <vector>
+#include <cstddef>
+
+// Works out the endstop trims, delta radius, the angles of the first two towers and optionally the arm length of a
+// linear delta from one set of probed points, by least squares over all of them at once
+class DeltaCalibrationSolver
+{
+public:
+    // what a linear delta is set to, in the units of M665 and M666
+    struct geometry_t {
+        float arm_length;
+        float arm_radius;
+        float tower_angle[3];
+        float tower_offset[3];
+        float trim[3];
+    };
+
+    // the factors it can solve for, in this order
+    enum {
+        TRIM_X, TRIM_Y, TRIM_Z, RADIUS, ANGLE_X, ANGLE_Y, ARM_LENGTH,
+        MAX_FACTORS
+    };
+
+    DeltaCalibrationSolver(const geometry_t& geometry) : current(geometry) {}
+
+    // the nozzle was at x, y and z when the probe touched the bed, all in the coordinates geometry gave
+    void add_point(float x, float y, float z);
+    size_t point_count() const { return points.size(); }
+
+    // the geometry that has the probed points on a flat bed, solving for the first factors of the list above,
+    // the trims are all zero or less and it returns false if there are not enough points or it did not converge
+    bool solve(int factors, geometry_t& result) const;
+
+    // where the carriages are for the nozzle to be at x, y and z, and the height of the nozzle with them there,
+    // the carriage heights include the trim so they are the same whatever else the geometry has
+    static void inverse(const geometry_t& g, float x, float y, float z, float carriage[3]);
+    static float forward_z(const geometry_t& g, const float carriage[3]);
+
+private:
+    struct point_t {
+        float carriage[3];
+    };
+
+    static void towers(const geometry_t& g, float tx[3], float ty[3]);
+    static void adjust(geometry_t& g, int factor, float by);
+
+    geometry_t current;
+    std::vector<point_t> points;
+};
+
+#endif
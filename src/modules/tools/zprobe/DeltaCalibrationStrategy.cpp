@@ -13,6 +13,7 @@
 #include "ZProbe.h"
 #include "BaseSolution.h"
 #include "StepperMotor.h"
+#include "DeltaCalibrationSolver.h"
 
 #include <cmath>
 #include <tuple>
@@ -51,6 +52,15 @@ bool DeltaCalibrationStrategy::handleGcode(Gcode *gcode)
             // turn off any compensation transform as it will be invalidated anyway by this
             THEROBOT->compensationTransform= nullptr;
 
+            if(gcode->subcode == 1) {
+                if(!calibrate_least_squares(gcode)) {
+                    gcode->stream->printf("Calibration failed to complete, check the initial probe height and/or initial_height settings\n");
+                    return true;
+                }
+                gcode->stream->printf("Calibration complete, save settings with M500\n");
+                return true;
+            }
+
             if(!gcode->has_letter('R')) {
                 if(!calibrate_delta_endstops(gcode)) {
                     gcode->stream->printf("Calibration failed to complete, check the initial probe height and/or initial_height settings\n");
@@ -284,7 +294,7 @@ bool DeltaCalibrationStrategy::calibrate_delta_endstops(Gcode *gcode)
         trimz += (mmx.first - t3z) * trimscale;
 
         // flush the output
-        THEKERNEL->call_event(ON_IDLE);
+        THEKERNEL->yield();
     }
 
     if((mmx.second - mmx.first) > target) {
@@ -374,13 +384,14 @@ bool DeltaCalibrationStrategy::calibrate_delta_radius(Gcode *gcode)
         // set the new delta radius
         options['R'] = delta_radius;
         THEROBOT->arm_solution->set_optional(options);
+        THEROBOT->arm_solution_changed();
         gcode->stream->printf("Setting delta radius to: %1.4f\n", delta_radius);
 
         zprobe->home();
         zprobe->coordinated_move(NAN, NAN, -bedht, zprobe->getFastFeedrate(), true); // needs to be a relative coordinated move
 
         // flush the output
-        THEKERNEL->call_event(ON_IDLE);
+        THEKERNEL->yield();
     }
 
     if(!good) {
@@ -390,6 +401,110 @@ bool DeltaCalibrationStrategy::calibrate_delta_radius(Gcode *gcode)
     return true;
 }
 
+/*
+    G32.1 solves for the endstop trims, delta radius and the angles of the X and Y towers together from one set of
+    probes, and the arm length as well with L, then probes again to check and solves again from those if it is not
+    yet within the target. I and J are the target and probe radius as for G32.
+*/
+bool DeltaCalibrationStrategy::calibrate_least_squares(Gcode *gcode)
+{
+    float target = 0.03F;
+    if(gcode->has_letter('I')) target = gcode->get_value('I'); // override default target
+    if(gcode->has_letter('J')) this->probe_radius = gcode->get_value('J'); // override default probe radius
+    int factors = gcode->has_letter('L') ? DeltaCalibrationSolver::MAX_FACTORS : DeltaCalibrationSolver::ARM_LENGTH;
+
+    gcode->stream->printf("Calibrating %d factors: target %fmm, radius %fmm\n", factors, target, this->probe_radius);
+
+    DeltaCalibrationSolver::geometry_t geometry;
+    BaseSolution::arm_options_t options;
+    if(!THEROBOT->arm_solution->get_optional(options, true) || options.find('D') == options.end()) {
+        gcode->stream->printf("This appears to not be a linear delta arm solution\n");
+        return false;
+    }
+    geometry.arm_length = options['L'];
+    geometry.arm_radius = options['R'];
+    geometry.tower_offset[0] = options['A'];
+    geometry.tower_offset[1] = options['B'];
+    geometry.tower_offset[2] = options['C'];
+    geometry.tower_angle[0] = options['D'];
+    geometry.tower_angle[1] = options['E'];
+    geometry.tower_angle[2] = options['H'];
+    if(!get_trim(geometry.trim[0], geometry.trim[1], geometry.trim[2])) {
+        gcode->stream->printf("Could not get current trim, are endstops enabled?\n");
+        return false;
+    }
+
+    float bedht= findBed();
+    if(isnan(bedht)) return false;
+    gcode->stream->printf("initial Bed ht is %f mm\n", bedht);
+
+    // check probe ht
+    float mm;
+    if(!zprobe->doProbeAt(mm, 0, 0)) return false;
+    float dz = zprobe->getProbeHeight() - mm;
+    gcode->stream->printf("center probe: %1.4f\n", dz);
+    if(fabsf(dz) > target) {
+         gcode->stream->printf("Probe was not repeatable to %f mm, (%f)\n", target, dz);
+         return false;
+    }
+
+    // the center, six points around the edge and six half way out
+    float pp[13][2];
+    pp[0][0] = pp[0][1] = 0;
+    for (int i = 0; i < 12; ++i) {
+        float a = i * 60.0F * 0.01745329252F, r = i < 6 ? this->probe_radius : this->probe_radius / 2;
+        pp[i + 1][0] = r * cosf(a);
+        pp[i + 1][1] = r * sinf(a);
+    }
+
+    for (int pass = 1; pass <= 3; ++pass) {
+        if(pass > 1) {
+            zprobe->home();
+            zprobe->coordinated_move(NAN, NAN, -bedht, zprobe->getFastFeedrate(), true); // do a relative move from home to the point above the bed
+        }
+
+        // all the probes start from the same height, so the distance down is the height of the bed below it
+        DeltaCalibrationSolver solver(geometry);
+        float lo = 1e6F, hi = -1e6F;
+        for(auto& i : pp) {
+            if(!zprobe->doProbeAt(mm, i[0], i[1])) return false;
+            solver.add_point(i[0], i[1], -mm);
+            lo = std::min(lo, mm);
+            hi = std::max(hi, mm);
+            gcode->stream->printf("P%d-%u X:%1.3f Y:%1.3f Z:%1.4f\n", pass, solver.point_count(), i[0], i[1], mm);
+        }
+        gcode->stream->printf("pass %d delta: %f\n", pass, hi - lo);
+
+        if(hi - lo <= target) {
+            gcode->stream->printf("calibrated to within required parameters: delta %f\n", hi - lo);
+            return true;
+        }
+        if(pass == 3) break;
+
+        if(!solver.solve(factors, geometry)) {
+            gcode->stream->printf("Could not find a solution from the probed points\n");
+            return false;
+        }
+
+        if(!set_trim(geometry.trim[0], geometry.trim[1], geometry.trim[2], gcode->stream)) return false;
+        options.clear();
+        options['L'] = geometry.arm_length;
+        options['R'] = geometry.arm_radius;
+        options['D'] = geometry.tower_angle[0];
+        options['E'] = geometry.tower_angle[1];
+        THEROBOT->arm_solution->set_optional(options);
+        THEROBOT->arm_solution_changed();
+        gcode->stream->printf("Setting arm length %1.4f, delta radius %1.4f, tower angles X:%1.4f Y:%1.4f\n",
+            geometry.arm_length, geometry.arm_radius, geometry.tower_angle[0], geometry.tower_angle[1]);
+
+        // flush the output
+        THEKERNEL->yield();
+    }
+
+    gcode->stream->printf("WARNING: calibration did not resolve to within required parameters: %f\n", target);
+    return true;
+}
+
 bool DeltaCalibrationStrategy::set_trim(float x, float y, float z, StreamOutput *stream)
 {
     float t[3] {x, y, z};
@@ -53,6 +53,8 @@
     M374 Save grid to /sd/delta.grid
     M374.1 delete /sd/delta.grid
     M375 Load the grid from /sd/delta.grid and enable compensation
+    M374, M374.1 and M375 take Pn to use one of several saved grids, /sd/delta-n.grid, so each bed or fixture can have
+    its own. The grid last saved or loaded is the one M500 loads on boot
     M375.1 display the current grid
     M561 clears the grid and turns off compensation
     M565 defines the probe offsets from the nozzle or tool head
@@ -78,6 +80,7 @@
 #include "nuts_bolts.h"
 #include "utils.h"
 #include "platform_memory.h"
+#include "GridFile.h"
 
 #include <string>
 #include <algorithm>
@@ -94,11 +97,12 @@
 #define do_home_checksum             CHECKSUM("do_home")
 #define is_square_checksum           CHECKSUM("is_square") // deprecated
 
-#define GRIDFILE "/sd/delta.grid"
+#define GRIDFILE "delta"
 
 DeltaGridStrategy::DeltaGridStrategy(ZProbe *zprobe) : LevelingStrategy(zprobe)
 {
     grid = nullptr;
+    grid_slot = 0;
 }
 
 DeltaGridStrategy::~DeltaGridStrategy()
@@ -135,95 +139,54 @@ bool DeltaGridStrategy::handleConfig()
         THEKERNEL->streams->printf("Error: Not enough memory\n");
         return false;
     }
+    compensation.allocate(grid_size * grid_size);
 
     reset_bed_level();
 
     return true;
 }
 
-void DeltaGridStrategy::save_grid(StreamOutput *stream)
+void DeltaGridStrategy::save_grid(StreamOutput *stream, uint8_t slot)
 {
     if(isnan(grid[0])) {
         stream->printf("error:No grid to save\n");
         return;
     }
 
-    FILE *fp = fopen(GRIDFILE, "w");
-    if(fp == NULL) {
-        stream->printf("error:Failed to open grid file %s\n", GRIDFILE);
-        return;
-    }
-
-    if(fwrite(&grid_size, sizeof(uint8_t), 1, fp) != 1) {
-        stream->printf("error:Failed to write grid size\n");
-        fclose(fp);
-        return;
-    }
-
-    if(fwrite(&grid_radius, sizeof(float), 1, fp) != 1) {
-        stream->printf("error:Failed to write grid radius\n");
-        fclose(fp);
-        return;
-    }
-
-    for (int y = 0; y < grid_size; y++) {
-        for (int x = 0; x < grid_size; x++) {
-            if(fwrite(&grid[x + (grid_size * y)], sizeof(float), 1, fp) != 1) {
-                stream->printf("error:Failed to write grid\n");
-                fclose(fp);
-                return;
-            }
-        }
-    }
-    stream->printf("grid saved to %s\n", GRIDFILE);
-    fclose(fp);
+    // the file is made up in RAM and written from idle in one go
+    float bounds[4] = {grid_radius, 0, 0, 0};
+    std::string fn = GridFile::filename(GRIDFILE, slot);
+    GridFile::save(fn, grid_size, grid_size, bounds, grid);
+    grid_slot = slot;
+    stream->printf("grid saved to %s\n", fn.c_str());
 }
 
-bool DeltaGridStrategy::load_grid(StreamOutput *stream)
+bool DeltaGridStrategy::load_grid(StreamOutput *stream, uint8_t slot)
 {
-    FILE *fp = fopen(GRIDFILE, "r");
-    if(fp == NULL) {
-        stream->printf("error:Failed to open grid %s\n", GRIDFILE);
-        return false;
-    }
-
-    uint8_t size;
-    float radius;
+    GridFile gf;
+    if(!gf.open(GridFile::filename(GRIDFILE, slot), stream)) return false;
 
-    if(fread(&size, sizeof(uint8_t), 1, fp) != 1) {
-        stream->printf("error:Failed to read grid size\n");
-        fclose(fp);
+    const GridFile::header_t &h = gf.get_header();
+    if(h.x_points != grid_size || h.y_points != grid_size) {
+        stream->printf("error:grid size is different read %d - config %d\n", h.x_points, grid_size);
         return false;
     }
 
-    if(size != grid_size) {
-        stream->printf("error:grid size is different read %d - config %d\n", size, grid_size);
-        fclose(fp);
-        return false;
-    }
-
-    if(fread(&radius, sizeof(float), 1, fp) != 1) {
-        stream->printf("error:Failed to read grid radius\n");
-        fclose(fp);
+    // this replaces the grid, if it fails there is no grid
+    if(!gf.read(grid, stream)) {
+        setAdjustFunction(false);
+        reset_bed_level();
         return false;
     }
 
+    float radius = h.bounds[0];
     if(radius != grid_radius) {
         stream->printf("warning:grid radius is different read %f - config %f, overriding config\n", radius, grid_radius);
         grid_radius = radius;
     }
 
-    for (int y = 0; y < grid_size; y++) {
-        for (int x = 0; x < grid_size; x++) {
-            if(fread(&grid[x + (grid_size * y)], sizeof(float), 1, fp) != 1) {
-                stream->printf("error:Failed to read grid\n");
-                fclose(fp);
-                return false;
-            }
-        }
-    }
+    grid_slot = slot;
     stream->printf("grid loaded, radius: %f, size: %d\n", grid_radius, grid_size);
-    fclose(fp);
     return true;
 }
 
@@ -238,23 +201,29 @@ bool DeltaGridStrategy::probe_grid(int n, float radius, StreamOutput *stream)
     if(isnan(initial_z)) return false;
 
     float d = ((radius * 2) / (n - 1));
+    float row[n];
 
     for (int c = 0; c < n; ++c) {
         float y = -radius + d * c;
-        for (int r = 0; r < n; ++r) {
+        // every other row is done backwards so it never goes back across the bed
+        for (int i = 0; i < n; ++i) {
+            int r = (c % 2) ? n - 1 - i : i;
             float x = -radius + d * r;
             // Avoid probing the corners (outside the round or hexagon print surface) on a delta printer.
             float distance_from_center = sqrtf(x * x + y * y);
-            float z = 0.0F;
+            row[r] = 0.0F;
             if (distance_from_center <= radius) {
                 float mm;
-                if(!zprobe->doProbeAt(mm, x, y)) return false;
-                z = zprobe->getProbeHeight() - mm;
+                if(!zprobe->doProbeAt(mm, x, y, true)) return false;
+                row[r] = zprobe->getProbeHeight() - mm;
             }
-            stream->printf("%8.4f ", z);
+        }
+        for (int r = 0; r < n; ++r) {
+            stream->printf("%8.4f ", row[r]);
         }
         stream->printf("\n");
     }
+    THEKERNEL->conveyor->wait_for_idle();
     return true;
 }
 
@@ -278,12 +247,13 @@ bool DeltaGridStrategy::probe_spiral(int n, float radius, StreamOutput *stream)
         float y = r * sinf(angle);
 
         float mm;
-        if (!zprobe->doProbeAt(mm, x, y)) return false;
+        if (!zprobe->doProbeAt(mm, x, y, true)) return false;
         float z = zprobe->getProbeHeight() - mm;
         stream->printf("PROBE: X%1.4f, Y%1.4f, Z%1.4f\n", x, y, z);
         if(isnan(maxz) || z > maxz) maxz = z;
         if(isnan(minz) || z < minz) minz = z;
     }
+    THEKERNEL->conveyor->wait_for_idle();
 
     stream->printf("max: %1.4f, min: %1.4f, delta: %1.4f\n", maxz, minz, maxz - minz);
     return true;
@@ -336,21 +306,24 @@ bool DeltaGridStrategy::handleGcode(Gcode *gcode)
             gcode->stream->printf("grid cleared and disabled\n");
             return true;
 
-        } else if(gcode->m == 374) { // M374: Save grid, M374.1: delete saved grid
+        } else if(gcode->m == 374) { // M374: Save grid, M374.1: delete saved grid, Pn picks the slot
+            uint8_t slot = gcode->has_letter('P') ? gcode->get_value('P') : 0;
             if(gcode->subcode == 1) {
-                remove(GRIDFILE);
-                gcode->stream->printf("%s deleted\n", GRIDFILE);
+                std::string fn = GridFile::filename(GRIDFILE, slot);
+                remove(fn.c_str());
+                gcode->stream->printf("%s deleted\n", fn.c_str());
             } else {
-                save_grid(gcode->stream);
+                save_grid(gcode->stream, slot);
             }
 
             return true;
 
-        } else if(gcode->m == 375) { // M375: load grid, M375.1 display grid
+        } else if(gcode->m == 375) { // M375: load grid, M375.1 display grid, Pn picks the slot
             if(gcode->subcode == 1) {
                 print_bed_level(gcode->stream);
             } else {
-                if(load_grid(gcode->stream)) setAdjustFunction(true);
+                uint8_t slot = gcode->has_letter('P') ? gcode->get_value('P') : 0;
+                if(load_grid(gcode->stream, slot)) setAdjustFunction(true);
             }
             return true;
 
@@ -367,7 +340,10 @@ bool DeltaGridStrategy::handleGcode(Gcode *gcode)
             std::tie(x, y, z) = probe_offsets;
             gcode->stream->printf(";Probe offsets:\nM565 X%1.5f Y%1.5f Z%1.5f\n", x, y, z);
             if(save) {
-                if(!isnan(grid[0])) gcode->stream->printf(";Load saved grid\nM375\n");
+                if(!isnan(grid[0])) {
+                    if(grid_slot == 0) gcode->stream->printf(";Load saved grid\nM375\n");
+                    else gcode->stream->printf(";Load saved grid\nM375 P%d\n", grid_slot);
+                }
                 else if(gcode->m == 503) gcode->stream->printf(";WARNING No grid to save\n");
             }
             return true;
@@ -395,6 +371,10 @@ bool DeltaGridStrategy::handleGcode(Gcode *gcode)
 void DeltaGridStrategy::setAdjustFunction(bool on)
 {
     if(on) {
+        // precompute the cell coefficients from the current grid
+        compensation.build(grid, grid_size, grid_size, LEFT_PROBE_BED_POSITION, FRONT_PROBE_BED_POSITION,
+                           RIGHT_PROBE_BED_POSITION - LEFT_PROBE_BED_POSITION, BACK_PROBE_BED_POSITION - FRONT_PROBE_BED_POSITION);
+
         // set the compensationTransform in robot
         using std::placeholders::_1;
         using std::placeholders::_2;
@@ -468,12 +448,13 @@ bool DeltaGridStrategy::doProbe(Gcode *gc)
             float distance_from_center = sqrtf(xProbe * xProbe + yProbe * yProbe);
             if (distance_from_center > radius) continue;
 
-            if(!zprobe->doProbeAt(mm, xProbe - X_PROBE_OFFSET_FROM_EXTRUDER, yProbe - Y_PROBE_OFFSET_FROM_EXTRUDER)) return false;
+            if(!zprobe->doProbeAt(mm, xProbe - X_PROBE_OFFSET_FROM_EXTRUDER, yProbe - Y_PROBE_OFFSET_FROM_EXTRUDER, true)) return false;
             float measured_z = zprobe->getProbeHeight() - mm - z_reference; // this is the delta z from bed at 0,0
             gc->stream->printf("DEBUG: X%1.4f, Y%1.4f, Z%1.4f\n", xProbe, yProbe, measured_z);
             grid[xCount + (grid_size * yCount)] = measured_z;
         }
     }
+    THEKERNEL->conveyor->wait_for_idle();
 
     extrapolate_unprobed_bed_level();
     print_bed_level(gc->stream);
@@ -520,44 +501,13 @@ void DeltaGridStrategy::extrapolate_unprobed_bed_level()
 
 void DeltaGridStrategy::doCompensation(float *target, bool inverse)
 {
-    // Adjust print surface height by linear interpolation over the bed_level array.
-    int half = (grid_size - 1) / 2;
-    float grid_x = std::max(0.001F - half, std::min(half - 0.001F, target[X_AXIS] / AUTO_BED_LEVELING_GRID_X));
-    float grid_y = std::max(0.001F - half, std::min(half - 0.001F, target[Y_AXIS] / AUTO_BED_LEVELING_GRID_Y));
-    int floor_x = floorf(grid_x);
-    int floor_y = floorf(grid_y);
-    float ratio_x = grid_x - floor_x;
-    float ratio_y = grid_y - floor_y;
-    float z1 = grid[(floor_x + half) + ((floor_y + half) * grid_size)];
-    float z2 = grid[(floor_x + half) + ((floor_y + half + 1) * grid_size)];
-    float z3 = grid[(floor_x + half + 1) + ((floor_y + half) * grid_size)];
-    float z4 = grid[(floor_x + half + 1) + ((floor_y + half + 1) * grid_size)];
-    float left = (1 - ratio_y) * z1 + ratio_y * z2;
-    float right = (1 - ratio_y) * z3 + ratio_y * z4;
-    float offset = (1 - ratio_x) * left + ratio_x * right;
+    // Adjust print surface height by bilinear interpolation over the precomputed bed_level cells.
+    float offset = compensation.get_offset(target[X_AXIS], target[Y_AXIS]);
 
     if(inverse)
         target[Z_AXIS] -= offset;
     else
         target[Z_AXIS] += offset;
-
-
-    /*
-        THEKERNEL->streams->printf("//DEBUG: TARGET: %f, %f, %f\n", target[0], target[1], target[2]);
-        THEKERNEL->streams->printf("//DEBUG: grid_x= %f\n", grid_x);
-        THEKERNEL->streams->printf("//DEBUG: grid_y= %f\n", grid_y);
-        THEKERNEL->streams->printf("//DEBUG: floor_x= %d\n", floor_x);
-        THEKERNEL->streams->printf("//DEBUG: floor_y= %d\n", floor_y);
-        THEKERNEL->streams->printf("//DEBUG: ratio_x= %f\n", ratio_x);
-        THEKERNEL->streams->printf("//DEBUG: ratio_y= %f\n", ratio_y);
-        THEKERNEL->streams->printf("//DEBUG: z1= %f\n", z1);
-        THEKERNEL->streams->printf("//DEBUG: z2= %f\n", z2);
-        THEKERNEL->streams->printf("//DEBUG: z3= %f\n", z3);
-        THEKERNEL->streams->printf("//DEBUG: z4= %f\n", z4);
-        THEKERNEL->streams->printf("//DEBUG: left= %f\n", left);
-        THEKERNEL->streams->printf("//DEBUG: right= %f\n", right);
-        THEKERNEL->streams->printf("//DEBUG: offset= %f\n", offset);
-    */
 }
 
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "LevelingStrategy.h"
+#include "BilinearGrid.h"
 
 #include <string.h>
 #include <tuple>
@@ -28,8 +29,8 @@ private:
     void print_bed_level(StreamOutput *stream);
     void doCompensation(float *target, bool inverse);
     void reset_bed_level();
-    void save_grid(StreamOutput *stream);
-    bool load_grid(StreamOutput *stream);
+    void save_grid(StreamOutput *stream, uint8_t slot);
+    bool load_grid(StreamOutput *stream, uint8_t slot);
     bool probe_spiral(int n, float radius, StreamOutput *stream);
     bool probe_grid(int n, float radius, StreamOutput *stream);
 
@@ -37,9 +38,11 @@ private:
     float tolerance;
 
     float *grid;
+    BilinearGrid compensation;
     float grid_radius;
     std::tuple<float, float, float> probe_offsets;
     uint8_t grid_size;
+    uint8_t grid_slot; // of the grid last saved or loaded
 
     struct {
         bool save:1;
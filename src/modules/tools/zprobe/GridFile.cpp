@@ -0,0 +1,78 @@
+#include "GridFile.h"
+
+#include "StreamOutput.h"
+#include "WriteBehind.h"
+#include "utils.h"
+
+std::string GridFile::filename(const char *base, uint8_t slot)
+{
+    char buf[32];
+    if(slot == 0) snprintf(buf, sizeof(buf), "/sd/%s.grid", base);
+    else snprintf(buf, sizeof(buf), "/sd/%s-%d.grid", base, slot);
+    return buf;
+}
+
+void GridFile::save(const std::string &fn, uint8_t x_points, uint8_t y_points, const float bounds[4], const float *grid)
+{
+    size_t n= x_points * y_points * sizeof(float);
+
+    header_t h{};
+    h.magic= magic;
+    h.version= version;
+    h.x_points= x_points;
+    h.y_points= y_points;
+    for (int i = 0; i < 4; ++i) h.bounds[i]= bounds[i];
+    h.crc= crc32(grid, n);
+
+    std::string data;
+    data.reserve(sizeof(h) + n);
+    data.append((const char *)&h, sizeof(h));
+    data.append((const char *)grid, n);
+    WriteBehind::queue(fn.c_str(), std::move(data));
+}
+
+bool GridFile::open(const std::string &fn, StreamOutput *stream)
+{
+    close();
+    WriteBehind::sync(); // it may not have been written yet
+    fp= fopen(fn.c_str(), "r");
+    if(fp == nullptr) {
+        stream->printf("error:Failed to open grid %s\n", fn.c_str());
+        return false;
+    }
+
+    if(fread(&header, sizeof(header), 1, fp) != 1 || header.magic != magic) {
+        stream->printf("error:%s is not a grid file, or was saved by an older version and needs probing and saving again\n", fn.c_str());
+        close();
+        return false;
+    }
+
+    if(header.version != version) {
+        stream->printf("error:%s is grid file version %d, this reads version %d\n", fn.c_str(), header.version, version);
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool GridFile::read(float *grid, StreamOutput *stream)
+{
+    size_t n= header.x_points * header.y_points;
+    bool ok= fp != nullptr && fread(grid, sizeof(float), n, fp) == n;
+    if(!ok) {
+        stream->printf("error:Failed to read grid\n");
+    } else if(crc32(grid, n * sizeof(float)) != header.crc) {
+        stream->printf("error:grid file is corrupt\n");
+        ok= false;
+    }
+    close();
+    return ok;
+}
+
+void GridFile::close()
+{
+    if(fp != nullptr) {
+        fclose(fp);
+        fp= nullptr;
+    }
+}
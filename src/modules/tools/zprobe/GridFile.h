@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+class StreamOutput;
+
+// The saved grids of the grid levelling strategies, a fixed header and then the heights as floats in the order the
+// strategies keep them, so a grid loads in one read straight into its buffer. Each strategy can keep several, the
+// slot number picks the file so a different bed or fixture is one M375 P away.
+class GridFile
+{
+public:
+    static const uint32_t magic= 0x44495247; // "GRID"
+    static const uint8_t version= 1;
+
+    struct header_t {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t x_points;
+        uint8_t y_points;
+        uint8_t reserved;
+        float bounds[4]; // what the grid covers, as the strategy that saved it sees it
+        uint32_t crc;    // crc32 of the heights
+    };
+
+    GridFile() : fp(nullptr) {}
+    ~GridFile() { close(); }
+
+    // /sd/<base>.grid for slot 0 and /sd/<base>-<slot>.grid for the others
+    static std::string filename(const char *base, uint8_t slot);
+    // makes the file in RAM and queues it to be written from idle
+    static void save(const std::string &fn, uint8_t x_points, uint8_t y_points, const float bounds[4], const float *grid);
+
+    // opens fn and reads its header, false with the reason printed if it is not a grid file this can read
+    bool open(const std::string &fn, StreamOutput *stream);
+    const header_t &get_header() const { return header; }
+    // reads the heights into grid, which must hold x_points * y_points, and checks them against the header. If this
+    // fails what is in grid has been overwritten
+    bool read(float *grid, StreamOutput *stream);
+    void close();
+
+private:
+    FILE *fp;
+    header_t header;
+};
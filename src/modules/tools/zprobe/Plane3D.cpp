@@ -1,5 +1,7 @@
 #include "Plane3D.h"
 
+#include <cmath>
+
 Plane3D::Plane3D(const Vector3 &v1, const Vector3 &v2, const Vector3 &v3)
 {
     // get the normal of the plane
@@ -12,6 +14,53 @@ Plane3D::Plane3D(const Vector3 &v1, const Vector3 &v2, const Vector3 &v3)
     // ax+by+cz+d=0
     // solve for d
     d = -normal.dot(v1);
+    set_slopes();
+}
+
+// solve for z given x and y
+// z= (-ax - by - d)/c
+void Plane3D::set_slopes()
+{
+    float k = -1.0F / normal[2];
+    a = normal[0] * k;
+    b = normal[1] * k;
+    c = d * k;
+}
+
+// fits z = ax + by + c, about the mean of the points so the sums stay small enough for a float
+Plane3D *Plane3D::fit(const Vector3 *points, int n)
+{
+    if(n < 3) return nullptr;
+
+    float mx = 0, my = 0, mz = 0;
+    for (int i = 0; i < n; ++i) {
+        mx += points[i][0];
+        my += points[i][1];
+        mz += points[i][2];
+    }
+    mx /= n; my /= n; mz /= n;
+
+    float sxx = 0, sxy = 0, syy = 0, sxz = 0, syz = 0;
+    for (int i = 0; i < n; ++i) {
+        float x = points[i][0] - mx, y = points[i][1] - my, z = points[i][2] - mz;
+        sxx += x * x;
+        sxy += x * y;
+        syy += y * y;
+        sxz += x * z;
+        syz += y * z;
+    }
+
+    float det = sxx * syy - sxy * sxy;
+    if(det <= 1e-6F * sxx * syy || det <= 0) return nullptr;
+
+    float a = (sxz * syy - syz * sxy) / det;
+    float b = (syz * sxx - sxz * sxy) / det;
+    float c = mz - a * mx - b * my;
+
+    // ax + by - z + c = 0 scaled to a unit normal
+    Vector3 nv(-a, -b, 1.0F);
+    float k = 1.0F / sqrtf(nv.magsq());
+    return new Plane3D(nv.mul(k), -c * k);
 }
 
 typedef union { float f; uint32_t u; } conv_t;
@@ -22,6 +71,7 @@ Plane3D::Plane3D(uint32_t a, uint32_t b, uint32_t c, uint32_t d)
     ca.u= a; cb.u= b; cc.u= c; cd.u= d;
     this->normal = Vector3(ca.f, cb.f, cc.f);
     this->d= cd.f;
+    set_slopes();
 }
 
 void Plane3D::encode(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d)
@@ -33,15 +83,3 @@ void Plane3D::encode(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d)
     cd.f= this->d;
     a= ca.u; b= cb.u; c= cc.u; d= cd.u;
 }
-
-// solve for z given x and y
-// z= (-ax - by - d)/c
-float Plane3D::getz(float x, float y)
-{
-    return ((-normal[0] * x) - (normal[1] * y) - d) / normal[2];
-}
-
-Vector3 Plane3D::getNormal() const
-{
-    return normal;
-}
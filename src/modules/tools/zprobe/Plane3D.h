@@ -9,14 +9,26 @@
 class Plane3D
 {
 private:
+    Plane3D(const Vector3 &normal, float d) : normal(normal), d(d) { set_slopes(); }
+    void set_slopes();
+
     Vector3 normal;
     float d;
+    // z = ax + by + c worked out once from the normal, so getz is two multiplies and two adds
+    float a, b, c;
 
 public:
     Plane3D(const Vector3 &v1, const Vector3 &v2, const Vector3 &v3);
     Plane3D(uint32_t a, uint32_t b, uint32_t c, uint32_t d);
-    float getz(float x, float y);
-    Vector3 getNormal() const;
+    // the least squares plane through n points, nullptr if they are all on a line
+    static Plane3D *fit(const Vector3 *points, int n);
+    float getz(float x, float y) const { return a * x + b * y + c; }
+    // z for each of n points, ignoring the z they have
+    void getz(const Vector3 *points, int n, float *z) const
+    {
+        for (int i = 0; i < n; ++i) z[i] = a * points[i][0] + b * points[i][1] + c;
+    }
+    Vector3 getNormal() const { return normal; }
     void encode(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d);
 };
 
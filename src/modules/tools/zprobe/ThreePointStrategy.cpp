@@ -4,8 +4,10 @@
 
     Summary
     -------
-    Probes three user specified points on the bed and determines the plane of the bed relative to the probe.
+    Probes three or more user specified points on the bed and determines the plane of the bed relative to the probe.
     as the head moves in X and Y it will adjust Z to keep the head tram with the bed.
+    With more than three points the plane is a least squares fit, and a point that is further from it than the
+    outlier limit is left out and the plane fitted again without it, so one bad probe does not tilt the whole bed.
 
     Configuration
     -------------
@@ -20,7 +22,10 @@
     leveling-strategy.three-point-leveling.point2         200.0,200.0 # the second probe point (x,y)
     leveling-strategy.three-point-leveling.point3         0.0,200.0   # the third probe point (x,y)
 
-    or they may be defined (and saved with M500) using M557 P0 X30 Y40.5  where P is 0,1,2
+    up to six more may be added with point4 to point9, spread over the bed
+
+    or they may be defined (and saved with M500) using M557 P0 X30 Y40.5  where P is 0 to 8, M557 P3 with no X or Y
+    removes an optional point
 
     probe offsets from the nozzle or tool head can be defined with
 
@@ -36,11 +41,16 @@
 
     leveling-strategy.three-point-leveling.tolerance   0.03    # the probe tolerance in mm, default is 0.03mm
 
+    A point is an outlier when it is more than this from the plane fitted through the others, at least four points
+    are kept
+
+    leveling-strategy.three-point-leveling.outlier_limit   0.1    # in mm, default is 0.1mm
+
 
     Usage
     -----
-    G29 probes the three probe points and reports the Z at each point, if a plane is active it will be used to level the probe.
-    G32 probes the three probe points and defines the bed plane, this will remain in effect until reset or M561
+    G29 probes the probe points and reports the Z at each point, if a plane is active it will be used to level the probe.
+    G32 probes the probe points and defines the bed plane, this will remain in effect until reset or M561
     G31 reports the status
 
     M557 defines the probe points
@@ -71,17 +81,20 @@
 #include <cstdlib>
 #include <cmath>
 
-#define probe_point_1_checksum       CHECKSUM("point1")
-#define probe_point_2_checksum       CHECKSUM("point2")
-#define probe_point_3_checksum       CHECKSUM("point3")
 #define probe_offsets_checksum       CHECKSUM("probe_offsets")
 #define home_checksum                CHECKSUM("home_first")
 #define tolerance_checksum           CHECKSUM("tolerance")
 #define save_plane_checksum          CHECKSUM("save_plane")
+#define outlier_limit_checksum       CHECKSUM("outlier_limit")
+
+static const uint16_t probe_point_checksums[MAX_PROBE_POINTS] = {
+    CHECKSUM("point1"), CHECKSUM("point2"), CHECKSUM("point3"), CHECKSUM("point4"), CHECKSUM("point5"),
+    CHECKSUM("point6"), CHECKSUM("point7"), CHECKSUM("point8"), CHECKSUM("point9")
+};
 
 ThreePointStrategy::ThreePointStrategy(ZProbe *zprobe) : LevelingStrategy(zprobe)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < MAX_PROBE_POINTS; ++i) {
         probe_points[i] = std::make_tuple(NAN, NAN);
     }
     plane = nullptr;
@@ -95,12 +108,10 @@ ThreePointStrategy::~ThreePointStrategy()
 bool ThreePointStrategy::handleConfig()
 {
     // format is xxx,yyy for the probe points
-    std::string p1 = THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, probe_point_1_checksum)->by_default("")->as_string();
-    std::string p2 = THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, probe_point_2_checksum)->by_default("")->as_string();
-    std::string p3 = THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, probe_point_3_checksum)->by_default("")->as_string();
-    if(!p1.empty()) probe_points[0] = parseXY(p1.c_str());
-    if(!p2.empty()) probe_points[1] = parseXY(p2.c_str());
-    if(!p3.empty()) probe_points[2] = parseXY(p3.c_str());
+    for (int i = 0; i < MAX_PROBE_POINTS; ++i) {
+        std::string p = THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, probe_point_checksums[i])->by_default("")->as_string();
+        if(!p.empty()) probe_points[i] = parseXY(p.c_str());
+    }
 
     // Probe offsets xxx,yyy,zzz
     std::string po = THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, probe_offsets_checksum)->by_default("0,0,0")->as_string();
@@ -109,6 +120,7 @@ bool ThreePointStrategy::handleConfig()
     this->home= THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, home_checksum)->by_default(true)->as_bool();
     this->tolerance= THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, tolerance_checksum)->by_default(0.03F)->as_number();
     this->save= THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, save_plane_checksum)->by_default(false)->as_bool();
+    this->outlier_limit= THEKERNEL->config->value(leveling_strategy_checksum, three_point_leveling_strategy_checksum, outlier_limit_checksum)->by_default(0.1F)->as_number();
     return true;
 }
 
@@ -149,16 +161,16 @@ bool ThreePointStrategy::handleGcode(Gcode *gcode)
         }
 
     } else if(gcode->has_m) {
-        if(gcode->m == 557) { // M557 - set probe points eg M557 P0 X30 Y40.5  where P is 0,1,2
+        if(gcode->m == 557) { // M557 - set probe points eg M557 P0 X30 Y40.5  where P is 0 to 8
             int idx = 0;
             float x = NAN, y = NAN;
             if(gcode->has_letter('P')) idx = gcode->get_value('P');
             if(gcode->has_letter('X')) x = gcode->get_value('X');
             if(gcode->has_letter('Y')) y = gcode->get_value('Y');
-            if(idx >= 0 && idx <= 2) {
+            if(idx >= 0 && idx < MAX_PROBE_POINTS) {
                 probe_points[idx] = std::make_tuple(x, y);
             }else{
-                 gcode->stream->printf("only 3 probe points allowed P0-P2\n");
+                 gcode->stream->printf("only %d probe points allowed P0-P%d\n", MAX_PROBE_POINTS, MAX_PROBE_POINTS - 1);
             }
             return true;
 
@@ -193,8 +205,9 @@ bool ThreePointStrategy::handleGcode(Gcode *gcode)
         } else if(gcode->m == 500 || gcode->m == 503) { // M500 save, M503 display
             float x, y, z;
             gcode->stream->printf(";Probe points:\n");
-            for (int i = 0; i < 3; ++i) {
+            for (int i = 0; i < MAX_PROBE_POINTS; ++i) {
                 std::tie(x, y) = probe_points[i];
+                if(i >= 3 && (isnan(x) || isnan(y))) continue;
                 gcode->stream->printf("M557 P%d X%1.5f Y%1.5f\n", i, x, y);
             }
             gcode->stream->printf(";Probe offsets:\n");
@@ -287,17 +300,19 @@ bool ThreePointStrategy::doProbing(StreamOutput *stream)
     // move up to specified probe start position
     zprobe->coordinated_move(NAN, NAN, zprobe->getProbeHeight(), zprobe->getSlowFeedrate()); // move to probe start position
 
-    // probe the three points
-    Vector3 v[3];
-    for (int i = 0; i < 3; ++i) {
+    // probe the points that are defined, the move up from each one runs into the move to the next
+    Vector3 v[MAX_PROBE_POINTS];
+    int n = 0;
+    for (int i = 0; i < MAX_PROBE_POINTS; ++i) {
         float z;
         std::tie(x, y) = probe_points[i];
+        if(isnan(x) || isnan(y)) continue;
         // offset moves by the probe XY offset
-        if(!zprobe->doProbeAt(z, x-std::get<X_AXIS>(this->probe_offsets), y-std::get<Y_AXIS>(this->probe_offsets))) return false;
+        if(!zprobe->doProbeAt(z, x-std::get<X_AXIS>(this->probe_offsets), y-std::get<Y_AXIS>(this->probe_offsets), true)) return false;
 
         z= zprobe->getProbeHeight() - z; // relative distance between the probe points, lower is negative z
         stream->printf("DEBUG: P%d:%1.4f\n", i, z);
-        v[i] = Vector3(x, y, z);
+        v[n++] = Vector3(x, y, z);
     }
 
     // if first point is not within tolerance report it, it should ideally be 0
@@ -305,34 +320,75 @@ bool ThreePointStrategy::doProbing(StreamOutput *stream)
         stream->printf("WARNING: probe is not within tolerance: %f > %f\n", fabsf(v[0][2]), this->tolerance);
     }
 
+    // leave out the point furthest from the plane through the others while that is over the limit, keeping four
+    while(n > 4) {
+        int worst = -1;
+        float worst_error = 0;
+        for (int i = 0; i < n; ++i) {
+            Vector3 others[MAX_PROBE_POINTS];
+            int m = 0;
+            for (int j = 0; j < n; ++j) {
+                if(j != i) others[m++] = v[j];
+            }
+            Plane3D *p = Plane3D::fit(others, m);
+            if(p == nullptr) continue;
+            float error = fabsf(v[i][2] - p->getz(v[i][0], v[i][1]));
+            delete p;
+            if(error > worst_error) {
+                worst_error = error;
+                worst = i;
+            }
+        }
+        if(worst < 0 || worst_error <= this->outlier_limit) break;
+
+        stream->printf("DEBUG: left out X:%1.4f Y:%1.4f, it is %1.4f from the plane\n", v[worst][0], v[worst][1], worst_error);
+        for (int j = worst + 1; j < n; ++j) v[j - 1] = v[j];
+        --n;
+    }
+
     // define the plane
     delete this->plane;
+    this->plane= nullptr;
     // check tolerance level here default 0.03mm
-    auto mmx = std::minmax({v[0][2], v[1][2], v[2][2]});
-    if((mmx.second - mmx.first) <= this->tolerance) {
+    float lo = v[0][2], hi = v[0][2];
+    for (int i = 1; i < n; ++i) {
+        lo = std::min(lo, v[i][2]);
+        hi = std::max(hi, v[i][2]);
+    }
+    if((hi - lo) <= this->tolerance) {
         this->plane= nullptr; // plane is flat no need to do anything
         stream->printf("DEBUG: flat plane\n");
         // clear the compensationTransform in robot
         setAdjustFunction(false);
 
     }else{
-        this->plane = new Plane3D(v[0], v[1], v[2]);
+        this->plane = Plane3D::fit(v, n);
+        if(this->plane == nullptr) {
+            stream->printf("The probe points are all on a line, they do not define a plane\n");
+            setAdjustFunction(false);
+            return false;
+        }
         stream->printf("DEBUG: plane normal= %f, %f, %f\n", plane->getNormal()[0], plane->getNormal()[1], plane->getNormal()[2]);
+        float z[MAX_PROBE_POINTS], worst = 0;
+        plane->getz(v, n, z);
+        for (int i = 0; i < n; ++i) worst = std::max(worst, fabsf(v[i][2] - z[i]));
+        stream->printf("DEBUG: furthest probe point is %1.4f from the plane\n", worst);
         setAdjustFunction(true);
     }
 
     return true;
 }
 
-// Probes the 3 points and reports heights
+// Probes the points and reports heights
 bool ThreePointStrategy::test_probe_points(Gcode *gcode)
 {
     // check the probe points have been defined
     float max_delta= 0;
     float last_z= NAN;
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < MAX_PROBE_POINTS; ++i) {
         float x, y;
         std::tie(x, y) = probe_points[i];
+        if(i >= 3 && (isnan(x) || isnan(y))) continue;
         if(isnan(x) || isnan(y)) {
             gcode->stream->printf("Probe point P%d has not been defined, use M557 P%d Xnnn Ynnn to define it\n", i, i);
             return false;
@@ -359,7 +415,9 @@ void ThreePointStrategy::setAdjustFunction(bool on)
 {
     if(on) {
         // set the compensationTransform in robot
-        THEROBOT->compensationTransform= [this](float *target, bool inverse) { if(inverse) target[2] -= this->plane->getz(target[0], target[1]); else target[2] += this->plane->getz(target[0], target[1]); };
+        // the plane rather than this is captured so each move only has the one pointer to follow to its inline getz
+        const Plane3D *p= this->plane;
+        THEROBOT->compensationTransform= [p](float *target, bool inverse) { float dz= p->getz(target[0], target[1]); target[2] += inverse ? -dz : dz; };
     }else{
         // clear it
         THEROBOT->compensationTransform= nullptr;
@@ -8,6 +8,9 @@
 
 #define three_point_leveling_strategy_checksum CHECKSUM("three-point-leveling")
 
+// the first three have to be set, the rest are optional and make a least squares fit of the plane
+#define MAX_PROBE_POINTS 9
+
 class StreamOutput;
 class Plane3D;
 
@@ -29,13 +32,14 @@ private:
     bool test_probe_points(Gcode *gcode);
 
     std::tuple<float, float, float> probe_offsets;
-    std::tuple<float, float> probe_points[3];
+    std::tuple<float, float> probe_points[MAX_PROBE_POINTS];
     Plane3D *plane;
     struct {
         bool home:1;
         bool save:1;
     };
     float tolerance;
+    float outlier_limit;
 };
 
 #endif
@@ -26,6 +26,7 @@
 #include "LevelingStrategy.h"
 #include "StepTicker.h"
 #include "utils.h"
+#include "InterruptIn.h" // mbed
 
 // strategies we know about
 #include "DeltaCalibrationStrategy.h"
@@ -44,6 +45,7 @@
 #define max_z_checksum           CHECKSUM("max_z")
 #define reverse_z_direction_checksum CHECKSUM("reverse_z")
 #define dwell_before_probing_checksum CHECKSUM("dwell_before_probing")
+#define interrupt_enable_checksum CHECKSUM("interrupt_enable")
 
 // from endstop section
 #define delta_homing_checksum    CHECKSUM("delta_homing")
@@ -146,6 +148,21 @@ void ZProbe::config_load()
     }
     this->dwell_before_probing = THEKERNEL->config->value(zprobe_checksum, dwell_before_probing_checksum)->by_default(0)->as_number(); // dwell time in seconds before probing
 
+    // optionally stop on the pin interrupt rather than the 1ms poll, the position it triggered at is then exact whatever the feedrate
+    if(THEKERNEL->config->value(zprobe_checksum, interrupt_enable_checksum)->by_default(false)->as_bool()) {
+        Pin p= this->pin; // interrupt_pin() marks a pin it can't use as invalid, and it still needs to be polled
+        this->irq= p.interrupt_pin();
+        if(this->irq == nullptr) {
+            THEKERNEL->streams->printf("WARNING: zprobe pin P%d.%d can't use an interrupt, only pins on ports 0 and 2 can\n", this->pin.port_number, this->pin.pin);
+        } else {
+            if(this->pin.is_inverting()) {
+                this->irq->fall(this, &ZProbe::probe_edge);
+            } else {
+                this->irq->rise(this, &ZProbe::probe_edge);
+            }
+        }
+    }
+
 }
 
 uint32_t ZProbe::read_probe(uint32_t dummy)
@@ -159,10 +176,7 @@ uint32_t ZProbe::read_probe(uint32_t dummy)
             if(debounce < debounce_ms) {
                 debounce++;
             } else {
-                // we signal the motors to stop, which will preempt any moves on that axis
-                // we do all motors as it may be a delta
-                for(auto &a : THEROBOT->actuators) a->stop_moving();
-                probe_detected= true;
+                trigger();
                 debounce= 0;
             }
 
@@ -175,6 +189,27 @@ uint32_t ZProbe::read_probe(uint32_t dummy)
     return 0;
 }
 
+// called from the pin interrupt when the probe becomes active, it has to read active a few more times to count
+void ZProbe::probe_edge()
+{
+    if(!probing || probe_detected) return;
+    if(!(STEPPER[X_AXIS]->is_moving() || STEPPER[Y_AXIS]->is_moving() || STEPPER[Z_AXIS]->is_moving())) return;
+
+    for (int i = 0; i < 8; ++i) {
+        if(!this->pin.get()) return; // a glitch
+    }
+    trigger();
+}
+
+// we signal the motors to stop, which will preempt any moves on that axis
+// we do all motors as it may be a delta, and keep where they were as they may take a tick to actually stop
+void ZProbe::trigger()
+{
+    for (int i = X_AXIS; i <= Z_AXIS; ++i) trigger_step[i]= STEPPER[i]->get_current_step();
+    for(auto &a : THEROBOT->actuators) a->stop_moving();
+    probe_detected= true;
+}
+
 // single probe in Z with custom feedrate
 // returns boolean value indicating if probe was triggered
 bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
@@ -204,9 +239,13 @@ bool ZProbe::run_probe(float& mm, float feedrate, float max_dist, bool reverse)
     // wait until finished
     THECONVEYOR->wait_for_idle();
 
-    // now see how far we moved, get delta in z we moved
+    // now see how far we moved, get delta in z we moved, up to where it triggered
     // NOTE this works for deltas as well as all three actuators move the same amount in Z
-    mm= z_start_pos - THEROBOT->actuators[2]->get_current_position();
+    if(probe_detected) {
+        mm= z_start_pos - (float)trigger_step[Z_AXIS] / Z_STEPS_PER_MM;
+    } else {
+        mm= z_start_pos - THEROBOT->actuators[2]->get_current_position();
+    }
 
     // set the last probe position to the actuator units moved during this home
     THEROBOT->set_last_probe_position(std::make_tuple(0, 0, mm, probe_detected?1:0));
@@ -227,8 +266,14 @@ bool ZProbe::run_probe_return(float& mm, float feedrate, float max_dist, bool re
     float save_z_pos= THEROBOT->get_axis_position(Z_AXIS);
 
     bool ok= run_probe(mm, feedrate, max_dist, reverse);
+    move_back(save_z_pos, true);
 
-    // move probe back to where it was
+    return ok;
+}
+
+// move probe back to where it was
+void ZProbe::move_back(float z, bool wait)
+{
     float fr;
     if(this->return_feedrate != 0) { // use return_feedrate if set
         fr = this->return_feedrate;
@@ -238,16 +283,20 @@ bool ZProbe::run_probe_return(float& mm, float feedrate, float max_dist, bool re
     }
 
     // absolute move back to saved starting position
-    coordinated_move(NAN, NAN, save_z_pos, fr, false);
-
-    return ok;
+    coordinated_move(NAN, NAN, z, fr, false, wait);
 }
 
-bool ZProbe::doProbeAt(float &mm, float x, float y)
+// with overlap set the lift after the probe is left in the queue, so it runs straight on into the move to the next point
+// without stopping, the caller must wait for idle after the last one
+bool ZProbe::doProbeAt(float &mm, float x, float y, bool overlap)
 {
-    // move to xy
+    // move to xy, this waits so the probe only ever starts from a standstill
     coordinated_move(x, y, NAN, getFastFeedrate());
-    return run_probe_return(mm, slow_feedrate);
+
+    float save_z_pos= THEROBOT->get_axis_position(Z_AXIS);
+    bool ok= run_probe(mm, slow_feedrate);
+    move_back(save_z_pos, !overlap);
+    return ok;
 }
 
 void ZProbe::on_gcode_received(void *argument)
@@ -434,6 +483,20 @@ void ZProbe::probe_XYZ(Gcode *gcode, float x, float y, float z)
 
     uint8_t probeok= this->probe_detected ? 1 : 0;
 
+    if(probeok) {
+        // report where it triggered rather than where it came to a stop, the difference between the two goes through the
+        // kinematics so it works on a delta too
+        ActuatorCoordinates at, now;
+        for (int i = X_AXIS; i <= Z_AXIS; ++i) {
+            at[i]= (float)trigger_step[i] / STEPS_PER_MM(i);
+            now[i]= STEPPER[i]->get_current_position();
+        }
+        float pat[3], pnow[3];
+        THEROBOT->arm_solution->actuator_to_cartesian(at, pat);
+        THEROBOT->arm_solution->actuator_to_cartesian(now, pnow);
+        for (int i = X_AXIS; i <= Z_AXIS; ++i) pos[i] += pat[i] - pnow[i];
+    }
+
     // print results using the GRBL format
     gcode->stream->printf("[PRB:%1.3f,%1.3f,%1.3f:%d]\n", THEKERNEL->robot->from_millimeters(pos[X_AXIS]), THEKERNEL->robot->from_millimeters(pos[Y_AXIS]), THEKERNEL->robot->from_millimeters(pos[Z_AXIS]), probeok);
     THEROBOT->set_last_probe_position(std::make_tuple(pos[X_AXIS], pos[Y_AXIS], pos[Z_AXIS], probeok));
@@ -448,7 +511,7 @@ void ZProbe::probe_XYZ(Gcode *gcode, float x, float y, float z)
 // issue a coordinated move directly to robot, and return when done
 // Only move the coordinates that are passed in as not nan
 // NOTE must use G53 to force move in machine coordinates and ignore any WCS offsets
-void ZProbe::coordinated_move(float x, float y, float z, float feedrate, bool relative)
+void ZProbe::coordinated_move(float x, float y, float z, float feedrate, bool relative, bool wait)
 {
     #define CMDLEN 128
     char *cmd= new char[CMDLEN]; // use heap here to reduce stack usage
@@ -487,7 +550,7 @@ void ZProbe::coordinated_move(float x, float y, float z, float feedrate, bool re
 
     message.stream = &(StreamOutput::NullStream);
     THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message );
-    THEKERNEL->conveyor->wait_for_idle();
+    if(wait) THEKERNEL->conveyor->wait_for_idle();
     THEROBOT->pop_state();
 
 }
@@ -21,12 +21,15 @@ class StepperMotor;
 class Gcode;
 class StreamOutput;
 class LevelingStrategy;
+namespace mbed {
+    class InterruptIn;
+}
 
 class ZProbe: public Module
 {
 
 public:
-    ZProbe() : invert_override(false) {};
+    ZProbe() : irq(nullptr), invert_override(false) {};
     virtual ~ZProbe() {};
 
     void on_module_loaded();
@@ -34,9 +37,9 @@ public:
 
     bool run_probe(float& mm, float feedrate, float max_dist= -1, bool reverse= false);
     bool run_probe_return(float& mm, float feedrate, float max_dist= -1, bool reverse= false);
-    bool doProbeAt(float &mm, float x, float y);
+    bool doProbeAt(float &mm, float x, float y, bool overlap= false);
 
-    void coordinated_move(float x, float y, float z, float feedrate, bool relative=false);
+    void coordinated_move(float x, float y, float z, float feedrate, bool relative=false, bool wait=true);
     void home();
 
     bool getProbeStatus() { return this->pin.get(); }
@@ -48,7 +51,10 @@ public:
 private:
     void config_load();
     void probe_XYZ(Gcode *gc, float x, float y, float z);
+    void move_back(float z, bool wait);
     uint32_t read_probe(uint32_t dummy);
+    void probe_edge();
+    void trigger();
 
     float slow_feedrate;
     float fast_feedrate;
@@ -58,8 +64,10 @@ private:
     float dwell_before_probing;
 
     Pin pin;
+    mbed::InterruptIn *irq; // set if the probe pin has an edge interrupt
     std::vector<LevelingStrategy*> strategies;
     uint16_t debounce_ms, debounce;
+    int32_t trigger_step[3]; // XYZ actuator positions when the probe triggered
 
     volatile struct {
         bool is_delta:1;
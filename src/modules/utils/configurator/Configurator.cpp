@@ -19,6 +19,10 @@
 #include "FileConfigSource.h"
 #include "ConfigValue.h"
 #include "ConfigCache.h"
+#include "Conveyor.h"
+#include "Planner.h"
+#include "SimpleShell.h"
+#include "WriteBehind.h"
 
 #define CONF_NONE       0
 #define CONF_ROM        1
@@ -119,6 +123,22 @@ void Configurator::config_load_command( string parameters, StreamOutput *stream
         THEKERNEL->config->config_cache->dump(stream);
         THEKERNEL->config->config_cache_clear();
 
+    } else if(source == "reload") {
+        // re-read the settings the modules can change in place, pins and which modules are loaded need a reset
+        THECONVEYOR->wait_for_idle();
+        THEKERNEL->config->config_cache_load();
+        THEKERNEL->planner->config_load();
+        THEKERNEL->call_event(ON_CONFIG_RELOAD);
+        THEKERNEL->config->config_cache_clear();
+        // then as at boot the config-override goes on top
+        WriteBehind::sync();
+        FILE *fp= fopen(THEKERNEL->config_override_filename(), "r");
+        if(fp != NULL) {
+            fclose(fp);
+            SimpleShell::parse_command("load", THEKERNEL->config_override_filename(), stream);
+        }
+        stream->printf( "config reloaded\r\n" );
+
     } else if(source == "checksum") {
         string key = shift_parameter(parameters);
         uint16_t cs[3];
@@ -126,7 +146,7 @@ void Configurator::config_load_command( string parameters, StreamOutput *stream
         stream->printf( "checksum of %s = %02X %02X %02X\n", key.c_str(), cs[0], cs[1], cs[2]);
 
     } else {
-        stream->printf( "unsupported option: must be one of load|unload|dump|checksum\n" );
+        stream->printf( "unsupported option: must be one of load|unload|dump|reload|checksum\n" );
     }
 }
 
@@ -4,6 +4,7 @@
 #include "libs/Kernel.h"
 #include "libs/utils.h"
 #include <libs/Pin.h>
+#include "SPIBus.h"
 #include "mbed.h"
 #include <string>
 #include <math.h>
@@ -27,10 +28,12 @@ class AD5206 : public DigipotBase {
 				current = min( max( current, 0.0F ), 2.0F );
 				char adresses[6] = { 0x05, 0x03, 0x01, 0x00, 0x02, 0x04 };
 				currents[channel] = current;
+				SPIBus::hold(1);
 				cs.set(0);
 				spi->write((int)adresses[channel]);
 				spi->write((int)current_to_wiper(current));
 				cs.set(1);
+				SPIBus::release(1);
 			}
         }
 
@@ -9,6 +9,8 @@
 #include "checksumm.h"
 #include "ConfigValue.h"
 #include "StreamOutputPool.h"
+#include "StepTicker.h"
+#include "InterruptIn.h" // mbed
 
 using namespace std;
 
@@ -19,6 +21,7 @@ using namespace std;
 #define pause_button_pin_checksum    CHECKSUM("pause_button_pin")
 #define kill_button_pin_checksum     CHECKSUM("kill_button_pin")
 #define poll_frequency_checksum      CHECKSUM("kill_button_poll_frequency")
+#define interrupt_enable_checksum    CHECKSUM("kill_button_interrupt_enable")
 
 KillButton::KillButton()
 {
@@ -50,14 +53,45 @@ void KillButton::on_module_loaded()
         return;
     }
 
-    this->register_for_event(ON_IDLE);
+    this->register_for_event(ON_IDLE, PRIORITY_HIGH);
 
     this->poll_frequency = THEKERNEL->config->value( poll_frequency_checksum )->by_default(5)->as_number();
     THEKERNEL->slow_ticker->attach( this->poll_frequency, this, &KillButton::button_tick );
+
+    // optionally stop the steps on the pin interrupt as well, so how long a kill takes does not depend on what the main loop is doing
+    if(THEKERNEL->config->value( interrupt_enable_checksum )->by_default(false)->as_bool()) {
+        Pin p= this->kill_button; // interrupt_pin() marks a pin it can't use as invalid, and it is still polled
+        this->irq= p.interrupt_pin();
+        if(this->irq == nullptr) {
+            THEKERNEL->streams->printf("WARNING: kill button pin P%d.%d can't use an interrupt, only pins on ports 0 and 2 can\n", this->kill_button.port_number, this->kill_button.pin);
+        } else {
+            // pressed reads as false
+            if(this->kill_button.is_inverting()) {
+                this->irq->rise(this, &KillButton::button_edge);
+            } else {
+                this->irq->fall(this, &KillButton::button_edge);
+            }
+        }
+    }
+}
+
+// the steps stop here and the halt follows in on_idle, presses while halted are left to the poll for unkill
+void KillButton::button_edge()
+{
+    if(!THEKERNEL->is_halted()) THEKERNEL->step_ticker->emergency_stop();
 }
 
 void KillButton::on_idle(void *argument)
 {
+    if(THEKERNEL->step_ticker->is_emergency_stopped()) {
+        // the edge interrupt has already stopped the steps, halt the rest, once halted the step ticker stays stopped
+        if(!THEKERNEL->is_halted()) {
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            THEKERNEL->streams->printf("ALARM: Kill button pressed - reset or M999 to continue\r\n");
+        }
+        THEKERNEL->step_ticker->clear_emergency_stop();
+    }
+
     if(state == KILL_BUTTON_DOWN) {
         if(!THEKERNEL->is_halted()) {
             THEKERNEL->call_event(ON_HALT, nullptr);
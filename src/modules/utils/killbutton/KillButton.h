@@ -2,6 +2,10 @@
 
 #include "libs/Pin.h"
 
+namespace mbed {
+    class InterruptIn;
+}
+
 class KillButton : public Module {
     public:
         KillButton();
@@ -9,9 +13,11 @@ class KillButton : public Module {
         void on_module_loaded();
         void on_idle(void *argument);
         uint32_t button_tick(uint32_t dummy);
+        void button_edge();
 
     private:
         Pin kill_button;
+        mbed::InterruptIn *irq{nullptr}; // set if the pin has an edge interrupt that stops the steps at once
         enum STATE {
             IDLE,
             KILL_BUTTON_DOWN,
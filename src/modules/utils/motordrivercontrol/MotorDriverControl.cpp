@@ -8,27 +8,34 @@
 #include "Robot.h"
 #include "StepperMotor.h"
 #include "PublicDataRequest.h"
+#include "PublicData.h"
+#include "SlowTicker.h"
+#include "StepTicker.h"
+#include "Block.h"
 
 #include "Gcode.h"
 #include "Config.h"
 #include "checksumm.h"
 
-#include "mbed.h" // for SPI
 
 #include "drivers/TMC26X/TMC26X.h"
 #include "drivers/DRV8711/drv8711.h"
 
 #include <string>
 
-#define motor_driver_control_checksum  CHECKSUM("motor_driver_control")
 #define enable_checksum                CHECKSUM("enable")
 #define chip_checksum                  CHECKSUM("chip")
 #define designator_checksum            CHECKSUM("designator")
 #define axis_checksum                  CHECKSUM("axis")
 #define alarm_checksum                 CHECKSUM("alarm")
 #define halt_on_alarm_checksum         CHECKSUM("halt_on_alarm")
+#define sensorless_homing_checksum     CHECKSUM("sensorless_homing")
+#define halt_on_stall_checksum         CHECKSUM("halt_on_stall")
+#define stall_threshold_checksum       CHECKSUM("stall_threshold")
+#define stall_filter_checksum          CHECKSUM("stall_filter")
 
 #define current_checksum               CHECKSUM("current")
+#define cruise_current_checksum        CHECKSUM("cruise_current")
 #define max_current_checksum           CHECKSUM("max_current")
 
 #define microsteps_checksum            CHECKSUM("microsteps")
@@ -121,20 +128,14 @@ bool MotorDriverControl::config_module(uint16_t cs)
     int spi_channel = THEKERNEL->config->value(motor_driver_control_checksum, cs, spi_channel_checksum)->by_default(1)->as_number();
     int spi_frequency = THEKERNEL->config->value(motor_driver_control_checksum, cs, spi_frequency_checksum)->by_default(1000000)->as_number();
 
-    // select SPI channel to use
-    PinName mosi, miso, sclk;
-    if(spi_channel == 0) {
-        mosi = P0_18; miso = P0_17; sclk = P0_15;
-    } else if(spi_channel == 1) {
-        mosi = P0_9; miso = P0_8; sclk = P0_7;
-    } else {
+    // select SPI channel to use, the bus is shared with anything else on it
+    if(spi_channel != 0 && spi_channel != 1) {
         THEKERNEL->streams->printf("MotorDriverControl %c ERROR: Unknown SPI Channel: %d\n", axis, spi_channel);
         return false;
     }
 
-    this->spi = new mbed::SPI(mosi, miso, sclk);
-    this->spi->frequency(spi_frequency);
-    this->spi->format(8, 3); // 8bit, mode3
+    this->bus = SPIBus::get(spi_channel);
+    this->bus->setup(device, &spi_cs_pin, spi_frequency, 3); // 8bit, mode3
 
     // set default max currents for each chip, can be overidden in config
     switch(chip) {
@@ -181,14 +182,49 @@ bool MotorDriverControl::config_module(uint16_t cs)
     this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_HALT);
     this->register_for_event(ON_ENABLE);
-    this->register_for_event(ON_IDLE);
+    this->register_for_event(ON_IDLE, PRIORITY_LOW);
 
     if( THEKERNEL->config->value(motor_driver_control_checksum, cs, alarm_checksum )->by_default(false)->as_bool() ) {
         halt_on_alarm= THEKERNEL->config->value(motor_driver_control_checksum, cs, halt_on_alarm_checksum )->by_default(false)->as_bool();
         // enable alarm monitoring for the chip
+        poll.device= &device;
+        poll.len= 0;
+        poll.done= &MotorDriverControl::poll_done;
+        poll.arg= this;
+        poll.busy= false;
+        poll_ready= false;
         this->register_for_event(ON_SECOND_TICK);
     }
 
+    // StallGuard for sensorless homing and crash detection, only the TMC2660 has it
+    bool sensorless= THEKERNEL->config->value(motor_driver_control_checksum, cs, sensorless_homing_checksum )->by_default(false)->as_bool();
+    halt_on_stall= THEKERNEL->config->value(motor_driver_control_checksum, cs, halt_on_stall_checksum )->by_default(false)->as_bool();
+    actuator= (axis >= 'X' && axis <= 'Z') ? axis-'X' : axis-'A'+3;
+    if((sensorless || halt_on_stall) && chip == TMC2660 && actuator < THEROBOT->actuators.size()) {
+        int threshold= THEKERNEL->config->value(motor_driver_control_checksum, cs, stall_threshold_checksum )->by_default(0)->as_int();
+        bool filter= THEKERNEL->config->value(motor_driver_control_checksum, cs, stall_filter_checksum )->by_default(false)->as_bool();
+        tmc26x->setStallGuardThreshold(threshold, filter ? 1 : 0);
+
+        stall_poll.device= &device;
+        stall_poll.done= &MotorDriverControl::stall_done;
+        stall_poll.arg= this;
+        stall_poll.busy= false;
+        if(sensorless) PublicData::register_get(motor_driver_control_checksum, this);
+        THEKERNEL->slow_ticker->attach(1000, this, &MotorDriverControl::stall_tick);
+    }
+
+    // lower current when not accelerating, only the TMC2660 as its current is set by one datagram that can be queued
+    cruise_current= THEKERNEL->config->value(motor_driver_control_checksum, cs, cruise_current_checksum )->by_default(0)->as_number(); // in mA
+    if(cruise_current > 0 && chip == TMC2660 && actuator < THEROBOT->actuators.size()) {
+        current_change.device= &device;
+        current_change.len= 3;
+        current_change.done= nullptr;
+        current_change.busy= false;
+        THEKERNEL->slow_ticker->attach(1000, this, &MotorDriverControl::current_tick);
+    }else{
+        cruise_current= 0;
+    }
+
     THEKERNEL->streams->printf("MotorDriverControl INFO: configured motor %c (%d): as %s, cs: %04X\n", axis, id, chip==TMC2660?"TMC2660":chip==DRV8711?"DRV8711":"UNKNOWN", (spi_cs_pin.port_number<<8)|spi_cs_pin.pin);
 
     return true;
@@ -218,6 +254,36 @@ void MotorDriverControl::on_idle(void *argument)
         enable_event= false;
         enable(enable_flg);
     }
+
+    if(stall_alarm) {
+        stall_alarm= false;
+        if(!THEKERNEL->is_halted()) {
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            THEKERNEL->streams->printf("Error: Motor %c stalled - reset or M999 required to continue\r\n", axis);
+        }
+    }
+
+    if(poll_ready) {
+        poll_ready= false;
+        if(THEKERNEL->is_halted()) return;
+
+        bool alarm= false;
+        switch(chip) {
+            case DRV8711: alarm= drv8711->check_alarm(poll.rx); break;
+            case TMC2660: alarm= tmc26x->checkAlarm(poll.rx); break;
+        }
+
+        if(halt_on_alarm && alarm) {
+            THEKERNEL->call_event(ON_HALT, nullptr);
+            THEKERNEL->streams->printf("Error: Motor Driver alarm - reset or M999 required to continue\r\n");
+        }
+    }
+}
+
+// called from the SSP interrupt
+void MotorDriverControl::poll_done(SPIBus::Transaction *t)
+{
+    static_cast<MotorDriverControl *>(t->arg)->poll_ready= true;
 }
 
 void MotorDriverControl::on_halt(void *argument)
@@ -228,27 +294,75 @@ void MotorDriverControl::on_halt(void *argument)
     }
 }
 
-// runs in on_idle, does SPI transaction
-void MotorDriverControl::on_second_tick(void *argument)
+// the endstops ask each driver for the stall state of its axis
+void MotorDriverControl::on_get_public_data(void *argument)
 {
-    // we don't want to keep checking once we have been halted by an error
-    if(THEKERNEL->is_halted()) return;
+    PublicDataRequest *pdr= static_cast<PublicDataRequest *>(argument);
+    if(!pdr->starts_with(motor_driver_control_checksum) || !pdr->second_element_is(stall_state_checksum)) return;
 
-    bool alarm=false;;
-    switch(chip) {
-        case DRV8711:
-            alarm= drv8711->check_alarm();
-            break;
+    pad_stall *p= static_cast<pad_stall *>(pdr->get_data_ptr());
+    if(p->axis != axis) return;
+    p->state= &stall;
+    pdr->set_taken();
+}
 
-        case TMC2660:
-            alarm= tmc26x->checkAlarm();
-            break;
+// called every millisecond from the SlowTicker interrupt, the read runs from the SSP interrupt as the bus is free
+uint32_t MotorDriverControl::stall_tick(uint32_t)
+{
+    if(!(stall.homing || halt_on_stall) || stall_poll.busy || THEKERNEL->is_halted()) return 0;
+    // StallGuard means nothing when the motor is not turning
+    if(!THEROBOT->actuators[actuator]->is_moving()) return 0;
+    stall_poll.len= tmc26x->statusRequest(stall_poll.tx);
+    bus->queue(&stall_poll);
+    return 0;
+}
+
+// called every millisecond from the SlowTicker interrupt, raises the current for the acceleration and deceleration
+// of the block being stepped if this motor moves in it and lowers it for the plateau and when idle
+uint32_t MotorDriverControl::current_tick(uint32_t)
+{
+    bool want= false;
+    const Block *block= THEKERNEL->step_ticker->get_current_block();
+    if(block != nullptr && block->is_ticking && block->steps[actuator] > 0) {
+        uint32_t tick= THEKERNEL->step_ticker->get_current_tick();
+        want= tick < block->accelerate_until || tick > block->decelerate_after;
+    }
+    if(want == boosted || current_change.busy) return 0;
+
+    unsigned long datagram= tmc26x->currentDatagram(want ? current : cruise_current);
+    current_change.tx[0]= datagram >> 16;
+    current_change.tx[1]= datagram >> 8;
+    current_change.tx[2]= datagram & 0xff;
+    if(bus->queue(&current_change)) boosted= want;
+    return 0;
+}
+
+// called from the SSP interrupt
+void MotorDriverControl::stall_done(SPIBus::Transaction *t)
+{
+    MotorDriverControl *m= static_cast<MotorDriverControl *>(t->arg);
+    // the latest reading, the endstops debounce it over endstop_debounce_ms as StallGuard is noisy when accelerating
+    m->stall.stalled= TMC26X::isStallGuardReached(t->rx);
+    if(m->stall.stalled && !m->stall.homing && m->halt_on_stall) {
+        // a crash, stop the motor now and leave the halt and the message to on_idle
+        THEROBOT->actuators[m->actuator]->stop_moving();
+        m->stall_alarm= true;
     }
+}
+
+// queues the status read, all the drivers do this on the same tick so the reads go out back to back from the
+// SSP interrupt instead of each waiting for its transfer in the main loop, the reply is checked in on_idle
+void MotorDriverControl::on_second_tick(void *argument)
+{
+    // we don't want to keep checking once we have been halted by an error
+    if(THEKERNEL->is_halted() || poll.busy || poll_ready) return;
 
-    if(halt_on_alarm && alarm) {
-        THEKERNEL->call_event(ON_HALT, nullptr);
-        THEKERNEL->streams->printf("Error: Motor Driver alarm - reset or M999 required to continue\r\n");
+    switch(chip) {
+        case DRV8711: poll.len= drv8711->status_request(poll.tx); break;
+        case TMC2660: poll.len= tmc26x->statusRequest(poll.tx); break;
     }
+    // if the queue is full it is tried again next second
+    bus->queue(&poll);
 }
 
 void MotorDriverControl::on_gcode_received(void *argument)
@@ -365,6 +479,8 @@ void MotorDriverControl::set_current(uint32_t c)
             tmc26x->setCurrent(c);
             break;
     }
+    // that sent the full current, current_tick lowers it again if it should be
+    boosted= true;
 }
 
 // set microsteps where n is the number of microsteps eg 64 for 1/64
@@ -464,11 +580,6 @@ void MotorDriverControl::set_options(Gcode *gcode)
 // Called by the drivers codes to send and receive SPI data to/from the chip
 int MotorDriverControl::sendSPI(uint8_t *b, int cnt, uint8_t *r)
 {
-    spi_cs_pin.set(0);
-    for (int i = 0; i < cnt; ++i) {
-        r[i]= spi->write(b[i]);
-    }
-    spi_cs_pin.set(1);
-    return cnt;
+    return bus->transfer(device, b, r, cnt);
 }
 
@@ -2,13 +2,11 @@
 
 #include "Module.h"
 #include "Pin.h"
+#include "SPIBus.h"
+#include "MotorDriverControlPublicAccess.h"
 
 #include <stdint.h>
 
-namespace mbed {
-    class SPI;
-}
-
 class DRV8711DRV;
 class TMC26X;
 class StreamOutput;
@@ -25,6 +23,7 @@ class MotorDriverControl : public Module {
         void on_enable(void *argument);
         void on_idle(void *argument);
         void on_second_tick(void *argument);
+        void on_get_public_data(void *argument);
 
     private:
         bool config_module(uint16_t cs);
@@ -38,9 +37,16 @@ class MotorDriverControl : public Module {
 
         void enable(bool on);
         int sendSPI(uint8_t *b, int cnt, uint8_t *r);
+        static void poll_done(SPIBus::Transaction *t);
+        uint32_t stall_tick(uint32_t);
+        static void stall_done(SPIBus::Transaction *t);
+        uint32_t current_tick(uint32_t);
 
         Pin spi_cs_pin;
-        mbed::SPI *spi;
+        SPIBus *bus;
+        SPIBus::Device device;
+        // the alarm status read, queued each second and checked in on_idle once it is back
+        SPIBus::Transaction poll{};
 
         enum CHIP_TYPE {
             DRV8711,
@@ -71,5 +77,18 @@ class MotorDriverControl : public Module {
             bool microstep_override:1;
             bool halt_on_alarm:1;
         };
+        volatile bool poll_ready{false}; // set by the SSP interrupt, not a bitfield so it does not share a byte
+
+        // StallGuard, read at 1KHz while the motor moves when homing sensorless or watching for a stall
+        SPIBus::Transaction stall_poll{};
+        struct stall_state stall{false, false};
+        volatile bool stall_alarm{false};
+        uint8_t actuator;
+        bool halt_on_stall{false};
+
+        // the current is only raised to current while the motor accelerates or decelerates, and is cruise_current otherwise
+        SPIBus::Transaction current_change{};
+        uint32_t cruise_current{0}; // in milliamps, 0 if not used
+        volatile bool boosted{true}; // the chip has current rather than cruise_current
 
 };
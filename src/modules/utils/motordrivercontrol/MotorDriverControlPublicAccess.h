@@ -0,0 +1,20 @@
+#ifndef __MOTORDRIVERCONTROLPUBLICACCESS_H
+#define __MOTORDRIVERCONTROLPUBLICACCESS_H
+
+// addresses used for public data access
+#define motor_driver_control_checksum  CHECKSUM("motor_driver_control")
+#define stall_state_checksum           CHECKSUM("stall_state")
+
+// StallGuard state of one driver, shared with the endstops for sensorless homing
+struct stall_state {
+    volatile bool stalled; // the last StallGuard reading, updated from the SSP interrupt while the motor moves
+    volatile bool homing;  // set by the endstops while homing, a stall then stops the axis rather than halting
+};
+
+// the caller sets axis, the driver for that axis sets state
+struct pad_stall {
+    char axis;
+    struct stall_state *state;
+};
+
+#endif // __MOTORDRIVERCONTROLPUBLICACCESS_H
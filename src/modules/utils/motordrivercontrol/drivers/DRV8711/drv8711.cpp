@@ -325,11 +325,24 @@ void DRV8711DRV::WriteAllRegisters()
 }
 
 bool DRV8711DRV::check_alarm()
+{
+    uint8_t tx[2], rx[2];
+    spi(tx, status_request(tx), rx);
+    return check_alarm(rx);
+}
+
+int DRV8711DRV::status_request(uint8_t *tx)
+{
+    tx[0]= REGREAD | (G_STATUS_REG.Address << 4);
+    tx[1]= 0;
+    return 2;
+}
+
+bool DRV8711DRV::check_alarm(const uint8_t *rx)
 {
     bool error= false;
     STATUS_Register_t  R_STATUS_REG;
-    // Read STATUS Register
-    R_STATUS_REG.raw= ReadRegister(G_STATUS_REG.Address);
+    R_STATUS_REG.raw= (rx[0] << 8) | rx[1];
 
     if(R_STATUS_REG.OTS) {
         if(!error_reported.test(0)) THEKERNEL->streams->printf("%c, ERROR: Overtemperature shutdown\n", designator);
@@ -19,6 +19,10 @@ public:
   void dump_status(StreamOutput *stream) ;
   bool set_raw_register(StreamOutput *stream, uint32_t reg, uint32_t val);
   bool check_alarm();
+  // the bytes that read the status register, so it can be polled without waiting for the reply
+  int status_request(uint8_t *tx);
+  // check_alarm on the reply to status_request
+  bool check_alarm(const uint8_t *rx);
 
 private:
 
@@ -252,6 +252,15 @@ void TMC26X::setCurrent(unsigned int current)
     }
 }
 
+unsigned long TMC26X::currentDatagram(unsigned int current) const
+{
+    float voltage = (driver_configuration_register_value & VSENSE) ? 0.165F : 0.31F;
+    int current_scaling = (int)(((float)this->resistor * current * 32.0F / (voltage * 1000.0F * 1000.0F)) - 0.5F);
+    if (current_scaling < 0) current_scaling = 0;
+    if (current_scaling > 31) current_scaling = 31;
+    return (stall_guard2_current_register_value & ~(CURRENT_SCALING_PATTERN)) | current_scaling;
+}
+
 unsigned int TMC26X::getCurrent(void)
 {
     //we calculate the current according to the datasheet to be on the safe side
@@ -966,8 +975,34 @@ void TMC26X::dumpStatus(StreamOutput *stream, bool readable)
 // check error bits and report, only report once
 bool TMC26X::check_error_status_bits(StreamOutput *stream)
 {
-    bool error= false;
     readStatus(TMC26X_READOUT_POSITION); // get the status bits
+    return report_error_status_bits(stream);
+}
+
+// the status bits are in every reply whatever the readout is set to
+int TMC26X::statusRequest(uint8_t *tx)
+{
+    tx[0]= (uint8_t)(driver_configuration_register_value >> 16);
+    tx[1]= (uint8_t)(driver_configuration_register_value >> 8);
+    tx[2]= (uint8_t)(driver_configuration_register_value & 0xff);
+    return 3;
+}
+
+bool TMC26X::isStallGuardReached(const uint8_t *rx)
+{
+    return ((((rx[0] << 16) | (rx[1] << 8) | (rx[2])) >> 4) & STATUS_STALL_GUARD_STATUS) != 0;
+}
+
+bool TMC26X::checkAlarm(const uint8_t *rx)
+{
+    driver_status_result = ((rx[0] << 16) | (rx[1] << 8) | (rx[2])) >> 4;
+    return report_error_status_bits(THEKERNEL->streams);
+}
+
+// report the error bits of the last status read
+bool TMC26X::report_error_status_bits(StreamOutput *stream)
+{
+    bool error= false;
 
     if (this->getOverTemperature()&TMC26X_OVERTEMPERATURE_PREWARING) {
         if(!error_reported.test(0)) stream->printf("%c - WARNING: Overtemperature Prewarning!\n", designator);
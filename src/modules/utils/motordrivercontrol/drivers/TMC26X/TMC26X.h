@@ -175,6 +175,8 @@ public:
      * \sa getCurrentCurrent()
      */
     unsigned int getCurrent(void);
+    // the current scaling datagram for current mA without storing or sending it, keeping the present sense range
+    unsigned long currentDatagram(unsigned int current) const;
 
     /*!
      * \brief set the StallGuard threshold in order to get sensible StallGuard readings.
@@ -371,6 +373,8 @@ public:
      * \sa setStallGuardThreshold() for tuning the readout to sensible ranges.
      */
     bool isStallGuardReached(void);
+    // isStallGuardReached on the reply to statusRequest, does not touch the stored status so it can be called from an interrupt
+    static bool isStallGuardReached(const uint8_t *rx);
 
     /*!
      *\brief enables or disables the motor driver bridges. If disabled the motor can run freely. If enabled not.
@@ -403,6 +407,10 @@ public:
     void dumpStatus(StreamOutput *stream, bool readable= true);
     bool setRawRegister(StreamOutput *stream, uint32_t reg, uint32_t val);
     bool checkAlarm();
+    // the datagram that reads the status bits, so they can be polled without waiting for the reply
+    int statusRequest(uint8_t *tx);
+    // checkAlarm on the reply to statusRequest
+    bool checkAlarm(const uint8_t *rx);
 
     using options_t= std::map<char,int>;
 
@@ -412,6 +420,7 @@ private:
     //helper routione to get the top 10 bit of the readout
     inline int getReadoutValue();
     bool check_error_status_bits(StreamOutput *stream);
+    bool report_error_status_bits(StreamOutput *stream);
 
     // SPI sender
     inline void send262(unsigned long datagram);
@@ -67,6 +67,10 @@
 #define panel_display_message_checksum CHECKSUM("display_message")
 #define laser_checksum             CHECKSUM("laser")
 #define display_extruder_checksum  CHECKSUM("display_extruder")
+#define input_interrupts_checksum  CHECKSUM("input_interrupts")
+
+// how many button ticks the buttons are polled for after an edge, enough for the debounce to settle
+#define BUTTON_POLLS 10
 
 Panel* Panel::instance= nullptr;
 
@@ -85,6 +89,10 @@ Panel::Panel()
     this->lcd = NULL;
     this->do_buttons = false;
     this->do_encoder = false;
+    this->input_irq = false;
+    this->button_edges = 0;
+    this->seen_edges = 0;
+    this->button_polls = 0;
     this->idle_time = 0;
     this->start_up = true;
     this->current_screen = NULL;
@@ -186,8 +194,15 @@ void Panel::on_module_loaded()
 //    this->back_button.set_longpress_delay(longpress_delay);
 //    this->pause_button.set_longpress_delay(longpress_delay);
 
+    // the encoder and buttons are read on their pin edges when the panel can, polling them is the fallback
+    if(!lcd->encoderReturnsDelta() && THEKERNEL->config->value( panel_checksum, input_interrupts_checksum )->by_default(true)->as_bool()) {
+        this->input_irq = lcd->attachInputInterrupts();
+    }
+
     THEKERNEL->slow_ticker->attach( 50,  this, &Panel::button_tick );
-    if(lcd->encoderReturnsDelta()) {
+    if(this->input_irq) {
+        // encoder_check is called by the edges
+    }else if(lcd->encoderReturnsDelta()) {
         // panel handles encoder pins and returns a delta
         THEKERNEL->slow_ticker->attach( 10, this, &Panel::encoder_tick );
     }else{
@@ -199,9 +214,9 @@ void Panel::on_module_loaded()
     this->display_extruder = THEKERNEL->config->value( panel_checksum, display_extruder_checksum )->by_default(false)->as_bool();
 
     // Register for events
-    this->register_for_event(ON_IDLE);
-    this->register_for_event(ON_MAIN_LOOP);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    this->register_for_event(ON_IDLE, PRIORITY_LOW);
+    this->register_for_event(ON_MAIN_LOOP, PRIORITY_LOW);
+    PublicData::register_set(panel_checksum, this);
 
     // Refresh timer
     THEKERNEL->slow_ticker->attach( 20, this, &Panel::refresh_tick );
@@ -273,10 +288,25 @@ uint32_t Panel::encoder_check(uint32_t dummy)
 // Read and update each button
 uint32_t Panel::button_tick(uint32_t dummy)
 {
+    if(this->input_irq) {
+        // only polled while they settle after an edge, or are held
+        if(this->button_edges != this->seen_edges) {
+            this->seen_edges = this->button_edges;
+            this->button_polls = BUTTON_POLLS;
+        }
+        if(this->button_polls == 0) return 0;
+        --this->button_polls;
+    }
     this->do_buttons = true;
     return 0;
 }
 
+// a button pin changed, called from its interrupt
+void Panel::button_edge()
+{
+    ++this->button_edges;
+}
+
 // Read and update encoder from a slow source
 uint32_t Panel::encoder_tick(uint32_t dummy)
 {
@@ -404,6 +434,8 @@ void Panel::idle_processing()
         // read the actual buttons
         int but = lcd->readButtons();
         if (but != 0) {
+            // held, kept polled for the repeat and for the release to be debounced
+            this->button_polls = BUTTON_POLLS;
             this->idle_time = 0;
             if(current_screen == NULL) {
                 // we were in startup screen so go to watch screen
@@ -684,6 +716,7 @@ bool Panel::mount_external_sd(bool on)
             void *v = AHB0.alloc(n);
             memset(v, 0, n); // clear the allocated memory
             this->sd= new(v) SDCard(mosi, miso, sclk, cs); // allocate object using zeroed memory
+            this->sd->set_max_frequency(2500000); // it is at the end of the panel cable so keep the old clock
         }
         delete this->extmounter; // if it was not unmounted before
         size_t n= sizeof(SDFAT);
@@ -45,6 +45,7 @@ class Panel : public Module {
         uint32_t on_select(uint32_t dummy);
         uint32_t refresh_tick(uint32_t dummy);
         uint32_t encoder_check(uint32_t dummy);
+        void button_edge();
         bool counter_change();
         bool click();
         int get_encoder_resolution() const { return encoder_click_resolution; }
@@ -139,6 +140,11 @@ class Panel : public Module {
 
         char playing_file[20];
 
+        // button edges counted by their interrupt, and the count button_tick last saw
+        volatile uint8_t button_edges;
+        uint8_t seen_edges;
+        volatile uint8_t button_polls;
+
         volatile struct {
             uint16_t screen_lines:16;
             uint16_t menu_current_line:16;
@@ -156,6 +162,7 @@ class Panel : public Module {
             volatile bool refresh_flag:1;
             volatile bool do_buttons:1;
             volatile bool do_encoder:1;
+            bool input_irq:1;
 
             char mode:2;
             char menu_offset:3;
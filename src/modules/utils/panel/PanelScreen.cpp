@@ -48,6 +48,27 @@ void PanelScreen::refresh_screen(bool clear)
     }
 }
 
+void PanelScreen::refresh_changed_lines(const uint32_t *keys, uint32_t *drawn, uint16_t n)
+{
+    for (uint16_t i = 0; i < n && (int)i < THEPANEL->panel_lines; i++) {
+        if (keys[i] == drawn[i]) continue;
+        drawn[i] = keys[i];
+        THEPANEL->lcd->setCursor(0, i);
+        this->display_menu_line(i);
+    }
+}
+
+// FNV-1a, can be chained by passing the key so far
+uint32_t PanelScreen::line_key(const void *p, size_t n, uint32_t key)
+{
+    const uint8_t *b = (const uint8_t *)p;
+    while (n-- > 0) {
+        key ^= *b++;
+        key *= 16777619UL;
+    }
+    return key;
+}
+
 PanelScreen *PanelScreen::set_parent(PanelScreen *passed_parent)
 {
     this->parent = passed_parent;
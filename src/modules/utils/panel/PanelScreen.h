@@ -10,6 +10,8 @@
 
 #include <string>
 #include <deque>
+#include <stdint.h>
+#include <stddef.h>
 
 class Panel;
 
@@ -29,12 +31,16 @@ public:
     void refresh_menu(bool clear);
     void refresh_menu(void) { refresh_menu(true); };
     virtual void display_menu_line(uint16_t line) = 0;
+    // redraw only the first n lines whose key is not the one in drawn, which is then updated
+    // a screen makes the key of a line from the values it shows with line_key
+    void refresh_changed_lines(const uint32_t *keys, uint32_t *drawn, uint16_t n);
     // default idle timeout for a screen, each screen can override this
     virtual int idle_timeout_secs(){ return 10; }
 
     friend class Panel;
 protected:
     void get_current_pos(float *p);
+    static uint32_t line_key(const void *p, size_t n, uint32_t key= 2166136261UL);
     void send_gcode(std::string g);
     void send_gcode(const char *gm_code, char parameter, float value);
     void send_command(const char *gcstr);
@@ -1,10 +1,14 @@
 #include "LcdBase.h"
+#include "Panel.h"
+#include "Pin.h"
+
+#include "InterruptIn.h" // mbed
 
 #include "stdarg.h"
 #include "stdio.h"
 
-LcdBase::LcdBase() {}
-LcdBase::~LcdBase() {}
+LcdBase::LcdBase() { n_irqs= 0; }
+LcdBase::~LcdBase() { detach_input_irqs(); }
 
 int LcdBase::printf(const char* format, ...){
     va_list args;
@@ -15,3 +19,52 @@ int LcdBase::printf(const char* format, ...){
     this->write(buffer, n);
     return n;
 }
+
+bool LcdBase::attach_input_irqs(const Pin& encoder_a, const Pin& encoder_b, const Pin *const *buttons, int n)
+{
+    const Pin *pins[sizeof(irqs) / sizeof(irqs[0])];
+    int np= 0;
+    if(encoder_a.connected() && encoder_b.connected()) {
+        pins[np++]= &encoder_a;
+        pins[np++]= &encoder_b;
+    }
+    for (int i = 0; i < n && np < (int)(sizeof(pins) / sizeof(pins[0])); ++i) {
+        if(buttons[i]->connected()) pins[np++]= buttons[i];
+    }
+    if(np == 0) return false;
+
+    for (int i = 0; i < np; ++i) {
+        Pin p= *pins[i]; // interrupt_pin() marks a pin it can't use as invalid, and it still needs to be polled
+        mbed::InterruptIn *irq= p.interrupt_pin();
+        if(irq == nullptr) {
+            // all of them or none, a mix would still have to be polled as fast as the encoder turns
+            detach_input_irqs();
+            return false;
+        }
+        irqs[n_irqs++]= irq;
+        if(pins[i] == &encoder_a || pins[i] == &encoder_b) {
+            irq->rise(this, &LcdBase::encoder_edge);
+            irq->fall(this, &LcdBase::encoder_edge);
+        } else {
+            irq->rise(this, &LcdBase::button_edge);
+            irq->fall(this, &LcdBase::button_edge);
+        }
+    }
+    return true;
+}
+
+void LcdBase::detach_input_irqs()
+{
+    while(n_irqs > 0) delete irqs[--n_irqs];
+}
+
+// every edge of either pin is one step of the quadrature, so none are missed however fast it turns
+void LcdBase::encoder_edge()
+{
+    panel->encoder_check(0);
+}
+
+void LcdBase::button_edge()
+{
+    panel->button_edge();
+}
@@ -20,6 +20,11 @@
 #define LED_HOT       4
 
 class Panel;
+class Pin;
+
+namespace mbed {
+    class InterruptIn;
+}
 
 class LcdBase {
     public:
@@ -54,6 +59,9 @@ class LcdBase {
         virtual void buzz(long,uint16_t){};
         virtual bool hasGraphics() { return false; }
         virtual bool encoderReturnsDelta() { return false; } // set to true if the panel handles encoder clicks and returns a delta
+        // the panel reads its encoder and buttons on their pin edges so they need not be polled, false if it does not
+        // read them from pins or one of them is on a pin that can not interrupt
+        virtual bool attachInputInterrupts() { return false; }
         virtual uint8_t getContrast() { return 0; }
         virtual void setContrast(uint8_t c) { }
 
@@ -72,7 +80,16 @@ class LcdBase {
     protected:
         Panel* panel;
         virtual void write(const char* line, int len)= 0;
+        // the edges of the encoder pins read the encoder, the edges of the buttons start them being polled
+        bool attach_input_irqs(const Pin& encoder_a, const Pin& encoder_b, const Pin *const *buttons, int n);
+
+    private:
+        void encoder_edge();
+        void button_edge();
+        void detach_input_irqs();
 
+        mbed::InterruptIn *irqs[8];
+        uint8_t n_irqs;
 };
 
 #endif // LCDBASE_H
@@ -63,6 +63,11 @@ int ReprapDiscountGLCD::readEncoderDelta() {
     return  enc_states[(old_AB&0x0f)];
 }
 
+bool ReprapDiscountGLCD::attachInputInterrupts() {
+    const Pin *buttons[]= {&this->click_pin, &this->back_pin};
+    return attach_input_irqs(this->encoder_a_pin, this->encoder_b_pin, buttons, 2);
+}
+
 // cycle the buzzer pin at a certain frequency (hz) for a certain duration (ms)
 void ReprapDiscountGLCD::buzz(long duration, uint16_t freq) {
     if(!this->buzz_pin.connected()) return;
@@ -23,6 +23,7 @@ class ReprapDiscountGLCD : public LcdBase {
 
         uint8_t readButtons();
         int readEncoderDelta();
+        bool attachInputInterrupts();
         void write(const char* line, int len);
         void home();
         void clear();
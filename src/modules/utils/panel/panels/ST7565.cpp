@@ -13,6 +13,7 @@
 #include "checksumm.h"
 #include "StreamOutputPool.h"
 #include "ConfigValue.h"
+#include "SPIBus.h"
 
 
 
@@ -21,6 +22,9 @@
 #define LCDHEIGHT 64
 #define LCDPAGES  (LCDHEIGHT+7)/8
 #define FB_SIZE LCDWIDTH*LCDPAGES
+// each page is sent in pieces this wide, a piece is only sent when it has changed since it was last sent
+#define PIECE_WIDTH 32
+#define PIECES (LCDWIDTH/PIECE_WIDTH*LCDPAGES)
 #define FONT_SIZE_X 6
 #define FONT_SIZE_Y 8
 
@@ -79,7 +83,7 @@ ST7565::ST7565(uint8_t variant)
 
     //SPI com
     // select which SPI channel to use
-    int spi_channel = THEKERNEL->config->value(panel_checksum, spi_channel_checksum)->by_default(0)->as_number();
+    spi_channel = THEKERNEL->config->value(panel_checksum, spi_channel_checksum)->by_default(0)->as_number();
     PinName mosi, miso, sclk;
     if(spi_channel == 0) {
         mosi = P0_18; miso = P0_17; sclk = P0_15;
@@ -90,7 +94,9 @@ ST7565::ST7565(uint8_t variant)
     }
 
     this->spi = new mbed::SPI(mosi, miso, sclk);
+    SPIBus::hold(spi_channel);
     this->spi->frequency(THEKERNEL->config->value(panel_checksum, spi_frequency_checksum)->by_default(1000000)->as_number()); //4Mhz freq, can try go a little lower
+    SPIBus::release(spi_channel);
 
     //chip select
     this->cs.from_string(THEKERNEL->config->value( panel_checksum, spi_cs_pin_checksum)->by_default("0.16")->as_string())->as_output();
@@ -150,10 +156,12 @@ ST7565::ST7565(uint8_t variant)
     // reverse display
     this->reversed = THEKERNEL->config->value(panel_checksum, reverse_checksum)->by_default(this->reversed)->as_bool();
 
-    framebuffer = (uint8_t *)AHB0.alloc(FB_SIZE); // grab some memory from USB_RAM
+    framebuffer = (uint8_t *)AHB0.alloc(FB_SIZE + PIECES * sizeof(uint32_t)); // grab some memory from USB_RAM
     if(framebuffer == NULL) {
         THEKERNEL->streams->printf("Not enough memory available for frame buffer");
     }
+    sent = (uint32_t *)(framebuffer + FB_SIZE);
+    resend = true;
 
 }
 
@@ -166,23 +174,27 @@ ST7565::~ST7565()
 //send commands to lcd
 void ST7565::send_commands(const unsigned char *buf, size_t size)
 {
+    SPIBus::hold(spi_channel);
     cs.set(0);
     if(a0.connected()) a0.set(0);
     while(size-- > 0) {
         spi->write(*buf++);
     }
     cs.set(1);
+    SPIBus::release(spi_channel);
 }
 
 //send data to lcd
 void ST7565::send_data(const unsigned char *buf, size_t size)
 {
+    SPIBus::hold(spi_channel);
     cs.set(0);
     if(a0.connected()) a0.set(1);
     while(size-- > 0) {
         spi->write(*buf++);
     }
     cs.set(1);
+    SPIBus::release(spi_channel);
     if(a0.connected()) a0.set(0);
 }
 
@@ -202,6 +214,32 @@ void ST7565::send_pic(const unsigned char *data)
     }
 }
 
+// FNV-1a, to tell if a piece of the frame buffer differs from what was last sent
+static uint32_t piece_hash(const unsigned char *p, int n)
+{
+    uint32_t h = 2166136261UL;
+    while(n-- > 0) {
+        h ^= *p++;
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+// send only the pieces of the frame buffer that have changed, the screens redraw everything each time but
+// usually only a few characters are different
+void ST7565::send_changes()
+{
+    for (int i = 0; i < PIECES; i++) {
+        const unsigned char *p = framebuffer + i * PIECE_WIDTH;
+        uint32_t h = piece_hash(p, PIECE_WIDTH);
+        if(!resend && h == sent[i]) continue;
+        sent[i] = h;
+        set_xy((i * PIECE_WIDTH) % LCDWIDTH + 4, i * PIECE_WIDTH / LCDWIDTH);
+        send_data(p, PIECE_WIDTH);
+    }
+    resend = false;
+}
+
 // set column and page number
 void ST7565::set_xy(int x, int y)
 {
@@ -316,6 +354,8 @@ void ST7565::init()
     }
 
     clear();
+    // the display ram is not cleared by the reset
+    resend = true;
 }
 
 void ST7565::setContrast(uint8_t c)
@@ -381,7 +421,7 @@ void ST7565::on_refresh(bool now)
     refresh_counts++;
     // 10Hz refresh rate
     if(now || refresh_counts % 2 == 0 ) {
-        send_pic(framebuffer);
+        send_changes();
     }
 }
 
@@ -417,6 +457,12 @@ int ST7565::readEncoderDelta()
     }
 }
 
+bool ST7565::attachInputInterrupts()
+{
+    const Pin *buttons[]= {&this->click_pin, &this->up_pin, &this->down_pin, &this->aux_pin};
+    return attach_input_irqs(this->encoder_a_pin, this->encoder_b_pin, buttons, 4);
+}
+
 void ST7565::bltGlyph(int x, int y, int w, int h, const uint8_t *glyph, int span, int x_offset, int y_offset)
 {
     if(x_offset == 0 && y_offset == 0 && span == 0) {
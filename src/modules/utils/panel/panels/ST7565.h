@@ -28,6 +28,7 @@ public:
 	//encoder which dosent exist :/
 	uint8_t readButtons();
 	int readEncoderDelta();
+	bool attachInputInterrupts();
 	int getEncoderResolution() { return is_viki2 ? 4 : 2; }
 	uint16_t get_screen_lines() { return 8; }
 	bool hasGraphics() { return true; }
@@ -39,6 +40,8 @@ public:
 	void set_xy(int x, int y);
 	//send pic to whole screen
 	void send_pic(const unsigned char* data);
+	//send the parts of the framebuffer that changed since the last time
+	void send_changes();
 	//drawing char
 	int drawChar(int x, int y, unsigned char c, int color);
     // blit a glyph of w pixels wide and h pixels high to x, y. offset pixel position in glyph by x_offset, y_offset.
@@ -58,7 +61,9 @@ private:
 
     //buffer
 	unsigned char *framebuffer;
+	uint32_t *sent; // hash of each piece of the framebuffer as it was last sent
 	mbed::SPI* spi;
+	int spi_channel;
 	Pin cs;
 	Pin rst;
 	Pin a0;
@@ -82,6 +87,7 @@ private:
         bool is_ssd1306:1;
         bool use_pause:1;
         bool use_back:1;
+        bool resend:1;
     };
 };
 
@@ -13,6 +13,7 @@
 #include "libs/Pin.h"
 #include "StreamOutputPool.h"
 #include "utils.h"
+#include "SPIBus.h"
 
 // config settings
 #define panel_checksum             CHECKSUM("panel")
@@ -38,11 +39,13 @@
 UniversalAdapter::SPIFrame::SPIFrame(UniversalAdapter *pu)
 {
     this->u = pu;
+    SPIBus::hold(u->spi_channel);
     u->cs_pin->set(0);
 }
 UniversalAdapter::SPIFrame::~SPIFrame()
 {
     u->cs_pin->set(1);
+    SPIBus::release(u->spi_channel);
 }
 
 UniversalAdapter::UniversalAdapter()
@@ -55,7 +58,7 @@ UniversalAdapter::UniversalAdapter()
     this->busy_pin->from_string(THEKERNEL->config->value( panel_checksum, busy_pin_checksum)->by_default("nc")->as_string())->as_input();
 
     // select which SPI channel to use
-    int spi_channel = THEKERNEL->config->value(panel_checksum, spi_channel_checksum)->by_default(0)->as_number();
+    spi_channel = THEKERNEL->config->value(panel_checksum, spi_channel_checksum)->by_default(0)->as_number();
     PinName mosi, miso, sclk;
     if(spi_channel == 0) {
         mosi = P0_18; miso = P0_17; sclk = P0_15;
@@ -70,7 +73,9 @@ UniversalAdapter::UniversalAdapter()
     this->cs_pin->set(1);
 
     int spi_frequency = THEKERNEL->config->value(panel_checksum, spi_frequency_checksum)->by_default(500000)->as_int();
+    SPIBus::hold(spi_channel);
     this->spi->frequency(spi_frequency);
+    SPIBus::release(spi_channel);
     ledBits = 0;
 }
 
@@ -51,6 +51,7 @@ class UniversalAdapter : public LcdBase {
         uint8_t sendReadCmd(uint8_t cmd);
         uint16_t ledBits;
         mbed::SPI* spi;
+        int spi_channel;
         Pin *cs_pin;
         Pin *busy_pin;
 };
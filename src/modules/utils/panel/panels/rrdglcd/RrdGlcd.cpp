@@ -2,6 +2,7 @@
 
 #include "platform_memory.h"
 #include "StreamOutputPool.h"
+#include "SPIBus.h"
 
 static const uint8_t font5x8[] = {
     // 5x8 font each byte is consecutive x bits left aligned then each subsequent byte is Y 8 bytes per character
@@ -136,8 +137,8 @@ static const uint8_t font5x8[] = {
     0x00,0x00,0x78,0x78,0x78,0x78,0x00,0x00
 };
 
-#define ST7920_CS()              {cs.set(1);wait_us(10);}
-#define ST7920_NCS()             {cs.set(0);wait_us(10);}
+#define ST7920_CS()              {SPIBus::hold(spi_channel);cs.set(1);wait_us(10);}
+#define ST7920_NCS()             {cs.set(0);wait_us(10);SPIBus::release(spi_channel);}
 #define ST7920_WRITE_BYTE(a)     {this->spi->write((a)&0xf0);this->spi->write((a)<<4);wait_us(10);}
 #define ST7920_WRITE_BYTES(p,l)  {uint8_t i;for(i=0;i<l;i++){this->spi->write(*p&0xf0);this->spi->write(*p<<4);p++;} wait_us(10); }
 #define ST7920_SET_CMD()         {this->spi->write(0xf8);wait_us(10);}
@@ -148,6 +149,7 @@ static const uint8_t font5x8[] = {
 #define FB_SIZE WIDTH*HEIGHT/8
 
 RrdGlcd::RrdGlcd(int spi_channel, Pin cs) {
+    this->spi_channel= spi_channel;
     PinName mosi, miso, sclk;
     if(spi_channel == 0) {
         mosi = P0_18; miso = P0_17; sclk = P0_15;
@@ -162,12 +164,14 @@ RrdGlcd::RrdGlcd(int spi_channel, Pin cs) {
     //chip select
     this->cs= cs;
     this->cs.set(0);
-    fb= (uint8_t *)AHB0.alloc(FB_SIZE); // grab some memoery from USB_RAM
+    fb= (uint8_t *)AHB0.alloc(FB_SIZE + HEIGHT*sizeof(uint32_t)); // grab some memoery from USB_RAM
     if(fb == NULL) {
         THEKERNEL->streams->printf("Not enough memory available for frame buffer");
     }
+    sent= (uint32_t *)(fb + FB_SIZE);
     inited= false;
     dirty= false;
+    resend= true;
 }
 
 RrdGlcd::~RrdGlcd() {
@@ -176,7 +180,9 @@ RrdGlcd::~RrdGlcd() {
 }
 
 void RrdGlcd::setFrequency(int freq) {
+       SPIBus::hold(spi_channel);
        this->spi->frequency(freq);
+       SPIBus::release(spi_channel);
 }
 
 void RrdGlcd::initDisplay() {
@@ -201,6 +207,7 @@ void RrdGlcd::initDisplay() {
     ST7920_WRITE_BYTE(0x0C); //display on, cursor+blink off
     ST7920_NCS();
     inited= true;
+    resend= true;
 }
 
 void RrdGlcd::clearScreen() {
@@ -317,8 +324,34 @@ void RrdGlcd::fillGDRAM(const uint8_t *bitmap) {
     }
 }
 
+// FNV-1a, to tell if a line of the frame buffer differs from what was last sent
+static uint32_t line_hash(const uint8_t *p, int n) {
+    uint32_t h= 2166136261UL;
+    while(n-- > 0) {
+        h ^= *p++;
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+// only send the lines that have changed since they were last sent, the screens redraw everything each time
+// but usually only a few characters are different
 void RrdGlcd::refresh() {
     if(!inited || !dirty) return;
-    fillGDRAM(this->fb);
+    ST7920_CS();
+    for(int y=0;y<HEIGHT;y++) {
+        const uint8_t *line= &fb[y*WIDTH/8];
+        uint32_t h= line_hash(line, WIDTH/8);
+        if(!resend && h == sent[y]) continue;
+        sent[y]= h;
+        // the bottom half of the screen is to the right of the top half in GDRAM
+        ST7920_SET_CMD();
+        ST7920_WRITE_BYTE(0x80 | (y % PAGE_HEIGHT));
+        ST7920_WRITE_BYTE(y < PAGE_HEIGHT ? 0x80 : 0x80 | 0x08);
+        ST7920_SET_DAT();
+        ST7920_WRITE_BYTES(line, WIDTH/8); // line gets incremented in this macro
+    }
+    ST7920_NCS();
+    resend= false;
     dirty= false;
 }
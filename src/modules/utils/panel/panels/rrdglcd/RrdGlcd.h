@@ -54,12 +54,15 @@ public:
 private:
     Pin cs;
     mbed::SPI* spi;
+    int spi_channel;
     void renderChar(uint8_t *fb, char c, int ox, int oy);
     void displayChar(int row, int column,char inpChr);
 
     uint8_t *fb;
+    uint32_t *sent; // hash of each line of fb as it was last sent
     bool inited;
     bool dirty;
+    bool resend;
 };
 #endif
 
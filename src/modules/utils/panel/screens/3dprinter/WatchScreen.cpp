@@ -65,13 +65,6 @@ void WatchScreen::on_enter()
 {
     THEPANEL->lcd->clear();
     THEPANEL->setup_menu(4);
-    get_current_status();
-    get_current_pos(this->pos);
-    get_sd_play_info();
-    this->current_speed = lroundf(get_current_speed());
-    this->refresh_screen(false);
-    THEPANEL->enter_control_mode(1, 0.5);
-    THEPANEL->set_control_value(this->current_speed);
 
     // enumerate temperature controls
     temp_controllers.clear();
@@ -82,13 +75,69 @@ void WatchScreen::on_enter()
             temp_controllers.push_back(c.id);
         }
     }
+
+    get_current_status();
+    get_current_pos(this->pos);
+    get_sd_play_info();
+    get_temperatures();
+    get_extruder_pos();
+    this->current_speed = lroundf(get_current_speed());
+    this->refresh_screen(false);
+    make_keys(this->drawn);
+    THEPANEL->enter_control_mode(1, 0.5);
+    THEPANEL->set_control_value(this->current_speed);
+}
+
+void WatchScreen::get_temperatures()
+{
+    temps.resize(temp_controllers.size());
+    for (size_t i = 0; i < temp_controllers.size(); ++i) {
+        if(!PublicData::get_value( temperature_control_checksum, current_temperature_checksum, temp_controllers[i], &temps[i] )) {
+            temps[i].current_temperature = temps[i].target_temperature = 0;
+        }
+    }
 }
 
-static struct pad_temperature getTemperatures(uint16_t heater_cs)
+void WatchScreen::get_extruder_pos()
 {
-    struct pad_temperature temp;
-    PublicData::get_value( temperature_control_checksum, current_temperature_checksum, heater_cs, &temp );
-    return temp;
+    pad_extruder_t rd;
+    this->show_extruder = THEPANEL->is_extruder_display_enabled() && THEPANEL->is_playing() && PublicData::get_value(extruder_checksum, (void *)&rd);
+    this->extruder_pos = this->show_extruder ? rd.current_position : 0;
+}
+
+// which pair of temperatures line 0 shows, more than two are cycled through every 5 seconds
+static size_t temperature_pair(size_t n, uint32_t update_counts)
+{
+    if(n <= 2) return 0;
+    return (update_counts / 100) % ((n + 1) / 2);
+}
+
+// the key of each line is made from what it shows as it is shown, so a line is only redrawn when it will look different
+void WatchScreen::make_keys(uint32_t *keys)
+{
+    int32_t v[5];
+    size_t n = temperature_pair(temps.size(), update_counts);
+    keys[0] = line_key(&n, sizeof(n));
+    for (auto &t : temps) {
+        v[0] = roundf(t.current_temperature);
+        v[1] = roundf(t.target_temperature);
+        keys[0] = line_key(v, 2 * sizeof(int32_t), keys[0]);
+    }
+
+    v[0] = show_extruder;
+    v[1] = lroundf(extruder_pos * 100);
+    v[2] = round(pos[0]);
+    v[3] = round(pos[1]);
+    v[4] = lroundf(pos[2] * 100);
+    keys[1] = line_key(v, sizeof(v));
+
+    v[0] = current_speed;
+    v[1] = elapsed_time;
+    v[2] = sd_pcnt_played;
+    keys[2] = line_key(v, 3 * sizeof(int32_t));
+
+    const char *s = get_status();
+    keys[3] = line_key(s, strlen(s));
 }
 
 void WatchScreen::on_refresh()
@@ -110,7 +159,9 @@ void WatchScreen::on_refresh()
             // flag the update to change the speed, we don't want to issue hundreds of M220s
             // but we do want to display the change we are going to make
             this->speed_changed = true; // flag indicating speed changed
-            this->refresh_screen(false);
+            uint32_t keys[4];
+            make_keys(keys);
+            refresh_changed_lines(keys, this->drawn, 4);
         }
     }
 
@@ -120,6 +171,8 @@ void WatchScreen::on_refresh()
         get_sd_play_info();
         get_current_pos(this->pos);
         get_current_status();
+        get_temperatures();
+        get_extruder_pos();
         if (this->speed_changed) {
             this->issue_change_speed = true; // trigger actual command to change speed
             this->speed_changed = false;
@@ -130,13 +183,20 @@ void WatchScreen::on_refresh()
             THEPANEL->reset_counter();
         }
 
-        this->refresh_screen(THEPANEL->lcd->hasGraphics() ? true : false); // graphics screens should be cleared
+        uint32_t keys[4];
+        make_keys(keys);
+        if (THEPANEL->lcd->hasGraphics()) {
+            // graphics screens should be cleared, the lcd only sends what changed in its frame buffer
+            this->refresh_screen(true);
+            memcpy(this->drawn, keys, sizeof(keys));
+        } else {
+            refresh_changed_lines(keys, this->drawn, 4);
+        }
 
         // for LCDs with leds set them according to heater status
         bool bed_on= false, hotend_on= false, is_hot= false;
         uint8_t heon=0, hemsk= 0x01; // bit set for which hotend is on bit0: hotend1, bit1: hotend2 etc
-        for(auto id : temp_controllers) {
-            struct pad_temperature c= getTemperatures(id);
+        for(auto &c : temps) {
             if(c.current_temperature > 50) is_hot= true; // anything is hot
             if(c.designator.front() == 'B' && c.target_temperature > 0) bed_on= true;   // bed on/off
             if(c.designator.front() == 'T') { // a hotend by convention
@@ -225,22 +285,16 @@ void WatchScreen::display_menu_line(uint16_t line)
     switch ( line ) {
         case 0:
         {
-            auto& tm= this->temp_controllers;
+            auto& tm= this->temps;
             if(tm.size() > 0) {
                 // only if we detected heaters in config
-                int n= 0;
-                if(tm.size() > 2) {
-                    // more than two temps we need to cycle between them
-                    n= update_counts/100; // increments every 5 seconds
-                    int ntemps= (tm.size()+1)/2;
-                    n= n%ntemps; // which of the pairs of temps to display
-                }
+                size_t n= temperature_pair(tm.size(), update_counts);
 
                 int off= 0;
                 for (size_t i = 0; i < 2; ++i) {
                     size_t o= i+(n*2);
                     if(o>tm.size()-1) break;
-                    struct pad_temperature temp= getTemperatures(tm[o]);
+                    const struct pad_temperature &temp= tm[o];
                     int t= std::min(999, (int)roundf(temp.current_temperature));
                     int tt= roundf(temp.target_temperature);
                     THEPANEL->lcd->setCursor(off, 0); // col, row
@@ -253,10 +307,8 @@ void WatchScreen::display_menu_line(uint16_t line)
             break;
         }
         case 1: {
-            pad_extruder_t rd;
-            if ( THEPANEL->is_extruder_display_enabled() && THEPANEL->is_playing() && PublicData::get_value(extruder_checksum, (void *)&rd)) {
-                float extruder_pos = rd.current_position;
-                THEPANEL->lcd->printf("E %1.2f", extruder_pos);
+            if ( this->show_extruder ) {
+                THEPANEL->lcd->printf("E %1.2f", this->extruder_pos);
                 THEPANEL->lcd->setCursor(12, line);
                 THEPANEL->lcd->printf("Z%7.2f", this->pos[2]);
             } else {
@@ -9,8 +9,10 @@
 #define WATCHSCREEN_H
 
 #include "PanelScreen.h"
+#include "TemperatureControlPublicAccess.h"
 
 #include <tuple>
+#include <vector>
 
 class WatchScreen : public PanelScreen
 {
@@ -29,8 +31,15 @@ private:
     void get_sd_play_info();
     const char *get_status();
     const char *get_network();
+    void get_temperatures();
+    void get_extruder_pos();
+    void make_keys(uint32_t *keys);
 
     std::vector<uint16_t> temp_controllers;
+    // fetched once a second, the lines are drawn from these
+    std::vector<struct pad_temperature> temps;
+    float extruder_pos;
+    uint32_t drawn[4]; // key of each line as it was last drawn
 
     uint32_t update_counts;
     int current_speed;
@@ -43,6 +52,7 @@ private:
         bool speed_changed:1;
         bool issue_change_speed:1;
         bool fan_state:1;
+        bool show_extruder:1;
     };
 };
 
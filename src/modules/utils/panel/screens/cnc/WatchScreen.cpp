@@ -58,8 +58,10 @@ void WatchScreen::on_enter()
     get_current_status();
     get_wpos();
     get_sd_play_info();
+    get_feed_and_laser();
     this->current_speed = lroundf(get_current_speed());
     this->refresh_screen(false);
+    make_keys(this->drawn);
     THEPANEL->enter_control_mode(1, 0.5);
     THEPANEL->set_control_value(this->current_speed);
 }
@@ -83,7 +85,9 @@ void WatchScreen::on_refresh()
             // flag the update to change the speed, we don't want to issue hundreds of M220s
             // but we do want to display the change we are going to make
             this->speed_changed = true; // flag indicating speed changed
-            this->refresh_screen(false);
+            uint32_t keys[8];
+            make_keys(keys);
+            refresh_changed_lines(keys, this->drawn, 8);
         }
     }
 
@@ -93,6 +97,7 @@ void WatchScreen::on_refresh()
         get_sd_play_info();
         get_wpos();
         get_current_status();
+        get_feed_and_laser();
         if (this->speed_changed) {
             this->issue_change_speed = true; // trigger actual command to change speed
             this->speed_changed = false;
@@ -103,8 +108,63 @@ void WatchScreen::on_refresh()
             THEPANEL->reset_counter();
         }
 
-        this->refresh_screen(THEPANEL->lcd->hasGraphics() ? true : false); // graphics screens should be cleared
+        uint32_t keys[8];
+        make_keys(keys);
+        if (THEPANEL->lcd->hasGraphics()) {
+            // graphics screens should be cleared, the lcd only sends what changed in its frame buffer
+            this->refresh_screen(true);
+            memcpy(this->drawn, keys, sizeof(keys));
+        } else {
+            refresh_changed_lines(keys, this->drawn, 8);
+        }
+    }
+}
+
+void WatchScreen::get_feed_and_laser()
+{
+    this->feed_rate = THEROBOT->from_millimeters(THEROBOT->get_feed_rate());
+    this->current_feed_rate = THEROBOT->from_millimeters(THEKERNEL->conveyor->get_current_feedrate() * 60.0F);
+    this->show_laser = false;
+    if(THEPANEL->has_laser()) {
+        #ifndef NO_TOOLS_LASER
+        Laser *plaser= nullptr;
+        if(PublicData::get_value(laser_checksum, (void *)&plaser) && plaser != nullptr) {
+            this->show_laser = true;
+            this->laser_s = THEROBOT->get_s_value();
+            this->laser_power = plaser->get_current_power();
+        }
+        #endif
+    }
+}
+
+// the key of each line is made from what it shows as it is shown, so a line is only redrawn when it will look different
+void WatchScreen::make_keys(uint32_t *keys)
+{
+    int32_t v[3];
+    v[0] = THEROBOT->inch_mode;
+    keys[0] = line_key(v, sizeof(int32_t));
+    for (int i = 0; i < 3; ++i) {
+        v[0] = lroundf(wpos[i] * 1000);
+        v[1] = lroundf(mpos[i] * 1000);
+        keys[i + 1] = line_key(v, 2 * sizeof(int32_t));
     }
+
+    v[0] = lroundf(feed_rate * 10);
+    v[1] = lroundf(current_feed_rate * 10);
+    keys[4] = line_key(wcs.data(), wcs.size(), line_key(v, 2 * sizeof(int32_t)));
+
+    v[0] = current_speed;
+    v[1] = elapsed_time;
+    v[2] = sd_pcnt_played;
+    keys[5] = line_key(v, sizeof(v));
+
+    v[0] = show_laser;
+    v[1] = show_laser ? lroundf(laser_s * 10000) : 0;
+    v[2] = show_laser ? lroundf(laser_power * 100) : 0;
+    keys[6] = line_key(v, sizeof(v));
+
+    const char *s = get_status();
+    keys[7] = line_key(s, strlen(s));
 }
 
 void WatchScreen::get_wpos()
@@ -180,20 +240,10 @@ void WatchScreen::display_menu_line(uint16_t line)
         case 1: THEPANEL->lcd->printf("X %8.3f %8.3f", wpos[0], mpos[0]); break;
         case 2: THEPANEL->lcd->printf("Y %8.3f %8.3f", wpos[1], mpos[1]); break;
         case 3: THEPANEL->lcd->printf("Z %8.3f %8.3f", wpos[2], mpos[2]); break;
-        case 4: THEPANEL->lcd->printf("%s F%6.1f/%6.1f", this->wcs.c_str(), // display requested feedrate and actual feedrate
-            THEROBOT->from_millimeters(THEROBOT->get_feed_rate()),
-            THEROBOT->from_millimeters(THEKERNEL->conveyor->get_current_feedrate()*60.0F));
-            break;
+        case 4: THEPANEL->lcd->printf("%s F%6.1f/%6.1f", this->wcs.c_str(), this->feed_rate, this->current_feed_rate); break; // display requested feedrate and actual feedrate
         case 5: THEPANEL->lcd->printf("%3d%% %2lu:%02lu %3u%% sd", this->current_speed, this->elapsed_time / 60, this->elapsed_time % 60, this->sd_pcnt_played); break;
         case 6:
-            if(THEPANEL->has_laser()){
-                #ifndef NO_TOOLS_LASER
-                Laser *plaser= nullptr;
-                if(PublicData::get_value(laser_checksum, (void *)&plaser) && plaser != nullptr) {
-                    THEPANEL->lcd->printf("Laser S%1.4f/%1.2f%%", THEROBOT->get_s_value(), plaser->get_current_power());
-                }
-                #endif
-            }
+            if(this->show_laser) THEPANEL->lcd->printf("Laser S%1.4f/%1.2f%%", this->laser_s, this->laser_power);
             break;
         case 7: THEPANEL->lcd->printf("%19s", this->get_status()); break;
     }
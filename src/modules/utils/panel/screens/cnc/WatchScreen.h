@@ -30,11 +30,17 @@ private:
     void get_sd_play_info();
     const char *get_status();
     const char *get_network();
+    void get_feed_and_laser();
+    void make_keys(uint32_t *keys);
 
     uint32_t update_counts;
     int current_speed;
     float wpos[3], mpos[3];
     std::string wcs;
+    // fetched once a second, the lines are drawn from these
+    float feed_rate, current_feed_rate;
+    float laser_s, laser_power;
+    uint32_t drawn[8]; // key of each line as it was last drawn
     unsigned long elapsed_time;
     unsigned int sd_pcnt_played;
     char *ipstr;
@@ -43,6 +49,7 @@ private:
         bool speed_changed:1;
         bool issue_change_speed:1;
         bool spindle_state:1;
+        bool show_laser:1;
     };
 };
 
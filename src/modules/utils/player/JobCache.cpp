@@ -0,0 +1,193 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JobCache.h"
+#include "LineReader.h"
+#include "LineIndex.h"
+#include "libs/Kernel.h"
+#include "libs/utils.h"
+#include "StreamOutput.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// how often compiling a file lets idle run
+#define cache_yield_us 2000
+
+const char JobCache::letters[8] = {'X', 'Y', 'Z', 'E', 'A', 'B', 'F', 'S'};
+
+// a G0 or G1 followed by nothing but a value for each of up to 8 different letters, or just the values if the
+// modal motion is G0 or G1
+bool JobCache::parse_move(const char *line, uint8_t modal, Record& record)
+{
+    const char *p= line;
+    if(*p == 'G') {
+        char *e;
+        long g= strtol(p + 1, &e, 10);
+        if(e == p + 1 || g < 0 || g > 1 || *e == '.') return false;
+        record.type= g;
+        p= e;
+    } else if(*p == 'X' || *p == 'Y' || *p == 'Z' || *p == 'F') {
+        if(modal > 1) return false;
+        record.type= modal;
+    } else {
+        return false;
+    }
+
+    float values[8];
+    uint8_t mask= 0;
+    while(true) {
+        while(*p == ' ' || *p == '\t') ++p;
+        if(*p == '\0' || *p == '\r' || *p == '\n' || *p == ';') break;
+        const char *l= (const char *)memchr(letters, *p, sizeof(letters));
+        if(l == nullptr) return false;
+        int i= l - letters;
+        if(mask & (1 << i)) return false;
+        char *e;
+        values[i]= strtof(p + 1, &e);
+        if(e == p + 1) return false;
+        mask |= (1 << i);
+        p= e;
+    }
+    if(mask == 0) return false;
+
+    // the values are kept in mask order with nothing in between
+    record.mask= mask;
+    int n= 0;
+    for(int i= 0; i < 8; i++) {
+        if(mask & (1 << i)) record.values[n++]= values[i];
+    }
+    return true;
+}
+
+bool JobCache::compile(const std::string& filename, StreamOutput *stream)
+{
+    FILE *fp= fopen(filename.c_str(), "r");
+    if(fp == nullptr) {
+        stream->printf("File not found: %s\r\n", filename.c_str());
+        return false;
+    }
+
+    std::string binname= filename + ".bin";
+    FILE *bp= fopen(binname.c_str(), "w");
+    if(bp == nullptr) {
+        stream->printf("Could not create %s\r\n", binname.c_str());
+        fclose(fp);
+        return false;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    uint32_t size= ftell(fp);
+    Header h{{'S', 'B', 'J', 'C'}, 2, size, LineIndex::fingerprint(fp, size)};
+    fwrite(&h, sizeof(h), 1, bp);
+
+    LineReader reader;
+    reader.attach(fp);
+    LineIndex::State state;
+    state.reset();
+    Record r;
+    char buf[130];
+    int len;
+    uint32_t moves= 0, lines= 0;
+    while((len= reader.read_line(buf, sizeof(buf))) != 0) {
+        if(len < 0) {
+            stream->printf("Warning: Discarded long line\r\n");
+            continue;
+        }
+        while(len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) buf[--len]= '\0';
+        if(len == 0 || buf[0] == ';' || buf[0] == '(') continue;
+
+        compile_line(buf, len, state, r);
+        if(r.type != RECORD_TEXT) moves++;
+        char out[2 + sizeof(r.text)];
+        fwrite(out, 1, encode(r, out), bp);
+
+        lines++;
+
+        // keep the comms going, this can take a while on a big file
+        THEKERNEL->yield(cache_yield_us);
+    }
+
+    reader.detach();
+    fclose(fp);
+    fclose(bp);
+
+    stream->printf("Compiled %lu lines of %s, %lu moves pre parsed\r\n", lines, filename.c_str(), moves);
+    return true;
+}
+
+FILE *JobCache::open(const std::string& filename, FILE *source, uint32_t source_size)
+{
+    std::string binname= filename + ".bin";
+    FILE *bp= fopen(binname.c_str(), "r");
+    if(bp == nullptr) return nullptr;
+
+    Header h;
+    if(fread(&h, sizeof(h), 1, bp) != 1 || memcmp(h.magic, "SBJC", 4) != 0 || h.version != 2 ||
+       h.source_size != source_size || h.source_crc != LineIndex::fingerprint(source, source_size)) {
+        fclose(bp);
+        return nullptr;
+    }
+
+    return bp;
+}
+
+void JobCache::compile_line(const char *line, size_t len, LineIndex::State& state, Record& r)
+{
+    if(!parse_move(line, state.motion, r)) {
+        // the moves before it may have changed the modal motion so give any line that relies on it an explicit one
+        int n= 0;
+        if(state.motion <= 3 && (line[0] == 'X' || line[0] == 'Y' || line[0] == 'Z' || line[0] == 'F')) n= snprintf(r.text, sizeof(r.text), "G%d ", state.motion);
+        memcpy(&r.text[n], line, len);
+        r.type= RECORD_TEXT;
+        r.mask= n + len;
+    }
+    state.scan(line);
+}
+
+size_t JobCache::encode(const Record& r, char *out)
+{
+    out[0]= r.type;
+    out[1]= r.mask;
+    size_t n= r.type == RECORD_TEXT ? r.mask : __builtin_popcount(r.mask) * sizeof(float);
+    memcpy(&out[2], r.type == RECORD_TEXT ? (const void *)r.text : (const void *)r.values, n);
+    return 2 + n;
+}
+
+size_t JobCache::decode(const char *p, size_t n, Record& record)
+{
+    if(n < 2) return 0;
+    record.type= p[0];
+    record.mask= p[1];
+
+    if(record.type == RECORD_TEXT) {
+        if(record.mask >= sizeof(record.text) || n < 2u + record.mask) return 0;
+        memcpy(record.text, &p[2], record.mask);
+        record.text[record.mask]= '\0';
+        return 2 + record.mask;
+    }
+
+    size_t len= __builtin_popcount(record.mask) * sizeof(float);
+    if(n < 2 + len) return 0;
+    memcpy(record.values, &p[2], len);
+    return 2 + len;
+}
+
+size_t JobCache::read(LineReader& reader, Record& record)
+{
+    if(reader.read(&record.type, 2) != 2) return 0;
+
+    if(record.type == RECORD_TEXT) {
+        if(record.mask >= sizeof(record.text) || reader.read(record.text, record.mask) != record.mask) return 0;
+        record.text[record.mask]= '\0';
+        return 2 + record.mask;
+    }
+
+    size_t n= __builtin_popcount(record.mask) * sizeof(float);
+    if(reader.read(record.values, n) != n) return 0;
+    return 2 + n;
+}
@@ -0,0 +1,67 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+
+#include "LineIndex.h"
+
+class StreamOutput;
+class LineReader;
+
+// A gcode file compiled to file.bin, plain G0/G1 lines are stored pre parsed so playing it again needs no text parsing.
+// A G0/G1 record is the opcode, the axis mask and the values the same as a USBSerial binary frame without the
+// sequence number and crc, every other line is kept as text.
+class JobCache {
+    public:
+        static const uint8_t RECORD_G0= 0;
+        static const uint8_t RECORD_G1= 1;
+        static const uint8_t RECORD_TEXT= 0xFF;
+        static const size_t max_record_size= 2 + 8 * 4;
+
+        struct Record {
+            uint8_t type;
+            uint8_t mask;  // for G0/G1 the axis letters present, for text the length
+            union {
+                float values[8];
+                char text[132]; // a line of up to 128 characters and a modal G prefix
+            };
+        };
+
+        // letters set by the bits of the mask
+        static const char letters[8];
+
+        // compiles filename into filename.bin, returns false if either can not be opened
+        static bool compile(const std::string& filename, StreamOutput *stream);
+
+        // opens the cache of a source file if there is one compiled from it as it is now, returns nullptr if not
+        static FILE *open(const std::string& filename, FILE *source, uint32_t source_size);
+
+        // reads the next record, returns its size in the file or 0 at the end
+        static size_t read(LineReader& reader, Record& record);
+
+        // turns a line with its line ending removed into a record, with the modal state it is played in, which it
+        // updates, a motion above 3 is not known so lines that rely on it are left to be parsed when they are played
+        static void compile_line(const char *line, size_t len, LineIndex::State& state, Record& record);
+        // writes a record as it is in a compiled file to out, which has room for 2 + sizeof(Record::text), returns the size
+        static size_t encode(const Record& record, char *out);
+        // copies out the record at the start of the n bytes at p, returns its size or 0 if there is not a whole one
+        static size_t decode(const char *p, size_t n, Record& record);
+
+    private:
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint32_t source_size;
+            uint32_t source_crc;
+        };
+
+        static bool parse_move(const char *line, uint8_t modal, Record& record);
+};
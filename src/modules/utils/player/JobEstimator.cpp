@@ -0,0 +1,367 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JobEstimator.h"
+#include "libs/Kernel.h"
+#include "Robot.h"
+#include "Planner.h"
+#include "Block.h"
+#include "StreamOutput.h"
+#include "us_ticker_api.h"
+
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <algorithm>
+
+JobEstimator::JobEstimator()
+{
+    fp= nullptr;
+    done= false;
+    total= 0;
+    file_size= 0;
+}
+
+bool JobEstimator::start(const std::string& fn)
+{
+    stop();
+    fp= fopen(fn.c_str(), "r");
+    if(fp == nullptr) return false;
+
+    fseek(fp, 0, SEEK_END);
+    file_size= ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    reader.attach(fp);
+
+    filename= fn;
+    done= false;
+    tail= count= 0;
+    memset(previous_unit, 0, sizeof(previous_unit));
+    memset(position, 0, sizeof(position));
+    last_layer_z= NAN;
+    feed_rate= THEROBOT->get_feed_rate();
+    seek_rate= THEROBOT->get_seek_rate();
+    acceleration= THEROBOT->get_default_acceleration();
+    junction_deviation= THEKERNEL->planner->get_junction_deviation();
+    minimum_planner_speed= THEKERNEL->planner->get_minimum_planner_speed();
+    total= 0;
+    percent= 0;
+    layers.clear();
+    tools.clear();
+    relative= inches= false;
+    motion= 0;
+    return true;
+}
+
+void JobEstimator::stop()
+{
+    if(fp == nullptr) return;
+    reader.detach();
+    fclose(fp);
+    fp= nullptr;
+}
+
+bool JobEstimator::run(uint32_t budget_us)
+{
+    if(fp == nullptr) return done;
+
+    uint32_t start= us_ticker_read();
+    char buf[130];
+    do {
+        line_offset= reader.position();
+        int len= reader.read_line(buf, sizeof(buf));
+        if(len == 0) {
+            flush();
+            resolve(file_size);
+            stop();
+            done= true;
+            break;
+        }
+        if(len > 0) scan_line(buf);
+    } while(us_ticker_read() - start < budget_us);
+
+    return done;
+}
+
+// the letters on the line and the G codes in the order they appear, comments and message text are skipped
+void JobEstimator::scan_line(const char *line)
+{
+    float values[26];
+    uint32_t letters= 0;
+    int gcodes[4];
+    int ngcodes= 0;
+
+    for(const char *p= line; *p; ) {
+        char c= toupper(*p);
+        if(c == ';') break;
+        if(c == '(') {
+            p= strchr(p, ')');
+            if(p == nullptr) break;
+            ++p;
+            continue;
+        }
+        if(c < 'A' || c > 'Z') {
+            ++p;
+            continue;
+        }
+        char *e;
+        float v= strtof(p + 1, &e);
+        if(e == p + 1) {
+            ++p;
+            continue;
+        }
+        p= e;
+        if(c == 'G') {
+            if(ngcodes < 4) gcodes[ngcodes++]= lroundf(v * 10);
+        } else {
+            values[c - 'A']= v;
+            letters |= 1 << (c - 'A');
+            if(c == 'M' && (v == 117 || v == 118)) break; // the rest of the line is text
+        }
+    }
+    #define HAS(l) (letters & (1 << ((l) - 'A')))
+
+    bool move= false, set_position= false;
+    int dwell= -1;
+    for(int i= 0; i < ngcodes; i++) {
+        switch(gcodes[i]) {
+            case 0: case 10: case 20: case 30: motion= gcodes[i] / 10; move= true; break;
+            case 40: dwell= i; break;
+            case 200: inches= true; break;
+            case 210: inches= false; break;
+            case 900: relative= false; break;
+            case 910: relative= true; break;
+            case 280: flush(); break; // homing takes however long it takes
+            case 920: set_position= true; break;
+        }
+    }
+    if(!move && ngcodes == 0 && (HAS('X') || HAS('Y') || HAS('Z')) && !HAS('M') && !HAS('T')) move= true; // modal motion
+
+    if((HAS('T') && !HAS('M') && ngcodes == 0) || (HAS('M') && values['M' - 'A'] == 6)) {
+        // the machine stops for a tool change
+        flush();
+        add_event(tools);
+    }
+
+    if(dwell >= 0) {
+        flush();
+        if(HAS('P')) total += values['P' - 'A'] / 1000.0F;
+        if(HAS('S')) total += values['S' - 'A'];
+        return;
+    }
+
+    float scale= inches ? 25.4F : 1.0F;
+    if(set_position) {
+        for(int i= 0; i < 3; i++) {
+            if(HAS('X' + i)) position[i]= values['X' + i - 'A'] * scale;
+        }
+        return;
+    }
+    if(HAS('F')) {
+        if(motion == 0) seek_rate= values['F' - 'A'] * scale;
+        else feed_rate= values['F' - 'A'] * scale;
+    }
+    if(!move) return;
+
+    float target[3];
+    memcpy(target, position, sizeof(target));
+    for(int i= 0; i < 3; i++) {
+        if(HAS('X' + i)) target[i]= (relative ? position[i] : 0) + values['X' + i - 'A'] * scale;
+    }
+    float rate= (motion == 0 ? seek_rate : feed_rate) / 60.0F;
+
+    // the first cutting or printing move above the last layer starts a new one, so z hops on travel moves are not layers
+    if(motion != 0 && (target[0] != position[0] || target[1] != position[1]) && (isnan(last_layer_z) || position[2] > last_layer_z + 0.0001F)) {
+        if(!isnan(last_layer_z)) add_event(layers);
+        last_layer_z= position[2];
+    }
+
+    if(motion >= 2) {
+        // an arc is planned as one move the length of the arc, which is how its segments add up
+        float i= HAS('I') ? values['I' - 'A'] * scale : 0, j= HAS('J') ? values['J' - 'A'] * scale : 0;
+        float cx= position[0] + i, cy= position[1] + j;
+        float r= hypotf(i, j);
+        float a0= atan2f(position[1] - cy, position[0] - cx), a1= atan2f(target[1] - cy, target[0] - cx);
+        float angle= motion == 2 ? a0 - a1 : a1 - a0;
+        if(angle <= 0.0001F) angle += 2 * M_PI;
+        float distance= hypotf(r * angle, target[2] - position[2]);
+        append_move(target, distance, rate, true);
+        return;
+    }
+
+    float d[3]= {target[0] - position[0], target[1] - position[1], target[2] - position[2]};
+    float distance= sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    if(distance < 0.00001F) {
+        // extruder only moves take their time but do not take part in junctions
+        if(HAS('E') && values['E' - 'A'] != 0) append_move(target, fabsf(values['E' - 'A'] * scale), rate, false);
+        return;
+    }
+    append_move(target, distance, rate, true);
+    #undef HAS
+}
+
+// the same junction speed and entry speed as Planner::append_block()
+void JobEstimator::append_move(const float target[3], float distance, float rate_mm_s, bool primary)
+{
+    float unit[3]= {0, 0, 0};
+    if(primary) {
+        for(int i= 0; i < 3; i++) {
+            unit[i]= (target[i] - position[i]) / distance;
+            // limit the rate so no axis goes faster than its max speed, as Robot::append_milestone() does
+            float max= THEROBOT->get_max_speed(i);
+            float axis_speed= fabsf(unit[i] * rate_mm_s);
+            if(max > 0 && axis_speed > max) rate_mm_s *= max / axis_speed;
+        }
+    }
+    memcpy(position, target, sizeof(position));
+    if(rate_mm_s <= 0.0F) return;
+
+    if(count == lookahead) retire();
+
+    float vmax_junction= minimum_planner_speed;
+    if(primary && count > 0) {
+        const Move& prev= moves[(tail + count - 1) % lookahead];
+        float previous_nominal_speed= prev.nominal_speed;
+        float cos_theta= -previous_unit[0] * unit[0] - previous_unit[1] * unit[1] - previous_unit[2] * unit[2];
+        if(junction_deviation > 0.0F && previous_nominal_speed > 0.0F && cos_theta <= 0.9999F) {
+            vmax_junction= std::min(previous_nominal_speed, rate_mm_s);
+            if(cos_theta >= -0.9999F) {
+                float sin_theta_d2= sqrtf(0.5F * (1.0F - cos_theta));
+                vmax_junction= std::min(vmax_junction, sqrtf(acceleration * junction_deviation * sin_theta_d2 / (1.0F - sin_theta_d2)));
+            }
+        }
+    }
+    memcpy(previous_unit, unit, sizeof(previous_unit));
+
+    Move& m= moves[(tail + count) % lookahead];
+    count++;
+    m.offset= reader.position();
+    m.millimeters= distance;
+    m.nominal_speed= rate_mm_s;
+    m.acceleration= acceleration;
+    m.max_entry_speed= vmax_junction;
+    float v_allowable= sqrtf(minimum_planner_speed * minimum_planner_speed + 2.0F * acceleration * distance);
+    m.entry_speed= std::min(vmax_junction, v_allowable);
+    m.nominal_length= rate_mm_s <= v_allowable;
+
+    recalculate();
+}
+
+// reverse then forward pass over the whole lookahead as in Planner::recalculate(), the oldest entry speed is fixed
+void JobEstimator::recalculate()
+{
+    float exit_speed= minimum_planner_speed;
+    for(int n= count - 1; n > 0; n--) {
+        Move& m= moves[(tail + n) % lookahead];
+        if(!m.nominal_length && m.max_entry_speed > exit_speed) {
+            m.entry_speed= std::min(m.max_entry_speed, sqrtf(exit_speed * exit_speed + 2.0F * m.acceleration * m.millimeters));
+        } else {
+            m.entry_speed= m.max_entry_speed;
+        }
+        exit_speed= m.entry_speed;
+    }
+
+    for(int n= 1; n < count; n++) {
+        const Move& prev= moves[(tail + n - 1) % lookahead];
+        Move& m= moves[(tail + n) % lookahead];
+        float max_exit= prev.nominal_length ? prev.nominal_speed :
+                        std::min(prev.nominal_speed, sqrtf(prev.entry_speed * prev.entry_speed + 2.0F * prev.acceleration * prev.millimeters));
+        if(max_exit < m.entry_speed) m.entry_speed= max_exit;
+    }
+}
+
+// the oldest move leaves the lookahead with its speeds final, as when the step ticker takes a block
+void JobEstimator::retire()
+{
+    if(count == 0) return;
+    const Move& m= moves[tail];
+    float exit_speed= count > 1 ? moves[(tail + 1) % lookahead].entry_speed : minimum_planner_speed;
+
+    resolve(m.offset - 1);
+    total += Block::trapezoid_time(m.millimeters, m.acceleration, m.nominal_speed, m.entry_speed, exit_speed);
+
+    // the percent of the file the move ends in is done
+    uint32_t offset= m.offset;
+    tail= (tail + 1) % lookahead;
+    count--;
+    int p= file_size > 0 ? (uint64_t)offset * 100 / file_size : 100;
+    while(percent <= p && percent <= 100) percent_time[percent++]= total;
+}
+
+// everything is planned to a stop, as happens before a dwell, tool change or the end of the file
+void JobEstimator::flush()
+{
+    while(count > 0) retire();
+    memset(previous_unit, 0, sizeof(previous_unit));
+    resolve(line_offset);
+}
+
+void JobEstimator::add_event(std::vector<Event>& events)
+{
+    if(events.size() >= max_events) return;
+    events.push_back({line_offset, -1});
+    resolve(0); // there may be nothing in the lookahead to wait for
+}
+
+// events at or before offset have all their preceding moves timed
+void JobEstimator::resolve(uint32_t offset)
+{
+    for(auto *v : {&layers, &tools}) {
+        for(auto i= v->rbegin(); i != v->rend() && i->time < 0; ++i) {
+            if(i->offset <= offset || count == 0) i->time= total;
+        }
+    }
+    if(offset >= file_size) {
+        while(percent <= 100) percent_time[percent++]= total;
+    }
+}
+
+float JobEstimator::remaining(uint32_t offset) const
+{
+    if(!done || file_size == 0) return 0;
+    float f= std::min(1.0F, (float)offset / file_size) * 100;
+    int i= std::min(99, (int)f);
+    float t= percent_time[i] + (percent_time[i + 1] - percent_time[i]) * (f - i);
+    return std::max(0.0F, total - t);
+}
+
+const JobEstimator::Event *JobEstimator::next_event(const std::vector<Event>& events, uint32_t offset)
+{
+    for(auto& e : events) {
+        if(e.offset > offset) return &e;
+    }
+    return nullptr;
+}
+
+void JobEstimator::report(StreamOutput *stream, uint32_t offset) const
+{
+    if(!done) {
+        if(fp != nullptr) stream->printf("estimating %s, %u%% done\r\n", filename.c_str(), file_size > 0 ? (unsigned)((uint64_t)reader.position() * 100 / file_size) : 0);
+        return;
+    }
+
+    uint32_t t= lroundf(total);
+    stream->printf("planned time for %s: %02lu:%02lu:%02lu", filename.c_str(), t / 3600, (t % 3600) / 60, t % 60);
+    if(offset > 0) {
+        float left= remaining(offset);
+        float now= total - left;
+        uint32_t r= lroundf(left);
+        stream->printf(", left: %02lu:%02lu:%02lu", r / 3600, (r % 3600) / 60, r % 60);
+
+        const Event *l= next_event(layers, offset);
+        if(!layers.empty()) {
+            stream->printf(", layer %u of %u", (unsigned)((l == nullptr ? layers.size() : l - &layers[0]) + 1), (unsigned)layers.size() + 1);
+            if(l != nullptr) stream->printf(" %lus left in it", (uint32_t)std::max(0L, lroundf(l->time - now)));
+        }
+        const Event *tc= next_event(tools, offset);
+        if(tc != nullptr) stream->printf(", next tool change in %lus", (uint32_t)std::max(0L, lroundf(tc->time - now)));
+    } else {
+        stream->printf(", %u layers, %u tool changes", (unsigned)layers.size() + 1, (unsigned)tools.size());
+    }
+    stream->printf("\r\n");
+}
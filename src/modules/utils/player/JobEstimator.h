@@ -0,0 +1,96 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "LineReader.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class StreamOutput;
+
+// Works out how long a file will take to play by planning its moves the way the Planner does, the same junction
+// speeds, reverse and forward passes over a queue sized lookahead and Block trapezoids, without stepping anything.
+// It runs a little at a time so it can be done in idle time, and records the time at every percent of the file,
+// each layer and each tool change so the time left can be given part way through.
+class JobEstimator {
+    public:
+        JobEstimator();
+
+        // starts estimating filename, returns false if it can not be opened
+        bool start(const std::string& filename);
+        void stop();
+
+        // estimates for up to budget_us, returns true once the whole file has been done
+        bool run(uint32_t budget_us);
+
+        bool is_running() const { return fp != nullptr; }
+        bool is_done() const { return done; }
+        const std::string& get_filename() const { return filename; }
+        float get_total() const { return total; }
+        uint32_t get_file_size() const { return file_size; }
+
+        // times left once offset bytes of the file have been played, the layer and tool checks use the recorded events
+        float remaining(uint32_t offset) const;
+        void report(StreamOutput *stream, uint32_t offset) const;
+
+    private:
+        struct Move {
+            uint32_t offset;    // of the end of the line it came from
+            float millimeters;
+            float nominal_speed;
+            float max_entry_speed;
+            float entry_speed;
+            float acceleration;
+            bool nominal_length;
+        };
+        struct Event {
+            uint32_t offset;    // of the start of the line it came from
+            float time;         // negative until the moves before it have been planned
+        };
+
+        void scan_line(const char *line);
+        void append_move(const float target[3], float distance, float rate_mm_s, bool primary);
+        void recalculate();
+        void retire();
+        void flush();
+        void add_event(std::vector<Event>& events);
+        void resolve(uint32_t offset);
+        static const Event *next_event(const std::vector<Event>& events, uint32_t offset);
+
+        static const int lookahead= 32;
+        static const size_t max_events= 512;
+
+        std::string filename;
+        FILE *fp;
+        LineReader reader;
+        uint32_t file_size;
+        uint32_t line_offset;     // start of the line being scanned
+
+        Move moves[lookahead];   // ring of moves still being planned, oldest at tail
+        int tail, count;
+        float previous_unit[3];
+        float position[3];
+        float last_layer_z;
+        float feed_rate, seek_rate; // mm/min
+        float acceleration, junction_deviation, minimum_planner_speed;
+        float total;              // seconds for all the moves retired so far
+        float percent_time[101];  // total at each percent of the file
+        int percent;              // percents recorded so far
+        std::vector<Event> layers;
+        std::vector<Event> tools;
+
+        struct {
+            bool done:1;
+            bool relative:1;
+            bool inches:1;
+            uint8_t motion:2;
+        };
+};
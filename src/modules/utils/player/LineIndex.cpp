@@ -0,0 +1,158 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LineIndex.h"
+#include "LineReader.h"
+#include "libs/Kernel.h"
+#include "StreamOutput.h"
+#include "libs/utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+// keep track of the modal codes on the line, comments and message text are skipped
+void LineIndex::State::scan(const char *line)
+{
+    const char *p= line;
+    while(*p) {
+        char c= toupper(*p);
+        if(c == ';') break;
+        if(c == '(') {
+            p= strchr(p, ')');
+            if(p == nullptr) break;
+            ++p;
+            continue;
+        }
+
+        if(c == 'M' || c == 'G' || c == 'F') {
+            char *e;
+            float v= strtof(p + 1, &e);
+            if(e == p + 1) {
+                ++p;
+                continue;
+            }
+            p= e;
+
+            if(c == 'M') {
+                if(v == 117 || v == 118) break; // the rest of the line is text
+            } else if(c == 'F') {
+                if(motion != 0) feedrate= v;
+            } else {
+                int g= (int)v;
+                int sub= lroundf((v - g) * 10);
+                if(g >= 0 && g <= 3 && sub == 0) motion= g;
+                else if(g == 90) relative= false;
+                else if(g == 91) relative= true;
+                else if(g == 20) inches= true;
+                else if(g == 21) inches= false;
+                else if(g >= 54 && g <= 58 && sub == 0) wcs= g - 54;
+                else if(g == 59 && sub <= 3) wcs= 5 + sub;
+            }
+            continue;
+        }
+        ++p;
+    }
+}
+
+uint32_t LineIndex::fingerprint(FILE *fp, uint32_t size)
+{
+    char buf[512];
+    uint32_t crc= crc32(&size, sizeof(size));
+    fseek(fp, 0, SEEK_SET);
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) {
+        crc= crc32(buf, n, crc);
+        // keep the comms going, this can take a while on a big file
+        THEKERNEL->yield(2000);
+    }
+    fseek(fp, 0, SEEK_SET);
+    return crc;
+}
+
+bool LineIndex::build(const std::string& filename, uint32_t every, StreamOutput *stream)
+{
+    FILE *fp= fopen(filename.c_str(), "r");
+    if(fp == nullptr) {
+        stream->printf("File not found: %s\r\n", filename.c_str());
+        return false;
+    }
+
+    std::string idxname= filename + ".idx";
+    FILE *ip= fopen(idxname.c_str(), "w");
+    if(ip == nullptr) {
+        stream->printf("Could not create %s\r\n", idxname.c_str());
+        fclose(fp);
+        return false;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    uint32_t size= ftell(fp);
+    Header h{{'S', 'I', 'D', 'X'}, 2, every, size, fingerprint(fp, size), 0};
+    fwrite(&h, sizeof(h), 1, ip); // rewritten with the count at the end
+
+    LineReader reader;
+    reader.attach(fp);
+    Entry e;
+    e.state.reset();
+    uint32_t line= 1;
+    char buf[130];
+    int len;
+    while(true) {
+        if(line % every == 0) {
+            e.line= line;
+            e.offset= reader.position();
+            fwrite(&e, sizeof(e), 1, ip);
+            h.count++;
+            // keep the comms going, this can take a while on a big file
+            THEKERNEL->yield();
+        }
+        if((len= reader.read_line(buf, sizeof(buf))) == 0) break;
+        if(len > 0) e.state.scan(buf);
+        ++line;
+    }
+
+    reader.detach();
+    fclose(fp);
+    fseek(ip, 0, SEEK_SET);
+    fwrite(&h, sizeof(h), 1, ip);
+    fclose(ip);
+
+    stream->printf("Indexed %lu lines of %s, %lu entries\r\n", line - 1, filename.c_str(), h.count);
+    return true;
+}
+
+bool LineIndex::find(const std::string& filename, uint32_t file_size, uint32_t line, Entry& entry)
+{
+    std::string idxname= filename + ".idx";
+    FILE *ip= fopen(idxname.c_str(), "r");
+    if(ip == nullptr) return false;
+
+    Header h;
+    bool ok= fread(&h, sizeof(h), 1, ip) == 1 && memcmp(h.magic, "SIDX", 4) == 0 && h.version == 2 &&
+             h.file_size == file_size && h.every > 0;
+    if(ok) {
+        // the same size is not enough, an edit that keeps it would put every offset after it on the wrong line
+        FILE *fp= fopen(filename.c_str(), "r");
+        ok= fp != nullptr && h.file_crc == fingerprint(fp, file_size);
+        if(fp != nullptr) fclose(fp);
+    }
+
+    // the entries are at every Kth line so seek straight to the one wanted
+    uint32_t n= ok ? line / h.every : 0;
+    if(ok && n > h.count) n= h.count;
+    if(n > 0) {
+        ok= fseek(ip, sizeof(h) + (n - 1) * sizeof(Entry), SEEK_SET) == 0 && fread(&entry, sizeof(entry), 1, ip) == 1;
+    } else {
+        ok= false; // before the first entry, start from the top
+    }
+
+    fclose(ip);
+    return ok;
+}
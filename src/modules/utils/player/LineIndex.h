@@ -0,0 +1,59 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+class StreamOutput;
+
+// An index of a gcode file kept next to it as file.idx, every Kth line number with its byte offset and the modal
+// state in force at the start of that line, so a job can be restarted at a line without reading it from the start
+class LineIndex {
+    public:
+        // the modal state that has to be restored when starting part way through a file
+        struct State {
+            float feedrate;     // last F given to a G1/G2/G3, in the units in force, 0 if none yet
+            uint8_t wcs;        // 0 is G54 ... 8 is G59.3
+            uint8_t motion;     // 0 G0, 1 G1, 2 G2, 3 G3
+            bool relative;      // G91
+            bool inches;        // G20
+
+            void reset() { feedrate= 0; wcs= 0; motion= 0; relative= false; inches= false; }
+            void scan(const char *line);
+        };
+
+        struct Entry {
+            uint32_t line;      // line number, the first line is 1
+            uint32_t offset;    // byte offset of the start of the line
+            State state;
+        };
+
+        static const uint32_t default_every= 1000;
+
+        // reads the whole file and writes filename.idx, returns false if either can not be opened
+        static bool build(const std::string& filename, uint32_t every, StreamOutput *stream);
+
+        // the last entry at or before line, returns false if there is no index or it is for a different file
+        static bool find(const std::string& filename, uint32_t file_size, uint32_t line, Entry& entry);
+
+        // a crc of the size and every byte of the file, which is what ties a .idx or .bin to the file it was made from as
+        // there is no clock to date them with, leaves fp at the start
+        static uint32_t fingerprint(FILE *fp, uint32_t size);
+
+    private:
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint32_t every;
+            uint32_t file_size;
+            uint32_t file_crc;
+            uint32_t count;
+        };
+};
@@ -0,0 +1,188 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LineReader.h"
+#include "platform_memory.h"
+#include "FileTail.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+bool LineReader::attach(FILE *f, bool grow)
+{
+    fp= f;
+    consumed= offset= 0;
+    head= count= 0;
+    eof= discarding= waiting= false;
+    if(buffer == nullptr) {
+        buffer= (char *)AHB0.alloc(buffer_size);
+        if(buffer == nullptr) buffer= (char *)malloc(buffer_size);
+    }
+    // we do our own buffering so the reads go straight to the file system
+    if(buffer != nullptr) setvbuf(fp, nullptr, _IONBF, 0);
+    // fgets would hand out the last line before it has all been written
+    growing= grow && buffer != nullptr;
+    return growing == grow;
+}
+
+void LineReader::reopen(FILE *f, bool grow)
+{
+    fp= f;
+    eof= waiting= false;
+    growing= grow;
+    setvbuf(fp, nullptr, _IONBF, 0);
+}
+
+void LineReader::detach()
+{
+    fp= nullptr;
+    if(buffer == nullptr) return;
+    if(AHB0.has(buffer)) AHB0.dealloc(buffer);
+    else free(buffer);
+    buffer= nullptr;
+}
+
+void LineReader::fill(size_t below)
+{
+    if(fp == nullptr || buffer == nullptr || count >= below) return;
+
+    // head stays on a chunk boundary so the reads line up with the sectors of the file, unless it is growing
+    waiting= false;
+    while(!eof && !waiting && buffer_size - count >= chunk_size) {
+        size_t n= buffer_size - head;
+        size_t room= (buffer_size - count) & ~(chunk_size - 1);
+        if(n > room) n= room;
+        size_t r= fread(&buffer[head], 1, n, fp);
+        if(r < n) {
+            if(growing) {
+                // the rest may only be in RAM so far
+                r += FileTail::read(offset + r, &buffer[head + r], n - r);
+                if(r < n) waiting= true;
+            } else {
+                eof= true;
+            }
+        }
+        offset += r;
+        head= (head + r) & mask;
+        count += r;
+    }
+}
+
+// copies out the line at the tail if there is a whole one buffered, returns 0 if there is not
+int LineReader::take_line(char *buf, size_t size)
+{
+    size_t tail= (head - count) & mask;
+    size_t len= 0;
+    bool found= false;
+
+    // look for the newline in the up to two pieces either side of the wrap
+    size_t first= buffer_size - tail;
+    if(first > count) first= count;
+    const char *p= (const char *)memchr(&buffer[tail], '\n', first);
+    if(p != nullptr) {
+        len= p - &buffer[tail] + 1;
+        found= true;
+    } else if(count > first) {
+        p= (const char *)memchr(buffer, '\n', count - first);
+        if(p != nullptr) {
+            len= first + (p - buffer) + 1;
+            found= true;
+        }
+    }
+
+    if(!found) {
+        if(eof && count > 0) {
+            len= count; // last line has no newline
+        } else if(buffer_size - count < chunk_size || discarding) {
+            // no newline in a buffer that can not take another chunk, or still skipping a long line, drop what we have
+            discarding= true;
+            consumed += count;
+            count= 0;
+            return 0;
+        } else {
+            return 0;
+        }
+    }
+
+    count -= len;
+    consumed += len;
+    if(discarding) {
+        discarding= false;
+        return -1;
+    }
+    if(len >= size) return -1;
+
+    if(tail + len <= buffer_size) {
+        memcpy(buf, &buffer[tail], len);
+    } else {
+        memcpy(buf, &buffer[tail], buffer_size - tail);
+        memcpy(&buf[buffer_size - tail], buffer, len - (buffer_size - tail));
+    }
+    buf[len]= '\0';
+    return len;
+}
+
+size_t LineReader::read(void *buf, size_t n)
+{
+    if(fp == nullptr) return 0;
+
+    size_t got= 0;
+    if(buffer == nullptr) {
+        got= fread(buf, 1, n, fp);
+        offset += got;
+
+    } else {
+        char *p= (char *)buf;
+        while(got < n) {
+            if(count == 0) {
+                if(eof || waiting) break;
+                fill();
+                continue;
+            }
+            size_t tail= (head - count) & mask;
+            size_t len= buffer_size - tail;
+            if(len > count) len= count;
+            if(len > n - got) len= n - got;
+            memcpy(&p[got], &buffer[tail], len);
+            got += len;
+            count -= len;
+        }
+    }
+
+    consumed += got;
+    return got;
+}
+
+int LineReader::read_line(char *buf, size_t size)
+{
+    if(fp == nullptr) return 0;
+
+    if(buffer == nullptr) {
+        // no memory for the read ahead buffer so read it the slow way
+        while(fgets(buf, size, fp) != nullptr) {
+            size_t len= strlen(buf);
+            if(len == 0) continue;
+            consumed += len;
+            offset += len;
+            if(buf[len - 1] == '\n' || feof(fp)) {
+                if(!discarding) return len;
+                discarding= false;
+                return -1;
+            }
+            discarding= true;
+        }
+        return 0;
+    }
+
+    waiting= false;
+    while(true) {
+        int n= take_line(buf, size);
+        if(n != 0) return n;
+        if(eof || waiting) return 0;
+        fill();
+    }
+}
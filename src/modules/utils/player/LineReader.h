@@ -0,0 +1,63 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Reads lines from a file through a ring buffer that is filled in whole sectors, a chunk at a time ahead of use.
+// fill() can be called when there is time to spare (eg from idle while waiting for the queue) so the lines
+// are there when they are needed and the SD card is read in long multi sector transfers.
+// A file that is still being uploaded is followed past the end the handle knows about through FileTail, with no
+// end of file until the upload is over, is_waiting() says when all there is so far has been read.
+class LineReader {
+    public:
+        LineReader() : fp(nullptr), buffer(nullptr), consumed(0), offset(0), head(0), count(0), eof(false), discarding(false), growing(false), waiting(false) {}
+        ~LineReader() { detach(); }
+
+        // start reading from the current position of fp, returns false if a growing file can not be followed
+        bool attach(FILE *fp, bool growing= false);
+        // carry on from a new handle on the same file positioned at file_offset(), eg once the writer has checkpointed it
+        void reopen(FILE *fp, bool growing);
+        void detach();
+
+        // copies the next line, including its newline, into buf and terminates it, returns the length
+        // returns 0 at the end of the file and -1 if a line too long for buf was discarded
+        int read_line(char *buf, size_t size);
+
+        // copies the next n bytes into buf, returns the number copied which is less than n at the end of the file
+        size_t read(void *buf, size_t n);
+
+        // reads ahead while there is room for a chunk, if below is set only when less than that is buffered
+        void fill(size_t below= buffer_size);
+
+        // bytes of the file read out, or discarded, since attach
+        uint32_t position() const { return consumed; }
+        // bytes read from the file since attach, buffered or not
+        uint32_t file_offset() const { return offset; }
+        bool is_waiting() const { return waiting; }
+
+    private:
+        int take_line(char *buf, size_t size);
+
+        static const size_t buffer_size= 4096; // power of 2 multiple of the sector size
+        static const size_t chunk_size= 512;
+        static const size_t mask= buffer_size - 1;
+
+        FILE *fp;
+        char *buffer; // nullptr if it could not be allocated, then it falls back to fgets
+        uint32_t consumed;
+        uint32_t offset;
+        uint16_t head; // next byte read from the file goes here, always a multiple of chunk_size
+        uint16_t count; // bytes buffered before head
+        bool eof:1;
+        bool discarding:1; // skipping to the end of a long line
+        bool growing:1; // the file is still being written
+        bool waiting:1; // a growing file has nothing more for now
+};
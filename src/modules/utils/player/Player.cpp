@@ -26,9 +26,14 @@
 #include "PublicDataRequest.h"
 #include "PublicData.h"
 #include "PlayerPublicAccess.h"
+#include "MSDPublicAccess.h"
+#include "LineIndex.h"
+#include "JobCache.h"
+#include "JobEstimator.h"
 #include "TemperatureControlPublicAccess.h"
 #include "TemperatureControlPool.h"
 #include "ExtruderPublicAccess.h"
+#include "FileTail.h"
 
 #include <cstddef>
 #include <cmath>
@@ -42,26 +47,37 @@
 #define before_resume_gcode_checksum      CHECKSUM("before_resume_gcode")
 #define leave_heaters_on_suspend_checksum CHECKSUM("leave_heaters_on_suspend")
 
+// subroutines nest this deep, and the ones up to this size are kept compiled in RAM, as many as fit in the cache
+#define max_subroutine_depth    8
+#define max_cached_subroutine   2048
+#define subroutine_cache_size   4096
+
 extern SDFAT mounter;
 
 Player::Player()
 {
     this->playing_file = false;
+    this->playing_cache = false;
+    this->following_upload = false;
+    this->playing_line = false;
+    this->sub_calls = 0;
     this->current_file_handler = nullptr;
     this->booted = false;
     this->elapsed_secs = 0;
     this->reply_stream = nullptr;
     this->suspended= false;
     this->suspend_loops= 0;
+    this->job_number= 0;
 }
 
 void Player::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
     this->register_for_event(ON_MAIN_LOOP);
+    this->register_for_event(ON_IDLE);
     this->register_for_event(ON_SECOND_TICK);
-    this->register_for_event(ON_GET_PUBLIC_DATA);
-    this->register_for_event(ON_SET_PUBLIC_DATA);
+    PublicData::register_get(player_checksum, this);
+    PublicData::register_set(player_checksum, this);
     this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_HALT);
 
@@ -87,6 +103,39 @@ void Player::on_second_tick(void *)
     if(this->playing_file) this->elapsed_secs++;
 }
 
+// the host may have changed the card over USB since it was mounted, which the file system here would not know about
+static void remount_if_host_written()
+{
+    void *returned_data;
+    if(PublicData::get_value(msd_checksum, host_written_checksum, &returned_data) && *static_cast<bool *>(returned_data)) {
+        mounter.remount();
+        PublicData::set_value(msd_checksum, host_written_checksum, nullptr);
+    }
+}
+
+// the host sees the card write protected from before the file is opened until after it is closed, so it can not change
+// the file under the player, returns false if it could not be opened
+bool Player::open_file(const char *fn)
+{
+    bool ro = true;
+    PublicData::set_value(msd_checksum, read_only_checksum, &ro);
+    remount_if_host_written();
+    this->current_file_handler = fopen(fn, "r");
+    if(this->current_file_handler != NULL) return true;
+
+    ro = false;
+    PublicData::set_value(msd_checksum, read_only_checksum, &ro);
+    return false;
+}
+
+void Player::close_file()
+{
+    if(this->current_file_handler != NULL) fclose(this->current_file_handler);
+    this->current_file_handler = NULL;
+    bool ro = false;
+    PublicData::set_value(msd_checksum, read_only_checksum, &ro);
+}
+
 // extract any options found on line, terminates args at the space before the first option (-v)
 // eg this is a file.gcode -v
 //    will return -v and set args to this is a file.gcode
@@ -117,11 +166,14 @@ void Player::on_gcode_received(void *argument)
 
             if(this->current_file_handler != NULL) {
                 this->playing_file = false;
-                fclose(this->current_file_handler);
+                reader.detach();
+                close_file();
+                stop_following();
             }
-            this->current_file_handler = fopen( this->filename.c_str(), "r");
+            clear_subroutines();
+            this->playing_cache = false; // the host follows progress in bytes of the file it selected
 
-            if(this->current_file_handler == NULL) {
+            if(!open_file(this->filename.c_str())) {
                 gcode->stream->printf("file.open failed: %s\r\n", this->filename.c_str());
                 return;
 
@@ -134,13 +186,19 @@ void Player::on_gcode_received(void *argument)
                     this->file_size = ftell(this->current_file_handler);
                     fseek(this->current_file_handler, 0, SEEK_SET);
                 }
+                reader.attach(this->current_file_handler);
                 gcode->stream->printf("File opened:%s Size:%ld\r\n", this->filename.c_str(), this->file_size);
                 gcode->stream->printf("File selected\r\n");
             }
 
 
             this->played_cnt = 0;
+
+
+            this->played_lines = 0;
             this->elapsed_secs = 0;
+            this->job_number = 1;
+            THEKERNEL->conveyor->reset_stats();
 
         } else if (gcode->m == 24) { // start print
             if (this->current_file_handler != NULL) {
@@ -164,11 +222,10 @@ void Player::on_gcode_received(void *argument)
 
                 if(!currentfn.empty()) {
                     // reload the last file opened
-                    this->current_file_handler = fopen(currentfn.c_str() , "r");
-
-                    if(this->current_file_handler == NULL) {
+                    if(!open_file(currentfn.c_str())) {
                         gcode->stream->printf("file.open failed: %s\r\n", currentfn.c_str());
                     } else {
+                        reader.attach(this->current_file_handler);
                         this->filename = currentfn;
                         this->file_size = old_size;
                         this->current_stream = nullptr;
@@ -188,11 +245,13 @@ void Player::on_gcode_received(void *argument)
 
             if(this->current_file_handler != NULL) {
                 this->playing_file = false;
-                fclose(this->current_file_handler);
+                reader.detach();
+                close_file();
+                stop_following();
             }
+            clear_subroutines();
 
-            this->current_file_handler = fopen( this->filename.c_str(), "r");
-            if(this->current_file_handler == NULL) {
+            if(!open_file(this->filename.c_str())) {
                 gcode->stream->printf("file.open failed: %s\r\n", this->filename.c_str());
             } else {
                 this->playing_file = true;
@@ -205,10 +264,27 @@ void Player::on_gcode_received(void *argument)
                         file_size = ftell(this->current_file_handler);
                         fseek(this->current_file_handler, 0, SEEK_SET);
                 }
+                start_estimate();
+                open_job_cache();
+                reader.attach(this->current_file_handler);
             }
 
             this->played_cnt = 0;
+
+            this->played_lines = 0;
             this->elapsed_secs = 0;
+            this->job_number = 1;
+            THEKERNEL->conveyor->reset_stats();
+
+        } else if (gcode->m == 98) { // call subroutine
+            if(this->playing_line) {
+                call_subroutine(gcode);
+            } else {
+                gcode->stream->printf("M98 can only be used in a file being played\r\n");
+            }
+
+        } else if (gcode->m == 99) { // return from subroutine, the main file just carries on
+            if(this->playing_line && !this->sub_stack.empty()) return_from_subroutine();
 
         } else if (gcode->m == 600) { // suspend print, Not entirely Marlin compliant, M600.1 will leave the heaters on
             this->suspend_command((gcode->subcode == 1)?"h":"", gcode->stream);
@@ -236,15 +312,15 @@ void Player::on_console_line_received( void *argument )
 {
     if(THEKERNEL->is_halted()) return; // if in halted state ignore any commands
 
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
-
-    string possible_command = new_message.message;
+    SerialMessage& new_message = *static_cast<SerialMessage *>(argument);
 
     // ignore anything that is not lowercase or a letter
-    if(possible_command.empty() || !islower(possible_command[0]) || !isalpha(possible_command[0])) {
+    if(new_message.message.empty() || !islower(new_message.message[0]) || !isalpha(new_message.message[0])) {
         return;
     }
 
+    string possible_command = new_message.message;
+
     string cmd = shift_parameter(possible_command);
 
     //new_message.stream->printf("Received %s\r\n", possible_command.c_str());
@@ -260,6 +336,12 @@ void Player::on_console_line_received( void *argument )
         this->suspend_command( possible_command, new_message.stream );
     }else if (cmd == "resume") {
         this->resume_command( possible_command, new_message.stream );
+    }else if (cmd == "index") {
+        this->index_command( possible_command, new_message.stream );
+    }else if (cmd == "estimate") {
+        this->estimate_command( possible_command, new_message.stream );
+    }else if (cmd == "compile") {
+        this->compile_command( possible_command, new_message.stream );
     }
 }
 
@@ -269,19 +351,35 @@ void Player::play_command( string parameters, StreamOutput *stream )
     // extract any options from the line and terminate the line there
     string options= extract_options(parameters);
     // Get filename which is the entire parameter line upto any options found or entire line
-    this->filename = absolute_from_relative(parameters);
+    string fn = absolute_from_relative(parameters);
+
+    // -q queues the file to be played as soon as the current one has been read, so the planner never runs dry between them
+    if(options.find("-q") != string::npos && (this->playing_file || this->suspended)) {
+        if(this->playlist.size() >= 16) {
+            stream->printf("Job queue is full\r\n");
+            return;
+        }
+        this->playlist.push_back(fn);
+        stream->printf("Queued %s as job %u\r\n", fn.c_str(), (unsigned)(this->job_number + this->playlist.size()));
+        return;
+    }
 
     if(this->playing_file || this->suspended) {
         stream->printf("Currently printing, abort print first\r\n");
         return;
     }
 
+    this->filename = fn;
+    this->job_number = 1;
+    clear_subroutines();
+
     if(this->current_file_handler != NULL) { // must have been a paused print
-        fclose(this->current_file_handler);
+        reader.detach();
+        close_file();
+        stop_following();
     }
 
-    this->current_file_handler = fopen( this->filename.c_str(), "r");
-    if(this->current_file_handler == NULL) {
+    if(!open_file(this->filename.c_str())) {
         stream->printf("File not found: %s\r\n", this->filename.c_str());
         return;
     }
@@ -308,8 +406,172 @@ void Player::play_command( string parameters, StreamOutput *stream )
         fseek(this->current_file_handler, 0, SEEK_SET);
         stream->printf("  File size %ld\r\n", file_size);
     }
+
+    // a file that is still being uploaded is played as it arrives, there is no estimate, cache or index of it yet
+    if(FileTail::is_writing(this->filename.c_str())) {
+        this->following_upload = true;
+        if(!FileTail::follow() || !reader.attach(this->current_file_handler, true)) {
+            stream->printf("Not enough memory to play %s while it is uploaded\r\n", this->filename.c_str());
+            abort_command("1", stream);
+            return;
+        }
+        stream->printf("  Following upload, %lu bytes so far\r\n", FileTail::get_written());
+        this->played_cnt = 0;
+        this->played_lines = 0;
+        this->elapsed_secs = 0;
+        THEKERNEL->conveyor->reset_stats();
+        return;
+    }
+
+    start_estimate();
+
+    // start part way through the file if we were passed the -l ( line ) option, the cache has no line numbers
+    size_t pos= options.find("-l");
+    uint32_t line= pos == string::npos ? 0 : strtoul(options.substr(pos + 2).c_str(), nullptr, 10);
+    if(line <= 1 && open_job_cache()) {
+        stream->printf("  Playing compiled %s.bin\r\n", this->filename.c_str());
+    }
+
+    reader.attach(this->current_file_handler);
     this->played_cnt = 0;
+    this->played_lines = 0;
     this->elapsed_secs = 0;
+    THEKERNEL->conveyor->reset_stats();
+    if(line > 1) restart_at_line(line, stream);
+}
+
+// swap the open file for its compiled cache if there is one that is up to date, file_size becomes the size of its records
+bool Player::open_job_cache()
+{
+    this->playing_cache = false;
+    FILE *bp= JobCache::open(this->filename, this->current_file_handler, file_size);
+    if(bp == nullptr) return false;
+
+    fclose(this->current_file_handler);
+    this->current_file_handler = bp;
+    long start = ftell(bp);
+    fseek(bp, 0, SEEK_END);
+    file_size = ftell(bp) - start;
+    fseek(bp, start, SEEK_SET);
+    this->playing_cache = true;
+    return true;
+}
+
+// skip to the given line using the index if there is one, then restore the modal state the file had at that line
+void Player::restart_at_line(uint32_t line, StreamOutput *stream)
+{
+    LineIndex::Entry e;
+    if(LineIndex::find(this->filename, file_size, line, e) && fseek(this->current_file_handler, e.offset, SEEK_SET) == 0) {
+        reader.attach(this->current_file_handler);
+    } else {
+        e.line= 1;
+        e.offset= 0;
+        e.state.reset();
+    }
+
+    char buf[130];
+    int len= 1;
+    while(e.line < line && (len= reader.read_line(buf, sizeof(buf))) != 0) {
+        if(len > 0) e.state.scan(buf);
+        ++e.line;
+    }
+    this->played_cnt = e.offset + reader.position();
+    this->played_lines = e.line - 1;
+
+    if(len == 0) {
+        stream->printf("File only has %lu lines\r\n", e.line - 1);
+        return;
+    }
+    stream->printf("  Starting at line %lu, byte %lu\r\n", line, played_cnt);
+
+    char cmd[32];
+    send_gcode(e.state.inches ? "G20" : "G21");
+    send_gcode(e.state.relative ? "G91" : "G90");
+    if(e.state.wcs < 6) snprintf(cmd, sizeof(cmd), "G%d", 54 + e.state.wcs);
+    else snprintf(cmd, sizeof(cmd), "G59.%d", e.state.wcs - 5);
+    send_gcode(cmd);
+    if(e.state.feedrate > 0) {
+        snprintf(cmd, sizeof(cmd), "G1 F%1.4f", e.state.feedrate);
+        send_gcode(cmd);
+    }
+    if(e.state.motion == 0) send_gcode("G0");
+}
+
+void Player::send_gcode(const char *gcode)
+{
+    struct SerialMessage message;
+    message.message = gcode;
+    message.stream = &(StreamOutput::NullStream);
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+}
+
+// plan the moves of the file to find out how long it will take, done in idle time
+void Player::estimate_command( string parameters, StreamOutput *stream )
+{
+    if(parameters.empty()) {
+        if(!estimator.is_done() && !estimator.is_running()) {
+            stream->printf("No estimate, estimate file to make one\r\n");
+        } else {
+            estimator.report(stream, this->playing_file && estimator.get_filename() == this->filename ? played_offset() : 0);
+        }
+        return;
+    }
+
+    string fn= absolute_from_relative(parameters);
+    if(!estimator.start(fn)) {
+        stream->printf("File not found: %s\r\n", fn.c_str());
+        return;
+    }
+    stream->printf("Estimating %s in idle time, estimate shows the result\r\n", fn.c_str());
+}
+
+// estimate the file being opened unless it already has been, must be called while file_size is that of the source
+void Player::start_estimate()
+{
+    if(estimator.get_filename() == this->filename && estimator.get_file_size() == (uint32_t)file_size &&
+       (estimator.is_done() || estimator.is_running())) return;
+    estimator.start(this->filename);
+}
+
+// how far through the source file we are, a compiled file has the records in the same order as the lines
+uint32_t Player::played_offset() const
+{
+    if(!this->playing_cache || file_size <= 0) return played_cnt;
+    return (uint64_t)played_cnt * estimator.get_file_size() / file_size;
+}
+
+// compile the file to file.bin which play will then use in its place
+void Player::compile_command( string parameters, StreamOutput *stream )
+{
+    string fn= absolute_from_relative(parameters);
+
+    if(this->playing_file || this->suspended) {
+        stream->printf("Currently printing, abort print first\r\n");
+        return;
+    }
+
+    JobCache::compile(fn, stream);
+}
+
+// build an index of the file so play -l can get to a line quickly
+void Player::index_command( string parameters, StreamOutput *stream )
+{
+    string options= extract_options(parameters);
+    string fn= absolute_from_relative(parameters);
+
+    if(this->playing_file || this->suspended) {
+        stream->printf("Currently printing, abort print first\r\n");
+        return;
+    }
+
+    uint32_t every= LineIndex::default_every;
+    size_t pos= options.find("-k");
+    if(pos != string::npos) {
+        every= strtoul(options.substr(pos + 2).c_str(), nullptr, 10);
+        if(every == 0) every= LineIndex::default_every;
+    }
+
+    LineIndex::build(fn, every, stream);
 }
 
 void Player::progress_command( string parameters, StreamOutput *stream )
@@ -331,9 +593,22 @@ void Player::progress_command( string parameters, StreamOutput *stream )
         return;
     }
 
+    if(this->following_upload && FileTail::is_writing(this->filename.c_str())) {
+        // the size is not known until the upload is over
+        if(sdprinting)
+            stream->printf("SD printing byte %lu/%lu\r\n", played_cnt, FileTail::get_written());
+        else
+            stream->printf("file: %s, played %lu of %lu bytes uploaded so far, elapsed time: %02lu:%02lu:%02lu\r\n", this->filename.c_str(), played_cnt, FileTail::get_written(), this->elapsed_secs / 3600, (this->elapsed_secs % 3600) / 60, this->elapsed_secs % 60);
+        return;
+    }
+
     if(file_size > 0) {
         unsigned long est = 0;
-        if(this->elapsed_secs > 10) {
+        bool planned = estimator.is_done() && estimator.get_filename() == this->filename;
+        if(planned) {
+            // the time left as planned, which knows about slow and fast parts of the file unlike the bytes per second
+            est = lroundf(estimator.remaining(played_offset()));
+        } else if(this->elapsed_secs > 10) {
             unsigned long bytespersec = played_cnt / this->elapsed_secs;
             if(bytespersec > 0)
                 est = (file_size - played_cnt) / bytespersec;
@@ -347,6 +622,12 @@ void Player::progress_command( string parameters, StreamOutput *stream )
                 stream->printf(", est time: %02lu:%02lu:%02lu",  est / 3600, (est % 3600) / 60, est % 60);
             }
             stream->printf("\r\n");
+            if(this->job_number > 1 || !this->playlist.empty()) {
+                stream->printf("job %u, %u queued%s%s\r\n", this->job_number, (unsigned)this->playlist.size(),
+                               this->playlist.empty() ? "" : ", next: ", this->playlist.empty() ? "" : this->playlist.front().c_str());
+            }
+            if(planned) estimator.report(stream, played_offset());
+            THEKERNEL->conveyor->print_stats(stream);
         } else {
             stream->printf("SD printing byte %lu/%lu\r\n", played_cnt, file_size);
         }
@@ -362,14 +643,19 @@ void Player::abort_command( string parameters, StreamOutput *stream )
         stream->printf("Not currently playing\r\n");
         return;
     }
+    playlist.clear();
+    clear_subroutines();
     suspended= false;
     playing_file = false;
+    playing_cache = false;
     played_cnt = 0;
+    played_lines = 0;
     file_size = 0;
     this->filename = "";
     this->current_stream = NULL;
-    fclose(current_file_handler);
-    current_file_handler = NULL;
+    reader.detach();
+    close_file();
+    stop_following();
     if(parameters.empty()) {
         // clear out the block queue, will wait until queue is empty
         // MUST be called in on_main_loop to make sure there are no blocked main loops waiting to put something on the queue
@@ -401,49 +687,57 @@ void Player::on_main_loop(void *argument)
     }
 
     if( this->playing_file ) {
-        if(THEKERNEL->is_halted()) {
+        if(THEKERNEL->is_halted() || THEROBOT->is_segmenting()) {
             return;
         }
 
-        char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
-        bool discard = false;
+        if(!this->sub_stack.empty()) {
+            play_subroutine_line();
+            return;
+        }
 
-        while(fgets(buf, sizeof(buf), this->current_file_handler) != NULL) {
-            int len = strlen(buf);
-            if(len == 0) continue; // empty line? should not be possible
-            if(buf[len - 1] == '\n' || feof(this->current_file_handler)) {
-                if(discard) { // we are discarding a long line
-                    discard = false;
-                    continue;
-                }
-                if(len == 1) continue; // empty line
+        if(this->playing_cache) {
+            if(play_cached_record()) return; // we feed one record per main loop
 
-                if(this->current_stream != nullptr) {
-                    this->current_stream->printf("%s", buf);
-                }
+        } else {
+            char buf[130]; // lines upto 128 characters are allowed, anything longer is discarded
+            int len;
 
-                struct SerialMessage message;
-                message.message = buf;
-                message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+            while((len = reader.read_line(buf, sizeof(buf))) != 0) {
+                ++played_lines;
+                if(len > 0) {
+                    if(len == 1) continue; // empty line
 
-                // waits for the queue to have enough room
-                THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
-                played_cnt += len;
-                return; // we feed one line per main loop
+                    played_cnt += len;
+                    THEROBOT->set_source_line(played_lines);
+                    play_line(buf);
+                    return; // we feed one line per main loop
 
-            } else {
-                // discard long line
-                if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
-                discard = true;
+                } else {
+                    // discarded long line
+                    if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
+                }
             }
+
+            // caught up with a file that is being uploaded
+            if(reader.is_waiting() && follow_upload()) return;
         }
 
+        reader.detach();
+        close_file();
+        stop_following();
+        clear_subroutines();
+
+        // the tail of this file is still in the planner, the next job carries straight on from it
+        if(start_next_job()) return;
+
         this->playing_file = false;
+        this->playing_cache = false;
         this->filename = "";
         played_cnt = 0;
+        played_lines = 0;
         file_size = 0;
-        fclose(this->current_file_handler);
-        current_file_handler = NULL;
+        THEROBOT->set_source_line(0);
         this->current_stream = NULL;
 
         if(this->reply_stream != NULL) {
@@ -454,6 +748,323 @@ void Player::on_main_loop(void *argument)
     }
 }
 
+// opens the next file on the playlist, with the counts of the job starting again, returns false once there are none left
+bool Player::start_next_job()
+{
+    while(!this->playlist.empty()) {
+        this->filename = this->playlist.front();
+        this->playlist.erase(this->playlist.begin());
+        this->job_number++;
+
+        if(!open_file(this->filename.c_str())) {
+            THEKERNEL->streams->printf("Job %u file not found: %s\r\n", this->job_number, this->filename.c_str());
+            continue;
+        }
+
+        if(fseek(this->current_file_handler, 0, SEEK_END) != 0) {
+            file_size = 0;
+        } else {
+            file_size = ftell(this->current_file_handler);
+            fseek(this->current_file_handler, 0, SEEK_SET);
+        }
+        if(FileTail::is_writing(this->filename.c_str())) {
+            this->following_upload = true;
+            if(!FileTail::follow() || !reader.attach(this->current_file_handler, true)) {
+                THEKERNEL->streams->printf("Job %u not enough memory to play %s while it is uploaded\r\n", this->job_number, this->filename.c_str());
+                reader.detach();
+                close_file();
+                stop_following();
+                continue;
+            }
+        } else {
+            start_estimate();
+            open_job_cache();
+            reader.attach(this->current_file_handler);
+        }
+
+        this->played_cnt = 0;
+
+        this->played_lines = 0;
+        this->elapsed_secs = 0;
+        THEKERNEL->conveyor->reset_stats();
+        THEKERNEL->streams->printf("Playing job %u %s\r\n", this->job_number, this->filename.c_str());
+        return true;
+    }
+    return false;
+}
+
+// playback has caught up with a file that is being uploaded, returns false if there will be no more of it
+bool Player::follow_upload()
+{
+    const char *fn = this->filename.c_str();
+    bool writing = FileTail::is_writing(fn);
+    if(!writing && FileTail::has_failed(fn)) {
+        THEKERNEL->streams->printf("Upload of %s failed, stopped playing it\r\n", fn);
+        return false;
+    }
+
+    if(!writing || FileTail::get_on_card() > (uint32_t)file_size) {
+        // the card has more than the handle knew about when it was opened, so open it again where we got to
+        uint32_t at = reader.file_offset();
+        fclose(this->current_file_handler);
+        this->current_file_handler = fopen(fn, "r");
+        if(this->current_file_handler == NULL || fseek(this->current_file_handler, 0, SEEK_END) != 0) {
+            THEKERNEL->streams->printf("Upload of %s failed, stopped playing it\r\n", fn);
+            return false;
+        }
+        file_size = ftell(this->current_file_handler);
+        fseek(this->current_file_handler, at, SEEK_SET);
+        reader.reopen(this->current_file_handler, writing);
+
+    } else if(reader.file_offset() < FileTail::get_written()) {
+        // fallen behind what is kept in RAM, so the writer has to put it on the card
+        FileTail::want_sync();
+    }
+    return true;
+}
+
+void Player::stop_following()
+{
+    if(!this->following_upload) return;
+    FileTail::unfollow();
+    this->following_upload = false;
+}
+
+// sends a line of the file as if it had been received on the console
+void Player::play_line(const char *line)
+{
+    if(this->current_stream != nullptr) {
+        this->current_stream->printf("%s", line);
+    }
+
+    struct SerialMessage message;
+    message.message = line;
+    message.stream = this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+
+    // waits for the queue to have enough room
+    this->playing_line = true;
+    THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+    this->playing_line = false;
+}
+
+// runs the next record of a compiled file, moves go straight to the modules without being parsed, returns false at the end
+bool Player::play_cached_record()
+{
+    JobCache::Record r;
+    size_t n= JobCache::read(reader, r);
+    if(n == 0) return false;
+    played_cnt += n;
+    THEROBOT->set_source_line(0); // the cache does not keep the line numbers
+    run_record(r);
+    return true;
+}
+
+void Player::run_record(const JobCache::Record& r)
+{
+    StreamOutput *stream= this->current_stream == nullptr ? &(StreamOutput::NullStream) : this->current_stream;
+
+    if(r.type == JobCache::RECORD_TEXT) {
+        if(this->current_stream != nullptr) {
+            this->current_stream->printf("%s\n", r.text);
+        }
+        struct SerialMessage message;
+        message.message = r.text;
+        message.stream = stream;
+        this->playing_line = true;
+        THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+        this->playing_line = false;
+        return;
+    }
+
+    Gcode gcode(r.type == JobCache::RECORD_G1 ? "G1" : "G0", stream);
+    if(this->current_stream != nullptr) this->current_stream->printf("G%d", r.type);
+    int v= 0;
+    for (int i = 0; i < 8; i++) {
+        if(r.mask & (1 << i)) {
+            gcode.set_value(JobCache::letters[i], r.values[v]);
+            if(this->current_stream != nullptr) this->current_stream->printf(" %c%1.4f", JobCache::letters[i], r.values[v]);
+            v++;
+        }
+    }
+    if(this->current_stream != nullptr) this->current_stream->printf("\n");
+
+    // waits for the queue to have enough room
+    THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode);
+
+    if(gcode.is_error) {
+        stream->printf("%s%s\r\nEntering Alarm/Halt state\n", THEKERNEL->is_grbl_mode() ? "error:" : "Error: ",
+                       gcode.txt_after_ok.empty() ? "unknown" : gcode.txt_after_ok.c_str());
+        THEKERNEL->call_event(ON_HALT, nullptr);
+    }
+}
+
+void Player::call_subroutine(Gcode *gcode)
+{
+    if(!gcode->has_letter('P')) {
+        gcode->is_error = true;
+        gcode->txt_after_ok = "M98 needs a P";
+        return;
+    }
+    uint32_t number = gcode->get_uint('P');
+    uint32_t times = gcode->has_letter('L') ? gcode->get_uint('L') : 1;
+    if(times == 0) return;
+    if(times > 0xFFFF) times = 0xFFFF;
+
+    if(this->sub_stack.size() >= max_subroutine_depth) {
+        gcode->is_error = true;
+        gcode->txt_after_ok = "subroutines nested too deep";
+        return;
+    }
+
+    SubFrame f{number, (uint16_t)(times - 1), nullptr, 0};
+    if(!cache_subroutine(number)) {
+        // too big to keep in RAM so it is read from the card each time
+        char fn[32];
+        snprintf(fn, sizeof(fn), "/sd/subs/%lu.g", number);
+        f.fp = fopen(fn, "r");
+        if(f.fp == nullptr) {
+            gcode->is_error = true;
+            gcode->txt_after_ok = "subroutine not found: ";
+            gcode->txt_after_ok.append(fn);
+            return;
+        }
+    }
+    this->sub_stack.push_back(f);
+}
+
+// makes sure the subroutine is in the cache, returns false if it is not found or can not be kept there
+bool Player::cache_subroutine(uint32_t number)
+{
+    ++this->sub_calls;
+    for(auto& b : this->sub_cache) {
+        if(b.number == number) {
+            b.last_used = this->sub_calls;
+            return true;
+        }
+    }
+
+    char fn[32];
+    snprintf(fn, sizeof(fn), "/sd/subs/%lu.g", number);
+    FILE *fp = fopen(fn, "r");
+    if(fp == nullptr) return false;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if(size > max_cached_subroutine) {
+        fclose(fp);
+        return false;
+    }
+
+    SubBody body{number, this->sub_calls, ""};
+    LineIndex::State state;
+    state.reset();
+    state.motion = 0xFF; // whatever the caller left it as
+    JobCache::Record r;
+    char buf[130];
+    char out[2 + sizeof(r.text)];
+    bool whole = true;
+    while(fgets(buf, sizeof(buf), fp) != nullptr) {
+        size_t len = strlen(buf);
+        if(buf[len - 1] != '\n' && !feof(fp)) {
+            // a long line, play it from the card where it gets the same warning as in any other file
+            whole = false;
+            break;
+        }
+        while(len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) buf[--len] = '\0';
+        if(len == 0 || buf[0] == ';' || buf[0] == '(') continue;
+        JobCache::compile_line(buf, len, state, r);
+        body.code.append(out, JobCache::encode(r, out));
+    }
+    fclose(fp);
+    if(!whole) return false;
+
+    // make room by dropping the ones used longest ago that are not being played
+    size_t total = body.code.size();
+    for(auto& b : this->sub_cache) total += b.code.size();
+    while(total > subroutine_cache_size) {
+        auto lru = this->sub_cache.end();
+        for(auto i = this->sub_cache.begin(); i != this->sub_cache.end(); ++i) {
+            bool in_use = std::any_of(this->sub_stack.begin(), this->sub_stack.end(), [&i](const SubFrame& f) { return f.fp == nullptr && f.number == i->number; });
+            if(!in_use && (lru == this->sub_cache.end() || i->last_used < lru->last_used)) lru = i;
+        }
+        if(lru == this->sub_cache.end()) return false;
+        total -= lru->code.size();
+        this->sub_cache.erase(lru);
+    }
+
+    this->sub_cache.push_back(std::move(body));
+    return true;
+}
+
+// plays the next line of the innermost subroutine, which runs again or returns to its caller at the end
+void Player::play_subroutine_line()
+{
+    SubFrame& f = this->sub_stack.back();
+    if(f.fp == nullptr) {
+        JobCache::Record r;
+        size_t n = 0;
+        for(auto& b : this->sub_cache) {
+            if(b.number == f.number) {
+                n = JobCache::decode(&b.code[f.pos], b.code.size() - f.pos, r);
+                break;
+            }
+        }
+        if(n == 0) {
+            return_from_subroutine();
+            return;
+        }
+        f.pos += n;
+        run_record(r); // may call or return, so the frame is not used after this
+        return;
+    }
+
+    char buf[130];
+    while(fgets(buf, sizeof(buf), f.fp) != nullptr) {
+        size_t len = strlen(buf);
+        if(buf[len - 1] != '\n' && !feof(f.fp)) {
+            int c;
+            while((c = fgetc(f.fp)) != EOF && c != '\n') ;
+            if(this->current_stream != nullptr) { this->current_stream->printf("Warning: Discarded long line\n"); }
+            continue;
+        }
+        if(len == 1) continue; // empty line
+        play_line(buf);
+        return;
+    }
+    return_from_subroutine();
+}
+
+void Player::return_from_subroutine()
+{
+    SubFrame& f = this->sub_stack.back();
+    if(f.left > 0) {
+        --f.left;
+        f.pos = 0;
+        if(f.fp != nullptr) fseek(f.fp, 0, SEEK_SET);
+        return;
+    }
+    if(f.fp != nullptr) fclose(f.fp);
+    this->sub_stack.pop_back();
+}
+
+// a new job may come with new subroutines, so they are compiled again rather than trusting the cache
+void Player::clear_subroutines()
+{
+    for(auto& f : this->sub_stack) {
+        if(f.fp != nullptr) fclose(f.fp);
+    }
+    this->sub_stack.clear();
+    this->sub_cache.clear();
+}
+
+// while the main loop is waiting for room in the queue read ahead, big reads only so the card is not kept busy
+void Player::on_idle(void *argument)
+{
+    if(this->playing_file) reader.fill(2048);
+    // a little at a time so the estimate does not hold anything up
+    if(estimator.is_running()) estimator.run(1000);
+}
+
 void Player::on_get_public_data(void *argument)
 {
     PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "Module.h"
+#include "LineReader.h"
+#include "JobEstimator.h"
+#include "JobCache.h"
 
 #include <stdio.h>
 #include <string>
@@ -17,6 +20,7 @@
 using std::string;
 
 class StreamOutput;
+class Gcode;
 
 class Player : public Module {
     public:
@@ -25,6 +29,7 @@ class Player : public Module {
         void on_module_loaded();
         void on_console_line_received( void* argument );
         void on_main_loop( void* argument );
+        void on_idle( void* argument );
         void on_second_tick(void* argument);
         void on_get_public_data(void* argument);
         void on_set_public_data(void* argument);
@@ -37,6 +42,27 @@ class Player : public Module {
         void abort_command( string parameters, StreamOutput* stream );
         void suspend_command( string parameters, StreamOutput* stream );
         void resume_command( string parameters, StreamOutput* stream );
+        void index_command( string parameters, StreamOutput* stream );
+        void compile_command( string parameters, StreamOutput* stream );
+        void estimate_command( string parameters, StreamOutput* stream );
+        void start_estimate();
+        uint32_t played_offset() const;
+        bool open_file(const char *fn);
+        void close_file();
+        bool open_job_cache();
+        bool play_cached_record();
+        void run_record(const JobCache::Record& r);
+        void play_line(const char *line);
+        void call_subroutine(Gcode *gcode);
+        bool cache_subroutine(uint32_t number);
+        void play_subroutine_line();
+        void return_from_subroutine();
+        void clear_subroutines();
+        bool start_next_job();
+        bool follow_upload();
+        void stop_following();
+        void restart_at_line(uint32_t line, StreamOutput* stream);
+        void send_gcode(const char *gcode);
         string extract_options(string& args);
         void suspend_part2();
 
@@ -48,15 +74,40 @@ class Player : public Module {
         StreamOutput* reply_stream;
 
         FILE* current_file_handler;
+        LineReader reader;
+        JobEstimator estimator;
         long file_size;
         unsigned long played_cnt;
+        uint32_t played_lines; // lines read from the file, including empty ones
         unsigned long elapsed_secs;
         float saved_position[3]; // only saves XYZ
         std::map<uint16_t, float> saved_temperatures;
+        std::vector<string> playlist; // files queued with play -q, the next is opened as soon as the current one is read
+
+        // M98 Pn Ln plays /sd/subs/n.g L times before carrying on after the M98, M99 or the end of it returns
+        struct SubFrame {
+            uint32_t number;
+            uint16_t left; // times still to run after this one
+            FILE *fp;      // nullptr if it is played from sub_cache
+            uint32_t pos;  // the next record of the cached body
+        };
+        // small subroutines are compiled the first time they are called and played pre parsed after that
+        struct SubBody {
+            uint32_t number;
+            uint32_t last_used;
+            string code; // the records as they are in a compiled file
+        };
+        std::vector<SubFrame> sub_stack;
+        std::vector<SubBody> sub_cache;
+        uint32_t sub_calls;
+        uint16_t job_number; // of the current file since the playlist was started
         struct {
             bool on_boot_gcode_enable:1;
             bool booted:1;
             bool playing_file:1;
+            bool playing_cache:1; // current_file_handler is a compiled JobCache file
+            bool following_upload:1; // current_file_handler is still being uploaded, the end of it comes from FileTail
+            bool playing_line:1; // a line of the file is being sent, so an M98 or M99 is from the file
             bool suspended:1;
             bool was_playing_file:1;
             bool leave_heaters_on:1;
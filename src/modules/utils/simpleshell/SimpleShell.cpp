@@ -12,14 +12,18 @@
 #include "libs/utils.h"
 #include "libs/SerialMessage.h"
 #include "libs/StreamOutput.h"
+#include "StreamOutputPool.h"
 #include "modules/robot/Conveyor.h"
 #include "DirHandle.h"
 #include "mri.h"
 #include "version.h"
 #include "PublicDataRequest.h"
-#include "AppendFileStream.h"
 #include "FileStream.h"
+#include "StringStream.h"
+#include "WriteBehind.h"
 #include "checksumm.h"
+#include "Config.h"
+#include "ConfigValue.h"
 #include "PublicData.h"
 #include "Gcode.h"
 #include "Robot.h"
@@ -29,17 +33,25 @@
 #include "StepperMotor.h"
 #include "Configurator.h"
 #include "Block.h"
+#include "StepTicker.h"
 
 #include "TemperatureControlPublicAccess.h"
 #include "EndstopsPublicAccess.h"
 #include "NetworkPublicAccess.h"
 #include "platform_memory.h"
+#include "SlabPool.h"
+#include "BootTrace.h"
+#include "Trace.h"
 #include "SwitchPublicAccess.h"
+#include "PlayerPublicAccess.h"
 #include "SDFAT.h"
 #include "Thermistor.h"
 #include "md5.h"
 #include "utils.h"
 #include "AutoPushPop.h"
+#include "FileWriter.h"
+#include "LineReader.h"
+#include "us_ticker_api.h"
 
 #include "system_LPC17xx.h"
 #include "LPC17xx.h"
@@ -47,6 +59,8 @@
 #include "mbed.h" // for wait_ms()
 
 extern unsigned int g_maximumHeapAddress;
+extern unsigned int g_heapInUse;
+extern unsigned int g_heapPeak;
 
 #include <malloc.h>
 #include <mri.h>
@@ -57,6 +71,14 @@ extern unsigned int g_maximumHeapAddress;
 extern "C" uint32_t  __end__;
 extern "C" uint32_t  __malloc_free_list;
 extern "C" uint32_t  _sbrk(int size);
+extern "C" uint32_t  __StackTop;
+
+// binary uploads, the largest frame, how many frames the host may send ahead of the replies and how long to wait for data
+#define upload_chunk_size 2048
+#define upload_window     4
+#define upload_timeout_us 5000000
+
+#define trace_save_on_halt_checksum CHECKSUM("trace_save_on_halt")
 
 
 // command lookup table
@@ -75,6 +97,7 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"help",     SimpleShell::help_command},
     {"?",        SimpleShell::help_command},
     {"version",  SimpleShell::version_command},
+    {"boottime", SimpleShell::boottime_command},
     {"mem",      SimpleShell::mem_command},
     {"get",      SimpleShell::get_command},
     {"set_temp", SimpleShell::set_temp_command},
@@ -87,12 +110,18 @@ const SimpleShell::ptentry_t SimpleShell::commands_table[] = {
     {"thermistors", SimpleShell::print_thermistors_command},
     {"md5sum",   SimpleShell::md5sum_command},
     {"test",     SimpleShell::test_command},
+    {"stepstats", SimpleShell::stepstats_command},
+    {"top",      SimpleShell::top_command},
+    {"trace",    SimpleShell::trace_command},
 
     // unknown command
     {NULL, NULL}
 };
 
 int SimpleShell::reset_delay_secs = 0;
+bool SimpleShell::trace_save_pending = false;
+SimpleShell::MD5Job *SimpleShell::md5_job = nullptr;
+SimpleShell::DirCursor *SimpleShell::dir_cursor = nullptr;
 
 // Adam Greens heap walk from http://mbed.org/forum/mbed/topic/2701/?page=4#comment-22556
 static uint32_t heapWalk(StreamOutput *stream, bool verbose)
@@ -149,12 +178,28 @@ static uint32_t heapWalk(StreamOutput *stream, bool verbose)
     return freeSize;
 }
 
+// at boot the RAM between the heap and the stack pointer was filled with 0xdeadbeef, the deepest the stack has been is
+// the lowest word that is not that any more, looked for from the limit of the stack up or without one from the heap
+static uint32_t stackHighWater()
+{
+    uint32_t *p = (uint32_t *)(STACK_SIZE ? g_maximumHeapAddress + 32 : _sbrk(0));
+    uint32_t *top = &__StackTop;
+    while (p < top && *p == 0xdeadbeef) p++;
+    return (uint32_t)top - (uint32_t)p;
+}
+
 
 void SimpleShell::on_module_loaded()
 {
     this->register_for_event(ON_CONSOLE_LINE_RECEIVED);
     this->register_for_event(ON_GCODE_RECEIVED);
     this->register_for_event(ON_SECOND_TICK);
+    this->register_for_event(ON_IDLE);
+#ifdef EVENT_TRACE
+    if(THEKERNEL->config->value(trace_save_on_halt_checksum)->by_default(false)->as_bool()) {
+        this->register_for_event(ON_HALT);
+    }
+#endif
 
     reset_delay_secs = 0;
 }
@@ -175,43 +220,108 @@ void SimpleShell::on_gcode_received(void *argument)
     string args = get_arguments(gcode->get_command());
 
     if (gcode->has_m) {
-        if (gcode->m == 20) { // list sd card
+        if (gcode->m == 20) { // list sd card, S is the first entry and P how many to list for a page of a large directory
             gcode->stream->printf("Begin file list\r\n");
-            ls_command("/sd", gcode->stream);
+            uint32_t offset = gcode->has_letter('S') ? gcode->get_uint('S') : 0;
+            uint32_t count = gcode->has_letter('P') ? gcode->get_uint('P') : UINT32_MAX;
+            ls_page("/sd", offset, count, false, false, gcode->stream);
             gcode->stream->printf("End file list\r\n");
 
         } else if (gcode->m == 30) { // remove file
             if(!args.empty() && !THEKERNEL->is_grbl_mode())
                 rm_command("/sd/" + args, gcode->stream);
+
+        } else if (gcode->m == 997) { // reset for the bootloader to flash /sd/firmware.bin, once the moves before it are done
+            void *returned_data;
+            bool playing = PublicData::get_value(player_checksum, is_playing_checksum, &returned_data) && *static_cast<bool *>(returned_data);
+            if(!file_exists("/sd/firmware.bin")) {
+                gcode->stream->printf("error: there is no /sd/firmware.bin to flash\r\n");
+            } else if(playing) {
+                gcode->stream->printf("error: not while a file is playing\r\n");
+            } else {
+                THECONVEYOR->wait_for_idle();
+                gcode->stream->printf("Flashing firmware.bin, rebooting in 2 seconds...\r\n");
+                reset_delay_secs = 2; // so the reply gets back to the host first
+            }
+
+#ifdef EVENT_PROFILE
+        } else if (gcode->m == 577) { // reset the per module event cycle counts shown by top
+            THEKERNEL->reset_event_profile();
+#endif
         }
     }
 }
 
-bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+// the commands are indexed by checksum the first time one is looked up, anything that is not a whole command name is
+// matched on the start of it as the table always was, so "load_command" still finds load
+const SimpleShell::ptentry_t *SimpleShell::find_command(const char *cmd, size_t n)
 {
-    for (const ptentry_t *p = commands_table; p->command != NULL; ++p) {
-        if (strncasecmp(cmd, p->command, strlen(p->command)) == 0) {
-            p->func(args, stream);
-            return true;
+    static uint8_t slots[command_slots]; // index + 1 into commands_table, 0 is empty
+    static bool indexed = false;
+    if(!indexed) {
+        for (uint8_t i = 0; commands_table[i].command != NULL; i++) {
+            uint16_t s = get_checksum(commands_table[i].command) % command_slots;
+            while(slots[s] != 0) s = (s + 1) % command_slots;
+            slots[s] = i + 1;
         }
+        indexed = true;
     }
 
-    return false;
+    char word[16];
+    if(n < sizeof(word)) {
+        for (size_t i = 0; i < n; i++) word[i] = tolower(cmd[i]);
+        word[n] = '\0';
+        for (uint16_t s = get_checksum(word) % command_slots; slots[s] != 0; s = (s + 1) % command_slots) {
+            const ptentry_t *p = &commands_table[slots[s] - 1];
+            if(strcmp(p->command, word) == 0) return p;
+        }
+    }
+
+    for (const ptentry_t *p = commands_table; p->command != NULL; ++p) {
+        size_t len = strlen(p->command);
+        if (len <= n && strncasecmp(cmd, p->command, len) == 0) return p;
+    }
+    return nullptr;
+}
+
+bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+{
+    const ptentry_t *p = find_command(cmd, strlen(cmd));
+    if(p == nullptr) return false;
+
+    p->func(std::move(args), stream);
+    return true;
+}
+
+static bool word_is(const char *word, size_t n, const char *s)
+{
+    return strncmp(word, s, n) == 0 && s[n] == '\0';
 }
 
 // When a new line is received, check if it is a command, and if it is, act upon it
 void SimpleShell::on_console_line_received( void *argument )
 {
-    SerialMessage new_message = *static_cast<SerialMessage *>(argument);
-    string possible_command = new_message.message;
+    SerialMessage& new_message = *static_cast<SerialMessage *>(argument);
+
+    // ignore anything that is not lowercase or a $ as it is not a command, before it is copied to a string
+    if(new_message.message.empty() || (!islower(new_message.message[0]) && new_message.message[0] != '$')) {
+        return;
+    }
 
-    // ignore anything that is not lowercase or a $ as it is not a command
-    if(possible_command.size() == 0 || (!islower(possible_command[0]) && possible_command[0] != '$')) {
+    // what hosts poll for while a job runs is answered straight from the line
+    const char *line = new_message.message.c_str();
+    if(strcmp(line, "get temp") == 0) {
+        print_temperatures(new_message.stream);
+        return;
+    }
+    if(strcmp(line, "get pos") == 0) {
+        print_positions(new_message.stream);
         return;
     }
 
     // it is a grbl compatible command
-    if(possible_command[0] == '$' && possible_command.size() >= 2) {
+    if(line[0] == '$' && new_message.message.size() >= 2) {
+        string possible_command = new_message.message;
         switch(possible_command[1]) {
             case 'G':
                 // issue get state
@@ -226,6 +336,18 @@ void SimpleShell::on_console_line_received( void *argument )
                 }
                 break;
 
+            case 'J': {
+                // $J=G91 X10 F1000 jogs and 0x85 cancels them, see Robot::jog()
+                if(possible_command.size() < 3 || possible_command[2] != '=') {
+                    new_message.stream->printf("error:Invalid statement\n");
+                    break;
+                }
+                string err= THEROBOT->jog(possible_command.c_str() + 3);
+                if(err.empty()) new_message.stream->printf("ok\n");
+                else new_message.stream->printf("error:%s\n", err.c_str());
+                break;
+            }
+
             case '#':
                 grblDP_command("", new_message.stream);
                 new_message.stream->printf("ok\n");
@@ -251,44 +373,119 @@ void SimpleShell::on_console_line_received( void *argument )
 
     }else{
 
-        //new_message.stream->printf("Received %s\r\n", possible_command.c_str());
-        string cmd = shift_parameter(possible_command);
+        // the command is looked up in the line, only the arguments are copied for it
+        size_t n = strcspn(line, " ");
+        const char *args = line[n] == ' ' ? line + n + 1 : line + n;
 
         // Configurator commands
-        if (cmd == "config-get"){
-            THEKERNEL->configurator->config_get_command(  possible_command, new_message.stream );
+        if (word_is(line, n, "config-get")){
+            THEKERNEL->configurator->config_get_command(  args, new_message.stream );
 
-        } else if (cmd == "config-set"){
-            THEKERNEL->configurator->config_set_command(  possible_command, new_message.stream );
+        } else if (word_is(line, n, "config-set")){
+            THEKERNEL->configurator->config_set_command(  args, new_message.stream );
 
-        } else if (cmd == "config-load"){
-            THEKERNEL->configurator->config_load_command(  possible_command, new_message.stream );
+        } else if (word_is(line, n, "config-load")){
+            THEKERNEL->configurator->config_load_command(  args, new_message.stream );
 
-        } else if (cmd == "play" || cmd == "progress" || cmd == "abort" || cmd == "suspend" || cmd == "resume") {
+        } else if (word_is(line, n, "play") || word_is(line, n, "progress") || word_is(line, n, "abort") || word_is(line, n, "suspend") ||
+                   word_is(line, n, "resume") || word_is(line, n, "index") || word_is(line, n, "compile") || word_is(line, n, "estimate")) {
             // these are handled by Player module
 
-        } else if (cmd == "fire") {
+        } else if (word_is(line, n, "fire")) {
             // these are handled by Laser module
 
-        } else if (cmd == "ok") {
+        } else if (word_is(line, n, "ok")) {
             // probably an echo so reply ok
             new_message.stream->printf("ok\n");
 
-        }else if(!parse_command(cmd.c_str(), possible_command, new_message.stream)) {
-            new_message.stream->printf("error:Unsupported command - %s\n", cmd.c_str());
+        } else {
+            const ptentry_t *p = find_command(line, n);
+            if(p != nullptr) p->func(args, new_message.stream);
+            else new_message.stream->printf("error:Unsupported command - %.*s\n", (int)n, line);
         }
     }
 }
 
 // Act upon an ls command
 // Convert the first parameter into an absolute path, then list the files in that path
+struct SimpleShell::DirCursor {
+    string path;
+    DIR *d;
+    uint32_t index; // entry readdir gives next
+};
+
+void SimpleShell::close_dir_cursor()
+{
+    if(dir_cursor == nullptr) return;
+    closedir(dir_cursor->d);
+    delete dir_cursor;
+    dir_cursor = nullptr;
+}
+
+// lists count entries of path from offset on, when a page is filled it ends with the offset of the next one
+// the directory is kept open at the end of the page, so asking for the next page does not read the entries before it again
+void SimpleShell::ls_page(const string &path, uint32_t offset, uint32_t count, bool sizes, bool machine, StreamOutput *stream)
+{
+    if(dir_cursor != nullptr && (dir_cursor->path != path || dir_cursor->index > offset)) close_dir_cursor();
+
+    if(dir_cursor == nullptr) {
+        DIR *d = opendir(path.c_str());
+        if (d == NULL) {
+            stream->printf("Could not open directory %s\r\n", path.c_str());
+            return;
+        }
+        dir_cursor = new DirCursor;
+        dir_cursor->path = path;
+        dir_cursor->d = d;
+        dir_cursor->index = 0;
+    }
+
+    struct dirent *p = nullptr;
+    while(dir_cursor->index < offset && (p = readdir(dir_cursor->d)) != NULL) dir_cursor->index++;
+
+    uint32_t n = 0;
+    while(n < count && (dir_cursor->index >= offset) && (p = readdir(dir_cursor->d)) != NULL) {
+        // lower case in place as the name is only wanted for printing
+        for(char *c = p->d_name; *c; ++c) *c = tolower(*c);
+
+        if(machine) {
+            if(p->d_isdir) stream->printf("d %s\r\n", p->d_name);
+            else stream->printf("f %u %s\r\n", p->d_fsize, p->d_name);
+        } else if(p->d_isdir) {
+            stream->printf("%s/\r\n", p->d_name);
+        } else if(sizes) {
+            stream->printf("%s %u\r\n", p->d_name, p->d_fsize);
+        } else {
+            stream->printf("%s\r\n", p->d_name);
+        }
+        dir_cursor->index++;
+        n++;
+    }
+
+    if(n == count) {
+        // there may be more
+        if(machine || count != UINT32_MAX) stream->printf("next %lu\r\n", dir_cursor->index);
+    } else {
+        close_dir_cursor();
+        if(machine) stream->printf("end\r\n");
+    }
+}
+
+// ls [-s] [-m] [-o offset] [-n count] [folder]
 void SimpleShell::ls_command( string parameters, StreamOutput *stream )
 {
-    string path, opts;
+    string path;
+    bool sizes = false, machine = false;
+    uint32_t offset = 0, count = UINT32_MAX;
     while(!parameters.empty()) {
         string s = shift_parameter( parameters );
-        if(s.front() == '-') {
-            opts.append(s);
+        if(s == "-o") {
+            offset = strtoul(shift_parameter( parameters ).c_str(), nullptr, 10);
+        } else if(s == "-n") {
+            count = strtoul(shift_parameter( parameters ).c_str(), nullptr, 10);
+        } else if(s.front() == '-') {
+            if(s.find('s') != string::npos) sizes = true;
+            if(s.find('m') != string::npos) machine = true;
         } else {
             path = s;
             if(!parameters.empty()) {
@@ -299,31 +496,14 @@ void SimpleShell::ls_command( string parameters, StreamOutput *stream )
         }
     }
 
-    path = absolute_from_relative(path);
-
-    DIR *d;
-    struct dirent *p;
-    d = opendir(path.c_str());
-    if (d != NULL) {
-        while ((p = readdir(d)) != NULL) {
-            stream->printf("%s", lc(string(p->d_name)).c_str());
-            if(p->d_isdir) {
-                stream->printf("/");
-            } else if(opts.find("-s", 0, 2) != string::npos) {
-                stream->printf(" %d", p->d_fsize);
-            }
-            stream->printf("\r\n");
-        }
-        closedir(d);
-    } else {
-        stream->printf("Could not open directory %s\r\n", path.c_str());
-    }
+    ls_page(absolute_from_relative(path), offset, count, sizes, machine, stream);
 }
 
 extern SDFAT mounter;
 
 void SimpleShell::remount_command( string parameters, StreamOutput *stream )
 {
+    close_dir_cursor();
     mounter.remount();
     stream->printf("remounted\r\n");
 }
@@ -427,7 +607,7 @@ void SimpleShell::cat_command( string parameters, StreamOutput *stream )
             buffer.clear();
             if(linecnt > 80) linecnt = 0;
             // we need to kick things or they die
-            THEKERNEL->call_event(ON_IDLE);
+            THEKERNEL->yield();
         }
         if ( newlines == limit ) {
             break;
@@ -449,6 +629,12 @@ void SimpleShell::upload_command( string parameters, StreamOutput *stream )
         return;
     }
 
+    if(parameters.compare(0, 3, "-b ") == 0) {
+        parameters.erase(0, 3);
+        binary_upload_command(parameters, stream);
+        return;
+    }
+
     // open file to upload to
     string upload_filename = absolute_from_relative( parameters );
     FILE *fd = fopen(upload_filename.c_str(), "w");
@@ -464,7 +650,7 @@ void SimpleShell::upload_command( string parameters, StreamOutput *stream )
     while(uploading) {
         if(!stream->ready()) {
             // we need to kick things or they die
-            THEKERNEL->call_event(ON_IDLE);
+            THEKERNEL->yield();
             continue;
         }
 
@@ -489,7 +675,7 @@ void SimpleShell::upload_command( string parameters, StreamOutput *stream )
             } else {
                 if ((cnt%1000) == 0) {
                     // we need to kick things or they die
-                    THEKERNEL->call_event(ON_IDLE);
+                    THEKERNEL->yield();
                 }
             }
         }
@@ -500,12 +686,112 @@ void SimpleShell::upload_command( string parameters, StreamOutput *stream )
         if(stream->ready()) {
             c= stream->_getc();
         }else{
-            THEKERNEL->call_event(ON_IDLE);
+            THEKERNEL->yield();
             c= 0;
         }
     } while(c != 4 && c != 26);
 }
 
+// upload -b size filename, the file is sent as frames of a 2 byte length, that many bytes of data and the crc32
+// of the data, all little endian. each frame is answered with ok and its number, the host may send upload_window
+// frames ahead of the replies. any error removes the file.
+void SimpleShell::binary_upload_command( string parameters, StreamOutput *stream )
+{
+    uint32_t size = strtoul(shift_parameter(parameters).c_str(), nullptr, 10);
+    if(size == 0 || parameters.empty()) {
+        stream->printf("usage: upload -b size filename\r\n");
+        return;
+    }
+
+    string upload_filename = absolute_from_relative( parameters );
+    FileWriter writer;
+    if(!writer.open(upload_filename.c_str())) {
+        stream->printf("failed to open file: %s.\r\n", upload_filename.c_str());
+        return;
+    }
+
+    if(!stream->set_raw(true)) {
+        writer.close();
+        remove(upload_filename.c_str());
+        stream->printf("binary upload is not supported on this connection\r\n");
+        return;
+    }
+    stream->printf("ready %d %d\r\n", upload_chunk_size, upload_window);
+
+    uint8_t buf[64];
+    uint8_t field[4];
+    int nfield = 0;
+    int part = 0; // 0 length, 1 data, 2 crc
+    uint32_t left = 0; // data bytes still to come in this frame
+    uint32_t received = 0, chunk_crc = 0, chunks = 0;
+    const char *error = nullptr;
+    uint32_t last_us = us_ticker_read();
+
+    while(error == nullptr && (received < size || part != 0)) {
+        int n = stream->read_raw(buf, sizeof(buf));
+        if(n == 0) {
+            if(us_ticker_read() - last_us > upload_timeout_us) error = "timed out";
+            // we need to kick things or they die
+            THEKERNEL->yield();
+            continue;
+        }
+        last_us = us_ticker_read();
+
+        for (int i = 0; i < n && error == nullptr; ) {
+            if(part == 1) {
+                // data goes straight to the writer
+                uint32_t l = n - i;
+                if(l > left) l = left;
+                if(!writer.write(&buf[i], l)) {
+                    error = "could not write to file";
+                    break;
+                }
+                chunk_crc = crc32(&buf[i], l, chunk_crc);
+                i += l;
+                left -= l;
+                received += l;
+                if(left == 0) part = 2;
+                continue;
+            }
+
+            field[nfield++] = buf[i++];
+            if(part == 0 && nfield == 2) {
+                left = field[0] | (field[1] << 8);
+                if(left == 0 || left > upload_chunk_size || left > size - received) error = "got a bad frame length";
+                chunk_crc = 0;
+                nfield = 0;
+                part = 1;
+
+            } else if(part == 2 && nfield == 4) {
+                uint32_t crc = field[0] | (field[1] << 8) | (field[2] << 16) | ((uint32_t)field[3] << 24);
+                if(crc != chunk_crc) error = "got a crc mismatch";
+                else stream->printf("ok %lu\r\n", ++chunks);
+                nfield = 0;
+                part = 0;
+            }
+        }
+    }
+
+    if(error == nullptr && !writer.close()) error = "could not write to file";
+
+    if(error != nullptr) {
+        writer.close();
+        remove(upload_filename.c_str());
+        // the host may still be sending, let it stop before going back to interpreting what is received
+        uint32_t t = us_ticker_read();
+        while(us_ticker_read() - t < 200000) {
+            if(stream->read_raw(buf, sizeof(buf)) > 0) t = us_ticker_read();
+            THEKERNEL->yield();
+        }
+        stream->set_raw(false);
+        stream->printf("error: upload %s after %lu bytes, file removed\r\n", error, received);
+        return;
+    }
+
+    stream->set_raw(false);
+    stream->printf("uploaded %lu bytes crc32 %08lx\r\n", received, writer.get_crc());
+}
+
 // loads the specified config-override file
 void SimpleShell::load_command( string parameters, StreamOutput *stream )
 {
@@ -515,25 +801,71 @@ void SimpleShell::load_command( string parameters, StreamOutput *stream )
         filename = THEKERNEL->config_override_filename();
     }
 
-    FILE *fp = fopen(filename.c_str(), "r");
-    if(fp != NULL) {
-        char buf[132];
-        stream->printf("Loading config override file: %s...\n", filename.c_str());
-        while(fgets(buf, sizeof buf, fp) != NULL) {
-            stream->printf("  %s", buf);
-            if(buf[0] == ';') continue; // skip the comments
-            // NOTE only Gcodes and Mcodes can be in the config-override
-            Gcode *gcode = new Gcode(buf, &StreamOutput::NullStream);
-            THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode);
-            delete gcode;
-            THEKERNEL->call_event(ON_IDLE);
+    WriteBehind::sync(); // it may not have been written yet
+    if(replay_gcodes(filename.c_str(), stream, true) < 0) {
+        stream->printf("File not found: %s\n", filename.c_str());
+    }
+}
+
+// runs the gcodes in a config override file straight into the modules, the whole file is read in one go if there is
+// room for it. verbose echoes each line and lets idle run between them as the load command does, otherwise only
+// errors are reported, which is how it is done at boot. returns the number of errors or -1 if there is no file
+int SimpleShell::replay_gcodes(const char *filename, StreamOutput *stream, bool verbose)
+{
+    FILE *fp = fopen(filename, "r");
+    if(fp == NULL) return -1;
+
+    if(verbose) stream->printf("Loading config override file: %s...\n", filename);
+
+    int errors = 0, n = 0;
+    auto run = [&](char *line, size_t len) {
+        ++n;
+        if(verbose) stream->printf("  %.*s\n", (int)len, line);
+        while(len > 0 && (line[len - 1] == '\r' || line[len - 1] == ' ')) --len;
+        if(len == 0 || line[0] == ';') return; // skip the comments
+        // NOTE only Gcodes and Mcodes can be in the config-override
+        Gcode gcode(line, len, &StreamOutput::NullStream);
+        THEKERNEL->call_event(ON_GCODE_RECEIVED, &gcode);
+        if(gcode.is_error) {
+            ++errors;
+            stream->printf("config override line %d: %.*s: %s\n", n, (int)len, line, gcode.txt_after_ok.empty() ? "error" : gcode.txt_after_ok.c_str());
+        }
+        if(verbose) THEKERNEL->yield();
+    };
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf = size > 0 ? (char *)AHB0.alloc(size) : nullptr;
+    if(buf == nullptr && size > 0) buf = (char *)malloc(size);
+
+    if(buf != nullptr && fread(buf, 1, size, fp) == (size_t)size) {
+        for(char *p = buf, *end = buf + size; p < end; ) {
+            char *e = (char *)memchr(p, '\n', end - p);
+            if(e == nullptr) e = end;
+            run(p, e - p);
+            p = e + 1;
         }
-        stream->printf("config override file executed\n");
-        fclose(fp);
 
     } else {
-        stream->printf("File not found: %s\n", filename.c_str());
+        // no room for it all, or the read failed, so a line at a time
+        char line[132];
+        fseek(fp, 0, SEEK_SET);
+        while(fgets(line, sizeof line, fp) != NULL) {
+            size_t len = strlen(line);
+            if(len > 0 && line[len - 1] == '\n') --len;
+            run(line, len);
+        }
+    }
+
+    if(buf != nullptr) {
+        if(AHB0.has(buf)) AHB0.dealloc(buf);
+        else free(buf);
     }
+    fclose(fp);
+
+    if(verbose || errors > 0) stream->printf("config override file executed%s\n", errors > 0 ? " with errors" : "");
+    return errors;
 }
 
 // saves the specified config-override file
@@ -547,27 +879,17 @@ void SimpleShell::save_command( string parameters, StreamOutput *stream )
 
     THECONVEYOR->wait_for_idle(); //just to be safe as it can take a while to run
 
-    //remove(filename.c_str()); // seems to cause a hang every now and then
-    {
-        FileStream fs(filename.c_str());
-        fs.printf("; DO NOT EDIT THIS FILE\n");
-        // this also will truncate the existing file instead of deleting it
-    }
-
-    // stream that appends to file
-    AppendFileStream *gs = new AppendFileStream(filename.c_str());
-    // if(!gs->is_open()) {
-    //     stream->printf("Unable to open File %s for write\n", filename.c_str());
-    //     return;
-    // }
+    // the settings are collected in RAM and the file is written from idle in one go
+    StringStream ss;
+    ss.printf("; DO NOT EDIT THIS FILE\n");
 
     __disable_irq();
-    // issue a M500 which will store values in the file stream
-    Gcode *gcode = new Gcode("M500", gs);
+    // issue a M500 which will store values in the string stream
+    Gcode *gcode = new Gcode("M500", &ss);
     THEKERNEL->call_event(ON_GCODE_RECEIVED, gcode );
-    delete gs;
     delete gcode;
     __enable_irq();
+    WriteBehind::queue(filename.c_str(), ss.getOutput());
 
     stream->printf("Settings Stored to %s\r\n", filename.c_str());
 }
@@ -582,8 +904,13 @@ void SimpleShell::mem_command( string parameters, StreamOutput *stream)
 
     uint32_t f = heapWalk(stream, verbose);
     stream->printf("Total Free RAM: %lu bytes\r\n", m + f);
+    stream->printf("Heap in use: %u, most used: %u, Stack most used: %lu", g_heapInUse, g_heapPeak, stackHighWater());
+    if (STACK_SIZE) stream->printf(" of %d", STACK_SIZE);
+    stream->printf(" bytes\r\n");
 
     stream->printf("Free AHB0: %lu, AHB1: %lu\r\n", AHB0.free(), AHB1.free());
+    stream->printf("Largest free AHB0: %lu, AHB1: %lu, most used AHB0: %lu, AHB1: %lu\r\n", AHB0.largest_free(), AHB1.largest_free(), AHB0.get_high_water(), AHB1.get_high_water());
+    SlabPool::debug_all(stream);
     if (verbose) {
         AHB0.debug(stream);
         AHB1.debug(stream);
@@ -626,6 +953,12 @@ void SimpleShell::net_command( string parameters, StreamOutput *stream)
 }
 
 // print out build version
+// how long each phase of init and each module took to load
+void SimpleShell::boottime_command( string parameters, StreamOutput *stream)
+{
+    BootTrace::print(stream);
+}
+
 void SimpleShell::version_command( string parameters, StreamOutput *stream)
 {
     Version vers;
@@ -736,6 +1069,33 @@ void SimpleShell::grblDP_command( string parameters, StreamOutput *stream)
     stream->printf("[PRB:%1.4f,%1.4f,%1.4f:%d]\n", THEROBOT->from_millimeters(px), THEROBOT->from_millimeters(py), THEROBOT->from_millimeters(pz), ps);
 }
 
+// get temp, scans all temperature controls
+void SimpleShell::print_temperatures(StreamOutput *stream)
+{
+    std::vector<struct pad_temperature> controllers;
+    bool ok = PublicData::get_value(temperature_control_checksum, poll_controls_checksum, &controllers);
+    if (ok) {
+        for (auto &c : controllers) {
+           stream->printf("%s (%d) temp: %f/%f @%d\r\n", c.designator.c_str(), c.id, c.current_temperature, c.target_temperature, c.pwm);
+        }
+
+    } else {
+        stream->printf("no heaters found\r\n");
+    }
+}
+
+// get pos, convenience to call all the various M114 variants, shows ABC axis where relevant
+void SimpleShell::print_positions(StreamOutput *stream)
+{
+    std::string buf;
+    THEROBOT->print_position(0, buf); stream->printf("last %s\n", buf.c_str()); buf.clear();
+    THEROBOT->print_position(1, buf); stream->printf("realtime %s\n", buf.c_str()); buf.clear();
+    THEROBOT->print_position(2, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
+    THEROBOT->print_position(3, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
+    THEROBOT->print_position(4, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
+    THEROBOT->print_position(5, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
+}
+
 void SimpleShell::get_command( string parameters, StreamOutput *stream)
 {
     string what = shift_parameter( parameters );
@@ -744,17 +1104,7 @@ void SimpleShell::get_command( string parameters, StreamOutput *stream)
         struct pad_temperature temp;
         string type = shift_parameter( parameters );
         if(type.empty()) {
-            // scan all temperature controls
-            std::vector<struct pad_temperature> controllers;
-            bool ok = PublicData::get_value(temperature_control_checksum, poll_controls_checksum, &controllers);
-            if (ok) {
-                for (auto &c : controllers) {
-                   stream->printf("%s (%d) temp: %f/%f @%d\r\n", c.designator.c_str(), c.id, c.current_temperature, c.target_temperature, c.pwm);
-                }
-
-            } else {
-                stream->printf("no heaters found\r\n");
-            }
+            print_temperatures(stream);
 
         }else{
             bool ok = PublicData::get_value( temperature_control_checksum, current_temperature_checksum, get_checksum(type), &temp );
@@ -814,14 +1164,7 @@ void SimpleShell::get_command( string parameters, StreamOutput *stream)
         }
 
    } else if (what == "pos") {
-        // convenience to call all the various M114 variants, shows ABC axis where relevant
-        std::string buf;
-        THEROBOT->print_position(0, buf); stream->printf("last %s\n", buf.c_str()); buf.clear();
-        THEROBOT->print_position(1, buf); stream->printf("realtime %s\n", buf.c_str()); buf.clear();
-        THEROBOT->print_position(2, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
-        THEROBOT->print_position(3, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
-        THEROBOT->print_position(4, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
-        THEROBOT->print_position(5, buf); stream->printf("%s\n", buf.c_str()); buf.clear();
+        print_positions(stream);
 
     } else if (what == "wcs") {
         // print the wcs state
@@ -944,8 +1287,24 @@ void SimpleShell::switch_command( string parameters, StreamOutput *stream)
     }
 }
 
+struct SimpleShell::MD5Job {
+    string filename;
+    StreamOutput *stream; // the one that asked, only used if it is still in the kernel's streams when it is done
+    FILE *fp;
+    LineReader reader;
+    MD5 md5;
+};
+
+#define md5_slice_us 2000
+
+// the file is hashed in slices from on_idle so the main loop keeps running, the result is printed when it is done
 void SimpleShell::md5sum_command( string parameters, StreamOutput *stream )
 {
+    if(md5_job != nullptr) {
+        stream->printf("md5sum of %s is already running\r\n", md5_job->filename.c_str());
+        return;
+    }
+
     string filename = absolute_from_relative(parameters);
 
     // Open file
@@ -954,16 +1313,56 @@ void SimpleShell::md5sum_command( string parameters, StreamOutput *stream )
         stream->printf("File not found: %s\r\n", filename.c_str());
         return;
     }
-    MD5 md5;
-    uint8_t buf[64];
+
+    md5_job = new MD5Job;
+    md5_job->filename = filename;
+    md5_job->stream = stream;
+    md5_job->fp = lp;
+    md5_job->reader.attach(lp);
+}
+
+// the trace is saved from idle as the halt may have come from anywhere
+void SimpleShell::on_halt(void *argument)
+{
+    if(argument == nullptr) trace_save_pending = true;
+}
+
+void SimpleShell::on_idle(void *)
+{
+    WriteBehind::write_pending();
+
+#ifdef EVENT_TRACE
+    if(trace_save_pending) {
+        trace_save_pending = false;
+        FileStream fs("/sd/trace.log");
+        Trace::print(&fs);
+    }
+#endif
+
+    if(md5_job == nullptr) return;
+
+    uint32_t t = us_ticker_read();
+    uint8_t buf[512];
+    size_t n;
     do {
-        size_t n= fread(buf, 1, sizeof buf, lp);
-        if(n > 0) md5.update(buf, n);
-        THEKERNEL->call_event(ON_IDLE);
-    } while(!feof(lp));
+        n = md5_job->reader.read(buf, sizeof buf);
+        if(n > 0) md5_job->md5.update(buf, n);
+    } while(n == sizeof buf && us_ticker_read() - t < md5_slice_us);
 
-    stream->printf("%s %s\n", md5.finalize().hexdigest().c_str(), filename.c_str());
-    fclose(lp);
+    if(n == sizeof buf) return;
+
+    // the reply goes to the stream that asked for it, if that has gone by now or was never one of the kernel's streams it
+    // goes to all of them with a prefix so it can not be taken for the reply to something else
+    string digest = md5_job->md5.finalize().hexdigest();
+    if(THEKERNEL->streams->has_stream(md5_job->stream)) {
+        md5_job->stream->printf("%s %s\n", digest.c_str(), md5_job->filename.c_str());
+    } else {
+        THEKERNEL->streams->printf("md5sum: %s %s\n", digest.c_str(), md5_job->filename.c_str());
+    }
+    md5_job->reader.detach();
+    fclose(md5_job->fp);
+    delete md5_job;
+    md5_job = nullptr;
 }
 
 // runs several types of test on the mechanisms
@@ -1131,19 +1530,114 @@ void SimpleShell::test_command( string parameters, StreamOutput *stream)
     }
 }
 
+#ifdef STEPTICKER_PROFILE
+static void print_cycle_stats(StreamOutput *stream, const char *name, const StepTicker::cycle_stats_t& stats, bool histogram)
+{
+    // take a copy so the ISR does not change it while we print it
+    __disable_irq();
+    StepTicker::cycle_stats_t s= stats;
+    __enable_irq();
+
+    if(s.count == 0) {
+        stream->printf("%s: no samples\n", name);
+        return;
+    }
+
+    stream->printf("%s: samples: %lu, min: %lu, avg: %lu, max: %lu cycles, overruns: %lu\n",
+        name, s.count, s.min, (uint32_t)(s.total / s.count), s.max, s.overruns);
+
+    if(histogram) {
+        for (size_t i = 0; i < s.histogram.size(); ++i) {
+            if(i < s.histogram.size() - 1) {
+                stream->printf("  %3u-%3u%%: %lu\n", i * 100 / 8, (i + 1) * 100 / 8, s.histogram[i]);
+            } else {
+                stream->printf("     >%3u%%: %lu\n", i * 100 / 8, s.histogram[i]);
+            }
+        }
+    }
+}
+#endif
+
+// print the cycle counts used by the step ticker interrupts, stepstats -r resets them
+void SimpleShell::stepstats_command( string parameters, StreamOutput *stream)
+{
+#ifdef STEPTICKER_PROFILE
+    StepTicker *st= StepTicker::getInstance();
+    if(shift_parameter(parameters) == "-r") {
+        st->reset_profile();
+        stream->printf("step ticker profile reset\n");
+        return;
+    }
+
+    stream->printf("Step tick period: %lu cycles (%1.0f Hz), CPU at %lu MHz\n", st->get_period_cycles(), st->get_frequency(), SystemCoreClock / 1000000);
+    print_cycle_stats(stream, "step_tick", st->get_tick_stats(), true);
+    print_cycle_stats(stream, "start_next_block", st->get_block_stats(), false);
+    print_cycle_stats(stream, "unstep_tick", st->get_unstep_stats(), false);
+
+#else
+    stream->printf("step ticker profiling not enabled, build with STEPTICKER_PROFILE=1\n");
+#endif
+}
+
+// print the cycles used by each module in each event, top -r (or M577) resets them
+void SimpleShell::top_command( string parameters, StreamOutput *stream)
+{
+#ifdef EVENT_PROFILE
+    if(shift_parameter(parameters) == "-r") {
+        THEKERNEL->reset_event_profile();
+        stream->printf("event profile reset\n");
+        return;
+    }
+    THEKERNEL->print_event_profile(stream);
+
+#else
+    stream->printf("event profiling not enabled, build with EVENT_PROFILE=1\n");
+#endif
+}
+
+// print the event trace, trace -c clears it, -m adds a mark, -s saves it to /sd/trace.log
+void SimpleShell::trace_command( string parameters, StreamOutput *stream)
+{
+#ifdef EVENT_TRACE
+    string opt = shift_parameter(parameters);
+    if(opt == "-c") {
+        Trace::clear();
+        stream->printf("trace cleared\n");
+    } else if(opt == "-m") {
+        Trace::add(Trace::MARK);
+    } else if(opt == "-s") {
+        FileStream fs("/sd/trace.log");
+        if(!fs.is_open()) {
+            stream->printf("can not open /sd/trace.log\n");
+            return;
+        }
+        Trace::print(&fs);
+        stream->printf("trace saved to /sd/trace.log\n");
+    } else {
+        Trace::print(stream);
+    }
+
+#else
+    stream->printf("event trace not enabled, build with EVENT_TRACE=1\n");
+#endif
+}
+
 void SimpleShell::help_command( string parameters, StreamOutput *stream )
 {
     stream->printf("Commands:\r\n");
     stream->printf("version\r\n");
     stream->printf("mem [-v]\r\n");
-    stream->printf("ls [-s] [folder]\r\n");
+    stream->printf("ls [-s] [-m] [-o offset] [-n count] [folder]\r\n");
     stream->printf("cd folder\r\n");
     stream->printf("pwd\r\n");
     stream->printf("cat file [limit] [-d 10]\r\n");
     stream->printf("rm file\r\n");
     stream->printf("mv file newfile\r\n");
     stream->printf("remount\r\n");
-    stream->printf("play file [-v]\r\n");
+    stream->printf("play file [-v] [-l line] [-q]\r\n");
+    stream->printf("index file [-k lines] - index file so play -l can start part way through it\r\n");
+    stream->printf("compile file - pre parse file to file.bin which play then uses\r\n");
+    stream->printf("estimate [file] - plan file in idle time to estimate how long it will take, or show the estimate\r\n");
     stream->printf("progress - shows progress of current play\r\n");
     stream->printf("abort - abort currently playing file\r\n");
     stream->printf("reset - reset smoothie\r\n");
@@ -1159,8 +1653,12 @@ void SimpleShell::help_command( string parameters, StreamOutput *stream )
     stream->printf("load [file] - loads a configuration override file from soecified name or config-override\r\n");
     stream->printf("save [file] - saves a configuration override file as specified filename or as config-override\r\n");
     stream->printf("upload filename - saves a stream of text to the named file\r\n");
+    stream->printf("upload -b size filename - saves a binary upload with a crc per frame, see smoothie-upload.py\r\n");
     stream->printf("calc_thermistor [-s0] T1,R1,T2,R2,T3,R3 - calculate the Steinhart Hart coefficients for a thermistor\r\n");
     stream->printf("thermistors - print out the predefined thermistors\r\n");
-    stream->printf("md5sum file - prints md5 sum of the given file\r\n");
+    stream->printf("md5sum file - prints md5 sum of the given file when it has been read, in the background\r\n");
+    stream->printf("stepstats [-r] - prints step ticker interrupt cycle counts (needs STEPTICKER_PROFILE build), -r resets\r\n");
+    stream->printf("top [-r] - prints the time each module uses in each event (needs EVENT_PROFILE build), -r resets\r\n");
+    stream->printf("trace [-c|-m|-s] - prints the block, stall and overrun timeline (needs EVENT_TRACE build), -c clears, -m marks, -s saves to sd\r\n");
 }
 
@@ -24,12 +24,17 @@ public:
     void on_console_line_received( void *argument );
     void on_gcode_received(void *argument);
     void on_second_tick(void *);
+    void on_idle(void *);
+    void on_halt(void *argument);
     static bool parse_command(const char *cmd, string args, StreamOutput *stream);
     static void print_mem(StreamOutput *stream) { mem_command("", stream); }
     static void version_command(string parameters, StreamOutput *stream );
+    static void boottime_command(string parameters, StreamOutput *stream );
+    static int replay_gcodes(const char *filename, StreamOutput *stream, bool verbose);
 
 private:
     static void ls_command(string parameters, StreamOutput *stream );
+    static void ls_page(const string &path, uint32_t offset, uint32_t count, bool sizes, bool machine, StreamOutput *stream);
     static void cd_command(string parameters, StreamOutput *stream );
     static void delete_file_command(string parameters, StreamOutput *stream );
     static void pwd_command(string parameters, StreamOutput *stream );
@@ -38,6 +43,7 @@ private:
     static void mv_command(string parameters, StreamOutput *stream );
     static void mkdir_command(string parameters, StreamOutput *stream );
     static void upload_command(string parameters, StreamOutput *stream );
+    static void binary_upload_command(string parameters, StreamOutput *stream );
     static void break_command(string parameters, StreamOutput *stream );
     static void reset_command(string parameters, StreamOutput *stream );
     static void dfu_command(string parameters, StreamOutput *stream );
@@ -60,6 +66,13 @@ private:
     static void remount_command( string parameters, StreamOutput *stream);
 
     static void test_command( string parameters, StreamOutput *stream);
+    static void stepstats_command( string parameters, StreamOutput *stream);
+    static void top_command( string parameters, StreamOutput *stream);
+    static void trace_command( string parameters, StreamOutput *stream);
+
+    // answer the get temp and get pos that hosts poll with
+    static void print_temperatures(StreamOutput *stream);
+    static void print_positions(StreamOutput *stream);
 
     typedef void (*PFUNC)(string parameters, StreamOutput *stream);
     typedef struct {
@@ -68,5 +81,17 @@ private:
     } const ptentry_t;
 
     static const ptentry_t commands_table[];
+    static const uint8_t command_slots = 64; // size of the checksum index over commands_table, must be more than the commands
+    static const ptentry_t *find_command(const char *cmd, size_t n);
     static int reset_delay_secs;
+    static bool trace_save_pending; // halted, save the trace from the next idle
+
+    // md5sum in progress, hashed a slice at a time from on_idle
+    struct MD5Job;
+    static MD5Job *md5_job;
+
+    // directory left open where the last paged ls stopped, so the next page carries on without reading from the start
+    struct DirCursor;
+    static DirCursor *dir_cursor;
+    static void close_dir_cursor();
 };
@@ -0,0 +1,6 @@
+# a three axis cartesian CNC mill, build with make PROFILE=cartesian-cnc
+ARM_SOLUTION=cartesian
+AXIS=3
+PAXIS=3
+CNC=1
+export EXCLUDE_MODULES = tools/filamentdetector tools/scaracal tools/temperaturecontrol tools/temperatureswitch tools/extruder tools/laser tools/rotarydeltacalibration
@@ -0,0 +1,5 @@
+# a linear delta 3D printer with one extruder, build with make PROFILE=delta-printer
+ARM_SOLUTION=linear_delta
+AXIS=4
+PAXIS=3
+export EXCLUDE_MODULES = tools/drillingcycles tools/spindle tools/laser tools/scaracal tools/rotarydeltacalibration
@@ -0,0 +1,100 @@
+#ifndef GCODELINES_H
+#define GCODELINES_H
+
+// The lines the Gcode parser benchmarks time and the random lines its property tests check, shared by the unit
+// tests on the board and gcodebench in the host build so both measure the same thing
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+struct gcode_line_shape_t {
+    const char *name;
+    const char *line;
+};
+
+// what a job is mostly made of, as it reaches the Gcode once the line number, checksum and comment are gone
+static const gcode_line_shape_t gcode_line_shapes[] = {
+    {"short",   "G1 X10.5 Y20.25"},
+    {"extrude", "G1 X123.456 Y-78.901 E1.23456"},
+    {"feed",    "G1 X123.456 Y-78.901 Z0.2 E1.23456 F3000"},
+    {"arc",     "G2 X10 Y10 I5 J0 F1200"},
+    {"raster",  "G1 X10.125 S0.75"},
+    {"mcode",   "M104 S210"},
+    {"long",    "G1 X123.4567 Y234.5678 Z12.3456 A1.2345 B2.3456 C3.4567 E0.12345 F1234.5"},
+};
+static const int gcode_line_shape_count= sizeof(gcode_line_shapes) / sizeof(gcode_line_shapes[0]);
+
+// the letters the lookup benchmark asks every line for, as Robot does for a move
+static const char gcode_lookup_letters[]= "XYZEF";
+
+// what a random line should parse to
+struct gcode_expect_t {
+    bool is_g;
+    unsigned int code;
+    unsigned int subcode;
+    uint32_t letters;    // a bit for each letter A-Z on the line
+    float values[26];    // the first value of each
+    int args;            // parameters not counting T
+};
+
+// a repeatable generator, the same seed gives the same lines on the board and the host
+static inline uint32_t gcode_random(uint32_t &seed)
+{
+    seed= seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+// a G or M code with up to eight parameters in all the ways hosts write them, signs, no integer part, no fraction,
+// leading zeros, extra spaces or none, and letters given twice where the first one counts
+// with m_code it is always that M code, for lines that no module acts on
+static inline std::string gcode_random_line(uint32_t &seed, gcode_expect_t &e, unsigned int m_code= 0)
+{
+    static const char params[]= "ABCDEFHIJKLOPQRSTUVWXYZ";
+    char buf[32];
+    std::string line;
+
+    e= {};
+    e.is_g= gcode_random(seed) % 4 != 0;
+    e.code= gcode_random(seed) % 1000;
+    e.subcode= gcode_random(seed) % 3 == 0 ? 1 + gcode_random(seed) % 7 : 0;
+    if(m_code != 0) {
+        e.is_g= false;
+        e.code= m_code;
+    }
+    snprintf(buf, sizeof(buf), e.subcode == 0 ? "%c%u" : "%c%u.%u", e.is_g ? 'G' : 'M', e.code, e.subcode);
+    line= buf;
+
+    int n= gcode_random(seed) % 9;
+    bool spaced= gcode_random(seed) % 4 != 0;
+    if(spaced) line += ' ';
+    for (int i = 0; i < n; ++i) {
+        char c= params[gcode_random(seed) % (sizeof(params) - 1)];
+        // a value straight after a number would be read as its exponent
+        if(c == 'E' && !spaced) line += ' ';
+        line += c;
+
+        std::string v;
+        if(gcode_random(seed) % 3 == 0) v += '-';
+        switch(gcode_random(seed) % 4) {
+            case 0: snprintf(buf, sizeof(buf), "%u", gcode_random(seed) % 10000); break;
+            case 1: snprintf(buf, sizeof(buf), "%u.%0*u", gcode_random(seed) % 1000, 1 + (int)(gcode_random(seed) % 5), gcode_random(seed) % 10000); break;
+            case 2: snprintf(buf, sizeof(buf), ".%u", gcode_random(seed) % 1000); break;
+            case 3: snprintf(buf, sizeof(buf), "00%u.", gcode_random(seed) % 100); break;
+        }
+        v += buf;
+        line += v;
+
+        uint32_t bit= 1 << (c - 'A');
+        if(!(e.letters & bit)) e.values[c - 'A']= strtof(v.c_str(), nullptr);
+        e.letters |= bit;
+        if(c != 'T') e.args++;
+
+        spaced= gcode_random(seed) % 4 != 0;
+        if(spaced) line.append(1 + gcode_random(seed) % 2, ' ');
+    }
+    return line;
+}
+
+#endif
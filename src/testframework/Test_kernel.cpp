@@ -33,6 +33,7 @@ This is aprt of the Smoothie test framework, it generates a Mockable Kernl so ke
 #include "FirmConfigSource.h"
 
 #include <malloc.h>
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <map>
@@ -73,16 +74,33 @@ void Kernel::add_module(Module* module){
 }
 
 // Adds a hook for a given module and event
-void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod){
-    this->hooks[id_event].push_back(mod);
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod, uint8_t priority, uint32_t period_us, uint32_t budget_us){
+    this->hooks[id_event].push_back(Hook{mod, nullptr, period_us, budget_us, 0, priority, false});
+}
+
+// the codes are recorded the same way, but call_event does not route so every ON_GCODE_RECEIVED hook sees every gcode
+void Kernel::register_for_gcode(Module *mod, char letter, uint16_t code, uint8_t priority)
+{
+    if(!kernel_has_event(ON_GCODE_RECEIVED, mod)) register_for_event(ON_GCODE_RECEIVED, mod, priority);
+
+    uint16_t key= gcode_key(letter == 'M', code);
+    for (auto& c : gcode_codes) {
+        if(c.module == mod && c.key == key) return;
+    }
+    gcode_codes.push_back(GcodeCode{mod, key});
+}
+
+void Kernel::unregister_for_gcodes(Module *mod)
+{
+    gcode_codes.erase(std::remove_if(gcode_codes.begin(), gcode_codes.end(), [mod](const GcodeCode& c) { return c.module == mod; }), gcode_codes.end());
 }
 
 static std::map<_EVENT_ENUM, std::function<void(void*)> > event_callbacks;
 
 // Call a specific event with an argument
 void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
-    for (auto m : hooks[id_event]) {
-        (m->*kernel_callback_functions[id_event])(argument);
+    for (auto& h : hooks[id_event]) {
+        (h.module->*kernel_callback_functions[id_event])(argument);
     }
     if(event_callbacks.find(id_event) != event_callbacks.end()){
         event_callbacks[id_event](argument);
@@ -94,8 +112,8 @@ void Kernel::call_event(_EVENT_ENUM id_event, void * argument){
 // These are used by tests to test for various things. basically mocks
 bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
 {
-    for (auto m : hooks[id_event]) {
-        if(m == mod) return true;
+    for (auto& h : hooks[id_event]) {
+        if(h.module == mod) return true;
     }
     return false;
 }
@@ -103,7 +121,7 @@ bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
 void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
 {
     for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
-        if(*i == mod) {
+        if(i->module == mod) {
             hooks[id_event].erase(i);
             return;
         }
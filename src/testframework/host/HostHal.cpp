@@ -0,0 +1,77 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// The hardware for the host build. The peripherals and the system control space are ordinary memory mapped at
+// the addresses the firmware expects, so the register writes just land there and MotionSimulator reads back
+// the ones the timers need. The time is the virtual time of the simulation.
+
+#include "MotionSimulator.h"
+
+#include "platform_memory.h"
+#include "us_ticker_api.h"
+#include "wait_api.h"
+#include "SimpleShell.h"
+#include "MRI_Hooks.h"
+
+#include <sys/mman.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+uint32_t SystemCoreClock= 100000000;
+uint32_t host_primask= 0;
+uint32_t host_basepri= 0;
+
+static void map_registers(uintptr_t base, size_t size)
+{
+    void *p= mmap((void *)base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if(p != (void *)base) {
+        fprintf(stderr, "could not map the registers at %08lX\n", (unsigned long)base);
+        exit(1);
+    }
+}
+
+// before any constructors that may touch a register
+__attribute__((constructor(101))) static void map_peripherals()
+{
+    map_registers(LPC_GPIO_BASE, 0x4000);
+    map_registers(LPC_APB0_BASE, 0x100000); // APB1 follows on from APB0
+    map_registers(LPC_AHB_BASE, 0x10000);
+    map_registers(0xE0000000UL, 0x100000); // the core peripherals, NVIC, SCB and DWT
+}
+
+// the block queue and anything else that goes in AHB RAM on the board
+static uint8_t ahb0_ram[0x4000];
+static uint8_t ahb1_ram[0x4000];
+
+__attribute__((constructor(102))) static void init_memory_pools()
+{
+    _AHB0= new MemoryPool(ahb0_ram, sizeof(ahb0_ram));
+    _AHB1= new MemoryPool(ahb1_ram, sizeof(ahb1_ram));
+}
+
+extern "C" uint32_t us_ticker_read()
+{
+    return MotionSimulator::instance == nullptr ? 0 : MotionSimulator::instance->get_time_us();
+}
+
+// a busy wait lets the interrupts run
+extern "C" void wait_us(int us)
+{
+    if(MotionSimulator::instance != nullptr) MotionSimulator::instance->advance(us);
+}
+
+// the rest is what the motion code links against but never reaches in the host build
+
+void set_high_on_debug(int port, int pin)
+{
+}
+
+// GcodeDispatch passes the lines that are not gcode to the shell, there is none
+bool SimpleShell::parse_command(const char *cmd, string args, StreamOutput *stream)
+{
+    return false;
+}
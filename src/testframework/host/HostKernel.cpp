@@ -0,0 +1,223 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+This is part of the host build, it is the Kernel with just the modules that get a gcode line to the step ticker:
+GcodeDispatch, Robot, Planner, Conveyor and the StepTicker. The events are scheduled the same way the firmware does it.
+*/
+
+#include "HostKernel.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/Config.h"
+#include "libs/StreamOutputPool.h"
+#include "libs/StepTicker.h"
+#include "checksumm.h"
+#include "ConfigValue.h"
+#include "FirmConfigSource.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/robot/Planner.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+
+#include "Probe.h"
+
+#include "us_ticker_api.h"
+
+#define base_stepping_frequency_checksum            CHECKSUM("base_stepping_frequency")
+#define microseconds_per_step_pulse_checksum        CHECKSUM("microseconds_per_step_pulse")
+#define microseconds_direction_setup_checksum       CHECKSUM("microseconds_direction_setup")
+#define variable_step_interval_checksum             CHECKSUM("variable_step_interval")
+#define single_timer_step_pulse_checksum            CHECKSUM("single_timer_step_pulse")
+#define secondary_stepping_divider_checksum         CHECKSUM("secondary_stepping_divider")
+#define grbl_mode_checksum                          CHECKSUM("grbl_mode")
+#define feed_hold_enable_checksum                   CHECKSUM("enable_feed_hold")
+#define ok_per_line_checksum                        CHECKSUM("ok_per_line")
+
+Kernel* Kernel::instance;
+std::string host_config;
+
+// as the firmware's Kernel but without the serial, the HAL modules other than the step ticker and the tools.
+// Everything main() does to start them up once the modules are loaded is done here too
+Kernel::Kernel()
+{
+    halted= false;
+    feed_hold= false;
+    enable_feed_hold= false;
+    use_leds= false;
+    new_status_format= true;
+
+    instance= this;
+
+    this->serial= nullptr;
+    this->streams= new StreamOutputPool();
+    this->current_path= "/";
+    this->slow_ticker= nullptr;
+    this->adc= nullptr;
+    this->simpleshell= nullptr;
+    this->configurator= nullptr;
+
+    this->config= new Config(new FirmConfigSource("host", host_config.data(), host_config.data() + host_config.size()));
+    this->config->config_cache_load();
+
+    this->grbl_mode= this->config->value( grbl_mode_checksum )->by_default(false)->as_bool();
+    this->enable_feed_hold= this->config->value( feed_hold_enable_checksum )->by_default(this->grbl_mode)->as_bool();
+    this->ok_per_line= this->config->value( ok_per_line_checksum )->by_default(true)->as_bool();
+
+    // Configure the step ticker
+    this->step_ticker= new StepTicker();
+    this->base_stepping_frequency= this->config->value(base_stepping_frequency_checksum)->by_default(100000)->as_number();
+    this->step_ticker->set_frequency( this->base_stepping_frequency );
+    this->step_ticker->set_unstep_time( this->config->value(microseconds_per_step_pulse_checksum)->by_default(1)->as_number() );
+    this->step_ticker->set_dir_setup_time( this->config->value(microseconds_direction_setup_checksum)->by_default(0)->as_number() );
+    this->step_ticker->set_variable_interval( this->config->value(variable_step_interval_checksum)->by_default(false)->as_bool() );
+    this->step_ticker->set_single_timer( this->config->value(single_timer_step_pulse_checksum)->by_default(false)->as_bool() );
+    this->step_ticker->set_secondary_divider( this->config->value(secondary_stepping_divider_checksum)->by_default(1)->as_int() );
+
+    // Core modules
+    this->add_module( this->conveyor       = new Conveyor()      );
+    this->add_module( this->gcode_dispatch = new GcodeDispatch() );
+    this->add_module( this->robot          = new Robot()         );
+
+    this->planner= new Planner();
+
+    this->conveyor->start(this->robot->get_number_registered_motors());
+    this->step_ticker->start();
+
+    this->config->config_cache_clear();
+}
+
+// this also stops the step ticker in the middle of whatever block it is running, not just the queuing of new ones
+void Kernel::set_feed_hold(bool f)
+{
+    feed_hold= f;
+    step_ticker->set_feed_hold(f);
+}
+
+// there is no status to report, ? is answered by the serial console which is not here
+std::string Kernel::get_query_string()
+{
+    return "<Idle>\n";
+}
+
+const char *Kernel::get_status_snapshot()
+{
+    return "<Idle>\n";
+}
+
+void Kernel::refresh_status_snapshot()
+{
+}
+
+void Kernel::add_module(Module* module)
+{
+    module->on_module_loaded();
+}
+
+// Adds a hook for a given module and event
+void Kernel::register_for_event(_EVENT_ENUM id_event, Module *mod, uint8_t priority, uint32_t period_us, uint32_t budget_us)
+{
+    // keep the hooks sorted by priority, after any already registered with the same priority
+    auto& v= this->hooks[id_event];
+    auto i= v.begin();
+    while(i != v.end() && i->priority <= priority) ++i;
+    HookFunction fn= (HookFunction)(mod->*kernel_callback_functions[id_event]);
+    v.insert(i, Hook{mod, fn, period_us, budget_us, 0, priority, false});
+}
+
+// blocking waits call ON_IDLE from inside a main loop or idle handler, low priority hooks are not called more often
+// than this in there so the motion feeding hooks get the time
+#define nested_low_priority_period_us 20000
+
+bool Kernel::hook_is_due(Hook& h, uint8_t depth)
+{
+    uint32_t period= h.period_us;
+    if(h.priority == PRIORITY_LOW && depth > 1 && period < nested_low_priority_period_us) period= nested_low_priority_period_us;
+    if(period != 0) {
+        uint32_t now= us_ticker_read();
+        if(now - h.last_us < period) return false;
+        h.last_us= now;
+    }
+    if(h.skip_next) {
+        // overran its budget last time
+        h.skip_next= false;
+        return false;
+    }
+    return true;
+}
+
+inline void Kernel::call_hook(Hook& h, _EVENT_ENUM id_event, void *argument)
+{
+    h.fn(h.module, argument);
+}
+
+// Call a specific event with an argument
+void Kernel::call_event(_EVENT_ENUM id_event, void * argument)
+{
+    bool was_idle = true;
+    if(id_event == ON_HALT) {
+        this->halted = (argument == nullptr);
+        was_idle = conveyor->is_idle(); // see if we were doing anything like printing
+    }
+
+    // the benchmarks do not count the time spent idle against the function that is waiting
+    static uint8_t idle_depth= 0;
+    uint64_t idle_start= 0;
+    if(id_event == ON_IDLE && idle_depth++ == 0) idle_start= Probe::now_ns();
+
+    auto& v= hooks[id_event];
+    if(id_event == ON_MAIN_LOOP || id_event == ON_IDLE) {
+        // the main loop and idle are scheduled by priority, period and budget
+        uint8_t depth= ++loop_depth;
+        for (size_t i = 0; i < v.size(); i++) {
+            Hook& h= v[i];
+            if(!hook_is_due(h, depth)) continue;
+            if(h.budget_us == 0) {
+                call_hook(h, id_event, argument);
+            } else {
+                uint32_t start= us_ticker_read();
+                call_hook(h, id_event, argument);
+                if(us_ticker_read() - start > h.budget_us) h.skip_next= true;
+            }
+        }
+        --loop_depth;
+
+    } else {
+        // send to all registered modules
+        for (size_t i = 0; i < v.size(); i++) {
+            call_hook(v[i], id_event, argument);
+        }
+    }
+
+    if(id_event == ON_IDLE && --idle_depth == 0) Probe::idle_ns += Probe::now_ns() - idle_start;
+
+    if(id_event == ON_HALT) {
+        if(!this->halted || !was_idle) {
+            // fix up the current positions in case they got out of sync due to backed up commands
+            this->robot->reset_position_from_current_actuator_position();
+        }
+    }
+}
+
+bool Kernel::kernel_has_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto& h : hooks[id_event]) {
+        if(h.module == mod) return true;
+    }
+    return false;
+}
+
+void Kernel::unregister_for_event(_EVENT_ENUM id_event, Module *mod)
+{
+    for (auto i = hooks[id_event].begin(); i != hooks[id_event].end(); ++i) {
+        if(i->module == mod) {
+            hooks[id_event].erase(i);
+            return;
+        }
+    }
+}
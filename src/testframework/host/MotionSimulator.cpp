@@ -0,0 +1,148 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MotionSimulator.h"
+
+#include "libs/Kernel.h"
+#include "libs/StepTicker.h"
+#include "libs/StepperMotor.h"
+#include "modules/robot/Robot.h"
+#include "Probe.h"
+
+extern "C" void TIMER0_IRQHandler(void);
+extern "C" void TIMER1_IRQHandler(void);
+extern "C" void PendSV_Handler(void);
+extern "C" void RIT_IRQHandler(void);
+
+MotionSimulator *MotionSimulator::instance= nullptr;
+
+void stepticker_step_hook(uint8_t motor, bool dir)
+{
+    MotionSimulator::instance->on_step(motor, dir);
+}
+
+MotionSimulator::MotionSimulator()
+{
+    instance= this;
+    stats= {};
+    clock= 0;
+    counts_per_second= SystemCoreClock / 4;
+    counts_per_us= counts_per_second / 1000000;
+    next_tick= 0;
+    idle_us= 100;
+    block_pending= false;
+}
+
+void MotionSimulator::on_module_loaded()
+{
+    // the step ticker has its period by now
+    next_tick= clock + LPC_TIM0->MR0 + 1;
+    // after the firmware modules, but not PRIORITY_LOW which is rate limited by the clock in a blocking wait and
+    // only this moves the clock on
+    register_for_event(ON_IDLE, PRIORITY_NORMAL);
+}
+
+// the main loop was idle for a while, the firmware only waits in ON_IDLE so that is when the interrupts get to run
+void MotionSimulator::on_idle(void *)
+{
+    advance(idle_us);
+}
+
+void MotionSimulator::advance(uint32_t us)
+{
+    uint64_t end= clock + (uint64_t)us * counts_per_us;
+    while(next_tick <= end) {
+        clock= next_tick;
+        step_interrupt();
+    }
+    clock= end;
+}
+
+void MotionSimulator::on_step(uint8_t motor, bool dir)
+{
+    if(stats.steps++ == 0) stats.first_step_us= get_time_us();
+    if(block_pending) start_block();
+    if(step_fnc) step_fnc(motor, dir, clock);
+}
+
+uint8_t MotionSimulator::moving_motors() const
+{
+    uint8_t n= 0;
+    for (auto a : THEROBOT->actuators) {
+        if(a->is_moving()) ++n;
+    }
+    return n;
+}
+
+void MotionSimulator::start_block()
+{
+    block_pending= false;
+    block_fnc(StepTicker::getInstance()->get_current_block(), clock);
+}
+
+void MotionSimulator::step_interrupt()
+{
+    StepTicker *st= StepTicker::getInstance();
+    bool busy= st->is_running();
+    uint8_t moving= moving_motors();
+
+    // a block gets its first tick here if the last one finished on the last tick, or if nothing was running and one
+    // is started in this one, that one is only known once it steps or the handler is done
+    block_pending= block_fnc && (!busy || st->get_current_tick() == 0);
+    if(block_pending && busy) start_block();
+
+    uint64_t start= Probe::now_ns();
+
+    LPC_TIM0->IR= 1; // the registers are just memory here, the handler looks at which match it is for
+    TIMER0_IRQHandler();
+    LPC_TIM0->IR= 0;
+    uint64_t ns= Probe::now_ns() - start;
+
+    // the secondary tick is pended by the step tick, it is lower priority so it runs once that returns
+    if(NVIC->ISPR[0] & (1UL << RIT_IRQn)) {
+        NVIC->ISPR[0] &= ~(1UL << RIT_IRQn);
+        uint64_t s= Probe::now_ns();
+        RIT_IRQHandler();
+        s= Probe::now_ns() - s;
+        stats.secondary_ns += s > Probe::overhead_ns() ? s - Probe::overhead_ns() : 0;
+        ++stats.secondary_ticks;
+    }
+
+    start= Probe::now_ns();
+    // it starts the unstep timer when it steps, the step pulse is always over before the next tick
+    if(LPC_TIM1->TCR == 1) {
+        LPC_TIM1->TCR= 0;
+        TIMER1_IRQHandler();
+    }
+    // or in single timer mode it sets MR1 of the step timer to when the pulse ends, if that is within this tick
+    if(LPC_TIM0->MR1 <= LPC_TIM0->MR0) {
+        LPC_TIM0->IR= 2;
+        TIMER0_IRQHandler();
+        LPC_TIM0->IR= 0;
+    }
+    if(SCB->ICSR & SCB_ICSR_PENDSVSET_Msk) {
+        SCB->ICSR &= ~SCB_ICSR_PENDSVSET_Msk;
+        PendSV_Handler();
+    }
+
+    ns += Probe::now_ns() - start;
+    if(block_pending && st->is_running()) start_block();
+    block_pending= false;
+    ns= ns > Probe::overhead_ns() ? ns - Probe::overhead_ns() : 0;
+    stats.isr_ns += ns;
+    ++stats.ticks;
+    if(busy || st->is_running()) {
+        ++stats.busy_ticks;
+        // a block that started on this tick had nothing moving before it
+        if(moving == 0) moving= moving_motors();
+        stats.motor_ticks[moving]++;
+        stats.motor_ns[moving] += ns;
+    }
+
+    // the timer resets on the match, the handler may have changed MR0 for the period it is now in
+    next_tick= clock + LPC_TIM0->MR0 + 1;
+}
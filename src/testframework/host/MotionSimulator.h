@@ -0,0 +1,76 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MOTIONSIMULATOR_H
+#define MOTIONSIMULATOR_H
+
+#include "Module.h"
+#include "ActuatorCoordinates.h"
+
+#include <stdint.h>
+#include <functional>
+
+class Block;
+
+// Runs the step ticker interrupts in virtual time for the host build.
+// Time only passes when the firmware is idle, each ON_IDLE lets idle_us of it go by and any timer matches that
+// fall in it are taken. The timers count at SystemCoreClock/4 as on the board, and the step ticker's timer is
+// reloaded from whatever it left in MR0 so the variable interval skipping is followed exactly.
+class MotionSimulator : public Module {
+    public:
+        MotionSimulator();
+        static MotionSimulator *instance;
+
+        void on_module_loaded();
+        void on_idle(void *argument);
+
+        // the virtual time in timer counts
+        uint64_t get_clock() const { return clock; }
+        uint32_t get_time_us() const { return clock / counts_per_us; }
+        double get_seconds() const { return (double)clock / counts_per_second; }
+        uint32_t get_counts_per_second() const { return counts_per_second; }
+
+        // runs the interrupts due in the next us of virtual time
+        void advance(uint32_t us);
+        void set_idle_time(uint32_t us) { idle_us= us; }
+
+        // called from the step ticker interrupt for every step, motor is the actuator index and dir is true when it
+        // steps backwards, clock is the time of the tick that stepped it
+        std::function<void(uint8_t motor, bool dir, uint64_t clock)> step_fnc;
+        void on_step(uint8_t motor, bool dir);
+        // called when a block gets its first tick, before any of its steps, clock is the time of that tick
+        std::function<void(const Block *block, uint64_t clock)> block_fnc;
+
+        struct stats_t {
+            uint64_t ticks;        // step ticker interrupts taken
+            uint64_t busy_ticks;   // the ones that had a block to run
+            uint64_t steps;
+            uint64_t first_step_us; // virtual time of the first step, how long the first move took to start
+            uint64_t isr_ns;       // host time in the step ticker interrupt handlers
+            uint64_t secondary_ticks; // secondary step ticks taken, and the host time in them which is not in isr_ns
+            uint64_t secondary_ns;
+            // the busy ticks and the host time they took by how many motors were moving
+            uint64_t motor_ticks[k_max_actuators + 1];
+            uint64_t motor_ns[k_max_actuators + 1];
+        };
+        const stats_t& get_stats() const { return stats; }
+
+    private:
+        void step_interrupt();
+        uint8_t moving_motors() const;
+        void start_block();
+
+        stats_t stats;
+        uint64_t clock;
+        uint64_t next_tick;
+        uint32_t counts_per_second;
+        uint32_t counts_per_us;
+        uint32_t idle_us;
+        bool block_pending;
+};
+
+#endif
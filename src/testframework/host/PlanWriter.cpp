@@ -0,0 +1,104 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PlanWriter.h"
+#include "MotionSimulator.h"
+
+#include "libs/USBDevice/USBSerial/USBSerial.h"
+#include "modules/robot/Block.h"
+
+#include <string.h>
+
+// the same as USBSerial.cpp
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i] << 8;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+PlanWriter::PlanWriter(MotionSimulator *sim, FILE *fp, float tick_frequency) : fp(fp)
+{
+    blocks= 0;
+    refused= 0;
+    seq= 0;
+
+    // called along with whatever else wants to see the blocks start
+    auto next= sim->block_fnc;
+    sim->block_fnc= [this, next](const Block *block, uint64_t clock) {
+        on_block(block);
+        if(next) next(block, clock);
+    };
+
+    write_frame(3, 1, (const uint8_t *)&tick_frequency, sizeof(tick_frequency));
+}
+
+void PlanWriter::finish()
+{
+    write_frame(4, 0, nullptr, 0);
+    fflush(fp);
+}
+
+void PlanWriter::on_block(const Block *block)
+{
+    if(block->is_scurve || block->backlash_motors != 0) {
+        ++refused;
+        return;
+    }
+
+    uint8_t payload[USBSERIAL_PLANNED_SIZE + 8 * 4];
+    float final_rate= block->nominal_speed > 0.0F ? block->nominal_rate * (block->exit_speed / block->nominal_speed) : 0.0F;
+    float s_value= block->s_value / (float)(1 << 11);
+    uint8_t flags= block->is_g123 ? 1 : 0;
+    // a ramp time a hair under zero floors to -1 ticks, which wraps to UINT32_MAX here but saturates to 0 on the board
+    uint32_t accelerate_until= block->accelerate_until > block->total_move_ticks ? 0 : block->accelerate_until;
+    uint32_t decelerate_after= block->decelerate_after > block->total_move_ticks ? block->total_move_ticks : block->decelerate_after;
+    memcpy(&payload[0], &accelerate_until, 4);
+    memcpy(&payload[4], &decelerate_after, 4);
+    memcpy(&payload[8], &block->total_move_ticks, 4);
+    memcpy(&payload[12], &block->initial_rate, 4);
+    memcpy(&payload[16], &block->maximum_rate, 4);
+    memcpy(&payload[20], &final_rate, 4);
+    memcpy(&payload[24], &block->millimeters, 4);
+    memcpy(&payload[28], &block->nominal_speed, 4);
+    memcpy(&payload[32], &block->acceleration, 4);
+    memcpy(&payload[36], &s_value, 4);
+    payload[40]= flags;
+
+    size_t len= USBSERIAL_PLANNED_SIZE;
+    uint8_t mask= 0;
+    for (uint8_t m = 0; m < Block::n_actuators && m < 8; m++) {
+        if(block->steps[m] == 0) continue;
+        int32_t steps= block->direction_bits[m] ? -(int32_t)block->steps[m] : block->steps[m];
+        memcpy(&payload[len], &steps, 4);
+        len += 4;
+        mask |= 1 << m;
+    }
+
+    write_frame(2, mask, payload, len);
+    ++blocks;
+}
+
+void PlanWriter::write_frame(uint8_t opcode, uint8_t mask, const uint8_t *payload, size_t len)
+{
+    uint8_t frame[3 + USBSERIAL_PLANNED_SIZE + 8 * 4 + 2];
+    frame[0]= seq++;
+    frame[1]= opcode;
+    frame[2]= mask;
+    if(len > 0) memcpy(&frame[3], payload, len);
+    uint16_t crc= crc16(frame, 3 + len);
+    frame[3 + len]= crc & 0xFF;
+    frame[4 + len]= crc >> 8;
+
+    fputc(USBSERIAL_BINARY_SYNC, fp);
+    fwrite(frame, 1, 5 + len, fp);
+}
@@ -0,0 +1,41 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PLANWRITER_H
+#define PLANWRITER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+class Block;
+class MotionSimulator;
+
+// Writes every block as the step ticker starts it as a host planning frame, see USBSerial.h, so the board can run the
+// plan made here without planning anything itself. A block is only final once the step ticker has it, which is why
+// they are taken then rather than as they are queued. Frames are numbered from 0, fast-stream.py -p renumbers them.
+// The board needs the same step frequency and steps per mm, s-curve and backlash blocks are not written as the board
+// could not run them the same, they are counted in get_refused() instead.
+class PlanWriter {
+    public:
+        PlanWriter(MotionSimulator *sim, FILE *fp, float tick_frequency);
+
+        // writes the end frame, call when the motion has finished
+        void finish();
+        uint32_t get_blocks() const { return blocks; }
+        uint32_t get_refused() const { return refused; }
+
+    private:
+        void on_block(const Block *block);
+        void write_frame(uint8_t opcode, uint8_t mask, const uint8_t *payload, size_t len);
+
+        FILE *fp;
+        uint32_t blocks;
+        uint32_t refused;
+        uint8_t seq;
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Probe.h"
+
+#include "ActuatorCoordinates.h"
+
+#include <time.h>
+
+class Planner;
+class Block;
+
+Probe Probe::append_block("append_block");
+Probe Probe::calculate_trapezoid("calculate_trapezoid");
+Probe Probe::update_trapezoid("update_trapezoid");
+uint64_t Probe::idle_ns= 0;
+
+uint64_t Probe::now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+uint32_t Probe::overhead_ns()
+{
+    static uint32_t overhead= 0xFFFFFFFFUL;
+    if(overhead == 0xFFFFFFFFUL) {
+        // the quickest of many back to back reads
+        uint64_t best= ~0ULL;
+        for (int i = 0; i < 1000; ++i) {
+            uint64_t a= now_ns();
+            uint64_t b= now_ns();
+            if(b - a < best) best= b - a;
+        }
+        overhead= best;
+    }
+    return overhead;
+}
+
+// The wrapped functions, the linker sends the calls from the other firmware files here and __real_ is the function
+// itself. These are member functions so the names are the mangled ones, with this as the first argument, and they
+// have to match the ones in the makefile. They are for an LP64 host with the default MAX_ROBOT_ACTUATORS of 5
+static_assert(sizeof(size_t) == 8 && k_max_actuators == 5, "the mangled names of the probes need changing");
+
+extern "C" {
+
+bool __real__ZN7Planner12append_blockERSt5arrayIfLm5EEhffPfffbtj(Planner *, ActuatorCoordinates &, uint8_t, float, float, float *, float, float, bool, uint16_t, uint32_t);
+bool __wrap__ZN7Planner12append_blockERSt5arrayIfLm5EEhffPfffbtj(Planner *planner, ActuatorCoordinates &actuator_pos, uint8_t n_motors, float rate_mm_s, float distance, float *unit_vec, float acceleration, float s_value, bool g123, uint16_t raster_count, uint32_t raster_start)
+{
+    ProbeScope p(Probe::append_block);
+    return __real__ZN7Planner12append_blockERSt5arrayIfLm5EEhffPfffbtj(planner, actuator_pos, n_motors, rate_mm_s, distance, unit_vec, acceleration, s_value, g123, raster_count, raster_start);
+}
+
+void __real__ZN5Block19calculate_trapezoidEff(Block *, float, float);
+void __wrap__ZN5Block19calculate_trapezoidEff(Block *block, float entryspeed, float exitspeed)
+{
+    ProbeScope p(Probe::calculate_trapezoid);
+    __real__ZN5Block19calculate_trapezoidEff(block, entryspeed, exitspeed);
+}
+
+void __real__ZN5Block16update_trapezoidEv(Block *);
+void __wrap__ZN5Block16update_trapezoidEv(Block *block)
+{
+    ProbeScope p(Probe::update_trapezoid);
+    __real__ZN5Block16update_trapezoidEv(block);
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <stdint.h>
+
+// Host time spent in one of the firmware functions the benchmarks measure. The linker wraps the calls to them,
+// see PROBES in the makefile and Probe.cpp. Time spent in ON_IDLE while inside the function is not counted,
+// that is where the firmware waits for room in the queue and where the step ticker interrupts run.
+class Probe {
+    public:
+        Probe(const char *name) : name(name), calls(0), total_ns(0) {}
+
+        const char *name;
+        uint64_t calls;
+        uint64_t total_ns;
+
+        static uint64_t now_ns();
+        // the time now_ns() itself takes, taken off each measurement
+        static uint32_t overhead_ns();
+
+        // host time spent in the outermost ON_IDLE calls so far
+        static uint64_t idle_ns;
+
+        static Probe append_block;        // Planner::append_block, including recalculate and the trapezoids it does
+        static Probe calculate_trapezoid; // Block::calculate_trapezoid from the planner, which prepares the block
+        static Probe update_trapezoid;    // Block::update_trapezoid from the conveyor, the lazy prepare
+};
+
+// times the scope it is in with p, without the idle time
+class ProbeScope {
+    public:
+        ProbeScope(Probe &p) : probe(p), idle(Probe::idle_ns), start(Probe::now_ns()) {}
+        ~ProbeScope()
+        {
+            uint64_t ns= Probe::now_ns() - start - (Probe::idle_ns - idle);
+            uint32_t o= Probe::overhead_ns();
+            probe.total_ns += ns > o ? ns - o : 0;
+            probe.calls++;
+        }
+
+    private:
+        Probe &probe;
+        uint64_t idle;
+        uint64_t start;
+};
+
+#endif
@@ -0,0 +1,179 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StepVerifier.h"
+#include "MotionSimulator.h"
+
+#include "libs/Kernel.h"
+#include "libs/StepperMotor.h"
+#include "modules/robot/Block.h"
+#include "modules/robot/Robot.h"
+
+#include <math.h>
+#include <algorithm>
+
+StepVerifier::StepVerifier(MotionSimulator *sim, float tick_frequency) : sim(sim)
+{
+    seconds_per_tick= 1.0 / tick_frequency;
+    blocks= 0;
+    skipped_blocks= 0;
+    blocks_done= false;
+    block= {};
+    results= {};
+    for (auto &s : state) {
+        s= {};
+        s.end_speed= 0;
+        s.planned_end= 0;
+    }
+
+    using namespace std::placeholders;
+    sim->block_fnc= std::bind(&StepVerifier::on_block, this, _1, _2);
+    sim->step_fnc= std::bind(&StepVerifier::on_step, this, _1, _2, _3);
+}
+
+void StepVerifier::finish()
+{
+    end_block();
+    blocks_done= true;
+}
+
+double StepVerifier::steps_per_mm(uint8_t m) const
+{
+    return THEROBOT->actuators[m]->get_steps_per_mm();
+}
+
+void StepVerifier::on_block(const Block *b, uint64_t clock)
+{
+    end_block();
+    ++blocks;
+    blocks_done= false;
+
+    block.valid= !b->is_scurve;
+    if(!block.valid) ++skipped_blocks;
+    block.skip_motor= b->advance_motor;
+    block.start= (double)clock / sim->get_counts_per_second() - seconds_per_tick;
+    for (size_t m = 0; m < k_max_actuators; ++m) {
+        block.steps[m]= b->steps[m];
+        block.backwards[m]= b->direction_bits[m];
+    }
+
+    // the same trapezoid compute_trapezoid() works out, before it is rounded to ticks
+    double n= b->steps_event_count;
+    double r0= b->initial_rate;
+    double r1= (double)b->nominal_rate * b->exit_speed / b->nominal_speed;
+    double a= (double)b->acceleration * n / b->millimeters;
+    double rmax= std::min((double)b->nominal_rate, sqrt(n * a + (r0 * r0 + r1 * r1) / 2.0));
+    rmax= std::max(rmax, std::max(r0, r1));
+    block.total= n;
+    block.initial_rate= r0;
+    block.maximum_rate= rmax;
+    block.final_rate= r1;
+    block.acceleration= a;
+    block.accel_distance= (rmax * rmax - r0 * r0) / (2.0 * a);
+    double decel_distance= (rmax * rmax - r1 * r1) / (2.0 * a);
+    block.plateau_distance= std::max(0.0, n - block.accel_distance - decel_distance);
+    block.accel_time= (rmax - r0) / a;
+    block.plateau_time= block.plateau_distance / rmax;
+    block.decel_time= (rmax - r1) / a;
+
+    size_t n_motors= THEROBOT->actuators.size();
+    for (size_t m = 0; m < n_motors; ++m) {
+        motor_state_t &s= state[m];
+        s.count= 0;
+
+        // the speed each motor is planned to start at, against what it was planned to end the last block at
+        double sign= block.backwards[m] ? -1.0 : 1.0;
+        double planned= block.valid ? sign * r0 * block.steps[m] / n / steps_per_mm(m) : NAN;
+        if(!isnan(planned) && !isnan(s.planned_end)) {
+            results[m].planned_junction= std::max(results[m].planned_junction, fabs(planned - s.planned_end));
+        }
+        // a motor that does not move in this block starts it stopped
+        if(block.steps[m] == 0 && !isnan(s.end_speed)) {
+            results[m].measured_junction= std::max(results[m].measured_junction, fabs(s.end_speed));
+        }
+    }
+}
+
+void StepVerifier::end_block()
+{
+    if(blocks == 0 || blocks_done) return;
+
+    size_t n_motors= THEROBOT->actuators.size();
+    for (size_t m = 0; m < n_motors; ++m) {
+        motor_state_t &s= state[m];
+        // the advanced motor is expected to be off by the change in advance
+        if(s.count != block.steps[m] && m != block.skip_motor) ++results[m].count_errors;
+
+        double sign= block.backwards[m] ? -1.0 : 1.0;
+        if(block.steps[m] == 0) s.end_speed= 0;
+        else if(s.count >= 2) s.end_speed= sign / (s.last_time - s.prev_time) / steps_per_mm(m);
+        else s.end_speed= NAN;
+        s.planned_end= block.valid ? sign * block.final_rate * block.steps[m] / block.total / steps_per_mm(m) : NAN;
+    }
+}
+
+void StepVerifier::on_step(uint8_t m, bool dir, uint64_t clock)
+{
+    double t= (double)clock / sim->get_counts_per_second();
+    motor_state_t &s= state[m];
+    motor_result_t &r= results[m];
+
+    ++s.count;
+    s.prev_time= s.last_time;
+    s.last_time= t;
+    if(s.count == 1) s.first_time= t;
+    if(block.steps[m] > 0 && dir != block.backwards[m]) ++r.direction_errors;
+
+    // the speed it starts this block at from its first interval
+    if(s.count == 2 && !isnan(s.end_speed)) {
+        double speed= (block.backwards[m] ? -1.0 : 1.0) / (s.last_time - s.prev_time) / steps_per_mm(m);
+        r.measured_junction= std::max(r.measured_junction, fabs(speed - s.end_speed));
+    }
+
+    if(!block.valid || m == block.skip_motor || block.steps[m] == 0 || s.count > block.steps[m]) return;
+    ++r.steps;
+
+    // where it should be now, it should have just passed count
+    double tb= t - block.start;
+    double ratio= block.steps[m] / block.total;
+    double error= s.count - position_at(tb) * ratio;
+    r.position_error= std::max(r.position_error, fabs(error));
+
+    // and when it should have got there
+    double timing= (tb - time_at(s.count / ratio)) * 1e6;
+    r.timing_error_us= std::max(r.timing_error_us, fabs(timing));
+    if(s.count >= 2) {
+        double jitter= timing - s.last_error;
+        r.jitter_us= std::max(r.jitter_us, fabs(jitter));
+        r.jitter_sum_sq += jitter * jitter;
+        ++r.intervals;
+    }
+    s.last_error= timing;
+}
+
+// steps of the primary motor t seconds into the block
+double StepVerifier::position_at(double t) const
+{
+    if(t <= 0) return 0;
+    if(t < block.accel_time) return block.initial_rate * t + block.acceleration * t * t / 2.0;
+    t -= block.accel_time;
+    if(t < block.plateau_time) return block.accel_distance + block.maximum_rate * t;
+    t= std::min(t - block.plateau_time, block.decel_time);
+    double p= block.accel_distance + block.plateau_distance + block.maximum_rate * t - block.acceleration * t * t / 2.0;
+    return std::min(p, block.total);
+}
+
+// seconds into the block the primary motor is p steps along
+double StepVerifier::time_at(double p) const
+{
+    double r0= block.initial_rate, rmax= block.maximum_rate, a= block.acceleration;
+    if(p <= block.accel_distance) return (sqrt(r0 * r0 + 2.0 * a * p) - r0) / a;
+    p -= block.accel_distance;
+    if(p <= block.plateau_distance) return block.accel_time + p / rmax;
+    p -= block.plateau_distance;
+    return block.accel_time + block.plateau_time + (rmax - sqrt(std::max(0.0, rmax * rmax - 2.0 * a * p))) / a;
+}
@@ -0,0 +1,86 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STEPVERIFIER_H
+#define STEPVERIFIER_H
+
+#include "ActuatorCoordinates.h"
+
+#include <stdint.h>
+#include <array>
+
+class Block;
+class MotionSimulator;
+
+// Checks the steps the step ticker issues against the trapezoid the planner asked for.
+// When a block gets its first tick the entry, peak and exit rates and the acceleration are taken from it and the
+// trapezoid is worked out again in double precision, in real time from that tick. Every step of every motor is then
+// compared with where that motor should be at that moment, and with when the step should have happened. None of
+// the step ticker's own state is used so a different step generator is held to the same plan.
+// S-curve blocks and the motor pressure advance is applied to are not checked, they are not meant to follow the trapezoid.
+class StepVerifier {
+    public:
+        StepVerifier(MotionSimulator *sim, float tick_frequency);
+
+        // checks the last block, call when the motion has finished
+        void finish();
+
+        struct motor_result_t {
+            uint64_t steps;             // steps checked
+            double position_error;      // furthest the motor got from its planned position at a step, in steps
+            double timing_error_us;     // latest or earliest a step was against its planned time
+            double jitter_us;           // biggest difference of a step interval from the planned interval
+            double jitter_sum_sq;       // for the rms of the interval differences
+            uint64_t intervals;
+            double planned_junction;    // biggest change of speed between two blocks in the plan, mm/sec
+            double measured_junction;   // and in the step intervals either side of the junction
+            uint32_t count_errors;      // blocks that ended with a different step count than planned
+            uint32_t direction_errors;  // steps made in the wrong direction for the block
+        };
+        const motor_result_t& get_result(uint8_t m) const { return results[m]; }
+        uint32_t get_blocks() const { return blocks; }
+        uint32_t get_skipped_blocks() const { return skipped_blocks; }
+
+    private:
+        void on_block(const Block *block, uint64_t clock);
+        void on_step(uint8_t m, bool dir, uint64_t clock);
+        void end_block();
+        double position_at(double t) const;
+        double time_at(double p) const;
+        double steps_per_mm(uint8_t m) const;
+
+        // the block being run, rates in steps of the primary motor per second
+        struct {
+            bool valid;
+            double start;        // seconds, one tick before the first as the step ticker adds the rate before it steps
+            double total;        // steps of the primary motor
+            double initial_rate, maximum_rate, final_rate, acceleration;
+            double accel_distance, plateau_distance, accel_time, plateau_time, decel_time;
+            std::array<uint32_t, k_max_actuators> steps;
+            std::array<bool, k_max_actuators> backwards;
+            uint8_t skip_motor;
+        } block;
+
+        // each motor in the block being run
+        struct motor_state_t {
+            uint32_t count;
+            double first_time, last_time, prev_time; // seconds of its first, last and the one before last steps
+            double last_error;   // timing error of the last step
+            double end_speed;    // measured mm/sec at the end of the last block, NAN if it could not be measured
+            double planned_end;  // planned mm/sec at the end of the last block
+        };
+        std::array<motor_state_t, k_max_actuators> state;
+        std::array<motor_result_t, k_max_actuators> results;
+
+        MotionSimulator *sim;
+        double seconds_per_tick;
+        uint32_t blocks;
+        uint32_t skipped_blocks;
+        bool blocks_done;  // the last block has been checked
+};
+
+#endif
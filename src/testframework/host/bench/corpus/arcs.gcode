@@ -0,0 +1,406 @@
+; arcs
+; generated by make_corpus.py
+G21
+G90
+G0 X0 Y0
+G1 F4800
+G2 X0.067 Y0.250 I0.500 J0.000
+G3 X9.807 Y-1.732 I5.990 J4.514
+G2 X6.996 Y25.009 I3.997 J13.938
+G1 X1.399 Y5.002
+G2 X-1.325 Y10.348 I-2.968 J1.855
+G3 X-6.535 Y0.340 I-10.460 J-0.915
+G2 X-2.136 Y-13.199 I-13.005 J-11.710
+G1 X-0.427 Y-2.640
+G2 X7.544 Y-12.484 I2.849 J-5.842
+G1 X1.509 Y-2.497
+G1 X0.302 Y-0.499
+G3 X-0.493 Y1.329 I1.705 J1.828
+G2 X-8.535 Y7.841 I0.993 J9.448
+G1 X-1.707 Y1.568
+G1 X-0.341 Y0.314
+G3 X-8.404 Y-5.873 I-5.313 J-1.424
+G2 X-24.783 Y-6.731 I-7.696 J-9.850
+G1 X-4.957 Y-1.346
+G2 X-2.960 Y-1.556 I0.882 J-1.214
+G3 X9.418 Y-11.402 I8.129 J-2.485
+G1 X1.884 Y-2.280
+G1 X0.377 Y-0.456
+G2 X4.235 Y2.347 I-0.314 J4.489
+G3 X8.190 Y11.026 I-7.545 J8.679
+G2 X-17.430 Y-2.028 I-18.096 J3.846
+G3 X-18.383 Y-2.239 I-0.453 J-0.211
+G1 X-3.677 Y-0.448
+G3 X13.092 Y-14.769 I2.268 J-14.321
+G1 X2.618 Y-2.954
+G3 X4.342 Y-6.411 I3.474 J-0.427
+G2 X13.436 Y9.339 I9.093 J5.250
+G1 X2.687 Y1.868
+G1 X0.537 Y0.374
+G3 X-7.764 Y-1.165 I-5.051 J4.091
+G2 X-10.064 Y-8.243 I-13.492 J0.471
+G1 X-2.013 Y-1.649
+G2 X-1.768 Y-6.310 I-0.773 J-2.378
+G3 X6.074 Y-23.520 I3.093 J-8.982
+G1 X1.215 Y-4.704
+G3 X12.933 Y16.878 I23.468 J1.230
+G2 X11.729 Y21.368 I4.213 J3.535
+G1 X2.346 Y4.274
+G1 X0.469 Y0.855
+G3 X-2.343 Y1.582 I-1.312 J0.727
+G2 X-13.103 Y8.570 I-8.417 J-1.183
+G3 X-8.563 Y-2.390 I-10.960 J-10.960
+G2 X10.137 Y-19.228 I-3.131 J-22.281
+G1 X2.027 Y-3.846
+G2 X23.470 Y-12.077 I10.506 J-4.677
+G1 X4.694 Y-2.415
+G2 X5.337 Y-2.415 I0.321 J0.383
+G3 X9.479 Y-1.421 I0.393 J7.490
+G2 X-10.055 Y1.673 I-8.108 J12.021
+G1 X-2.011 Y0.335
+G2 X-8.821 Y-1.113 I-3.329 J-1.082
+G3 X-9.593 Y-18.807 I-6.023 J-8.601
+G1 X-1.919 Y-3.761
+G3 X-11.000 Y-22.802 I15.418 J-19.040
+G2 X-1.642 Y-18.635 I6.307 J-1.572
+G3 X24.285 Y-13.360 I12.427 J5.275
+G1 X4.857 Y-2.672
+G3 X2.052 Y-0.191 I-0.305 J2.481
+G2 X4.947 Y6.312 I-6.599 J6.834
+G3 X-3.100 Y23.182 I-16.297 J2.581
+G2 X-25.488 Y-11.293 I-20.749 J-11.033
+G1 X-5.098 Y-2.259
+G2 X-9.846 Y-24.598 I2.599 J-12.227
+G3 X14.621 Y-20.504 I14.717 J-12.793
+G2 X14.935 Y-19.685 I1.496 J-0.105
+G1 X2.987 Y-3.937
+G2 X2.987 Y25.193 I5.301 J14.565
+G1 X0.597 Y5.039
+G2 X-2.108 Y12.085 I-3.641 J2.645
+G3 X-7.856 Y1.925 I-11.498 J-0.201
+G2 X-4.484 Y-13.940 I-14.578 J-11.390
+G3 X-5.113 Y-14.423 I-0.129 J-0.483
+G2 X2.907 Y-26.772 I2.810 J-6.954
+G1 X0.581 Y-5.354
+G1 X0.116 Y-1.071
+G3 X-0.824 Y1.316 I2.560 J2.387
+G2 X-9.341 Y9.833 I1.823 J10.340
+G1 X-1.868 Y1.967
+G1 X-0.374 Y0.393
+G3 X-10.004 Y-6.476 I-6.381 J-1.240
+G2 X-26.973 Y-5.587 I-9.033 J-10.032
+G1 X-5.395 Y-1.117
+G2 X-1.997 Y-1.840 I1.325 J-2.120
+G3 X11.622 Y-13.471 I8.869 J-3.404
+G1 X2.324 Y-2.694
+G1 X0.465 Y-0.539
+G2 X5.228 Y2.211 I0.000 J5.500
+G3 X10.205 Y12.194 I-7.523 J9.983
+G2 X-18.873 Y1.032 I-18.745 J5.375
+G3 X-21.773 Y0.495 I-1.400 J-0.538
+G1 X-4.355 Y0.099
+G3 X12.496 Y-15.342 I1.351 J-15.441
+G1 X2.499 Y-3.068
+G3 X4.667 Y-7.824 I4.417 J-0.859
+G2 X16.603 Y8.605 I10.336 J5.041
+G1 X3.321 Y1.721
+G2 X3.555 Y2.596 I-0.087 J0.492
+G3 X-5.680 Y1.216 I-5.485 J5.115
+G2 X-9.325 Y-6.970 I-14.421 J1.516
+G1 X-1.865 Y-1.394
+G2 X-2.211 Y-8.004 I-1.311 J-3.245
+G3 X5.756 Y-27.239 I2.718 J-10.142
+G1 X1.151 Y-5.448
+G3 X13.398 Y15.342 I24.496 J-0.428
+G2 X12.474 Y21.171 I5.259 J3.821
+G1 X2.495 Y4.234
+G1 X0.499 Y0.847
+G3 X-4.098 Y2.208 I-2.097 J1.362
+G2 X-14.897 Y10.953 I-9.477 J-0.663
+G3 X-10.849 Y0.128 I-12.453 J-10.825
+G2 X7.636 Y-20.402 I-4.886 J-22.986
+G1 X1.527 Y-4.080
+G1 X0.305 Y-0.816
+G1 X0.061 Y-0.163
+G2 X1.898 Y-0.356 I1.042 J1.079
+G3 X7.184 Y0.719 I1.036 J8.437
+G2 X-13.990 Y6.393 I-7.750 J13.423
+G1 X-2.798 Y1.279
+G2 X-11.661 Y0.347 I-4.366 J-1.089
+G3 X-13.149 Y-18.550 I-7.237 J-8.937
+G1 X-2.630 Y-3.710
+G3 X-2.843 Y-4.119 I0.287 J-0.410
+G2 X8.698 Y-0.369 I7.133 J-2.318
+G1 X1.740 Y-0.074
+G1 X0.348 Y-0.015
+G3 X-3.335 Y3.480 I-0.183 J3.495
+G2 X0.256 Y9.701 I-6.749 J8.043
+G1 X0.051 Y1.940
+G1 X0.010 Y0.388
+G3 X-6.391 Y-10.926 I-3.151 J-5.685
+G1 X-1.278 Y-2.185
+G3 X23.467 Y1.073 I14.496 J-14.496
+G2 X24.207 Y2.523 I2.476 J-0.348
+G1 X4.841 Y0.505
+G1 X0.968 Y0.101
+G1 X0.194 Y0.020
+G2 X-2.138 Y8.724 I-4.213 J3.535
+G3 X-8.371 Y-1.447 I-12.483 J0.654
+G2 X-6.457 Y-19.656 I-16.166 J-10.904
+G3 X-8.446 Y-21.075 I-0.488 J-1.418
+G1 X-1.689 Y-4.215
+G1 X-0.338 Y-0.843
+G1 X-0.068 Y-0.169
+G3 X-1.070 Y2.663 I3.497 J2.832
+G2 X-9.781 Y13.420 I2.782 J11.158
+G1 X-1.956 Y2.684
+G2 X-2.822 Y3.184 I-0.433 J0.250
+G3 X-14.016 Y-4.225 I-7.444 J-0.914
+G1 X-2.803 Y-0.845
+G3 X-16.917 Y-3.461 I-3.363 J-21.235
+G2 X-12.128 Y-5.017 I1.643 J-3.090
+G3 X2.639 Y-18.548 I9.516 J-4.437
+G1 X0.528 Y-3.710
+G1 X0.106 Y-0.742
+G2 X5.681 Y1.740 I0.453 J6.484
+G3 X11.828 Y13.063 I-7.353 J11.322
+G2 X-20.612 Y4.370 I-19.264 J7.011
+G3 X-25.503 Y3.639 I-2.391 J-0.731
+G1 X-5.101 Y0.728
+G3 X11.687 Y-15.770 I0.288 J-16.497
+G1 X2.337 Y-3.154
+G3 X4.900 Y-9.341 I5.313 J-1.424
+G2 X19.935 Y7.358 I11.590 J4.683
+G1 X3.987 Y1.472
+G2 X4.945 Y3.967 I-0.157 J1.492
+G3 X-5.102 Y2.822 I-5.797 J6.217
+G2 X-10.403 Y-6.360 I-15.265 J2.692
+G1 X-2.081 Y-1.272
+G2 X-3.427 Y-9.773 I-1.973 J-4.045
+G1 X-0.685 Y-1.955
+G1 X-0.137 Y-0.391
+G3 X0.111 Y-0.001 I0.498 J-0.044
+G2 X-0.270 Y7.261 I6.360 J3.974
+G1 X-0.054 Y1.452
+G1 X-0.011 Y0.290
+G3 X-6.306 Y2.397 I-2.795 J2.106
+G2 X-16.806 Y12.897 I-10.500 J0.000
+G3 X-13.282 Y2.365 I-13.976 J-10.532
+G2 X4.450 Y-22.041 I-6.753 J-23.551
+G1 X0.890 Y-4.408
+G1 X0.178 Y-0.882
+G1 X0.036 Y-0.176
+G2 X2.910 Y-0.787 I1.858 J1.673
+G3 X9.473 Y0.311 I1.813 J9.325
+G2 X-13.059 Y8.960 I-7.233 J14.830
+G1 X-2.612 Y1.792
+G2 X-13.445 Y1.792 I-5.416 J-0.955
+G3 X-15.720 Y-18.175 I-8.525 J-9.142
+G1 X-3.144 Y-3.635
+G3 X-3.871 Y-4.921 I0.773 J-1.286
+G2 X9.914 Y-1.991 I7.881 J-3.184
+G1 X1.983 Y-0.398
+G1 X0.397 Y-0.080
+G3 X-4.025 Y4.420 I0.079 J4.499
+G2 X0.153 Y10.170 I-6.760 J9.304
+G1 X0.031 Y2.034
+G2 X-0.610 Y1.393 I-0.470 J-0.171
+G3 X-8.445 Y-11.392 I-4.085 J-6.290
+G1 X-1.689 Y-2.278
+G3 X23.166 Y0.115 I14.105 J-16.226
+G2 X24.533 Y2.219 I3.424 J-0.728
+G1 X4.907 Y0.444
+G1 X0.981 Y0.089
+G1 X0.196 Y0.018
+G2 X-1.428 Y10.272 I-4.676 J4.515
+G3 X-8.077 Y0.226 I-13.399 J1.645
+G2 X-8.077 Y-20.274 I-17.754 J-10.250
+G3 X-11.554 Y-22.575 I-0.977 J-2.301
+G1 X-2.311 Y-4.515
+G1 X-0.462 Y-0.903
+G1 X-0.092 Y-0.181
+G3 X-1.087 Y2.974 I4.505 J3.155
+G2 X-9.656 Y16.169 I3.863 J11.888
+G1 X-1.931 Y3.234
+G2 X-4.357 Y4.996 I-1.244 J0.839
+G3 X-17.095 Y-2.810 I-8.488 J-0.445
+G1 X-3.419 Y-0.562
+G3 X-19.730 Y-3.000 I-5.061 J-21.923
+G2 X-13.620 Y-5.720 I1.830 J-4.111
+G3 X2.188 Y-21.255 I10.058 J-5.575
+G1 X0.438 Y-4.251
+G3 X0.541 Y-3.464 I0.354 J0.354
+G2 X6.795 Y-1.432 I1.044 J7.427
+G3 X14.265 Y11.250 I-7.030 J12.682
+G2 X-21.354 Y5.608 I-19.641 J8.745
+G1 X-4.271 Y1.122
+G2 X-21.360 Y-8.745 I-6.749 J-8.043
+G3 X-4.776 Y-26.221 I-0.916 J-17.476
+G1 X-0.955 Y-5.244
+G3 X1.941 Y-12.990 I6.146 J-2.116
+G2 X20.271 Y3.515 I12.839 J4.172
+G1 X4.054 Y0.703
+G2 X6.040 Y4.599 I-0.087 J2.498
+G3 X-4.689 Y3.755 I-5.979 J7.383
+G2 X-11.955 Y-6.246 I-16.010 J3.992
+G1 X-2.391 Y-1.249
+G2 X-5.141 Y-11.512 I-2.750 J-4.763
+G1 X-1.028 Y-2.302
+G1 X-0.206 Y-0.460
+G3 X0.526 Y0.604 I1.482 J-0.235
+G2 X0.984 Y9.348 I7.505 J3.991
+G1 X0.197 Y1.870
+G1 X0.039 Y0.374
+G3 X-7.857 Y3.326 I-3.396 J2.952
+G2 X-17.728 Y15.516 I-11.472 J0.802
+G3 X-14.744 Y5.441 I-15.515 J-10.076
+G2 X-14.422 Y4.884 I-0.171 J-0.470
+G3 X-15.980 Y-8.784 I2.193 J-7.172
+G2 X6.527 Y-27.009 I11.731 J-8.523
+G1 X1.305 Y-5.402
+G2 X5.028 Y-6.611 I2.758 J2.155
+G3 X12.996 Y-5.562 I2.718 J10.142
+G2 X-10.540 Y6.430 I-6.556 J16.226
+G1 X-2.108 Y1.286
+G2 X-14.754 Y2.615 I-6.464 J-0.679
+G3 X-17.878 Y-18.283 I-9.873 J-9.207
+G1 X-3.576 Y-3.657
+G3 X-4.941 Y-5.884 I1.135 J-2.228
+G2 X11.084 Y-4.200 I8.539 J-4.165
+G1 X2.217 Y-0.840
+G1 X0.443 Y-0.168
+G3 X-4.577 Y5.311 I0.479 J5.479
+G2 X0.034 Y10.432 I-6.624 J10.601
+G1 X0.007 Y2.086
+G2 X-2.139 Y0.349 I-1.442 J-0.413
+G3 X-11.505 Y-13.801 I-5.115 J-6.788
+G1 X-2.301 Y-2.760
+G3 X22.490 Y-1.244 I13.541 J-17.969
+G2 X24.703 Y1.489 I4.326 J-1.240
+G1 X4.941 Y0.298
+G1 X0.988 Y0.060
+G3 X0.695 Y0.991 I-0.044 J0.498
+G2 X0.084 Y12.632 I-5.018 J5.574
+G3 X-6.899 Y2.841 I-14.234 J2.767
+G2 X-9.281 Y-19.820 I-19.324 J-9.425
+G3 X-14.370 Y-22.939 I-1.589 J-3.119
+G1 X-2.874 Y-4.588
+G1 X-0.575 Y-0.918
+G1 X-0.115 Y-0.184
+G3 X-1.043 Y3.164 I5.572 J3.348
+G2 X-9.085 Y18.947 I5.057 J12.517
+G1 X-1.817 Y3.789
+G2 X-5.524 Y7.127 I-1.970 J1.539
+G3 X-19.772 Y-0.935 I-9.499 J0.166
+G1 X-3.954 Y-0.187
+G3 X-22.575 Y-2.308 I-6.871 J-22.473
+G2 X-15.278 Y-6.522 I1.881 J-5.168
+G3 X1.456 Y-24.155 I10.483 J-6.808
+G1 X0.291 Y-4.831
+G3 X0.673 Y-2.548 I1.132 J0.984
+G2 X7.437 Y-1.110 I1.767 J8.314
+G3 X16.386 Y12.938 I-6.551 J14.048
+G2 X-22.134 Y10.919 I-19.866 J10.563
+G1 X-4.427 Y2.184
+G2 X-23.908 Y-6.490 I-7.989 J-8.272
+G3 X-7.663 Y-24.852 I-2.255 J-18.362
+G2 X-7.413 Y-24.785 I0.250 J-0.433
+G1 X-1.483 Y-4.957
+G2 X20.271 Y10.848 I14.069 J3.508
+G1 X4.054 Y2.170
+G2 X7.322 Y7.202 I0.122 J3.498
+G3 X-3.951 Y6.710 I-6.023 J8.601
+G2 X-13.476 Y-3.870 I-16.643 J5.408
+G1 X-2.695 Y-0.774
+G2 X-7.235 Y-12.599 I-3.635 J-5.389
+G1 X-1.447 Y-2.520
+G1 X-0.289 Y-0.504
+G3 X0.897 Y1.099 I2.436 J-0.562
+G2 X2.515 Y11.319 I8.679 J3.864
+G1 X0.503 Y2.264
+G1 X0.101 Y0.453
+G3 X-9.288 Y4.342 I-3.889 J3.889
+G2 X-18.221 Y18.097 I-12.378 J1.740
+G1 X-3.644 Y3.619
+G2 X-2.828 Y1.786 I-0.610 J-1.370
+G3 X-5.166 Y-13.858 I1.912 J-8.282
+G1 X-1.033 Y-2.772
+G1 X-0.207 Y-0.554
+G2 X4.150 Y-2.494 I3.731 J2.516
+G3 X13.644 Y-1.580 I3.744 J10.873
+G2 X-10.471 Y14.081 I-5.717 J17.595
+G3 X-11.131 Y14.801 I-0.410 J0.287
+G1 X-2.226 Y2.960
+G3 X-6.245 Y-18.722 I-11.269 J-9.125
+G1 X-1.249 Y-3.744
+G3 X-3.381 Y-6.966 I1.368 J-3.222
+G2 X14.805 Y-6.966 I9.093 J-5.250
+G1 X2.961 Y-1.393
+G1 X0.592 Y-0.279
+G3 X-4.891 Y6.141 I1.017 J6.420
+G2 X-12.171 Y4.594 I-6.338 J11.920
+G1 X-2.434 Y0.919
+G2 X-6.349 Y-1.624 I-2.445 J-0.520
+G3 X-17.332 Y-17.021 I-6.233 J-7.170
+G1 X-3.466 Y-3.404
+G3 X21.083 Y-2.761 I12.799 J-19.709
+G2 X24.370 Y0.526 I5.168 J-1.881
+G1 X4.874 Y0.105
+G1 X0.975 Y0.021
+G3 X0.199 Y2.820 I-0.026 J1.500
+G2 X0.870 Y15.632 I-5.233 J6.698
+G3 X-6.352 Y6.221 I-14.972 J4.012
+G2 X-11.584 Y-18.393 I-20.862 J-8.429
+G1 X-2.317 Y-3.679
+G2 X1.276 Y-26.364 I1.202 J-11.437
+G1 X0.255 Y-5.273
+G2 X0.577 Y-5.830 I0.492 J-0.087
+G3 X3.509 Y-8.920 I6.683 J3.405
+G2 X-3.579 Y9.545 I6.356 J13.033
+G1 X-0.716 Y1.909
+G2 X-5.374 Y7.082 I-2.601 J2.342
+G3 X-21.084 Y-1.096 I-10.460 J0.915
+G1 X-4.217 Y-0.219
+G3 X-25.247 Y-1.874 I-8.780 J-22.873
+G2 X-16.959 Y-7.896 I1.792 J-6.248
+G3 X0.572 Y-27.711 I10.782 J-8.125
+G1 X0.114 Y-5.542
+G3 X0.861 Y-1.873 I1.997 J1.505
+G2 X7.940 Y-1.129 I2.619 J9.132
+G3 X18.527 Y14.275 I-5.913 J15.404
+G2 X-22.524 Y16.427 I-19.929 J12.453
+G1 X-4.505 Y3.285
+G2 X-26.226 Y-3.772 I-9.289 J-8.364
+G3 X-10.446 Y-22.914 I-3.721 J-19.142
+G2 X-9.580 Y-22.777 I0.658 J-1.348
+G1 X-1.916 Y-4.555
+G2 X23.312 Y10.010 I15.265 J2.692
+G1 X4.662 Y2.002
+G2 X9.412 Y7.868 I0.470 J4.475
+G3 X-2.260 Y7.766 I-5.923 J9.857
+G2 X-14.314 Y-3.087 I-17.153 J6.930
+G3 X-15.047 Y-2.783 I-0.483 J-0.129
+G2 X-21.732 Y-15.903 I-4.617 J-5.910
+G1 X-4.346 Y-3.181
+G1 X-0.869 Y-0.636
+G3 X0.728 Y1.372 I3.347 J-1.023
+G2 X3.845 Y13.006 I9.867 J3.591
+G1 X0.769 Y2.601
+G1 X0.154 Y0.520
+G3 X-10.611 Y5.426 I-4.264 J4.906
+G2 X-18.325 Y20.566 I-13.205 J2.807
+G1 X-3.665 Y4.113
+G2 X-2.592 Y0.810 I-1.174 J-2.207
+G3 X-5.855 Y-16.800 I1.486 J-9.383
+G1 X-1.171 Y-3.360
+G1 X-0.234 Y-0.672
+G2 X4.529 Y-3.422 I4.763 J2.750
+G3 X15.663 Y-2.741 I4.884 J11.506
+G2 X-8.543 Y16.860 I-4.717 J18.921
+G3 X-10.458 Y19.103 I-1.166 J0.944
+G1 X-2.092 Y3.821
+G3 X-7.039 Y-18.493 I-12.697 J-8.890
+G1 X-1.408 Y-3.699
+G3 X-4.443 Y-7.953 I1.465 J-4.255
+G2 X15.754 Y-10.076 I9.534 J-6.431
+G1 X3.151 Y-2.015
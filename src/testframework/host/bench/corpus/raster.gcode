@@ -0,0 +1,3248 @@
+; laser raster
+; generated by make_corpus.py
+G21
+G90
+G0 X-10 Y-5
+M3
+G1 F6000
+G0 X-10.000 Y-5.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.57
+G1 X-9.250 S0.64
+G1 X-9.000 S0.71
+G1 X-8.750 S0.77
+G1 X-8.500 S0.83
+G1 X-8.250 S0.88
+G1 X-8.000 S0.92
+G1 X-7.750 S0.95
+G1 X-7.500 S0.98
+G1 X-7.250 S0.99
+G1 X-7.000 S1.00
+G1 X-6.750 S0.99
+G1 X-6.500 S0.98
+G1 X-6.250 S0.95
+G1 X-6.000 S0.92
+G1 X-5.750 S0.88
+G1 X-5.500 S0.83
+G1 X-5.250 S0.77
+G1 X-5.000 S0.71
+G1 X-4.750 S0.64
+G1 X-4.500 S0.57
+G1 X-4.250 S0.50
+G1 X-4.000 S0.43
+G1 X-3.750 S0.36
+G1 X-3.500 S0.29
+G1 X-3.250 S0.23
+G1 X-3.000 S0.17
+G1 X-2.750 S0.12
+G1 X-2.500 S0.08
+G1 X-2.250 S0.04
+G1 X-2.000 S0.02
+G1 X-1.750 S0.00
+G1 X-1.500 S0.00
+G1 X-1.250 S0.01
+G1 X-1.000 S0.02
+G1 X-0.750 S0.05
+G1 X-0.500 S0.08
+G1 X-0.250 S0.12
+G1 X0.000 S0.17
+G1 X0.250 S0.23
+G1 X0.500 S0.29
+G1 X0.750 S0.36
+G1 X1.000 S0.43
+G1 X1.250 S0.50
+G1 X1.500 S0.57
+G1 X1.750 S0.64
+G1 X2.000 S0.71
+G1 X2.250 S0.77
+G1 X2.500 S0.83
+G1 X2.750 S0.88
+G1 X3.000 S0.92
+G1 X3.250 S0.96
+G1 X3.500 S0.98
+G1 X3.750 S1.00
+G1 X4.000 S1.00
+G1 X4.250 S0.99
+G1 X4.500 S0.98
+G1 X4.750 S0.95
+G1 X5.000 S0.92
+G1 X5.250 S0.88
+G1 X5.500 S0.83
+G1 X5.750 S0.77
+G1 X6.000 S0.71
+G1 X6.250 S0.64
+G1 X6.500 S0.57
+G1 X6.750 S0.50
+G1 X7.000 S0.43
+G1 X7.250 S0.36
+G1 X7.500 S0.29
+G1 X7.750 S0.23
+G1 X8.000 S0.17
+G1 X8.250 S0.12
+G1 X8.500 S0.08
+G1 X8.750 S0.04
+G1 X9.000 S0.02
+G1 X9.250 S0.00
+G1 X9.500 S0.00
+G1 X9.750 S0.01
+G1 X10.000 S0.02
+G0 X10.000 Y-4.750
+G1 X9.750 S0.03
+G1 X9.500 S0.02
+G1 X9.250 S0.01
+G1 X9.000 S0.01
+G1 X8.750 S0.03
+G1 X8.500 S0.05
+G1 X8.250 S0.09
+G1 X8.000 S0.13
+G1 X7.750 S0.18
+G1 X7.500 S0.23
+G1 X7.250 S0.29
+G1 X7.000 S0.36
+G1 X6.750 S0.43
+G1 X6.500 S0.50
+G1 X6.250 S0.57
+G1 X6.000 S0.64
+G1 X5.750 S0.70
+G1 X5.500 S0.76
+G1 X5.250 S0.82
+G1 X5.000 S0.87
+G1 X4.750 S0.91
+G1 X4.500 S0.95
+G1 X4.250 S0.97
+G1 X4.000 S0.98
+G1 X3.750 S0.99
+G1 X3.500 S0.99
+G1 X3.250 S0.97
+G1 X3.000 S0.95
+G1 X2.750 S0.91
+G1 X2.500 S0.87
+G1 X2.250 S0.82
+G1 X2.000 S0.77
+G1 X1.750 S0.70
+G1 X1.500 S0.64
+G1 X1.250 S0.57
+G1 X1.000 S0.50
+G1 X0.750 S0.43
+G1 X0.500 S0.36
+G1 X0.250 S0.30
+G1 X0.000 S0.24
+G1 X-0.250 S0.18
+G1 X-0.500 S0.13
+G1 X-0.750 S0.09
+G1 X-1.000 S0.05
+G1 X-1.250 S0.03
+G1 X-1.500 S0.02
+G1 X-1.750 S0.01
+G1 X-2.000 S0.01
+G1 X-2.250 S0.03
+G1 X-2.500 S0.05
+G1 X-2.750 S0.09
+G1 X-3.000 S0.13
+G1 X-3.250 S0.18
+G1 X-3.500 S0.23
+G1 X-3.750 S0.30
+G1 X-4.000 S0.36
+G1 X-4.250 S0.43
+G1 X-4.500 S0.50
+G1 X-4.750 S0.57
+G1 X-5.000 S0.64
+G1 X-5.250 S0.70
+G1 X-5.500 S0.76
+G1 X-5.750 S0.82
+G1 X-6.000 S0.87
+G1 X-6.250 S0.91
+G1 X-6.500 S0.95
+G1 X-6.750 S0.97
+G1 X-7.000 S0.98
+G1 X-7.250 S0.99
+G1 X-7.500 S0.99
+G1 X-7.750 S0.97
+G1 X-8.000 S0.95
+G1 X-8.250 S0.91
+G1 X-8.500 S0.87
+G1 X-8.750 S0.82
+G1 X-9.000 S0.77
+G1 X-9.250 S0.70
+G1 X-9.500 S0.64
+G1 X-9.750 S0.57
+G1 X-10.000 S0.50
+G0 X-10.000 Y-4.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.57
+G1 X-9.250 S0.63
+G1 X-9.000 S0.69
+G1 X-8.750 S0.75
+G1 X-8.500 S0.80
+G1 X-8.250 S0.85
+G1 X-8.000 S0.89
+G1 X-7.750 S0.92
+G1 X-7.500 S0.94
+G1 X-7.250 S0.96
+G1 X-7.000 S0.96
+G1 X-6.750 S0.96
+G1 X-6.500 S0.94
+G1 X-6.250 S0.92
+G1 X-6.000 S0.89
+G1 X-5.750 S0.85
+G1 X-5.500 S0.80
+G1 X-5.250 S0.75
+G1 X-5.000 S0.69
+G1 X-4.750 S0.63
+G1 X-4.500 S0.56
+G1 X-4.250 S0.50
+G1 X-4.000 S0.43
+G1 X-3.750 S0.37
+G1 X-3.500 S0.31
+G1 X-3.250 S0.25
+G1 X-3.000 S0.20
+G1 X-2.750 S0.15
+G1 X-2.500 S0.11
+G1 X-2.250 S0.08
+G1 X-2.000 S0.06
+G1 X-1.750 S0.04
+G1 X-1.500 S0.04
+G1 X-1.250 S0.04
+G1 X-1.000 S0.06
+G1 X-0.750 S0.08
+G1 X-0.500 S0.11
+G1 X-0.250 S0.15
+G1 X0.000 S0.20
+G1 X0.250 S0.25
+G1 X0.500 S0.31
+G1 X0.750 S0.37
+G1 X1.000 S0.44
+G1 X1.250 S0.50
+G1 X1.500 S0.57
+G1 X1.750 S0.63
+G1 X2.000 S0.69
+G1 X2.250 S0.75
+G1 X2.500 S0.80
+G1 X2.750 S0.85
+G1 X3.000 S0.89
+G1 X3.250 S0.92
+G1 X3.500 S0.94
+G1 X3.750 S0.96
+G1 X4.000 S0.96
+G1 X4.250 S0.96
+G1 X4.500 S0.94
+G1 X4.750 S0.92
+G1 X5.000 S0.89
+G1 X5.250 S0.85
+G1 X5.500 S0.80
+G1 X5.750 S0.75
+G1 X6.000 S0.69
+G1 X6.250 S0.63
+G1 X6.500 S0.56
+G1 X6.750 S0.50
+G1 X7.000 S0.43
+G1 X7.250 S0.37
+G1 X7.500 S0.31
+G1 X7.750 S0.25
+G1 X8.000 S0.20
+G1 X8.250 S0.15
+G1 X8.500 S0.11
+G1 X8.750 S0.08
+G1 X9.000 S0.06
+G1 X9.250 S0.04
+G1 X9.500 S0.04
+G1 X9.750 S0.04
+G1 X10.000 S0.06
+G0 X10.000 Y-4.250
+G1 X9.750 S0.10
+G1 X9.500 S0.09
+G1 X9.250 S0.09
+G1 X9.000 S0.09
+G1 X8.750 S0.10
+G1 X8.500 S0.12
+G1 X8.250 S0.15
+G1 X8.000 S0.19
+G1 X7.750 S0.23
+G1 X7.500 S0.28
+G1 X7.250 S0.33
+G1 X7.000 S0.38
+G1 X6.750 S0.44
+G1 X6.500 S0.50
+G1 X6.250 S0.56
+G1 X6.000 S0.61
+G1 X5.750 S0.67
+G1 X5.500 S0.72
+G1 X5.250 S0.77
+G1 X5.000 S0.81
+G1 X4.750 S0.85
+G1 X4.500 S0.87
+G1 X4.250 S0.90
+G1 X4.000 S0.91
+G1 X3.750 S0.91
+G1 X3.500 S0.91
+G1 X3.250 S0.90
+G1 X3.000 S0.88
+G1 X2.750 S0.85
+G1 X2.500 S0.81
+G1 X2.250 S0.77
+G1 X2.000 S0.72
+G1 X1.750 S0.67
+G1 X1.500 S0.62
+G1 X1.250 S0.56
+G1 X1.000 S0.50
+G1 X0.750 S0.44
+G1 X0.500 S0.38
+G1 X0.250 S0.33
+G1 X0.000 S0.28
+G1 X-0.250 S0.23
+G1 X-0.500 S0.19
+G1 X-0.750 S0.15
+G1 X-1.000 S0.12
+G1 X-1.250 S0.10
+G1 X-1.500 S0.09
+G1 X-1.750 S0.09
+G1 X-2.000 S0.09
+G1 X-2.250 S0.10
+G1 X-2.500 S0.12
+G1 X-2.750 S0.15
+G1 X-3.000 S0.19
+G1 X-3.250 S0.23
+G1 X-3.500 S0.28
+G1 X-3.750 S0.33
+G1 X-4.000 S0.38
+G1 X-4.250 S0.44
+G1 X-4.500 S0.50
+G1 X-4.750 S0.56
+G1 X-5.000 S0.62
+G1 X-5.250 S0.67
+G1 X-5.500 S0.72
+G1 X-5.750 S0.77
+G1 X-6.000 S0.81
+G1 X-6.250 S0.85
+G1 X-6.500 S0.88
+G1 X-6.750 S0.90
+G1 X-7.000 S0.91
+G1 X-7.250 S0.91
+G1 X-7.500 S0.91
+G1 X-7.750 S0.90
+G1 X-8.000 S0.88
+G1 X-8.250 S0.85
+G1 X-8.500 S0.81
+G1 X-8.750 S0.77
+G1 X-9.000 S0.72
+G1 X-9.250 S0.67
+G1 X-9.500 S0.62
+G1 X-9.750 S0.56
+G1 X-10.000 S0.50
+G0 X-10.000 Y-4.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.55
+G1 X-9.250 S0.60
+G1 X-9.000 S0.64
+G1 X-8.750 S0.69
+G1 X-8.500 S0.73
+G1 X-8.250 S0.76
+G1 X-8.000 S0.79
+G1 X-7.750 S0.82
+G1 X-7.500 S0.83
+G1 X-7.250 S0.84
+G1 X-7.000 S0.85
+G1 X-6.750 S0.84
+G1 X-6.500 S0.83
+G1 X-6.250 S0.82
+G1 X-6.000 S0.79
+G1 X-5.750 S0.76
+G1 X-5.500 S0.73
+G1 X-5.250 S0.69
+G1 X-5.000 S0.64
+G1 X-4.750 S0.60
+G1 X-4.500 S0.55
+G1 X-4.250 S0.50
+G1 X-4.000 S0.45
+G1 X-3.750 S0.40
+G1 X-3.500 S0.35
+G1 X-3.250 S0.31
+G1 X-3.000 S0.27
+G1 X-2.750 S0.24
+G1 X-2.500 S0.21
+G1 X-2.250 S0.18
+G1 X-2.000 S0.17
+G1 X-1.750 S0.16
+G1 X-1.500 S0.15
+G1 X-1.250 S0.16
+G1 X-1.000 S0.17
+G1 X-0.750 S0.18
+G1 X-0.500 S0.21
+G1 X-0.250 S0.24
+G1 X0.000 S0.27
+G1 X0.250 S0.31
+G1 X0.500 S0.36
+G1 X0.750 S0.40
+G1 X1.000 S0.45
+G1 X1.250 S0.50
+G1 X1.500 S0.55
+G1 X1.750 S0.60
+G1 X2.000 S0.65
+G1 X2.250 S0.69
+G1 X2.500 S0.73
+G1 X2.750 S0.76
+G1 X3.000 S0.79
+G1 X3.250 S0.82
+G1 X3.500 S0.83
+G1 X3.750 S0.84
+G1 X4.000 S0.85
+G1 X4.250 S0.84
+G1 X4.500 S0.83
+G1 X4.750 S0.82
+G1 X5.000 S0.79
+G1 X5.250 S0.76
+G1 X5.500 S0.73
+G1 X5.750 S0.69
+G1 X6.000 S0.64
+G1 X6.250 S0.60
+G1 X6.500 S0.55
+G1 X6.750 S0.50
+G1 X7.000 S0.45
+G1 X7.250 S0.40
+G1 X7.500 S0.35
+G1 X7.750 S0.31
+G1 X8.000 S0.27
+G1 X8.250 S0.24
+G1 X8.500 S0.21
+G1 X8.750 S0.18
+G1 X9.000 S0.17
+G1 X9.250 S0.15
+G1 X9.500 S0.15
+G1 X9.750 S0.16
+G1 X10.000 S0.17
+G0 X10.000 Y-3.750
+G1 X9.750 S0.24
+G1 X9.500 S0.23
+G1 X9.250 S0.23
+G1 X9.000 S0.23
+G1 X8.750 S0.24
+G1 X8.500 S0.25
+G1 X8.250 S0.27
+G1 X8.000 S0.30
+G1 X7.750 S0.32
+G1 X7.500 S0.35
+G1 X7.250 S0.39
+G1 X7.000 S0.42
+G1 X6.750 S0.46
+G1 X6.500 S0.50
+G1 X6.250 S0.54
+G1 X6.000 S0.58
+G1 X5.750 S0.61
+G1 X5.500 S0.65
+G1 X5.250 S0.68
+G1 X5.000 S0.70
+G1 X4.750 S0.73
+G1 X4.500 S0.75
+G1 X4.250 S0.76
+G1 X4.000 S0.77
+G1 X3.750 S0.77
+G1 X3.500 S0.77
+G1 X3.250 S0.76
+G1 X3.000 S0.75
+G1 X2.750 S0.73
+G1 X2.500 S0.70
+G1 X2.250 S0.68
+G1 X2.000 S0.65
+G1 X1.750 S0.61
+G1 X1.500 S0.58
+G1 X1.250 S0.54
+G1 X1.000 S0.50
+G1 X0.750 S0.46
+G1 X0.500 S0.42
+G1 X0.250 S0.39
+G1 X0.000 S0.35
+G1 X-0.250 S0.32
+G1 X-0.500 S0.30
+G1 X-0.750 S0.27
+G1 X-1.000 S0.25
+G1 X-1.250 S0.24
+G1 X-1.500 S0.23
+G1 X-1.750 S0.23
+G1 X-2.000 S0.23
+G1 X-2.250 S0.24
+G1 X-2.500 S0.25
+G1 X-2.750 S0.27
+G1 X-3.000 S0.30
+G1 X-3.250 S0.32
+G1 X-3.500 S0.35
+G1 X-3.750 S0.39
+G1 X-4.000 S0.42
+G1 X-4.250 S0.46
+G1 X-4.500 S0.50
+G1 X-4.750 S0.54
+G1 X-5.000 S0.58
+G1 X-5.250 S0.61
+G1 X-5.500 S0.65
+G1 X-5.750 S0.68
+G1 X-6.000 S0.70
+G1 X-6.250 S0.73
+G1 X-6.500 S0.75
+G1 X-6.750 S0.76
+G1 X-7.000 S0.77
+G1 X-7.250 S0.77
+G1 X-7.500 S0.77
+G1 X-7.750 S0.76
+G1 X-8.000 S0.75
+G1 X-8.250 S0.73
+G1 X-8.500 S0.70
+G1 X-8.750 S0.68
+G1 X-9.000 S0.65
+G1 X-9.250 S0.61
+G1 X-9.500 S0.58
+G1 X-9.750 S0.54
+G1 X-10.000 S0.50
+G0 X-10.000 Y-3.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.53
+G1 X-9.250 S0.55
+G1 X-9.000 S0.58
+G1 X-8.750 S0.60
+G1 X-8.500 S0.62
+G1 X-8.250 S0.64
+G1 X-8.000 S0.65
+G1 X-7.750 S0.66
+G1 X-7.500 S0.67
+G1 X-7.250 S0.68
+G1 X-7.000 S0.68
+G1 X-6.750 S0.68
+G1 X-6.500 S0.67
+G1 X-6.250 S0.66
+G1 X-6.000 S0.65
+G1 X-5.750 S0.64
+G1 X-5.500 S0.62
+G1 X-5.250 S0.60
+G1 X-5.000 S0.58
+G1 X-4.750 S0.55
+G1 X-4.500 S0.53
+G1 X-4.250 S0.50
+G1 X-4.000 S0.47
+G1 X-3.750 S0.45
+G1 X-3.500 S0.42
+G1 X-3.250 S0.40
+G1 X-3.000 S0.38
+G1 X-2.750 S0.36
+G1 X-2.500 S0.35
+G1 X-2.250 S0.34
+G1 X-2.000 S0.33
+G1 X-1.750 S0.32
+G1 X-1.500 S0.32
+G1 X-1.250 S0.32
+G1 X-1.000 S0.33
+G1 X-0.750 S0.34
+G1 X-0.500 S0.35
+G1 X-0.250 S0.36
+G1 X0.000 S0.38
+G1 X0.250 S0.40
+G1 X0.500 S0.43
+G1 X0.750 S0.45
+G1 X1.000 S0.47
+G1 X1.250 S0.50
+G1 X1.500 S0.53
+G1 X1.750 S0.55
+G1 X2.000 S0.58
+G1 X2.250 S0.60
+G1 X2.500 S0.62
+G1 X2.750 S0.64
+G1 X3.000 S0.65
+G1 X3.250 S0.67
+G1 X3.500 S0.67
+G1 X3.750 S0.68
+G1 X4.000 S0.68
+G1 X4.250 S0.68
+G1 X4.500 S0.67
+G1 X4.750 S0.66
+G1 X5.000 S0.65
+G1 X5.250 S0.64
+G1 X5.500 S0.62
+G1 X5.750 S0.60
+G1 X6.000 S0.57
+G1 X6.250 S0.55
+G1 X6.500 S0.53
+G1 X6.750 S0.50
+G1 X7.000 S0.47
+G1 X7.250 S0.45
+G1 X7.500 S0.42
+G1 X7.750 S0.40
+G1 X8.000 S0.38
+G1 X8.250 S0.36
+G1 X8.500 S0.35
+G1 X8.750 S0.33
+G1 X9.000 S0.33
+G1 X9.250 S0.32
+G1 X9.500 S0.32
+G1 X9.750 S0.32
+G1 X10.000 S0.33
+G0 X10.000 Y-3.250
+G1 X9.750 S0.42
+G1 X9.500 S0.42
+G1 X9.250 S0.42
+G1 X9.000 S0.42
+G1 X8.750 S0.42
+G1 X8.500 S0.42
+G1 X8.250 S0.43
+G1 X8.000 S0.44
+G1 X7.750 S0.44
+G1 X7.500 S0.45
+G1 X7.250 S0.46
+G1 X7.000 S0.48
+G1 X6.750 S0.49
+G1 X6.500 S0.50
+G1 X6.250 S0.51
+G1 X6.000 S0.52
+G1 X5.750 S0.54
+G1 X5.500 S0.55
+G1 X5.250 S0.56
+G1 X5.000 S0.56
+G1 X4.750 S0.57
+G1 X4.500 S0.58
+G1 X4.250 S0.58
+G1 X4.000 S0.58
+G1 X3.750 S0.58
+G1 X3.500 S0.58
+G1 X3.250 S0.58
+G1 X3.000 S0.58
+G1 X2.750 S0.57
+G1 X2.500 S0.56
+G1 X2.250 S0.56
+G1 X2.000 S0.55
+G1 X1.750 S0.54
+G1 X1.500 S0.52
+G1 X1.250 S0.51
+G1 X1.000 S0.50
+G1 X0.750 S0.49
+G1 X0.500 S0.48
+G1 X0.250 S0.46
+G1 X0.000 S0.45
+G1 X-0.250 S0.44
+G1 X-0.500 S0.44
+G1 X-0.750 S0.43
+G1 X-1.000 S0.42
+G1 X-1.250 S0.42
+G1 X-1.500 S0.42
+G1 X-1.750 S0.42
+G1 X-2.000 S0.42
+G1 X-2.250 S0.42
+G1 X-2.500 S0.42
+G1 X-2.750 S0.43
+G1 X-3.000 S0.44
+G1 X-3.250 S0.44
+G1 X-3.500 S0.45
+G1 X-3.750 S0.46
+G1 X-4.000 S0.48
+G1 X-4.250 S0.49
+G1 X-4.500 S0.50
+G1 X-4.750 S0.51
+G1 X-5.000 S0.52
+G1 X-5.250 S0.54
+G1 X-5.500 S0.55
+G1 X-5.750 S0.56
+G1 X-6.000 S0.56
+G1 X-6.250 S0.57
+G1 X-6.500 S0.58
+G1 X-6.750 S0.58
+G1 X-7.000 S0.58
+G1 X-7.250 S0.58
+G1 X-7.500 S0.58
+G1 X-7.750 S0.58
+G1 X-8.000 S0.58
+G1 X-8.250 S0.57
+G1 X-8.500 S0.56
+G1 X-8.750 S0.56
+G1 X-9.000 S0.55
+G1 X-9.250 S0.54
+G1 X-9.500 S0.52
+G1 X-9.750 S0.51
+G1 X-10.000 S0.50
+G0 X-10.000 Y-3.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.50
+G1 X-9.250 S0.50
+G1 X-9.000 S0.49
+G1 X-8.750 S0.49
+G1 X-8.500 S0.49
+G1 X-8.250 S0.49
+G1 X-8.000 S0.49
+G1 X-7.750 S0.49
+G1 X-7.500 S0.49
+G1 X-7.250 S0.49
+G1 X-7.000 S0.49
+G1 X-6.750 S0.49
+G1 X-6.500 S0.49
+G1 X-6.250 S0.49
+G1 X-6.000 S0.49
+G1 X-5.750 S0.49
+G1 X-5.500 S0.49
+G1 X-5.250 S0.49
+G1 X-5.000 S0.49
+G1 X-4.750 S0.50
+G1 X-4.500 S0.50
+G1 X-4.250 S0.50
+G1 X-4.000 S0.50
+G1 X-3.750 S0.50
+G1 X-3.500 S0.51
+G1 X-3.250 S0.51
+G1 X-3.000 S0.51
+G1 X-2.750 S0.51
+G1 X-2.500 S0.51
+G1 X-2.250 S0.51
+G1 X-2.000 S0.51
+G1 X-1.750 S0.51
+G1 X-1.500 S0.51
+G1 X-1.250 S0.51
+G1 X-1.000 S0.51
+G1 X-0.750 S0.51
+G1 X-0.500 S0.51
+G1 X-0.250 S0.51
+G1 X0.000 S0.51
+G1 X0.250 S0.51
+G1 X0.500 S0.51
+G1 X0.750 S0.50
+G1 X1.000 S0.50
+G1 X1.250 S0.50
+G1 X1.500 S0.50
+G1 X1.750 S0.50
+G1 X2.000 S0.49
+G1 X2.250 S0.49
+G1 X2.500 S0.49
+G1 X2.750 S0.49
+G1 X3.000 S0.49
+G1 X3.250 S0.49
+G1 X3.500 S0.49
+G1 X3.750 S0.49
+G1 X4.000 S0.49
+G1 X4.250 S0.49
+G1 X4.500 S0.49
+G1 X4.750 S0.49
+G1 X5.000 S0.49
+G1 X5.250 S0.49
+G1 X5.500 S0.49
+G1 X5.750 S0.49
+G1 X6.000 S0.49
+G1 X6.250 S0.50
+G1 X6.500 S0.50
+G1 X6.750 S0.50
+G1 X7.000 S0.50
+G1 X7.250 S0.50
+G1 X7.500 S0.51
+G1 X7.750 S0.51
+G1 X8.000 S0.51
+G1 X8.250 S0.51
+G1 X8.500 S0.51
+G1 X8.750 S0.51
+G1 X9.000 S0.51
+G1 X9.250 S0.51
+G1 X9.500 S0.51
+G1 X9.750 S0.51
+G1 X10.000 S0.51
+G0 X10.000 Y-2.750
+G1 X9.750 S0.61
+G1 X9.500 S0.61
+G1 X9.250 S0.61
+G1 X9.000 S0.61
+G1 X8.750 S0.61
+G1 X8.500 S0.60
+G1 X8.250 S0.60
+G1 X8.000 S0.59
+G1 X7.750 S0.57
+G1 X7.500 S0.56
+G1 X7.250 S0.55
+G1 X7.000 S0.53
+G1 X6.750 S0.52
+G1 X6.500 S0.50
+G1 X6.250 S0.48
+G1 X6.000 S0.47
+G1 X5.750 S0.45
+G1 X5.500 S0.44
+G1 X5.250 S0.43
+G1 X5.000 S0.41
+G1 X4.750 S0.40
+G1 X4.500 S0.40
+G1 X4.250 S0.39
+G1 X4.000 S0.39
+G1 X3.750 S0.39
+G1 X3.500 S0.39
+G1 X3.250 S0.39
+G1 X3.000 S0.40
+G1 X2.750 S0.40
+G1 X2.500 S0.41
+G1 X2.250 S0.43
+G1 X2.000 S0.44
+G1 X1.750 S0.45
+G1 X1.500 S0.47
+G1 X1.250 S0.48
+G1 X1.000 S0.50
+G1 X0.750 S0.52
+G1 X0.500 S0.53
+G1 X0.250 S0.55
+G1 X0.000 S0.56
+G1 X-0.250 S0.57
+G1 X-0.500 S0.59
+G1 X-0.750 S0.60
+G1 X-1.000 S0.60
+G1 X-1.250 S0.61
+G1 X-1.500 S0.61
+G1 X-1.750 S0.61
+G1 X-2.000 S0.61
+G1 X-2.250 S0.61
+G1 X-2.500 S0.60
+G1 X-2.750 S0.60
+G1 X-3.000 S0.59
+G1 X-3.250 S0.57
+G1 X-3.500 S0.56
+G1 X-3.750 S0.55
+G1 X-4.000 S0.53
+G1 X-4.250 S0.52
+G1 X-4.500 S0.50
+G1 X-4.750 S0.48
+G1 X-5.000 S0.47
+G1 X-5.250 S0.45
+G1 X-5.500 S0.44
+G1 X-5.750 S0.43
+G1 X-6.000 S0.41
+G1 X-6.250 S0.40
+G1 X-6.500 S0.40
+G1 X-6.750 S0.39
+G1 X-7.000 S0.39
+G1 X-7.250 S0.39
+G1 X-7.500 S0.39
+G1 X-7.750 S0.39
+G1 X-8.000 S0.40
+G1 X-8.250 S0.40
+G1 X-8.500 S0.41
+G1 X-8.750 S0.43
+G1 X-9.000 S0.44
+G1 X-9.250 S0.45
+G1 X-9.500 S0.47
+G1 X-9.750 S0.48
+G1 X-10.000 S0.50
+G0 X-10.000 Y-2.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.47
+G1 X-9.250 S0.44
+G1 X-9.000 S0.41
+G1 X-8.750 S0.39
+G1 X-8.500 S0.36
+G1 X-8.250 S0.34
+G1 X-8.000 S0.32
+G1 X-7.750 S0.31
+G1 X-7.500 S0.30
+G1 X-7.250 S0.29
+G1 X-7.000 S0.29
+G1 X-6.750 S0.29
+G1 X-6.500 S0.30
+G1 X-6.250 S0.31
+G1 X-6.000 S0.33
+G1 X-5.750 S0.34
+G1 X-5.500 S0.36
+G1 X-5.250 S0.39
+G1 X-5.000 S0.41
+G1 X-4.750 S0.44
+G1 X-4.500 S0.47
+G1 X-4.250 S0.50
+G1 X-4.000 S0.53
+G1 X-3.750 S0.56
+G1 X-3.500 S0.59
+G1 X-3.250 S0.61
+G1 X-3.000 S0.64
+G1 X-2.750 S0.66
+G1 X-2.500 S0.68
+G1 X-2.250 S0.69
+G1 X-2.000 S0.70
+G1 X-1.750 S0.71
+G1 X-1.500 S0.71
+G1 X-1.250 S0.71
+G1 X-1.000 S0.70
+G1 X-0.750 S0.69
+G1 X-0.500 S0.67
+G1 X-0.250 S0.66
+G1 X0.000 S0.64
+G1 X0.250 S0.61
+G1 X0.500 S0.59
+G1 X0.750 S0.56
+G1 X1.000 S0.53
+G1 X1.250 S0.50
+G1 X1.500 S0.47
+G1 X1.750 S0.44
+G1 X2.000 S0.41
+G1 X2.250 S0.39
+G1 X2.500 S0.36
+G1 X2.750 S0.34
+G1 X3.000 S0.32
+G1 X3.250 S0.31
+G1 X3.500 S0.30
+G1 X3.750 S0.29
+G1 X4.000 S0.29
+G1 X4.250 S0.29
+G1 X4.500 S0.30
+G1 X4.750 S0.31
+G1 X5.000 S0.33
+G1 X5.250 S0.34
+G1 X5.500 S0.36
+G1 X5.750 S0.39
+G1 X6.000 S0.41
+G1 X6.250 S0.44
+G1 X6.500 S0.47
+G1 X6.750 S0.50
+G1 X7.000 S0.53
+G1 X7.250 S0.56
+G1 X7.500 S0.59
+G1 X7.750 S0.61
+G1 X8.000 S0.64
+G1 X8.250 S0.66
+G1 X8.500 S0.68
+G1 X8.750 S0.69
+G1 X9.000 S0.70
+G1 X9.250 S0.71
+G1 X9.500 S0.71
+G1 X9.750 S0.71
+G1 X10.000 S0.70
+G0 X10.000 Y-2.250
+G1 X9.750 S0.78
+G1 X9.500 S0.79
+G1 X9.250 S0.79
+G1 X9.000 S0.79
+G1 X8.750 S0.78
+G1 X8.500 S0.77
+G1 X8.250 S0.75
+G1 X8.000 S0.72
+G1 X7.750 S0.69
+G1 X7.500 S0.66
+G1 X7.250 S0.62
+G1 X7.000 S0.58
+G1 X6.750 S0.54
+G1 X6.500 S0.50
+G1 X6.250 S0.46
+G1 X6.000 S0.42
+G1 X5.750 S0.38
+G1 X5.500 S0.34
+G1 X5.250 S0.31
+G1 X5.000 S0.28
+G1 X4.750 S0.25
+G1 X4.500 S0.23
+G1 X4.250 S0.22
+G1 X4.000 S0.21
+G1 X3.750 S0.21
+G1 X3.500 S0.21
+G1 X3.250 S0.22
+G1 X3.000 S0.23
+G1 X2.750 S0.25
+G1 X2.500 S0.28
+G1 X2.250 S0.31
+G1 X2.000 S0.34
+G1 X1.750 S0.38
+G1 X1.500 S0.42
+G1 X1.250 S0.46
+G1 X1.000 S0.50
+G1 X0.750 S0.54
+G1 X0.500 S0.58
+G1 X0.250 S0.62
+G1 X0.000 S0.66
+G1 X-0.250 S0.69
+G1 X-0.500 S0.72
+G1 X-0.750 S0.75
+G1 X-1.000 S0.77
+G1 X-1.250 S0.78
+G1 X-1.500 S0.79
+G1 X-1.750 S0.79
+G1 X-2.000 S0.79
+G1 X-2.250 S0.78
+G1 X-2.500 S0.77
+G1 X-2.750 S0.75
+G1 X-3.000 S0.72
+G1 X-3.250 S0.69
+G1 X-3.500 S0.66
+G1 X-3.750 S0.62
+G1 X-4.000 S0.58
+G1 X-4.250 S0.54
+G1 X-4.500 S0.50
+G1 X-4.750 S0.46
+G1 X-5.000 S0.42
+G1 X-5.250 S0.38
+G1 X-5.500 S0.34
+G1 X-5.750 S0.31
+G1 X-6.000 S0.28
+G1 X-6.250 S0.25
+G1 X-6.500 S0.23
+G1 X-6.750 S0.22
+G1 X-7.000 S0.21
+G1 X-7.250 S0.21
+G1 X-7.500 S0.21
+G1 X-7.750 S0.22
+G1 X-8.000 S0.23
+G1 X-8.250 S0.25
+G1 X-8.500 S0.28
+G1 X-8.750 S0.31
+G1 X-9.000 S0.34
+G1 X-9.250 S0.38
+G1 X-9.500 S0.42
+G1 X-9.750 S0.46
+G1 X-10.000 S0.50
+G0 X-10.000 Y-2.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.45
+G1 X-9.250 S0.40
+G1 X-9.000 S0.35
+G1 X-8.750 S0.30
+G1 X-8.500 S0.26
+G1 X-8.250 S0.22
+G1 X-8.000 S0.19
+G1 X-7.750 S0.16
+G1 X-7.500 S0.15
+G1 X-7.250 S0.14
+G1 X-7.000 S0.13
+G1 X-6.750 S0.14
+G1 X-6.500 S0.15
+G1 X-6.250 S0.16
+G1 X-6.000 S0.19
+G1 X-5.750 S0.22
+G1 X-5.500 S0.26
+G1 X-5.250 S0.30
+G1 X-5.000 S0.35
+G1 X-4.750 S0.40
+G1 X-4.500 S0.45
+G1 X-4.250 S0.50
+G1 X-4.000 S0.55
+G1 X-3.750 S0.60
+G1 X-3.500 S0.65
+G1 X-3.250 S0.70
+G1 X-3.000 S0.74
+G1 X-2.750 S0.78
+G1 X-2.500 S0.81
+G1 X-2.250 S0.84
+G1 X-2.000 S0.85
+G1 X-1.750 S0.87
+G1 X-1.500 S0.87
+G1 X-1.250 S0.86
+G1 X-1.000 S0.85
+G1 X-0.750 S0.84
+G1 X-0.500 S0.81
+G1 X-0.250 S0.78
+G1 X0.000 S0.74
+G1 X0.250 S0.70
+G1 X0.500 S0.65
+G1 X0.750 S0.60
+G1 X1.000 S0.55
+G1 X1.250 S0.50
+G1 X1.500 S0.45
+G1 X1.750 S0.40
+G1 X2.000 S0.35
+G1 X2.250 S0.30
+G1 X2.500 S0.26
+G1 X2.750 S0.22
+G1 X3.000 S0.19
+G1 X3.250 S0.16
+G1 X3.500 S0.15
+G1 X3.750 S0.13
+G1 X4.000 S0.13
+G1 X4.250 S0.14
+G1 X4.500 S0.15
+G1 X4.750 S0.17
+G1 X5.000 S0.19
+G1 X5.250 S0.22
+G1 X5.500 S0.26
+G1 X5.750 S0.30
+G1 X6.000 S0.35
+G1 X6.250 S0.40
+G1 X6.500 S0.45
+G1 X6.750 S0.50
+G1 X7.000 S0.55
+G1 X7.250 S0.61
+G1 X7.500 S0.65
+G1 X7.750 S0.70
+G1 X8.000 S0.74
+G1 X8.250 S0.78
+G1 X8.500 S0.81
+G1 X8.750 S0.84
+G1 X9.000 S0.85
+G1 X9.250 S0.87
+G1 X9.500 S0.87
+G1 X9.750 S0.86
+G1 X10.000 S0.85
+G0 X10.000 Y-1.750
+G1 X9.750 S0.91
+G1 X9.500 S0.92
+G1 X9.250 S0.93
+G1 X9.000 S0.92
+G1 X8.750 S0.91
+G1 X8.500 S0.89
+G1 X8.250 S0.86
+G1 X8.000 S0.82
+G1 X7.750 S0.78
+G1 X7.500 S0.73
+G1 X7.250 S0.68
+G1 X7.000 S0.62
+G1 X6.750 S0.56
+G1 X6.500 S0.50
+G1 X6.250 S0.44
+G1 X6.000 S0.38
+G1 X5.750 S0.32
+G1 X5.500 S0.27
+G1 X5.250 S0.22
+G1 X5.000 S0.18
+G1 X4.750 S0.14
+G1 X4.500 S0.11
+G1 X4.250 S0.09
+G1 X4.000 S0.08
+G1 X3.750 S0.07
+G1 X3.500 S0.08
+G1 X3.250 S0.09
+G1 X3.000 S0.11
+G1 X2.750 S0.14
+G1 X2.500 S0.18
+G1 X2.250 S0.22
+G1 X2.000 S0.27
+G1 X1.750 S0.32
+G1 X1.500 S0.38
+G1 X1.250 S0.44
+G1 X1.000 S0.50
+G1 X0.750 S0.56
+G1 X0.500 S0.62
+G1 X0.250 S0.68
+G1 X0.000 S0.73
+G1 X-0.250 S0.78
+G1 X-0.500 S0.82
+G1 X-0.750 S0.86
+G1 X-1.000 S0.89
+G1 X-1.250 S0.91
+G1 X-1.500 S0.92
+G1 X-1.750 S0.93
+G1 X-2.000 S0.92
+G1 X-2.250 S0.91
+G1 X-2.500 S0.89
+G1 X-2.750 S0.86
+G1 X-3.000 S0.82
+G1 X-3.250 S0.78
+G1 X-3.500 S0.73
+G1 X-3.750 S0.68
+G1 X-4.000 S0.62
+G1 X-4.250 S0.56
+G1 X-4.500 S0.50
+G1 X-4.750 S0.44
+G1 X-5.000 S0.38
+G1 X-5.250 S0.32
+G1 X-5.500 S0.27
+G1 X-5.750 S0.22
+G1 X-6.000 S0.18
+G1 X-6.250 S0.14
+G1 X-6.500 S0.11
+G1 X-6.750 S0.09
+G1 X-7.000 S0.08
+G1 X-7.250 S0.07
+G1 X-7.500 S0.08
+G1 X-7.750 S0.09
+G1 X-8.000 S0.11
+G1 X-8.250 S0.14
+G1 X-8.500 S0.18
+G1 X-8.750 S0.22
+G1 X-9.000 S0.27
+G1 X-9.250 S0.32
+G1 X-9.500 S0.38
+G1 X-9.750 S0.44
+G1 X-10.000 S0.50
+G0 X-10.000 Y-1.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.43
+G1 X-9.250 S0.37
+G1 X-9.000 S0.30
+G1 X-8.750 S0.25
+G1 X-8.500 S0.19
+G1 X-8.250 S0.14
+G1 X-8.000 S0.10
+G1 X-7.750 S0.07
+G1 X-7.500 S0.05
+G1 X-7.250 S0.03
+G1 X-7.000 S0.03
+G1 X-6.750 S0.03
+G1 X-6.500 S0.05
+G1 X-6.250 S0.07
+G1 X-6.000 S0.10
+G1 X-5.750 S0.14
+G1 X-5.500 S0.19
+G1 X-5.250 S0.25
+G1 X-5.000 S0.30
+G1 X-4.750 S0.37
+G1 X-4.500 S0.43
+G1 X-4.250 S0.50
+G1 X-4.000 S0.57
+G1 X-3.750 S0.63
+G1 X-3.500 S0.70
+G1 X-3.250 S0.76
+G1 X-3.000 S0.81
+G1 X-2.750 S0.86
+G1 X-2.500 S0.90
+G1 X-2.250 S0.93
+G1 X-2.000 S0.95
+G1 X-1.750 S0.97
+G1 X-1.500 S0.97
+G1 X-1.250 S0.97
+G1 X-1.000 S0.95
+G1 X-0.750 S0.93
+G1 X-0.500 S0.90
+G1 X-0.250 S0.86
+G1 X0.000 S0.81
+G1 X0.250 S0.75
+G1 X0.500 S0.69
+G1 X0.750 S0.63
+G1 X1.000 S0.57
+G1 X1.250 S0.50
+G1 X1.500 S0.43
+G1 X1.750 S0.37
+G1 X2.000 S0.30
+G1 X2.250 S0.24
+G1 X2.500 S0.19
+G1 X2.750 S0.14
+G1 X3.000 S0.10
+G1 X3.250 S0.07
+G1 X3.500 S0.05
+G1 X3.750 S0.03
+G1 X4.000 S0.03
+G1 X4.250 S0.03
+G1 X4.500 S0.05
+G1 X4.750 S0.07
+G1 X5.000 S0.10
+G1 X5.250 S0.15
+G1 X5.500 S0.19
+G1 X5.750 S0.25
+G1 X6.000 S0.31
+G1 X6.250 S0.37
+G1 X6.500 S0.43
+G1 X6.750 S0.50
+G1 X7.000 S0.57
+G1 X7.250 S0.63
+G1 X7.500 S0.70
+G1 X7.750 S0.76
+G1 X8.000 S0.81
+G1 X8.250 S0.86
+G1 X8.500 S0.90
+G1 X8.750 S0.93
+G1 X9.000 S0.95
+G1 X9.250 S0.97
+G1 X9.500 S0.97
+G1 X9.750 S0.97
+G1 X10.000 S0.95
+G0 X10.000 Y-1.250
+G1 X9.750 S0.97
+G1 X9.500 S0.99
+G1 X9.250 S0.99
+G1 X9.000 S0.99
+G1 X8.750 S0.98
+G1 X8.500 S0.95
+G1 X8.250 S0.92
+G1 X8.000 S0.88
+G1 X7.750 S0.83
+G1 X7.500 S0.77
+G1 X7.250 S0.71
+G1 X7.000 S0.64
+G1 X6.750 S0.57
+G1 X6.500 S0.50
+G1 X6.250 S0.43
+G1 X6.000 S0.36
+G1 X5.750 S0.30
+G1 X5.500 S0.23
+G1 X5.250 S0.18
+G1 X5.000 S0.13
+G1 X4.750 S0.08
+G1 X4.500 S0.05
+G1 X4.250 S0.03
+G1 X4.000 S0.01
+G1 X3.750 S0.01
+G1 X3.500 S0.01
+G1 X3.250 S0.02
+G1 X3.000 S0.05
+G1 X2.750 S0.08
+G1 X2.500 S0.12
+G1 X2.250 S0.17
+G1 X2.000 S0.23
+G1 X1.750 S0.29
+G1 X1.500 S0.36
+G1 X1.250 S0.43
+G1 X1.000 S0.50
+G1 X0.750 S0.57
+G1 X0.500 S0.64
+G1 X0.250 S0.70
+G1 X0.000 S0.77
+G1 X-0.250 S0.82
+G1 X-0.500 S0.87
+G1 X-0.750 S0.92
+G1 X-1.000 S0.95
+G1 X-1.250 S0.97
+G1 X-1.500 S0.99
+G1 X-1.750 S0.99
+G1 X-2.000 S0.99
+G1 X-2.250 S0.98
+G1 X-2.500 S0.95
+G1 X-2.750 S0.92
+G1 X-3.000 S0.87
+G1 X-3.250 S0.82
+G1 X-3.500 S0.77
+G1 X-3.750 S0.71
+G1 X-4.000 S0.64
+G1 X-4.250 S0.57
+G1 X-4.500 S0.50
+G1 X-4.750 S0.43
+G1 X-5.000 S0.36
+G1 X-5.250 S0.29
+G1 X-5.500 S0.23
+G1 X-5.750 S0.18
+G1 X-6.000 S0.13
+G1 X-6.250 S0.08
+G1 X-6.500 S0.05
+G1 X-6.750 S0.03
+G1 X-7.000 S0.01
+G1 X-7.250 S0.01
+G1 X-7.500 S0.01
+G1 X-7.750 S0.02
+G1 X-8.000 S0.05
+G1 X-8.250 S0.08
+G1 X-8.500 S0.13
+G1 X-8.750 S0.18
+G1 X-9.000 S0.23
+G1 X-9.250 S0.29
+G1 X-9.500 S0.36
+G1 X-9.750 S0.43
+G1 X-10.000 S0.50
+G0 X-10.000 Y-1.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.43
+G1 X-9.250 S0.36
+G1 X-9.000 S0.29
+G1 X-8.750 S0.23
+G1 X-8.500 S0.17
+G1 X-8.250 S0.12
+G1 X-8.000 S0.08
+G1 X-7.750 S0.05
+G1 X-7.500 S0.02
+G1 X-7.250 S0.01
+G1 X-7.000 S0.00
+G1 X-6.750 S0.01
+G1 X-6.500 S0.02
+G1 X-6.250 S0.05
+G1 X-6.000 S0.08
+G1 X-5.750 S0.12
+G1 X-5.500 S0.17
+G1 X-5.250 S0.23
+G1 X-5.000 S0.29
+G1 X-4.750 S0.36
+G1 X-4.500 S0.43
+G1 X-4.250 S0.50
+G1 X-4.000 S0.57
+G1 X-3.750 S0.64
+G1 X-3.500 S0.71
+G1 X-3.250 S0.77
+G1 X-3.000 S0.83
+G1 X-2.750 S0.88
+G1 X-2.500 S0.92
+G1 X-2.250 S0.95
+G1 X-2.000 S0.98
+G1 X-1.750 S0.99
+G1 X-1.500 S1.00
+G1 X-1.250 S0.99
+G1 X-1.000 S0.98
+G1 X-0.750 S0.95
+G1 X-0.500 S0.92
+G1 X-0.250 S0.88
+G1 X0.000 S0.83
+G1 X0.250 S0.77
+G1 X0.500 S0.71
+G1 X0.750 S0.64
+G1 X1.000 S0.57
+G1 X1.250 S0.50
+G1 X1.500 S0.43
+G1 X1.750 S0.36
+G1 X2.000 S0.29
+G1 X2.250 S0.23
+G1 X2.500 S0.17
+G1 X2.750 S0.12
+G1 X3.000 S0.08
+G1 X3.250 S0.05
+G1 X3.500 S0.02
+G1 X3.750 S0.01
+G1 X4.000 S0.00
+G1 X4.250 S0.01
+G1 X4.500 S0.02
+G1 X4.750 S0.05
+G1 X5.000 S0.08
+G1 X5.250 S0.12
+G1 X5.500 S0.17
+G1 X5.750 S0.23
+G1 X6.000 S0.29
+G1 X6.250 S0.36
+G1 X6.500 S0.43
+G1 X6.750 S0.50
+G1 X7.000 S0.57
+G1 X7.250 S0.64
+G1 X7.500 S0.71
+G1 X7.750 S0.77
+G1 X8.000 S0.83
+G1 X8.250 S0.88
+G1 X8.500 S0.92
+G1 X8.750 S0.95
+G1 X9.000 S0.98
+G1 X9.250 S0.99
+G1 X9.500 S1.00
+G1 X9.750 S0.99
+G1 X10.000 S0.98
+G0 X10.000 Y-0.750
+G1 X9.750 S0.96
+G1 X9.500 S0.98
+G1 X9.250 S0.98
+G1 X9.000 S0.98
+G1 X8.750 S0.96
+G1 X8.500 S0.94
+G1 X8.250 S0.91
+G1 X8.000 S0.87
+G1 X7.750 S0.82
+G1 X7.500 S0.76
+G1 X7.250 S0.70
+G1 X7.000 S0.64
+G1 X6.750 S0.57
+G1 X6.500 S0.50
+G1 X6.250 S0.43
+G1 X6.000 S0.37
+G1 X5.750 S0.30
+G1 X5.500 S0.24
+G1 X5.250 S0.18
+G1 X5.000 S0.14
+G1 X4.750 S0.09
+G1 X4.500 S0.06
+G1 X4.250 S0.04
+G1 X4.000 S0.02
+G1 X3.750 S0.02
+G1 X3.500 S0.02
+G1 X3.250 S0.04
+G1 X3.000 S0.06
+G1 X2.750 S0.09
+G1 X2.500 S0.13
+G1 X2.250 S0.18
+G1 X2.000 S0.24
+G1 X1.750 S0.30
+G1 X1.500 S0.36
+G1 X1.250 S0.43
+G1 X1.000 S0.50
+G1 X0.750 S0.57
+G1 X0.500 S0.64
+G1 X0.250 S0.70
+G1 X0.000 S0.76
+G1 X-0.250 S0.82
+G1 X-0.500 S0.86
+G1 X-0.750 S0.91
+G1 X-1.000 S0.94
+G1 X-1.250 S0.96
+G1 X-1.500 S0.98
+G1 X-1.750 S0.98
+G1 X-2.000 S0.98
+G1 X-2.250 S0.96
+G1 X-2.500 S0.94
+G1 X-2.750 S0.91
+G1 X-3.000 S0.87
+G1 X-3.250 S0.82
+G1 X-3.500 S0.76
+G1 X-3.750 S0.70
+G1 X-4.000 S0.64
+G1 X-4.250 S0.57
+G1 X-4.500 S0.50
+G1 X-4.750 S0.43
+G1 X-5.000 S0.36
+G1 X-5.250 S0.30
+G1 X-5.500 S0.24
+G1 X-5.750 S0.18
+G1 X-6.000 S0.13
+G1 X-6.250 S0.09
+G1 X-6.500 S0.06
+G1 X-6.750 S0.04
+G1 X-7.000 S0.02
+G1 X-7.250 S0.02
+G1 X-7.500 S0.02
+G1 X-7.750 S0.04
+G1 X-8.000 S0.06
+G1 X-8.250 S0.09
+G1 X-8.500 S0.13
+G1 X-8.750 S0.18
+G1 X-9.000 S0.24
+G1 X-9.250 S0.30
+G1 X-9.500 S0.36
+G1 X-9.750 S0.43
+G1 X-10.000 S0.50
+G0 X-10.000 Y-0.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.44
+G1 X-9.250 S0.37
+G1 X-9.000 S0.31
+G1 X-8.750 S0.26
+G1 X-8.500 S0.21
+G1 X-8.250 S0.16
+G1 X-8.000 S0.12
+G1 X-7.750 S0.09
+G1 X-7.500 S0.07
+G1 X-7.250 S0.06
+G1 X-7.000 S0.05
+G1 X-6.750 S0.06
+G1 X-6.500 S0.07
+G1 X-6.250 S0.09
+G1 X-6.000 S0.12
+G1 X-5.750 S0.16
+G1 X-5.500 S0.21
+G1 X-5.250 S0.26
+G1 X-5.000 S0.31
+G1 X-4.750 S0.37
+G1 X-4.500 S0.44
+G1 X-4.250 S0.50
+G1 X-4.000 S0.56
+G1 X-3.750 S0.63
+G1 X-3.500 S0.69
+G1 X-3.250 S0.74
+G1 X-3.000 S0.79
+G1 X-2.750 S0.84
+G1 X-2.500 S0.88
+G1 X-2.250 S0.91
+G1 X-2.000 S0.93
+G1 X-1.750 S0.94
+G1 X-1.500 S0.95
+G1 X-1.250 S0.94
+G1 X-1.000 S0.93
+G1 X-0.750 S0.91
+G1 X-0.500 S0.88
+G1 X-0.250 S0.84
+G1 X0.000 S0.79
+G1 X0.250 S0.74
+G1 X0.500 S0.69
+G1 X0.750 S0.63
+G1 X1.000 S0.56
+G1 X1.250 S0.50
+G1 X1.500 S0.44
+G1 X1.750 S0.37
+G1 X2.000 S0.31
+G1 X2.250 S0.26
+G1 X2.500 S0.21
+G1 X2.750 S0.16
+G1 X3.000 S0.12
+G1 X3.250 S0.09
+G1 X3.500 S0.07
+G1 X3.750 S0.06
+G1 X4.000 S0.05
+G1 X4.250 S0.06
+G1 X4.500 S0.07
+G1 X4.750 S0.09
+G1 X5.000 S0.12
+G1 X5.250 S0.16
+G1 X5.500 S0.21
+G1 X5.750 S0.26
+G1 X6.000 S0.32
+G1 X6.250 S0.38
+G1 X6.500 S0.44
+G1 X6.750 S0.50
+G1 X7.000 S0.57
+G1 X7.250 S0.63
+G1 X7.500 S0.69
+G1 X7.750 S0.74
+G1 X8.000 S0.80
+G1 X8.250 S0.84
+G1 X8.500 S0.88
+G1 X8.750 S0.91
+G1 X9.000 S0.93
+G1 X9.250 S0.94
+G1 X9.500 S0.95
+G1 X9.750 S0.94
+G1 X10.000 S0.93
+G0 X10.000 Y-0.250
+G1 X9.750 S0.88
+G1 X9.500 S0.89
+G1 X9.250 S0.90
+G1 X9.000 S0.89
+G1 X8.750 S0.88
+G1 X8.500 S0.86
+G1 X8.250 S0.83
+G1 X8.000 S0.80
+G1 X7.750 S0.76
+G1 X7.500 S0.72
+G1 X7.250 S0.67
+G1 X7.000 S0.61
+G1 X6.750 S0.56
+G1 X6.500 S0.50
+G1 X6.250 S0.45
+G1 X6.000 S0.39
+G1 X5.750 S0.34
+G1 X5.500 S0.29
+G1 X5.250 S0.24
+G1 X5.000 S0.20
+G1 X4.750 S0.17
+G1 X4.500 S0.14
+G1 X4.250 S0.12
+G1 X4.000 S0.11
+G1 X3.750 S0.10
+G1 X3.500 S0.11
+G1 X3.250 S0.12
+G1 X3.000 S0.14
+G1 X2.750 S0.17
+G1 X2.500 S0.20
+G1 X2.250 S0.24
+G1 X2.000 S0.29
+G1 X1.750 S0.33
+G1 X1.500 S0.39
+G1 X1.250 S0.44
+G1 X1.000 S0.50
+G1 X0.750 S0.56
+G1 X0.500 S0.61
+G1 X0.250 S0.66
+G1 X0.000 S0.71
+G1 X-0.250 S0.76
+G1 X-0.500 S0.80
+G1 X-0.750 S0.83
+G1 X-1.000 S0.86
+G1 X-1.250 S0.88
+G1 X-1.500 S0.89
+G1 X-1.750 S0.90
+G1 X-2.000 S0.89
+G1 X-2.250 S0.88
+G1 X-2.500 S0.86
+G1 X-2.750 S0.83
+G1 X-3.000 S0.80
+G1 X-3.250 S0.76
+G1 X-3.500 S0.71
+G1 X-3.750 S0.66
+G1 X-4.000 S0.61
+G1 X-4.250 S0.56
+G1 X-4.500 S0.50
+G1 X-4.750 S0.44
+G1 X-5.000 S0.39
+G1 X-5.250 S0.34
+G1 X-5.500 S0.29
+G1 X-5.750 S0.24
+G1 X-6.000 S0.20
+G1 X-6.250 S0.17
+G1 X-6.500 S0.14
+G1 X-6.750 S0.12
+G1 X-7.000 S0.11
+G1 X-7.250 S0.10
+G1 X-7.500 S0.11
+G1 X-7.750 S0.12
+G1 X-8.000 S0.14
+G1 X-8.250 S0.17
+G1 X-8.500 S0.20
+G1 X-8.750 S0.24
+G1 X-9.000 S0.29
+G1 X-9.250 S0.34
+G1 X-9.500 S0.39
+G1 X-9.750 S0.44
+G1 X-10.000 S0.50
+G0 X-10.000 Y0.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.45
+G1 X-9.250 S0.41
+G1 X-9.000 S0.36
+G1 X-8.750 S0.32
+G1 X-8.500 S0.29
+G1 X-8.250 S0.25
+G1 X-8.000 S0.22
+G1 X-7.750 S0.20
+G1 X-7.500 S0.19
+G1 X-7.250 S0.18
+G1 X-7.000 S0.17
+G1 X-6.750 S0.18
+G1 X-6.500 S0.19
+G1 X-6.250 S0.20
+G1 X-6.000 S0.23
+G1 X-5.750 S0.25
+G1 X-5.500 S0.29
+G1 X-5.250 S0.32
+G1 X-5.000 S0.36
+G1 X-4.750 S0.41
+G1 X-4.500 S0.45
+G1 X-4.250 S0.50
+G1 X-4.000 S0.55
+G1 X-3.750 S0.59
+G1 X-3.500 S0.64
+G1 X-3.250 S0.68
+G1 X-3.000 S0.71
+G1 X-2.750 S0.75
+G1 X-2.500 S0.78
+G1 X-2.250 S0.80
+G1 X-2.000 S0.81
+G1 X-1.750 S0.82
+G1 X-1.500 S0.83
+G1 X-1.250 S0.82
+G1 X-1.000 S0.81
+G1 X-0.750 S0.80
+G1 X-0.500 S0.77
+G1 X-0.250 S0.75
+G1 X0.000 S0.71
+G1 X0.250 S0.68
+G1 X0.500 S0.64
+G1 X0.750 S0.59
+G1 X1.000 S0.55
+G1 X1.250 S0.50
+G1 X1.500 S0.45
+G1 X1.750 S0.41
+G1 X2.000 S0.36
+G1 X2.250 S0.32
+G1 X2.500 S0.29
+G1 X2.750 S0.25
+G1 X3.000 S0.22
+G1 X3.250 S0.20
+G1 X3.500 S0.19
+G1 X3.750 S0.18
+G1 X4.000 S0.17
+G1 X4.250 S0.18
+G1 X4.500 S0.19
+G1 X4.750 S0.20
+G1 X5.000 S0.23
+G1 X5.250 S0.25
+G1 X5.500 S0.29
+G1 X5.750 S0.32
+G1 X6.000 S0.37
+G1 X6.250 S0.41
+G1 X6.500 S0.45
+G1 X6.750 S0.50
+G1 X7.000 S0.55
+G1 X7.250 S0.59
+G1 X7.500 S0.64
+G1 X7.750 S0.68
+G1 X8.000 S0.72
+G1 X8.250 S0.75
+G1 X8.500 S0.78
+G1 X8.750 S0.80
+G1 X9.000 S0.81
+G1 X9.250 S0.82
+G1 X9.500 S0.83
+G1 X9.750 S0.82
+G1 X10.000 S0.81
+G0 X10.000 Y0.250
+G1 X9.750 S0.73
+G1 X9.500 S0.74
+G1 X9.250 S0.75
+G1 X9.000 S0.74
+G1 X8.750 S0.74
+G1 X8.500 S0.72
+G1 X8.250 S0.71
+G1 X8.000 S0.69
+G1 X7.750 S0.66
+G1 X7.500 S0.63
+G1 X7.250 S0.60
+G1 X7.000 S0.57
+G1 X6.750 S0.54
+G1 X6.500 S0.50
+G1 X6.250 S0.47
+G1 X6.000 S0.43
+G1 X5.750 S0.40
+G1 X5.500 S0.37
+G1 X5.250 S0.34
+G1 X5.000 S0.32
+G1 X4.750 S0.29
+G1 X4.500 S0.28
+G1 X4.250 S0.27
+G1 X4.000 S0.26
+G1 X3.750 S0.25
+G1 X3.500 S0.26
+G1 X3.250 S0.26
+G1 X3.000 S0.28
+G1 X2.750 S0.29
+G1 X2.500 S0.31
+G1 X2.250 S0.34
+G1 X2.000 S0.37
+G1 X1.750 S0.40
+G1 X1.500 S0.43
+G1 X1.250 S0.46
+G1 X1.000 S0.50
+G1 X0.750 S0.53
+G1 X0.500 S0.57
+G1 X0.250 S0.60
+G1 X0.000 S0.63
+G1 X-0.250 S0.66
+G1 X-0.500 S0.68
+G1 X-0.750 S0.71
+G1 X-1.000 S0.72
+G1 X-1.250 S0.74
+G1 X-1.500 S0.74
+G1 X-1.750 S0.75
+G1 X-2.000 S0.74
+G1 X-2.250 S0.74
+G1 X-2.500 S0.72
+G1 X-2.750 S0.71
+G1 X-3.000 S0.69
+G1 X-3.250 S0.66
+G1 X-3.500 S0.63
+G1 X-3.750 S0.60
+G1 X-4.000 S0.57
+G1 X-4.250 S0.54
+G1 X-4.500 S0.50
+G1 X-4.750 S0.47
+G1 X-5.000 S0.43
+G1 X-5.250 S0.40
+G1 X-5.500 S0.37
+G1 X-5.750 S0.34
+G1 X-6.000 S0.31
+G1 X-6.250 S0.29
+G1 X-6.500 S0.28
+G1 X-6.750 S0.26
+G1 X-7.000 S0.26
+G1 X-7.250 S0.25
+G1 X-7.500 S0.26
+G1 X-7.750 S0.26
+G1 X-8.000 S0.28
+G1 X-8.250 S0.29
+G1 X-8.500 S0.31
+G1 X-8.750 S0.34
+G1 X-9.000 S0.37
+G1 X-9.250 S0.40
+G1 X-9.500 S0.43
+G1 X-9.750 S0.47
+G1 X-10.000 S0.50
+G0 X-10.000 Y0.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.48
+G1 X-9.250 S0.46
+G1 X-9.000 S0.44
+G1 X-8.750 S0.42
+G1 X-8.500 S0.40
+G1 X-8.250 S0.38
+G1 X-8.000 S0.37
+G1 X-7.750 S0.36
+G1 X-7.500 S0.35
+G1 X-7.250 S0.35
+G1 X-7.000 S0.35
+G1 X-6.750 S0.35
+G1 X-6.500 S0.35
+G1 X-6.250 S0.36
+G1 X-6.000 S0.37
+G1 X-5.750 S0.38
+G1 X-5.500 S0.40
+G1 X-5.250 S0.42
+G1 X-5.000 S0.44
+G1 X-4.750 S0.46
+G1 X-4.500 S0.48
+G1 X-4.250 S0.50
+G1 X-4.000 S0.52
+G1 X-3.750 S0.54
+G1 X-3.500 S0.56
+G1 X-3.250 S0.58
+G1 X-3.000 S0.60
+G1 X-2.750 S0.62
+G1 X-2.500 S0.63
+G1 X-2.250 S0.64
+G1 X-2.000 S0.65
+G1 X-1.750 S0.65
+G1 X-1.500 S0.65
+G1 X-1.250 S0.65
+G1 X-1.000 S0.65
+G1 X-0.750 S0.64
+G1 X-0.500 S0.63
+G1 X-0.250 S0.62
+G1 X0.000 S0.60
+G1 X0.250 S0.58
+G1 X0.500 S0.56
+G1 X0.750 S0.54
+G1 X1.000 S0.52
+G1 X1.250 S0.50
+G1 X1.500 S0.48
+G1 X1.750 S0.46
+G1 X2.000 S0.44
+G1 X2.250 S0.42
+G1 X2.500 S0.40
+G1 X2.750 S0.38
+G1 X3.000 S0.37
+G1 X3.250 S0.36
+G1 X3.500 S0.35
+G1 X3.750 S0.35
+G1 X4.000 S0.35
+G1 X4.250 S0.35
+G1 X4.500 S0.35
+G1 X4.750 S0.36
+G1 X5.000 S0.37
+G1 X5.250 S0.38
+G1 X5.500 S0.40
+G1 X5.750 S0.42
+G1 X6.000 S0.44
+G1 X6.250 S0.46
+G1 X6.500 S0.48
+G1 X6.750 S0.50
+G1 X7.000 S0.52
+G1 X7.250 S0.54
+G1 X7.500 S0.56
+G1 X7.750 S0.58
+G1 X8.000 S0.60
+G1 X8.250 S0.62
+G1 X8.500 S0.63
+G1 X8.750 S0.64
+G1 X9.000 S0.65
+G1 X9.250 S0.65
+G1 X9.500 S0.65
+G1 X9.750 S0.65
+G1 X10.000 S0.65
+G0 X10.000 Y0.750
+G1 X9.750 S0.55
+G1 X9.500 S0.56
+G1 X9.250 S0.56
+G1 X9.000 S0.56
+G1 X8.750 S0.55
+G1 X8.500 S0.55
+G1 X8.250 S0.55
+G1 X8.000 S0.54
+G1 X7.750 S0.54
+G1 X7.500 S0.53
+G1 X7.250 S0.52
+G1 X7.000 S0.52
+G1 X6.750 S0.51
+G1 X6.500 S0.50
+G1 X6.250 S0.49
+G1 X6.000 S0.48
+G1 X5.750 S0.48
+G1 X5.500 S0.47
+G1 X5.250 S0.46
+G1 X5.000 S0.46
+G1 X4.750 S0.45
+G1 X4.500 S0.45
+G1 X4.250 S0.45
+G1 X4.000 S0.44
+G1 X3.750 S0.44
+G1 X3.500 S0.44
+G1 X3.250 S0.45
+G1 X3.000 S0.45
+G1 X2.750 S0.45
+G1 X2.500 S0.46
+G1 X2.250 S0.46
+G1 X2.000 S0.47
+G1 X1.750 S0.48
+G1 X1.500 S0.48
+G1 X1.250 S0.49
+G1 X1.000 S0.50
+G1 X0.750 S0.51
+G1 X0.500 S0.52
+G1 X0.250 S0.52
+G1 X0.000 S0.53
+G1 X-0.250 S0.54
+G1 X-0.500 S0.54
+G1 X-0.750 S0.55
+G1 X-1.000 S0.55
+G1 X-1.250 S0.55
+G1 X-1.500 S0.56
+G1 X-1.750 S0.56
+G1 X-2.000 S0.56
+G1 X-2.250 S0.55
+G1 X-2.500 S0.55
+G1 X-2.750 S0.55
+G1 X-3.000 S0.54
+G1 X-3.250 S0.54
+G1 X-3.500 S0.53
+G1 X-3.750 S0.52
+G1 X-4.000 S0.52
+G1 X-4.250 S0.51
+G1 X-4.500 S0.50
+G1 X-4.750 S0.49
+G1 X-5.000 S0.48
+G1 X-5.250 S0.48
+G1 X-5.500 S0.47
+G1 X-5.750 S0.46
+G1 X-6.000 S0.46
+G1 X-6.250 S0.45
+G1 X-6.500 S0.45
+G1 X-6.750 S0.45
+G1 X-7.000 S0.44
+G1 X-7.250 S0.44
+G1 X-7.500 S0.44
+G1 X-7.750 S0.45
+G1 X-8.000 S0.45
+G1 X-8.250 S0.45
+G1 X-8.500 S0.46
+G1 X-8.750 S0.46
+G1 X-9.000 S0.47
+G1 X-9.250 S0.48
+G1 X-9.500 S0.48
+G1 X-9.750 S0.49
+G1 X-10.000 S0.50
+G0 X-10.000 Y1.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.51
+G1 X-9.250 S0.51
+G1 X-9.000 S0.52
+G1 X-8.750 S0.52
+G1 X-8.500 S0.53
+G1 X-8.250 S0.53
+G1 X-8.000 S0.54
+G1 X-7.750 S0.54
+G1 X-7.500 S0.54
+G1 X-7.250 S0.54
+G1 X-7.000 S0.54
+G1 X-6.750 S0.54
+G1 X-6.500 S0.54
+G1 X-6.250 S0.54
+G1 X-6.000 S0.54
+G1 X-5.750 S0.53
+G1 X-5.500 S0.53
+G1 X-5.250 S0.52
+G1 X-5.000 S0.52
+G1 X-4.750 S0.51
+G1 X-4.500 S0.51
+G1 X-4.250 S0.50
+G1 X-4.000 S0.49
+G1 X-3.750 S0.49
+G1 X-3.500 S0.48
+G1 X-3.250 S0.48
+G1 X-3.000 S0.47
+G1 X-2.750 S0.47
+G1 X-2.500 S0.46
+G1 X-2.250 S0.46
+G1 X-2.000 S0.46
+G1 X-1.750 S0.46
+G1 X-1.500 S0.46
+G1 X-1.250 S0.46
+G1 X-1.000 S0.46
+G1 X-0.750 S0.46
+G1 X-0.500 S0.46
+G1 X-0.250 S0.47
+G1 X0.000 S0.47
+G1 X0.250 S0.48
+G1 X0.500 S0.48
+G1 X0.750 S0.49
+G1 X1.000 S0.49
+G1 X1.250 S0.50
+G1 X1.500 S0.51
+G1 X1.750 S0.51
+G1 X2.000 S0.52
+G1 X2.250 S0.52
+G1 X2.500 S0.53
+G1 X2.750 S0.53
+G1 X3.000 S0.54
+G1 X3.250 S0.54
+G1 X3.500 S0.54
+G1 X3.750 S0.54
+G1 X4.000 S0.54
+G1 X4.250 S0.54
+G1 X4.500 S0.54
+G1 X4.750 S0.54
+G1 X5.000 S0.54
+G1 X5.250 S0.53
+G1 X5.500 S0.53
+G1 X5.750 S0.52
+G1 X6.000 S0.52
+G1 X6.250 S0.51
+G1 X6.500 S0.51
+G1 X6.750 S0.50
+G1 X7.000 S0.49
+G1 X7.250 S0.49
+G1 X7.500 S0.48
+G1 X7.750 S0.48
+G1 X8.000 S0.47
+G1 X8.250 S0.47
+G1 X8.500 S0.46
+G1 X8.750 S0.46
+G1 X9.000 S0.46
+G1 X9.250 S0.46
+G1 X9.500 S0.46
+G1 X9.750 S0.46
+G1 X10.000 S0.46
+G0 X10.000 Y1.250
+G1 X9.750 S0.36
+G1 X9.500 S0.36
+G1 X9.250 S0.36
+G1 X9.000 S0.36
+G1 X8.750 S0.36
+G1 X8.500 S0.37
+G1 X8.250 S0.38
+G1 X8.000 S0.39
+G1 X7.750 S0.41
+G1 X7.500 S0.42
+G1 X7.250 S0.44
+G1 X7.000 S0.46
+G1 X6.750 S0.48
+G1 X6.500 S0.50
+G1 X6.250 S0.52
+G1 X6.000 S0.54
+G1 X5.750 S0.56
+G1 X5.500 S0.58
+G1 X5.250 S0.59
+G1 X5.000 S0.61
+G1 X4.750 S0.62
+G1 X4.500 S0.63
+G1 X4.250 S0.64
+G1 X4.000 S0.64
+G1 X3.750 S0.64
+G1 X3.500 S0.64
+G1 X3.250 S0.64
+G1 X3.000 S0.63
+G1 X2.750 S0.62
+G1 X2.500 S0.61
+G1 X2.250 S0.59
+G1 X2.000 S0.58
+G1 X1.750 S0.56
+G1 X1.500 S0.54
+G1 X1.250 S0.52
+G1 X1.000 S0.50
+G1 X0.750 S0.48
+G1 X0.500 S0.46
+G1 X0.250 S0.44
+G1 X0.000 S0.42
+G1 X-0.250 S0.41
+G1 X-0.500 S0.39
+G1 X-0.750 S0.38
+G1 X-1.000 S0.37
+G1 X-1.250 S0.36
+G1 X-1.500 S0.36
+G1 X-1.750 S0.36
+G1 X-2.000 S0.36
+G1 X-2.250 S0.36
+G1 X-2.500 S0.37
+G1 X-2.750 S0.38
+G1 X-3.000 S0.39
+G1 X-3.250 S0.41
+G1 X-3.500 S0.42
+G1 X-3.750 S0.44
+G1 X-4.000 S0.46
+G1 X-4.250 S0.48
+G1 X-4.500 S0.50
+G1 X-4.750 S0.52
+G1 X-5.000 S0.54
+G1 X-5.250 S0.56
+G1 X-5.500 S0.58
+G1 X-5.750 S0.59
+G1 X-6.000 S0.61
+G1 X-6.250 S0.62
+G1 X-6.500 S0.63
+G1 X-6.750 S0.64
+G1 X-7.000 S0.64
+G1 X-7.250 S0.64
+G1 X-7.500 S0.64
+G1 X-7.750 S0.64
+G1 X-8.000 S0.63
+G1 X-8.250 S0.62
+G1 X-8.500 S0.61
+G1 X-8.750 S0.59
+G1 X-9.000 S0.58
+G1 X-9.250 S0.56
+G1 X-9.500 S0.54
+G1 X-9.750 S0.52
+G1 X-10.000 S0.50
+G0 X-10.000 Y1.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.53
+G1 X-9.250 S0.57
+G1 X-9.000 S0.60
+G1 X-8.750 S0.63
+G1 X-8.500 S0.65
+G1 X-8.250 S0.68
+G1 X-8.000 S0.70
+G1 X-7.750 S0.71
+G1 X-7.500 S0.72
+G1 X-7.250 S0.73
+G1 X-7.000 S0.73
+G1 X-6.750 S0.73
+G1 X-6.500 S0.72
+G1 X-6.250 S0.71
+G1 X-6.000 S0.70
+G1 X-5.750 S0.68
+G1 X-5.500 S0.65
+G1 X-5.250 S0.63
+G1 X-5.000 S0.60
+G1 X-4.750 S0.57
+G1 X-4.500 S0.53
+G1 X-4.250 S0.50
+G1 X-4.000 S0.47
+G1 X-3.750 S0.43
+G1 X-3.500 S0.40
+G1 X-3.250 S0.37
+G1 X-3.000 S0.35
+G1 X-2.750 S0.32
+G1 X-2.500 S0.30
+G1 X-2.250 S0.29
+G1 X-2.000 S0.28
+G1 X-1.750 S0.27
+G1 X-1.500 S0.27
+G1 X-1.250 S0.27
+G1 X-1.000 S0.28
+G1 X-0.750 S0.29
+G1 X-0.500 S0.30
+G1 X-0.250 S0.32
+G1 X0.000 S0.35
+G1 X0.250 S0.37
+G1 X0.500 S0.40
+G1 X0.750 S0.43
+G1 X1.000 S0.47
+G1 X1.250 S0.50
+G1 X1.500 S0.53
+G1 X1.750 S0.57
+G1 X2.000 S0.60
+G1 X2.250 S0.63
+G1 X2.500 S0.65
+G1 X2.750 S0.68
+G1 X3.000 S0.70
+G1 X3.250 S0.71
+G1 X3.500 S0.72
+G1 X3.750 S0.73
+G1 X4.000 S0.73
+G1 X4.250 S0.73
+G1 X4.500 S0.72
+G1 X4.750 S0.71
+G1 X5.000 S0.70
+G1 X5.250 S0.68
+G1 X5.500 S0.65
+G1 X5.750 S0.63
+G1 X6.000 S0.60
+G1 X6.250 S0.57
+G1 X6.500 S0.53
+G1 X6.750 S0.50
+G1 X7.000 S0.47
+G1 X7.250 S0.43
+G1 X7.500 S0.40
+G1 X7.750 S0.37
+G1 X8.000 S0.35
+G1 X8.250 S0.32
+G1 X8.500 S0.30
+G1 X8.750 S0.29
+G1 X9.000 S0.27
+G1 X9.250 S0.27
+G1 X9.500 S0.27
+G1 X9.750 S0.27
+G1 X10.000 S0.28
+G0 X10.000 Y1.750
+G1 X9.750 S0.20
+G1 X9.500 S0.19
+G1 X9.250 S0.18
+G1 X9.000 S0.19
+G1 X8.750 S0.20
+G1 X8.500 S0.21
+G1 X8.250 S0.23
+G1 X8.000 S0.26
+G1 X7.750 S0.29
+G1 X7.500 S0.33
+G1 X7.250 S0.37
+G1 X7.000 S0.41
+G1 X6.750 S0.45
+G1 X6.500 S0.50
+G1 X6.250 S0.54
+G1 X6.000 S0.59
+G1 X5.750 S0.63
+G1 X5.500 S0.67
+G1 X5.250 S0.71
+G1 X5.000 S0.74
+G1 X4.750 S0.77
+G1 X4.500 S0.79
+G1 X4.250 S0.80
+G1 X4.000 S0.81
+G1 X3.750 S0.82
+G1 X3.500 S0.81
+G1 X3.250 S0.80
+G1 X3.000 S0.79
+G1 X2.750 S0.77
+G1 X2.500 S0.74
+G1 X2.250 S0.71
+G1 X2.000 S0.67
+G1 X1.750 S0.63
+G1 X1.500 S0.59
+G1 X1.250 S0.55
+G1 X1.000 S0.50
+G1 X0.750 S0.46
+G1 X0.500 S0.41
+G1 X0.250 S0.37
+G1 X0.000 S0.33
+G1 X-0.250 S0.29
+G1 X-0.500 S0.26
+G1 X-0.750 S0.23
+G1 X-1.000 S0.21
+G1 X-1.250 S0.20
+G1 X-1.500 S0.19
+G1 X-1.750 S0.18
+G1 X-2.000 S0.19
+G1 X-2.250 S0.20
+G1 X-2.500 S0.21
+G1 X-2.750 S0.23
+G1 X-3.000 S0.26
+G1 X-3.250 S0.29
+G1 X-3.500 S0.33
+G1 X-3.750 S0.37
+G1 X-4.000 S0.41
+G1 X-4.250 S0.45
+G1 X-4.500 S0.50
+G1 X-4.750 S0.54
+G1 X-5.000 S0.59
+G1 X-5.250 S0.63
+G1 X-5.500 S0.67
+G1 X-5.750 S0.71
+G1 X-6.000 S0.74
+G1 X-6.250 S0.77
+G1 X-6.500 S0.79
+G1 X-6.750 S0.80
+G1 X-7.000 S0.81
+G1 X-7.250 S0.82
+G1 X-7.500 S0.81
+G1 X-7.750 S0.80
+G1 X-8.000 S0.79
+G1 X-8.250 S0.77
+G1 X-8.500 S0.74
+G1 X-8.750 S0.71
+G1 X-9.000 S0.67
+G1 X-9.250 S0.63
+G1 X-9.500 S0.59
+G1 X-9.750 S0.55
+G1 X-10.000 S0.50
+G0 X-10.000 Y2.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.56
+G1 X-9.250 S0.61
+G1 X-9.000 S0.66
+G1 X-8.750 S0.71
+G1 X-8.500 S0.75
+G1 X-8.250 S0.79
+G1 X-8.000 S0.83
+G1 X-7.750 S0.85
+G1 X-7.500 S0.87
+G1 X-7.250 S0.88
+G1 X-7.000 S0.89
+G1 X-6.750 S0.88
+G1 X-6.500 S0.87
+G1 X-6.250 S0.85
+G1 X-6.000 S0.83
+G1 X-5.750 S0.79
+G1 X-5.500 S0.75
+G1 X-5.250 S0.71
+G1 X-5.000 S0.66
+G1 X-4.750 S0.61
+G1 X-4.500 S0.55
+G1 X-4.250 S0.50
+G1 X-4.000 S0.44
+G1 X-3.750 S0.39
+G1 X-3.500 S0.34
+G1 X-3.250 S0.29
+G1 X-3.000 S0.25
+G1 X-2.750 S0.21
+G1 X-2.500 S0.17
+G1 X-2.250 S0.15
+G1 X-2.000 S0.13
+G1 X-1.750 S0.12
+G1 X-1.500 S0.11
+G1 X-1.250 S0.12
+G1 X-1.000 S0.13
+G1 X-0.750 S0.15
+G1 X-0.500 S0.17
+G1 X-0.250 S0.21
+G1 X0.000 S0.25
+G1 X0.250 S0.29
+G1 X0.500 S0.34
+G1 X0.750 S0.39
+G1 X1.000 S0.45
+G1 X1.250 S0.50
+G1 X1.500 S0.56
+G1 X1.750 S0.61
+G1 X2.000 S0.66
+G1 X2.250 S0.71
+G1 X2.500 S0.75
+G1 X2.750 S0.79
+G1 X3.000 S0.83
+G1 X3.250 S0.85
+G1 X3.500 S0.87
+G1 X3.750 S0.88
+G1 X4.000 S0.89
+G1 X4.250 S0.88
+G1 X4.500 S0.87
+G1 X4.750 S0.85
+G1 X5.000 S0.83
+G1 X5.250 S0.79
+G1 X5.500 S0.75
+G1 X5.750 S0.71
+G1 X6.000 S0.66
+G1 X6.250 S0.61
+G1 X6.500 S0.55
+G1 X6.750 S0.50
+G1 X7.000 S0.44
+G1 X7.250 S0.39
+G1 X7.500 S0.34
+G1 X7.750 S0.29
+G1 X8.000 S0.24
+G1 X8.250 S0.21
+G1 X8.500 S0.17
+G1 X8.750 S0.15
+G1 X9.000 S0.13
+G1 X9.250 S0.12
+G1 X9.500 S0.11
+G1 X9.750 S0.12
+G1 X10.000 S0.13
+G0 X10.000 Y2.250
+G1 X9.750 S0.08
+G1 X9.500 S0.06
+G1 X9.250 S0.06
+G1 X9.000 S0.06
+G1 X8.750 S0.07
+G1 X8.500 S0.10
+G1 X8.250 S0.13
+G1 X8.000 S0.16
+G1 X7.750 S0.21
+G1 X7.500 S0.26
+G1 X7.250 S0.31
+G1 X7.000 S0.37
+G1 X6.750 S0.44
+G1 X6.500 S0.50
+G1 X6.250 S0.56
+G1 X6.000 S0.62
+G1 X5.750 S0.68
+G1 X5.500 S0.74
+G1 X5.250 S0.79
+G1 X5.000 S0.83
+G1 X4.750 S0.87
+G1 X4.500 S0.90
+G1 X4.250 S0.92
+G1 X4.000 S0.94
+G1 X3.750 S0.94
+G1 X3.500 S0.94
+G1 X3.250 S0.93
+G1 X3.000 S0.90
+G1 X2.750 S0.87
+G1 X2.500 S0.84
+G1 X2.250 S0.79
+G1 X2.000 S0.74
+G1 X1.750 S0.69
+G1 X1.500 S0.63
+G1 X1.250 S0.56
+G1 X1.000 S0.50
+G1 X0.750 S0.44
+G1 X0.500 S0.38
+G1 X0.250 S0.32
+G1 X0.000 S0.26
+G1 X-0.250 S0.21
+G1 X-0.500 S0.17
+G1 X-0.750 S0.13
+G1 X-1.000 S0.10
+G1 X-1.250 S0.08
+G1 X-1.500 S0.06
+G1 X-1.750 S0.06
+G1 X-2.000 S0.06
+G1 X-2.250 S0.07
+G1 X-2.500 S0.10
+G1 X-2.750 S0.13
+G1 X-3.000 S0.16
+G1 X-3.250 S0.21
+G1 X-3.500 S0.26
+G1 X-3.750 S0.32
+G1 X-4.000 S0.37
+G1 X-4.250 S0.44
+G1 X-4.500 S0.50
+G1 X-4.750 S0.56
+G1 X-5.000 S0.62
+G1 X-5.250 S0.68
+G1 X-5.500 S0.74
+G1 X-5.750 S0.79
+G1 X-6.000 S0.83
+G1 X-6.250 S0.87
+G1 X-6.500 S0.90
+G1 X-6.750 S0.92
+G1 X-7.000 S0.94
+G1 X-7.250 S0.94
+G1 X-7.500 S0.94
+G1 X-7.750 S0.92
+G1 X-8.000 S0.90
+G1 X-8.250 S0.87
+G1 X-8.500 S0.83
+G1 X-8.750 S0.79
+G1 X-9.000 S0.74
+G1 X-9.250 S0.68
+G1 X-9.500 S0.62
+G1 X-9.750 S0.56
+G1 X-10.000 S0.50
+G0 X-10.000 Y2.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.57
+G1 X-9.250 S0.64
+G1 X-9.000 S0.70
+G1 X-8.750 S0.76
+G1 X-8.500 S0.81
+G1 X-8.250 S0.86
+G1 X-8.000 S0.90
+G1 X-7.750 S0.94
+G1 X-7.500 S0.96
+G1 X-7.250 S0.98
+G1 X-7.000 S0.98
+G1 X-6.750 S0.98
+G1 X-6.500 S0.96
+G1 X-6.250 S0.94
+G1 X-6.000 S0.90
+G1 X-5.750 S0.86
+G1 X-5.500 S0.81
+G1 X-5.250 S0.76
+G1 X-5.000 S0.70
+G1 X-4.750 S0.63
+G1 X-4.500 S0.57
+G1 X-4.250 S0.50
+G1 X-4.000 S0.43
+G1 X-3.750 S0.36
+G1 X-3.500 S0.30
+G1 X-3.250 S0.24
+G1 X-3.000 S0.19
+G1 X-2.750 S0.14
+G1 X-2.500 S0.10
+G1 X-2.250 S0.06
+G1 X-2.000 S0.04
+G1 X-1.750 S0.02
+G1 X-1.500 S0.02
+G1 X-1.250 S0.02
+G1 X-1.000 S0.04
+G1 X-0.750 S0.06
+G1 X-0.500 S0.10
+G1 X-0.250 S0.14
+G1 X0.000 S0.19
+G1 X0.250 S0.24
+G1 X0.500 S0.30
+G1 X0.750 S0.37
+G1 X1.000 S0.43
+G1 X1.250 S0.50
+G1 X1.500 S0.57
+G1 X1.750 S0.64
+G1 X2.000 S0.70
+G1 X2.250 S0.76
+G1 X2.500 S0.82
+G1 X2.750 S0.86
+G1 X3.000 S0.90
+G1 X3.250 S0.94
+G1 X3.500 S0.96
+G1 X3.750 S0.98
+G1 X4.000 S0.98
+G1 X4.250 S0.97
+G1 X4.500 S0.96
+G1 X4.750 S0.94
+G1 X5.000 S0.90
+G1 X5.250 S0.86
+G1 X5.500 S0.81
+G1 X5.750 S0.76
+G1 X6.000 S0.70
+G1 X6.250 S0.63
+G1 X6.500 S0.57
+G1 X6.750 S0.50
+G1 X7.000 S0.43
+G1 X7.250 S0.36
+G1 X7.500 S0.30
+G1 X7.750 S0.24
+G1 X8.000 S0.18
+G1 X8.250 S0.14
+G1 X8.500 S0.10
+G1 X8.750 S0.06
+G1 X9.000 S0.04
+G1 X9.250 S0.02
+G1 X9.500 S0.02
+G1 X9.750 S0.03
+G1 X10.000 S0.04
+G0 X10.000 Y2.750
+G1 X9.750 S0.02
+G1 X9.500 S0.01
+G1 X9.250 S0.00
+G1 X9.000 S0.01
+G1 X8.750 S0.02
+G1 X8.500 S0.05
+G1 X8.250 S0.08
+G1 X8.000 S0.12
+G1 X7.750 S0.17
+G1 X7.500 S0.23
+G1 X7.250 S0.29
+G1 X7.000 S0.36
+G1 X6.750 S0.43
+G1 X6.500 S0.50
+G1 X6.250 S0.57
+G1 X6.000 S0.64
+G1 X5.750 S0.71
+G1 X5.500 S0.77
+G1 X5.250 S0.82
+G1 X5.000 S0.88
+G1 X4.750 S0.92
+G1 X4.500 S0.95
+G1 X4.250 S0.98
+G1 X4.000 S0.99
+G1 X3.750 S1.00
+G1 X3.500 S0.99
+G1 X3.250 S0.98
+G1 X3.000 S0.95
+G1 X2.750 S0.92
+G1 X2.500 S0.88
+G1 X2.250 S0.83
+G1 X2.000 S0.77
+G1 X1.750 S0.71
+G1 X1.500 S0.64
+G1 X1.250 S0.57
+G1 X1.000 S0.50
+G1 X0.750 S0.43
+G1 X0.500 S0.36
+G1 X0.250 S0.29
+G1 X0.000 S0.23
+G1 X-0.250 S0.17
+G1 X-0.500 S0.12
+G1 X-0.750 S0.08
+G1 X-1.000 S0.05
+G1 X-1.250 S0.02
+G1 X-1.500 S0.01
+G1 X-1.750 S0.00
+G1 X-2.000 S0.01
+G1 X-2.250 S0.02
+G1 X-2.500 S0.05
+G1 X-2.750 S0.08
+G1 X-3.000 S0.12
+G1 X-3.250 S0.17
+G1 X-3.500 S0.23
+G1 X-3.750 S0.29
+G1 X-4.000 S0.36
+G1 X-4.250 S0.43
+G1 X-4.500 S0.50
+G1 X-4.750 S0.57
+G1 X-5.000 S0.64
+G1 X-5.250 S0.71
+G1 X-5.500 S0.77
+G1 X-5.750 S0.83
+G1 X-6.000 S0.88
+G1 X-6.250 S0.92
+G1 X-6.500 S0.95
+G1 X-6.750 S0.98
+G1 X-7.000 S0.99
+G1 X-7.250 S1.00
+G1 X-7.500 S0.99
+G1 X-7.750 S0.98
+G1 X-8.000 S0.95
+G1 X-8.250 S0.92
+G1 X-8.500 S0.88
+G1 X-8.750 S0.83
+G1 X-9.000 S0.77
+G1 X-9.250 S0.71
+G1 X-9.500 S0.64
+G1 X-9.750 S0.57
+G1 X-10.000 S0.50
+G0 X-10.000 Y3.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.57
+G1 X-9.250 S0.64
+G1 X-9.000 S0.71
+G1 X-8.750 S0.77
+G1 X-8.500 S0.83
+G1 X-8.250 S0.88
+G1 X-8.000 S0.92
+G1 X-7.750 S0.95
+G1 X-7.500 S0.98
+G1 X-7.250 S0.99
+G1 X-7.000 S1.00
+G1 X-6.750 S0.99
+G1 X-6.500 S0.98
+G1 X-6.250 S0.95
+G1 X-6.000 S0.92
+G1 X-5.750 S0.88
+G1 X-5.500 S0.82
+G1 X-5.250 S0.77
+G1 X-5.000 S0.71
+G1 X-4.750 S0.64
+G1 X-4.500 S0.57
+G1 X-4.250 S0.50
+G1 X-4.000 S0.43
+G1 X-3.750 S0.36
+G1 X-3.500 S0.29
+G1 X-3.250 S0.23
+G1 X-3.000 S0.17
+G1 X-2.750 S0.12
+G1 X-2.500 S0.08
+G1 X-2.250 S0.05
+G1 X-2.000 S0.02
+G1 X-1.750 S0.01
+G1 X-1.500 S0.00
+G1 X-1.250 S0.01
+G1 X-1.000 S0.02
+G1 X-0.750 S0.05
+G1 X-0.500 S0.08
+G1 X-0.250 S0.13
+G1 X0.000 S0.18
+G1 X0.250 S0.23
+G1 X0.500 S0.29
+G1 X0.750 S0.36
+G1 X1.000 S0.43
+G1 X1.250 S0.50
+G1 X1.500 S0.57
+G1 X1.750 S0.64
+G1 X2.000 S0.71
+G1 X2.250 S0.77
+G1 X2.500 S0.83
+G1 X2.750 S0.88
+G1 X3.000 S0.92
+G1 X3.250 S0.95
+G1 X3.500 S0.98
+G1 X3.750 S0.99
+G1 X4.000 S1.00
+G1 X4.250 S0.99
+G1 X4.500 S0.98
+G1 X4.750 S0.95
+G1 X5.000 S0.92
+G1 X5.250 S0.87
+G1 X5.500 S0.82
+G1 X5.750 S0.77
+G1 X6.000 S0.70
+G1 X6.250 S0.64
+G1 X6.500 S0.57
+G1 X6.750 S0.50
+G1 X7.000 S0.43
+G1 X7.250 S0.36
+G1 X7.500 S0.29
+G1 X7.750 S0.23
+G1 X8.000 S0.17
+G1 X8.250 S0.12
+G1 X8.500 S0.08
+G1 X8.750 S0.05
+G1 X9.000 S0.02
+G1 X9.250 S0.01
+G1 X9.500 S0.00
+G1 X9.750 S0.01
+G1 X10.000 S0.02
+G0 X10.000 Y3.250
+G1 X9.750 S0.04
+G1 X9.500 S0.03
+G1 X9.250 S0.02
+G1 X9.000 S0.03
+G1 X8.750 S0.04
+G1 X8.500 S0.07
+G1 X8.250 S0.10
+G1 X8.000 S0.14
+G1 X7.750 S0.19
+G1 X7.500 S0.24
+G1 X7.250 S0.30
+G1 X7.000 S0.36
+G1 X6.750 S0.43
+G1 X6.500 S0.50
+G1 X6.250 S0.57
+G1 X6.000 S0.63
+G1 X5.750 S0.70
+G1 X5.500 S0.76
+G1 X5.250 S0.81
+G1 X5.000 S0.86
+G1 X4.750 S0.90
+G1 X4.500 S0.93
+G1 X4.250 S0.96
+G1 X4.000 S0.97
+G1 X3.750 S0.98
+G1 X3.500 S0.97
+G1 X3.250 S0.96
+G1 X3.000 S0.93
+G1 X2.750 S0.90
+G1 X2.500 S0.86
+G1 X2.250 S0.81
+G1 X2.000 S0.76
+G1 X1.750 S0.70
+G1 X1.500 S0.64
+G1 X1.250 S0.57
+G1 X1.000 S0.50
+G1 X0.750 S0.43
+G1 X0.500 S0.37
+G1 X0.250 S0.30
+G1 X0.000 S0.24
+G1 X-0.250 S0.19
+G1 X-0.500 S0.14
+G1 X-0.750 S0.10
+G1 X-1.000 S0.07
+G1 X-1.250 S0.04
+G1 X-1.500 S0.03
+G1 X-1.750 S0.02
+G1 X-2.000 S0.03
+G1 X-2.250 S0.04
+G1 X-2.500 S0.07
+G1 X-2.750 S0.10
+G1 X-3.000 S0.14
+G1 X-3.250 S0.19
+G1 X-3.500 S0.24
+G1 X-3.750 S0.30
+G1 X-4.000 S0.37
+G1 X-4.250 S0.43
+G1 X-4.500 S0.50
+G1 X-4.750 S0.57
+G1 X-5.000 S0.63
+G1 X-5.250 S0.70
+G1 X-5.500 S0.76
+G1 X-5.750 S0.81
+G1 X-6.000 S0.86
+G1 X-6.250 S0.90
+G1 X-6.500 S0.93
+G1 X-6.750 S0.96
+G1 X-7.000 S0.97
+G1 X-7.250 S0.98
+G1 X-7.500 S0.97
+G1 X-7.750 S0.96
+G1 X-8.000 S0.93
+G1 X-8.250 S0.90
+G1 X-8.500 S0.86
+G1 X-8.750 S0.81
+G1 X-9.000 S0.76
+G1 X-9.250 S0.70
+G1 X-9.500 S0.63
+G1 X-9.750 S0.57
+G1 X-10.000 S0.50
+G0 X-10.000 Y3.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.56
+G1 X-9.250 S0.62
+G1 X-9.000 S0.68
+G1 X-8.750 S0.74
+G1 X-8.500 S0.78
+G1 X-8.250 S0.83
+G1 X-8.000 S0.87
+G1 X-7.750 S0.90
+G1 X-7.500 S0.92
+G1 X-7.250 S0.93
+G1 X-7.000 S0.93
+G1 X-6.750 S0.93
+G1 X-6.500 S0.92
+G1 X-6.250 S0.90
+G1 X-6.000 S0.87
+G1 X-5.750 S0.83
+G1 X-5.500 S0.78
+G1 X-5.250 S0.73
+G1 X-5.000 S0.68
+G1 X-4.750 S0.62
+G1 X-4.500 S0.56
+G1 X-4.250 S0.50
+G1 X-4.000 S0.44
+G1 X-3.750 S0.38
+G1 X-3.500 S0.32
+G1 X-3.250 S0.26
+G1 X-3.000 S0.21
+G1 X-2.750 S0.17
+G1 X-2.500 S0.13
+G1 X-2.250 S0.10
+G1 X-2.000 S0.08
+G1 X-1.750 S0.07
+G1 X-1.500 S0.07
+G1 X-1.250 S0.07
+G1 X-1.000 S0.08
+G1 X-0.750 S0.10
+G1 X-0.500 S0.13
+G1 X-0.250 S0.17
+G1 X0.000 S0.22
+G1 X0.250 S0.27
+G1 X0.500 S0.32
+G1 X0.750 S0.38
+G1 X1.000 S0.44
+G1 X1.250 S0.50
+G1 X1.500 S0.56
+G1 X1.750 S0.62
+G1 X2.000 S0.68
+G1 X2.250 S0.74
+G1 X2.500 S0.79
+G1 X2.750 S0.83
+G1 X3.000 S0.87
+G1 X3.250 S0.90
+G1 X3.500 S0.92
+G1 X3.750 S0.93
+G1 X4.000 S0.93
+G1 X4.250 S0.93
+G1 X4.500 S0.92
+G1 X4.750 S0.89
+G1 X5.000 S0.86
+G1 X5.250 S0.83
+G1 X5.500 S0.78
+G1 X5.750 S0.73
+G1 X6.000 S0.68
+G1 X6.250 S0.62
+G1 X6.500 S0.56
+G1 X6.750 S0.50
+G1 X7.000 S0.44
+G1 X7.250 S0.38
+G1 X7.500 S0.32
+G1 X7.750 S0.26
+G1 X8.000 S0.21
+G1 X8.250 S0.17
+G1 X8.500 S0.13
+G1 X8.750 S0.10
+G1 X9.000 S0.08
+G1 X9.250 S0.07
+G1 X9.500 S0.07
+G1 X9.750 S0.07
+G1 X10.000 S0.08
+G0 X10.000 Y3.750
+G1 X9.750 S0.14
+G1 X9.500 S0.13
+G1 X9.250 S0.12
+G1 X9.000 S0.13
+G1 X8.750 S0.14
+G1 X8.500 S0.16
+G1 X8.250 S0.18
+G1 X8.000 S0.21
+G1 X7.750 S0.25
+G1 X7.500 S0.29
+G1 X7.250 S0.34
+G1 X7.000 S0.39
+G1 X6.750 S0.44
+G1 X6.500 S0.50
+G1 X6.250 S0.55
+G1 X6.000 S0.60
+G1 X5.750 S0.66
+G1 X5.500 S0.70
+G1 X5.250 S0.75
+G1 X5.000 S0.78
+G1 X4.750 S0.82
+G1 X4.500 S0.84
+G1 X4.250 S0.86
+G1 X4.000 S0.87
+G1 X3.750 S0.88
+G1 X3.500 S0.87
+G1 X3.250 S0.86
+G1 X3.000 S0.84
+G1 X2.750 S0.82
+G1 X2.500 S0.79
+G1 X2.250 S0.75
+G1 X2.000 S0.70
+G1 X1.750 S0.66
+G1 X1.500 S0.61
+G1 X1.250 S0.55
+G1 X1.000 S0.50
+G1 X0.750 S0.45
+G1 X0.500 S0.39
+G1 X0.250 S0.34
+G1 X0.000 S0.30
+G1 X-0.250 S0.25
+G1 X-0.500 S0.22
+G1 X-0.750 S0.18
+G1 X-1.000 S0.16
+G1 X-1.250 S0.14
+G1 X-1.500 S0.13
+G1 X-1.750 S0.12
+G1 X-2.000 S0.13
+G1 X-2.250 S0.14
+G1 X-2.500 S0.16
+G1 X-2.750 S0.18
+G1 X-3.000 S0.21
+G1 X-3.250 S0.25
+G1 X-3.500 S0.30
+G1 X-3.750 S0.34
+G1 X-4.000 S0.39
+G1 X-4.250 S0.45
+G1 X-4.500 S0.50
+G1 X-4.750 S0.55
+G1 X-5.000 S0.61
+G1 X-5.250 S0.66
+G1 X-5.500 S0.70
+G1 X-5.750 S0.75
+G1 X-6.000 S0.78
+G1 X-6.250 S0.82
+G1 X-6.500 S0.84
+G1 X-6.750 S0.86
+G1 X-7.000 S0.87
+G1 X-7.250 S0.88
+G1 X-7.500 S0.87
+G1 X-7.750 S0.86
+G1 X-8.000 S0.84
+G1 X-8.250 S0.82
+G1 X-8.500 S0.78
+G1 X-8.750 S0.75
+G1 X-9.000 S0.70
+G1 X-9.250 S0.66
+G1 X-9.500 S0.61
+G1 X-9.750 S0.55
+G1 X-10.000 S0.50
+G0 X-10.000 Y4.000
+G1 X-9.750 S0.50
+G1 X-9.500 S0.54
+G1 X-9.250 S0.59
+G1 X-9.000 S0.63
+G1 X-8.750 S0.66
+G1 X-8.500 S0.70
+G1 X-8.250 S0.73
+G1 X-8.000 S0.76
+G1 X-7.750 S0.78
+G1 X-7.500 S0.79
+G1 X-7.250 S0.80
+G1 X-7.000 S0.80
+G1 X-6.750 S0.80
+G1 X-6.500 S0.79
+G1 X-6.250 S0.78
+G1 X-6.000 S0.76
+G1 X-5.750 S0.73
+G1 X-5.500 S0.70
+G1 X-5.250 S0.66
+G1 X-5.000 S0.63
+G1 X-4.750 S0.59
+G1 X-4.500 S0.54
+G1 X-4.250 S0.50
+G1 X-4.000 S0.46
+G1 X-3.750 S0.41
+G1 X-3.500 S0.37
+G1 X-3.250 S0.34
+G1 X-3.000 S0.30
+G1 X-2.750 S0.27
+G1 X-2.500 S0.24
+G1 X-2.250 S0.22
+G1 X-2.000 S0.21
+G1 X-1.750 S0.20
+G1 X-1.500 S0.20
+G1 X-1.250 S0.20
+G1 X-1.000 S0.21
+G1 X-0.750 S0.22
+G1 X-0.500 S0.24
+G1 X-0.250 S0.27
+G1 X0.000 S0.30
+G1 X0.250 S0.34
+G1 X0.500 S0.37
+G1 X0.750 S0.42
+G1 X1.000 S0.46
+G1 X1.250 S0.50
+G1 X1.500 S0.54
+G1 X1.750 S0.59
+G1 X2.000 S0.63
+G1 X2.250 S0.67
+G1 X2.500 S0.70
+G1 X2.750 S0.73
+G1 X3.000 S0.76
+G1 X3.250 S0.78
+G1 X3.500 S0.79
+G1 X3.750 S0.80
+G1 X4.000 S0.80
+G1 X4.250 S0.80
+G1 X4.500 S0.79
+G1 X4.750 S0.78
+G1 X5.000 S0.76
+G1 X5.250 S0.73
+G1 X5.500 S0.70
+G1 X5.750 S0.66
+G1 X6.000 S0.63
+G1 X6.250 S0.58
+G1 X6.500 S0.54
+G1 X6.750 S0.50
+G1 X7.000 S0.46
+G1 X7.250 S0.41
+G1 X7.500 S0.37
+G1 X7.750 S0.33
+G1 X8.000 S0.30
+G1 X8.250 S0.27
+G1 X8.500 S0.24
+G1 X8.750 S0.22
+G1 X9.000 S0.21
+G1 X9.250 S0.20
+G1 X9.500 S0.20
+G1 X9.750 S0.20
+G1 X10.000 S0.21
+G0 X10.000 Y4.250
+G1 X9.750 S0.29
+G1 X9.500 S0.28
+G1 X9.250 S0.28
+G1 X9.000 S0.28
+G1 X8.750 S0.29
+G1 X8.500 S0.30
+G1 X8.250 S0.32
+G1 X8.000 S0.33
+G1 X7.750 S0.36
+G1 X7.500 S0.38
+G1 X7.250 S0.41
+G1 X7.000 S0.44
+G1 X6.750 S0.47
+G1 X6.500 S0.50
+G1 X6.250 S0.53
+G1 X6.000 S0.56
+G1 X5.750 S0.59
+G1 X5.500 S0.62
+G1 X5.250 S0.64
+G1 X5.000 S0.67
+G1 X4.750 S0.68
+G1 X4.500 S0.70
+G1 X4.250 S0.71
+G1 X4.000 S0.72
+G1 X3.750 S0.72
+G1 X3.500 S0.72
+G1 X3.250 S0.71
+G1 X3.000 S0.70
+G1 X2.750 S0.68
+G1 X2.500 S0.67
+G1 X2.250 S0.64
+G1 X2.000 S0.62
+G1 X1.750 S0.59
+G1 X1.500 S0.56
+G1 X1.250 S0.53
+G1 X1.000 S0.50
+G1 X0.750 S0.47
+G1 X0.500 S0.44
+G1 X0.250 S0.41
+G1 X0.000 S0.38
+G1 X-0.250 S0.36
+G1 X-0.500 S0.33
+G1 X-0.750 S0.32
+G1 X-1.000 S0.30
+G1 X-1.250 S0.29
+G1 X-1.500 S0.28
+G1 X-1.750 S0.28
+G1 X-2.000 S0.28
+G1 X-2.250 S0.29
+G1 X-2.500 S0.30
+G1 X-2.750 S0.32
+G1 X-3.000 S0.33
+G1 X-3.250 S0.36
+G1 X-3.500 S0.38
+G1 X-3.750 S0.41
+G1 X-4.000 S0.44
+G1 X-4.250 S0.47
+G1 X-4.500 S0.50
+G1 X-4.750 S0.53
+G1 X-5.000 S0.56
+G1 X-5.250 S0.59
+G1 X-5.500 S0.62
+G1 X-5.750 S0.64
+G1 X-6.000 S0.67
+G1 X-6.250 S0.68
+G1 X-6.500 S0.70
+G1 X-6.750 S0.71
+G1 X-7.000 S0.72
+G1 X-7.250 S0.72
+G1 X-7.500 S0.72
+G1 X-7.750 S0.71
+G1 X-8.000 S0.70
+G1 X-8.250 S0.68
+G1 X-8.500 S0.67
+G1 X-8.750 S0.64
+G1 X-9.000 S0.62
+G1 X-9.250 S0.59
+G1 X-9.500 S0.56
+G1 X-9.750 S0.53
+G1 X-10.000 S0.50
+G0 X-10.000 Y4.500
+G1 X-9.750 S0.50
+G1 X-9.500 S0.52
+G1 X-9.250 S0.54
+G1 X-9.000 S0.55
+G1 X-8.750 S0.57
+G1 X-8.500 S0.58
+G1 X-8.250 S0.59
+G1 X-8.000 S0.61
+G1 X-7.750 S0.61
+G1 X-7.500 S0.62
+G1 X-7.250 S0.62
+G1 X-7.000 S0.63
+G1 X-6.750 S0.62
+G1 X-6.500 S0.62
+G1 X-6.250 S0.61
+G1 X-6.000 S0.61
+G1 X-5.750 S0.59
+G1 X-5.500 S0.58
+G1 X-5.250 S0.57
+G1 X-5.000 S0.55
+G1 X-4.750 S0.54
+G1 X-4.500 S0.52
+G1 X-4.250 S0.50
+G1 X-4.000 S0.48
+G1 X-3.750 S0.46
+G1 X-3.500 S0.45
+G1 X-3.250 S0.43
+G1 X-3.000 S0.42
+G1 X-2.750 S0.40
+G1 X-2.500 S0.39
+G1 X-2.250 S0.39
+G1 X-2.000 S0.38
+G1 X-1.750 S0.38
+G1 X-1.500 S0.37
+G1 X-1.250 S0.38
+G1 X-1.000 S0.38
+G1 X-0.750 S0.39
+G1 X-0.500 S0.39
+G1 X-0.250 S0.41
+G1 X0.000 S0.42
+G1 X0.250 S0.43
+G1 X0.500 S0.45
+G1 X0.750 S0.46
+G1 X1.000 S0.48
+G1 X1.250 S0.50
+G1 X1.500 S0.52
+G1 X1.750 S0.54
+G1 X2.000 S0.55
+G1 X2.250 S0.57
+G1 X2.500 S0.58
+G1 X2.750 S0.60
+G1 X3.000 S0.61
+G1 X3.250 S0.61
+G1 X3.500 S0.62
+G1 X3.750 S0.62
+G1 X4.000 S0.63
+G1 X4.250 S0.62
+G1 X4.500 S0.62
+G1 X4.750 S0.61
+G1 X5.000 S0.61
+G1 X5.250 S0.59
+G1 X5.500 S0.58
+G1 X5.750 S0.57
+G1 X6.000 S0.55
+G1 X6.250 S0.53
+G1 X6.500 S0.52
+G1 X6.750 S0.50
+G1 X7.000 S0.48
+G1 X7.250 S0.46
+G1 X7.500 S0.45
+G1 X7.750 S0.43
+G1 X8.000 S0.42
+G1 X8.250 S0.40
+G1 X8.500 S0.39
+G1 X8.750 S0.39
+G1 X9.000 S0.38
+G1 X9.250 S0.38
+G1 X9.500 S0.37
+G1 X9.750 S0.38
+G1 X10.000 S0.38
+G0 X10.000 Y4.750
+G1 X9.750 S0.47
+G1 X9.500 S0.47
+G1 X9.250 S0.47
+G1 X9.000 S0.47
+G1 X8.750 S0.47
+G1 X8.500 S0.48
+G1 X8.250 S0.48
+G1 X8.000 S0.48
+G1 X7.750 S0.48
+G1 X7.500 S0.49
+G1 X7.250 S0.49
+G1 X7.000 S0.49
+G1 X6.750 S0.50
+G1 X6.500 S0.50
+G1 X6.250 S0.50
+G1 X6.000 S0.51
+G1 X5.750 S0.51
+G1 X5.500 S0.51
+G1 X5.250 S0.52
+G1 X5.000 S0.52
+G1 X4.750 S0.52
+G1 X4.500 S0.52
+G1 X4.250 S0.53
+G1 X4.000 S0.53
+G1 X3.750 S0.53
+G1 X3.500 S0.53
+G1 X3.250 S0.53
+G1 X3.000 S0.52
+G1 X2.750 S0.52
+G1 X2.500 S0.52
+G1 X2.250 S0.52
+G1 X2.000 S0.51
+G1 X1.750 S0.51
+G1 X1.500 S0.51
+G1 X1.250 S0.50
+G1 X1.000 S0.50
+G1 X0.750 S0.50
+G1 X0.500 S0.49
+G1 X0.250 S0.49
+G1 X0.000 S0.49
+G1 X-0.250 S0.48
+G1 X-0.500 S0.48
+G1 X-0.750 S0.48
+G1 X-1.000 S0.48
+G1 X-1.250 S0.47
+G1 X-1.500 S0.47
+G1 X-1.750 S0.47
+G1 X-2.000 S0.47
+G1 X-2.250 S0.47
+G1 X-2.500 S0.48
+G1 X-2.750 S0.48
+G1 X-3.000 S0.48
+G1 X-3.250 S0.48
+G1 X-3.500 S0.49
+G1 X-3.750 S0.49
+G1 X-4.000 S0.49
+G1 X-4.250 S0.50
+G1 X-4.500 S0.50
+G1 X-4.750 S0.50
+G1 X-5.000 S0.51
+G1 X-5.250 S0.51
+G1 X-5.500 S0.51
+G1 X-5.750 S0.52
+G1 X-6.000 S0.52
+G1 X-6.250 S0.52
+G1 X-6.500 S0.52
+G1 X-6.750 S0.53
+G1 X-7.000 S0.53
+G1 X-7.250 S0.53
+G1 X-7.500 S0.53
+G1 X-7.750 S0.53
+G1 X-8.000 S0.52
+G1 X-8.250 S0.52
+G1 X-8.500 S0.52
+G1 X-8.750 S0.52
+G1 X-9.000 S0.51
+G1 X-9.250 S0.51
+G1 X-9.500 S0.51
+G1 X-9.750 S0.50
+G1 X-10.000 S0.50
+M5
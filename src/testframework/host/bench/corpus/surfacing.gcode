@@ -0,0 +1,3059 @@
+; dense surfacing
+; generated by make_corpus.py
+G21
+G90
+G0 Z5
+G0 X-30 Y-30
+G1 Z0 F600
+G1 F3000
+G1 X-30.000 Y-30.000 Z-1.412
+G1 X-29.000 Y-30.000 Z-1.462
+G1 X-28.000 Y-30.000 Z-1.471
+G1 X-27.000 Y-30.000 Z-1.439
+G1 X-26.000 Y-30.000 Z-1.368
+G1 X-25.000 Y-30.000 Z-1.259
+G1 X-24.000 Y-30.000 Z-1.114
+G1 X-23.000 Y-30.000 Z-0.939
+G1 X-22.000 Y-30.000 Z-0.738
+G1 X-21.000 Y-30.000 Z-0.517
+G1 X-20.000 Y-30.000 Z-0.281
+G1 X-19.000 Y-30.000 Z-0.037
+G1 X-18.000 Y-30.000 Z0.208
+G1 X-17.000 Y-30.000 Z0.447
+G1 X-16.000 Y-30.000 Z0.673
+G1 X-15.000 Y-30.000 Z0.881
+G1 X-14.000 Y-30.000 Z1.065
+G1 X-13.000 Y-30.000 Z1.219
+G1 X-12.000 Y-30.000 Z1.339
+G1 X-11.000 Y-30.000 Z1.422
+G1 X-10.000 Y-30.000 Z1.466
+G1 X-9.000 Y-30.000 Z1.469
+G1 X-8.000 Y-30.000 Z1.431
+G1 X-7.000 Y-30.000 Z1.354
+G1 X-6.000 Y-30.000 Z1.239
+G1 X-5.000 Y-30.000 Z1.090
+G1 X-4.000 Y-30.000 Z0.911
+G1 X-3.000 Y-30.000 Z0.706
+G1 X-2.000 Y-30.000 Z0.482
+G1 X-1.000 Y-30.000 Z0.244
+G1 X0.000 Y-30.000 Z-0.000
+G1 X1.000 Y-30.000 Z-0.244
+G1 X2.000 Y-30.000 Z-0.482
+G1 X3.000 Y-30.000 Z-0.706
+G1 X4.000 Y-30.000 Z-0.911
+G1 X5.000 Y-30.000 Z-1.090
+G1 X6.000 Y-30.000 Z-1.239
+G1 X7.000 Y-30.000 Z-1.354
+G1 X8.000 Y-30.000 Z-1.431
+G1 X9.000 Y-30.000 Z-1.469
+G1 X10.000 Y-30.000 Z-1.466
+G1 X11.000 Y-30.000 Z-1.422
+G1 X12.000 Y-30.000 Z-1.339
+G1 X13.000 Y-30.000 Z-1.219
+G1 X14.000 Y-30.000 Z-1.065
+G1 X15.000 Y-30.000 Z-0.881
+G1 X16.000 Y-30.000 Z-0.673
+G1 X17.000 Y-30.000 Z-0.447
+G1 X18.000 Y-30.000 Z-0.208
+G1 X19.000 Y-30.000 Z0.037
+G1 X20.000 Y-30.000 Z0.281
+G1 X21.000 Y-30.000 Z0.517
+G1 X22.000 Y-30.000 Z0.738
+G1 X23.000 Y-30.000 Z0.939
+G1 X24.000 Y-30.000 Z1.114
+G1 X25.000 Y-30.000 Z1.259
+G1 X26.000 Y-30.000 Z1.368
+G1 X27.000 Y-30.000 Z1.439
+G1 X28.000 Y-30.000 Z1.471
+G1 X29.000 Y-30.000 Z1.462
+G1 X30.000 Y-30.000 Z1.412
+G1 X30.000 Y-28.800 Z1.436
+G1 X29.000 Y-28.800 Z1.487
+G1 X28.000 Y-28.800 Z1.496
+G1 X27.000 Y-28.800 Z1.464
+G1 X26.000 Y-28.800 Z1.391
+G1 X25.000 Y-28.800 Z1.280
+G1 X24.000 Y-28.800 Z1.133
+G1 X23.000 Y-28.800 Z0.955
+G1 X22.000 Y-28.800 Z0.751
+G1 X21.000 Y-28.800 Z0.525
+G1 X20.000 Y-28.800 Z0.285
+G1 X19.000 Y-28.800 Z0.038
+G1 X18.000 Y-28.800 Z-0.211
+G1 X17.000 Y-28.800 Z-0.454
+G1 X16.000 Y-28.800 Z-0.685
+G1 X15.000 Y-28.800 Z-0.896
+G1 X14.000 Y-28.800 Z-1.083
+G1 X13.000 Y-28.800 Z-1.239
+G1 X12.000 Y-28.800 Z-1.362
+G1 X11.000 Y-28.800 Z-1.446
+G1 X10.000 Y-28.800 Z-1.491
+G1 X9.000 Y-28.800 Z-1.494
+G1 X8.000 Y-28.800 Z-1.455
+G1 X7.000 Y-28.800 Z-1.377
+G1 X6.000 Y-28.800 Z-1.260
+G1 X5.000 Y-28.800 Z-1.108
+G1 X4.000 Y-28.800 Z-0.926
+G1 X3.000 Y-28.800 Z-0.718
+G1 X2.000 Y-28.800 Z-0.490
+G1 X1.000 Y-28.800 Z-0.248
+G1 X0.000 Y-28.800 Z-0.000
+G1 X-1.000 Y-28.800 Z0.248
+G1 X-2.000 Y-28.800 Z0.490
+G1 X-3.000 Y-28.800 Z0.718
+G1 X-4.000 Y-28.800 Z0.926
+G1 X-5.000 Y-28.800 Z1.108
+G1 X-6.000 Y-28.800 Z1.260
+G1 X-7.000 Y-28.800 Z1.377
+G1 X-8.000 Y-28.800 Z1.455
+G1 X-9.000 Y-28.800 Z1.494
+G1 X-10.000 Y-28.800 Z1.491
+G1 X-11.000 Y-28.800 Z1.446
+G1 X-12.000 Y-28.800 Z1.362
+G1 X-13.000 Y-28.800 Z1.239
+G1 X-14.000 Y-28.800 Z1.083
+G1 X-15.000 Y-28.800 Z0.896
+G1 X-16.000 Y-28.800 Z0.685
+G1 X-17.000 Y-28.800 Z0.454
+G1 X-18.000 Y-28.800 Z0.211
+G1 X-19.000 Y-28.800 Z-0.038
+G1 X-20.000 Y-28.800 Z-0.285
+G1 X-21.000 Y-28.800 Z-0.525
+G1 X-22.000 Y-28.800 Z-0.751
+G1 X-23.000 Y-28.800 Z-0.955
+G1 X-24.000 Y-28.800 Z-1.133
+G1 X-25.000 Y-28.800 Z-1.280
+G1 X-26.000 Y-28.800 Z-1.391
+G1 X-27.000 Y-28.800 Z-1.464
+G1 X-28.000 Y-28.800 Z-1.496
+G1 X-29.000 Y-28.800 Z-1.487
+G1 X-30.000 Y-28.800 Z-1.436
+G1 X-30.000 Y-27.600 Z-1.434
+G1 X-29.000 Y-27.600 Z-1.485
+G1 X-28.000 Y-27.600 Z-1.494
+G1 X-27.000 Y-27.600 Z-1.462
+G1 X-26.000 Y-27.600 Z-1.390
+G1 X-25.000 Y-27.600 Z-1.279
+G1 X-24.000 Y-27.600 Z-1.132
+G1 X-23.000 Y-27.600 Z-0.954
+G1 X-22.000 Y-27.600 Z-0.750
+G1 X-21.000 Y-27.600 Z-0.525
+G1 X-20.000 Y-27.600 Z-0.285
+G1 X-19.000 Y-27.600 Z-0.038
+G1 X-18.000 Y-27.600 Z0.211
+G1 X-17.000 Y-27.600 Z0.454
+G1 X-16.000 Y-27.600 Z0.684
+G1 X-15.000 Y-27.600 Z0.895
+G1 X-14.000 Y-27.600 Z1.082
+G1 X-13.000 Y-27.600 Z1.238
+G1 X-12.000 Y-27.600 Z1.360
+G1 X-11.000 Y-27.600 Z1.445
+G1 X-10.000 Y-27.600 Z1.489
+G1 X-9.000 Y-27.600 Z1.492
+G1 X-8.000 Y-27.600 Z1.454
+G1 X-7.000 Y-27.600 Z1.375
+G1 X-6.000 Y-27.600 Z1.259
+G1 X-5.000 Y-27.600 Z1.107
+G1 X-4.000 Y-27.600 Z0.925
+G1 X-3.000 Y-27.600 Z0.717
+G1 X-2.000 Y-27.600 Z0.489
+G1 X-1.000 Y-27.600 Z0.248
+G1 X0.000 Y-27.600 Z-0.000
+G1 X1.000 Y-27.600 Z-0.248
+G1 X2.000 Y-27.600 Z-0.489
+G1 X3.000 Y-27.600 Z-0.717
+G1 X4.000 Y-27.600 Z-0.925
+G1 X5.000 Y-27.600 Z-1.107
+G1 X6.000 Y-27.600 Z-1.259
+G1 X7.000 Y-27.600 Z-1.375
+G1 X8.000 Y-27.600 Z-1.454
+G1 X9.000 Y-27.600 Z-1.492
+G1 X10.000 Y-27.600 Z-1.489
+G1 X11.000 Y-27.600 Z-1.445
+G1 X12.000 Y-27.600 Z-1.360
+G1 X13.000 Y-27.600 Z-1.238
+G1 X14.000 Y-27.600 Z-1.082
+G1 X15.000 Y-27.600 Z-0.895
+G1 X16.000 Y-27.600 Z-0.684
+G1 X17.000 Y-27.600 Z-0.454
+G1 X18.000 Y-27.600 Z-0.211
+G1 X19.000 Y-27.600 Z0.038
+G1 X20.000 Y-27.600 Z0.285
+G1 X21.000 Y-27.600 Z0.525
+G1 X22.000 Y-27.600 Z0.750
+G1 X23.000 Y-27.600 Z0.954
+G1 X24.000 Y-27.600 Z1.132
+G1 X25.000 Y-27.600 Z1.279
+G1 X26.000 Y-27.600 Z1.390
+G1 X27.000 Y-27.600 Z1.462
+G1 X28.000 Y-27.600 Z1.494
+G1 X29.000 Y-27.600 Z1.485
+G1 X30.000 Y-27.600 Z1.434
+G1 X30.000 Y-26.400 Z1.407
+G1 X29.000 Y-26.400 Z1.457
+G1 X28.000 Y-26.400 Z1.466
+G1 X27.000 Y-26.400 Z1.435
+G1 X26.000 Y-26.400 Z1.363
+G1 X25.000 Y-26.400 Z1.254
+G1 X24.000 Y-26.400 Z1.111
+G1 X23.000 Y-26.400 Z0.936
+G1 X22.000 Y-26.400 Z0.736
+G1 X21.000 Y-26.400 Z0.515
+G1 X20.000 Y-26.400 Z0.280
+G1 X19.000 Y-26.400 Z0.037
+G1 X18.000 Y-26.400 Z-0.207
+G1 X17.000 Y-26.400 Z-0.445
+G1 X16.000 Y-26.400 Z-0.671
+G1 X15.000 Y-26.400 Z-0.878
+G1 X14.000 Y-26.400 Z-1.061
+G1 X13.000 Y-26.400 Z-1.215
+G1 X12.000 Y-26.400 Z-1.334
+G1 X11.000 Y-26.400 Z-1.417
+G1 X10.000 Y-26.400 Z-1.461
+G1 X9.000 Y-26.400 Z-1.464
+G1 X8.000 Y-26.400 Z-1.426
+G1 X7.000 Y-26.400 Z-1.349
+G1 X6.000 Y-26.400 Z-1.235
+G1 X5.000 Y-26.400 Z-1.086
+G1 X4.000 Y-26.400 Z-0.908
+G1 X3.000 Y-26.400 Z-0.704
+G1 X2.000 Y-26.400 Z-0.480
+G1 X1.000 Y-26.400 Z-0.243
+G1 X0.000 Y-26.400 Z-0.000
+G1 X-1.000 Y-26.400 Z0.243
+G1 X-2.000 Y-26.400 Z0.480
+G1 X-3.000 Y-26.400 Z0.704
+G1 X-4.000 Y-26.400 Z0.908
+G1 X-5.000 Y-26.400 Z1.086
+G1 X-6.000 Y-26.400 Z1.235
+G1 X-7.000 Y-26.400 Z1.349
+G1 X-8.000 Y-26.400 Z1.426
+G1 X-9.000 Y-26.400 Z1.464
+G1 X-10.000 Y-26.400 Z1.461
+G1 X-11.000 Y-26.400 Z1.417
+G1 X-12.000 Y-26.400 Z1.334
+G1 X-13.000 Y-26.400 Z1.215
+G1 X-14.000 Y-26.400 Z1.061
+G1 X-15.000 Y-26.400 Z0.878
+G1 X-16.000 Y-26.400 Z0.671
+G1 X-17.000 Y-26.400 Z0.445
+G1 X-18.000 Y-26.400 Z0.207
+G1 X-19.000 Y-26.400 Z-0.037
+G1 X-20.000 Y-26.400 Z-0.280
+G1 X-21.000 Y-26.400 Z-0.515
+G1 X-22.000 Y-26.400 Z-0.736
+G1 X-23.000 Y-26.400 Z-0.936
+G1 X-24.000 Y-26.400 Z-1.111
+G1 X-25.000 Y-26.400 Z-1.254
+G1 X-26.000 Y-26.400 Z-1.363
+G1 X-27.000 Y-26.400 Z-1.435
+G1 X-28.000 Y-26.400 Z-1.466
+G1 X-29.000 Y-26.400 Z-1.457
+G1 X-30.000 Y-26.400 Z-1.407
+G1 X-30.000 Y-25.200 Z-1.355
+G1 X-29.000 Y-25.200 Z-1.403
+G1 X-28.000 Y-25.200 Z-1.412
+G1 X-27.000 Y-25.200 Z-1.382
+G1 X-26.000 Y-25.200 Z-1.313
+G1 X-25.000 Y-25.200 Z-1.208
+G1 X-24.000 Y-25.200 Z-1.070
+G1 X-23.000 Y-25.200 Z-0.902
+G1 X-22.000 Y-25.200 Z-0.708
+G1 X-21.000 Y-25.200 Z-0.496
+G1 X-20.000 Y-25.200 Z-0.269
+G1 X-19.000 Y-25.200 Z-0.035
+G1 X-18.000 Y-25.200 Z0.199
+G1 X-17.000 Y-25.200 Z0.429
+G1 X-16.000 Y-25.200 Z0.646
+G1 X-15.000 Y-25.200 Z0.846
+G1 X-14.000 Y-25.200 Z1.022
+G1 X-13.000 Y-25.200 Z1.170
+G1 X-12.000 Y-25.200 Z1.285
+G1 X-11.000 Y-25.200 Z1.365
+G1 X-10.000 Y-25.200 Z1.407
+G1 X-9.000 Y-25.200 Z1.410
+G1 X-8.000 Y-25.200 Z1.374
+G1 X-7.000 Y-25.200 Z1.299
+G1 X-6.000 Y-25.200 Z1.189
+G1 X-5.000 Y-25.200 Z1.046
+G1 X-4.000 Y-25.200 Z0.874
+G1 X-3.000 Y-25.200 Z0.678
+G1 X-2.000 Y-25.200 Z0.462
+G1 X-1.000 Y-25.200 Z0.234
+G1 X0.000 Y-25.200 Z-0.000
+G1 X1.000 Y-25.200 Z-0.234
+G1 X2.000 Y-25.200 Z-0.462
+G1 X3.000 Y-25.200 Z-0.678
+G1 X4.000 Y-25.200 Z-0.874
+G1 X5.000 Y-25.200 Z-1.046
+G1 X6.000 Y-25.200 Z-1.189
+G1 X7.000 Y-25.200 Z-1.299
+G1 X8.000 Y-25.200 Z-1.374
+G1 X9.000 Y-25.200 Z-1.410
+G1 X10.000 Y-25.200 Z-1.407
+G1 X11.000 Y-25.200 Z-1.365
+G1 X12.000 Y-25.200 Z-1.285
+G1 X13.000 Y-25.200 Z-1.170
+G1 X14.000 Y-25.200 Z-1.022
+G1 X15.000 Y-25.200 Z-0.846
+G1 X16.000 Y-25.200 Z-0.646
+G1 X17.000 Y-25.200 Z-0.429
+G1 X18.000 Y-25.200 Z-0.199
+G1 X19.000 Y-25.200 Z0.035
+G1 X20.000 Y-25.200 Z0.269
+G1 X21.000 Y-25.200 Z0.496
+G1 X22.000 Y-25.200 Z0.708
+G1 X23.000 Y-25.200 Z0.902
+G1 X24.000 Y-25.200 Z1.070
+G1 X25.000 Y-25.200 Z1.208
+G1 X26.000 Y-25.200 Z1.313
+G1 X27.000 Y-25.200 Z1.382
+G1 X28.000 Y-25.200 Z1.412
+G1 X29.000 Y-25.200 Z1.403
+G1 X30.000 Y-25.200 Z1.355
+G1 X30.000 Y-24.000 Z1.279
+G1 X29.000 Y-24.000 Z1.324
+G1 X28.000 Y-24.000 Z1.333
+G1 X27.000 Y-24.000 Z1.304
+G1 X26.000 Y-24.000 Z1.239
+G1 X25.000 Y-24.000 Z1.140
+G1 X24.000 Y-24.000 Z1.010
+G1 X23.000 Y-24.000 Z0.851
+G1 X22.000 Y-24.000 Z0.669
+G1 X21.000 Y-24.000 Z0.468
+G1 X20.000 Y-24.000 Z0.254
+G1 X19.000 Y-24.000 Z0.033
+G1 X18.000 Y-24.000 Z-0.188
+G1 X17.000 Y-24.000 Z-0.405
+G1 X16.000 Y-24.000 Z-0.610
+G1 X15.000 Y-24.000 Z-0.798
+G1 X14.000 Y-24.000 Z-0.965
+G1 X13.000 Y-24.000 Z-1.104
+G1 X12.000 Y-24.000 Z-1.213
+G1 X11.000 Y-24.000 Z-1.288
+G1 X10.000 Y-24.000 Z-1.328
+G1 X9.000 Y-24.000 Z-1.331
+G1 X8.000 Y-24.000 Z-1.297
+G1 X7.000 Y-24.000 Z-1.227
+G1 X6.000 Y-24.000 Z-1.123
+G1 X5.000 Y-24.000 Z-0.987
+G1 X4.000 Y-24.000 Z-0.825
+G1 X3.000 Y-24.000 Z-0.640
+G1 X2.000 Y-24.000 Z-0.436
+G1 X1.000 Y-24.000 Z-0.221
+G1 X0.000 Y-24.000 Z-0.000
+G1 X-1.000 Y-24.000 Z0.221
+G1 X-2.000 Y-24.000 Z0.436
+G1 X-3.000 Y-24.000 Z0.640
+G1 X-4.000 Y-24.000 Z0.825
+G1 X-5.000 Y-24.000 Z0.987
+G1 X-6.000 Y-24.000 Z1.123
+G1 X-7.000 Y-24.000 Z1.227
+G1 X-8.000 Y-24.000 Z1.297
+G1 X-9.000 Y-24.000 Z1.331
+G1 X-10.000 Y-24.000 Z1.328
+G1 X-11.000 Y-24.000 Z1.288
+G1 X-12.000 Y-24.000 Z1.213
+G1 X-13.000 Y-24.000 Z1.104
+G1 X-14.000 Y-24.000 Z0.965
+G1 X-15.000 Y-24.000 Z0.798
+G1 X-16.000 Y-24.000 Z0.610
+G1 X-17.000 Y-24.000 Z0.405
+G1 X-18.000 Y-24.000 Z0.188
+G1 X-19.000 Y-24.000 Z-0.033
+G1 X-20.000 Y-24.000 Z-0.254
+G1 X-21.000 Y-24.000 Z-0.468
+G1 X-22.000 Y-24.000 Z-0.669
+G1 X-23.000 Y-24.000 Z-0.851
+G1 X-24.000 Y-24.000 Z-1.010
+G1 X-25.000 Y-24.000 Z-1.140
+G1 X-26.000 Y-24.000 Z-1.239
+G1 X-27.000 Y-24.000 Z-1.304
+G1 X-28.000 Y-24.000 Z-1.333
+G1 X-29.000 Y-24.000 Z-1.324
+G1 X-30.000 Y-24.000 Z-1.279
+G1 X-30.000 Y-22.800 Z-1.180
+G1 X-29.000 Y-22.800 Z-1.222
+G1 X-28.000 Y-22.800 Z-1.230
+G1 X-27.000 Y-22.800 Z-1.203
+G1 X-26.000 Y-22.800 Z-1.144
+G1 X-25.000 Y-22.800 Z-1.052
+G1 X-24.000 Y-22.800 Z-0.932
+G1 X-23.000 Y-22.800 Z-0.785
+G1 X-22.000 Y-22.800 Z-0.617
+G1 X-21.000 Y-22.800 Z-0.432
+G1 X-20.000 Y-22.800 Z-0.235
+G1 X-19.000 Y-22.800 Z-0.031
+G1 X-18.000 Y-22.800 Z0.174
+G1 X-17.000 Y-22.800 Z0.373
+G1 X-16.000 Y-22.800 Z0.563
+G1 X-15.000 Y-22.800 Z0.737
+G1 X-14.000 Y-22.800 Z0.890
+G1 X-13.000 Y-22.800 Z1.019
+G1 X-12.000 Y-22.800 Z1.119
+G1 X-11.000 Y-22.800 Z1.189
+G1 X-10.000 Y-22.800 Z1.225
+G1 X-9.000 Y-22.800 Z1.228
+G1 X-8.000 Y-22.800 Z1.196
+G1 X-7.000 Y-22.800 Z1.132
+G1 X-6.000 Y-22.800 Z1.036
+G1 X-5.000 Y-22.800 Z0.911
+G1 X-4.000 Y-22.800 Z0.761
+G1 X-3.000 Y-22.800 Z0.590
+G1 X-2.000 Y-22.800 Z0.403
+G1 X-1.000 Y-22.800 Z0.204
+G1 X0.000 Y-22.800 Z-0.000
+G1 X1.000 Y-22.800 Z-0.204
+G1 X2.000 Y-22.800 Z-0.403
+G1 X3.000 Y-22.800 Z-0.590
+G1 X4.000 Y-22.800 Z-0.761
+G1 X5.000 Y-22.800 Z-0.911
+G1 X6.000 Y-22.800 Z-1.036
+G1 X7.000 Y-22.800 Z-1.132
+G1 X8.000 Y-22.800 Z-1.196
+G1 X9.000 Y-22.800 Z-1.228
+G1 X10.000 Y-22.800 Z-1.225
+G1 X11.000 Y-22.800 Z-1.189
+G1 X12.000 Y-22.800 Z-1.119
+G1 X13.000 Y-22.800 Z-1.019
+G1 X14.000 Y-22.800 Z-0.890
+G1 X15.000 Y-22.800 Z-0.737
+G1 X16.000 Y-22.800 Z-0.563
+G1 X17.000 Y-22.800 Z-0.373
+G1 X18.000 Y-22.800 Z-0.174
+G1 X19.000 Y-22.800 Z0.031
+G1 X20.000 Y-22.800 Z0.235
+G1 X21.000 Y-22.800 Z0.432
+G1 X22.000 Y-22.800 Z0.617
+G1 X23.000 Y-22.800 Z0.785
+G1 X24.000 Y-22.800 Z0.932
+G1 X25.000 Y-22.800 Z1.052
+G1 X26.000 Y-22.800 Z1.144
+G1 X27.000 Y-22.800 Z1.203
+G1 X28.000 Y-22.800 Z1.230
+G1 X29.000 Y-22.800 Z1.222
+G1 X30.000 Y-22.800 Z1.180
+G1 X30.000 Y-21.600 Z1.061
+G1 X29.000 Y-21.600 Z1.098
+G1 X28.000 Y-21.600 Z1.105
+G1 X27.000 Y-21.600 Z1.081
+G1 X26.000 Y-21.600 Z1.028
+G1 X25.000 Y-21.600 Z0.945
+G1 X24.000 Y-21.600 Z0.837
+G1 X23.000 Y-21.600 Z0.706
+G1 X22.000 Y-21.600 Z0.554
+G1 X21.000 Y-21.600 Z0.388
+G1 X20.000 Y-21.600 Z0.211
+G1 X19.000 Y-21.600 Z0.028
+G1 X18.000 Y-21.600 Z-0.156
+G1 X17.000 Y-21.600 Z-0.336
+G1 X16.000 Y-21.600 Z-0.506
+G1 X15.000 Y-21.600 Z-0.662
+G1 X14.000 Y-21.600 Z-0.800
+G1 X13.000 Y-21.600 Z-0.915
+G1 X12.000 Y-21.600 Z-1.006
+G1 X11.000 Y-21.600 Z-1.068
+G1 X10.000 Y-21.600 Z-1.101
+G1 X9.000 Y-21.600 Z-1.103
+G1 X8.000 Y-21.600 Z-1.075
+G1 X7.000 Y-21.600 Z-1.017
+G1 X6.000 Y-21.600 Z-0.931
+G1 X5.000 Y-21.600 Z-0.819
+G1 X4.000 Y-21.600 Z-0.684
+G1 X3.000 Y-21.600 Z-0.530
+G1 X2.000 Y-21.600 Z-0.362
+G1 X1.000 Y-21.600 Z-0.183
+G1 X0.000 Y-21.600 Z-0.000
+G1 X-1.000 Y-21.600 Z0.183
+G1 X-2.000 Y-21.600 Z0.362
+G1 X-3.000 Y-21.600 Z0.530
+G1 X-4.000 Y-21.600 Z0.684
+G1 X-5.000 Y-21.600 Z0.819
+G1 X-6.000 Y-21.600 Z0.931
+G1 X-7.000 Y-21.600 Z1.017
+G1 X-8.000 Y-21.600 Z1.075
+G1 X-9.000 Y-21.600 Z1.103
+G1 X-10.000 Y-21.600 Z1.101
+G1 X-11.000 Y-21.600 Z1.068
+G1 X-12.000 Y-21.600 Z1.006
+G1 X-13.000 Y-21.600 Z0.915
+G1 X-14.000 Y-21.600 Z0.800
+G1 X-15.000 Y-21.600 Z0.662
+G1 X-16.000 Y-21.600 Z0.506
+G1 X-17.000 Y-21.600 Z0.336
+G1 X-18.000 Y-21.600 Z0.156
+G1 X-19.000 Y-21.600 Z-0.028
+G1 X-20.000 Y-21.600 Z-0.211
+G1 X-21.000 Y-21.600 Z-0.388
+G1 X-22.000 Y-21.600 Z-0.554
+G1 X-23.000 Y-21.600 Z-0.706
+G1 X-24.000 Y-21.600 Z-0.837
+G1 X-25.000 Y-21.600 Z-0.945
+G1 X-26.000 Y-21.600 Z-1.028
+G1 X-27.000 Y-21.600 Z-1.081
+G1 X-28.000 Y-21.600 Z-1.105
+G1 X-29.000 Y-21.600 Z-1.098
+G1 X-30.000 Y-21.600 Z-1.061
+G1 X-30.000 Y-20.400 Z-0.922
+G1 X-29.000 Y-20.400 Z-0.955
+G1 X-28.000 Y-20.400 Z-0.961
+G1 X-27.000 Y-20.400 Z-0.940
+G1 X-26.000 Y-20.400 Z-0.893
+G1 X-25.000 Y-20.400 Z-0.822
+G1 X-24.000 Y-20.400 Z-0.728
+G1 X-23.000 Y-20.400 Z-0.613
+G1 X-22.000 Y-20.400 Z-0.482
+G1 X-21.000 Y-20.400 Z-0.337
+G1 X-20.000 Y-20.400 Z-0.183
+G1 X-19.000 Y-20.400 Z-0.024
+G1 X-18.000 Y-20.400 Z0.136
+G1 X-17.000 Y-20.400 Z0.292
+G1 X-16.000 Y-20.400 Z0.440
+G1 X-15.000 Y-20.400 Z0.575
+G1 X-14.000 Y-20.400 Z0.695
+G1 X-13.000 Y-20.400 Z0.796
+G1 X-12.000 Y-20.400 Z0.874
+G1 X-11.000 Y-20.400 Z0.929
+G1 X-10.000 Y-20.400 Z0.957
+G1 X-9.000 Y-20.400 Z0.959
+G1 X-8.000 Y-20.400 Z0.935
+G1 X-7.000 Y-20.400 Z0.884
+G1 X-6.000 Y-20.400 Z0.809
+G1 X-5.000 Y-20.400 Z0.712
+G1 X-4.000 Y-20.400 Z0.595
+G1 X-3.000 Y-20.400 Z0.461
+G1 X-2.000 Y-20.400 Z0.315
+G1 X-1.000 Y-20.400 Z0.160
+G1 X0.000 Y-20.400 Z-0.000
+G1 X1.000 Y-20.400 Z-0.160
+G1 X2.000 Y-20.400 Z-0.315
+G1 X3.000 Y-20.400 Z-0.461
+G1 X4.000 Y-20.400 Z-0.595
+G1 X5.000 Y-20.400 Z-0.712
+G1 X6.000 Y-20.400 Z-0.809
+G1 X7.000 Y-20.400 Z-0.884
+G1 X8.000 Y-20.400 Z-0.935
+G1 X9.000 Y-20.400 Z-0.959
+G1 X10.000 Y-20.400 Z-0.957
+G1 X11.000 Y-20.400 Z-0.929
+G1 X12.000 Y-20.400 Z-0.874
+G1 X13.000 Y-20.400 Z-0.796
+G1 X14.000 Y-20.400 Z-0.695
+G1 X15.000 Y-20.400 Z-0.575
+G1 X16.000 Y-20.400 Z-0.440
+G1 X17.000 Y-20.400 Z-0.292
+G1 X18.000 Y-20.400 Z-0.136
+G1 X19.000 Y-20.400 Z0.024
+G1 X20.000 Y-20.400 Z0.183
+G1 X21.000 Y-20.400 Z0.337
+G1 X22.000 Y-20.400 Z0.482
+G1 X23.000 Y-20.400 Z0.613
+G1 X24.000 Y-20.400 Z0.728
+G1 X25.000 Y-20.400 Z0.822
+G1 X26.000 Y-20.400 Z0.893
+G1 X27.000 Y-20.400 Z0.940
+G1 X28.000 Y-20.400 Z0.961
+G1 X29.000 Y-20.400 Z0.955
+G1 X30.000 Y-20.400 Z0.922
+G1 X30.000 Y-19.200 Z0.767
+G1 X29.000 Y-19.200 Z0.794
+G1 X28.000 Y-19.200 Z0.799
+G1 X27.000 Y-19.200 Z0.782
+G1 X26.000 Y-19.200 Z0.743
+G1 X25.000 Y-19.200 Z0.684
+G1 X24.000 Y-19.200 Z0.605
+G1 X23.000 Y-19.200 Z0.510
+G1 X22.000 Y-19.200 Z0.401
+G1 X21.000 Y-19.200 Z0.281
+G1 X20.000 Y-19.200 Z0.152
+G1 X19.000 Y-19.200 Z0.020
+G1 X18.000 Y-19.200 Z-0.113
+G1 X17.000 Y-19.200 Z-0.243
+G1 X16.000 Y-19.200 Z-0.366
+G1 X15.000 Y-19.200 Z-0.479
+G1 X14.000 Y-19.200 Z-0.578
+G1 X13.000 Y-19.200 Z-0.662
+G1 X12.000 Y-19.200 Z-0.727
+G1 X11.000 Y-19.200 Z-0.773
+G1 X10.000 Y-19.200 Z-0.796
+G1 X9.000 Y-19.200 Z-0.798
+G1 X8.000 Y-19.200 Z-0.778
+G1 X7.000 Y-19.200 Z-0.736
+G1 X6.000 Y-19.200 Z-0.673
+G1 X5.000 Y-19.200 Z-0.592
+G1 X4.000 Y-19.200 Z-0.495
+G1 X3.000 Y-19.200 Z-0.384
+G1 X2.000 Y-19.200 Z-0.262
+G1 X1.000 Y-19.200 Z-0.133
+G1 X0.000 Y-19.200 Z-0.000
+G1 X-1.000 Y-19.200 Z0.133
+G1 X-2.000 Y-19.200 Z0.262
+G1 X-3.000 Y-19.200 Z0.384
+G1 X-4.000 Y-19.200 Z0.495
+G1 X-5.000 Y-19.200 Z0.592
+G1 X-6.000 Y-19.200 Z0.673
+G1 X-7.000 Y-19.200 Z0.736
+G1 X-8.000 Y-19.200 Z0.778
+G1 X-9.000 Y-19.200 Z0.798
+G1 X-10.000 Y-19.200 Z0.796
+G1 X-11.000 Y-19.200 Z0.773
+G1 X-12.000 Y-19.200 Z0.727
+G1 X-13.000 Y-19.200 Z0.662
+G1 X-14.000 Y-19.200 Z0.578
+G1 X-15.000 Y-19.200 Z0.479
+G1 X-16.000 Y-19.200 Z0.366
+G1 X-17.000 Y-19.200 Z0.243
+G1 X-18.000 Y-19.200 Z0.113
+G1 X-19.000 Y-19.200 Z-0.020
+G1 X-20.000 Y-19.200 Z-0.152
+G1 X-21.000 Y-19.200 Z-0.281
+G1 X-22.000 Y-19.200 Z-0.401
+G1 X-23.000 Y-19.200 Z-0.510
+G1 X-24.000 Y-19.200 Z-0.605
+G1 X-25.000 Y-19.200 Z-0.684
+G1 X-26.000 Y-19.200 Z-0.743
+G1 X-27.000 Y-19.200 Z-0.782
+G1 X-28.000 Y-19.200 Z-0.799
+G1 X-29.000 Y-19.200 Z-0.794
+G1 X-30.000 Y-19.200 Z-0.767
+G1 X-30.000 Y-18.000 Z-0.599
+G1 X-29.000 Y-18.000 Z-0.620
+G1 X-28.000 Y-18.000 Z-0.624
+G1 X-27.000 Y-18.000 Z-0.610
+G1 X-26.000 Y-18.000 Z-0.580
+G1 X-25.000 Y-18.000 Z-0.534
+G1 X-24.000 Y-18.000 Z-0.472
+G1 X-23.000 Y-18.000 Z-0.398
+G1 X-22.000 Y-18.000 Z-0.313
+G1 X-21.000 Y-18.000 Z-0.219
+G1 X-20.000 Y-18.000 Z-0.119
+G1 X-19.000 Y-18.000 Z-0.016
+G1 X-18.000 Y-18.000 Z0.088
+G1 X-17.000 Y-18.000 Z0.189
+G1 X-16.000 Y-18.000 Z0.285
+G1 X-15.000 Y-18.000 Z0.374
+G1 X-14.000 Y-18.000 Z0.451
+G1 X-13.000 Y-18.000 Z0.517
+G1 X-12.000 Y-18.000 Z0.568
+G1 X-11.000 Y-18.000 Z0.603
+G1 X-10.000 Y-18.000 Z0.621
+G1 X-9.000 Y-18.000 Z0.623
+G1 X-8.000 Y-18.000 Z0.607
+G1 X-7.000 Y-18.000 Z0.574
+G1 X-6.000 Y-18.000 Z0.525
+G1 X-5.000 Y-18.000 Z0.462
+G1 X-4.000 Y-18.000 Z0.386
+G1 X-3.000 Y-18.000 Z0.299
+G1 X-2.000 Y-18.000 Z0.204
+G1 X-1.000 Y-18.000 Z0.104
+G1 X0.000 Y-18.000 Z-0.000
+G1 X1.000 Y-18.000 Z-0.104
+G1 X2.000 Y-18.000 Z-0.204
+G1 X3.000 Y-18.000 Z-0.299
+G1 X4.000 Y-18.000 Z-0.386
+G1 X5.000 Y-18.000 Z-0.462
+G1 X6.000 Y-18.000 Z-0.525
+G1 X7.000 Y-18.000 Z-0.574
+G1 X8.000 Y-18.000 Z-0.607
+G1 X9.000 Y-18.000 Z-0.623
+G1 X10.000 Y-18.000 Z-0.621
+G1 X11.000 Y-18.000 Z-0.603
+G1 X12.000 Y-18.000 Z-0.568
+G1 X13.000 Y-18.000 Z-0.517
+G1 X14.000 Y-18.000 Z-0.451
+G1 X15.000 Y-18.000 Z-0.374
+G1 X16.000 Y-18.000 Z-0.285
+G1 X17.000 Y-18.000 Z-0.189
+G1 X18.000 Y-18.000 Z-0.088
+G1 X19.000 Y-18.000 Z0.016
+G1 X20.000 Y-18.000 Z0.119
+G1 X21.000 Y-18.000 Z0.219
+G1 X22.000 Y-18.000 Z0.313
+G1 X23.000 Y-18.000 Z0.398
+G1 X24.000 Y-18.000 Z0.472
+G1 X25.000 Y-18.000 Z0.534
+G1 X26.000 Y-18.000 Z0.580
+G1 X27.000 Y-18.000 Z0.610
+G1 X28.000 Y-18.000 Z0.624
+G1 X29.000 Y-18.000 Z0.620
+G1 X30.000 Y-18.000 Z0.599
+G1 X30.000 Y-16.800 Z0.419
+G1 X29.000 Y-16.800 Z0.434
+G1 X28.000 Y-16.800 Z0.437
+G1 X27.000 Y-16.800 Z0.428
+G1 X26.000 Y-16.800 Z0.406
+G1 X25.000 Y-16.800 Z0.374
+G1 X24.000 Y-16.800 Z0.331
+G1 X23.000 Y-16.800 Z0.279
+G1 X22.000 Y-16.800 Z0.219
+G1 X21.000 Y-16.800 Z0.153
+G1 X20.000 Y-16.800 Z0.083
+G1 X19.000 Y-16.800 Z0.011
+G1 X18.000 Y-16.800 Z-0.062
+G1 X17.000 Y-16.800 Z-0.133
+G1 X16.000 Y-16.800 Z-0.200
+G1 X15.000 Y-16.800 Z-0.262
+G1 X14.000 Y-16.800 Z-0.316
+G1 X13.000 Y-16.800 Z-0.362
+G1 X12.000 Y-16.800 Z-0.398
+G1 X11.000 Y-16.800 Z-0.422
+G1 X10.000 Y-16.800 Z-0.435
+G1 X9.000 Y-16.800 Z-0.436
+G1 X8.000 Y-16.800 Z-0.425
+G1 X7.000 Y-16.800 Z-0.402
+G1 X6.000 Y-16.800 Z-0.368
+G1 X5.000 Y-16.800 Z-0.324
+G1 X4.000 Y-16.800 Z-0.270
+G1 X3.000 Y-16.800 Z-0.210
+G1 X2.000 Y-16.800 Z-0.143
+G1 X1.000 Y-16.800 Z-0.073
+G1 X0.000 Y-16.800 Z-0.000
+G1 X-1.000 Y-16.800 Z0.073
+G1 X-2.000 Y-16.800 Z0.143
+G1 X-3.000 Y-16.800 Z0.210
+G1 X-4.000 Y-16.800 Z0.270
+G1 X-5.000 Y-16.800 Z0.324
+G1 X-6.000 Y-16.800 Z0.368
+G1 X-7.000 Y-16.800 Z0.402
+G1 X-8.000 Y-16.800 Z0.425
+G1 X-9.000 Y-16.800 Z0.436
+G1 X-10.000 Y-16.800 Z0.435
+G1 X-11.000 Y-16.800 Z0.422
+G1 X-12.000 Y-16.800 Z0.398
+G1 X-13.000 Y-16.800 Z0.362
+G1 X-14.000 Y-16.800 Z0.316
+G1 X-15.000 Y-16.800 Z0.262
+G1 X-16.000 Y-16.800 Z0.200
+G1 X-17.000 Y-16.800 Z0.133
+G1 X-18.000 Y-16.800 Z0.062
+G1 X-19.000 Y-16.800 Z-0.011
+G1 X-20.000 Y-16.800 Z-0.083
+G1 X-21.000 Y-16.800 Z-0.153
+G1 X-22.000 Y-16.800 Z-0.219
+G1 X-23.000 Y-16.800 Z-0.279
+G1 X-24.000 Y-16.800 Z-0.331
+G1 X-25.000 Y-16.800 Z-0.374
+G1 X-26.000 Y-16.800 Z-0.406
+G1 X-27.000 Y-16.800 Z-0.428
+G1 X-28.000 Y-16.800 Z-0.437
+G1 X-29.000 Y-16.800 Z-0.434
+G1 X-30.000 Y-16.800 Z-0.419
+G1 X-30.000 Y-15.600 Z-0.233
+G1 X-29.000 Y-15.600 Z-0.241
+G1 X-28.000 Y-15.600 Z-0.242
+G1 X-27.000 Y-15.600 Z-0.237
+G1 X-26.000 Y-15.600 Z-0.226
+G1 X-25.000 Y-15.600 Z-0.207
+G1 X-24.000 Y-15.600 Z-0.184
+G1 X-23.000 Y-15.600 Z-0.155
+G1 X-22.000 Y-15.600 Z-0.122
+G1 X-21.000 Y-15.600 Z-0.085
+G1 X-20.000 Y-15.600 Z-0.046
+G1 X-19.000 Y-15.600 Z-0.006
+G1 X-18.000 Y-15.600 Z0.034
+G1 X-17.000 Y-15.600 Z0.074
+G1 X-16.000 Y-15.600 Z0.111
+G1 X-15.000 Y-15.600 Z0.145
+G1 X-14.000 Y-15.600 Z0.176
+G1 X-13.000 Y-15.600 Z0.201
+G1 X-12.000 Y-15.600 Z0.221
+G1 X-11.000 Y-15.600 Z0.234
+G1 X-10.000 Y-15.600 Z0.242
+G1 X-9.000 Y-15.600 Z0.242
+G1 X-8.000 Y-15.600 Z0.236
+G1 X-7.000 Y-15.600 Z0.223
+G1 X-6.000 Y-15.600 Z0.204
+G1 X-5.000 Y-15.600 Z0.180
+G1 X-4.000 Y-15.600 Z0.150
+G1 X-3.000 Y-15.600 Z0.116
+G1 X-2.000 Y-15.600 Z0.079
+G1 X-1.000 Y-15.600 Z0.040
+G1 X0.000 Y-15.600 Z-0.000
+G1 X1.000 Y-15.600 Z-0.040
+G1 X2.000 Y-15.600 Z-0.079
+G1 X3.000 Y-15.600 Z-0.116
+G1 X4.000 Y-15.600 Z-0.150
+G1 X5.000 Y-15.600 Z-0.180
+G1 X6.000 Y-15.600 Z-0.204
+G1 X7.000 Y-15.600 Z-0.223
+G1 X8.000 Y-15.600 Z-0.236
+G1 X9.000 Y-15.600 Z-0.242
+G1 X10.000 Y-15.600 Z-0.242
+G1 X11.000 Y-15.600 Z-0.234
+G1 X12.000 Y-15.600 Z-0.221
+G1 X13.000 Y-15.600 Z-0.201
+G1 X14.000 Y-15.600 Z-0.176
+G1 X15.000 Y-15.600 Z-0.145
+G1 X16.000 Y-15.600 Z-0.111
+G1 X17.000 Y-15.600 Z-0.074
+G1 X18.000 Y-15.600 Z-0.034
+G1 X19.000 Y-15.600 Z0.006
+G1 X20.000 Y-15.600 Z0.046
+G1 X21.000 Y-15.600 Z0.085
+G1 X22.000 Y-15.600 Z0.122
+G1 X23.000 Y-15.600 Z0.155
+G1 X24.000 Y-15.600 Z0.184
+G1 X25.000 Y-15.600 Z0.207
+G1 X26.000 Y-15.600 Z0.226
+G1 X27.000 Y-15.600 Z0.237
+G1 X28.000 Y-15.600 Z0.242
+G1 X29.000 Y-15.600 Z0.241
+G1 X30.000 Y-15.600 Z0.233
+G1 X30.000 Y-14.400 Z0.042
+G1 X29.000 Y-14.400 Z0.043
+G1 X28.000 Y-14.400 Z0.044
+G1 X27.000 Y-14.400 Z0.043
+G1 X26.000 Y-14.400 Z0.041
+G1 X25.000 Y-14.400 Z0.037
+G1 X24.000 Y-14.400 Z0.033
+G1 X23.000 Y-14.400 Z0.028
+G1 X22.000 Y-14.400 Z0.022
+G1 X21.000 Y-14.400 Z0.015
+G1 X20.000 Y-14.400 Z0.008
+G1 X19.000 Y-14.400 Z0.001
+G1 X18.000 Y-14.400 Z-0.006
+G1 X17.000 Y-14.400 Z-0.013
+G1 X16.000 Y-14.400 Z-0.020
+G1 X15.000 Y-14.400 Z-0.026
+G1 X14.000 Y-14.400 Z-0.032
+G1 X13.000 Y-14.400 Z-0.036
+G1 X12.000 Y-14.400 Z-0.040
+G1 X11.000 Y-14.400 Z-0.042
+G1 X10.000 Y-14.400 Z-0.044
+G1 X9.000 Y-14.400 Z-0.044
+G1 X8.000 Y-14.400 Z-0.043
+G1 X7.000 Y-14.400 Z-0.040
+G1 X6.000 Y-14.400 Z-0.037
+G1 X5.000 Y-14.400 Z-0.032
+G1 X4.000 Y-14.400 Z-0.027
+G1 X3.000 Y-14.400 Z-0.021
+G1 X2.000 Y-14.400 Z-0.014
+G1 X1.000 Y-14.400 Z-0.007
+G1 X0.000 Y-14.400 Z-0.000
+G1 X-1.000 Y-14.400 Z0.007
+G1 X-2.000 Y-14.400 Z0.014
+G1 X-3.000 Y-14.400 Z0.021
+G1 X-4.000 Y-14.400 Z0.027
+G1 X-5.000 Y-14.400 Z0.032
+G1 X-6.000 Y-14.400 Z0.037
+G1 X-7.000 Y-14.400 Z0.040
+G1 X-8.000 Y-14.400 Z0.043
+G1 X-9.000 Y-14.400 Z0.044
+G1 X-10.000 Y-14.400 Z0.044
+G1 X-11.000 Y-14.400 Z0.042
+G1 X-12.000 Y-14.400 Z0.040
+G1 X-13.000 Y-14.400 Z0.036
+G1 X-14.000 Y-14.400 Z0.032
+G1 X-15.000 Y-14.400 Z0.026
+G1 X-16.000 Y-14.400 Z0.020
+G1 X-17.000 Y-14.400 Z0.013
+G1 X-18.000 Y-14.400 Z0.006
+G1 X-19.000 Y-14.400 Z-0.001
+G1 X-20.000 Y-14.400 Z-0.008
+G1 X-21.000 Y-14.400 Z-0.015
+G1 X-22.000 Y-14.400 Z-0.022
+G1 X-23.000 Y-14.400 Z-0.028
+G1 X-24.000 Y-14.400 Z-0.033
+G1 X-25.000 Y-14.400 Z-0.037
+G1 X-26.000 Y-14.400 Z-0.041
+G1 X-27.000 Y-14.400 Z-0.043
+G1 X-28.000 Y-14.400 Z-0.044
+G1 X-29.000 Y-14.400 Z-0.043
+G1 X-30.000 Y-14.400 Z-0.042
+G1 X-30.000 Y-13.200 Z0.150
+G1 X-29.000 Y-13.200 Z0.155
+G1 X-28.000 Y-13.200 Z0.156
+G1 X-27.000 Y-13.200 Z0.152
+G1 X-26.000 Y-13.200 Z0.145
+G1 X-25.000 Y-13.200 Z0.133
+G1 X-24.000 Y-13.200 Z0.118
+G1 X-23.000 Y-13.200 Z0.099
+G1 X-22.000 Y-13.200 Z0.078
+G1 X-21.000 Y-13.200 Z0.055
+G1 X-20.000 Y-13.200 Z0.030
+G1 X-19.000 Y-13.200 Z0.004
+G1 X-18.000 Y-13.200 Z-0.022
+G1 X-17.000 Y-13.200 Z-0.047
+G1 X-16.000 Y-13.200 Z-0.071
+G1 X-15.000 Y-13.200 Z-0.093
+G1 X-14.000 Y-13.200 Z-0.113
+G1 X-13.000 Y-13.200 Z-0.129
+G1 X-12.000 Y-13.200 Z-0.142
+G1 X-11.000 Y-13.200 Z-0.151
+G1 X-10.000 Y-13.200 Z-0.155
+G1 X-9.000 Y-13.200 Z-0.156
+G1 X-8.000 Y-13.200 Z-0.152
+G1 X-7.000 Y-13.200 Z-0.143
+G1 X-6.000 Y-13.200 Z-0.131
+G1 X-5.000 Y-13.200 Z-0.115
+G1 X-4.000 Y-13.200 Z-0.096
+G1 X-3.000 Y-13.200 Z-0.075
+G1 X-2.000 Y-13.200 Z-0.051
+G1 X-1.000 Y-13.200 Z-0.026
+G1 X0.000 Y-13.200 Z0.000
+G1 X1.000 Y-13.200 Z0.026
+G1 X2.000 Y-13.200 Z0.051
+G1 X3.000 Y-13.200 Z0.075
+G1 X4.000 Y-13.200 Z0.096
+G1 X5.000 Y-13.200 Z0.115
+G1 X6.000 Y-13.200 Z0.131
+G1 X7.000 Y-13.200 Z0.143
+G1 X8.000 Y-13.200 Z0.152
+G1 X9.000 Y-13.200 Z0.156
+G1 X10.000 Y-13.200 Z0.155
+G1 X11.000 Y-13.200 Z0.151
+G1 X12.000 Y-13.200 Z0.142
+G1 X13.000 Y-13.200 Z0.129
+G1 X14.000 Y-13.200 Z0.113
+G1 X15.000 Y-13.200 Z0.093
+G1 X16.000 Y-13.200 Z0.071
+G1 X17.000 Y-13.200 Z0.047
+G1 X18.000 Y-13.200 Z0.022
+G1 X19.000 Y-13.200 Z-0.004
+G1 X20.000 Y-13.200 Z-0.030
+G1 X21.000 Y-13.200 Z-0.055
+G1 X22.000 Y-13.200 Z-0.078
+G1 X23.000 Y-13.200 Z-0.099
+G1 X24.000 Y-13.200 Z-0.118
+G1 X25.000 Y-13.200 Z-0.133
+G1 X26.000 Y-13.200 Z-0.145
+G1 X27.000 Y-13.200 Z-0.152
+G1 X28.000 Y-13.200 Z-0.156
+G1 X29.000 Y-13.200 Z-0.155
+G1 X30.000 Y-13.200 Z-0.150
+G1 X30.000 Y-12.000 Z-0.338
+G1 X29.000 Y-12.000 Z-0.350
+G1 X28.000 Y-12.000 Z-0.352
+G1 X27.000 Y-12.000 Z-0.345
+G1 X26.000 Y-12.000 Z-0.328
+G1 X25.000 Y-12.000 Z-0.302
+G1 X24.000 Y-12.000 Z-0.267
+G1 X23.000 Y-12.000 Z-0.225
+G1 X22.000 Y-12.000 Z-0.177
+G1 X21.000 Y-12.000 Z-0.124
+G1 X20.000 Y-12.000 Z-0.067
+G1 X19.000 Y-12.000 Z-0.009
+G1 X18.000 Y-12.000 Z0.050
+G1 X17.000 Y-12.000 Z0.107
+G1 X16.000 Y-12.000 Z0.161
+G1 X15.000 Y-12.000 Z0.211
+G1 X14.000 Y-12.000 Z0.255
+G1 X13.000 Y-12.000 Z0.292
+G1 X12.000 Y-12.000 Z0.321
+G1 X11.000 Y-12.000 Z0.341
+G1 X10.000 Y-12.000 Z0.351
+G1 X9.000 Y-12.000 Z0.352
+G1 X8.000 Y-12.000 Z0.343
+G1 X7.000 Y-12.000 Z0.324
+G1 X6.000 Y-12.000 Z0.297
+G1 X5.000 Y-12.000 Z0.261
+G1 X4.000 Y-12.000 Z0.218
+G1 X3.000 Y-12.000 Z0.169
+G1 X2.000 Y-12.000 Z0.115
+G1 X1.000 Y-12.000 Z0.059
+G1 X0.000 Y-12.000 Z0.000
+G1 X-1.000 Y-12.000 Z-0.059
+G1 X-2.000 Y-12.000 Z-0.115
+G1 X-3.000 Y-12.000 Z-0.169
+G1 X-4.000 Y-12.000 Z-0.218
+G1 X-5.000 Y-12.000 Z-0.261
+G1 X-6.000 Y-12.000 Z-0.297
+G1 X-7.000 Y-12.000 Z-0.324
+G1 X-8.000 Y-12.000 Z-0.343
+G1 X-9.000 Y-12.000 Z-0.352
+G1 X-10.000 Y-12.000 Z-0.351
+G1 X-11.000 Y-12.000 Z-0.341
+G1 X-12.000 Y-12.000 Z-0.321
+G1 X-13.000 Y-12.000 Z-0.292
+G1 X-14.000 Y-12.000 Z-0.255
+G1 X-15.000 Y-12.000 Z-0.211
+G1 X-16.000 Y-12.000 Z-0.161
+G1 X-17.000 Y-12.000 Z-0.107
+G1 X-18.000 Y-12.000 Z-0.050
+G1 X-19.000 Y-12.000 Z0.009
+G1 X-20.000 Y-12.000 Z0.067
+G1 X-21.000 Y-12.000 Z0.124
+G1 X-22.000 Y-12.000 Z0.177
+G1 X-23.000 Y-12.000 Z0.225
+G1 X-24.000 Y-12.000 Z0.267
+G1 X-25.000 Y-12.000 Z0.302
+G1 X-26.000 Y-12.000 Z0.328
+G1 X-27.000 Y-12.000 Z0.345
+G1 X-28.000 Y-12.000 Z0.352
+G1 X-29.000 Y-12.000 Z0.350
+G1 X-30.000 Y-12.000 Z0.338
+G1 X-30.000 Y-10.800 Z0.521
+G1 X-29.000 Y-10.800 Z0.540
+G1 X-28.000 Y-10.800 Z0.543
+G1 X-27.000 Y-10.800 Z0.531
+G1 X-26.000 Y-10.800 Z0.505
+G1 X-25.000 Y-10.800 Z0.465
+G1 X-24.000 Y-10.800 Z0.411
+G1 X-23.000 Y-10.800 Z0.347
+G1 X-22.000 Y-10.800 Z0.272
+G1 X-21.000 Y-10.800 Z0.191
+G1 X-20.000 Y-10.800 Z0.104
+G1 X-19.000 Y-10.800 Z0.014
+G1 X-18.000 Y-10.800 Z-0.077
+G1 X-17.000 Y-10.800 Z-0.165
+G1 X-16.000 Y-10.800 Z-0.249
+G1 X-15.000 Y-10.800 Z-0.325
+G1 X-14.000 Y-10.800 Z-0.393
+G1 X-13.000 Y-10.800 Z-0.450
+G1 X-12.000 Y-10.800 Z-0.494
+G1 X-11.000 Y-10.800 Z-0.525
+G1 X-10.000 Y-10.800 Z-0.541
+G1 X-9.000 Y-10.800 Z-0.542
+G1 X-8.000 Y-10.800 Z-0.528
+G1 X-7.000 Y-10.800 Z-0.500
+G1 X-6.000 Y-10.800 Z-0.457
+G1 X-5.000 Y-10.800 Z-0.402
+G1 X-4.000 Y-10.800 Z-0.336
+G1 X-3.000 Y-10.800 Z-0.261
+G1 X-2.000 Y-10.800 Z-0.178
+G1 X-1.000 Y-10.800 Z-0.090
+G1 X0.000 Y-10.800 Z0.000
+G1 X1.000 Y-10.800 Z0.090
+G1 X2.000 Y-10.800 Z0.178
+G1 X3.000 Y-10.800 Z0.261
+G1 X4.000 Y-10.800 Z0.336
+G1 X5.000 Y-10.800 Z0.402
+G1 X6.000 Y-10.800 Z0.457
+G1 X7.000 Y-10.800 Z0.500
+G1 X8.000 Y-10.800 Z0.528
+G1 X9.000 Y-10.800 Z0.542
+G1 X10.000 Y-10.800 Z0.541
+G1 X11.000 Y-10.800 Z0.525
+G1 X12.000 Y-10.800 Z0.494
+G1 X13.000 Y-10.800 Z0.450
+G1 X14.000 Y-10.800 Z0.393
+G1 X15.000 Y-10.800 Z0.325
+G1 X16.000 Y-10.800 Z0.249
+G1 X17.000 Y-10.800 Z0.165
+G1 X18.000 Y-10.800 Z0.077
+G1 X19.000 Y-10.800 Z-0.014
+G1 X20.000 Y-10.800 Z-0.104
+G1 X21.000 Y-10.800 Z-0.191
+G1 X22.000 Y-10.800 Z-0.272
+G1 X23.000 Y-10.800 Z-0.347
+G1 X24.000 Y-10.800 Z-0.411
+G1 X25.000 Y-10.800 Z-0.465
+G1 X26.000 Y-10.800 Z-0.505
+G1 X27.000 Y-10.800 Z-0.531
+G1 X28.000 Y-10.800 Z-0.543
+G1 X29.000 Y-10.800 Z-0.540
+G1 X30.000 Y-10.800 Z-0.521
+G1 X30.000 Y-9.600 Z-0.695
+G1 X29.000 Y-9.600 Z-0.719
+G1 X28.000 Y-9.600 Z-0.724
+G1 X27.000 Y-9.600 Z-0.708
+G1 X26.000 Y-9.600 Z-0.673
+G1 X25.000 Y-9.600 Z-0.619
+G1 X24.000 Y-9.600 Z-0.548
+G1 X23.000 Y-9.600 Z-0.462
+G1 X22.000 Y-9.600 Z-0.363
+G1 X21.000 Y-9.600 Z-0.254
+G1 X20.000 Y-9.600 Z-0.138
+G1 X19.000 Y-9.600 Z-0.018
+G1 X18.000 Y-9.600 Z0.102
+G1 X17.000 Y-9.600 Z0.220
+G1 X16.000 Y-9.600 Z0.331
+G1 X15.000 Y-9.600 Z0.434
+G1 X14.000 Y-9.600 Z0.524
+G1 X13.000 Y-9.600 Z0.600
+G1 X12.000 Y-9.600 Z0.659
+G1 X11.000 Y-9.600 Z0.700
+G1 X10.000 Y-9.600 Z0.721
+G1 X9.000 Y-9.600 Z0.723
+G1 X8.000 Y-9.600 Z0.704
+G1 X7.000 Y-9.600 Z0.666
+G1 X6.000 Y-9.600 Z0.610
+G1 X5.000 Y-9.600 Z0.536
+G1 X4.000 Y-9.600 Z0.448
+G1 X3.000 Y-9.600 Z0.347
+G1 X2.000 Y-9.600 Z0.237
+G1 X1.000 Y-9.600 Z0.120
+G1 X0.000 Y-9.600 Z0.000
+G1 X-1.000 Y-9.600 Z-0.120
+G1 X-2.000 Y-9.600 Z-0.237
+G1 X-3.000 Y-9.600 Z-0.347
+G1 X-4.000 Y-9.600 Z-0.448
+G1 X-5.000 Y-9.600 Z-0.536
+G1 X-6.000 Y-9.600 Z-0.610
+G1 X-7.000 Y-9.600 Z-0.666
+G1 X-8.000 Y-9.600 Z-0.704
+G1 X-9.000 Y-9.600 Z-0.723
+G1 X-10.000 Y-9.600 Z-0.721
+G1 X-11.000 Y-9.600 Z-0.700
+G1 X-12.000 Y-9.600 Z-0.659
+G1 X-13.000 Y-9.600 Z-0.600
+G1 X-14.000 Y-9.600 Z-0.524
+G1 X-15.000 Y-9.600 Z-0.434
+G1 X-16.000 Y-9.600 Z-0.331
+G1 X-17.000 Y-9.600 Z-0.220
+G1 X-18.000 Y-9.600 Z-0.102
+G1 X-19.000 Y-9.600 Z0.018
+G1 X-20.000 Y-9.600 Z0.138
+G1 X-21.000 Y-9.600 Z0.254
+G1 X-22.000 Y-9.600 Z0.363
+G1 X-23.000 Y-9.600 Z0.462
+G1 X-24.000 Y-9.600 Z0.548
+G1 X-25.000 Y-9.600 Z0.619
+G1 X-26.000 Y-9.600 Z0.673
+G1 X-27.000 Y-9.600 Z0.708
+G1 X-28.000 Y-9.600 Z0.724
+G1 X-29.000 Y-9.600 Z0.719
+G1 X-30.000 Y-9.600 Z0.695
+G1 X-30.000 Y-8.400 Z0.856
+G1 X-29.000 Y-8.400 Z0.886
+G1 X-28.000 Y-8.400 Z0.892
+G1 X-27.000 Y-8.400 Z0.873
+G1 X-26.000 Y-8.400 Z0.829
+G1 X-25.000 Y-8.400 Z0.763
+G1 X-24.000 Y-8.400 Z0.676
+G1 X-23.000 Y-8.400 Z0.569
+G1 X-22.000 Y-8.400 Z0.448
+G1 X-21.000 Y-8.400 Z0.313
+G1 X-20.000 Y-8.400 Z0.170
+G1 X-19.000 Y-8.400 Z0.022
+G1 X-18.000 Y-8.400 Z-0.126
+G1 X-17.000 Y-8.400 Z-0.271
+G1 X-16.000 Y-8.400 Z-0.408
+G1 X-15.000 Y-8.400 Z-0.534
+G1 X-14.000 Y-8.400 Z-0.646
+G1 X-13.000 Y-8.400 Z-0.739
+G1 X-12.000 Y-8.400 Z-0.812
+G1 X-11.000 Y-8.400 Z-0.862
+G1 X-10.000 Y-8.400 Z-0.889
+G1 X-9.000 Y-8.400 Z-0.891
+G1 X-8.000 Y-8.400 Z-0.868
+G1 X-7.000 Y-8.400 Z-0.821
+G1 X-6.000 Y-8.400 Z-0.751
+G1 X-5.000 Y-8.400 Z-0.661
+G1 X-4.000 Y-8.400 Z-0.552
+G1 X-3.000 Y-8.400 Z-0.428
+G1 X-2.000 Y-8.400 Z-0.292
+G1 X-1.000 Y-8.400 Z-0.148
+G1 X0.000 Y-8.400 Z0.000
+G1 X1.000 Y-8.400 Z0.148
+G1 X2.000 Y-8.400 Z0.292
+G1 X3.000 Y-8.400 Z0.428
+G1 X4.000 Y-8.400 Z0.552
+G1 X5.000 Y-8.400 Z0.661
+G1 X6.000 Y-8.400 Z0.751
+G1 X7.000 Y-8.400 Z0.821
+G1 X8.000 Y-8.400 Z0.868
+G1 X9.000 Y-8.400 Z0.891
+G1 X10.000 Y-8.400 Z0.889
+G1 X11.000 Y-8.400 Z0.862
+G1 X12.000 Y-8.400 Z0.812
+G1 X13.000 Y-8.400 Z0.739
+G1 X14.000 Y-8.400 Z0.646
+G1 X15.000 Y-8.400 Z0.534
+G1 X16.000 Y-8.400 Z0.408
+G1 X17.000 Y-8.400 Z0.271
+G1 X18.000 Y-8.400 Z0.126
+G1 X19.000 Y-8.400 Z-0.022
+G1 X20.000 Y-8.400 Z-0.170
+G1 X21.000 Y-8.400 Z-0.313
+G1 X22.000 Y-8.400 Z-0.448
+G1 X23.000 Y-8.400 Z-0.569
+G1 X24.000 Y-8.400 Z-0.676
+G1 X25.000 Y-8.400 Z-0.763
+G1 X26.000 Y-8.400 Z-0.829
+G1 X27.000 Y-8.400 Z-0.873
+G1 X28.000 Y-8.400 Z-0.892
+G1 X29.000 Y-8.400 Z-0.886
+G1 X30.000 Y-8.400 Z-0.856
+G1 X30.000 Y-7.200 Z-1.002
+G1 X29.000 Y-7.200 Z-1.037
+G1 X28.000 Y-7.200 Z-1.044
+G1 X27.000 Y-7.200 Z-1.022
+G1 X26.000 Y-7.200 Z-0.971
+G1 X25.000 Y-7.200 Z-0.893
+G1 X24.000 Y-7.200 Z-0.791
+G1 X23.000 Y-7.200 Z-0.667
+G1 X22.000 Y-7.200 Z-0.524
+G1 X21.000 Y-7.200 Z-0.367
+G1 X20.000 Y-7.200 Z-0.199
+G1 X19.000 Y-7.200 Z-0.026
+G1 X18.000 Y-7.200 Z0.147
+G1 X17.000 Y-7.200 Z0.317
+G1 X16.000 Y-7.200 Z0.478
+G1 X15.000 Y-7.200 Z0.625
+G1 X14.000 Y-7.200 Z0.756
+G1 X13.000 Y-7.200 Z0.865
+G1 X12.000 Y-7.200 Z0.950
+G1 X11.000 Y-7.200 Z1.009
+G1 X10.000 Y-7.200 Z1.040
+G1 X9.000 Y-7.200 Z1.042
+G1 X8.000 Y-7.200 Z1.016
+G1 X7.000 Y-7.200 Z0.961
+G1 X6.000 Y-7.200 Z0.879
+G1 X5.000 Y-7.200 Z0.774
+G1 X4.000 Y-7.200 Z0.646
+G1 X3.000 Y-7.200 Z0.501
+G1 X2.000 Y-7.200 Z0.342
+G1 X1.000 Y-7.200 Z0.173
+G1 X0.000 Y-7.200 Z0.000
+G1 X-1.000 Y-7.200 Z-0.173
+G1 X-2.000 Y-7.200 Z-0.342
+G1 X-3.000 Y-7.200 Z-0.501
+G1 X-4.000 Y-7.200 Z-0.646
+G1 X-5.000 Y-7.200 Z-0.774
+G1 X-6.000 Y-7.200 Z-0.879
+G1 X-7.000 Y-7.200 Z-0.961
+G1 X-8.000 Y-7.200 Z-1.016
+G1 X-9.000 Y-7.200 Z-1.042
+G1 X-10.000 Y-7.200 Z-1.040
+G1 X-11.000 Y-7.200 Z-1.009
+G1 X-12.000 Y-7.200 Z-0.950
+G1 X-13.000 Y-7.200 Z-0.865
+G1 X-14.000 Y-7.200 Z-0.756
+G1 X-15.000 Y-7.200 Z-0.625
+G1 X-16.000 Y-7.200 Z-0.478
+G1 X-17.000 Y-7.200 Z-0.317
+G1 X-18.000 Y-7.200 Z-0.147
+G1 X-19.000 Y-7.200 Z0.026
+G1 X-20.000 Y-7.200 Z0.199
+G1 X-21.000 Y-7.200 Z0.367
+G1 X-22.000 Y-7.200 Z0.524
+G1 X-23.000 Y-7.200 Z0.667
+G1 X-24.000 Y-7.200 Z0.791
+G1 X-25.000 Y-7.200 Z0.893
+G1 X-26.000 Y-7.200 Z0.971
+G1 X-27.000 Y-7.200 Z1.022
+G1 X-28.000 Y-7.200 Z1.044
+G1 X-29.000 Y-7.200 Z1.037
+G1 X-30.000 Y-7.200 Z1.002
+G1 X-30.000 Y-6.000 Z1.130
+G1 X-29.000 Y-6.000 Z1.170
+G1 X-28.000 Y-6.000 Z1.178
+G1 X-27.000 Y-6.000 Z1.152
+G1 X-26.000 Y-6.000 Z1.095
+G1 X-25.000 Y-6.000 Z1.008
+G1 X-24.000 Y-6.000 Z0.892
+G1 X-23.000 Y-6.000 Z0.752
+G1 X-22.000 Y-6.000 Z0.591
+G1 X-21.000 Y-6.000 Z0.414
+G1 X-20.000 Y-6.000 Z0.225
+G1 X-19.000 Y-6.000 Z0.030
+G1 X-18.000 Y-6.000 Z-0.166
+G1 X-17.000 Y-6.000 Z-0.358
+G1 X-16.000 Y-6.000 Z-0.539
+G1 X-15.000 Y-6.000 Z-0.705
+G1 X-14.000 Y-6.000 Z-0.852
+G1 X-13.000 Y-6.000 Z-0.976
+G1 X-12.000 Y-6.000 Z-1.072
+G1 X-11.000 Y-6.000 Z-1.138
+G1 X-10.000 Y-6.000 Z-1.173
+G1 X-9.000 Y-6.000 Z-1.176
+G1 X-8.000 Y-6.000 Z-1.146
+G1 X-7.000 Y-6.000 Z-1.084
+G1 X-6.000 Y-6.000 Z-0.992
+G1 X-5.000 Y-6.000 Z-0.873
+G1 X-4.000 Y-6.000 Z-0.729
+G1 X-3.000 Y-6.000 Z-0.565
+G1 X-2.000 Y-6.000 Z-0.386
+G1 X-1.000 Y-6.000 Z-0.196
+G1 X0.000 Y-6.000 Z0.000
+G1 X1.000 Y-6.000 Z0.196
+G1 X2.000 Y-6.000 Z0.386
+G1 X3.000 Y-6.000 Z0.565
+G1 X4.000 Y-6.000 Z0.729
+G1 X5.000 Y-6.000 Z0.873
+G1 X6.000 Y-6.000 Z0.992
+G1 X7.000 Y-6.000 Z1.084
+G1 X8.000 Y-6.000 Z1.146
+G1 X9.000 Y-6.000 Z1.176
+G1 X10.000 Y-6.000 Z1.173
+G1 X11.000 Y-6.000 Z1.138
+G1 X12.000 Y-6.000 Z1.072
+G1 X13.000 Y-6.000 Z0.976
+G1 X14.000 Y-6.000 Z0.852
+G1 X15.000 Y-6.000 Z0.705
+G1 X16.000 Y-6.000 Z0.539
+G1 X17.000 Y-6.000 Z0.358
+G1 X18.000 Y-6.000 Z0.166
+G1 X19.000 Y-6.000 Z-0.030
+G1 X20.000 Y-6.000 Z-0.225
+G1 X21.000 Y-6.000 Z-0.414
+G1 X22.000 Y-6.000 Z-0.591
+G1 X23.000 Y-6.000 Z-0.752
+G1 X24.000 Y-6.000 Z-0.892
+G1 X25.000 Y-6.000 Z-1.008
+G1 X26.000 Y-6.000 Z-1.095
+G1 X27.000 Y-6.000 Z-1.152
+G1 X28.000 Y-6.000 Z-1.178
+G1 X29.000 Y-6.000 Z-1.170
+G1 X30.000 Y-6.000 Z-1.130
+G1 X30.000 Y-4.800 Z-1.239
+G1 X29.000 Y-4.800 Z-1.282
+G1 X28.000 Y-4.800 Z-1.290
+G1 X27.000 Y-4.800 Z-1.263
+G1 X26.000 Y-4.800 Z-1.200
+G1 X25.000 Y-4.800 Z-1.104
+G1 X24.000 Y-4.800 Z-0.978
+G1 X23.000 Y-4.800 Z-0.824
+G1 X22.000 Y-4.800 Z-0.647
+G1 X21.000 Y-4.800 Z-0.453
+G1 X20.000 Y-4.800 Z-0.246
+G1 X19.000 Y-4.800 Z-0.032
+G1 X18.000 Y-4.800 Z0.182
+G1 X17.000 Y-4.800 Z0.392
+G1 X16.000 Y-4.800 Z0.591
+G1 X15.000 Y-4.800 Z0.773
+G1 X14.000 Y-4.800 Z0.934
+G1 X13.000 Y-4.800 Z1.069
+G1 X12.000 Y-4.800 Z1.175
+G1 X11.000 Y-4.800 Z1.247
+G1 X10.000 Y-4.800 Z1.286
+G1 X9.000 Y-4.800 Z1.288
+G1 X8.000 Y-4.800 Z1.255
+G1 X7.000 Y-4.800 Z1.188
+G1 X6.000 Y-4.800 Z1.087
+G1 X5.000 Y-4.800 Z0.956
+G1 X4.000 Y-4.800 Z0.799
+G1 X3.000 Y-4.800 Z0.619
+G1 X2.000 Y-4.800 Z0.423
+G1 X1.000 Y-4.800 Z0.214
+G1 X0.000 Y-4.800 Z0.000
+G1 X-1.000 Y-4.800 Z-0.214
+G1 X-2.000 Y-4.800 Z-0.423
+G1 X-3.000 Y-4.800 Z-0.619
+G1 X-4.000 Y-4.800 Z-0.799
+G1 X-5.000 Y-4.800 Z-0.956
+G1 X-6.000 Y-4.800 Z-1.087
+G1 X-7.000 Y-4.800 Z-1.188
+G1 X-8.000 Y-4.800 Z-1.255
+G1 X-9.000 Y-4.800 Z-1.288
+G1 X-10.000 Y-4.800 Z-1.286
+G1 X-11.000 Y-4.800 Z-1.247
+G1 X-12.000 Y-4.800 Z-1.175
+G1 X-13.000 Y-4.800 Z-1.069
+G1 X-14.000 Y-4.800 Z-0.934
+G1 X-15.000 Y-4.800 Z-0.773
+G1 X-16.000 Y-4.800 Z-0.591
+G1 X-17.000 Y-4.800 Z-0.392
+G1 X-18.000 Y-4.800 Z-0.182
+G1 X-19.000 Y-4.800 Z0.032
+G1 X-20.000 Y-4.800 Z0.246
+G1 X-21.000 Y-4.800 Z0.453
+G1 X-22.000 Y-4.800 Z0.647
+G1 X-23.000 Y-4.800 Z0.824
+G1 X-24.000 Y-4.800 Z0.978
+G1 X-25.000 Y-4.800 Z1.104
+G1 X-26.000 Y-4.800 Z1.200
+G1 X-27.000 Y-4.800 Z1.263
+G1 X-28.000 Y-4.800 Z1.290
+G1 X-29.000 Y-4.800 Z1.282
+G1 X-30.000 Y-4.800 Z1.239
+G1 X-30.000 Y-3.600 Z1.325
+G1 X-29.000 Y-3.600 Z1.371
+G1 X-28.000 Y-3.600 Z1.380
+G1 X-27.000 Y-3.600 Z1.351
+G1 X-26.000 Y-3.600 Z1.284
+G1 X-25.000 Y-3.600 Z1.181
+G1 X-24.000 Y-3.600 Z1.046
+G1 X-23.000 Y-3.600 Z0.881
+G1 X-22.000 Y-3.600 Z0.693
+G1 X-21.000 Y-3.600 Z0.485
+G1 X-20.000 Y-3.600 Z0.263
+G1 X-19.000 Y-3.600 Z0.035
+G1 X-18.000 Y-3.600 Z-0.195
+G1 X-17.000 Y-3.600 Z-0.419
+G1 X-16.000 Y-3.600 Z-0.632
+G1 X-15.000 Y-3.600 Z-0.827
+G1 X-14.000 Y-3.600 Z-0.999
+G1 X-13.000 Y-3.600 Z-1.143
+G1 X-12.000 Y-3.600 Z-1.256
+G1 X-11.000 Y-3.600 Z-1.334
+G1 X-10.000 Y-3.600 Z-1.375
+G1 X-9.000 Y-3.600 Z-1.378
+G1 X-8.000 Y-3.600 Z-1.343
+G1 X-7.000 Y-3.600 Z-1.270
+G1 X-6.000 Y-3.600 Z-1.163
+G1 X-5.000 Y-3.600 Z-1.023
+G1 X-4.000 Y-3.600 Z-0.854
+G1 X-3.000 Y-3.600 Z-0.662
+G1 X-2.000 Y-3.600 Z-0.452
+G1 X-1.000 Y-3.600 Z-0.229
+G1 X0.000 Y-3.600 Z0.000
+G1 X1.000 Y-3.600 Z0.229
+G1 X2.000 Y-3.600 Z0.452
+G1 X3.000 Y-3.600 Z0.662
+G1 X4.000 Y-3.600 Z0.854
+G1 X5.000 Y-3.600 Z1.023
+G1 X6.000 Y-3.600 Z1.163
+G1 X7.000 Y-3.600 Z1.270
+G1 X8.000 Y-3.600 Z1.343
+G1 X9.000 Y-3.600 Z1.378
+G1 X10.000 Y-3.600 Z1.375
+G1 X11.000 Y-3.600 Z1.334
+G1 X12.000 Y-3.600 Z1.256
+G1 X13.000 Y-3.600 Z1.143
+G1 X14.000 Y-3.600 Z0.999
+G1 X15.000 Y-3.600 Z0.827
+G1 X16.000 Y-3.600 Z0.632
+G1 X17.000 Y-3.600 Z0.419
+G1 X18.000 Y-3.600 Z0.195
+G1 X19.000 Y-3.600 Z-0.035
+G1 X20.000 Y-3.600 Z-0.263
+G1 X21.000 Y-3.600 Z-0.485
+G1 X22.000 Y-3.600 Z-0.693
+G1 X23.000 Y-3.600 Z-0.881
+G1 X24.000 Y-3.600 Z-1.046
+G1 X25.000 Y-3.600 Z-1.181
+G1 X26.000 Y-3.600 Z-1.284
+G1 X27.000 Y-3.600 Z-1.351
+G1 X28.000 Y-3.600 Z-1.380
+G1 X29.000 Y-3.600 Z-1.371
+G1 X30.000 Y-3.600 Z-1.325
+G1 X30.000 Y-2.400 Z-1.388
+G1 X29.000 Y-2.400 Z-1.436
+G1 X28.000 Y-2.400 Z-1.445
+G1 X27.000 Y-2.400 Z-1.414
+G1 X26.000 Y-2.400 Z-1.344
+G1 X25.000 Y-2.400 Z-1.237
+G1 X24.000 Y-2.400 Z-1.095
+G1 X23.000 Y-2.400 Z-0.923
+G1 X22.000 Y-2.400 Z-0.725
+G1 X21.000 Y-2.400 Z-0.508
+G1 X20.000 Y-2.400 Z-0.276
+G1 X19.000 Y-2.400 Z-0.036
+G1 X18.000 Y-2.400 Z0.204
+G1 X17.000 Y-2.400 Z0.439
+G1 X16.000 Y-2.400 Z0.662
+G1 X15.000 Y-2.400 Z0.866
+G1 X14.000 Y-2.400 Z1.046
+G1 X13.000 Y-2.400 Z1.198
+G1 X12.000 Y-2.400 Z1.316
+G1 X11.000 Y-2.400 Z1.397
+G1 X10.000 Y-2.400 Z1.440
+G1 X9.000 Y-2.400 Z1.443
+G1 X8.000 Y-2.400 Z1.406
+G1 X7.000 Y-2.400 Z1.330
+G1 X6.000 Y-2.400 Z1.218
+G1 X5.000 Y-2.400 Z1.071
+G1 X4.000 Y-2.400 Z0.895
+G1 X3.000 Y-2.400 Z0.694
+G1 X2.000 Y-2.400 Z0.473
+G1 X1.000 Y-2.400 Z0.240
+G1 X0.000 Y-2.400 Z0.000
+G1 X-1.000 Y-2.400 Z-0.240
+G1 X-2.000 Y-2.400 Z-0.473
+G1 X-3.000 Y-2.400 Z-0.694
+G1 X-4.000 Y-2.400 Z-0.895
+G1 X-5.000 Y-2.400 Z-1.071
+G1 X-6.000 Y-2.400 Z-1.218
+G1 X-7.000 Y-2.400 Z-1.330
+G1 X-8.000 Y-2.400 Z-1.406
+G1 X-9.000 Y-2.400 Z-1.443
+G1 X-10.000 Y-2.400 Z-1.440
+G1 X-11.000 Y-2.400 Z-1.397
+G1 X-12.000 Y-2.400 Z-1.316
+G1 X-13.000 Y-2.400 Z-1.198
+G1 X-14.000 Y-2.400 Z-1.046
+G1 X-15.000 Y-2.400 Z-0.866
+G1 X-16.000 Y-2.400 Z-0.662
+G1 X-17.000 Y-2.400 Z-0.439
+G1 X-18.000 Y-2.400 Z-0.204
+G1 X-19.000 Y-2.400 Z0.036
+G1 X-20.000 Y-2.400 Z0.276
+G1 X-21.000 Y-2.400 Z0.508
+G1 X-22.000 Y-2.400 Z0.725
+G1 X-23.000 Y-2.400 Z0.923
+G1 X-24.000 Y-2.400 Z1.095
+G1 X-25.000 Y-2.400 Z1.237
+G1 X-26.000 Y-2.400 Z1.344
+G1 X-27.000 Y-2.400 Z1.414
+G1 X-28.000 Y-2.400 Z1.445
+G1 X-29.000 Y-2.400 Z1.436
+G1 X-30.000 Y-2.400 Z1.388
+G1 X-30.000 Y-1.200 Z1.426
+G1 X-29.000 Y-1.200 Z1.476
+G1 X-28.000 Y-1.200 Z1.485
+G1 X-27.000 Y-1.200 Z1.453
+G1 X-26.000 Y-1.200 Z1.381
+G1 X-25.000 Y-1.200 Z1.271
+G1 X-24.000 Y-1.200 Z1.125
+G1 X-23.000 Y-1.200 Z0.948
+G1 X-22.000 Y-1.200 Z0.745
+G1 X-21.000 Y-1.200 Z0.522
+G1 X-20.000 Y-1.200 Z0.283
+G1 X-19.000 Y-1.200 Z0.037
+G1 X-18.000 Y-1.200 Z-0.210
+G1 X-17.000 Y-1.200 Z-0.451
+G1 X-16.000 Y-1.200 Z-0.680
+G1 X-15.000 Y-1.200 Z-0.890
+G1 X-14.000 Y-1.200 Z-1.075
+G1 X-13.000 Y-1.200 Z-1.230
+G1 X-12.000 Y-1.200 Z-1.352
+G1 X-11.000 Y-1.200 Z-1.436
+G1 X-10.000 Y-1.200 Z-1.480
+G1 X-9.000 Y-1.200 Z-1.483
+G1 X-8.000 Y-1.200 Z-1.445
+G1 X-7.000 Y-1.200 Z-1.367
+G1 X-6.000 Y-1.200 Z-1.251
+G1 X-5.000 Y-1.200 Z-1.100
+G1 X-4.000 Y-1.200 Z-0.919
+G1 X-3.000 Y-1.200 Z-0.713
+G1 X-2.000 Y-1.200 Z-0.486
+G1 X-1.000 Y-1.200 Z-0.247
+G1 X0.000 Y-1.200 Z0.000
+G1 X1.000 Y-1.200 Z0.247
+G1 X2.000 Y-1.200 Z0.486
+G1 X3.000 Y-1.200 Z0.713
+G1 X4.000 Y-1.200 Z0.919
+G1 X5.000 Y-1.200 Z1.100
+G1 X6.000 Y-1.200 Z1.251
+G1 X7.000 Y-1.200 Z1.367
+G1 X8.000 Y-1.200 Z1.445
+G1 X9.000 Y-1.200 Z1.483
+G1 X10.000 Y-1.200 Z1.480
+G1 X11.000 Y-1.200 Z1.436
+G1 X12.000 Y-1.200 Z1.352
+G1 X13.000 Y-1.200 Z1.230
+G1 X14.000 Y-1.200 Z1.075
+G1 X15.000 Y-1.200 Z0.890
+G1 X16.000 Y-1.200 Z0.680
+G1 X17.000 Y-1.200 Z0.451
+G1 X18.000 Y-1.200 Z0.210
+G1 X19.000 Y-1.200 Z-0.037
+G1 X20.000 Y-1.200 Z-0.283
+G1 X21.000 Y-1.200 Z-0.522
+G1 X22.000 Y-1.200 Z-0.745
+G1 X23.000 Y-1.200 Z-0.948
+G1 X24.000 Y-1.200 Z-1.125
+G1 X25.000 Y-1.200 Z-1.271
+G1 X26.000 Y-1.200 Z-1.381
+G1 X27.000 Y-1.200 Z-1.453
+G1 X28.000 Y-1.200 Z-1.485
+G1 X29.000 Y-1.200 Z-1.476
+G1 X30.000 Y-1.200 Z-1.426
+G1 X30.000 Y0.000 Z-1.438
+G1 X29.000 Y0.000 Z-1.489
+G1 X28.000 Y0.000 Z-1.498
+G1 X27.000 Y0.000 Z-1.466
+G1 X26.000 Y0.000 Z-1.394
+G1 X25.000 Y0.000 Z-1.282
+G1 X24.000 Y0.000 Z-1.135
+G1 X23.000 Y0.000 Z-0.957
+G1 X22.000 Y0.000 Z-0.752
+G1 X21.000 Y0.000 Z-0.526
+G1 X20.000 Y0.000 Z-0.286
+G1 X19.000 Y0.000 Z-0.038
+G1 X18.000 Y0.000 Z0.212
+G1 X17.000 Y0.000 Z0.455
+G1 X16.000 Y0.000 Z0.686
+G1 X15.000 Y0.000 Z0.898
+G1 X14.000 Y0.000 Z1.085
+G1 X13.000 Y0.000 Z1.241
+G1 X12.000 Y0.000 Z1.364
+G1 X11.000 Y0.000 Z1.449
+G1 X10.000 Y0.000 Z1.493
+G1 X9.000 Y0.000 Z1.496
+G1 X8.000 Y0.000 Z1.458
+G1 X7.000 Y0.000 Z1.379
+G1 X6.000 Y0.000 Z1.262
+G1 X5.000 Y0.000 Z1.110
+G1 X4.000 Y0.000 Z0.928
+G1 X3.000 Y0.000 Z0.719
+G1 X2.000 Y0.000 Z0.491
+G1 X1.000 Y0.000 Z0.249
+G1 X0.000 Y0.000 Z0.000
+G1 X-1.000 Y0.000 Z-0.249
+G1 X-2.000 Y0.000 Z-0.491
+G1 X-3.000 Y0.000 Z-0.719
+G1 X-4.000 Y0.000 Z-0.928
+G1 X-5.000 Y0.000 Z-1.110
+G1 X-6.000 Y0.000 Z-1.262
+G1 X-7.000 Y0.000 Z-1.379
+G1 X-8.000 Y0.000 Z-1.458
+G1 X-9.000 Y0.000 Z-1.496
+G1 X-10.000 Y0.000 Z-1.493
+G1 X-11.000 Y0.000 Z-1.449
+G1 X-12.000 Y0.000 Z-1.364
+G1 X-13.000 Y0.000 Z-1.241
+G1 X-14.000 Y0.000 Z-1.085
+G1 X-15.000 Y0.000 Z-0.898
+G1 X-16.000 Y0.000 Z-0.686
+G1 X-17.000 Y0.000 Z-0.455
+G1 X-18.000 Y0.000 Z-0.212
+G1 X-19.000 Y0.000 Z0.038
+G1 X-20.000 Y0.000 Z0.286
+G1 X-21.000 Y0.000 Z0.526
+G1 X-22.000 Y0.000 Z0.752
+G1 X-23.000 Y0.000 Z0.957
+G1 X-24.000 Y0.000 Z1.135
+G1 X-25.000 Y0.000 Z1.282
+G1 X-26.000 Y0.000 Z1.394
+G1 X-27.000 Y0.000 Z1.466
+G1 X-28.000 Y0.000 Z1.498
+G1 X-29.000 Y0.000 Z1.489
+G1 X-30.000 Y0.000 Z1.438
+G1 X-30.000 Y1.200 Z1.426
+G1 X-29.000 Y1.200 Z1.476
+G1 X-28.000 Y1.200 Z1.485
+G1 X-27.000 Y1.200 Z1.453
+G1 X-26.000 Y1.200 Z1.381
+G1 X-25.000 Y1.200 Z1.271
+G1 X-24.000 Y1.200 Z1.125
+G1 X-23.000 Y1.200 Z0.948
+G1 X-22.000 Y1.200 Z0.745
+G1 X-21.000 Y1.200 Z0.522
+G1 X-20.000 Y1.200 Z0.283
+G1 X-19.000 Y1.200 Z0.037
+G1 X-18.000 Y1.200 Z-0.210
+G1 X-17.000 Y1.200 Z-0.451
+G1 X-16.000 Y1.200 Z-0.680
+G1 X-15.000 Y1.200 Z-0.890
+G1 X-14.000 Y1.200 Z-1.075
+G1 X-13.000 Y1.200 Z-1.230
+G1 X-12.000 Y1.200 Z-1.352
+G1 X-11.000 Y1.200 Z-1.436
+G1 X-10.000 Y1.200 Z-1.480
+G1 X-9.000 Y1.200 Z-1.483
+G1 X-8.000 Y1.200 Z-1.445
+G1 X-7.000 Y1.200 Z-1.367
+G1 X-6.000 Y1.200 Z-1.251
+G1 X-5.000 Y1.200 Z-1.100
+G1 X-4.000 Y1.200 Z-0.919
+G1 X-3.000 Y1.200 Z-0.713
+G1 X-2.000 Y1.200 Z-0.486
+G1 X-1.000 Y1.200 Z-0.247
+G1 X0.000 Y1.200 Z0.000
+G1 X1.000 Y1.200 Z0.247
+G1 X2.000 Y1.200 Z0.486
+G1 X3.000 Y1.200 Z0.713
+G1 X4.000 Y1.200 Z0.919
+G1 X5.000 Y1.200 Z1.100
+G1 X6.000 Y1.200 Z1.251
+G1 X7.000 Y1.200 Z1.367
+G1 X8.000 Y1.200 Z1.445
+G1 X9.000 Y1.200 Z1.483
+G1 X10.000 Y1.200 Z1.480
+G1 X11.000 Y1.200 Z1.436
+G1 X12.000 Y1.200 Z1.352
+G1 X13.000 Y1.200 Z1.230
+G1 X14.000 Y1.200 Z1.075
+G1 X15.000 Y1.200 Z0.890
+G1 X16.000 Y1.200 Z0.680
+G1 X17.000 Y1.200 Z0.451
+G1 X18.000 Y1.200 Z0.210
+G1 X19.000 Y1.200 Z-0.037
+G1 X20.000 Y1.200 Z-0.283
+G1 X21.000 Y1.200 Z-0.522
+G1 X22.000 Y1.200 Z-0.745
+G1 X23.000 Y1.200 Z-0.948
+G1 X24.000 Y1.200 Z-1.125
+G1 X25.000 Y1.200 Z-1.271
+G1 X26.000 Y1.200 Z-1.381
+G1 X27.000 Y1.200 Z-1.453
+G1 X28.000 Y1.200 Z-1.485
+G1 X29.000 Y1.200 Z-1.476
+G1 X30.000 Y1.200 Z-1.426
+G1 X30.000 Y2.400 Z-1.388
+G1 X29.000 Y2.400 Z-1.436
+G1 X28.000 Y2.400 Z-1.445
+G1 X27.000 Y2.400 Z-1.414
+G1 X26.000 Y2.400 Z-1.344
+G1 X25.000 Y2.400 Z-1.237
+G1 X24.000 Y2.400 Z-1.095
+G1 X23.000 Y2.400 Z-0.923
+G1 X22.000 Y2.400 Z-0.725
+G1 X21.000 Y2.400 Z-0.508
+G1 X20.000 Y2.400 Z-0.276
+G1 X19.000 Y2.400 Z-0.036
+G1 X18.000 Y2.400 Z0.204
+G1 X17.000 Y2.400 Z0.439
+G1 X16.000 Y2.400 Z0.662
+G1 X15.000 Y2.400 Z0.866
+G1 X14.000 Y2.400 Z1.046
+G1 X13.000 Y2.400 Z1.198
+G1 X12.000 Y2.400 Z1.316
+G1 X11.000 Y2.400 Z1.397
+G1 X10.000 Y2.400 Z1.440
+G1 X9.000 Y2.400 Z1.443
+G1 X8.000 Y2.400 Z1.406
+G1 X7.000 Y2.400 Z1.330
+G1 X6.000 Y2.400 Z1.218
+G1 X5.000 Y2.400 Z1.071
+G1 X4.000 Y2.400 Z0.895
+G1 X3.000 Y2.400 Z0.694
+G1 X2.000 Y2.400 Z0.473
+G1 X1.000 Y2.400 Z0.240
+G1 X0.000 Y2.400 Z0.000
+G1 X-1.000 Y2.400 Z-0.240
+G1 X-2.000 Y2.400 Z-0.473
+G1 X-3.000 Y2.400 Z-0.694
+G1 X-4.000 Y2.400 Z-0.895
+G1 X-5.000 Y2.400 Z-1.071
+G1 X-6.000 Y2.400 Z-1.218
+G1 X-7.000 Y2.400 Z-1.330
+G1 X-8.000 Y2.400 Z-1.406
+G1 X-9.000 Y2.400 Z-1.443
+G1 X-10.000 Y2.400 Z-1.440
+G1 X-11.000 Y2.400 Z-1.397
+G1 X-12.000 Y2.400 Z-1.316
+G1 X-13.000 Y2.400 Z-1.198
+G1 X-14.000 Y2.400 Z-1.046
+G1 X-15.000 Y2.400 Z-0.866
+G1 X-16.000 Y2.400 Z-0.662
+G1 X-17.000 Y2.400 Z-0.439
+G1 X-18.000 Y2.400 Z-0.204
+G1 X-19.000 Y2.400 Z0.036
+G1 X-20.000 Y2.400 Z0.276
+G1 X-21.000 Y2.400 Z0.508
+G1 X-22.000 Y2.400 Z0.725
+G1 X-23.000 Y2.400 Z0.923
+G1 X-24.000 Y2.400 Z1.095
+G1 X-25.000 Y2.400 Z1.237
+G1 X-26.000 Y2.400 Z1.344
+G1 X-27.000 Y2.400 Z1.414
+G1 X-28.000 Y2.400 Z1.445
+G1 X-29.000 Y2.400 Z1.436
+G1 X-30.000 Y2.400 Z1.388
+G1 X-30.000 Y3.600 Z1.325
+G1 X-29.000 Y3.600 Z1.371
+G1 X-28.000 Y3.600 Z1.380
+G1 X-27.000 Y3.600 Z1.351
+G1 X-26.000 Y3.600 Z1.284
+G1 X-25.000 Y3.600 Z1.181
+G1 X-24.000 Y3.600 Z1.046
+G1 X-23.000 Y3.600 Z0.881
+G1 X-22.000 Y3.600 Z0.693
+G1 X-21.000 Y3.600 Z0.485
+G1 X-20.000 Y3.600 Z0.263
+G1 X-19.000 Y3.600 Z0.035
+G1 X-18.000 Y3.600 Z-0.195
+G1 X-17.000 Y3.600 Z-0.419
+G1 X-16.000 Y3.600 Z-0.632
+G1 X-15.000 Y3.600 Z-0.827
+G1 X-14.000 Y3.600 Z-0.999
+G1 X-13.000 Y3.600 Z-1.143
+G1 X-12.000 Y3.600 Z-1.256
+G1 X-11.000 Y3.600 Z-1.334
+G1 X-10.000 Y3.600 Z-1.375
+G1 X-9.000 Y3.600 Z-1.378
+G1 X-8.000 Y3.600 Z-1.343
+G1 X-7.000 Y3.600 Z-1.270
+G1 X-6.000 Y3.600 Z-1.163
+G1 X-5.000 Y3.600 Z-1.023
+G1 X-4.000 Y3.600 Z-0.854
+G1 X-3.000 Y3.600 Z-0.662
+G1 X-2.000 Y3.600 Z-0.452
+G1 X-1.000 Y3.600 Z-0.229
+G1 X0.000 Y3.600 Z0.000
+G1 X1.000 Y3.600 Z0.229
+G1 X2.000 Y3.600 Z0.452
+G1 X3.000 Y3.600 Z0.662
+G1 X4.000 Y3.600 Z0.854
+G1 X5.000 Y3.600 Z1.023
+G1 X6.000 Y3.600 Z1.163
+G1 X7.000 Y3.600 Z1.270
+G1 X8.000 Y3.600 Z1.343
+G1 X9.000 Y3.600 Z1.378
+G1 X10.000 Y3.600 Z1.375
+G1 X11.000 Y3.600 Z1.334
+G1 X12.000 Y3.600 Z1.256
+G1 X13.000 Y3.600 Z1.143
+G1 X14.000 Y3.600 Z0.999
+G1 X15.000 Y3.600 Z0.827
+G1 X16.000 Y3.600 Z0.632
+G1 X17.000 Y3.600 Z0.419
+G1 X18.000 Y3.600 Z0.195
+G1 X19.000 Y3.600 Z-0.035
+G1 X20.000 Y3.600 Z-0.263
+G1 X21.000 Y3.600 Z-0.485
+G1 X22.000 Y3.600 Z-0.693
+G1 X23.000 Y3.600 Z-0.881
+G1 X24.000 Y3.600 Z-1.046
+G1 X25.000 Y3.600 Z-1.181
+G1 X26.000 Y3.600 Z-1.284
+G1 X27.000 Y3.600 Z-1.351
+G1 X28.000 Y3.600 Z-1.380
+G1 X29.000 Y3.600 Z-1.371
+G1 X30.000 Y3.600 Z-1.325
+G1 X30.000 Y4.800 Z-1.239
+G1 X29.000 Y4.800 Z-1.282
+G1 X28.000 Y4.800 Z-1.290
+G1 X27.000 Y4.800 Z-1.263
+G1 X26.000 Y4.800 Z-1.200
+G1 X25.000 Y4.800 Z-1.104
+G1 X24.000 Y4.800 Z-0.978
+G1 X23.000 Y4.800 Z-0.824
+G1 X22.000 Y4.800 Z-0.647
+G1 X21.000 Y4.800 Z-0.453
+G1 X20.000 Y4.800 Z-0.246
+G1 X19.000 Y4.800 Z-0.032
+G1 X18.000 Y4.800 Z0.182
+G1 X17.000 Y4.800 Z0.392
+G1 X16.000 Y4.800 Z0.591
+G1 X15.000 Y4.800 Z0.773
+G1 X14.000 Y4.800 Z0.934
+G1 X13.000 Y4.800 Z1.069
+G1 X12.000 Y4.800 Z1.175
+G1 X11.000 Y4.800 Z1.247
+G1 X10.000 Y4.800 Z1.286
+G1 X9.000 Y4.800 Z1.288
+G1 X8.000 Y4.800 Z1.255
+G1 X7.000 Y4.800 Z1.188
+G1 X6.000 Y4.800 Z1.087
+G1 X5.000 Y4.800 Z0.956
+G1 X4.000 Y4.800 Z0.799
+G1 X3.000 Y4.800 Z0.619
+G1 X2.000 Y4.800 Z0.423
+G1 X1.000 Y4.800 Z0.214
+G1 X0.000 Y4.800 Z0.000
+G1 X-1.000 Y4.800 Z-0.214
+G1 X-2.000 Y4.800 Z-0.423
+G1 X-3.000 Y4.800 Z-0.619
+G1 X-4.000 Y4.800 Z-0.799
+G1 X-5.000 Y4.800 Z-0.956
+G1 X-6.000 Y4.800 Z-1.087
+G1 X-7.000 Y4.800 Z-1.188
+G1 X-8.000 Y4.800 Z-1.255
+G1 X-9.000 Y4.800 Z-1.288
+G1 X-10.000 Y4.800 Z-1.286
+G1 X-11.000 Y4.800 Z-1.247
+G1 X-12.000 Y4.800 Z-1.175
+G1 X-13.000 Y4.800 Z-1.069
+G1 X-14.000 Y4.800 Z-0.934
+G1 X-15.000 Y4.800 Z-0.773
+G1 X-16.000 Y4.800 Z-0.591
+G1 X-17.000 Y4.800 Z-0.392
+G1 X-18.000 Y4.800 Z-0.182
+G1 X-19.000 Y4.800 Z0.032
+G1 X-20.000 Y4.800 Z0.246
+G1 X-21.000 Y4.800 Z0.453
+G1 X-22.000 Y4.800 Z0.647
+G1 X-23.000 Y4.800 Z0.824
+G1 X-24.000 Y4.800 Z0.978
+G1 X-25.000 Y4.800 Z1.104
+G1 X-26.000 Y4.800 Z1.200
+G1 X-27.000 Y4.800 Z1.263
+G1 X-28.000 Y4.800 Z1.290
+G1 X-29.000 Y4.800 Z1.282
+G1 X-30.000 Y4.800 Z1.239
+G1 X-30.000 Y6.000 Z1.130
+G1 X-29.000 Y6.000 Z1.170
+G1 X-28.000 Y6.000 Z1.178
+G1 X-27.000 Y6.000 Z1.152
+G1 X-26.000 Y6.000 Z1.095
+G1 X-25.000 Y6.000 Z1.008
+G1 X-24.000 Y6.000 Z0.892
+G1 X-23.000 Y6.000 Z0.752
+G1 X-22.000 Y6.000 Z0.591
+G1 X-21.000 Y6.000 Z0.414
+G1 X-20.000 Y6.000 Z0.225
+G1 X-19.000 Y6.000 Z0.030
+G1 X-18.000 Y6.000 Z-0.166
+G1 X-17.000 Y6.000 Z-0.358
+G1 X-16.000 Y6.000 Z-0.539
+G1 X-15.000 Y6.000 Z-0.705
+G1 X-14.000 Y6.000 Z-0.852
+G1 X-13.000 Y6.000 Z-0.976
+G1 X-12.000 Y6.000 Z-1.072
+G1 X-11.000 Y6.000 Z-1.138
+G1 X-10.000 Y6.000 Z-1.173
+G1 X-9.000 Y6.000 Z-1.176
+G1 X-8.000 Y6.000 Z-1.146
+G1 X-7.000 Y6.000 Z-1.084
+G1 X-6.000 Y6.000 Z-0.992
+G1 X-5.000 Y6.000 Z-0.873
+G1 X-4.000 Y6.000 Z-0.729
+G1 X-3.000 Y6.000 Z-0.565
+G1 X-2.000 Y6.000 Z-0.386
+G1 X-1.000 Y6.000 Z-0.196
+G1 X0.000 Y6.000 Z0.000
+G1 X1.000 Y6.000 Z0.196
+G1 X2.000 Y6.000 Z0.386
+G1 X3.000 Y6.000 Z0.565
+G1 X4.000 Y6.000 Z0.729
+G1 X5.000 Y6.000 Z0.873
+G1 X6.000 Y6.000 Z0.992
+G1 X7.000 Y6.000 Z1.084
+G1 X8.000 Y6.000 Z1.146
+G1 X9.000 Y6.000 Z1.176
+G1 X10.000 Y6.000 Z1.173
+G1 X11.000 Y6.000 Z1.138
+G1 X12.000 Y6.000 Z1.072
+G1 X13.000 Y6.000 Z0.976
+G1 X14.000 Y6.000 Z0.852
+G1 X15.000 Y6.000 Z0.705
+G1 X16.000 Y6.000 Z0.539
+G1 X17.000 Y6.000 Z0.358
+G1 X18.000 Y6.000 Z0.166
+G1 X19.000 Y6.000 Z-0.030
+G1 X20.000 Y6.000 Z-0.225
+G1 X21.000 Y6.000 Z-0.414
+G1 X22.000 Y6.000 Z-0.591
+G1 X23.000 Y6.000 Z-0.752
+G1 X24.000 Y6.000 Z-0.892
+G1 X25.000 Y6.000 Z-1.008
+G1 X26.000 Y6.000 Z-1.095
+G1 X27.000 Y6.000 Z-1.152
+G1 X28.000 Y6.000 Z-1.178
+G1 X29.000 Y6.000 Z-1.170
+G1 X30.000 Y6.000 Z-1.130
+G1 X30.000 Y7.200 Z-1.002
+G1 X29.000 Y7.200 Z-1.037
+G1 X28.000 Y7.200 Z-1.044
+G1 X27.000 Y7.200 Z-1.022
+G1 X26.000 Y7.200 Z-0.971
+G1 X25.000 Y7.200 Z-0.893
+G1 X24.000 Y7.200 Z-0.791
+G1 X23.000 Y7.200 Z-0.667
+G1 X22.000 Y7.200 Z-0.524
+G1 X21.000 Y7.200 Z-0.367
+G1 X20.000 Y7.200 Z-0.199
+G1 X19.000 Y7.200 Z-0.026
+G1 X18.000 Y7.200 Z0.147
+G1 X17.000 Y7.200 Z0.317
+G1 X16.000 Y7.200 Z0.478
+G1 X15.000 Y7.200 Z0.625
+G1 X14.000 Y7.200 Z0.756
+G1 X13.000 Y7.200 Z0.865
+G1 X12.000 Y7.200 Z0.950
+G1 X11.000 Y7.200 Z1.009
+G1 X10.000 Y7.200 Z1.040
+G1 X9.000 Y7.200 Z1.042
+G1 X8.000 Y7.200 Z1.016
+G1 X7.000 Y7.200 Z0.961
+G1 X6.000 Y7.200 Z0.879
+G1 X5.000 Y7.200 Z0.774
+G1 X4.000 Y7.200 Z0.646
+G1 X3.000 Y7.200 Z0.501
+G1 X2.000 Y7.200 Z0.342
+G1 X1.000 Y7.200 Z0.173
+G1 X0.000 Y7.200 Z0.000
+G1 X-1.000 Y7.200 Z-0.173
+G1 X-2.000 Y7.200 Z-0.342
+G1 X-3.000 Y7.200 Z-0.501
+G1 X-4.000 Y7.200 Z-0.646
+G1 X-5.000 Y7.200 Z-0.774
+G1 X-6.000 Y7.200 Z-0.879
+G1 X-7.000 Y7.200 Z-0.961
+G1 X-8.000 Y7.200 Z-1.016
+G1 X-9.000 Y7.200 Z-1.042
+G1 X-10.000 Y7.200 Z-1.040
+G1 X-11.000 Y7.200 Z-1.009
+G1 X-12.000 Y7.200 Z-0.950
+G1 X-13.000 Y7.200 Z-0.865
+G1 X-14.000 Y7.200 Z-0.756
+G1 X-15.000 Y7.200 Z-0.625
+G1 X-16.000 Y7.200 Z-0.478
+G1 X-17.000 Y7.200 Z-0.317
+G1 X-18.000 Y7.200 Z-0.147
+G1 X-19.000 Y7.200 Z0.026
+G1 X-20.000 Y7.200 Z0.199
+G1 X-21.000 Y7.200 Z0.367
+G1 X-22.000 Y7.200 Z0.524
+G1 X-23.000 Y7.200 Z0.667
+G1 X-24.000 Y7.200 Z0.791
+G1 X-25.000 Y7.200 Z0.893
+G1 X-26.000 Y7.200 Z0.971
+G1 X-27.000 Y7.200 Z1.022
+G1 X-28.000 Y7.200 Z1.044
+G1 X-29.000 Y7.200 Z1.037
+G1 X-30.000 Y7.200 Z1.002
+G1 X-30.000 Y8.400 Z0.856
+G1 X-29.000 Y8.400 Z0.886
+G1 X-28.000 Y8.400 Z0.892
+G1 X-27.000 Y8.400 Z0.873
+G1 X-26.000 Y8.400 Z0.829
+G1 X-25.000 Y8.400 Z0.763
+G1 X-24.000 Y8.400 Z0.676
+G1 X-23.000 Y8.400 Z0.569
+G1 X-22.000 Y8.400 Z0.448
+G1 X-21.000 Y8.400 Z0.313
+G1 X-20.000 Y8.400 Z0.170
+G1 X-19.000 Y8.400 Z0.022
+G1 X-18.000 Y8.400 Z-0.126
+G1 X-17.000 Y8.400 Z-0.271
+G1 X-16.000 Y8.400 Z-0.408
+G1 X-15.000 Y8.400 Z-0.534
+G1 X-14.000 Y8.400 Z-0.646
+G1 X-13.000 Y8.400 Z-0.739
+G1 X-12.000 Y8.400 Z-0.812
+G1 X-11.000 Y8.400 Z-0.862
+G1 X-10.000 Y8.400 Z-0.889
+G1 X-9.000 Y8.400 Z-0.891
+G1 X-8.000 Y8.400 Z-0.868
+G1 X-7.000 Y8.400 Z-0.821
+G1 X-6.000 Y8.400 Z-0.751
+G1 X-5.000 Y8.400 Z-0.661
+G1 X-4.000 Y8.400 Z-0.552
+G1 X-3.000 Y8.400 Z-0.428
+G1 X-2.000 Y8.400 Z-0.292
+G1 X-1.000 Y8.400 Z-0.148
+G1 X0.000 Y8.400 Z0.000
+G1 X1.000 Y8.400 Z0.148
+G1 X2.000 Y8.400 Z0.292
+G1 X3.000 Y8.400 Z0.428
+G1 X4.000 Y8.400 Z0.552
+G1 X5.000 Y8.400 Z0.661
+G1 X6.000 Y8.400 Z0.751
+G1 X7.000 Y8.400 Z0.821
+G1 X8.000 Y8.400 Z0.868
+G1 X9.000 Y8.400 Z0.891
+G1 X10.000 Y8.400 Z0.889
+G1 X11.000 Y8.400 Z0.862
+G1 X12.000 Y8.400 Z0.812
+G1 X13.000 Y8.400 Z0.739
+G1 X14.000 Y8.400 Z0.646
+G1 X15.000 Y8.400 Z0.534
+G1 X16.000 Y8.400 Z0.408
+G1 X17.000 Y8.400 Z0.271
+G1 X18.000 Y8.400 Z0.126
+G1 X19.000 Y8.400 Z-0.022
+G1 X20.000 Y8.400 Z-0.170
+G1 X21.000 Y8.400 Z-0.313
+G1 X22.000 Y8.400 Z-0.448
+G1 X23.000 Y8.400 Z-0.569
+G1 X24.000 Y8.400 Z-0.676
+G1 X25.000 Y8.400 Z-0.763
+G1 X26.000 Y8.400 Z-0.829
+G1 X27.000 Y8.400 Z-0.873
+G1 X28.000 Y8.400 Z-0.892
+G1 X29.000 Y8.400 Z-0.886
+G1 X30.000 Y8.400 Z-0.856
+G1 X30.000 Y9.600 Z-0.695
+G1 X29.000 Y9.600 Z-0.719
+G1 X28.000 Y9.600 Z-0.724
+G1 X27.000 Y9.600 Z-0.708
+G1 X26.000 Y9.600 Z-0.673
+G1 X25.000 Y9.600 Z-0.619
+G1 X24.000 Y9.600 Z-0.548
+G1 X23.000 Y9.600 Z-0.462
+G1 X22.000 Y9.600 Z-0.363
+G1 X21.000 Y9.600 Z-0.254
+G1 X20.000 Y9.600 Z-0.138
+G1 X19.000 Y9.600 Z-0.018
+G1 X18.000 Y9.600 Z0.102
+G1 X17.000 Y9.600 Z0.220
+G1 X16.000 Y9.600 Z0.331
+G1 X15.000 Y9.600 Z0.434
+G1 X14.000 Y9.600 Z0.524
+G1 X13.000 Y9.600 Z0.600
+G1 X12.000 Y9.600 Z0.659
+G1 X11.000 Y9.600 Z0.700
+G1 X10.000 Y9.600 Z0.721
+G1 X9.000 Y9.600 Z0.723
+G1 X8.000 Y9.600 Z0.704
+G1 X7.000 Y9.600 Z0.666
+G1 X6.000 Y9.600 Z0.610
+G1 X5.000 Y9.600 Z0.536
+G1 X4.000 Y9.600 Z0.448
+G1 X3.000 Y9.600 Z0.347
+G1 X2.000 Y9.600 Z0.237
+G1 X1.000 Y9.600 Z0.120
+G1 X0.000 Y9.600 Z0.000
+G1 X-1.000 Y9.600 Z-0.120
+G1 X-2.000 Y9.600 Z-0.237
+G1 X-3.000 Y9.600 Z-0.347
+G1 X-4.000 Y9.600 Z-0.448
+G1 X-5.000 Y9.600 Z-0.536
+G1 X-6.000 Y9.600 Z-0.610
+G1 X-7.000 Y9.600 Z-0.666
+G1 X-8.000 Y9.600 Z-0.704
+G1 X-9.000 Y9.600 Z-0.723
+G1 X-10.000 Y9.600 Z-0.721
+G1 X-11.000 Y9.600 Z-0.700
+G1 X-12.000 Y9.600 Z-0.659
+G1 X-13.000 Y9.600 Z-0.600
+G1 X-14.000 Y9.600 Z-0.524
+G1 X-15.000 Y9.600 Z-0.434
+G1 X-16.000 Y9.600 Z-0.331
+G1 X-17.000 Y9.600 Z-0.220
+G1 X-18.000 Y9.600 Z-0.102
+G1 X-19.000 Y9.600 Z0.018
+G1 X-20.000 Y9.600 Z0.138
+G1 X-21.000 Y9.600 Z0.254
+G1 X-22.000 Y9.600 Z0.363
+G1 X-23.000 Y9.600 Z0.462
+G1 X-24.000 Y9.600 Z0.548
+G1 X-25.000 Y9.600 Z0.619
+G1 X-26.000 Y9.600 Z0.673
+G1 X-27.000 Y9.600 Z0.708
+G1 X-28.000 Y9.600 Z0.724
+G1 X-29.000 Y9.600 Z0.719
+G1 X-30.000 Y9.600 Z0.695
+G1 X-30.000 Y10.800 Z0.521
+G1 X-29.000 Y10.800 Z0.540
+G1 X-28.000 Y10.800 Z0.543
+G1 X-27.000 Y10.800 Z0.531
+G1 X-26.000 Y10.800 Z0.505
+G1 X-25.000 Y10.800 Z0.465
+G1 X-24.000 Y10.800 Z0.411
+G1 X-23.000 Y10.800 Z0.347
+G1 X-22.000 Y10.800 Z0.272
+G1 X-21.000 Y10.800 Z0.191
+G1 X-20.000 Y10.800 Z0.104
+G1 X-19.000 Y10.800 Z0.014
+G1 X-18.000 Y10.800 Z-0.077
+G1 X-17.000 Y10.800 Z-0.165
+G1 X-16.000 Y10.800 Z-0.249
+G1 X-15.000 Y10.800 Z-0.325
+G1 X-14.000 Y10.800 Z-0.393
+G1 X-13.000 Y10.800 Z-0.450
+G1 X-12.000 Y10.800 Z-0.494
+G1 X-11.000 Y10.800 Z-0.525
+G1 X-10.000 Y10.800 Z-0.541
+G1 X-9.000 Y10.800 Z-0.542
+G1 X-8.000 Y10.800 Z-0.528
+G1 X-7.000 Y10.800 Z-0.500
+G1 X-6.000 Y10.800 Z-0.457
+G1 X-5.000 Y10.800 Z-0.402
+G1 X-4.000 Y10.800 Z-0.336
+G1 X-3.000 Y10.800 Z-0.261
+G1 X-2.000 Y10.800 Z-0.178
+G1 X-1.000 Y10.800 Z-0.090
+G1 X0.000 Y10.800 Z0.000
+G1 X1.000 Y10.800 Z0.090
+G1 X2.000 Y10.800 Z0.178
+G1 X3.000 Y10.800 Z0.261
+G1 X4.000 Y10.800 Z0.336
+G1 X5.000 Y10.800 Z0.402
+G1 X6.000 Y10.800 Z0.457
+G1 X7.000 Y10.800 Z0.500
+G1 X8.000 Y10.800 Z0.528
+G1 X9.000 Y10.800 Z0.542
+G1 X10.000 Y10.800 Z0.541
+G1 X11.000 Y10.800 Z0.525
+G1 X12.000 Y10.800 Z0.494
+G1 X13.000 Y10.800 Z0.450
+G1 X14.000 Y10.800 Z0.393
+G1 X15.000 Y10.800 Z0.325
+G1 X16.000 Y10.800 Z0.249
+G1 X17.000 Y10.800 Z0.165
+G1 X18.000 Y10.800 Z0.077
+G1 X19.000 Y10.800 Z-0.014
+G1 X20.000 Y10.800 Z-0.104
+G1 X21.000 Y10.800 Z-0.191
+G1 X22.000 Y10.800 Z-0.272
+G1 X23.000 Y10.800 Z-0.347
+G1 X24.000 Y10.800 Z-0.411
+G1 X25.000 Y10.800 Z-0.465
+G1 X26.000 Y10.800 Z-0.505
+G1 X27.000 Y10.800 Z-0.531
+G1 X28.000 Y10.800 Z-0.543
+G1 X29.000 Y10.800 Z-0.540
+G1 X30.000 Y10.800 Z-0.521
+G1 X30.000 Y12.000 Z-0.338
+G1 X29.000 Y12.000 Z-0.350
+G1 X28.000 Y12.000 Z-0.352
+G1 X27.000 Y12.000 Z-0.345
+G1 X26.000 Y12.000 Z-0.328
+G1 X25.000 Y12.000 Z-0.302
+G1 X24.000 Y12.000 Z-0.267
+G1 X23.000 Y12.000 Z-0.225
+G1 X22.000 Y12.000 Z-0.177
+G1 X21.000 Y12.000 Z-0.124
+G1 X20.000 Y12.000 Z-0.067
+G1 X19.000 Y12.000 Z-0.009
+G1 X18.000 Y12.000 Z0.050
+G1 X17.000 Y12.000 Z0.107
+G1 X16.000 Y12.000 Z0.161
+G1 X15.000 Y12.000 Z0.211
+G1 X14.000 Y12.000 Z0.255
+G1 X13.000 Y12.000 Z0.292
+G1 X12.000 Y12.000 Z0.321
+G1 X11.000 Y12.000 Z0.341
+G1 X10.000 Y12.000 Z0.351
+G1 X9.000 Y12.000 Z0.352
+G1 X8.000 Y12.000 Z0.343
+G1 X7.000 Y12.000 Z0.324
+G1 X6.000 Y12.000 Z0.297
+G1 X5.000 Y12.000 Z0.261
+G1 X4.000 Y12.000 Z0.218
+G1 X3.000 Y12.000 Z0.169
+G1 X2.000 Y12.000 Z0.115
+G1 X1.000 Y12.000 Z0.059
+G1 X0.000 Y12.000 Z0.000
+G1 X-1.000 Y12.000 Z-0.059
+G1 X-2.000 Y12.000 Z-0.115
+G1 X-3.000 Y12.000 Z-0.169
+G1 X-4.000 Y12.000 Z-0.218
+G1 X-5.000 Y12.000 Z-0.261
+G1 X-6.000 Y12.000 Z-0.297
+G1 X-7.000 Y12.000 Z-0.324
+G1 X-8.000 Y12.000 Z-0.343
+G1 X-9.000 Y12.000 Z-0.352
+G1 X-10.000 Y12.000 Z-0.351
+G1 X-11.000 Y12.000 Z-0.341
+G1 X-12.000 Y12.000 Z-0.321
+G1 X-13.000 Y12.000 Z-0.292
+G1 X-14.000 Y12.000 Z-0.255
+G1 X-15.000 Y12.000 Z-0.211
+G1 X-16.000 Y12.000 Z-0.161
+G1 X-17.000 Y12.000 Z-0.107
+G1 X-18.000 Y12.000 Z-0.050
+G1 X-19.000 Y12.000 Z0.009
+G1 X-20.000 Y12.000 Z0.067
+G1 X-21.000 Y12.000 Z0.124
+G1 X-22.000 Y12.000 Z0.177
+G1 X-23.000 Y12.000 Z0.225
+G1 X-24.000 Y12.000 Z0.267
+G1 X-25.000 Y12.000 Z0.302
+G1 X-26.000 Y12.000 Z0.328
+G1 X-27.000 Y12.000 Z0.345
+G1 X-28.000 Y12.000 Z0.352
+G1 X-29.000 Y12.000 Z0.350
+G1 X-30.000 Y12.000 Z0.338
+G1 X-30.000 Y13.200 Z0.150
+G1 X-29.000 Y13.200 Z0.155
+G1 X-28.000 Y13.200 Z0.156
+G1 X-27.000 Y13.200 Z0.152
+G1 X-26.000 Y13.200 Z0.145
+G1 X-25.000 Y13.200 Z0.133
+G1 X-24.000 Y13.200 Z0.118
+G1 X-23.000 Y13.200 Z0.099
+G1 X-22.000 Y13.200 Z0.078
+G1 X-21.000 Y13.200 Z0.055
+G1 X-20.000 Y13.200 Z0.030
+G1 X-19.000 Y13.200 Z0.004
+G1 X-18.000 Y13.200 Z-0.022
+G1 X-17.000 Y13.200 Z-0.047
+G1 X-16.000 Y13.200 Z-0.071
+G1 X-15.000 Y13.200 Z-0.093
+G1 X-14.000 Y13.200 Z-0.113
+G1 X-13.000 Y13.200 Z-0.129
+G1 X-12.000 Y13.200 Z-0.142
+G1 X-11.000 Y13.200 Z-0.151
+G1 X-10.000 Y13.200 Z-0.155
+G1 X-9.000 Y13.200 Z-0.156
+G1 X-8.000 Y13.200 Z-0.152
+G1 X-7.000 Y13.200 Z-0.143
+G1 X-6.000 Y13.200 Z-0.131
+G1 X-5.000 Y13.200 Z-0.115
+G1 X-4.000 Y13.200 Z-0.096
+G1 X-3.000 Y13.200 Z-0.075
+G1 X-2.000 Y13.200 Z-0.051
+G1 X-1.000 Y13.200 Z-0.026
+G1 X0.000 Y13.200 Z0.000
+G1 X1.000 Y13.200 Z0.026
+G1 X2.000 Y13.200 Z0.051
+G1 X3.000 Y13.200 Z0.075
+G1 X4.000 Y13.200 Z0.096
+G1 X5.000 Y13.200 Z0.115
+G1 X6.000 Y13.200 Z0.131
+G1 X7.000 Y13.200 Z0.143
+G1 X8.000 Y13.200 Z0.152
+G1 X9.000 Y13.200 Z0.156
+G1 X10.000 Y13.200 Z0.155
+G1 X11.000 Y13.200 Z0.151
+G1 X12.000 Y13.200 Z0.142
+G1 X13.000 Y13.200 Z0.129
+G1 X14.000 Y13.200 Z0.113
+G1 X15.000 Y13.200 Z0.093
+G1 X16.000 Y13.200 Z0.071
+G1 X17.000 Y13.200 Z0.047
+G1 X18.000 Y13.200 Z0.022
+G1 X19.000 Y13.200 Z-0.004
+G1 X20.000 Y13.200 Z-0.030
+G1 X21.000 Y13.200 Z-0.055
+G1 X22.000 Y13.200 Z-0.078
+G1 X23.000 Y13.200 Z-0.099
+G1 X24.000 Y13.200 Z-0.118
+G1 X25.000 Y13.200 Z-0.133
+G1 X26.000 Y13.200 Z-0.145
+G1 X27.000 Y13.200 Z-0.152
+G1 X28.000 Y13.200 Z-0.156
+G1 X29.000 Y13.200 Z-0.155
+G1 X30.000 Y13.200 Z-0.150
+G1 X30.000 Y14.400 Z0.042
+G1 X29.000 Y14.400 Z0.043
+G1 X28.000 Y14.400 Z0.044
+G1 X27.000 Y14.400 Z0.043
+G1 X26.000 Y14.400 Z0.041
+G1 X25.000 Y14.400 Z0.037
+G1 X24.000 Y14.400 Z0.033
+G1 X23.000 Y14.400 Z0.028
+G1 X22.000 Y14.400 Z0.022
+G1 X21.000 Y14.400 Z0.015
+G1 X20.000 Y14.400 Z0.008
+G1 X19.000 Y14.400 Z0.001
+G1 X18.000 Y14.400 Z-0.006
+G1 X17.000 Y14.400 Z-0.013
+G1 X16.000 Y14.400 Z-0.020
+G1 X15.000 Y14.400 Z-0.026
+G1 X14.000 Y14.400 Z-0.032
+G1 X13.000 Y14.400 Z-0.036
+G1 X12.000 Y14.400 Z-0.040
+G1 X11.000 Y14.400 Z-0.042
+G1 X10.000 Y14.400 Z-0.044
+G1 X9.000 Y14.400 Z-0.044
+G1 X8.000 Y14.400 Z-0.043
+G1 X7.000 Y14.400 Z-0.040
+G1 X6.000 Y14.400 Z-0.037
+G1 X5.000 Y14.400 Z-0.032
+G1 X4.000 Y14.400 Z-0.027
+G1 X3.000 Y14.400 Z-0.021
+G1 X2.000 Y14.400 Z-0.014
+G1 X1.000 Y14.400 Z-0.007
+G1 X0.000 Y14.400 Z-0.000
+G1 X-1.000 Y14.400 Z0.007
+G1 X-2.000 Y14.400 Z0.014
+G1 X-3.000 Y14.400 Z0.021
+G1 X-4.000 Y14.400 Z0.027
+G1 X-5.000 Y14.400 Z0.032
+G1 X-6.000 Y14.400 Z0.037
+G1 X-7.000 Y14.400 Z0.040
+G1 X-8.000 Y14.400 Z0.043
+G1 X-9.000 Y14.400 Z0.044
+G1 X-10.000 Y14.400 Z0.044
+G1 X-11.000 Y14.400 Z0.042
+G1 X-12.000 Y14.400 Z0.040
+G1 X-13.000 Y14.400 Z0.036
+G1 X-14.000 Y14.400 Z0.032
+G1 X-15.000 Y14.400 Z0.026
+G1 X-16.000 Y14.400 Z0.020
+G1 X-17.000 Y14.400 Z0.013
+G1 X-18.000 Y14.400 Z0.006
+G1 X-19.000 Y14.400 Z-0.001
+G1 X-20.000 Y14.400 Z-0.008
+G1 X-21.000 Y14.400 Z-0.015
+G1 X-22.000 Y14.400 Z-0.022
+G1 X-23.000 Y14.400 Z-0.028
+G1 X-24.000 Y14.400 Z-0.033
+G1 X-25.000 Y14.400 Z-0.037
+G1 X-26.000 Y14.400 Z-0.041
+G1 X-27.000 Y14.400 Z-0.043
+G1 X-28.000 Y14.400 Z-0.044
+G1 X-29.000 Y14.400 Z-0.043
+G1 X-30.000 Y14.400 Z-0.042
+G1 X-30.000 Y15.600 Z-0.233
+G1 X-29.000 Y15.600 Z-0.241
+G1 X-28.000 Y15.600 Z-0.242
+G1 X-27.000 Y15.600 Z-0.237
+G1 X-26.000 Y15.600 Z-0.226
+G1 X-25.000 Y15.600 Z-0.207
+G1 X-24.000 Y15.600 Z-0.184
+G1 X-23.000 Y15.600 Z-0.155
+G1 X-22.000 Y15.600 Z-0.122
+G1 X-21.000 Y15.600 Z-0.085
+G1 X-20.000 Y15.600 Z-0.046
+G1 X-19.000 Y15.600 Z-0.006
+G1 X-18.000 Y15.600 Z0.034
+G1 X-17.000 Y15.600 Z0.074
+G1 X-16.000 Y15.600 Z0.111
+G1 X-15.000 Y15.600 Z0.145
+G1 X-14.000 Y15.600 Z0.176
+G1 X-13.000 Y15.600 Z0.201
+G1 X-12.000 Y15.600 Z0.221
+G1 X-11.000 Y15.600 Z0.234
+G1 X-10.000 Y15.600 Z0.242
+G1 X-9.000 Y15.600 Z0.242
+G1 X-8.000 Y15.600 Z0.236
+G1 X-7.000 Y15.600 Z0.223
+G1 X-6.000 Y15.600 Z0.204
+G1 X-5.000 Y15.600 Z0.180
+G1 X-4.000 Y15.600 Z0.150
+G1 X-3.000 Y15.600 Z0.116
+G1 X-2.000 Y15.600 Z0.079
+G1 X-1.000 Y15.600 Z0.040
+G1 X0.000 Y15.600 Z-0.000
+G1 X1.000 Y15.600 Z-0.040
+G1 X2.000 Y15.600 Z-0.079
+G1 X3.000 Y15.600 Z-0.116
+G1 X4.000 Y15.600 Z-0.150
+G1 X5.000 Y15.600 Z-0.180
+G1 X6.000 Y15.600 Z-0.204
+G1 X7.000 Y15.600 Z-0.223
+G1 X8.000 Y15.600 Z-0.236
+G1 X9.000 Y15.600 Z-0.242
+G1 X10.000 Y15.600 Z-0.242
+G1 X11.000 Y15.600 Z-0.234
+G1 X12.000 Y15.600 Z-0.221
+G1 X13.000 Y15.600 Z-0.201
+G1 X14.000 Y15.600 Z-0.176
+G1 X15.000 Y15.600 Z-0.145
+G1 X16.000 Y15.600 Z-0.111
+G1 X17.000 Y15.600 Z-0.074
+G1 X18.000 Y15.600 Z-0.034
+G1 X19.000 Y15.600 Z0.006
+G1 X20.000 Y15.600 Z0.046
+G1 X21.000 Y15.600 Z0.085
+G1 X22.000 Y15.600 Z0.122
+G1 X23.000 Y15.600 Z0.155
+G1 X24.000 Y15.600 Z0.184
+G1 X25.000 Y15.600 Z0.207
+G1 X26.000 Y15.600 Z0.226
+G1 X27.000 Y15.600 Z0.237
+G1 X28.000 Y15.600 Z0.242
+G1 X29.000 Y15.600 Z0.241
+G1 X30.000 Y15.600 Z0.233
+G1 X30.000 Y16.800 Z0.419
+G1 X29.000 Y16.800 Z0.434
+G1 X28.000 Y16.800 Z0.437
+G1 X27.000 Y16.800 Z0.428
+G1 X26.000 Y16.800 Z0.406
+G1 X25.000 Y16.800 Z0.374
+G1 X24.000 Y16.800 Z0.331
+G1 X23.000 Y16.800 Z0.279
+G1 X22.000 Y16.800 Z0.219
+G1 X21.000 Y16.800 Z0.153
+G1 X20.000 Y16.800 Z0.083
+G1 X19.000 Y16.800 Z0.011
+G1 X18.000 Y16.800 Z-0.062
+G1 X17.000 Y16.800 Z-0.133
+G1 X16.000 Y16.800 Z-0.200
+G1 X15.000 Y16.800 Z-0.262
+G1 X14.000 Y16.800 Z-0.316
+G1 X13.000 Y16.800 Z-0.362
+G1 X12.000 Y16.800 Z-0.398
+G1 X11.000 Y16.800 Z-0.422
+G1 X10.000 Y16.800 Z-0.435
+G1 X9.000 Y16.800 Z-0.436
+G1 X8.000 Y16.800 Z-0.425
+G1 X7.000 Y16.800 Z-0.402
+G1 X6.000 Y16.800 Z-0.368
+G1 X5.000 Y16.800 Z-0.324
+G1 X4.000 Y16.800 Z-0.270
+G1 X3.000 Y16.800 Z-0.210
+G1 X2.000 Y16.800 Z-0.143
+G1 X1.000 Y16.800 Z-0.073
+G1 X0.000 Y16.800 Z-0.000
+G1 X-1.000 Y16.800 Z0.073
+G1 X-2.000 Y16.800 Z0.143
+G1 X-3.000 Y16.800 Z0.210
+G1 X-4.000 Y16.800 Z0.270
+G1 X-5.000 Y16.800 Z0.324
+G1 X-6.000 Y16.800 Z0.368
+G1 X-7.000 Y16.800 Z0.402
+G1 X-8.000 Y16.800 Z0.425
+G1 X-9.000 Y16.800 Z0.436
+G1 X-10.000 Y16.800 Z0.435
+G1 X-11.000 Y16.800 Z0.422
+G1 X-12.000 Y16.800 Z0.398
+G1 X-13.000 Y16.800 Z0.362
+G1 X-14.000 Y16.800 Z0.316
+G1 X-15.000 Y16.800 Z0.262
+G1 X-16.000 Y16.800 Z0.200
+G1 X-17.000 Y16.800 Z0.133
+G1 X-18.000 Y16.800 Z0.062
+G1 X-19.000 Y16.800 Z-0.011
+G1 X-20.000 Y16.800 Z-0.083
+G1 X-21.000 Y16.800 Z-0.153
+G1 X-22.000 Y16.800 Z-0.219
+G1 X-23.000 Y16.800 Z-0.279
+G1 X-24.000 Y16.800 Z-0.331
+G1 X-25.000 Y16.800 Z-0.374
+G1 X-26.000 Y16.800 Z-0.406
+G1 X-27.000 Y16.800 Z-0.428
+G1 X-28.000 Y16.800 Z-0.437
+G1 X-29.000 Y16.800 Z-0.434
+G1 X-30.000 Y16.800 Z-0.419
+G1 X-30.000 Y18.000 Z-0.599
+G1 X-29.000 Y18.000 Z-0.620
+G1 X-28.000 Y18.000 Z-0.624
+G1 X-27.000 Y18.000 Z-0.610
+G1 X-26.000 Y18.000 Z-0.580
+G1 X-25.000 Y18.000 Z-0.534
+G1 X-24.000 Y18.000 Z-0.472
+G1 X-23.000 Y18.000 Z-0.398
+G1 X-22.000 Y18.000 Z-0.313
+G1 X-21.000 Y18.000 Z-0.219
+G1 X-20.000 Y18.000 Z-0.119
+G1 X-19.000 Y18.000 Z-0.016
+G1 X-18.000 Y18.000 Z0.088
+G1 X-17.000 Y18.000 Z0.189
+G1 X-16.000 Y18.000 Z0.285
+G1 X-15.000 Y18.000 Z0.374
+G1 X-14.000 Y18.000 Z0.451
+G1 X-13.000 Y18.000 Z0.517
+G1 X-12.000 Y18.000 Z0.568
+G1 X-11.000 Y18.000 Z0.603
+G1 X-10.000 Y18.000 Z0.621
+G1 X-9.000 Y18.000 Z0.623
+G1 X-8.000 Y18.000 Z0.607
+G1 X-7.000 Y18.000 Z0.574
+G1 X-6.000 Y18.000 Z0.525
+G1 X-5.000 Y18.000 Z0.462
+G1 X-4.000 Y18.000 Z0.386
+G1 X-3.000 Y18.000 Z0.299
+G1 X-2.000 Y18.000 Z0.204
+G1 X-1.000 Y18.000 Z0.104
+G1 X0.000 Y18.000 Z-0.000
+G1 X1.000 Y18.000 Z-0.104
+G1 X2.000 Y18.000 Z-0.204
+G1 X3.000 Y18.000 Z-0.299
+G1 X4.000 Y18.000 Z-0.386
+G1 X5.000 Y18.000 Z-0.462
+G1 X6.000 Y18.000 Z-0.525
+G1 X7.000 Y18.000 Z-0.574
+G1 X8.000 Y18.000 Z-0.607
+G1 X9.000 Y18.000 Z-0.623
+G1 X10.000 Y18.000 Z-0.621
+G1 X11.000 Y18.000 Z-0.603
+G1 X12.000 Y18.000 Z-0.568
+G1 X13.000 Y18.000 Z-0.517
+G1 X14.000 Y18.000 Z-0.451
+G1 X15.000 Y18.000 Z-0.374
+G1 X16.000 Y18.000 Z-0.285
+G1 X17.000 Y18.000 Z-0.189
+G1 X18.000 Y18.000 Z-0.088
+G1 X19.000 Y18.000 Z0.016
+G1 X20.000 Y18.000 Z0.119
+G1 X21.000 Y18.000 Z0.219
+G1 X22.000 Y18.000 Z0.313
+G1 X23.000 Y18.000 Z0.398
+G1 X24.000 Y18.000 Z0.472
+G1 X25.000 Y18.000 Z0.534
+G1 X26.000 Y18.000 Z0.580
+G1 X27.000 Y18.000 Z0.610
+G1 X28.000 Y18.000 Z0.624
+G1 X29.000 Y18.000 Z0.620
+G1 X30.000 Y18.000 Z0.599
+G1 X30.000 Y19.200 Z0.767
+G1 X29.000 Y19.200 Z0.794
+G1 X28.000 Y19.200 Z0.799
+G1 X27.000 Y19.200 Z0.782
+G1 X26.000 Y19.200 Z0.743
+G1 X25.000 Y19.200 Z0.684
+G1 X24.000 Y19.200 Z0.605
+G1 X23.000 Y19.200 Z0.510
+G1 X22.000 Y19.200 Z0.401
+G1 X21.000 Y19.200 Z0.281
+G1 X20.000 Y19.200 Z0.152
+G1 X19.000 Y19.200 Z0.020
+G1 X18.000 Y19.200 Z-0.113
+G1 X17.000 Y19.200 Z-0.243
+G1 X16.000 Y19.200 Z-0.366
+G1 X15.000 Y19.200 Z-0.479
+G1 X14.000 Y19.200 Z-0.578
+G1 X13.000 Y19.200 Z-0.662
+G1 X12.000 Y19.200 Z-0.727
+G1 X11.000 Y19.200 Z-0.773
+G1 X10.000 Y19.200 Z-0.796
+G1 X9.000 Y19.200 Z-0.798
+G1 X8.000 Y19.200 Z-0.778
+G1 X7.000 Y19.200 Z-0.736
+G1 X6.000 Y19.200 Z-0.673
+G1 X5.000 Y19.200 Z-0.592
+G1 X4.000 Y19.200 Z-0.495
+G1 X3.000 Y19.200 Z-0.384
+G1 X2.000 Y19.200 Z-0.262
+G1 X1.000 Y19.200 Z-0.133
+G1 X0.000 Y19.200 Z-0.000
+G1 X-1.000 Y19.200 Z0.133
+G1 X-2.000 Y19.200 Z0.262
+G1 X-3.000 Y19.200 Z0.384
+G1 X-4.000 Y19.200 Z0.495
+G1 X-5.000 Y19.200 Z0.592
+G1 X-6.000 Y19.200 Z0.673
+G1 X-7.000 Y19.200 Z0.736
+G1 X-8.000 Y19.200 Z0.778
+G1 X-9.000 Y19.200 Z0.798
+G1 X-10.000 Y19.200 Z0.796
+G1 X-11.000 Y19.200 Z0.773
+G1 X-12.000 Y19.200 Z0.727
+G1 X-13.000 Y19.200 Z0.662
+G1 X-14.000 Y19.200 Z0.578
+G1 X-15.000 Y19.200 Z0.479
+G1 X-16.000 Y19.200 Z0.366
+G1 X-17.000 Y19.200 Z0.243
+G1 X-18.000 Y19.200 Z0.113
+G1 X-19.000 Y19.200 Z-0.020
+G1 X-20.000 Y19.200 Z-0.152
+G1 X-21.000 Y19.200 Z-0.281
+G1 X-22.000 Y19.200 Z-0.401
+G1 X-23.000 Y19.200 Z-0.510
+G1 X-24.000 Y19.200 Z-0.605
+G1 X-25.000 Y19.200 Z-0.684
+G1 X-26.000 Y19.200 Z-0.743
+G1 X-27.000 Y19.200 Z-0.782
+G1 X-28.000 Y19.200 Z-0.799
+G1 X-29.000 Y19.200 Z-0.794
+G1 X-30.000 Y19.200 Z-0.767
+G1 X-30.000 Y20.400 Z-0.922
+G1 X-29.000 Y20.400 Z-0.955
+G1 X-28.000 Y20.400 Z-0.961
+G1 X-27.000 Y20.400 Z-0.940
+G1 X-26.000 Y20.400 Z-0.893
+G1 X-25.000 Y20.400 Z-0.822
+G1 X-24.000 Y20.400 Z-0.728
+G1 X-23.000 Y20.400 Z-0.613
+G1 X-22.000 Y20.400 Z-0.482
+G1 X-21.000 Y20.400 Z-0.337
+G1 X-20.000 Y20.400 Z-0.183
+G1 X-19.000 Y20.400 Z-0.024
+G1 X-18.000 Y20.400 Z0.136
+G1 X-17.000 Y20.400 Z0.292
+G1 X-16.000 Y20.400 Z0.440
+G1 X-15.000 Y20.400 Z0.575
+G1 X-14.000 Y20.400 Z0.695
+G1 X-13.000 Y20.400 Z0.796
+G1 X-12.000 Y20.400 Z0.874
+G1 X-11.000 Y20.400 Z0.929
+G1 X-10.000 Y20.400 Z0.957
+G1 X-9.000 Y20.400 Z0.959
+G1 X-8.000 Y20.400 Z0.935
+G1 X-7.000 Y20.400 Z0.884
+G1 X-6.000 Y20.400 Z0.809
+G1 X-5.000 Y20.400 Z0.712
+G1 X-4.000 Y20.400 Z0.595
+G1 X-3.000 Y20.400 Z0.461
+G1 X-2.000 Y20.400 Z0.315
+G1 X-1.000 Y20.400 Z0.160
+G1 X0.000 Y20.400 Z-0.000
+G1 X1.000 Y20.400 Z-0.160
+G1 X2.000 Y20.400 Z-0.315
+G1 X3.000 Y20.400 Z-0.461
+G1 X4.000 Y20.400 Z-0.595
+G1 X5.000 Y20.400 Z-0.712
+G1 X6.000 Y20.400 Z-0.809
+G1 X7.000 Y20.400 Z-0.884
+G1 X8.000 Y20.400 Z-0.935
+G1 X9.000 Y20.400 Z-0.959
+G1 X10.000 Y20.400 Z-0.957
+G1 X11.000 Y20.400 Z-0.929
+G1 X12.000 Y20.400 Z-0.874
+G1 X13.000 Y20.400 Z-0.796
+G1 X14.000 Y20.400 Z-0.695
+G1 X15.000 Y20.400 Z-0.575
+G1 X16.000 Y20.400 Z-0.440
+G1 X17.000 Y20.400 Z-0.292
+G1 X18.000 Y20.400 Z-0.136
+G1 X19.000 Y20.400 Z0.024
+G1 X20.000 Y20.400 Z0.183
+G1 X21.000 Y20.400 Z0.337
+G1 X22.000 Y20.400 Z0.482
+G1 X23.000 Y20.400 Z0.613
+G1 X24.000 Y20.400 Z0.728
+G1 X25.000 Y20.400 Z0.822
+G1 X26.000 Y20.400 Z0.893
+G1 X27.000 Y20.400 Z0.940
+G1 X28.000 Y20.400 Z0.961
+G1 X29.000 Y20.400 Z0.955
+G1 X30.000 Y20.400 Z0.922
+G1 X30.000 Y21.600 Z1.061
+G1 X29.000 Y21.600 Z1.098
+G1 X28.000 Y21.600 Z1.105
+G1 X27.000 Y21.600 Z1.081
+G1 X26.000 Y21.600 Z1.028
+G1 X25.000 Y21.600 Z0.945
+G1 X24.000 Y21.600 Z0.837
+G1 X23.000 Y21.600 Z0.706
+G1 X22.000 Y21.600 Z0.554
+G1 X21.000 Y21.600 Z0.388
+G1 X20.000 Y21.600 Z0.211
+G1 X19.000 Y21.600 Z0.028
+G1 X18.000 Y21.600 Z-0.156
+G1 X17.000 Y21.600 Z-0.336
+G1 X16.000 Y21.600 Z-0.506
+G1 X15.000 Y21.600 Z-0.662
+G1 X14.000 Y21.600 Z-0.800
+G1 X13.000 Y21.600 Z-0.915
+G1 X12.000 Y21.600 Z-1.006
+G1 X11.000 Y21.600 Z-1.068
+G1 X10.000 Y21.600 Z-1.101
+G1 X9.000 Y21.600 Z-1.103
+G1 X8.000 Y21.600 Z-1.075
+G1 X7.000 Y21.600 Z-1.017
+G1 X6.000 Y21.600 Z-0.931
+G1 X5.000 Y21.600 Z-0.819
+G1 X4.000 Y21.600 Z-0.684
+G1 X3.000 Y21.600 Z-0.530
+G1 X2.000 Y21.600 Z-0.362
+G1 X1.000 Y21.600 Z-0.183
+G1 X0.000 Y21.600 Z-0.000
+G1 X-1.000 Y21.600 Z0.183
+G1 X-2.000 Y21.600 Z0.362
+G1 X-3.000 Y21.600 Z0.530
+G1 X-4.000 Y21.600 Z0.684
+G1 X-5.000 Y21.600 Z0.819
+G1 X-6.000 Y21.600 Z0.931
+G1 X-7.000 Y21.600 Z1.017
+G1 X-8.000 Y21.600 Z1.075
+G1 X-9.000 Y21.600 Z1.103
+G1 X-10.000 Y21.600 Z1.101
+G1 X-11.000 Y21.600 Z1.068
+G1 X-12.000 Y21.600 Z1.006
+G1 X-13.000 Y21.600 Z0.915
+G1 X-14.000 Y21.600 Z0.800
+G1 X-15.000 Y21.600 Z0.662
+G1 X-16.000 Y21.600 Z0.506
+G1 X-17.000 Y21.600 Z0.336
+G1 X-18.000 Y21.600 Z0.156
+G1 X-19.000 Y21.600 Z-0.028
+G1 X-20.000 Y21.600 Z-0.211
+G1 X-21.000 Y21.600 Z-0.388
+G1 X-22.000 Y21.600 Z-0.554
+G1 X-23.000 Y21.600 Z-0.706
+G1 X-24.000 Y21.600 Z-0.837
+G1 X-25.000 Y21.600 Z-0.945
+G1 X-26.000 Y21.600 Z-1.028
+G1 X-27.000 Y21.600 Z-1.081
+G1 X-28.000 Y21.600 Z-1.105
+G1 X-29.000 Y21.600 Z-1.098
+G1 X-30.000 Y21.600 Z-1.061
+G1 X-30.000 Y22.800 Z-1.180
+G1 X-29.000 Y22.800 Z-1.222
+G1 X-28.000 Y22.800 Z-1.230
+G1 X-27.000 Y22.800 Z-1.203
+G1 X-26.000 Y22.800 Z-1.144
+G1 X-25.000 Y22.800 Z-1.052
+G1 X-24.000 Y22.800 Z-0.932
+G1 X-23.000 Y22.800 Z-0.785
+G1 X-22.000 Y22.800 Z-0.617
+G1 X-21.000 Y22.800 Z-0.432
+G1 X-20.000 Y22.800 Z-0.235
+G1 X-19.000 Y22.800 Z-0.031
+G1 X-18.000 Y22.800 Z0.174
+G1 X-17.000 Y22.800 Z0.373
+G1 X-16.000 Y22.800 Z0.563
+G1 X-15.000 Y22.800 Z0.737
+G1 X-14.000 Y22.800 Z0.890
+G1 X-13.000 Y22.800 Z1.019
+G1 X-12.000 Y22.800 Z1.119
+G1 X-11.000 Y22.800 Z1.189
+G1 X-10.000 Y22.800 Z1.225
+G1 X-9.000 Y22.800 Z1.228
+G1 X-8.000 Y22.800 Z1.196
+G1 X-7.000 Y22.800 Z1.132
+G1 X-6.000 Y22.800 Z1.036
+G1 X-5.000 Y22.800 Z0.911
+G1 X-4.000 Y22.800 Z0.761
+G1 X-3.000 Y22.800 Z0.590
+G1 X-2.000 Y22.800 Z0.403
+G1 X-1.000 Y22.800 Z0.204
+G1 X0.000 Y22.800 Z-0.000
+G1 X1.000 Y22.800 Z-0.204
+G1 X2.000 Y22.800 Z-0.403
+G1 X3.000 Y22.800 Z-0.590
+G1 X4.000 Y22.800 Z-0.761
+G1 X5.000 Y22.800 Z-0.911
+G1 X6.000 Y22.800 Z-1.036
+G1 X7.000 Y22.800 Z-1.132
+G1 X8.000 Y22.800 Z-1.196
+G1 X9.000 Y22.800 Z-1.228
+G1 X10.000 Y22.800 Z-1.225
+G1 X11.000 Y22.800 Z-1.189
+G1 X12.000 Y22.800 Z-1.119
+G1 X13.000 Y22.800 Z-1.019
+G1 X14.000 Y22.800 Z-0.890
+G1 X15.000 Y22.800 Z-0.737
+G1 X16.000 Y22.800 Z-0.563
+G1 X17.000 Y22.800 Z-0.373
+G1 X18.000 Y22.800 Z-0.174
+G1 X19.000 Y22.800 Z0.031
+G1 X20.000 Y22.800 Z0.235
+G1 X21.000 Y22.800 Z0.432
+G1 X22.000 Y22.800 Z0.617
+G1 X23.000 Y22.800 Z0.785
+G1 X24.000 Y22.800 Z0.932
+G1 X25.000 Y22.800 Z1.052
+G1 X26.000 Y22.800 Z1.144
+G1 X27.000 Y22.800 Z1.203
+G1 X28.000 Y22.800 Z1.230
+G1 X29.000 Y22.800 Z1.222
+G1 X30.000 Y22.800 Z1.180
+G1 X30.000 Y24.000 Z1.279
+G1 X29.000 Y24.000 Z1.324
+G1 X28.000 Y24.000 Z1.333
+G1 X27.000 Y24.000 Z1.304
+G1 X26.000 Y24.000 Z1.239
+G1 X25.000 Y24.000 Z1.140
+G1 X24.000 Y24.000 Z1.010
+G1 X23.000 Y24.000 Z0.851
+G1 X22.000 Y24.000 Z0.669
+G1 X21.000 Y24.000 Z0.468
+G1 X20.000 Y24.000 Z0.254
+G1 X19.000 Y24.000 Z0.033
+G1 X18.000 Y24.000 Z-0.188
+G1 X17.000 Y24.000 Z-0.405
+G1 X16.000 Y24.000 Z-0.610
+G1 X15.000 Y24.000 Z-0.798
+G1 X14.000 Y24.000 Z-0.965
+G1 X13.000 Y24.000 Z-1.104
+G1 X12.000 Y24.000 Z-1.213
+G1 X11.000 Y24.000 Z-1.288
+G1 X10.000 Y24.000 Z-1.328
+G1 X9.000 Y24.000 Z-1.331
+G1 X8.000 Y24.000 Z-1.297
+G1 X7.000 Y24.000 Z-1.227
+G1 X6.000 Y24.000 Z-1.123
+G1 X5.000 Y24.000 Z-0.987
+G1 X4.000 Y24.000 Z-0.825
+G1 X3.000 Y24.000 Z-0.640
+G1 X2.000 Y24.000 Z-0.436
+G1 X1.000 Y24.000 Z-0.221
+G1 X0.000 Y24.000 Z-0.000
+G1 X-1.000 Y24.000 Z0.221
+G1 X-2.000 Y24.000 Z0.436
+G1 X-3.000 Y24.000 Z0.640
+G1 X-4.000 Y24.000 Z0.825
+G1 X-5.000 Y24.000 Z0.987
+G1 X-6.000 Y24.000 Z1.123
+G1 X-7.000 Y24.000 Z1.227
+G1 X-8.000 Y24.000 Z1.297
+G1 X-9.000 Y24.000 Z1.331
+G1 X-10.000 Y24.000 Z1.328
+G1 X-11.000 Y24.000 Z1.288
+G1 X-12.000 Y24.000 Z1.213
+G1 X-13.000 Y24.000 Z1.104
+G1 X-14.000 Y24.000 Z0.965
+G1 X-15.000 Y24.000 Z0.798
+G1 X-16.000 Y24.000 Z0.610
+G1 X-17.000 Y24.000 Z0.405
+G1 X-18.000 Y24.000 Z0.188
+G1 X-19.000 Y24.000 Z-0.033
+G1 X-20.000 Y24.000 Z-0.254
+G1 X-21.000 Y24.000 Z-0.468
+G1 X-22.000 Y24.000 Z-0.669
+G1 X-23.000 Y24.000 Z-0.851
+G1 X-24.000 Y24.000 Z-1.010
+G1 X-25.000 Y24.000 Z-1.140
+G1 X-26.000 Y24.000 Z-1.239
+G1 X-27.000 Y24.000 Z-1.304
+G1 X-28.000 Y24.000 Z-1.333
+G1 X-29.000 Y24.000 Z-1.324
+G1 X-30.000 Y24.000 Z-1.279
+G1 X-30.000 Y25.200 Z-1.355
+G1 X-29.000 Y25.200 Z-1.403
+G1 X-28.000 Y25.200 Z-1.412
+G1 X-27.000 Y25.200 Z-1.382
+G1 X-26.000 Y25.200 Z-1.313
+G1 X-25.000 Y25.200 Z-1.208
+G1 X-24.000 Y25.200 Z-1.070
+G1 X-23.000 Y25.200 Z-0.902
+G1 X-22.000 Y25.200 Z-0.708
+G1 X-21.000 Y25.200 Z-0.496
+G1 X-20.000 Y25.200 Z-0.269
+G1 X-19.000 Y25.200 Z-0.035
+G1 X-18.000 Y25.200 Z0.199
+G1 X-17.000 Y25.200 Z0.429
+G1 X-16.000 Y25.200 Z0.646
+G1 X-15.000 Y25.200 Z0.846
+G1 X-14.000 Y25.200 Z1.022
+G1 X-13.000 Y25.200 Z1.170
+G1 X-12.000 Y25.200 Z1.285
+G1 X-11.000 Y25.200 Z1.365
+G1 X-10.000 Y25.200 Z1.407
+G1 X-9.000 Y25.200 Z1.410
+G1 X-8.000 Y25.200 Z1.374
+G1 X-7.000 Y25.200 Z1.299
+G1 X-6.000 Y25.200 Z1.189
+G1 X-5.000 Y25.200 Z1.046
+G1 X-4.000 Y25.200 Z0.874
+G1 X-3.000 Y25.200 Z0.678
+G1 X-2.000 Y25.200 Z0.462
+G1 X-1.000 Y25.200 Z0.234
+G1 X0.000 Y25.200 Z-0.000
+G1 X1.000 Y25.200 Z-0.234
+G1 X2.000 Y25.200 Z-0.462
+G1 X3.000 Y25.200 Z-0.678
+G1 X4.000 Y25.200 Z-0.874
+G1 X5.000 Y25.200 Z-1.046
+G1 X6.000 Y25.200 Z-1.189
+G1 X7.000 Y25.200 Z-1.299
+G1 X8.000 Y25.200 Z-1.374
+G1 X9.000 Y25.200 Z-1.410
+G1 X10.000 Y25.200 Z-1.407
+G1 X11.000 Y25.200 Z-1.365
+G1 X12.000 Y25.200 Z-1.285
+G1 X13.000 Y25.200 Z-1.170
+G1 X14.000 Y25.200 Z-1.022
+G1 X15.000 Y25.200 Z-0.846
+G1 X16.000 Y25.200 Z-0.646
+G1 X17.000 Y25.200 Z-0.429
+G1 X18.000 Y25.200 Z-0.199
+G1 X19.000 Y25.200 Z0.035
+G1 X20.000 Y25.200 Z0.269
+G1 X21.000 Y25.200 Z0.496
+G1 X22.000 Y25.200 Z0.708
+G1 X23.000 Y25.200 Z0.902
+G1 X24.000 Y25.200 Z1.070
+G1 X25.000 Y25.200 Z1.208
+G1 X26.000 Y25.200 Z1.313
+G1 X27.000 Y25.200 Z1.382
+G1 X28.000 Y25.200 Z1.412
+G1 X29.000 Y25.200 Z1.403
+G1 X30.000 Y25.200 Z1.355
+G1 X30.000 Y26.400 Z1.407
+G1 X29.000 Y26.400 Z1.457
+G1 X28.000 Y26.400 Z1.466
+G1 X27.000 Y26.400 Z1.435
+G1 X26.000 Y26.400 Z1.363
+G1 X25.000 Y26.400 Z1.254
+G1 X24.000 Y26.400 Z1.111
+G1 X23.000 Y26.400 Z0.936
+G1 X22.000 Y26.400 Z0.736
+G1 X21.000 Y26.400 Z0.515
+G1 X20.000 Y26.400 Z0.280
+G1 X19.000 Y26.400 Z0.037
+G1 X18.000 Y26.400 Z-0.207
+G1 X17.000 Y26.400 Z-0.445
+G1 X16.000 Y26.400 Z-0.671
+G1 X15.000 Y26.400 Z-0.878
+G1 X14.000 Y26.400 Z-1.061
+G1 X13.000 Y26.400 Z-1.215
+G1 X12.000 Y26.400 Z-1.334
+G1 X11.000 Y26.400 Z-1.417
+G1 X10.000 Y26.400 Z-1.461
+G1 X9.000 Y26.400 Z-1.464
+G1 X8.000 Y26.400 Z-1.426
+G1 X7.000 Y26.400 Z-1.349
+G1 X6.000 Y26.400 Z-1.235
+G1 X5.000 Y26.400 Z-1.086
+G1 X4.000 Y26.400 Z-0.908
+G1 X3.000 Y26.400 Z-0.704
+G1 X2.000 Y26.400 Z-0.480
+G1 X1.000 Y26.400 Z-0.243
+G1 X0.000 Y26.400 Z-0.000
+G1 X-1.000 Y26.400 Z0.243
+G1 X-2.000 Y26.400 Z0.480
+G1 X-3.000 Y26.400 Z0.704
+G1 X-4.000 Y26.400 Z0.908
+G1 X-5.000 Y26.400 Z1.086
+G1 X-6.000 Y26.400 Z1.235
+G1 X-7.000 Y26.400 Z1.349
+G1 X-8.000 Y26.400 Z1.426
+G1 X-9.000 Y26.400 Z1.464
+G1 X-10.000 Y26.400 Z1.461
+G1 X-11.000 Y26.400 Z1.417
+G1 X-12.000 Y26.400 Z1.334
+G1 X-13.000 Y26.400 Z1.215
+G1 X-14.000 Y26.400 Z1.061
+G1 X-15.000 Y26.400 Z0.878
+G1 X-16.000 Y26.400 Z0.671
+G1 X-17.000 Y26.400 Z0.445
+G1 X-18.000 Y26.400 Z0.207
+G1 X-19.000 Y26.400 Z-0.037
+G1 X-20.000 Y26.400 Z-0.280
+G1 X-21.000 Y26.400 Z-0.515
+G1 X-22.000 Y26.400 Z-0.736
+G1 X-23.000 Y26.400 Z-0.936
+G1 X-24.000 Y26.400 Z-1.111
+G1 X-25.000 Y26.400 Z-1.254
+G1 X-26.000 Y26.400 Z-1.363
+G1 X-27.000 Y26.400 Z-1.435
+G1 X-28.000 Y26.400 Z-1.466
+G1 X-29.000 Y26.400 Z-1.457
+G1 X-30.000 Y26.400 Z-1.407
+G1 X-30.000 Y27.600 Z-1.434
+G1 X-29.000 Y27.600 Z-1.485
+G1 X-28.000 Y27.600 Z-1.494
+G1 X-27.000 Y27.600 Z-1.462
+G1 X-26.000 Y27.600 Z-1.390
+G1 X-25.000 Y27.600 Z-1.279
+G1 X-24.000 Y27.600 Z-1.132
+G1 X-23.000 Y27.600 Z-0.954
+G1 X-22.000 Y27.600 Z-0.750
+G1 X-21.000 Y27.600 Z-0.525
+G1 X-20.000 Y27.600 Z-0.285
+G1 X-19.000 Y27.600 Z-0.038
+G1 X-18.000 Y27.600 Z0.211
+G1 X-17.000 Y27.600 Z0.454
+G1 X-16.000 Y27.600 Z0.684
+G1 X-15.000 Y27.600 Z0.895
+G1 X-14.000 Y27.600 Z1.082
+G1 X-13.000 Y27.600 Z1.238
+G1 X-12.000 Y27.600 Z1.360
+G1 X-11.000 Y27.600 Z1.445
+G1 X-10.000 Y27.600 Z1.489
+G1 X-9.000 Y27.600 Z1.492
+G1 X-8.000 Y27.600 Z1.454
+G1 X-7.000 Y27.600 Z1.375
+G1 X-6.000 Y27.600 Z1.259
+G1 X-5.000 Y27.600 Z1.107
+G1 X-4.000 Y27.600 Z0.925
+G1 X-3.000 Y27.600 Z0.717
+G1 X-2.000 Y27.600 Z0.489
+G1 X-1.000 Y27.600 Z0.248
+G1 X0.000 Y27.600 Z-0.000
+G1 X1.000 Y27.600 Z-0.248
+G1 X2.000 Y27.600 Z-0.489
+G1 X3.000 Y27.600 Z-0.717
+G1 X4.000 Y27.600 Z-0.925
+G1 X5.000 Y27.600 Z-1.107
+G1 X6.000 Y27.600 Z-1.259
+G1 X7.000 Y27.600 Z-1.375
+G1 X8.000 Y27.600 Z-1.454
+G1 X9.000 Y27.600 Z-1.492
+G1 X10.000 Y27.600 Z-1.489
+G1 X11.000 Y27.600 Z-1.445
+G1 X12.000 Y27.600 Z-1.360
+G1 X13.000 Y27.600 Z-1.238
+G1 X14.000 Y27.600 Z-1.082
+G1 X15.000 Y27.600 Z-0.895
+G1 X16.000 Y27.600 Z-0.684
+G1 X17.000 Y27.600 Z-0.454
+G1 X18.000 Y27.600 Z-0.211
+G1 X19.000 Y27.600 Z0.038
+G1 X20.000 Y27.600 Z0.285
+G1 X21.000 Y27.600 Z0.525
+G1 X22.000 Y27.600 Z0.750
+G1 X23.000 Y27.600 Z0.954
+G1 X24.000 Y27.600 Z1.132
+G1 X25.000 Y27.600 Z1.279
+G1 X26.000 Y27.600 Z1.390
+G1 X27.000 Y27.600 Z1.462
+G1 X28.000 Y27.600 Z1.494
+G1 X29.000 Y27.600 Z1.485
+G1 X30.000 Y27.600 Z1.434
+G1 X30.000 Y28.800 Z1.436
+G1 X29.000 Y28.800 Z1.487
+G1 X28.000 Y28.800 Z1.496
+G1 X27.000 Y28.800 Z1.464
+G1 X26.000 Y28.800 Z1.391
+G1 X25.000 Y28.800 Z1.280
+G1 X24.000 Y28.800 Z1.133
+G1 X23.000 Y28.800 Z0.955
+G1 X22.000 Y28.800 Z0.751
+G1 X21.000 Y28.800 Z0.525
+G1 X20.000 Y28.800 Z0.285
+G1 X19.000 Y28.800 Z0.038
+G1 X18.000 Y28.800 Z-0.211
+G1 X17.000 Y28.800 Z-0.454
+G1 X16.000 Y28.800 Z-0.685
+G1 X15.000 Y28.800 Z-0.896
+G1 X14.000 Y28.800 Z-1.083
+G1 X13.000 Y28.800 Z-1.239
+G1 X12.000 Y28.800 Z-1.362
+G1 X11.000 Y28.800 Z-1.446
+G1 X10.000 Y28.800 Z-1.491
+G1 X9.000 Y28.800 Z-1.494
+G1 X8.000 Y28.800 Z-1.455
+G1 X7.000 Y28.800 Z-1.377
+G1 X6.000 Y28.800 Z-1.260
+G1 X5.000 Y28.800 Z-1.108
+G1 X4.000 Y28.800 Z-0.926
+G1 X3.000 Y28.800 Z-0.718
+G1 X2.000 Y28.800 Z-0.490
+G1 X1.000 Y28.800 Z-0.248
+G1 X0.000 Y28.800 Z-0.000
+G1 X-1.000 Y28.800 Z0.248
+G1 X-2.000 Y28.800 Z0.490
+G1 X-3.000 Y28.800 Z0.718
+G1 X-4.000 Y28.800 Z0.926
+G1 X-5.000 Y28.800 Z1.108
+G1 X-6.000 Y28.800 Z1.260
+G1 X-7.000 Y28.800 Z1.377
+G1 X-8.000 Y28.800 Z1.455
+G1 X-9.000 Y28.800 Z1.494
+G1 X-10.000 Y28.800 Z1.491
+G1 X-11.000 Y28.800 Z1.446
+G1 X-12.000 Y28.800 Z1.362
+G1 X-13.000 Y28.800 Z1.239
+G1 X-14.000 Y28.800 Z1.083
+G1 X-15.000 Y28.800 Z0.896
+G1 X-16.000 Y28.800 Z0.685
+G1 X-17.000 Y28.800 Z0.454
+G1 X-18.000 Y28.800 Z0.211
+G1 X-19.000 Y28.800 Z-0.038
+G1 X-20.000 Y28.800 Z-0.285
+G1 X-21.000 Y28.800 Z-0.525
+G1 X-22.000 Y28.800 Z-0.751
+G1 X-23.000 Y28.800 Z-0.955
+G1 X-24.000 Y28.800 Z-1.133
+G1 X-25.000 Y28.800 Z-1.280
+G1 X-26.000 Y28.800 Z-1.391
+G1 X-27.000 Y28.800 Z-1.464
+G1 X-28.000 Y28.800 Z-1.496
+G1 X-29.000 Y28.800 Z-1.487
+G1 X-30.000 Y28.800 Z-1.436
+G0 Z5
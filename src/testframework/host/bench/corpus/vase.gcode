@@ -0,0 +1,2887 @@
+; vase mode
+; generated by make_corpus.py
+G21
+G90
+G0 X20 Y0 Z0.2
+G92 E0
+G1 F2400
+G1 X20.000 Y0.000 Z0.200 E0.00000
+G1 X20.614 Y1.803 Z0.203 E0.06287
+G1 X20.378 Y3.593 Z0.206 E0.12244
+G1 X19.319 Y5.176 Z0.208 E0.18531
+G1 X18.143 Y6.603 Z0.211 E0.24633
+G1 X17.498 Y8.160 Z0.214 E0.30191
+G1 X17.321 Y10.000 Z0.217 E0.36293
+G1 X16.951 Y11.869 Z0.219 E0.42580
+G1 X15.852 Y13.301 Z0.222 E0.48537
+G1 X14.142 Y14.142 Z0.225 E0.54824
+G1 X12.410 Y14.790 Z0.228 E0.60926
+G1 X11.074 Y15.816 Z0.231 E0.66484
+G1 X10.000 Y17.321 Z0.233 E0.72586
+G1 X8.745 Y18.754 Z0.236 E0.78873
+G1 X7.077 Y19.445 Z0.239 E0.84830
+G1 X5.176 Y19.319 Z0.242 E0.91117
+G1 X3.353 Y19.014 Z0.244 E0.97219
+G1 X1.683 Y19.234 Z0.247 E1.02777
+G1 X0.000 Y20.000 Z0.250 E1.08879
+G1 X-1.803 Y20.614 Z0.253 E1.15166
+G1 X-3.593 Y20.378 Z0.256 E1.21123
+G1 X-5.176 Y19.319 Z0.258 E1.27411
+G1 X-6.603 Y18.143 Z0.261 E1.33512
+G1 X-8.160 Y17.498 Z0.264 E1.39071
+G1 X-10.000 Y17.321 Z0.267 E1.45172
+G1 X-11.869 Y16.951 Z0.269 E1.51459
+G1 X-13.301 Y15.852 Z0.272 E1.57417
+G1 X-14.142 Y14.142 Z0.275 E1.63704
+G1 X-14.790 Y12.410 Z0.278 E1.69805
+G1 X-15.816 Y11.074 Z0.281 E1.75364
+G1 X-17.321 Y10.000 Z0.283 E1.81465
+G1 X-18.754 Y8.745 Z0.286 E1.87752
+G1 X-19.445 Y7.077 Z0.289 E1.93710
+G1 X-19.319 Y5.176 Z0.292 E1.99997
+G1 X-19.014 Y3.353 Z0.294 E2.06098
+G1 X-19.234 Y1.683 Z0.297 E2.11657
+G1 X-20.000 Y0.000 Z0.300 E2.17758
+G1 X-20.614 Y-1.803 Z0.303 E2.24045
+G1 X-20.378 Y-3.593 Z0.306 E2.30003
+G1 X-19.319 Y-5.176 Z0.308 E2.36290
+G1 X-18.143 Y-6.603 Z0.311 E2.42391
+G1 X-17.498 Y-8.160 Z0.314 E2.47950
+G1 X-17.321 Y-10.000 Z0.317 E2.54051
+G1 X-16.951 Y-11.869 Z0.319 E2.60338
+G1 X-15.852 Y-13.301 Z0.322 E2.66296
+G1 X-14.142 Y-14.142 Z0.325 E2.72583
+G1 X-12.410 Y-14.790 Z0.328 E2.78684
+G1 X-11.074 Y-15.816 Z0.331 E2.84243
+G1 X-10.000 Y-17.321 Z0.333 E2.90344
+G1 X-8.745 Y-18.754 Z0.336 E2.96632
+G1 X-7.077 Y-19.445 Z0.339 E3.02589
+G1 X-5.176 Y-19.319 Z0.342 E3.08876
+G1 X-3.353 Y-19.014 Z0.344 E3.14978
+G1 X-1.683 Y-19.234 Z0.347 E3.20536
+G1 X-0.000 Y-20.000 Z0.350 E3.26638
+G1 X1.803 Y-20.614 Z0.353 E3.32925
+G1 X3.593 Y-20.378 Z0.356 E3.38882
+G1 X5.176 Y-19.319 Z0.358 E3.45169
+G1 X6.603 Y-18.143 Z0.361 E3.51271
+G1 X8.160 Y-17.498 Z0.364 E3.56829
+G1 X10.000 Y-17.321 Z0.367 E3.62931
+G1 X11.869 Y-16.951 Z0.369 E3.69218
+G1 X13.301 Y-15.852 Z0.372 E3.75175
+G1 X14.142 Y-14.142 Z0.375 E3.81462
+G1 X14.790 Y-12.410 Z0.378 E3.87564
+G1 X15.816 Y-11.074 Z0.381 E3.93122
+G1 X17.321 Y-10.000 Z0.383 E3.99224
+G1 X18.754 Y-8.745 Z0.386 E4.05511
+G1 X19.445 Y-7.077 Z0.389 E4.11468
+G1 X19.319 Y-5.176 Z0.392 E4.17755
+G1 X19.014 Y-3.353 Z0.394 E4.23857
+G1 X19.234 Y-1.683 Z0.397 E4.29415
+G1 X20.000 Y-0.000 Z0.400 E4.35517
+G1 X20.614 Y1.803 Z0.403 E4.41804
+G1 X20.378 Y3.593 Z0.406 E4.47761
+G1 X19.319 Y5.176 Z0.408 E4.54048
+G1 X18.143 Y6.603 Z0.411 E4.60150
+G1 X17.498 Y8.160 Z0.414 E4.65708
+G1 X17.321 Y10.000 Z0.417 E4.71810
+G1 X16.951 Y11.869 Z0.419 E4.78097
+G1 X15.852 Y13.301 Z0.422 E4.84054
+G1 X14.142 Y14.142 Z0.425 E4.90341
+G1 X12.410 Y14.790 Z0.428 E4.96443
+G1 X11.074 Y15.816 Z0.431 E5.02001
+G1 X10.000 Y17.321 Z0.433 E5.08103
+G1 X8.745 Y18.754 Z0.436 E5.14390
+G1 X7.077 Y19.445 Z0.439 E5.20347
+G1 X5.176 Y19.319 Z0.442 E5.26634
+G1 X3.353 Y19.014 Z0.444 E5.32736
+G1 X1.683 Y19.234 Z0.447 E5.38294
+G1 X0.000 Y20.000 Z0.450 E5.44396
+G1 X-1.803 Y20.614 Z0.453 E5.50683
+G1 X-3.593 Y20.378 Z0.456 E5.56640
+G1 X-5.176 Y19.319 Z0.458 E5.62927
+G1 X-6.603 Y18.143 Z0.461 E5.69029
+G1 X-8.160 Y17.498 Z0.464 E5.74587
+G1 X-10.000 Y17.321 Z0.467 E5.80689
+G1 X-11.869 Y16.951 Z0.469 E5.86976
+G1 X-13.301 Y15.852 Z0.472 E5.92933
+G1 X-14.142 Y14.142 Z0.475 E5.99220
+G1 X-14.790 Y12.410 Z0.478 E6.05322
+G1 X-15.816 Y11.074 Z0.481 E6.10880
+G1 X-17.321 Y10.000 Z0.483 E6.16982
+G1 X-18.754 Y8.745 Z0.486 E6.23269
+G1 X-19.445 Y7.077 Z0.489 E6.29226
+G1 X-19.319 Y5.176 Z0.492 E6.35513
+G1 X-19.014 Y3.353 Z0.494 E6.41615
+G1 X-19.234 Y1.683 Z0.497 E6.47173
+G1 X-20.000 Y0.000 Z0.500 E6.53275
+G1 X-20.614 Y-1.803 Z0.503 E6.59562
+G1 X-20.378 Y-3.593 Z0.506 E6.65519
+G1 X-19.319 Y-5.176 Z0.508 E6.71806
+G1 X-18.143 Y-6.603 Z0.511 E6.77908
+G1 X-17.498 Y-8.160 Z0.514 E6.83466
+G1 X-17.321 Y-10.000 Z0.517 E6.89568
+G1 X-16.951 Y-11.869 Z0.519 E6.95855
+G1 X-15.852 Y-13.301 Z0.522 E7.01812
+G1 X-14.142 Y-14.142 Z0.525 E7.08099
+G1 X-12.410 Y-14.790 Z0.528 E7.14201
+G1 X-11.074 Y-15.816 Z0.531 E7.19759
+G1 X-10.000 Y-17.321 Z0.533 E7.25861
+G1 X-8.745 Y-18.754 Z0.536 E7.32148
+G1 X-7.077 Y-19.445 Z0.539 E7.38105
+G1 X-5.176 Y-19.319 Z0.542 E7.44392
+G1 X-3.353 Y-19.014 Z0.544 E7.50494
+G1 X-1.683 Y-19.234 Z0.547 E7.56052
+G1 X-0.000 Y-20.000 Z0.550 E7.62154
+G1 X1.803 Y-20.614 Z0.553 E7.68441
+G1 X3.593 Y-20.378 Z0.556 E7.74398
+G1 X5.176 Y-19.319 Z0.558 E7.80686
+G1 X6.603 Y-18.143 Z0.561 E7.86787
+G1 X8.160 Y-17.498 Z0.564 E7.92346
+G1 X10.000 Y-17.321 Z0.567 E7.98447
+G1 X11.869 Y-16.951 Z0.569 E8.04734
+G1 X13.301 Y-15.852 Z0.572 E8.10692
+G1 X14.142 Y-14.142 Z0.575 E8.16979
+G1 X14.790 Y-12.410 Z0.578 E8.23080
+G1 X15.816 Y-11.074 Z0.581 E8.28639
+G1 X17.321 Y-10.000 Z0.583 E8.34740
+G1 X18.754 Y-8.745 Z0.586 E8.41027
+G1 X19.445 Y-7.077 Z0.589 E8.46985
+G1 X19.319 Y-5.176 Z0.592 E8.53272
+G1 X19.014 Y-3.353 Z0.594 E8.59373
+G1 X19.234 Y-1.683 Z0.597 E8.64932
+G1 X20.000 Y-0.000 Z0.600 E8.71033
+G1 X20.614 Y1.803 Z0.603 E8.77320
+G1 X20.378 Y3.593 Z0.606 E8.83278
+G1 X19.319 Y5.176 Z0.608 E8.89565
+G1 X18.143 Y6.603 Z0.611 E8.95666
+G1 X17.498 Y8.160 Z0.614 E9.01225
+G1 X17.321 Y10.000 Z0.617 E9.07326
+G1 X16.951 Y11.869 Z0.619 E9.13613
+G1 X15.852 Y13.301 Z0.622 E9.19571
+G1 X14.142 Y14.142 Z0.625 E9.25858
+G1 X12.410 Y14.790 Z0.628 E9.31959
+G1 X11.074 Y15.816 Z0.631 E9.37518
+G1 X10.000 Y17.321 Z0.633 E9.43619
+G1 X8.745 Y18.754 Z0.636 E9.49907
+G1 X7.077 Y19.445 Z0.639 E9.55864
+G1 X5.176 Y19.319 Z0.642 E9.62151
+G1 X3.353 Y19.014 Z0.644 E9.68253
+G1 X1.683 Y19.234 Z0.647 E9.73811
+G1 X0.000 Y20.000 Z0.650 E9.79913
+G1 X-1.803 Y20.614 Z0.653 E9.86200
+G1 X-3.593 Y20.378 Z0.656 E9.92157
+G1 X-5.176 Y19.319 Z0.658 E9.98444
+G1 X-6.603 Y18.143 Z0.661 E10.04546
+G1 X-8.160 Y17.498 Z0.664 E10.10104
+G1 X-10.000 Y17.321 Z0.667 E10.16206
+G1 X-11.869 Y16.951 Z0.669 E10.22493
+G1 X-13.301 Y15.852 Z0.672 E10.28450
+G1 X-14.142 Y14.142 Z0.675 E10.34737
+G1 X-14.790 Y12.410 Z0.678 E10.40839
+G1 X-15.816 Y11.074 Z0.681 E10.46397
+G1 X-17.321 Y10.000 Z0.683 E10.52499
+G1 X-18.754 Y8.745 Z0.686 E10.58786
+G1 X-19.445 Y7.077 Z0.689 E10.64743
+G1 X-19.319 Y5.176 Z0.692 E10.71030
+G1 X-19.014 Y3.353 Z0.694 E10.77132
+G1 X-19.234 Y1.683 Z0.697 E10.82690
+G1 X-20.000 Y0.000 Z0.700 E10.88792
+G1 X-20.614 Y-1.803 Z0.703 E10.95079
+G1 X-20.378 Y-3.593 Z0.706 E11.01036
+G1 X-19.319 Y-5.176 Z0.708 E11.07323
+G1 X-18.143 Y-6.603 Z0.711 E11.13425
+G1 X-17.498 Y-8.160 Z0.714 E11.18983
+G1 X-17.321 Y-10.000 Z0.717 E11.25085
+G1 X-16.951 Y-11.869 Z0.719 E11.31372
+G1 X-15.852 Y-13.301 Z0.722 E11.37329
+G1 X-14.142 Y-14.142 Z0.725 E11.43616
+G1 X-12.410 Y-14.790 Z0.728 E11.49718
+G1 X-11.074 Y-15.816 Z0.731 E11.55276
+G1 X-10.000 Y-17.321 Z0.733 E11.61378
+G1 X-8.745 Y-18.754 Z0.736 E11.67665
+G1 X-7.077 Y-19.445 Z0.739 E11.73622
+G1 X-5.176 Y-19.319 Z0.742 E11.79909
+G1 X-3.353 Y-19.014 Z0.744 E11.86011
+G1 X-1.683 Y-19.234 Z0.747 E11.91569
+G1 X0.000 Y-20.000 Z0.750 E11.97671
+G1 X1.803 Y-20.614 Z0.753 E12.03958
+G1 X3.593 Y-20.378 Z0.756 E12.09915
+G1 X5.176 Y-19.319 Z0.758 E12.16202
+G1 X6.603 Y-18.143 Z0.761 E12.22304
+G1 X8.160 Y-17.498 Z0.764 E12.27862
+G1 X10.000 Y-17.321 Z0.767 E12.33964
+G1 X11.869 Y-16.951 Z0.769 E12.40251
+G1 X13.301 Y-15.852 Z0.772 E12.46208
+G1 X14.142 Y-14.142 Z0.775 E12.52495
+G1 X14.790 Y-12.410 Z0.778 E12.58597
+G1 X15.816 Y-11.074 Z0.781 E12.64155
+G1 X17.321 Y-10.000 Z0.783 E12.70257
+G1 X18.754 Y-8.745 Z0.786 E12.76544
+G1 X19.445 Y-7.077 Z0.789 E12.82501
+G1 X19.319 Y-5.176 Z0.792 E12.88788
+G1 X19.014 Y-3.353 Z0.794 E12.94890
+G1 X19.234 Y-1.683 Z0.797 E13.00448
+G1 X20.000 Y-0.000 Z0.800 E13.06550
+G1 X20.614 Y1.803 Z0.803 E13.12837
+G1 X20.378 Y3.593 Z0.806 E13.18794
+G1 X19.319 Y5.176 Z0.808 E13.25081
+G1 X18.143 Y6.603 Z0.811 E13.31183
+G1 X17.498 Y8.160 Z0.814 E13.36741
+G1 X17.321 Y10.000 Z0.817 E13.42843
+G1 X16.951 Y11.869 Z0.819 E13.49130
+G1 X15.852 Y13.301 Z0.822 E13.55087
+G1 X14.142 Y14.142 Z0.825 E13.61374
+G1 X12.410 Y14.790 Z0.828 E13.67476
+G1 X11.074 Y15.816 Z0.831 E13.73034
+G1 X10.000 Y17.321 Z0.833 E13.79136
+G1 X8.745 Y18.754 Z0.836 E13.85423
+G1 X7.077 Y19.445 Z0.839 E13.91380
+G1 X5.176 Y19.319 Z0.842 E13.97667
+G1 X3.353 Y19.014 Z0.844 E14.03769
+G1 X1.683 Y19.234 Z0.847 E14.09327
+G1 X-0.000 Y20.000 Z0.850 E14.15429
+G1 X-1.803 Y20.614 Z0.853 E14.21716
+G1 X-3.593 Y20.378 Z0.856 E14.27673
+G1 X-5.176 Y19.319 Z0.858 E14.33961
+G1 X-6.603 Y18.143 Z0.861 E14.40062
+G1 X-8.160 Y17.498 Z0.864 E14.45621
+G1 X-10.000 Y17.321 Z0.867 E14.51722
+G1 X-11.869 Y16.951 Z0.869 E14.58009
+G1 X-13.301 Y15.852 Z0.872 E14.63967
+G1 X-14.142 Y14.142 Z0.875 E14.70254
+G1 X-14.790 Y12.410 Z0.878 E14.76355
+G1 X-15.816 Y11.074 Z0.881 E14.81914
+G1 X-17.321 Y10.000 Z0.883 E14.88015
+G1 X-18.754 Y8.745 Z0.886 E14.94302
+G1 X-19.445 Y7.077 Z0.889 E15.00260
+G1 X-19.319 Y5.176 Z0.892 E15.06547
+G1 X-19.014 Y3.353 Z0.894 E15.12648
+G1 X-19.234 Y1.683 Z0.897 E15.18207
+G1 X-20.000 Y0.000 Z0.900 E15.24308
+G1 X-20.614 Y-1.803 Z0.903 E15.30595
+G1 X-20.378 Y-3.593 Z0.906 E15.36553
+G1 X-19.319 Y-5.176 Z0.908 E15.42840
+G1 X-18.143 Y-6.603 Z0.911 E15.48941
+G1 X-17.498 Y-8.160 Z0.914 E15.54500
+G1 X-17.321 Y-10.000 Z0.917 E15.60601
+G1 X-16.951 Y-11.869 Z0.919 E15.66888
+G1 X-15.852 Y-13.301 Z0.922 E15.72846
+G1 X-14.142 Y-14.142 Z0.925 E15.79133
+G1 X-12.410 Y-14.790 Z0.928 E15.85234
+G1 X-11.074 Y-15.816 Z0.931 E15.90793
+G1 X-10.000 Y-17.321 Z0.933 E15.96894
+G1 X-8.745 Y-18.754 Z0.936 E16.03182
+G1 X-7.077 Y-19.445 Z0.939 E16.09139
+G1 X-5.176 Y-19.319 Z0.942 E16.15426
+G1 X-3.353 Y-19.014 Z0.944 E16.21528
+G1 X-1.683 Y-19.234 Z0.947 E16.27086
+G1 X-0.000 Y-20.000 Z0.950 E16.33188
+G1 X1.803 Y-20.614 Z0.953 E16.39475
+G1 X3.593 Y-20.378 Z0.956 E16.45432
+G1 X5.176 Y-19.319 Z0.958 E16.51719
+G1 X6.603 Y-18.143 Z0.961 E16.57821
+G1 X8.160 Y-17.498 Z0.964 E16.63379
+G1 X10.000 Y-17.321 Z0.967 E16.69481
+G1 X11.869 Y-16.951 Z0.969 E16.75768
+G1 X13.301 Y-15.852 Z0.972 E16.81725
+G1 X14.142 Y-14.142 Z0.975 E16.88012
+G1 X14.790 Y-12.410 Z0.978 E16.94114
+G1 X15.816 Y-11.074 Z0.981 E16.99672
+G1 X17.321 Y-10.000 Z0.983 E17.05774
+G1 X18.754 Y-8.745 Z0.986 E17.12061
+G1 X19.445 Y-7.077 Z0.989 E17.18018
+G1 X19.319 Y-5.176 Z0.992 E17.24305
+G1 X19.014 Y-3.353 Z0.994 E17.30407
+G1 X19.234 Y-1.683 Z0.997 E17.35965
+G1 X20.000 Y-0.000 Z1.000 E17.42067
+G1 X20.614 Y1.803 Z1.003 E17.48354
+G1 X20.378 Y3.593 Z1.006 E17.54311
+G1 X19.319 Y5.176 Z1.008 E17.60598
+G1 X18.143 Y6.603 Z1.011 E17.66700
+G1 X17.498 Y8.160 Z1.014 E17.72258
+G1 X17.321 Y10.000 Z1.017 E17.78360
+G1 X16.951 Y11.869 Z1.019 E17.84647
+G1 X15.852 Y13.301 Z1.022 E17.90604
+G1 X14.142 Y14.142 Z1.025 E17.96891
+G1 X12.410 Y14.790 Z1.028 E18.02993
+G1 X11.074 Y15.816 Z1.031 E18.08551
+G1 X10.000 Y17.321 Z1.033 E18.14653
+G1 X8.745 Y18.754 Z1.036 E18.20940
+G1 X7.077 Y19.445 Z1.039 E18.26897
+G1 X5.176 Y19.319 Z1.042 E18.33184
+G1 X3.353 Y19.014 Z1.044 E18.39286
+G1 X1.683 Y19.234 Z1.047 E18.44844
+G1 X-0.000 Y20.000 Z1.050 E18.50946
+G1 X-1.803 Y20.614 Z1.053 E18.57233
+G1 X-3.593 Y20.378 Z1.056 E18.63190
+G1 X-5.176 Y19.319 Z1.058 E18.69477
+G1 X-6.603 Y18.143 Z1.061 E18.75579
+G1 X-8.160 Y17.498 Z1.064 E18.81137
+G1 X-10.000 Y17.321 Z1.067 E18.87239
+G1 X-11.869 Y16.951 Z1.069 E18.93526
+G1 X-13.301 Y15.852 Z1.072 E18.99483
+G1 X-14.142 Y14.142 Z1.075 E19.05770
+G1 X-14.790 Y12.410 Z1.078 E19.11872
+G1 X-15.816 Y11.074 Z1.081 E19.17430
+G1 X-17.321 Y10.000 Z1.083 E19.23532
+G1 X-18.754 Y8.745 Z1.086 E19.29819
+G1 X-19.445 Y7.077 Z1.089 E19.35776
+G1 X-19.319 Y5.176 Z1.092 E19.42063
+G1 X-19.014 Y3.353 Z1.094 E19.48165
+G1 X-19.234 Y1.683 Z1.097 E19.53723
+G1 X-20.000 Y0.000 Z1.100 E19.59825
+G1 X-20.614 Y-1.803 Z1.103 E19.66112
+G1 X-20.378 Y-3.593 Z1.106 E19.72069
+G1 X-19.319 Y-5.176 Z1.108 E19.78356
+G1 X-18.143 Y-6.603 Z1.111 E19.84458
+G1 X-17.498 Y-8.160 Z1.114 E19.90016
+G1 X-17.321 Y-10.000 Z1.117 E19.96118
+G1 X-16.951 Y-11.869 Z1.119 E20.02405
+G1 X-15.852 Y-13.301 Z1.122 E20.08362
+G1 X-14.142 Y-14.142 Z1.125 E20.14649
+G1 X-12.410 Y-14.790 Z1.128 E20.20751
+G1 X-11.074 Y-15.816 Z1.131 E20.26309
+G1 X-10.000 Y-17.321 Z1.133 E20.32411
+G1 X-8.745 Y-18.754 Z1.136 E20.38698
+G1 X-7.077 Y-19.445 Z1.139 E20.44655
+G1 X-5.176 Y-19.319 Z1.142 E20.50942
+G1 X-3.353 Y-19.014 Z1.144 E20.57044
+G1 X-1.683 Y-19.234 Z1.147 E20.62602
+G1 X-0.000 Y-20.000 Z1.150 E20.68704
+G1 X1.803 Y-20.614 Z1.153 E20.74991
+G1 X3.593 Y-20.378 Z1.156 E20.80948
+G1 X5.176 Y-19.319 Z1.158 E20.87236
+G1 X6.603 Y-18.143 Z1.161 E20.93337
+G1 X8.160 Y-17.498 Z1.164 E20.98896
+G1 X10.000 Y-17.321 Z1.167 E21.04997
+G1 X11.869 Y-16.951 Z1.169 E21.11284
+G1 X13.301 Y-15.852 Z1.172 E21.17242
+G1 X14.142 Y-14.142 Z1.175 E21.23529
+G1 X14.790 Y-12.410 Z1.178 E21.29630
+G1 X15.816 Y-11.074 Z1.181 E21.35189
+G1 X17.321 Y-10.000 Z1.183 E21.41290
+G1 X18.754 Y-8.745 Z1.186 E21.47577
+G1 X19.445 Y-7.077 Z1.189 E21.53535
+G1 X19.319 Y-5.176 Z1.192 E21.59822
+G1 X19.014 Y-3.353 Z1.194 E21.65923
+G1 X19.234 Y-1.683 Z1.197 E21.71482
+G1 X20.000 Y-0.000 Z1.200 E21.77583
+G1 X20.614 Y1.803 Z1.203 E21.83870
+G1 X20.378 Y3.593 Z1.206 E21.89828
+G1 X19.319 Y5.176 Z1.208 E21.96115
+G1 X18.143 Y6.603 Z1.211 E22.02216
+G1 X17.498 Y8.160 Z1.214 E22.07775
+G1 X17.321 Y10.000 Z1.217 E22.13876
+G1 X16.951 Y11.869 Z1.219 E22.20163
+G1 X15.852 Y13.301 Z1.222 E22.26121
+G1 X14.142 Y14.142 Z1.225 E22.32408
+G1 X12.410 Y14.790 Z1.228 E22.38509
+G1 X11.074 Y15.816 Z1.231 E22.44068
+G1 X10.000 Y17.321 Z1.233 E22.50169
+G1 X8.745 Y18.754 Z1.236 E22.56457
+G1 X7.077 Y19.445 Z1.239 E22.62414
+G1 X5.176 Y19.319 Z1.242 E22.68701
+G1 X3.353 Y19.014 Z1.244 E22.74803
+G1 X1.683 Y19.234 Z1.247 E22.80361
+G1 X-0.000 Y20.000 Z1.250 E22.86463
+G1 X-1.803 Y20.614 Z1.253 E22.92750
+G1 X-3.593 Y20.378 Z1.256 E22.98707
+G1 X-5.176 Y19.319 Z1.258 E23.04994
+G1 X-6.603 Y18.143 Z1.261 E23.11096
+G1 X-8.160 Y17.498 Z1.264 E23.16654
+G1 X-10.000 Y17.321 Z1.267 E23.22756
+G1 X-11.869 Y16.951 Z1.269 E23.29043
+G1 X-13.301 Y15.852 Z1.272 E23.35000
+G1 X-14.142 Y14.142 Z1.275 E23.41287
+G1 X-14.790 Y12.410 Z1.278 E23.47389
+G1 X-15.816 Y11.074 Z1.281 E23.52947
+G1 X-17.321 Y10.000 Z1.283 E23.59049
+G1 X-18.754 Y8.745 Z1.286 E23.65336
+G1 X-19.445 Y7.077 Z1.289 E23.71293
+G1 X-19.319 Y5.176 Z1.292 E23.77580
+G1 X-19.014 Y3.353 Z1.294 E23.83682
+G1 X-19.234 Y1.683 Z1.297 E23.89240
+G1 X-20.000 Y-0.000 Z1.300 E23.95342
+G1 X-20.614 Y-1.803 Z1.303 E24.01629
+G1 X-20.378 Y-3.593 Z1.306 E24.07586
+G1 X-19.319 Y-5.176 Z1.308 E24.13873
+G1 X-18.143 Y-6.603 Z1.311 E24.19975
+G1 X-17.498 Y-8.160 Z1.314 E24.25533
+G1 X-17.321 Y-10.000 Z1.317 E24.31635
+G1 X-16.951 Y-11.869 Z1.319 E24.37922
+G1 X-15.852 Y-13.301 Z1.322 E24.43879
+G1 X-14.142 Y-14.142 Z1.325 E24.50166
+G1 X-12.410 Y-14.790 Z1.328 E24.56268
+G1 X-11.074 Y-15.816 Z1.331 E24.61826
+G1 X-10.000 Y-17.321 Z1.333 E24.67928
+G1 X-8.745 Y-18.754 Z1.336 E24.74215
+G1 X-7.077 Y-19.445 Z1.339 E24.80172
+G1 X-5.176 Y-19.319 Z1.342 E24.86459
+G1 X-3.353 Y-19.014 Z1.344 E24.92561
+G1 X-1.683 Y-19.234 Z1.347 E24.98119
+G1 X-0.000 Y-20.000 Z1.350 E25.04221
+G1 X1.803 Y-20.614 Z1.353 E25.10508
+G1 X3.593 Y-20.378 Z1.356 E25.16465
+G1 X5.176 Y-19.319 Z1.358 E25.22752
+G1 X6.603 Y-18.143 Z1.361 E25.28854
+G1 X8.160 Y-17.498 Z1.364 E25.34412
+G1 X10.000 Y-17.321 Z1.367 E25.40514
+G1 X11.869 Y-16.951 Z1.369 E25.46801
+G1 X13.301 Y-15.852 Z1.372 E25.52758
+G1 X14.142 Y-14.142 Z1.375 E25.59045
+G1 X14.790 Y-12.410 Z1.378 E25.65147
+G1 X15.816 Y-11.074 Z1.381 E25.70705
+G1 X17.321 Y-10.000 Z1.383 E25.76807
+G1 X18.754 Y-8.745 Z1.386 E25.83094
+G1 X19.445 Y-7.077 Z1.389 E25.89051
+G1 X19.319 Y-5.176 Z1.392 E25.95338
+G1 X19.014 Y-3.353 Z1.394 E26.01440
+G1 X19.234 Y-1.683 Z1.397 E26.06998
+G1 X20.000 Y-0.000 Z1.400 E26.13100
+G1 X20.614 Y1.803 Z1.403 E26.19387
+G1 X20.378 Y3.593 Z1.406 E26.25344
+G1 X19.319 Y5.176 Z1.408 E26.31631
+G1 X18.143 Y6.603 Z1.411 E26.37733
+G1 X17.498 Y8.160 Z1.414 E26.43291
+G1 X17.321 Y10.000 Z1.417 E26.49393
+G1 X16.951 Y11.869 Z1.419 E26.55680
+G1 X15.852 Y13.301 Z1.422 E26.61637
+G1 X14.142 Y14.142 Z1.425 E26.67924
+G1 X12.410 Y14.790 Z1.428 E26.74026
+G1 X11.074 Y15.816 Z1.431 E26.79584
+G1 X10.000 Y17.321 Z1.433 E26.85686
+G1 X8.745 Y18.754 Z1.436 E26.91973
+G1 X7.077 Y19.445 Z1.439 E26.97930
+G1 X5.176 Y19.319 Z1.442 E27.04217
+G1 X3.353 Y19.014 Z1.444 E27.10319
+G1 X1.683 Y19.234 Z1.447 E27.15877
+G1 X-0.000 Y20.000 Z1.450 E27.21979
+G1 X-1.803 Y20.614 Z1.453 E27.28266
+G1 X-3.593 Y20.378 Z1.456 E27.34223
+G1 X-5.176 Y19.319 Z1.458 E27.40511
+G1 X-6.603 Y18.143 Z1.461 E27.46612
+G1 X-8.160 Y17.498 Z1.464 E27.52171
+G1 X-10.000 Y17.321 Z1.467 E27.58272
+G1 X-11.869 Y16.951 Z1.469 E27.64559
+G1 X-13.301 Y15.852 Z1.472 E27.70517
+G1 X-14.142 Y14.142 Z1.475 E27.76804
+G1 X-14.790 Y12.410 Z1.478 E27.82905
+G1 X-15.816 Y11.074 Z1.481 E27.88464
+G1 X-17.321 Y10.000 Z1.483 E27.94565
+G1 X-18.754 Y8.745 Z1.486 E28.00852
+G1 X-19.445 Y7.077 Z1.489 E28.06810
+G1 X-19.319 Y5.176 Z1.492 E28.13097
+G1 X-19.014 Y3.353 Z1.494 E28.19198
+G1 X-19.234 Y1.683 Z1.497 E28.24757
+G1 X-20.000 Y-0.000 Z1.500 E28.30858
+G1 X-20.614 Y-1.803 Z1.503 E28.37145
+G1 X-20.378 Y-3.593 Z1.506 E28.43103
+G1 X-19.319 Y-5.176 Z1.508 E28.49390
+G1 X-18.143 Y-6.603 Z1.511 E28.55491
+G1 X-17.498 Y-8.160 Z1.514 E28.61050
+G1 X-17.321 Y-10.000 Z1.517 E28.67151
+G1 X-16.951 Y-11.869 Z1.519 E28.73438
+G1 X-15.852 Y-13.301 Z1.522 E28.79396
+G1 X-14.142 Y-14.142 Z1.525 E28.85683
+G1 X-12.410 Y-14.790 Z1.528 E28.91784
+G1 X-11.074 Y-15.816 Z1.531 E28.97343
+G1 X-10.000 Y-17.321 Z1.533 E29.03444
+G1 X-8.745 Y-18.754 Z1.536 E29.09732
+G1 X-7.077 Y-19.445 Z1.539 E29.15689
+G1 X-5.176 Y-19.319 Z1.542 E29.21976
+G1 X-3.353 Y-19.014 Z1.544 E29.28078
+G1 X-1.683 Y-19.234 Z1.547 E29.33636
+G1 X-0.000 Y-20.000 Z1.550 E29.39738
+G1 X1.803 Y-20.614 Z1.553 E29.46025
+G1 X3.593 Y-20.378 Z1.556 E29.51982
+G1 X5.176 Y-19.319 Z1.558 E29.58269
+G1 X6.603 Y-18.143 Z1.561 E29.64371
+G1 X8.160 Y-17.498 Z1.564 E29.69929
+G1 X10.000 Y-17.321 Z1.567 E29.76031
+G1 X11.869 Y-16.951 Z1.569 E29.82318
+G1 X13.301 Y-15.852 Z1.572 E29.88275
+G1 X14.142 Y-14.142 Z1.575 E29.94562
+G1 X14.790 Y-12.410 Z1.578 E30.00664
+G1 X15.816 Y-11.074 Z1.581 E30.06222
+G1 X17.321 Y-10.000 Z1.583 E30.12324
+G1 X18.754 Y-8.745 Z1.586 E30.18611
+G1 X19.445 Y-7.077 Z1.589 E30.24568
+G1 X19.319 Y-5.176 Z1.592 E30.30855
+G1 X19.014 Y-3.353 Z1.594 E30.36957
+G1 X19.234 Y-1.683 Z1.597 E30.42515
+G1 X20.000 Y-0.000 Z1.600 E30.48617
+G1 X20.614 Y1.803 Z1.603 E30.54904
+G1 X20.378 Y3.593 Z1.606 E30.60861
+G1 X19.319 Y5.176 Z1.608 E30.67148
+G1 X18.143 Y6.603 Z1.611 E30.73250
+G1 X17.498 Y8.160 Z1.614 E30.78808
+G1 X17.321 Y10.000 Z1.617 E30.84910
+G1 X16.951 Y11.869 Z1.619 E30.91197
+G1 X15.852 Y13.301 Z1.622 E30.97154
+G1 X14.142 Y14.142 Z1.625 E31.03441
+G1 X12.410 Y14.790 Z1.628 E31.09543
+G1 X11.074 Y15.816 Z1.631 E31.15101
+G1 X10.000 Y17.321 Z1.633 E31.21203
+G1 X8.745 Y18.754 Z1.636 E31.27490
+G1 X7.077 Y19.445 Z1.639 E31.33447
+G1 X5.176 Y19.319 Z1.642 E31.39734
+G1 X3.353 Y19.014 Z1.644 E31.45836
+G1 X1.683 Y19.234 Z1.647 E31.51394
+G1 X0.000 Y20.000 Z1.650 E31.57496
+G1 X-1.803 Y20.614 Z1.653 E31.63783
+G1 X-3.593 Y20.378 Z1.656 E31.69740
+G1 X-5.176 Y19.319 Z1.658 E31.76027
+G1 X-6.603 Y18.143 Z1.661 E31.82129
+G1 X-8.160 Y17.498 Z1.664 E31.87687
+G1 X-10.000 Y17.321 Z1.667 E31.93789
+G1 X-11.869 Y16.951 Z1.669 E32.00076
+G1 X-13.301 Y15.852 Z1.672 E32.06033
+G1 X-14.142 Y14.142 Z1.675 E32.12320
+G1 X-14.790 Y12.410 Z1.678 E32.18422
+G1 X-15.816 Y11.074 Z1.681 E32.23980
+G1 X-17.321 Y10.000 Z1.683 E32.30082
+G1 X-18.754 Y8.745 Z1.686 E32.36369
+G1 X-19.445 Y7.077 Z1.689 E32.42326
+G1 X-19.319 Y5.176 Z1.692 E32.48613
+G1 X-19.014 Y3.353 Z1.694 E32.54715
+G1 X-19.234 Y1.683 Z1.697 E32.60273
+G1 X-20.000 Y0.000 Z1.700 E32.66375
+G1 X-20.614 Y-1.803 Z1.703 E32.72662
+G1 X-20.378 Y-3.593 Z1.706 E32.78619
+G1 X-19.319 Y-5.176 Z1.708 E32.84906
+G1 X-18.143 Y-6.603 Z1.711 E32.91008
+G1 X-17.498 Y-8.160 Z1.714 E32.96566
+G1 X-17.321 Y-10.000 Z1.717 E33.02668
+G1 X-16.951 Y-11.869 Z1.719 E33.08955
+G1 X-15.852 Y-13.301 Z1.722 E33.14912
+G1 X-14.142 Y-14.142 Z1.725 E33.21199
+G1 X-12.410 Y-14.790 Z1.728 E33.27301
+G1 X-11.074 Y-15.816 Z1.731 E33.32859
+G1 X-10.000 Y-17.321 Z1.733 E33.38961
+G1 X-8.745 Y-18.754 Z1.736 E33.45248
+G1 X-7.077 Y-19.445 Z1.739 E33.51205
+G1 X-5.176 Y-19.319 Z1.742 E33.57492
+G1 X-3.353 Y-19.014 Z1.744 E33.63594
+G1 X-1.683 Y-19.234 Z1.747 E33.69152
+G1 X-0.000 Y-20.000 Z1.750 E33.75254
+G1 X1.803 Y-20.614 Z1.753 E33.81541
+G1 X3.593 Y-20.378 Z1.756 E33.87498
+G1 X5.176 Y-19.319 Z1.758 E33.93786
+G1 X6.603 Y-18.143 Z1.761 E33.99887
+G1 X8.160 Y-17.498 Z1.764 E34.05446
+G1 X10.000 Y-17.321 Z1.767 E34.11547
+G1 X11.869 Y-16.951 Z1.769 E34.17834
+G1 X13.301 Y-15.852 Z1.772 E34.23792
+G1 X14.142 Y-14.142 Z1.775 E34.30079
+G1 X14.790 Y-12.410 Z1.778 E34.36180
+G1 X15.816 Y-11.074 Z1.781 E34.41739
+G1 X17.321 Y-10.000 Z1.783 E34.47840
+G1 X18.754 Y-8.745 Z1.786 E34.54127
+G1 X19.445 Y-7.077 Z1.789 E34.60085
+G1 X19.319 Y-5.176 Z1.792 E34.66372
+G1 X19.014 Y-3.353 Z1.794 E34.72473
+G1 X19.234 Y-1.683 Z1.797 E34.78032
+G1 X20.000 Y-0.000 Z1.800 E34.84133
+G1 X20.614 Y1.803 Z1.803 E34.90420
+G1 X20.378 Y3.593 Z1.806 E34.96378
+G1 X19.319 Y5.176 Z1.808 E35.02665
+G1 X18.143 Y6.603 Z1.811 E35.08766
+G1 X17.498 Y8.160 Z1.814 E35.14325
+G1 X17.321 Y10.000 Z1.817 E35.20426
+G1 X16.951 Y11.869 Z1.819 E35.26713
+G1 X15.852 Y13.301 Z1.822 E35.32671
+G1 X14.142 Y14.142 Z1.825 E35.38958
+G1 X12.410 Y14.790 Z1.828 E35.45059
+G1 X11.074 Y15.816 Z1.831 E35.50618
+G1 X10.000 Y17.321 Z1.833 E35.56719
+G1 X8.745 Y18.754 Z1.836 E35.63007
+G1 X7.077 Y19.445 Z1.839 E35.68964
+G1 X5.176 Y19.319 Z1.842 E35.75251
+G1 X3.353 Y19.014 Z1.844 E35.81353
+G1 X1.683 Y19.234 Z1.847 E35.86911
+G1 X0.000 Y20.000 Z1.850 E35.93013
+G1 X-1.803 Y20.614 Z1.853 E35.99300
+G1 X-3.593 Y20.378 Z1.856 E36.05257
+G1 X-5.176 Y19.319 Z1.858 E36.11544
+G1 X-6.603 Y18.143 Z1.861 E36.17646
+G1 X-8.160 Y17.498 Z1.864 E36.23204
+G1 X-10.000 Y17.321 Z1.867 E36.29306
+G1 X-11.869 Y16.951 Z1.869 E36.35593
+G1 X-13.301 Y15.852 Z1.872 E36.41550
+G1 X-14.142 Y14.142 Z1.875 E36.47837
+G1 X-14.790 Y12.410 Z1.878 E36.53939
+G1 X-15.816 Y11.074 Z1.881 E36.59497
+G1 X-17.321 Y10.000 Z1.883 E36.65599
+G1 X-18.754 Y8.745 Z1.886 E36.71886
+G1 X-19.445 Y7.077 Z1.889 E36.77843
+G1 X-19.319 Y5.176 Z1.892 E36.84130
+G1 X-19.014 Y3.353 Z1.894 E36.90232
+G1 X-19.234 Y1.683 Z1.897 E36.95790
+G1 X-20.000 Y-0.000 Z1.900 E37.01892
+G1 X-20.614 Y-1.803 Z1.903 E37.08179
+G1 X-20.378 Y-3.593 Z1.906 E37.14136
+G1 X-19.319 Y-5.176 Z1.908 E37.20423
+G1 X-18.143 Y-6.603 Z1.911 E37.26525
+G1 X-17.498 Y-8.160 Z1.914 E37.32083
+G1 X-17.321 Y-10.000 Z1.917 E37.38185
+G1 X-16.951 Y-11.869 Z1.919 E37.44472
+G1 X-15.852 Y-13.301 Z1.922 E37.50429
+G1 X-14.142 Y-14.142 Z1.925 E37.56716
+G1 X-12.410 Y-14.790 Z1.928 E37.62818
+G1 X-11.074 Y-15.816 Z1.931 E37.68376
+G1 X-10.000 Y-17.321 Z1.933 E37.74478
+G1 X-8.745 Y-18.754 Z1.936 E37.80765
+G1 X-7.077 Y-19.445 Z1.939 E37.86722
+G1 X-5.176 Y-19.319 Z1.942 E37.93009
+G1 X-3.353 Y-19.014 Z1.944 E37.99111
+G1 X-1.683 Y-19.234 Z1.947 E38.04669
+G1 X0.000 Y-20.000 Z1.950 E38.10771
+G1 X1.803 Y-20.614 Z1.953 E38.17058
+G1 X3.593 Y-20.378 Z1.956 E38.23015
+G1 X5.176 Y-19.319 Z1.958 E38.29302
+G1 X6.603 Y-18.143 Z1.961 E38.35404
+G1 X8.160 Y-17.498 Z1.964 E38.40962
+G1 X10.000 Y-17.321 Z1.967 E38.47064
+G1 X11.869 Y-16.951 Z1.969 E38.53351
+G1 X13.301 Y-15.852 Z1.972 E38.59308
+G1 X14.142 Y-14.142 Z1.975 E38.65595
+G1 X14.790 Y-12.410 Z1.978 E38.71697
+G1 X15.816 Y-11.074 Z1.981 E38.77255
+G1 X17.321 Y-10.000 Z1.983 E38.83357
+G1 X18.754 Y-8.745 Z1.986 E38.89644
+G1 X19.445 Y-7.077 Z1.989 E38.95601
+G1 X19.319 Y-5.176 Z1.992 E39.01888
+G1 X19.014 Y-3.353 Z1.994 E39.07990
+G1 X19.234 Y-1.683 Z1.997 E39.13548
+G1 X20.000 Y-0.000 Z2.000 E39.19650
+G1 X20.614 Y1.803 Z2.003 E39.25937
+G1 X20.378 Y3.593 Z2.006 E39.31894
+G1 X19.319 Y5.176 Z2.008 E39.38181
+G1 X18.143 Y6.603 Z2.011 E39.44283
+G1 X17.498 Y8.160 Z2.014 E39.49841
+G1 X17.321 Y10.000 Z2.017 E39.55943
+G1 X16.951 Y11.869 Z2.019 E39.62230
+G1 X15.852 Y13.301 Z2.022 E39.68187
+G1 X14.142 Y14.142 Z2.025 E39.74474
+G1 X12.410 Y14.790 Z2.028 E39.80576
+G1 X11.074 Y15.816 Z2.031 E39.86134
+G1 X10.000 Y17.321 Z2.033 E39.92236
+G1 X8.745 Y18.754 Z2.036 E39.98523
+G1 X7.077 Y19.445 Z2.039 E40.04480
+G1 X5.176 Y19.319 Z2.042 E40.10767
+G1 X3.353 Y19.014 Z2.044 E40.16869
+G1 X1.683 Y19.234 Z2.047 E40.22427
+G1 X0.000 Y20.000 Z2.050 E40.28529
+G1 X-1.803 Y20.614 Z2.053 E40.34816
+G1 X-3.593 Y20.378 Z2.056 E40.40773
+G1 X-5.176 Y19.319 Z2.058 E40.47061
+G1 X-6.603 Y18.143 Z2.061 E40.53162
+G1 X-8.160 Y17.498 Z2.064 E40.58721
+G1 X-10.000 Y17.321 Z2.067 E40.64822
+G1 X-11.869 Y16.951 Z2.069 E40.71109
+G1 X-13.301 Y15.852 Z2.072 E40.77067
+G1 X-14.142 Y14.142 Z2.075 E40.83354
+G1 X-14.790 Y12.410 Z2.078 E40.89455
+G1 X-15.816 Y11.074 Z2.081 E40.95014
+G1 X-17.321 Y10.000 Z2.083 E41.01115
+G1 X-18.754 Y8.745 Z2.086 E41.07402
+G1 X-19.445 Y7.077 Z2.089 E41.13360
+G1 X-19.319 Y5.176 Z2.092 E41.19647
+G1 X-19.014 Y3.353 Z2.094 E41.25748
+G1 X-19.234 Y1.683 Z2.097 E41.31307
+G1 X-20.000 Y0.000 Z2.100 E41.37408
+G1 X-20.614 Y-1.803 Z2.103 E41.43695
+G1 X-20.378 Y-3.593 Z2.106 E41.49653
+G1 X-19.319 Y-5.176 Z2.108 E41.55940
+G1 X-18.143 Y-6.603 Z2.111 E41.62041
+G1 X-17.498 Y-8.160 Z2.114 E41.67600
+G1 X-17.321 Y-10.000 Z2.117 E41.73701
+G1 X-16.951 Y-11.869 Z2.119 E41.79988
+G1 X-15.852 Y-13.301 Z2.122 E41.85946
+G1 X-14.142 Y-14.142 Z2.125 E41.92233
+G1 X-12.410 Y-14.790 Z2.128 E41.98334
+G1 X-11.074 Y-15.816 Z2.131 E42.03893
+G1 X-10.000 Y-17.321 Z2.133 E42.09994
+G1 X-8.745 Y-18.754 Z2.136 E42.16282
+G1 X-7.077 Y-19.445 Z2.139 E42.22239
+G1 X-5.176 Y-19.319 Z2.142 E42.28526
+G1 X-3.353 Y-19.014 Z2.144 E42.34628
+G1 X-1.683 Y-19.234 Z2.147 E42.40186
+G1 X-0.000 Y-20.000 Z2.150 E42.46288
+G1 X1.803 Y-20.614 Z2.153 E42.52575
+G1 X3.593 Y-20.378 Z2.156 E42.58532
+G1 X5.176 Y-19.319 Z2.158 E42.64819
+G1 X6.603 Y-18.143 Z2.161 E42.70921
+G1 X8.160 Y-17.498 Z2.164 E42.76479
+G1 X10.000 Y-17.321 Z2.167 E42.82581
+G1 X11.869 Y-16.951 Z2.169 E42.88868
+G1 X13.301 Y-15.852 Z2.172 E42.94825
+G1 X14.142 Y-14.142 Z2.175 E43.01112
+G1 X14.790 Y-12.410 Z2.178 E43.07214
+G1 X15.816 Y-11.074 Z2.181 E43.12772
+G1 X17.321 Y-10.000 Z2.183 E43.18874
+G1 X18.754 Y-8.745 Z2.186 E43.25161
+G1 X19.445 Y-7.077 Z2.189 E43.31118
+G1 X19.319 Y-5.176 Z2.192 E43.37405
+G1 X19.014 Y-3.353 Z2.194 E43.43507
+G1 X19.234 Y-1.683 Z2.197 E43.49065
+G1 X20.000 Y-0.000 Z2.200 E43.55167
+G1 X20.614 Y1.803 Z2.203 E43.61454
+G1 X20.378 Y3.593 Z2.206 E43.67411
+G1 X19.319 Y5.176 Z2.208 E43.73698
+G1 X18.143 Y6.603 Z2.211 E43.79800
+G1 X17.498 Y8.160 Z2.214 E43.85358
+G1 X17.321 Y10.000 Z2.217 E43.91460
+G1 X16.951 Y11.869 Z2.219 E43.97747
+G1 X15.852 Y13.301 Z2.222 E44.03704
+G1 X14.142 Y14.142 Z2.225 E44.09991
+G1 X12.410 Y14.790 Z2.228 E44.16093
+G1 X11.074 Y15.816 Z2.231 E44.21651
+G1 X10.000 Y17.321 Z2.233 E44.27753
+G1 X8.745 Y18.754 Z2.236 E44.34040
+G1 X7.077 Y19.445 Z2.239 E44.39997
+G1 X5.176 Y19.319 Z2.242 E44.46284
+G1 X3.353 Y19.014 Z2.244 E44.52386
+G1 X1.683 Y19.234 Z2.247 E44.57944
+G1 X-0.000 Y20.000 Z2.250 E44.64046
+G1 X-1.803 Y20.614 Z2.253 E44.70333
+G1 X-3.593 Y20.378 Z2.256 E44.76290
+G1 X-5.176 Y19.319 Z2.258 E44.82577
+G1 X-6.603 Y18.143 Z2.261 E44.88679
+G1 X-8.160 Y17.498 Z2.264 E44.94237
+G1 X-10.000 Y17.321 Z2.267 E45.00339
+G1 X-11.869 Y16.951 Z2.269 E45.06626
+G1 X-13.301 Y15.852 Z2.272 E45.12583
+G1 X-14.142 Y14.142 Z2.275 E45.18870
+G1 X-14.790 Y12.410 Z2.278 E45.24972
+G1 X-15.816 Y11.074 Z2.281 E45.30530
+G1 X-17.321 Y10.000 Z2.283 E45.36632
+G1 X-18.754 Y8.745 Z2.286 E45.42919
+G1 X-19.445 Y7.077 Z2.289 E45.48876
+G1 X-19.319 Y5.176 Z2.292 E45.55163
+G1 X-19.014 Y3.353 Z2.294 E45.61265
+G1 X-19.234 Y1.683 Z2.297 E45.66823
+G1 X-20.000 Y-0.000 Z2.300 E45.72925
+G1 X-20.614 Y-1.803 Z2.303 E45.79212
+G1 X-20.378 Y-3.593 Z2.306 E45.85169
+G1 X-19.319 Y-5.176 Z2.308 E45.91456
+G1 X-18.143 Y-6.603 Z2.311 E45.97558
+G1 X-17.498 Y-8.160 Z2.314 E46.03116
+G1 X-17.321 Y-10.000 Z2.317 E46.09218
+G1 X-16.951 Y-11.869 Z2.319 E46.15505
+G1 X-15.852 Y-13.301 Z2.322 E46.21462
+G1 X-14.142 Y-14.142 Z2.325 E46.27749
+G1 X-12.410 Y-14.790 Z2.328 E46.33851
+G1 X-11.074 Y-15.816 Z2.331 E46.39409
+G1 X-10.000 Y-17.321 Z2.333 E46.45511
+G1 X-8.745 Y-18.754 Z2.336 E46.51798
+G1 X-7.077 Y-19.445 Z2.339 E46.57755
+G1 X-5.176 Y-19.319 Z2.342 E46.64042
+G1 X-3.353 Y-19.014 Z2.344 E46.70144
+G1 X-1.683 Y-19.234 Z2.347 E46.75702
+G1 X-0.000 Y-20.000 Z2.350 E46.81804
+G1 X1.803 Y-20.614 Z2.353 E46.88091
+G1 X3.593 Y-20.378 Z2.356 E46.94048
+G1 X5.176 Y-19.319 Z2.358 E47.00336
+G1 X6.603 Y-18.143 Z2.361 E47.06437
+G1 X8.160 Y-17.498 Z2.364 E47.11996
+G1 X10.000 Y-17.321 Z2.367 E47.18097
+G1 X11.869 Y-16.951 Z2.369 E47.24384
+G1 X13.301 Y-15.852 Z2.372 E47.30342
+G1 X14.142 Y-14.142 Z2.375 E47.36629
+G1 X14.790 Y-12.410 Z2.378 E47.42730
+G1 X15.816 Y-11.074 Z2.381 E47.48289
+G1 X17.321 Y-10.000 Z2.383 E47.54390
+G1 X18.754 Y-8.745 Z2.386 E47.60677
+G1 X19.445 Y-7.077 Z2.389 E47.66635
+G1 X19.319 Y-5.176 Z2.392 E47.72922
+G1 X19.014 Y-3.353 Z2.394 E47.79023
+G1 X19.234 Y-1.683 Z2.397 E47.84582
+G1 X20.000 Y0.000 Z2.400 E47.90683
+G1 X20.614 Y1.803 Z2.403 E47.96970
+G1 X20.378 Y3.593 Z2.406 E48.02928
+G1 X19.319 Y5.176 Z2.408 E48.09215
+G1 X18.143 Y6.603 Z2.411 E48.15316
+G1 X17.498 Y8.160 Z2.414 E48.20875
+G1 X17.321 Y10.000 Z2.417 E48.26976
+G1 X16.951 Y11.869 Z2.419 E48.33263
+G1 X15.852 Y13.301 Z2.422 E48.39221
+G1 X14.142 Y14.142 Z2.425 E48.45508
+G1 X12.410 Y14.790 Z2.428 E48.51609
+G1 X11.074 Y15.816 Z2.431 E48.57168
+G1 X10.000 Y17.321 Z2.433 E48.63269
+G1 X8.745 Y18.754 Z2.436 E48.69557
+G1 X7.077 Y19.445 Z2.439 E48.75514
+G1 X5.176 Y19.319 Z2.442 E48.81801
+G1 X3.353 Y19.014 Z2.444 E48.87903
+G1 X1.683 Y19.234 Z2.447 E48.93461
+G1 X0.000 Y20.000 Z2.450 E48.99563
+G1 X-1.803 Y20.614 Z2.453 E49.05850
+G1 X-3.593 Y20.378 Z2.456 E49.11807
+G1 X-5.176 Y19.319 Z2.458 E49.18094
+G1 X-6.603 Y18.143 Z2.461 E49.24196
+G1 X-8.160 Y17.498 Z2.464 E49.29754
+G1 X-10.000 Y17.321 Z2.467 E49.35856
+G1 X-11.869 Y16.951 Z2.469 E49.42143
+G1 X-13.301 Y15.852 Z2.472 E49.48100
+G1 X-14.142 Y14.142 Z2.475 E49.54387
+G1 X-14.790 Y12.410 Z2.478 E49.60489
+G1 X-15.816 Y11.074 Z2.481 E49.66047
+G1 X-17.321 Y10.000 Z2.483 E49.72149
+G1 X-18.754 Y8.745 Z2.486 E49.78436
+G1 X-19.445 Y7.077 Z2.489 E49.84393
+G1 X-19.319 Y5.176 Z2.492 E49.90680
+G1 X-19.014 Y3.353 Z2.494 E49.96782
+G1 X-19.234 Y1.683 Z2.497 E50.02340
+G1 X-20.000 Y0.000 Z2.500 E50.08442
+G1 X-20.614 Y-1.803 Z2.503 E50.14729
+G1 X-20.378 Y-3.593 Z2.506 E50.20686
+G1 X-19.319 Y-5.176 Z2.508 E50.26973
+G1 X-18.143 Y-6.603 Z2.511 E50.33075
+G1 X-17.498 Y-8.160 Z2.514 E50.38633
+G1 X-17.321 Y-10.000 Z2.517 E50.44735
+G1 X-16.951 Y-11.869 Z2.519 E50.51022
+G1 X-15.852 Y-13.301 Z2.522 E50.56979
+G1 X-14.142 Y-14.142 Z2.525 E50.63266
+G1 X-12.410 Y-14.790 Z2.528 E50.69368
+G1 X-11.074 Y-15.816 Z2.531 E50.74926
+G1 X-10.000 Y-17.321 Z2.533 E50.81028
+G1 X-8.745 Y-18.754 Z2.536 E50.87315
+G1 X-7.077 Y-19.445 Z2.539 E50.93272
+G1 X-5.176 Y-19.319 Z2.542 E50.99559
+G1 X-3.353 Y-19.014 Z2.544 E51.05661
+G1 X-1.683 Y-19.234 Z2.547 E51.11219
+G1 X-0.000 Y-20.000 Z2.550 E51.17321
+G1 X1.803 Y-20.614 Z2.553 E51.23608
+G1 X3.593 Y-20.378 Z2.556 E51.29565
+G1 X5.176 Y-19.319 Z2.558 E51.35852
+G1 X6.603 Y-18.143 Z2.561 E51.41954
+G1 X8.160 Y-17.498 Z2.564 E51.47512
+G1 X10.000 Y-17.321 Z2.567 E51.53614
+G1 X11.869 Y-16.951 Z2.569 E51.59901
+G1 X13.301 Y-15.852 Z2.572 E51.65858
+G1 X14.142 Y-14.142 Z2.575 E51.72145
+G1 X14.790 Y-12.410 Z2.578 E51.78247
+G1 X15.816 Y-11.074 Z2.581 E51.83805
+G1 X17.321 Y-10.000 Z2.583 E51.89907
+G1 X18.754 Y-8.745 Z2.586 E51.96194
+G1 X19.445 Y-7.077 Z2.589 E52.02151
+G1 X19.319 Y-5.176 Z2.592 E52.08438
+G1 X19.014 Y-3.353 Z2.594 E52.14540
+G1 X19.234 Y-1.683 Z2.597 E52.20098
+G1 X20.000 Y-0.000 Z2.600 E52.26200
+G1 X20.614 Y1.803 Z2.603 E52.32487
+G1 X20.378 Y3.593 Z2.606 E52.38444
+G1 X19.319 Y5.176 Z2.608 E52.44731
+G1 X18.143 Y6.603 Z2.611 E52.50833
+G1 X17.498 Y8.160 Z2.614 E52.56391
+G1 X17.321 Y10.000 Z2.617 E52.62493
+G1 X16.951 Y11.869 Z2.619 E52.68780
+G1 X15.852 Y13.301 Z2.622 E52.74737
+G1 X14.142 Y14.142 Z2.625 E52.81024
+G1 X12.410 Y14.790 Z2.628 E52.87126
+G1 X11.074 Y15.816 Z2.631 E52.92684
+G1 X10.000 Y17.321 Z2.633 E52.98786
+G1 X8.745 Y18.754 Z2.636 E53.05073
+G1 X7.077 Y19.445 Z2.639 E53.11030
+G1 X5.176 Y19.319 Z2.642 E53.17317
+G1 X3.353 Y19.014 Z2.644 E53.23419
+G1 X1.683 Y19.234 Z2.647 E53.28977
+G1 X0.000 Y20.000 Z2.650 E53.35079
+G1 X-1.803 Y20.614 Z2.653 E53.41366
+G1 X-3.593 Y20.378 Z2.656 E53.47323
+G1 X-5.176 Y19.319 Z2.658 E53.53611
+G1 X-6.603 Y18.143 Z2.661 E53.59712
+G1 X-8.160 Y17.498 Z2.664 E53.65271
+G1 X-10.000 Y17.321 Z2.667 E53.71372
+G1 X-11.869 Y16.951 Z2.669 E53.77659
+G1 X-13.301 Y15.852 Z2.672 E53.83617
+G1 X-14.142 Y14.142 Z2.675 E53.89904
+G1 X-14.790 Y12.410 Z2.678 E53.96005
+G1 X-15.816 Y11.074 Z2.681 E54.01564
+G1 X-17.321 Y10.000 Z2.683 E54.07665
+G1 X-18.754 Y8.745 Z2.686 E54.13952
+G1 X-19.445 Y7.077 Z2.689 E54.19910
+G1 X-19.319 Y5.176 Z2.692 E54.26197
+G1 X-19.014 Y3.353 Z2.694 E54.32298
+G1 X-19.234 Y1.683 Z2.697 E54.37857
+G1 X-20.000 Y-0.000 Z2.700 E54.43958
+G1 X-20.614 Y-1.803 Z2.703 E54.50245
+G1 X-20.378 Y-3.593 Z2.706 E54.56203
+G1 X-19.319 Y-5.176 Z2.708 E54.62490
+G1 X-18.143 Y-6.603 Z2.711 E54.68591
+G1 X-17.498 Y-8.160 Z2.714 E54.74150
+G1 X-17.321 Y-10.000 Z2.717 E54.80251
+G1 X-16.951 Y-11.869 Z2.719 E54.86538
+G1 X-15.852 Y-13.301 Z2.722 E54.92496
+G1 X-14.142 Y-14.142 Z2.725 E54.98783
+G1 X-12.410 Y-14.790 Z2.728 E55.04884
+G1 X-11.074 Y-15.816 Z2.731 E55.10443
+G1 X-10.000 Y-17.321 Z2.733 E55.16544
+G1 X-8.745 Y-18.754 Z2.736 E55.22832
+G1 X-7.077 Y-19.445 Z2.739 E55.28789
+G1 X-5.176 Y-19.319 Z2.742 E55.35076
+G1 X-3.353 Y-19.014 Z2.744 E55.41178
+G1 X-1.683 Y-19.234 Z2.747 E55.46736
+G1 X-0.000 Y-20.000 Z2.750 E55.52838
+G1 X1.803 Y-20.614 Z2.753 E55.59125
+G1 X3.593 Y-20.378 Z2.756 E55.65082
+G1 X5.176 Y-19.319 Z2.758 E55.71369
+G1 X6.603 Y-18.143 Z2.761 E55.77471
+G1 X8.160 Y-17.498 Z2.764 E55.83029
+G1 X10.000 Y-17.321 Z2.767 E55.89131
+G1 X11.869 Y-16.951 Z2.769 E55.95418
+G1 X13.301 Y-15.852 Z2.772 E56.01375
+G1 X14.142 Y-14.142 Z2.775 E56.07662
+G1 X14.790 Y-12.410 Z2.778 E56.13764
+G1 X15.816 Y-11.074 Z2.781 E56.19322
+G1 X17.321 Y-10.000 Z2.783 E56.25424
+G1 X18.754 Y-8.745 Z2.786 E56.31711
+G1 X19.445 Y-7.077 Z2.789 E56.37668
+G1 X19.319 Y-5.176 Z2.792 E56.43955
+G1 X19.014 Y-3.353 Z2.794 E56.50057
+G1 X19.234 Y-1.683 Z2.797 E56.55615
+G1 X20.000 Y0.000 Z2.800 E56.61717
+G1 X20.614 Y1.803 Z2.803 E56.68004
+G1 X20.378 Y3.593 Z2.806 E56.73961
+G1 X19.319 Y5.176 Z2.808 E56.80248
+G1 X18.143 Y6.603 Z2.811 E56.86350
+G1 X17.498 Y8.160 Z2.814 E56.91908
+G1 X17.321 Y10.000 Z2.817 E56.98010
+G1 X16.951 Y11.869 Z2.819 E57.04297
+G1 X15.852 Y13.301 Z2.822 E57.10254
+G1 X14.142 Y14.142 Z2.825 E57.16541
+G1 X12.410 Y14.790 Z2.828 E57.22643
+G1 X11.074 Y15.816 Z2.831 E57.28201
+G1 X10.000 Y17.321 Z2.833 E57.34303
+G1 X8.745 Y18.754 Z2.836 E57.40590
+G1 X7.077 Y19.445 Z2.839 E57.46547
+G1 X5.176 Y19.319 Z2.842 E57.52834
+G1 X3.353 Y19.014 Z2.844 E57.58936
+G1 X1.683 Y19.234 Z2.847 E57.64494
+G1 X0.000 Y20.000 Z2.850 E57.70596
+G1 X-1.803 Y20.614 Z2.853 E57.76883
+G1 X-3.593 Y20.378 Z2.856 E57.82840
+G1 X-5.176 Y19.319 Z2.858 E57.89127
+G1 X-6.603 Y18.143 Z2.861 E57.95229
+G1 X-8.160 Y17.498 Z2.864 E58.00787
+G1 X-10.000 Y17.321 Z2.867 E58.06889
+G1 X-11.869 Y16.951 Z2.869 E58.13176
+G1 X-13.301 Y15.852 Z2.872 E58.19133
+G1 X-14.142 Y14.142 Z2.875 E58.25420
+G1 X-14.790 Y12.410 Z2.878 E58.31522
+G1 X-15.816 Y11.074 Z2.881 E58.37080
+G1 X-17.321 Y10.000 Z2.883 E58.43182
+G1 X-18.754 Y8.745 Z2.886 E58.49469
+G1 X-19.445 Y7.077 Z2.889 E58.55426
+G1 X-19.319 Y5.176 Z2.892 E58.61713
+G1 X-19.014 Y3.353 Z2.894 E58.67815
+G1 X-19.234 Y1.683 Z2.897 E58.73373
+G1 X-20.000 Y0.000 Z2.900 E58.79475
+G1 X-20.614 Y-1.803 Z2.903 E58.85762
+G1 X-20.378 Y-3.593 Z2.906 E58.91719
+G1 X-19.319 Y-5.176 Z2.908 E58.98006
+G1 X-18.143 Y-6.603 Z2.911 E59.04108
+G1 X-17.498 Y-8.160 Z2.914 E59.09666
+G1 X-17.321 Y-10.000 Z2.917 E59.15768
+G1 X-16.951 Y-11.869 Z2.919 E59.22055
+G1 X-15.852 Y-13.301 Z2.922 E59.28012
+G1 X-14.142 Y-14.142 Z2.925 E59.34299
+G1 X-12.410 Y-14.790 Z2.928 E59.40401
+G1 X-11.074 Y-15.816 Z2.931 E59.45959
+G1 X-10.000 Y-17.321 Z2.933 E59.52061
+G1 X-8.745 Y-18.754 Z2.936 E59.58348
+G1 X-7.077 Y-19.445 Z2.939 E59.64305
+G1 X-5.176 Y-19.319 Z2.942 E59.70592
+G1 X-3.353 Y-19.014 Z2.944 E59.76694
+G1 X-1.683 Y-19.234 Z2.947 E59.82252
+G1 X0.000 Y-20.000 Z2.950 E59.88354
+G1 X1.803 Y-20.614 Z2.953 E59.94641
+G1 X3.593 Y-20.378 Z2.956 E60.00598
+G1 X5.176 Y-19.319 Z2.958 E60.06886
+G1 X6.603 Y-18.143 Z2.961 E60.12987
+G1 X8.160 Y-17.498 Z2.964 E60.18546
+G1 X10.000 Y-17.321 Z2.967 E60.24647
+G1 X11.869 Y-16.951 Z2.969 E60.30934
+G1 X13.301 Y-15.852 Z2.972 E60.36892
+G1 X14.142 Y-14.142 Z2.975 E60.43179
+G1 X14.790 Y-12.410 Z2.978 E60.49280
+G1 X15.816 Y-11.074 Z2.981 E60.54839
+G1 X17.321 Y-10.000 Z2.983 E60.60940
+G1 X18.754 Y-8.745 Z2.986 E60.67227
+G1 X19.445 Y-7.077 Z2.989 E60.73185
+G1 X19.319 Y-5.176 Z2.992 E60.79472
+G1 X19.014 Y-3.353 Z2.994 E60.85573
+G1 X19.234 Y-1.683 Z2.997 E60.91132
+G1 X20.000 Y-0.000 Z3.000 E60.97233
+G1 X20.614 Y1.803 Z3.003 E61.03520
+G1 X20.378 Y3.593 Z3.006 E61.09478
+G1 X19.319 Y5.176 Z3.008 E61.15765
+G1 X18.143 Y6.603 Z3.011 E61.21866
+G1 X17.498 Y8.160 Z3.014 E61.27425
+G1 X17.321 Y10.000 Z3.017 E61.33526
+G1 X16.951 Y11.869 Z3.019 E61.39813
+G1 X15.852 Y13.301 Z3.022 E61.45771
+G1 X14.142 Y14.142 Z3.025 E61.52058
+G1 X12.410 Y14.790 Z3.028 E61.58159
+G1 X11.074 Y15.816 Z3.031 E61.63718
+G1 X10.000 Y17.321 Z3.033 E61.69819
+G1 X8.745 Y18.754 Z3.036 E61.76107
+G1 X7.077 Y19.445 Z3.039 E61.82064
+G1 X5.176 Y19.319 Z3.042 E61.88351
+G1 X3.353 Y19.014 Z3.044 E61.94453
+G1 X1.683 Y19.234 Z3.047 E62.00011
+G1 X-0.000 Y20.000 Z3.050 E62.06113
+G1 X-1.803 Y20.614 Z3.053 E62.12400
+G1 X-3.593 Y20.378 Z3.056 E62.18357
+G1 X-5.176 Y19.319 Z3.058 E62.24644
+G1 X-6.603 Y18.143 Z3.061 E62.30746
+G1 X-8.160 Y17.498 Z3.064 E62.36304
+G1 X-10.000 Y17.321 Z3.067 E62.42406
+G1 X-11.869 Y16.951 Z3.069 E62.48693
+G1 X-13.301 Y15.852 Z3.072 E62.54650
+G1 X-14.142 Y14.142 Z3.075 E62.60937
+G1 X-14.790 Y12.410 Z3.078 E62.67039
+G1 X-15.816 Y11.074 Z3.081 E62.72597
+G1 X-17.321 Y10.000 Z3.083 E62.78699
+G1 X-18.754 Y8.745 Z3.086 E62.84986
+G1 X-19.445 Y7.077 Z3.089 E62.90943
+G1 X-19.319 Y5.176 Z3.092 E62.97230
+G1 X-19.014 Y3.353 Z3.094 E63.03332
+G1 X-19.234 Y1.683 Z3.097 E63.08890
+G1 X-20.000 Y0.000 Z3.100 E63.14992
+G1 X-20.614 Y-1.803 Z3.103 E63.21279
+G1 X-20.378 Y-3.593 Z3.106 E63.27236
+G1 X-19.319 Y-5.176 Z3.108 E63.33523
+G1 X-18.143 Y-6.603 Z3.111 E63.39625
+G1 X-17.498 Y-8.160 Z3.114 E63.45183
+G1 X-17.321 Y-10.000 Z3.117 E63.51285
+G1 X-16.951 Y-11.869 Z3.119 E63.57572
+G1 X-15.852 Y-13.301 Z3.122 E63.63529
+G1 X-14.142 Y-14.142 Z3.125 E63.69816
+G1 X-12.410 Y-14.790 Z3.128 E63.75918
+G1 X-11.074 Y-15.816 Z3.131 E63.81476
+G1 X-10.000 Y-17.321 Z3.133 E63.87578
+G1 X-8.745 Y-18.754 Z3.136 E63.93865
+G1 X-7.077 Y-19.445 Z3.139 E63.99822
+G1 X-5.176 Y-19.319 Z3.142 E64.06109
+G1 X-3.353 Y-19.014 Z3.144 E64.12211
+G1 X-1.683 Y-19.234 Z3.147 E64.17769
+G1 X-0.000 Y-20.000 Z3.150 E64.23871
+G1 X1.803 Y-20.614 Z3.153 E64.30158
+G1 X3.593 Y-20.378 Z3.156 E64.36115
+G1 X5.176 Y-19.319 Z3.158 E64.42402
+G1 X6.603 Y-18.143 Z3.161 E64.48504
+G1 X8.160 Y-17.498 Z3.164 E64.54062
+G1 X10.000 Y-17.321 Z3.167 E64.60164
+G1 X11.869 Y-16.951 Z3.169 E64.66451
+G1 X13.301 Y-15.852 Z3.172 E64.72408
+G1 X14.142 Y-14.142 Z3.175 E64.78695
+G1 X14.790 Y-12.410 Z3.178 E64.84797
+G1 X15.816 Y-11.074 Z3.181 E64.90355
+G1 X17.321 Y-10.000 Z3.183 E64.96457
+G1 X18.754 Y-8.745 Z3.186 E65.02744
+G1 X19.445 Y-7.077 Z3.189 E65.08701
+G1 X19.319 Y-5.176 Z3.192 E65.14988
+G1 X19.014 Y-3.353 Z3.194 E65.21090
+G1 X19.234 Y-1.683 Z3.197 E65.26648
+G1 X20.000 Y-0.000 Z3.200 E65.32750
+G1 X20.614 Y1.803 Z3.203 E65.39037
+G1 X20.378 Y3.593 Z3.206 E65.44994
+G1 X19.319 Y5.176 Z3.208 E65.51281
+G1 X18.143 Y6.603 Z3.211 E65.57383
+G1 X17.498 Y8.160 Z3.214 E65.62941
+G1 X17.321 Y10.000 Z3.217 E65.69043
+G1 X16.951 Y11.869 Z3.219 E65.75330
+G1 X15.852 Y13.301 Z3.222 E65.81287
+G1 X14.142 Y14.142 Z3.225 E65.87574
+G1 X12.410 Y14.790 Z3.228 E65.93676
+G1 X11.074 Y15.816 Z3.231 E65.99234
+G1 X10.000 Y17.321 Z3.233 E66.05336
+G1 X8.745 Y18.754 Z3.236 E66.11623
+G1 X7.077 Y19.445 Z3.239 E66.17580
+G1 X5.176 Y19.319 Z3.242 E66.23868
+G1 X3.353 Y19.014 Z3.244 E66.29969
+G1 X1.683 Y19.234 Z3.247 E66.35527
+G1 X0.000 Y20.000 Z3.250 E66.41629
+G1 X-1.803 Y20.614 Z3.253 E66.47916
+G1 X-3.593 Y20.378 Z3.256 E66.53873
+G1 X-5.176 Y19.319 Z3.258 E66.60161
+G1 X-6.603 Y18.143 Z3.261 E66.66262
+G1 X-8.160 Y17.498 Z3.264 E66.71821
+G1 X-10.000 Y17.321 Z3.267 E66.77922
+G1 X-11.869 Y16.951 Z3.269 E66.84209
+G1 X-13.301 Y15.852 Z3.272 E66.90167
+G1 X-14.142 Y14.142 Z3.275 E66.96454
+G1 X-14.790 Y12.410 Z3.278 E67.02555
+G1 X-15.816 Y11.074 Z3.281 E67.08114
+G1 X-17.321 Y10.000 Z3.283 E67.14215
+G1 X-18.754 Y8.745 Z3.286 E67.20502
+G1 X-19.445 Y7.077 Z3.289 E67.26460
+G1 X-19.319 Y5.176 Z3.292 E67.32747
+G1 X-19.014 Y3.353 Z3.294 E67.38848
+G1 X-19.234 Y1.683 Z3.297 E67.44407
+G1 X-20.000 Y0.000 Z3.300 E67.50508
+G1 X-20.614 Y-1.803 Z3.303 E67.56795
+G1 X-20.378 Y-3.593 Z3.306 E67.62753
+G1 X-19.319 Y-5.176 Z3.308 E67.69040
+G1 X-18.143 Y-6.603 Z3.311 E67.75141
+G1 X-17.498 Y-8.160 Z3.314 E67.80700
+G1 X-17.321 Y-10.000 Z3.317 E67.86801
+G1 X-16.951 Y-11.869 Z3.319 E67.93088
+G1 X-15.852 Y-13.301 Z3.322 E67.99046
+G1 X-14.142 Y-14.142 Z3.325 E68.05333
+G1 X-12.410 Y-14.790 Z3.328 E68.11434
+G1 X-11.074 Y-15.816 Z3.331 E68.16993
+G1 X-10.000 Y-17.321 Z3.333 E68.23094
+G1 X-8.745 Y-18.754 Z3.336 E68.29382
+G1 X-7.077 Y-19.445 Z3.339 E68.35339
+G1 X-5.176 Y-19.319 Z3.342 E68.41626
+G1 X-3.353 Y-19.014 Z3.344 E68.47728
+G1 X-1.683 Y-19.234 Z3.347 E68.53286
+G1 X0.000 Y-20.000 Z3.350 E68.59388
+G1 X1.803 Y-20.614 Z3.353 E68.65675
+G1 X3.593 Y-20.378 Z3.356 E68.71632
+G1 X5.176 Y-19.319 Z3.358 E68.77919
+G1 X6.603 Y-18.143 Z3.361 E68.84021
+G1 X8.160 Y-17.498 Z3.364 E68.89579
+G1 X10.000 Y-17.321 Z3.367 E68.95681
+G1 X11.869 Y-16.951 Z3.369 E69.01968
+G1 X13.301 Y-15.852 Z3.372 E69.07925
+G1 X14.142 Y-14.142 Z3.375 E69.14212
+G1 X14.790 Y-12.410 Z3.378 E69.20314
+G1 X15.816 Y-11.074 Z3.381 E69.25872
+G1 X17.321 Y-10.000 Z3.383 E69.31974
+G1 X18.754 Y-8.745 Z3.386 E69.38261
+G1 X19.445 Y-7.077 Z3.389 E69.44218
+G1 X19.319 Y-5.176 Z3.392 E69.50505
+G1 X19.014 Y-3.353 Z3.394 E69.56607
+G1 X19.234 Y-1.683 Z3.397 E69.62165
+G1 X20.000 Y-0.000 Z3.400 E69.68267
+G1 X20.614 Y1.803 Z3.403 E69.74554
+G1 X20.378 Y3.593 Z3.406 E69.80511
+G1 X19.319 Y5.176 Z3.408 E69.86798
+G1 X18.143 Y6.603 Z3.411 E69.92900
+G1 X17.498 Y8.160 Z3.414 E69.98458
+G1 X17.321 Y10.000 Z3.417 E70.04560
+G1 X16.951 Y11.869 Z3.419 E70.10847
+G1 X15.852 Y13.301 Z3.422 E70.16804
+G1 X14.142 Y14.142 Z3.425 E70.23091
+G1 X12.410 Y14.790 Z3.428 E70.29193
+G1 X11.074 Y15.816 Z3.431 E70.34751
+G1 X10.000 Y17.321 Z3.433 E70.40853
+G1 X8.745 Y18.754 Z3.436 E70.47140
+G1 X7.077 Y19.445 Z3.439 E70.53097
+G1 X5.176 Y19.319 Z3.442 E70.59384
+G1 X3.353 Y19.014 Z3.444 E70.65486
+G1 X1.683 Y19.234 Z3.447 E70.71044
+G1 X0.000 Y20.000 Z3.450 E70.77146
+G1 X-1.803 Y20.614 Z3.453 E70.83433
+G1 X-3.593 Y20.378 Z3.456 E70.89390
+G1 X-5.176 Y19.319 Z3.458 E70.95677
+G1 X-6.603 Y18.143 Z3.461 E71.01779
+G1 X-8.160 Y17.498 Z3.464 E71.07337
+G1 X-10.000 Y17.321 Z3.467 E71.13439
+G1 X-11.869 Y16.951 Z3.469 E71.19726
+G1 X-13.301 Y15.852 Z3.472 E71.25683
+G1 X-14.142 Y14.142 Z3.475 E71.31970
+G1 X-14.790 Y12.410 Z3.478 E71.38072
+G1 X-15.816 Y11.074 Z3.481 E71.43630
+G1 X-17.321 Y10.000 Z3.483 E71.49732
+G1 X-18.754 Y8.745 Z3.486 E71.56019
+G1 X-19.445 Y7.077 Z3.489 E71.61976
+G1 X-19.319 Y5.176 Z3.492 E71.68263
+G1 X-19.014 Y3.353 Z3.494 E71.74365
+G1 X-19.234 Y1.683 Z3.497 E71.79923
+G1 X-20.000 Y0.000 Z3.500 E71.86025
+G1 X-20.614 Y-1.803 Z3.503 E71.92312
+G1 X-20.378 Y-3.593 Z3.506 E71.98269
+G1 X-19.319 Y-5.176 Z3.508 E72.04556
+G1 X-18.143 Y-6.603 Z3.511 E72.10658
+G1 X-17.498 Y-8.160 Z3.514 E72.16216
+G1 X-17.321 Y-10.000 Z3.517 E72.22318
+G1 X-16.951 Y-11.869 Z3.519 E72.28605
+G1 X-15.852 Y-13.301 Z3.522 E72.34562
+G1 X-14.142 Y-14.142 Z3.525 E72.40849
+G1 X-12.410 Y-14.790 Z3.528 E72.46951
+G1 X-11.074 Y-15.816 Z3.531 E72.52509
+G1 X-10.000 Y-17.321 Z3.533 E72.58611
+G1 X-8.745 Y-18.754 Z3.536 E72.64898
+G1 X-7.077 Y-19.445 Z3.539 E72.70855
+G1 X-5.176 Y-19.319 Z3.542 E72.77143
+G1 X-3.353 Y-19.014 Z3.544 E72.83244
+G1 X-1.683 Y-19.234 Z3.547 E72.88802
+G1 X-0.000 Y-20.000 Z3.550 E72.94904
+G1 X1.803 Y-20.614 Z3.553 E73.01191
+G1 X3.593 Y-20.378 Z3.556 E73.07148
+G1 X5.176 Y-19.319 Z3.558 E73.13436
+G1 X6.603 Y-18.143 Z3.561 E73.19537
+G1 X8.160 Y-17.498 Z3.564 E73.25096
+G1 X10.000 Y-17.321 Z3.567 E73.31197
+G1 X11.869 Y-16.951 Z3.569 E73.37484
+G1 X13.301 Y-15.852 Z3.572 E73.43442
+G1 X14.142 Y-14.142 Z3.575 E73.49729
+G1 X14.790 Y-12.410 Z3.578 E73.55830
+G1 X15.816 Y-11.074 Z3.581 E73.61389
+G1 X17.321 Y-10.000 Z3.583 E73.67490
+G1 X18.754 Y-8.745 Z3.586 E73.73777
+G1 X19.445 Y-7.077 Z3.589 E73.79735
+G1 X19.319 Y-5.176 Z3.592 E73.86022
+G1 X19.014 Y-3.353 Z3.594 E73.92123
+G1 X19.234 Y-1.683 Z3.597 E73.97682
+G1 X20.000 Y0.000 Z3.600 E74.03783
+G1 X20.614 Y1.803 Z3.603 E74.10070
+G1 X20.378 Y3.593 Z3.606 E74.16028
+G1 X19.319 Y5.176 Z3.608 E74.22315
+G1 X18.143 Y6.603 Z3.611 E74.28416
+G1 X17.498 Y8.160 Z3.614 E74.33975
+G1 X17.321 Y10.000 Z3.617 E74.40076
+G1 X16.951 Y11.869 Z3.619 E74.46363
+G1 X15.852 Y13.301 Z3.622 E74.52321
+G1 X14.142 Y14.142 Z3.625 E74.58608
+G1 X12.410 Y14.790 Z3.628 E74.64709
+G1 X11.074 Y15.816 Z3.631 E74.70268
+G1 X10.000 Y17.321 Z3.633 E74.76369
+G1 X8.745 Y18.754 Z3.636 E74.82657
+G1 X7.077 Y19.445 Z3.639 E74.88614
+G1 X5.176 Y19.319 Z3.642 E74.94901
+G1 X3.353 Y19.014 Z3.644 E75.01003
+G1 X1.683 Y19.234 Z3.647 E75.06561
+G1 X0.000 Y20.000 Z3.650 E75.12663
+G1 X-1.803 Y20.614 Z3.653 E75.18950
+G1 X-3.593 Y20.378 Z3.656 E75.24907
+G1 X-5.176 Y19.319 Z3.658 E75.31194
+G1 X-6.603 Y18.143 Z3.661 E75.37296
+G1 X-8.160 Y17.498 Z3.664 E75.42854
+G1 X-10.000 Y17.321 Z3.667 E75.48956
+G1 X-11.869 Y16.951 Z3.669 E75.55243
+G1 X-13.301 Y15.852 Z3.672 E75.61200
+G1 X-14.142 Y14.142 Z3.675 E75.67487
+G1 X-14.790 Y12.410 Z3.678 E75.73589
+G1 X-15.816 Y11.074 Z3.681 E75.79147
+G1 X-17.321 Y10.000 Z3.683 E75.85249
+G1 X-18.754 Y8.745 Z3.686 E75.91536
+G1 X-19.445 Y7.077 Z3.689 E75.97493
+G1 X-19.319 Y5.176 Z3.692 E76.03780
+G1 X-19.014 Y3.353 Z3.694 E76.09882
+G1 X-19.234 Y1.683 Z3.697 E76.15440
+G1 X-20.000 Y-0.000 Z3.700 E76.21542
+G1 X-20.614 Y-1.803 Z3.703 E76.27829
+G1 X-20.378 Y-3.593 Z3.706 E76.33786
+G1 X-19.319 Y-5.176 Z3.708 E76.40073
+G1 X-18.143 Y-6.603 Z3.711 E76.46175
+G1 X-17.498 Y-8.160 Z3.714 E76.51733
+G1 X-17.321 Y-10.000 Z3.717 E76.57835
+G1 X-16.951 Y-11.869 Z3.719 E76.64122
+G1 X-15.852 Y-13.301 Z3.722 E76.70079
+G1 X-14.142 Y-14.142 Z3.725 E76.76366
+G1 X-12.410 Y-14.790 Z3.728 E76.82468
+G1 X-11.074 Y-15.816 Z3.731 E76.88026
+G1 X-10.000 Y-17.321 Z3.733 E76.94128
+G1 X-8.745 Y-18.754 Z3.736 E77.00415
+G1 X-7.077 Y-19.445 Z3.739 E77.06372
+G1 X-5.176 Y-19.319 Z3.742 E77.12659
+G1 X-3.353 Y-19.014 Z3.744 E77.18761
+G1 X-1.683 Y-19.234 Z3.747 E77.24319
+G1 X-0.000 Y-20.000 Z3.750 E77.30421
+G1 X1.803 Y-20.614 Z3.753 E77.36708
+G1 X3.593 Y-20.378 Z3.756 E77.42665
+G1 X5.176 Y-19.319 Z3.758 E77.48952
+G1 X6.603 Y-18.143 Z3.761 E77.55054
+G1 X8.160 Y-17.498 Z3.764 E77.60612
+G1 X10.000 Y-17.321 Z3.767 E77.66714
+G1 X11.869 Y-16.951 Z3.769 E77.73001
+G1 X13.301 Y-15.852 Z3.772 E77.78958
+G1 X14.142 Y-14.142 Z3.775 E77.85245
+G1 X14.790 Y-12.410 Z3.778 E77.91347
+G1 X15.816 Y-11.074 Z3.781 E77.96905
+G1 X17.321 Y-10.000 Z3.783 E78.03007
+G1 X18.754 Y-8.745 Z3.786 E78.09294
+G1 X19.445 Y-7.077 Z3.789 E78.15251
+G1 X19.319 Y-5.176 Z3.792 E78.21538
+G1 X19.014 Y-3.353 Z3.794 E78.27640
+G1 X19.234 Y-1.683 Z3.797 E78.33198
+G1 X20.000 Y-0.000 Z3.800 E78.39300
+G1 X20.614 Y1.803 Z3.803 E78.45587
+G1 X20.378 Y3.593 Z3.806 E78.51544
+G1 X19.319 Y5.176 Z3.808 E78.57831
+G1 X18.143 Y6.603 Z3.811 E78.63933
+G1 X17.498 Y8.160 Z3.814 E78.69491
+G1 X17.321 Y10.000 Z3.817 E78.75593
+G1 X16.951 Y11.869 Z3.819 E78.81880
+G1 X15.852 Y13.301 Z3.822 E78.87837
+G1 X14.142 Y14.142 Z3.825 E78.94124
+G1 X12.410 Y14.790 Z3.828 E79.00226
+G1 X11.074 Y15.816 Z3.831 E79.05784
+G1 X10.000 Y17.321 Z3.833 E79.11886
+G1 X8.745 Y18.754 Z3.836 E79.18173
+G1 X7.077 Y19.445 Z3.839 E79.24130
+G1 X5.176 Y19.319 Z3.842 E79.30418
+G1 X3.353 Y19.014 Z3.844 E79.36519
+G1 X1.683 Y19.234 Z3.847 E79.42077
+G1 X-0.000 Y20.000 Z3.850 E79.48179
+G1 X-1.803 Y20.614 Z3.853 E79.54466
+G1 X-3.593 Y20.378 Z3.856 E79.60423
+G1 X-5.176 Y19.319 Z3.858 E79.66711
+G1 X-6.603 Y18.143 Z3.861 E79.72812
+G1 X-8.160 Y17.498 Z3.864 E79.78371
+G1 X-10.000 Y17.321 Z3.867 E79.84472
+G1 X-11.869 Y16.951 Z3.869 E79.90759
+G1 X-13.301 Y15.852 Z3.872 E79.96717
+G1 X-14.142 Y14.142 Z3.875 E80.03004
+G1 X-14.790 Y12.410 Z3.878 E80.09105
+G1 X-15.816 Y11.074 Z3.881 E80.14664
+G1 X-17.321 Y10.000 Z3.883 E80.20765
+G1 X-18.754 Y8.745 Z3.886 E80.27052
+G1 X-19.445 Y7.077 Z3.889 E80.33010
+G1 X-19.319 Y5.176 Z3.892 E80.39297
+G1 X-19.014 Y3.353 Z3.894 E80.45398
+G1 X-19.234 Y1.683 Z3.897 E80.50957
+G1 X-20.000 Y0.000 Z3.900 E80.57058
+G1 X-20.614 Y-1.803 Z3.903 E80.63345
+G1 X-20.378 Y-3.593 Z3.906 E80.69303
+G1 X-19.319 Y-5.176 Z3.908 E80.75590
+G1 X-18.143 Y-6.603 Z3.911 E80.81691
+G1 X-17.498 Y-8.160 Z3.914 E80.87250
+G1 X-17.321 Y-10.000 Z3.917 E80.93351
+G1 X-16.951 Y-11.869 Z3.919 E80.99638
+G1 X-15.852 Y-13.301 Z3.922 E81.05596
+G1 X-14.142 Y-14.142 Z3.925 E81.11883
+G1 X-12.410 Y-14.790 Z3.928 E81.17984
+G1 X-11.074 Y-15.816 Z3.931 E81.23543
+G1 X-10.000 Y-17.321 Z3.933 E81.29644
+G1 X-8.745 Y-18.754 Z3.936 E81.35932
+G1 X-7.077 Y-19.445 Z3.939 E81.41889
+G1 X-5.176 Y-19.319 Z3.942 E81.48176
+G1 X-3.353 Y-19.014 Z3.944 E81.54278
+G1 X-1.683 Y-19.234 Z3.947 E81.59836
+G1 X0.000 Y-20.000 Z3.950 E81.65938
+G1 X1.803 Y-20.614 Z3.953 E81.72225
+G1 X3.593 Y-20.378 Z3.956 E81.78182
+G1 X5.176 Y-19.319 Z3.958 E81.84469
+G1 X6.603 Y-18.143 Z3.961 E81.90571
+G1 X8.160 Y-17.498 Z3.964 E81.96129
+G1 X10.000 Y-17.321 Z3.967 E82.02231
+G1 X11.869 Y-16.951 Z3.969 E82.08518
+G1 X13.301 Y-15.852 Z3.972 E82.14475
+G1 X14.142 Y-14.142 Z3.975 E82.20762
+G1 X14.790 Y-12.410 Z3.978 E82.26864
+G1 X15.816 Y-11.074 Z3.981 E82.32422
+G1 X17.321 Y-10.000 Z3.983 E82.38524
+G1 X18.754 Y-8.745 Z3.986 E82.44811
+G1 X19.445 Y-7.077 Z3.989 E82.50768
+G1 X19.319 Y-5.176 Z3.992 E82.57055
+G1 X19.014 Y-3.353 Z3.994 E82.63157
+G1 X19.234 Y-1.683 Z3.997 E82.68715
+G1 X20.000 Y-0.000 Z4.000 E82.74817
+G1 X20.614 Y1.803 Z4.003 E82.81104
+G1 X20.378 Y3.593 Z4.006 E82.87061
+G1 X19.319 Y5.176 Z4.008 E82.93348
+G1 X18.143 Y6.603 Z4.011 E82.99450
+G1 X17.498 Y8.160 Z4.014 E83.05008
+G1 X17.321 Y10.000 Z4.017 E83.11110
+G1 X16.951 Y11.869 Z4.019 E83.17397
+G1 X15.852 Y13.301 Z4.022 E83.23354
+G1 X14.142 Y14.142 Z4.025 E83.29641
+G1 X12.410 Y14.790 Z4.028 E83.35743
+G1 X11.074 Y15.816 Z4.031 E83.41301
+G1 X10.000 Y17.321 Z4.033 E83.47403
+G1 X8.745 Y18.754 Z4.036 E83.53690
+G1 X7.077 Y19.445 Z4.039 E83.59647
+G1 X5.176 Y19.319 Z4.042 E83.65934
+G1 X3.353 Y19.014 Z4.044 E83.72036
+G1 X1.683 Y19.234 Z4.047 E83.77594
+G1 X0.000 Y20.000 Z4.050 E83.83696
+G1 X-1.803 Y20.614 Z4.053 E83.89983
+G1 X-3.593 Y20.378 Z4.056 E83.95940
+G1 X-5.176 Y19.319 Z4.058 E84.02227
+G1 X-6.603 Y18.143 Z4.061 E84.08329
+G1 X-8.160 Y17.498 Z4.064 E84.13887
+G1 X-10.000 Y17.321 Z4.067 E84.19989
+G1 X-11.869 Y16.951 Z4.069 E84.26276
+G1 X-13.301 Y15.852 Z4.072 E84.32233
+G1 X-14.142 Y14.142 Z4.075 E84.38520
+G1 X-14.790 Y12.410 Z4.078 E84.44622
+G1 X-15.816 Y11.074 Z4.081 E84.50180
+G1 X-17.321 Y10.000 Z4.083 E84.56282
+G1 X-18.754 Y8.745 Z4.086 E84.62569
+G1 X-19.445 Y7.077 Z4.089 E84.68526
+G1 X-19.319 Y5.176 Z4.092 E84.74813
+G1 X-19.014 Y3.353 Z4.094 E84.80915
+G1 X-19.234 Y1.683 Z4.097 E84.86473
+G1 X-20.000 Y0.000 Z4.100 E84.92575
+G1 X-20.614 Y-1.803 Z4.103 E84.98862
+G1 X-20.378 Y-3.593 Z4.106 E85.04819
+G1 X-19.319 Y-5.176 Z4.108 E85.11106
+G1 X-18.143 Y-6.603 Z4.111 E85.17208
+G1 X-17.498 Y-8.160 Z4.114 E85.22766
+G1 X-17.321 Y-10.000 Z4.117 E85.28868
+G1 X-16.951 Y-11.869 Z4.119 E85.35155
+G1 X-15.852 Y-13.301 Z4.122 E85.41112
+G1 X-14.142 Y-14.142 Z4.125 E85.47399
+G1 X-12.410 Y-14.790 Z4.128 E85.53501
+G1 X-11.074 Y-15.816 Z4.131 E85.59059
+G1 X-10.000 Y-17.321 Z4.133 E85.65161
+G1 X-8.745 Y-18.754 Z4.136 E85.71448
+G1 X-7.077 Y-19.445 Z4.139 E85.77405
+G1 X-5.176 Y-19.319 Z4.142 E85.83693
+G1 X-3.353 Y-19.014 Z4.144 E85.89794
+G1 X-1.683 Y-19.234 Z4.147 E85.95352
+G1 X-0.000 Y-20.000 Z4.150 E86.01454
+G1 X1.803 Y-20.614 Z4.153 E86.07741
+G1 X3.593 Y-20.378 Z4.156 E86.13698
+G1 X5.176 Y-19.319 Z4.158 E86.19986
+G1 X6.603 Y-18.143 Z4.161 E86.26087
+G1 X8.160 Y-17.498 Z4.164 E86.31646
+G1 X10.000 Y-17.321 Z4.167 E86.37747
+G1 X11.869 Y-16.951 Z4.169 E86.44034
+G1 X13.301 Y-15.852 Z4.172 E86.49992
+G1 X14.142 Y-14.142 Z4.175 E86.56279
+G1 X14.790 Y-12.410 Z4.178 E86.62380
+G1 X15.816 Y-11.074 Z4.181 E86.67939
+G1 X17.321 Y-10.000 Z4.183 E86.74040
+G1 X18.754 Y-8.745 Z4.186 E86.80327
+G1 X19.445 Y-7.077 Z4.189 E86.86285
+G1 X19.319 Y-5.176 Z4.192 E86.92572
+G1 X19.014 Y-3.353 Z4.194 E86.98673
+G1 X19.234 Y-1.683 Z4.197 E87.04232
+G1 X20.000 Y-0.000 Z4.200 E87.10333
+G1 X20.614 Y1.803 Z4.203 E87.16620
+G1 X20.378 Y3.593 Z4.206 E87.22578
+G1 X19.319 Y5.176 Z4.208 E87.28865
+G1 X18.143 Y6.603 Z4.211 E87.34966
+G1 X17.498 Y8.160 Z4.214 E87.40525
+G1 X17.321 Y10.000 Z4.217 E87.46626
+G1 X16.951 Y11.869 Z4.219 E87.52913
+G1 X15.852 Y13.301 Z4.222 E87.58871
+G1 X14.142 Y14.142 Z4.225 E87.65158
+G1 X12.410 Y14.790 Z4.228 E87.71259
+G1 X11.074 Y15.816 Z4.231 E87.76818
+G1 X10.000 Y17.321 Z4.233 E87.82919
+G1 X8.745 Y18.754 Z4.236 E87.89207
+G1 X7.077 Y19.445 Z4.239 E87.95164
+G1 X5.176 Y19.319 Z4.242 E88.01451
+G1 X3.353 Y19.014 Z4.244 E88.07553
+G1 X1.683 Y19.234 Z4.247 E88.13111
+G1 X0.000 Y20.000 Z4.250 E88.19213
+G1 X-1.803 Y20.614 Z4.253 E88.25500
+G1 X-3.593 Y20.378 Z4.256 E88.31457
+G1 X-5.176 Y19.319 Z4.258 E88.37744
+G1 X-6.603 Y18.143 Z4.261 E88.43846
+G1 X-8.160 Y17.498 Z4.264 E88.49404
+G1 X-10.000 Y17.321 Z4.267 E88.55506
+G1 X-11.869 Y16.951 Z4.269 E88.61793
+G1 X-13.301 Y15.852 Z4.272 E88.67750
+G1 X-14.142 Y14.142 Z4.275 E88.74037
+G1 X-14.790 Y12.410 Z4.278 E88.80139
+G1 X-15.816 Y11.074 Z4.281 E88.85697
+G1 X-17.321 Y10.000 Z4.283 E88.91799
+G1 X-18.754 Y8.745 Z4.286 E88.98086
+G1 X-19.445 Y7.077 Z4.289 E89.04043
+G1 X-19.319 Y5.176 Z4.292 E89.10330
+G1 X-19.014 Y3.353 Z4.294 E89.16432
+G1 X-19.234 Y1.683 Z4.297 E89.21990
+G1 X-20.000 Y-0.000 Z4.300 E89.28092
+G1 X-20.614 Y-1.803 Z4.303 E89.34379
+G1 X-20.378 Y-3.593 Z4.306 E89.40336
+G1 X-19.319 Y-5.176 Z4.308 E89.46623
+G1 X-18.143 Y-6.603 Z4.311 E89.52725
+G1 X-17.498 Y-8.160 Z4.314 E89.58283
+G1 X-17.321 Y-10.000 Z4.317 E89.64385
+G1 X-16.951 Y-11.869 Z4.319 E89.70672
+G1 X-15.852 Y-13.301 Z4.322 E89.76629
+G1 X-14.142 Y-14.142 Z4.325 E89.82916
+G1 X-12.410 Y-14.790 Z4.328 E89.89018
+G1 X-11.074 Y-15.816 Z4.331 E89.94576
+G1 X-10.000 Y-17.321 Z4.333 E90.00678
+G1 X-8.745 Y-18.754 Z4.336 E90.06965
+G1 X-7.077 Y-19.445 Z4.339 E90.12922
+G1 X-5.176 Y-19.319 Z4.342 E90.19209
+G1 X-3.353 Y-19.014 Z4.344 E90.25311
+G1 X-1.683 Y-19.234 Z4.347 E90.30869
+G1 X-0.000 Y-20.000 Z4.350 E90.36971
+G1 X1.803 Y-20.614 Z4.353 E90.43258
+G1 X3.593 Y-20.378 Z4.356 E90.49215
+G1 X5.176 Y-19.319 Z4.358 E90.55502
+G1 X6.603 Y-18.143 Z4.361 E90.61604
+G1 X8.160 Y-17.498 Z4.364 E90.67162
+G1 X10.000 Y-17.321 Z4.367 E90.73264
+G1 X11.869 Y-16.951 Z4.369 E90.79551
+G1 X13.301 Y-15.852 Z4.372 E90.85508
+G1 X14.142 Y-14.142 Z4.375 E90.91795
+G1 X14.790 Y-12.410 Z4.378 E90.97897
+G1 X15.816 Y-11.074 Z4.381 E91.03455
+G1 X17.321 Y-10.000 Z4.383 E91.09557
+G1 X18.754 Y-8.745 Z4.386 E91.15844
+G1 X19.445 Y-7.077 Z4.389 E91.21801
+G1 X19.319 Y-5.176 Z4.392 E91.28088
+G1 X19.014 Y-3.353 Z4.394 E91.34190
+G1 X19.234 Y-1.683 Z4.397 E91.39748
+G1 X20.000 Y0.000 Z4.400 E91.45850
+G1 X20.614 Y1.803 Z4.403 E91.52137
+G1 X20.378 Y3.593 Z4.406 E91.58094
+G1 X19.319 Y5.176 Z4.408 E91.64381
+G1 X18.143 Y6.603 Z4.411 E91.70483
+G1 X17.498 Y8.160 Z4.414 E91.76041
+G1 X17.321 Y10.000 Z4.417 E91.82143
+G1 X16.951 Y11.869 Z4.419 E91.88430
+G1 X15.852 Y13.301 Z4.422 E91.94387
+G1 X14.142 Y14.142 Z4.425 E92.00674
+G1 X12.410 Y14.790 Z4.428 E92.06776
+G1 X11.074 Y15.816 Z4.431 E92.12334
+G1 X10.000 Y17.321 Z4.433 E92.18436
+G1 X8.745 Y18.754 Z4.436 E92.24723
+G1 X7.077 Y19.445 Z4.439 E92.30680
+G1 X5.176 Y19.319 Z4.442 E92.36968
+G1 X3.353 Y19.014 Z4.444 E92.43069
+G1 X1.683 Y19.234 Z4.447 E92.48627
+G1 X0.000 Y20.000 Z4.450 E92.54729
+G1 X-1.803 Y20.614 Z4.453 E92.61016
+G1 X-3.593 Y20.378 Z4.456 E92.66973
+G1 X-5.176 Y19.319 Z4.458 E92.73261
+G1 X-6.603 Y18.143 Z4.461 E92.79362
+G1 X-8.160 Y17.498 Z4.464 E92.84921
+G1 X-10.000 Y17.321 Z4.467 E92.91022
+G1 X-11.869 Y16.951 Z4.469 E92.97309
+G1 X-13.301 Y15.852 Z4.472 E93.03267
+G1 X-14.142 Y14.142 Z4.475 E93.09554
+G1 X-14.790 Y12.410 Z4.478 E93.15655
+G1 X-15.816 Y11.074 Z4.481 E93.21214
+G1 X-17.321 Y10.000 Z4.483 E93.27315
+G1 X-18.754 Y8.745 Z4.486 E93.33602
+G1 X-19.445 Y7.077 Z4.489 E93.39560
+G1 X-19.319 Y5.176 Z4.492 E93.45847
+G1 X-19.014 Y3.353 Z4.494 E93.51948
+G1 X-19.234 Y1.683 Z4.497 E93.57507
+G1 X-20.000 Y0.000 Z4.500 E93.63608
+G1 X-20.614 Y-1.803 Z4.503 E93.69895
+G1 X-20.378 Y-3.593 Z4.506 E93.75853
+G1 X-19.319 Y-5.176 Z4.508 E93.82140
+G1 X-18.143 Y-6.603 Z4.511 E93.88241
+G1 X-17.498 Y-8.160 Z4.514 E93.93800
+G1 X-17.321 Y-10.000 Z4.517 E93.99901
+G1 X-16.951 Y-11.869 Z4.519 E94.06188
+G1 X-15.852 Y-13.301 Z4.522 E94.12146
+G1 X-14.142 Y-14.142 Z4.525 E94.18433
+G1 X-12.410 Y-14.790 Z4.528 E94.24534
+G1 X-11.074 Y-15.816 Z4.531 E94.30093
+G1 X-10.000 Y-17.321 Z4.533 E94.36194
+G1 X-8.745 Y-18.754 Z4.536 E94.42482
+G1 X-7.077 Y-19.445 Z4.539 E94.48439
+G1 X-5.176 Y-19.319 Z4.542 E94.54726
+G1 X-3.353 Y-19.014 Z4.544 E94.60828
+G1 X-1.683 Y-19.234 Z4.547 E94.66386
+G1 X-0.000 Y-20.000 Z4.550 E94.72488
+G1 X1.803 Y-20.614 Z4.553 E94.78775
+G1 X3.593 Y-20.378 Z4.556 E94.84732
+G1 X5.176 Y-19.319 Z4.558 E94.91019
+G1 X6.603 Y-18.143 Z4.561 E94.97121
+G1 X8.160 Y-17.498 Z4.564 E95.02679
+G1 X10.000 Y-17.321 Z4.567 E95.08781
+G1 X11.869 Y-16.951 Z4.569 E95.15068
+G1 X13.301 Y-15.852 Z4.572 E95.21025
+G1 X14.142 Y-14.142 Z4.575 E95.27312
+G1 X14.790 Y-12.410 Z4.578 E95.33414
+G1 X15.816 Y-11.074 Z4.581 E95.38972
+G1 X17.321 Y-10.000 Z4.583 E95.45074
+G1 X18.754 Y-8.745 Z4.586 E95.51361
+G1 X19.445 Y-7.077 Z4.589 E95.57318
+G1 X19.319 Y-5.176 Z4.592 E95.63605
+G1 X19.014 Y-3.353 Z4.594 E95.69707
+G1 X19.234 Y-1.683 Z4.597 E95.75265
+G1 X20.000 Y0.000 Z4.600 E95.81367
+G1 X20.614 Y1.803 Z4.603 E95.87654
+G1 X20.378 Y3.593 Z4.606 E95.93611
+G1 X19.319 Y5.176 Z4.608 E95.99898
+G1 X18.143 Y6.603 Z4.611 E96.06000
+G1 X17.498 Y8.160 Z4.614 E96.11558
+G1 X17.321 Y10.000 Z4.617 E96.17660
+G1 X16.951 Y11.869 Z4.619 E96.23947
+G1 X15.852 Y13.301 Z4.622 E96.29904
+G1 X14.142 Y14.142 Z4.625 E96.36191
+G1 X12.410 Y14.790 Z4.628 E96.42293
+G1 X11.074 Y15.816 Z4.631 E96.47851
+G1 X10.000 Y17.321 Z4.633 E96.53953
+G1 X8.745 Y18.754 Z4.636 E96.60240
+G1 X7.077 Y19.445 Z4.639 E96.66197
+G1 X5.176 Y19.319 Z4.642 E96.72484
+G1 X3.353 Y19.014 Z4.644 E96.78586
+G1 X1.683 Y19.234 Z4.647 E96.84144
+G1 X-0.000 Y20.000 Z4.650 E96.90246
+G1 X-1.803 Y20.614 Z4.653 E96.96533
+G1 X-3.593 Y20.378 Z4.656 E97.02490
+G1 X-5.176 Y19.319 Z4.658 E97.08777
+G1 X-6.603 Y18.143 Z4.661 E97.14879
+G1 X-8.160 Y17.498 Z4.664 E97.20437
+G1 X-10.000 Y17.321 Z4.667 E97.26539
+G1 X-11.869 Y16.951 Z4.669 E97.32826
+G1 X-13.301 Y15.852 Z4.672 E97.38783
+G1 X-14.142 Y14.142 Z4.675 E97.45070
+G1 X-14.790 Y12.410 Z4.678 E97.51172
+G1 X-15.816 Y11.074 Z4.681 E97.56730
+G1 X-17.321 Y10.000 Z4.683 E97.62832
+G1 X-18.754 Y8.745 Z4.686 E97.69119
+G1 X-19.445 Y7.077 Z4.689 E97.75076
+G1 X-19.319 Y5.176 Z4.692 E97.81363
+G1 X-19.014 Y3.353 Z4.694 E97.87465
+G1 X-19.234 Y1.683 Z4.697 E97.93023
+G1 X-20.000 Y0.000 Z4.700 E97.99125
+G1 X-20.614 Y-1.803 Z4.703 E98.05412
+G1 X-20.378 Y-3.593 Z4.706 E98.11369
+G1 X-19.319 Y-5.176 Z4.708 E98.17656
+G1 X-18.143 Y-6.603 Z4.711 E98.23758
+G1 X-17.498 Y-8.160 Z4.714 E98.29316
+G1 X-17.321 Y-10.000 Z4.717 E98.35418
+G1 X-16.951 Y-11.869 Z4.719 E98.41705
+G1 X-15.852 Y-13.301 Z4.722 E98.47662
+G1 X-14.142 Y-14.142 Z4.725 E98.53949
+G1 X-12.410 Y-14.790 Z4.728 E98.60051
+G1 X-11.074 Y-15.816 Z4.731 E98.65609
+G1 X-10.000 Y-17.321 Z4.733 E98.71711
+G1 X-8.745 Y-18.754 Z4.736 E98.77998
+G1 X-7.077 Y-19.445 Z4.739 E98.83955
+G1 X-5.176 Y-19.319 Z4.742 E98.90243
+G1 X-3.353 Y-19.014 Z4.744 E98.96344
+G1 X-1.683 Y-19.234 Z4.747 E99.01902
+G1 X-0.000 Y-20.000 Z4.750 E99.08004
+G1 X1.803 Y-20.614 Z4.753 E99.14291
+G1 X3.593 Y-20.378 Z4.756 E99.20248
+G1 X5.176 Y-19.319 Z4.758 E99.26536
+G1 X6.603 Y-18.143 Z4.761 E99.32637
+G1 X8.160 Y-17.498 Z4.764 E99.38196
+G1 X10.000 Y-17.321 Z4.767 E99.44297
+G1 X11.869 Y-16.951 Z4.769 E99.50584
+G1 X13.301 Y-15.852 Z4.772 E99.56542
+G1 X14.142 Y-14.142 Z4.775 E99.62829
+G1 X14.790 Y-12.410 Z4.778 E99.68930
+G1 X15.816 Y-11.074 Z4.781 E99.74489
+G1 X17.321 Y-10.000 Z4.783 E99.80590
+G1 X18.754 Y-8.745 Z4.786 E99.86877
+G1 X19.445 Y-7.077 Z4.789 E99.92835
+G1 X19.319 Y-5.176 Z4.792 E99.99122
+G1 X19.014 Y-3.353 Z4.794 E100.05223
+G1 X19.234 Y-1.683 Z4.797 E100.10782
+G1 X20.000 Y-0.000 Z4.800 E100.16883
+G1 X20.614 Y1.803 Z4.803 E100.23170
+G1 X20.378 Y3.593 Z4.806 E100.29128
+G1 X19.319 Y5.176 Z4.808 E100.35415
+G1 X18.143 Y6.603 Z4.811 E100.41516
+G1 X17.498 Y8.160 Z4.814 E100.47075
+G1 X17.321 Y10.000 Z4.817 E100.53176
+G1 X16.951 Y11.869 Z4.819 E100.59463
+G1 X15.852 Y13.301 Z4.822 E100.65421
+G1 X14.142 Y14.142 Z4.825 E100.71708
+G1 X12.410 Y14.790 Z4.828 E100.77809
+G1 X11.074 Y15.816 Z4.831 E100.83368
+G1 X10.000 Y17.321 Z4.833 E100.89469
+G1 X8.745 Y18.754 Z4.836 E100.95757
+G1 X7.077 Y19.445 Z4.839 E101.01714
+G1 X5.176 Y19.319 Z4.842 E101.08001
+G1 X3.353 Y19.014 Z4.844 E101.14103
+G1 X1.683 Y19.234 Z4.847 E101.19661
+G1 X-0.000 Y20.000 Z4.850 E101.25763
+G1 X-1.803 Y20.614 Z4.853 E101.32050
+G1 X-3.593 Y20.378 Z4.856 E101.38007
+G1 X-5.176 Y19.319 Z4.858 E101.44294
+G1 X-6.603 Y18.143 Z4.861 E101.50396
+G1 X-8.160 Y17.498 Z4.864 E101.55954
+G1 X-10.000 Y17.321 Z4.867 E101.62056
+G1 X-11.869 Y16.951 Z4.869 E101.68343
+G1 X-13.301 Y15.852 Z4.872 E101.74300
+G1 X-14.142 Y14.142 Z4.875 E101.80587
+G1 X-14.790 Y12.410 Z4.878 E101.86689
+G1 X-15.816 Y11.074 Z4.881 E101.92247
+G1 X-17.321 Y10.000 Z4.883 E101.98349
+G1 X-18.754 Y8.745 Z4.886 E102.04636
+G1 X-19.445 Y7.077 Z4.889 E102.10593
+G1 X-19.319 Y5.176 Z4.892 E102.16880
+G1 X-19.014 Y3.353 Z4.894 E102.22982
+G1 X-19.234 Y1.683 Z4.897 E102.28540
+G1 X-20.000 Y0.000 Z4.900 E102.34642
+G1 X-20.614 Y-1.803 Z4.903 E102.40929
+G1 X-20.378 Y-3.593 Z4.906 E102.46886
+G1 X-19.319 Y-5.176 Z4.908 E102.53173
+G1 X-18.143 Y-6.603 Z4.911 E102.59275
+G1 X-17.498 Y-8.160 Z4.914 E102.64833
+G1 X-17.321 Y-10.000 Z4.917 E102.70935
+G1 X-16.951 Y-11.869 Z4.919 E102.77222
+G1 X-15.852 Y-13.301 Z4.922 E102.83179
+G1 X-14.142 Y-14.142 Z4.925 E102.89466
+G1 X-12.410 Y-14.790 Z4.928 E102.95568
+G1 X-11.074 Y-15.816 Z4.931 E103.01126
+G1 X-10.000 Y-17.321 Z4.933 E103.07228
+G1 X-8.745 Y-18.754 Z4.936 E103.13515
+G1 X-7.077 Y-19.445 Z4.939 E103.19472
+G1 X-5.176 Y-19.319 Z4.942 E103.25759
+G1 X-3.353 Y-19.014 Z4.944 E103.31861
+G1 X-1.683 Y-19.234 Z4.947 E103.37419
+G1 X-0.000 Y-20.000 Z4.950 E103.43521
+G1 X1.803 Y-20.614 Z4.953 E103.49808
+G1 X3.593 Y-20.378 Z4.956 E103.55765
+G1 X5.176 Y-19.319 Z4.958 E103.62052
+G1 X6.603 Y-18.143 Z4.961 E103.68154
+G1 X8.160 Y-17.498 Z4.964 E103.73712
+G1 X10.000 Y-17.321 Z4.967 E103.79814
+G1 X11.869 Y-16.951 Z4.969 E103.86101
+G1 X13.301 Y-15.852 Z4.972 E103.92058
+G1 X14.142 Y-14.142 Z4.975 E103.98345
+G1 X14.790 Y-12.410 Z4.978 E104.04447
+G1 X15.816 Y-11.074 Z4.981 E104.10005
+G1 X17.321 Y-10.000 Z4.983 E104.16107
+G1 X18.754 Y-8.745 Z4.986 E104.22394
+G1 X19.445 Y-7.077 Z4.989 E104.28351
+G1 X19.319 Y-5.176 Z4.992 E104.34638
+G1 X19.014 Y-3.353 Z4.994 E104.40740
+G1 X19.234 Y-1.683 Z4.997 E104.46298
+G1 X20.000 Y-0.000 Z5.000 E104.52400
+G1 X20.614 Y1.803 Z5.003 E104.58687
+G1 X20.378 Y3.593 Z5.006 E104.64644
+G1 X19.319 Y5.176 Z5.008 E104.70931
+G1 X18.143 Y6.603 Z5.011 E104.77033
+G1 X17.498 Y8.160 Z5.014 E104.82591
+G1 X17.321 Y10.000 Z5.017 E104.88693
+G1 X16.951 Y11.869 Z5.019 E104.94980
+G1 X15.852 Y13.301 Z5.022 E105.00937
+G1 X14.142 Y14.142 Z5.025 E105.07224
+G1 X12.410 Y14.790 Z5.028 E105.13326
+G1 X11.074 Y15.816 Z5.031 E105.18884
+G1 X10.000 Y17.321 Z5.033 E105.24986
+G1 X8.745 Y18.754 Z5.036 E105.31273
+G1 X7.077 Y19.445 Z5.039 E105.37230
+G1 X5.176 Y19.319 Z5.042 E105.43518
+G1 X3.353 Y19.014 Z5.044 E105.49619
+G1 X1.683 Y19.234 Z5.047 E105.55177
+G1 X0.000 Y20.000 Z5.050 E105.61279
+G1 X-1.803 Y20.614 Z5.053 E105.67566
+G1 X-3.593 Y20.378 Z5.056 E105.73523
+G1 X-5.176 Y19.319 Z5.058 E105.79811
+G1 X-6.603 Y18.143 Z5.061 E105.85912
+G1 X-8.160 Y17.498 Z5.064 E105.91471
+G1 X-10.000 Y17.321 Z5.067 E105.97572
+G1 X-11.869 Y16.951 Z5.069 E106.03859
+G1 X-13.301 Y15.852 Z5.072 E106.09817
+G1 X-14.142 Y14.142 Z5.075 E106.16104
+G1 X-14.790 Y12.410 Z5.078 E106.22205
+G1 X-15.816 Y11.074 Z5.081 E106.27764
+G1 X-17.321 Y10.000 Z5.083 E106.33865
+G1 X-18.754 Y8.745 Z5.086 E106.40152
+G1 X-19.445 Y7.077 Z5.089 E106.46110
+G1 X-19.319 Y5.176 Z5.092 E106.52397
+G1 X-19.014 Y3.353 Z5.094 E106.58498
+G1 X-19.234 Y1.683 Z5.097 E106.64057
+G1 X-20.000 Y0.000 Z5.100 E106.70158
+G1 X-20.614 Y-1.803 Z5.103 E106.76445
+G1 X-20.378 Y-3.593 Z5.106 E106.82403
+G1 X-19.319 Y-5.176 Z5.108 E106.88690
+G1 X-18.143 Y-6.603 Z5.111 E106.94791
+G1 X-17.498 Y-8.160 Z5.114 E107.00350
+G1 X-17.321 Y-10.000 Z5.117 E107.06451
+G1 X-16.951 Y-11.869 Z5.119 E107.12738
+G1 X-15.852 Y-13.301 Z5.122 E107.18696
+G1 X-14.142 Y-14.142 Z5.125 E107.24983
+G1 X-12.410 Y-14.790 Z5.128 E107.31084
+G1 X-11.074 Y-15.816 Z5.131 E107.36643
+G1 X-10.000 Y-17.321 Z5.133 E107.42744
+G1 X-8.745 Y-18.754 Z5.136 E107.49032
+G1 X-7.077 Y-19.445 Z5.139 E107.54989
+G1 X-5.176 Y-19.319 Z5.142 E107.61276
+G1 X-3.353 Y-19.014 Z5.144 E107.67378
+G1 X-1.683 Y-19.234 Z5.147 E107.72936
+G1 X0.000 Y-20.000 Z5.150 E107.79038
+G1 X1.803 Y-20.614 Z5.153 E107.85325
+G1 X3.593 Y-20.378 Z5.156 E107.91282
+G1 X5.176 Y-19.319 Z5.158 E107.97569
+G1 X6.603 Y-18.143 Z5.161 E108.03671
+G1 X8.160 Y-17.498 Z5.164 E108.09229
+G1 X10.000 Y-17.321 Z5.167 E108.15331
+G1 X11.869 Y-16.951 Z5.169 E108.21618
+G1 X13.301 Y-15.852 Z5.172 E108.27575
+G1 X14.142 Y-14.142 Z5.175 E108.33862
+G1 X14.790 Y-12.410 Z5.178 E108.39964
+G1 X15.816 Y-11.074 Z5.181 E108.45522
+G1 X17.321 Y-10.000 Z5.183 E108.51624
+G1 X18.754 Y-8.745 Z5.186 E108.57911
+G1 X19.445 Y-7.077 Z5.189 E108.63868
+G1 X19.319 Y-5.176 Z5.192 E108.70155
+G1 X19.014 Y-3.353 Z5.194 E108.76257
+G1 X19.234 Y-1.683 Z5.197 E108.81815
+G1 X20.000 Y0.000 Z5.200 E108.87917
+G1 X20.614 Y1.803 Z5.203 E108.94204
+G1 X20.378 Y3.593 Z5.206 E109.00161
+G1 X19.319 Y5.176 Z5.208 E109.06448
+G1 X18.143 Y6.603 Z5.211 E109.12550
+G1 X17.498 Y8.160 Z5.214 E109.18108
+G1 X17.321 Y10.000 Z5.217 E109.24210
+G1 X16.951 Y11.869 Z5.219 E109.30497
+G1 X15.852 Y13.301 Z5.222 E109.36454
+G1 X14.142 Y14.142 Z5.225 E109.42741
+G1 X12.410 Y14.790 Z5.228 E109.48843
+G1 X11.074 Y15.816 Z5.231 E109.54401
+G1 X10.000 Y17.321 Z5.233 E109.60503
+G1 X8.745 Y18.754 Z5.236 E109.66790
+G1 X7.077 Y19.445 Z5.239 E109.72747
+G1 X5.176 Y19.319 Z5.242 E109.79034
+G1 X3.353 Y19.014 Z5.244 E109.85136
+G1 X1.683 Y19.234 Z5.247 E109.90694
+G1 X0.000 Y20.000 Z5.250 E109.96796
+G1 X-1.803 Y20.614 Z5.253 E110.03083
+G1 X-3.593 Y20.378 Z5.256 E110.09040
+G1 X-5.176 Y19.319 Z5.258 E110.15327
+G1 X-6.603 Y18.143 Z5.261 E110.21429
+G1 X-8.160 Y17.498 Z5.264 E110.26987
+G1 X-10.000 Y17.321 Z5.267 E110.33089
+G1 X-11.869 Y16.951 Z5.269 E110.39376
+G1 X-13.301 Y15.852 Z5.272 E110.45333
+G1 X-14.142 Y14.142 Z5.275 E110.51620
+G1 X-14.790 Y12.410 Z5.278 E110.57722
+G1 X-15.816 Y11.074 Z5.281 E110.63280
+G1 X-17.321 Y10.000 Z5.283 E110.69382
+G1 X-18.754 Y8.745 Z5.286 E110.75669
+G1 X-19.445 Y7.077 Z5.289 E110.81626
+G1 X-19.319 Y5.176 Z5.292 E110.87913
+G1 X-19.014 Y3.353 Z5.294 E110.94015
+G1 X-19.234 Y1.683 Z5.297 E110.99573
+G1 X-20.000 Y0.000 Z5.300 E111.05675
+G1 X-20.614 Y-1.803 Z5.303 E111.11962
+G1 X-20.378 Y-3.593 Z5.306 E111.17919
+G1 X-19.319 Y-5.176 Z5.308 E111.24206
+G1 X-18.143 Y-6.603 Z5.311 E111.30308
+G1 X-17.498 Y-8.160 Z5.314 E111.35866
+G1 X-17.321 Y-10.000 Z5.317 E111.41968
+G1 X-16.951 Y-11.869 Z5.319 E111.48255
+G1 X-15.852 Y-13.301 Z5.322 E111.54212
+G1 X-14.142 Y-14.142 Z5.325 E111.60499
+G1 X-12.410 Y-14.790 Z5.328 E111.66601
+G1 X-11.074 Y-15.816 Z5.331 E111.72159
+G1 X-10.000 Y-17.321 Z5.333 E111.78261
+G1 X-8.745 Y-18.754 Z5.336 E111.84548
+G1 X-7.077 Y-19.445 Z5.339 E111.90505
+G1 X-5.176 Y-19.319 Z5.342 E111.96793
+G1 X-3.353 Y-19.014 Z5.344 E112.02894
+G1 X-1.683 Y-19.234 Z5.347 E112.08453
+G1 X-0.000 Y-20.000 Z5.350 E112.14554
+G1 X1.803 Y-20.614 Z5.353 E112.20841
+G1 X3.593 Y-20.378 Z5.356 E112.26798
+G1 X5.176 Y-19.319 Z5.358 E112.33086
+G1 X6.603 Y-18.143 Z5.361 E112.39187
+G1 X8.160 Y-17.498 Z5.364 E112.44746
+G1 X10.000 Y-17.321 Z5.367 E112.50847
+G1 X11.869 Y-16.951 Z5.369 E112.57134
+G1 X13.301 Y-15.852 Z5.372 E112.63092
+G1 X14.142 Y-14.142 Z5.375 E112.69379
+G1 X14.790 Y-12.410 Z5.378 E112.75480
+G1 X15.816 Y-11.074 Z5.381 E112.81039
+G1 X17.321 Y-10.000 Z5.383 E112.87140
+G1 X18.754 Y-8.745 Z5.386 E112.93427
+G1 X19.445 Y-7.077 Z5.389 E112.99385
+G1 X19.319 Y-5.176 Z5.392 E113.05672
+G1 X19.014 Y-3.353 Z5.394 E113.11773
+G1 X19.234 Y-1.683 Z5.397 E113.17332
+G1 X20.000 Y0.000 Z5.400 E113.23433
+G1 X20.614 Y1.803 Z5.403 E113.29720
+G1 X20.378 Y3.593 Z5.406 E113.35678
+G1 X19.319 Y5.176 Z5.408 E113.41965
+G1 X18.143 Y6.603 Z5.411 E113.48066
+G1 X17.498 Y8.160 Z5.414 E113.53625
+G1 X17.321 Y10.000 Z5.417 E113.59726
+G1 X16.951 Y11.869 Z5.419 E113.66013
+G1 X15.852 Y13.301 Z5.422 E113.71971
+G1 X14.142 Y14.142 Z5.425 E113.78258
+G1 X12.410 Y14.790 Z5.428 E113.84359
+G1 X11.074 Y15.816 Z5.431 E113.89918
+G1 X10.000 Y17.321 Z5.433 E113.96019
+G1 X8.745 Y18.754 Z5.436 E114.02307
+G1 X7.077 Y19.445 Z5.439 E114.08264
+G1 X5.176 Y19.319 Z5.442 E114.14551
+G1 X3.353 Y19.014 Z5.444 E114.20653
+G1 X1.683 Y19.234 Z5.447 E114.26211
+G1 X0.000 Y20.000 Z5.450 E114.32313
+G1 X-1.803 Y20.614 Z5.453 E114.38600
+G1 X-3.593 Y20.378 Z5.456 E114.44557
+G1 X-5.176 Y19.319 Z5.458 E114.50844
+G1 X-6.603 Y18.143 Z5.461 E114.56946
+G1 X-8.160 Y17.498 Z5.464 E114.62504
+G1 X-10.000 Y17.321 Z5.467 E114.68606
+G1 X-11.869 Y16.951 Z5.469 E114.74893
+G1 X-13.301 Y15.852 Z5.472 E114.80850
+G1 X-14.142 Y14.142 Z5.475 E114.87137
+G1 X-14.790 Y12.410 Z5.478 E114.93239
+G1 X-15.816 Y11.074 Z5.481 E114.98797
+G1 X-17.321 Y10.000 Z5.483 E115.04899
+G1 X-18.754 Y8.745 Z5.486 E115.11186
+G1 X-19.445 Y7.077 Z5.489 E115.17143
+G1 X-19.319 Y5.176 Z5.492 E115.23430
+G1 X-19.014 Y3.353 Z5.494 E115.29532
+G1 X-19.234 Y1.683 Z5.497 E115.35090
+G1 X-20.000 Y0.000 Z5.500 E115.41192
+G1 X-20.614 Y-1.803 Z5.503 E115.47479
+G1 X-20.378 Y-3.593 Z5.506 E115.53436
+G1 X-19.319 Y-5.176 Z5.508 E115.59723
+G1 X-18.143 Y-6.603 Z5.511 E115.65825
+G1 X-17.498 Y-8.160 Z5.514 E115.71383
+G1 X-17.321 Y-10.000 Z5.517 E115.77485
+G1 X-16.951 Y-11.869 Z5.519 E115.83772
+G1 X-15.852 Y-13.301 Z5.522 E115.89729
+G1 X-14.142 Y-14.142 Z5.525 E115.96016
+G1 X-12.410 Y-14.790 Z5.528 E116.02118
+G1 X-11.074 Y-15.816 Z5.531 E116.07676
+G1 X-10.000 Y-17.321 Z5.533 E116.13778
+G1 X-8.745 Y-18.754 Z5.536 E116.20065
+G1 X-7.077 Y-19.445 Z5.539 E116.26022
+G1 X-5.176 Y-19.319 Z5.542 E116.32309
+G1 X-3.353 Y-19.014 Z5.544 E116.38411
+G1 X-1.683 Y-19.234 Z5.547 E116.43969
+G1 X-0.000 Y-20.000 Z5.550 E116.50071
+G1 X1.803 Y-20.614 Z5.553 E116.56358
+G1 X3.593 Y-20.378 Z5.556 E116.62315
+G1 X5.176 Y-19.319 Z5.558 E116.68602
+G1 X6.603 Y-18.143 Z5.561 E116.74704
+G1 X8.160 Y-17.498 Z5.564 E116.80262
+G1 X10.000 Y-17.321 Z5.567 E116.86364
+G1 X11.869 Y-16.951 Z5.569 E116.92651
+G1 X13.301 Y-15.852 Z5.572 E116.98608
+G1 X14.142 Y-14.142 Z5.575 E117.04895
+G1 X14.790 Y-12.410 Z5.578 E117.10997
+G1 X15.816 Y-11.074 Z5.581 E117.16555
+G1 X17.321 Y-10.000 Z5.583 E117.22657
+G1 X18.754 Y-8.745 Z5.586 E117.28944
+G1 X19.445 Y-7.077 Z5.589 E117.34901
+G1 X19.319 Y-5.176 Z5.592 E117.41188
+G1 X19.014 Y-3.353 Z5.594 E117.47290
+G1 X19.234 Y-1.683 Z5.597 E117.52848
+G1 X20.000 Y-0.000 Z5.600 E117.58950
+G1 X20.614 Y1.803 Z5.603 E117.65237
+G1 X20.378 Y3.593 Z5.606 E117.71194
+G1 X19.319 Y5.176 Z5.608 E117.77481
+G1 X18.143 Y6.603 Z5.611 E117.83583
+G1 X17.498 Y8.160 Z5.614 E117.89141
+G1 X17.321 Y10.000 Z5.617 E117.95243
+G1 X16.951 Y11.869 Z5.619 E118.01530
+G1 X15.852 Y13.301 Z5.622 E118.07487
+G1 X14.142 Y14.142 Z5.625 E118.13774
+G1 X12.410 Y14.790 Z5.628 E118.19876
+G1 X11.074 Y15.816 Z5.631 E118.25434
+G1 X10.000 Y17.321 Z5.633 E118.31536
+G1 X8.745 Y18.754 Z5.636 E118.37823
+G1 X7.077 Y19.445 Z5.639 E118.43780
+G1 X5.176 Y19.319 Z5.642 E118.50068
+G1 X3.353 Y19.014 Z5.644 E118.56169
+G1 X1.683 Y19.234 Z5.647 E118.61728
+G1 X0.000 Y20.000 Z5.650 E118.67829
+G1 X-1.803 Y20.614 Z5.653 E118.74116
+G1 X-3.593 Y20.378 Z5.656 E118.80073
+G1 X-5.176 Y19.319 Z5.658 E118.86361
+G1 X-6.603 Y18.143 Z5.661 E118.92462
+G1 X-8.160 Y17.498 Z5.664 E118.98021
+G1 X-10.000 Y17.321 Z5.667 E119.04122
+G1 X-11.869 Y16.951 Z5.669 E119.10409
+G1 X-13.301 Y15.852 Z5.672 E119.16367
+G1 X-14.142 Y14.142 Z5.675 E119.22654
+G1 X-14.790 Y12.410 Z5.678 E119.28755
+G1 X-15.816 Y11.074 Z5.681 E119.34314
+G1 X-17.321 Y10.000 Z5.683 E119.40415
+G1 X-18.754 Y8.745 Z5.686 E119.46702
+G1 X-19.445 Y7.077 Z5.689 E119.52660
+G1 X-19.319 Y5.176 Z5.692 E119.58947
+G1 X-19.014 Y3.353 Z5.694 E119.65048
+G1 X-19.234 Y1.683 Z5.697 E119.70607
+G1 X-20.000 Y-0.000 Z5.700 E119.76708
+G1 X-20.614 Y-1.803 Z5.703 E119.82995
+G1 X-20.378 Y-3.593 Z5.706 E119.88953
+G1 X-19.319 Y-5.176 Z5.708 E119.95240
+G1 X-18.143 Y-6.603 Z5.711 E120.01341
+G1 X-17.498 Y-8.160 Z5.714 E120.06900
+G1 X-17.321 Y-10.000 Z5.717 E120.13001
+G1 X-16.951 Y-11.869 Z5.719 E120.19288
+G1 X-15.852 Y-13.301 Z5.722 E120.25246
+G1 X-14.142 Y-14.142 Z5.725 E120.31533
+G1 X-12.410 Y-14.790 Z5.728 E120.37634
+G1 X-11.074 Y-15.816 Z5.731 E120.43193
+G1 X-10.000 Y-17.321 Z5.733 E120.49294
+G1 X-8.745 Y-18.754 Z5.736 E120.55582
+G1 X-7.077 Y-19.445 Z5.739 E120.61539
+G1 X-5.176 Y-19.319 Z5.742 E120.67826
+G1 X-3.353 Y-19.014 Z5.744 E120.73928
+G1 X-1.683 Y-19.234 Z5.747 E120.79486
+G1 X-0.000 Y-20.000 Z5.750 E120.85588
+G1 X1.803 Y-20.614 Z5.753 E120.91875
+G1 X3.593 Y-20.378 Z5.756 E120.97832
+G1 X5.176 Y-19.319 Z5.758 E121.04119
+G1 X6.603 Y-18.143 Z5.761 E121.10221
+G1 X8.160 Y-17.498 Z5.764 E121.15779
+G1 X10.000 Y-17.321 Z5.767 E121.21881
+G1 X11.869 Y-16.951 Z5.769 E121.28168
+G1 X13.301 Y-15.852 Z5.772 E121.34125
+G1 X14.142 Y-14.142 Z5.775 E121.40412
+G1 X14.790 Y-12.410 Z5.778 E121.46514
+G1 X15.816 Y-11.074 Z5.781 E121.52072
+G1 X17.321 Y-10.000 Z5.783 E121.58174
+G1 X18.754 Y-8.745 Z5.786 E121.64461
+G1 X19.445 Y-7.077 Z5.789 E121.70418
+G1 X19.319 Y-5.176 Z5.792 E121.76705
+G1 X19.014 Y-3.353 Z5.794 E121.82807
+G1 X19.234 Y-1.683 Z5.797 E121.88365
+G1 X20.000 Y-0.000 Z5.800 E121.94467
+G1 X20.614 Y1.803 Z5.803 E122.00754
+G1 X20.378 Y3.593 Z5.806 E122.06711
+G1 X19.319 Y5.176 Z5.808 E122.12998
+G1 X18.143 Y6.603 Z5.811 E122.19100
+G1 X17.498 Y8.160 Z5.814 E122.24658
+G1 X17.321 Y10.000 Z5.817 E122.30760
+G1 X16.951 Y11.869 Z5.819 E122.37047
+G1 X15.852 Y13.301 Z5.822 E122.43004
+G1 X14.142 Y14.142 Z5.825 E122.49291
+G1 X12.410 Y14.790 Z5.828 E122.55393
+G1 X11.074 Y15.816 Z5.831 E122.60951
+G1 X10.000 Y17.321 Z5.833 E122.67053
+G1 X8.745 Y18.754 Z5.836 E122.73340
+G1 X7.077 Y19.445 Z5.839 E122.79297
+G1 X5.176 Y19.319 Z5.842 E122.85584
+G1 X3.353 Y19.014 Z5.844 E122.91686
+G1 X1.683 Y19.234 Z5.847 E122.97244
+G1 X0.000 Y20.000 Z5.850 E123.03346
+G1 X-1.803 Y20.614 Z5.853 E123.09633
+G1 X-3.593 Y20.378 Z5.856 E123.15590
+G1 X-5.176 Y19.319 Z5.858 E123.21877
+G1 X-6.603 Y18.143 Z5.861 E123.27979
+G1 X-8.160 Y17.498 Z5.864 E123.33537
+G1 X-10.000 Y17.321 Z5.867 E123.39639
+G1 X-11.869 Y16.951 Z5.869 E123.45926
+G1 X-13.301 Y15.852 Z5.872 E123.51883
+G1 X-14.142 Y14.142 Z5.875 E123.58170
+G1 X-14.790 Y12.410 Z5.878 E123.64272
+G1 X-15.816 Y11.074 Z5.881 E123.69830
+G1 X-17.321 Y10.000 Z5.883 E123.75932
+G1 X-18.754 Y8.745 Z5.886 E123.82219
+G1 X-19.445 Y7.077 Z5.889 E123.88176
+G1 X-19.319 Y5.176 Z5.892 E123.94463
+G1 X-19.014 Y3.353 Z5.894 E124.00565
+G1 X-19.234 Y1.683 Z5.897 E124.06123
+G1 X-20.000 Y-0.000 Z5.900 E124.12225
+G1 X-20.614 Y-1.803 Z5.903 E124.18512
+G1 X-20.378 Y-3.593 Z5.906 E124.24469
+G1 X-19.319 Y-5.176 Z5.908 E124.30756
+G1 X-18.143 Y-6.603 Z5.911 E124.36858
+G1 X-17.498 Y-8.160 Z5.914 E124.42416
+G1 X-17.321 Y-10.000 Z5.917 E124.48518
+G1 X-16.951 Y-11.869 Z5.919 E124.54805
+G1 X-15.852 Y-13.301 Z5.922 E124.60762
+G1 X-14.142 Y-14.142 Z5.925 E124.67049
+G1 X-12.410 Y-14.790 Z5.928 E124.73151
+G1 X-11.074 Y-15.816 Z5.931 E124.78709
+G1 X-10.000 Y-17.321 Z5.933 E124.84811
+G1 X-8.745 Y-18.754 Z5.936 E124.91098
+G1 X-7.077 Y-19.445 Z5.939 E124.97055
+G1 X-5.176 Y-19.319 Z5.942 E125.03343
+G1 X-3.353 Y-19.014 Z5.944 E125.09444
+G1 X-1.683 Y-19.234 Z5.947 E125.15003
+G1 X0.000 Y-20.000 Z5.950 E125.21104
+G1 X1.803 Y-20.614 Z5.953 E125.27391
+G1 X3.593 Y-20.378 Z5.956 E125.33348
+G1 X5.176 Y-19.319 Z5.958 E125.39636
+G1 X6.603 Y-18.143 Z5.961 E125.45737
+G1 X8.160 Y-17.498 Z5.964 E125.51296
+G1 X10.000 Y-17.321 Z5.967 E125.57397
+G1 X11.869 Y-16.951 Z5.969 E125.63684
+G1 X13.301 Y-15.852 Z5.972 E125.69642
+G1 X14.142 Y-14.142 Z5.975 E125.75929
+G1 X14.790 Y-12.410 Z5.978 E125.82030
+G1 X15.816 Y-11.074 Z5.981 E125.87589
+G1 X17.321 Y-10.000 Z5.983 E125.93690
+G1 X18.754 Y-8.745 Z5.986 E125.99977
+G1 X19.445 Y-7.077 Z5.989 E126.05935
+G1 X19.319 Y-5.176 Z5.992 E126.12222
+G1 X19.014 Y-3.353 Z5.994 E126.18323
+G1 X19.234 Y-1.683 Z5.997 E126.23882
+G1 X20.000 Y-0.000 Z6.000 E126.29983
+G1 X20.614 Y1.803 Z6.003 E126.36270
+G1 X20.378 Y3.593 Z6.006 E126.42228
+G1 X19.319 Y5.176 Z6.008 E126.48515
+G1 X18.143 Y6.603 Z6.011 E126.54616
+G1 X17.498 Y8.160 Z6.014 E126.60175
+G1 X17.321 Y10.000 Z6.017 E126.66276
+G1 X16.951 Y11.869 Z6.019 E126.72563
+G1 X15.852 Y13.301 Z6.022 E126.78521
+G1 X14.142 Y14.142 Z6.025 E126.84808
+G1 X12.410 Y14.790 Z6.028 E126.90909
+G1 X11.074 Y15.816 Z6.031 E126.96468
+G1 X10.000 Y17.321 Z6.033 E127.02569
+G1 X8.745 Y18.754 Z6.036 E127.08857
+G1 X7.077 Y19.445 Z6.039 E127.14814
+G1 X5.176 Y19.319 Z6.042 E127.21101
+G1 X3.353 Y19.014 Z6.044 E127.27203
+G1 X1.683 Y19.234 Z6.047 E127.32761
+G1 X0.000 Y20.000 Z6.050 E127.38863
+G1 X-1.803 Y20.614 Z6.053 E127.45150
+G1 X-3.593 Y20.378 Z6.056 E127.51107
+G1 X-5.176 Y19.319 Z6.058 E127.57394
+G1 X-6.603 Y18.143 Z6.061 E127.63496
+G1 X-8.160 Y17.498 Z6.064 E127.69054
+G1 X-10.000 Y17.321 Z6.067 E127.75156
+G1 X-11.869 Y16.951 Z6.069 E127.81443
+G1 X-13.301 Y15.852 Z6.072 E127.87400
+G1 X-14.142 Y14.142 Z6.075 E127.93687
+G1 X-14.790 Y12.410 Z6.078 E127.99789
+G1 X-15.816 Y11.074 Z6.081 E128.05347
+G1 X-17.321 Y10.000 Z6.083 E128.11449
+G1 X-18.754 Y8.745 Z6.086 E128.17736
+G1 X-19.445 Y7.077 Z6.089 E128.23693
+G1 X-19.319 Y5.176 Z6.092 E128.29980
+G1 X-19.014 Y3.353 Z6.094 E128.36082
+G1 X-19.234 Y1.683 Z6.097 E128.41640
+G1 X-20.000 Y0.000 Z6.100 E128.47742
+G1 X-20.614 Y-1.803 Z6.103 E128.54029
+G1 X-20.378 Y-3.593 Z6.106 E128.59986
+G1 X-19.319 Y-5.176 Z6.108 E128.66273
+G1 X-18.143 Y-6.603 Z6.111 E128.72375
+G1 X-17.498 Y-8.160 Z6.114 E128.77933
+G1 X-17.321 Y-10.000 Z6.117 E128.84035
+G1 X-16.951 Y-11.869 Z6.119 E128.90322
+G1 X-15.852 Y-13.301 Z6.122 E128.96279
+G1 X-14.142 Y-14.142 Z6.125 E129.02566
+G1 X-12.410 Y-14.790 Z6.128 E129.08668
+G1 X-11.074 Y-15.816 Z6.131 E129.14226
+G1 X-10.000 Y-17.321 Z6.133 E129.20328
+G1 X-8.745 Y-18.754 Z6.136 E129.26615
+G1 X-7.077 Y-19.445 Z6.139 E129.32572
+G1 X-5.176 Y-19.319 Z6.142 E129.38859
+G1 X-3.353 Y-19.014 Z6.144 E129.44961
+G1 X-1.683 Y-19.234 Z6.147 E129.50519
+G1 X-0.000 Y-20.000 Z6.150 E129.56621
+G1 X1.803 Y-20.614 Z6.153 E129.62908
+G1 X3.593 Y-20.378 Z6.156 E129.68865
+G1 X5.176 Y-19.319 Z6.158 E129.75152
+G1 X6.603 Y-18.143 Z6.161 E129.81254
+G1 X8.160 Y-17.498 Z6.164 E129.86812
+G1 X10.000 Y-17.321 Z6.167 E129.92914
+G1 X11.869 Y-16.951 Z6.169 E129.99201
+G1 X13.301 Y-15.852 Z6.172 E130.05158
+G1 X14.142 Y-14.142 Z6.175 E130.11445
+G1 X14.790 Y-12.410 Z6.178 E130.17547
+G1 X15.816 Y-11.074 Z6.181 E130.23105
+G1 X17.321 Y-10.000 Z6.183 E130.29207
+G1 X18.754 Y-8.745 Z6.186 E130.35494
+G1 X19.445 Y-7.077 Z6.189 E130.41451
+G1 X19.319 Y-5.176 Z6.192 E130.47738
+G1 X19.014 Y-3.353 Z6.194 E130.53840
+G1 X19.234 Y-1.683 Z6.197 E130.59398
+G1 X20.000 Y-0.000 Z6.200 E130.65500
+G1 X20.614 Y1.803 Z6.203 E130.71787
+G1 X20.378 Y3.593 Z6.206 E130.77744
+G1 X19.319 Y5.176 Z6.208 E130.84031
+G1 X18.143 Y6.603 Z6.211 E130.90133
+G1 X17.498 Y8.160 Z6.214 E130.95691
+G1 X17.321 Y10.000 Z6.217 E131.01793
+G1 X16.951 Y11.869 Z6.219 E131.08080
+G1 X15.852 Y13.301 Z6.222 E131.14037
+G1 X14.142 Y14.142 Z6.225 E131.20324
+G1 X12.410 Y14.790 Z6.228 E131.26426
+G1 X11.074 Y15.816 Z6.231 E131.31984
+G1 X10.000 Y17.321 Z6.233 E131.38086
+G1 X8.745 Y18.754 Z6.236 E131.44373
+G1 X7.077 Y19.445 Z6.239 E131.50330
+G1 X5.176 Y19.319 Z6.242 E131.56618
+G1 X3.353 Y19.014 Z6.244 E131.62719
+G1 X1.683 Y19.234 Z6.247 E131.68278
+G1 X-0.000 Y20.000 Z6.250 E131.74379
+G1 X-1.803 Y20.614 Z6.253 E131.80666
+G1 X-3.593 Y20.378 Z6.256 E131.86623
+G1 X-5.176 Y19.319 Z6.258 E131.92911
+G1 X-6.603 Y18.143 Z6.261 E131.99012
+G1 X-8.160 Y17.498 Z6.264 E132.04571
+G1 X-10.000 Y17.321 Z6.267 E132.10672
+G1 X-11.869 Y16.951 Z6.269 E132.16959
+G1 X-13.301 Y15.852 Z6.272 E132.22917
+G1 X-14.142 Y14.142 Z6.275 E132.29204
+G1 X-14.790 Y12.410 Z6.278 E132.35305
+G1 X-15.816 Y11.074 Z6.281 E132.40864
+G1 X-17.321 Y10.000 Z6.283 E132.46965
+G1 X-18.754 Y8.745 Z6.286 E132.53252
+G1 X-19.445 Y7.077 Z6.289 E132.59210
+G1 X-19.319 Y5.176 Z6.292 E132.65497
+G1 X-19.014 Y3.353 Z6.294 E132.71598
+G1 X-19.234 Y1.683 Z6.297 E132.77157
+G1 X-20.000 Y0.000 Z6.300 E132.83258
+G1 X-20.614 Y-1.803 Z6.303 E132.89545
+G1 X-20.378 Y-3.593 Z6.306 E132.95503
+G1 X-19.319 Y-5.176 Z6.308 E133.01790
+G1 X-18.143 Y-6.603 Z6.311 E133.07891
+G1 X-17.498 Y-8.160 Z6.314 E133.13450
+G1 X-17.321 Y-10.000 Z6.317 E133.19551
+G1 X-16.951 Y-11.869 Z6.319 E133.25838
+G1 X-15.852 Y-13.301 Z6.322 E133.31796
+G1 X-14.142 Y-14.142 Z6.325 E133.38083
+G1 X-12.410 Y-14.790 Z6.328 E133.44184
+G1 X-11.074 Y-15.816 Z6.331 E133.49743
+G1 X-10.000 Y-17.321 Z6.333 E133.55844
+G1 X-8.745 Y-18.754 Z6.336 E133.62132
+G1 X-7.077 Y-19.445 Z6.339 E133.68089
+G1 X-5.176 Y-19.319 Z6.342 E133.74376
+G1 X-3.353 Y-19.014 Z6.344 E133.80478
+G1 X-1.683 Y-19.234 Z6.347 E133.86036
+G1 X-0.000 Y-20.000 Z6.350 E133.92138
+G1 X1.803 Y-20.614 Z6.353 E133.98425
+G1 X3.593 Y-20.378 Z6.356 E134.04382
+G1 X5.176 Y-19.319 Z6.358 E134.10669
+G1 X6.603 Y-18.143 Z6.361 E134.16771
+G1 X8.160 Y-17.498 Z6.364 E134.22329
+G1 X10.000 Y-17.321 Z6.367 E134.28431
+G1 X11.869 Y-16.951 Z6.369 E134.34718
+G1 X13.301 Y-15.852 Z6.372 E134.40675
+G1 X14.142 Y-14.142 Z6.375 E134.46962
+G1 X14.790 Y-12.410 Z6.378 E134.53064
+G1 X15.816 Y-11.074 Z6.381 E134.58622
+G1 X17.321 Y-10.000 Z6.383 E134.64724
+G1 X18.754 Y-8.745 Z6.386 E134.71011
+G1 X19.445 Y-7.077 Z6.389 E134.76968
+G1 X19.319 Y-5.176 Z6.392 E134.83255
+G1 X19.014 Y-3.353 Z6.394 E134.89357
+G1 X19.234 Y-1.683 Z6.397 E134.94915
+G1 X20.000 Y-0.000 Z6.400 E135.01017
+G1 X20.614 Y1.803 Z6.403 E135.07304
+G1 X20.378 Y3.593 Z6.406 E135.13261
+G1 X19.319 Y5.176 Z6.408 E135.19548
+G1 X18.143 Y6.603 Z6.411 E135.25650
+G1 X17.498 Y8.160 Z6.414 E135.31208
+G1 X17.321 Y10.000 Z6.417 E135.37310
+G1 X16.951 Y11.869 Z6.419 E135.43597
+G1 X15.852 Y13.301 Z6.422 E135.49554
+G1 X14.142 Y14.142 Z6.425 E135.55841
+G1 X12.410 Y14.790 Z6.428 E135.61943
+G1 X11.074 Y15.816 Z6.431 E135.67501
+G1 X10.000 Y17.321 Z6.433 E135.73603
+G1 X8.745 Y18.754 Z6.436 E135.79890
+G1 X7.077 Y19.445 Z6.439 E135.85847
+G1 X5.176 Y19.319 Z6.442 E135.92134
+G1 X3.353 Y19.014 Z6.444 E135.98236
+G1 X1.683 Y19.234 Z6.447 E136.03794
+G1 X-0.000 Y20.000 Z6.450 E136.09896
+G1 X-1.803 Y20.614 Z6.453 E136.16183
+G1 X-3.593 Y20.378 Z6.456 E136.22140
+G1 X-5.176 Y19.319 Z6.458 E136.28427
+G1 X-6.603 Y18.143 Z6.461 E136.34529
+G1 X-8.160 Y17.498 Z6.464 E136.40087
+G1 X-10.000 Y17.321 Z6.467 E136.46189
+G1 X-11.869 Y16.951 Z6.469 E136.52476
+G1 X-13.301 Y15.852 Z6.472 E136.58433
+G1 X-14.142 Y14.142 Z6.475 E136.64720
+G1 X-14.790 Y12.410 Z6.478 E136.70822
+G1 X-15.816 Y11.074 Z6.481 E136.76380
+G1 X-17.321 Y10.000 Z6.483 E136.82482
+G1 X-18.754 Y8.745 Z6.486 E136.88769
+G1 X-19.445 Y7.077 Z6.489 E136.94726
+G1 X-19.319 Y5.176 Z6.492 E137.01013
+G1 X-19.014 Y3.353 Z6.494 E137.07115
+G1 X-19.234 Y1.683 Z6.497 E137.12673
+G1 X-20.000 Y-0.000 Z6.500 E137.18775
+G1 X-20.614 Y-1.803 Z6.503 E137.25062
+G1 X-20.378 Y-3.593 Z6.506 E137.31019
+G1 X-19.319 Y-5.176 Z6.508 E137.37306
+G1 X-18.143 Y-6.603 Z6.511 E137.43408
+G1 X-17.498 Y-8.160 Z6.514 E137.48966
+G1 X-17.321 Y-10.000 Z6.517 E137.55068
+G1 X-16.951 Y-11.869 Z6.519 E137.61355
+G1 X-15.852 Y-13.301 Z6.522 E137.67312
+G1 X-14.142 Y-14.142 Z6.525 E137.73599
+G1 X-12.410 Y-14.790 Z6.528 E137.79701
+G1 X-11.074 Y-15.816 Z6.531 E137.85259
+G1 X-10.000 Y-17.321 Z6.533 E137.91361
+G1 X-8.745 Y-18.754 Z6.536 E137.97648
+G1 X-7.077 Y-19.445 Z6.539 E138.03605
+G1 X-5.176 Y-19.319 Z6.542 E138.09893
+G1 X-3.353 Y-19.014 Z6.544 E138.15994
+G1 X-1.683 Y-19.234 Z6.547 E138.21553
+G1 X-0.000 Y-20.000 Z6.550 E138.27654
+G1 X1.803 Y-20.614 Z6.553 E138.33941
+G1 X3.593 Y-20.378 Z6.556 E138.39898
+G1 X5.176 Y-19.319 Z6.558 E138.46186
+G1 X6.603 Y-18.143 Z6.561 E138.52287
+G1 X8.160 Y-17.498 Z6.564 E138.57846
+G1 X10.000 Y-17.321 Z6.567 E138.63947
+G1 X11.869 Y-16.951 Z6.569 E138.70234
+G1 X13.301 Y-15.852 Z6.572 E138.76192
+G1 X14.142 Y-14.142 Z6.575 E138.82479
+G1 X14.790 Y-12.410 Z6.578 E138.88580
+G1 X15.816 Y-11.074 Z6.581 E138.94139
+G1 X17.321 Y-10.000 Z6.583 E139.00240
+G1 X18.754 Y-8.745 Z6.586 E139.06527
+G1 X19.445 Y-7.077 Z6.589 E139.12485
+G1 X19.319 Y-5.176 Z6.592 E139.18772
+G1 X19.014 Y-3.353 Z6.594 E139.24873
+G1 X19.234 Y-1.683 Z6.597 E139.30432
+G1 X20.000 Y-0.000 Z6.600 E139.36533
+G1 X20.614 Y1.803 Z6.603 E139.42820
+G1 X20.378 Y3.593 Z6.606 E139.48778
+G1 X19.319 Y5.176 Z6.608 E139.55065
+G1 X18.143 Y6.603 Z6.611 E139.61166
+G1 X17.498 Y8.160 Z6.614 E139.66725
+G1 X17.321 Y10.000 Z6.617 E139.72826
+G1 X16.951 Y11.869 Z6.619 E139.79113
+G1 X15.852 Y13.301 Z6.622 E139.85071
+G1 X14.142 Y14.142 Z6.625 E139.91358
+G1 X12.410 Y14.790 Z6.628 E139.97459
+G1 X11.074 Y15.816 Z6.631 E140.03018
+G1 X10.000 Y17.321 Z6.633 E140.09119
+G1 X8.745 Y18.754 Z6.636 E140.15407
+G1 X7.077 Y19.445 Z6.639 E140.21364
+G1 X5.176 Y19.319 Z6.642 E140.27651
+G1 X3.353 Y19.014 Z6.644 E140.33753
+G1 X1.683 Y19.234 Z6.647 E140.39311
+G1 X0.000 Y20.000 Z6.650 E140.45413
+G1 X-1.803 Y20.614 Z6.653 E140.51700
+G1 X-3.593 Y20.378 Z6.656 E140.57657
+G1 X-5.176 Y19.319 Z6.658 E140.63944
+G1 X-6.603 Y18.143 Z6.661 E140.70046
+G1 X-8.160 Y17.498 Z6.664 E140.75604
+G1 X-10.000 Y17.321 Z6.667 E140.81706
+G1 X-11.869 Y16.951 Z6.669 E140.87993
+G1 X-13.301 Y15.852 Z6.672 E140.93950
+G1 X-14.142 Y14.142 Z6.675 E141.00237
+G1 X-14.790 Y12.410 Z6.678 E141.06339
+G1 X-15.816 Y11.074 Z6.681 E141.11897
+G1 X-17.321 Y10.000 Z6.683 E141.17999
+G1 X-18.754 Y8.745 Z6.686 E141.24286
+G1 X-19.445 Y7.077 Z6.689 E141.30243
+G1 X-19.319 Y5.176 Z6.692 E141.36530
+G1 X-19.014 Y3.353 Z6.694 E141.42632
+G1 X-19.234 Y1.683 Z6.697 E141.48190
+G1 X-20.000 Y0.000 Z6.700 E141.54292
+G1 X-20.614 Y-1.803 Z6.703 E141.60579
+G1 X-20.378 Y-3.593 Z6.706 E141.66536
+G1 X-19.319 Y-5.176 Z6.708 E141.72823
+G1 X-18.143 Y-6.603 Z6.711 E141.78925
+G1 X-17.498 Y-8.160 Z6.714 E141.84483
+G1 X-17.321 Y-10.000 Z6.717 E141.90585
+G1 X-16.951 Y-11.869 Z6.719 E141.96872
+G1 X-15.852 Y-13.301 Z6.722 E142.02829
+G1 X-14.142 Y-14.142 Z6.725 E142.09116
+G1 X-12.410 Y-14.790 Z6.728 E142.15218
+G1 X-11.074 Y-15.816 Z6.731 E142.20776
+G1 X-10.000 Y-17.321 Z6.733 E142.26878
+G1 X-8.745 Y-18.754 Z6.736 E142.33165
+G1 X-7.077 Y-19.445 Z6.739 E142.39122
+G1 X-5.176 Y-19.319 Z6.742 E142.45409
+G1 X-3.353 Y-19.014 Z6.744 E142.51511
+G1 X-1.683 Y-19.234 Z6.747 E142.57069
+G1 X-0.000 Y-20.000 Z6.750 E142.63171
+G1 X1.803 Y-20.614 Z6.753 E142.69458
+G1 X3.593 Y-20.378 Z6.756 E142.75415
+G1 X5.176 Y-19.319 Z6.758 E142.81702
+G1 X6.603 Y-18.143 Z6.761 E142.87804
+G1 X8.160 Y-17.498 Z6.764 E142.93362
+G1 X10.000 Y-17.321 Z6.767 E142.99464
+G1 X11.869 Y-16.951 Z6.769 E143.05751
+G1 X13.301 Y-15.852 Z6.772 E143.11708
+G1 X14.142 Y-14.142 Z6.775 E143.17995
+G1 X14.790 Y-12.410 Z6.778 E143.24097
+G1 X15.816 Y-11.074 Z6.781 E143.29655
+G1 X17.321 Y-10.000 Z6.783 E143.35757
+G1 X18.754 Y-8.745 Z6.786 E143.42044
+G1 X19.445 Y-7.077 Z6.789 E143.48001
+G1 X19.319 Y-5.176 Z6.792 E143.54288
+G1 X19.014 Y-3.353 Z6.794 E143.60390
+G1 X19.234 Y-1.683 Z6.797 E143.65948
+G1 X20.000 Y-0.000 Z6.800 E143.72050
+G1 X20.614 Y1.803 Z6.803 E143.78337
+G1 X20.378 Y3.593 Z6.806 E143.84294
+G1 X19.319 Y5.176 Z6.808 E143.90581
+G1 X18.143 Y6.603 Z6.811 E143.96683
+G1 X17.498 Y8.160 Z6.814 E144.02241
+G1 X17.321 Y10.000 Z6.817 E144.08343
+G1 X16.951 Y11.869 Z6.819 E144.14630
+G1 X15.852 Y13.301 Z6.822 E144.20587
+G1 X14.142 Y14.142 Z6.825 E144.26874
+G1 X12.410 Y14.790 Z6.828 E144.32976
+G1 X11.074 Y15.816 Z6.831 E144.38534
+G1 X10.000 Y17.321 Z6.833 E144.44636
+G1 X8.745 Y18.754 Z6.836 E144.50923
+G1 X7.077 Y19.445 Z6.839 E144.56880
+G1 X5.176 Y19.319 Z6.842 E144.63168
+G1 X3.353 Y19.014 Z6.844 E144.69269
+G1 X1.683 Y19.234 Z6.847 E144.74828
+G1 X0.000 Y20.000 Z6.850 E144.80929
+G1 X-1.803 Y20.614 Z6.853 E144.87216
+G1 X-3.593 Y20.378 Z6.856 E144.93173
+G1 X-5.176 Y19.319 Z6.858 E144.99461
+G1 X-6.603 Y18.143 Z6.861 E145.05562
+G1 X-8.160 Y17.498 Z6.864 E145.11121
+G1 X-10.000 Y17.321 Z6.867 E145.17222
+G1 X-11.869 Y16.951 Z6.869 E145.23509
+G1 X-13.301 Y15.852 Z6.872 E145.29467
+G1 X-14.142 Y14.142 Z6.875 E145.35754
+G1 X-14.790 Y12.410 Z6.878 E145.41855
+G1 X-15.816 Y11.074 Z6.881 E145.47414
+G1 X-17.321 Y10.000 Z6.883 E145.53515
+G1 X-18.754 Y8.745 Z6.886 E145.59802
+G1 X-19.445 Y7.077 Z6.889 E145.65760
+G1 X-19.319 Y5.176 Z6.892 E145.72047
+G1 X-19.014 Y3.353 Z6.894 E145.78148
+G1 X-19.234 Y1.683 Z6.897 E145.83707
+G1 X-20.000 Y0.000 Z6.900 E145.89808
+G1 X-20.614 Y-1.803 Z6.903 E145.96095
+G1 X-20.378 Y-3.593 Z6.906 E146.02053
+G1 X-19.319 Y-5.176 Z6.908 E146.08340
+G1 X-18.143 Y-6.603 Z6.911 E146.14441
+G1 X-17.498 Y-8.160 Z6.914 E146.20000
+G1 X-17.321 Y-10.000 Z6.917 E146.26101
+G1 X-16.951 Y-11.869 Z6.919 E146.32388
+G1 X-15.852 Y-13.301 Z6.922 E146.38346
+G1 X-14.142 Y-14.142 Z6.925 E146.44633
+G1 X-12.410 Y-14.790 Z6.928 E146.50734
+G1 X-11.074 Y-15.816 Z6.931 E146.56293
+G1 X-10.000 Y-17.321 Z6.933 E146.62394
+G1 X-8.745 Y-18.754 Z6.936 E146.68682
+G1 X-7.077 Y-19.445 Z6.939 E146.74639
+G1 X-5.176 Y-19.319 Z6.942 E146.80926
+G1 X-3.353 Y-19.014 Z6.944 E146.87028
+G1 X-1.683 Y-19.234 Z6.947 E146.92586
+G1 X-0.000 Y-20.000 Z6.950 E146.98688
+G1 X1.803 Y-20.614 Z6.953 E147.04975
+G1 X3.593 Y-20.378 Z6.956 E147.10932
+G1 X5.176 Y-19.319 Z6.958 E147.17219
+G1 X6.603 Y-18.143 Z6.961 E147.23321
+G1 X8.160 Y-17.498 Z6.964 E147.28879
+G1 X10.000 Y-17.321 Z6.967 E147.34981
+G1 X11.869 Y-16.951 Z6.969 E147.41268
+G1 X13.301 Y-15.852 Z6.972 E147.47225
+G1 X14.142 Y-14.142 Z6.975 E147.53512
+G1 X14.790 Y-12.410 Z6.978 E147.59614
+G1 X15.816 Y-11.074 Z6.981 E147.65172
+G1 X17.321 Y-10.000 Z6.983 E147.71274
+G1 X18.754 Y-8.745 Z6.986 E147.77561
+G1 X19.445 Y-7.077 Z6.989 E147.83518
+G1 X19.319 Y-5.176 Z6.992 E147.89805
+G1 X19.014 Y-3.353 Z6.994 E147.95907
+G1 X19.234 Y-1.683 Z6.997 E148.01465
+G1 X20.000 Y0.000 Z7.000 E148.07567
+G1 X20.614 Y1.803 Z7.003 E148.13854
+G1 X20.378 Y3.593 Z7.006 E148.19811
+G1 X19.319 Y5.176 Z7.008 E148.26098
+G1 X18.143 Y6.603 Z7.011 E148.32200
+G1 X17.498 Y8.160 Z7.014 E148.37758
+G1 X17.321 Y10.000 Z7.017 E148.43860
+G1 X16.951 Y11.869 Z7.019 E148.50147
+G1 X15.852 Y13.301 Z7.022 E148.56104
+G1 X14.142 Y14.142 Z7.025 E148.62391
+G1 X12.410 Y14.790 Z7.028 E148.68493
+G1 X11.074 Y15.816 Z7.031 E148.74051
+G1 X10.000 Y17.321 Z7.033 E148.80153
+G1 X8.745 Y18.754 Z7.036 E148.86440
+G1 X7.077 Y19.445 Z7.039 E148.92397
+G1 X5.176 Y19.319 Z7.042 E148.98684
+G1 X3.353 Y19.014 Z7.044 E149.04786
+G1 X1.683 Y19.234 Z7.047 E149.10344
+G1 X-0.000 Y20.000 Z7.050 E149.16446
+G1 X-1.803 Y20.614 Z7.053 E149.22733
+G1 X-3.593 Y20.378 Z7.056 E149.28690
+G1 X-5.176 Y19.319 Z7.058 E149.34977
+G1 X-6.603 Y18.143 Z7.061 E149.41079
+G1 X-8.160 Y17.498 Z7.064 E149.46637
+G1 X-10.000 Y17.321 Z7.067 E149.52739
+G1 X-11.869 Y16.951 Z7.069 E149.59026
+G1 X-13.301 Y15.852 Z7.072 E149.64983
+G1 X-14.142 Y14.142 Z7.075 E149.71270
+G1 X-14.790 Y12.410 Z7.078 E149.77372
+G1 X-15.816 Y11.074 Z7.081 E149.82930
+G1 X-17.321 Y10.000 Z7.083 E149.89032
+G1 X-18.754 Y8.745 Z7.086 E149.95319
+G1 X-19.445 Y7.077 Z7.089 E150.01276
+G1 X-19.319 Y5.176 Z7.092 E150.07563
+G1 X-19.014 Y3.353 Z7.094 E150.13665
+G1 X-19.234 Y1.683 Z7.097 E150.19223
+G1 X-20.000 Y0.000 Z7.100 E150.25325
+G1 X-20.614 Y-1.803 Z7.103 E150.31612
+G1 X-20.378 Y-3.593 Z7.106 E150.37569
+G1 X-19.319 Y-5.176 Z7.108 E150.43856
+G1 X-18.143 Y-6.603 Z7.111 E150.49958
+G1 X-17.498 Y-8.160 Z7.114 E150.55516
+G1 X-17.321 Y-10.000 Z7.117 E150.61618
+G1 X-16.951 Y-11.869 Z7.119 E150.67905
+G1 X-15.852 Y-13.301 Z7.122 E150.73862
+G1 X-14.142 Y-14.142 Z7.125 E150.80149
+G1 X-12.410 Y-14.790 Z7.128 E150.86251
+G1 X-11.074 Y-15.816 Z7.131 E150.91809
+G1 X-10.000 Y-17.321 Z7.133 E150.97911
+G1 X-8.745 Y-18.754 Z7.136 E151.04198
+G1 X-7.077 Y-19.445 Z7.139 E151.10155
+G1 X-5.176 Y-19.319 Z7.142 E151.16443
+G1 X-3.353 Y-19.014 Z7.144 E151.22544
+G1 X-1.683 Y-19.234 Z7.147 E151.28103
+G1 X-0.000 Y-20.000 Z7.150 E151.34204
+G1 X1.803 Y-20.614 Z7.153 E151.40491
+G1 X3.593 Y-20.378 Z7.156 E151.46448
+G1 X5.176 Y-19.319 Z7.158 E151.52736
+G1 X6.603 Y-18.143 Z7.161 E151.58837
+G1 X8.160 Y-17.498 Z7.164 E151.64396
+G1 X10.000 Y-17.321 Z7.167 E151.70497
+G1 X11.869 Y-16.951 Z7.169 E151.76784
+G1 X13.301 Y-15.852 Z7.172 E151.82742
+G1 X14.142 Y-14.142 Z7.175 E151.89029
+G1 X14.790 Y-12.410 Z7.178 E151.95130
+G1 X15.816 Y-11.074 Z7.181 E152.00689
+G1 X17.321 Y-10.000 Z7.183 E152.06790
+G1 X18.754 Y-8.745 Z7.186 E152.13077
+G1 X19.445 Y-7.077 Z7.189 E152.19035
+G1 X19.319 Y-5.176 Z7.192 E152.25322
+G1 X19.014 Y-3.353 Z7.194 E152.31423
+G1 X19.234 Y-1.683 Z7.197 E152.36982
+G1 X20.000 Y0.000 Z7.200 E152.43083
+G1 X20.614 Y1.803 Z7.203 E152.49370
+G1 X20.378 Y3.593 Z7.206 E152.55328
+G1 X19.319 Y5.176 Z7.208 E152.61615
+G1 X18.143 Y6.603 Z7.211 E152.67716
+G1 X17.498 Y8.160 Z7.214 E152.73275
+G1 X17.321 Y10.000 Z7.217 E152.79376
+G1 X16.951 Y11.869 Z7.219 E152.85663
+G1 X15.852 Y13.301 Z7.222 E152.91621
+G1 X14.142 Y14.142 Z7.225 E152.97908
+G1 X12.410 Y14.790 Z7.228 E153.04009
+G1 X11.074 Y15.816 Z7.231 E153.09568
+G1 X10.000 Y17.321 Z7.233 E153.15669
+G1 X8.745 Y18.754 Z7.236 E153.21957
+G1 X7.077 Y19.445 Z7.239 E153.27914
+G1 X5.176 Y19.319 Z7.242 E153.34201
+G1 X3.353 Y19.014 Z7.244 E153.40303
+G1 X1.683 Y19.234 Z7.247 E153.45861
+G1 X0.000 Y20.000 Z7.250 E153.51963
+G1 X-1.803 Y20.614 Z7.253 E153.58250
+G1 X-3.593 Y20.378 Z7.256 E153.64207
+G1 X-5.176 Y19.319 Z7.258 E153.70494
+G1 X-6.603 Y18.143 Z7.261 E153.76596
+G1 X-8.160 Y17.498 Z7.264 E153.82154
+G1 X-10.000 Y17.321 Z7.267 E153.88256
+G1 X-11.869 Y16.951 Z7.269 E153.94543
+G1 X-13.301 Y15.852 Z7.272 E154.00500
+G1 X-14.142 Y14.142 Z7.275 E154.06787
+G1 X-14.790 Y12.410 Z7.278 E154.12889
+G1 X-15.816 Y11.074 Z7.281 E154.18447
+G1 X-17.321 Y10.000 Z7.283 E154.24549
+G1 X-18.754 Y8.745 Z7.286 E154.30836
+G1 X-19.445 Y7.077 Z7.289 E154.36793
+G1 X-19.319 Y5.176 Z7.292 E154.43080
+G1 X-19.014 Y3.353 Z7.294 E154.49182
+G1 X-19.234 Y1.683 Z7.297 E154.54740
+G1 X-20.000 Y0.000 Z7.300 E154.60842
+G1 X-20.614 Y-1.803 Z7.303 E154.67129
+G1 X-20.378 Y-3.593 Z7.306 E154.73086
+G1 X-19.319 Y-5.176 Z7.308 E154.79373
+G1 X-18.143 Y-6.603 Z7.311 E154.85475
+G1 X-17.498 Y-8.160 Z7.314 E154.91033
+G1 X-17.321 Y-10.000 Z7.317 E154.97135
+G1 X-16.951 Y-11.869 Z7.319 E155.03422
+G1 X-15.852 Y-13.301 Z7.322 E155.09379
+G1 X-14.142 Y-14.142 Z7.325 E155.15666
+G1 X-12.410 Y-14.790 Z7.328 E155.21768
+G1 X-11.074 Y-15.816 Z7.331 E155.27326
+G1 X-10.000 Y-17.321 Z7.333 E155.33428
+G1 X-8.745 Y-18.754 Z7.336 E155.39715
+G1 X-7.077 Y-19.445 Z7.339 E155.45672
+G1 X-5.176 Y-19.319 Z7.342 E155.51959
+G1 X-3.353 Y-19.014 Z7.344 E155.58061
+G1 X-1.683 Y-19.234 Z7.347 E155.63619
+G1 X-0.000 Y-20.000 Z7.350 E155.69721
+G1 X1.803 Y-20.614 Z7.353 E155.76008
+G1 X3.593 Y-20.378 Z7.356 E155.81965
+G1 X5.176 Y-19.319 Z7.358 E155.88252
+G1 X6.603 Y-18.143 Z7.361 E155.94354
+G1 X8.160 Y-17.498 Z7.364 E155.99912
+G1 X10.000 Y-17.321 Z7.367 E156.06014
+G1 X11.869 Y-16.951 Z7.369 E156.12301
+G1 X13.301 Y-15.852 Z7.372 E156.18258
+G1 X14.142 Y-14.142 Z7.375 E156.24545
+G1 X14.790 Y-12.410 Z7.378 E156.30647
+G1 X15.816 Y-11.074 Z7.381 E156.36205
+G1 X17.321 Y-10.000 Z7.383 E156.42307
+G1 X18.754 Y-8.745 Z7.386 E156.48594
+G1 X19.445 Y-7.077 Z7.389 E156.54551
+G1 X19.319 Y-5.176 Z7.392 E156.60838
+G1 X19.014 Y-3.353 Z7.394 E156.66940
+G1 X19.234 Y-1.683 Z7.397 E156.72498
+G1 X20.000 Y-0.000 Z7.400 E156.78600
+G1 X20.614 Y1.803 Z7.403 E156.84887
+G1 X20.378 Y3.593 Z7.406 E156.90844
+G1 X19.319 Y5.176 Z7.408 E156.97131
+G1 X18.143 Y6.603 Z7.411 E157.03233
+G1 X17.498 Y8.160 Z7.414 E157.08791
+G1 X17.321 Y10.000 Z7.417 E157.14893
+G1 X16.951 Y11.869 Z7.419 E157.21180
+G1 X15.852 Y13.301 Z7.422 E157.27137
+G1 X14.142 Y14.142 Z7.425 E157.33424
+G1 X12.410 Y14.790 Z7.428 E157.39526
+G1 X11.074 Y15.816 Z7.431 E157.45084
+G1 X10.000 Y17.321 Z7.433 E157.51186
+G1 X8.745 Y18.754 Z7.436 E157.57473
+G1 X7.077 Y19.445 Z7.439 E157.63430
+G1 X5.176 Y19.319 Z7.442 E157.69718
+G1 X3.353 Y19.014 Z7.444 E157.75819
+G1 X1.683 Y19.234 Z7.447 E157.81378
+G1 X0.000 Y20.000 Z7.450 E157.87479
+G1 X-1.803 Y20.614 Z7.453 E157.93766
+G1 X-3.593 Y20.378 Z7.456 E157.99723
+G1 X-5.176 Y19.319 Z7.458 E158.06011
+G1 X-6.603 Y18.143 Z7.461 E158.12112
+G1 X-8.160 Y17.498 Z7.464 E158.17671
+G1 X-10.000 Y17.321 Z7.467 E158.23772
+G1 X-11.869 Y16.951 Z7.469 E158.30059
+G1 X-13.301 Y15.852 Z7.472 E158.36017
+G1 X-14.142 Y14.142 Z7.475 E158.42304
+G1 X-14.790 Y12.410 Z7.478 E158.48405
+G1 X-15.816 Y11.074 Z7.481 E158.53964
+G1 X-17.321 Y10.000 Z7.483 E158.60065
+G1 X-18.754 Y8.745 Z7.486 E158.66352
+G1 X-19.445 Y7.077 Z7.489 E158.72310
+G1 X-19.319 Y5.176 Z7.492 E158.78597
+G1 X-19.014 Y3.353 Z7.494 E158.84698
+G1 X-19.234 Y1.683 Z7.497 E158.90257
+G1 X-20.000 Y-0.000 Z7.500 E158.96358
+G1 X-20.614 Y-1.803 Z7.503 E159.02645
+G1 X-20.378 Y-3.593 Z7.506 E159.08603
+G1 X-19.319 Y-5.176 Z7.508 E159.14890
+G1 X-18.143 Y-6.603 Z7.511 E159.20991
+G1 X-17.498 Y-8.160 Z7.514 E159.26550
+G1 X-17.321 Y-10.000 Z7.517 E159.32651
+G1 X-16.951 Y-11.869 Z7.519 E159.38938
+G1 X-15.852 Y-13.301 Z7.522 E159.44896
+G1 X-14.142 Y-14.142 Z7.525 E159.51183
+G1 X-12.410 Y-14.790 Z7.528 E159.57284
+G1 X-11.074 Y-15.816 Z7.531 E159.62843
+G1 X-10.000 Y-17.321 Z7.533 E159.68944
+G1 X-8.745 Y-18.754 Z7.536 E159.75232
+G1 X-7.077 Y-19.445 Z7.539 E159.81189
+G1 X-5.176 Y-19.319 Z7.542 E159.87476
+G1 X-3.353 Y-19.014 Z7.544 E159.93578
+G1 X-1.683 Y-19.234 Z7.547 E159.99136
+G1 X-0.000 Y-20.000 Z7.550 E160.05238
+G1 X1.803 Y-20.614 Z7.553 E160.11525
+G1 X3.593 Y-20.378 Z7.556 E160.17482
+G1 X5.176 Y-19.319 Z7.558 E160.23769
+G1 X6.603 Y-18.143 Z7.561 E160.29871
+G1 X8.160 Y-17.498 Z7.564 E160.35429
+G1 X10.000 Y-17.321 Z7.567 E160.41531
+G1 X11.869 Y-16.951 Z7.569 E160.47818
+G1 X13.301 Y-15.852 Z7.572 E160.53775
+G1 X14.142 Y-14.142 Z7.575 E160.60062
+G1 X14.790 Y-12.410 Z7.578 E160.66164
+G1 X15.816 Y-11.074 Z7.581 E160.71722
+G1 X17.321 Y-10.000 Z7.583 E160.77824
+G1 X18.754 Y-8.745 Z7.586 E160.84111
+G1 X19.445 Y-7.077 Z7.589 E160.90068
+G1 X19.319 Y-5.176 Z7.592 E160.96355
+G1 X19.014 Y-3.353 Z7.594 E161.02457
+G1 X19.234 Y-1.683 Z7.597 E161.08015
+G1 X20.000 Y-0.000 Z7.600 E161.14117
+G1 X20.614 Y1.803 Z7.603 E161.20404
+G1 X20.378 Y3.593 Z7.606 E161.26361
+G1 X19.319 Y5.176 Z7.608 E161.32648
+G1 X18.143 Y6.603 Z7.611 E161.38750
+G1 X17.498 Y8.160 Z7.614 E161.44308
+G1 X17.321 Y10.000 Z7.617 E161.50410
+G1 X16.951 Y11.869 Z7.619 E161.56697
+G1 X15.852 Y13.301 Z7.622 E161.62654
+G1 X14.142 Y14.142 Z7.625 E161.68941
+G1 X12.410 Y14.790 Z7.628 E161.75043
+G1 X11.074 Y15.816 Z7.631 E161.80601
+G1 X10.000 Y17.321 Z7.633 E161.86703
+G1 X8.745 Y18.754 Z7.636 E161.92990
+G1 X7.077 Y19.445 Z7.639 E161.98947
+G1 X5.176 Y19.319 Z7.642 E162.05234
+G1 X3.353 Y19.014 Z7.644 E162.11336
+G1 X1.683 Y19.234 Z7.647 E162.16894
+G1 X0.000 Y20.000 Z7.650 E162.22996
+G1 X-1.803 Y20.614 Z7.653 E162.29283
+G1 X-3.593 Y20.378 Z7.656 E162.35240
+G1 X-5.176 Y19.319 Z7.658 E162.41527
+G1 X-6.603 Y18.143 Z7.661 E162.47629
+G1 X-8.160 Y17.498 Z7.664 E162.53187
+G1 X-10.000 Y17.321 Z7.667 E162.59289
+G1 X-11.869 Y16.951 Z7.669 E162.65576
+G1 X-13.301 Y15.852 Z7.672 E162.71533
+G1 X-14.142 Y14.142 Z7.675 E162.77820
+G1 X-14.790 Y12.410 Z7.678 E162.83922
+G1 X-15.816 Y11.074 Z7.681 E162.89480
+G1 X-17.321 Y10.000 Z7.683 E162.95582
+G1 X-18.754 Y8.745 Z7.686 E163.01869
+G1 X-19.445 Y7.077 Z7.689 E163.07826
+G1 X-19.319 Y5.176 Z7.692 E163.14113
+G1 X-19.014 Y3.353 Z7.694 E163.20215
+G1 X-19.234 Y1.683 Z7.697 E163.25773
+G1 X-20.000 Y-0.000 Z7.700 E163.31875
+G1 X-20.614 Y-1.803 Z7.703 E163.38162
+G1 X-20.378 Y-3.593 Z7.706 E163.44119
+G1 X-19.319 Y-5.176 Z7.708 E163.50406
+G1 X-18.143 Y-6.603 Z7.711 E163.56508
+G1 X-17.498 Y-8.160 Z7.714 E163.62066
+G1 X-17.321 Y-10.000 Z7.717 E163.68168
+G1 X-16.951 Y-11.869 Z7.719 E163.74455
+G1 X-15.852 Y-13.301 Z7.722 E163.80412
+G1 X-14.142 Y-14.142 Z7.725 E163.86699
+G1 X-12.410 Y-14.790 Z7.728 E163.92801
+G1 X-11.074 Y-15.816 Z7.731 E163.98359
+G1 X-10.000 Y-17.321 Z7.733 E164.04461
+G1 X-8.745 Y-18.754 Z7.736 E164.10748
+G1 X-7.077 Y-19.445 Z7.739 E164.16705
+G1 X-5.176 Y-19.319 Z7.742 E164.22993
+G1 X-3.353 Y-19.014 Z7.744 E164.29094
+G1 X-1.683 Y-19.234 Z7.747 E164.34653
+G1 X-0.000 Y-20.000 Z7.750 E164.40754
+G1 X1.803 Y-20.614 Z7.753 E164.47041
+G1 X3.593 Y-20.378 Z7.756 E164.52998
+G1 X5.176 Y-19.319 Z7.758 E164.59286
+G1 X6.603 Y-18.143 Z7.761 E164.65387
+G1 X8.160 Y-17.498 Z7.764 E164.70946
+G1 X10.000 Y-17.321 Z7.767 E164.77047
+G1 X11.869 Y-16.951 Z7.769 E164.83334
+G1 X13.301 Y-15.852 Z7.772 E164.89292
+G1 X14.142 Y-14.142 Z7.775 E164.95579
+G1 X14.790 Y-12.410 Z7.778 E165.01680
+G1 X15.816 Y-11.074 Z7.781 E165.07239
+G1 X17.321 Y-10.000 Z7.783 E165.13340
+G1 X18.754 Y-8.745 Z7.786 E165.19627
+G1 X19.445 Y-7.077 Z7.789 E165.25585
+G1 X19.319 Y-5.176 Z7.792 E165.31872
+G1 X19.014 Y-3.353 Z7.794 E165.37973
+G1 X19.234 Y-1.683 Z7.797 E165.43532
+G1 X20.000 Y-0.000 Z7.800 E165.49633
+G1 X20.614 Y1.803 Z7.803 E165.55920
+G1 X20.378 Y3.593 Z7.806 E165.61878
+G1 X19.319 Y5.176 Z7.808 E165.68165
+G1 X18.143 Y6.603 Z7.811 E165.74266
+G1 X17.498 Y8.160 Z7.814 E165.79825
+G1 X17.321 Y10.000 Z7.817 E165.85926
+G1 X16.951 Y11.869 Z7.819 E165.92214
+G1 X15.852 Y13.301 Z7.822 E165.98171
+G1 X14.142 Y14.142 Z7.825 E166.04458
+G1 X12.410 Y14.790 Z7.828 E166.10559
+G1 X11.074 Y15.816 Z7.831 E166.16118
+G1 X10.000 Y17.321 Z7.833 E166.22219
+G1 X8.745 Y18.754 Z7.836 E166.28507
+G1 X7.077 Y19.445 Z7.839 E166.34464
+G1 X5.176 Y19.319 Z7.842 E166.40751
+G1 X3.353 Y19.014 Z7.844 E166.46853
+G1 X1.683 Y19.234 Z7.847 E166.52411
+G1 X0.000 Y20.000 Z7.850 E166.58513
+G1 X-1.803 Y20.614 Z7.853 E166.64800
+G1 X-3.593 Y20.378 Z7.856 E166.70757
+G1 X-5.176 Y19.319 Z7.858 E166.77044
+G1 X-6.603 Y18.143 Z7.861 E166.83146
+G1 X-8.160 Y17.498 Z7.864 E166.88704
+G1 X-10.000 Y17.321 Z7.867 E166.94806
+G1 X-11.869 Y16.951 Z7.869 E167.01093
+G1 X-13.301 Y15.852 Z7.872 E167.07050
+G1 X-14.142 Y14.142 Z7.875 E167.13337
+G1 X-14.790 Y12.410 Z7.878 E167.19439
+G1 X-15.816 Y11.074 Z7.881 E167.24997
+G1 X-17.321 Y10.000 Z7.883 E167.31099
+G1 X-18.754 Y8.745 Z7.886 E167.37386
+G1 X-19.445 Y7.077 Z7.889 E167.43343
+G1 X-19.319 Y5.176 Z7.892 E167.49630
+G1 X-19.014 Y3.353 Z7.894 E167.55732
+G1 X-19.234 Y1.683 Z7.897 E167.61290
+G1 X-20.000 Y0.000 Z7.900 E167.67392
+G1 X-20.614 Y-1.803 Z7.903 E167.73679
+G1 X-20.378 Y-3.593 Z7.906 E167.79636
+G1 X-19.319 Y-5.176 Z7.908 E167.85923
+G1 X-18.143 Y-6.603 Z7.911 E167.92025
+G1 X-17.498 Y-8.160 Z7.914 E167.97583
+G1 X-17.321 Y-10.000 Z7.917 E168.03685
+G1 X-16.951 Y-11.869 Z7.919 E168.09972
+G1 X-15.852 Y-13.301 Z7.922 E168.15929
+G1 X-14.142 Y-14.142 Z7.925 E168.22216
+G1 X-12.410 Y-14.790 Z7.928 E168.28318
+G1 X-11.074 Y-15.816 Z7.931 E168.33876
+G1 X-10.000 Y-17.321 Z7.933 E168.39978
+G1 X-8.745 Y-18.754 Z7.936 E168.46265
+G1 X-7.077 Y-19.445 Z7.939 E168.52222
+G1 X-5.176 Y-19.319 Z7.942 E168.58509
+G1 X-3.353 Y-19.014 Z7.944 E168.64611
+G1 X-1.683 Y-19.234 Z7.947 E168.70169
+G1 X-0.000 Y-20.000 Z7.950 E168.76271
+G1 X1.803 Y-20.614 Z7.953 E168.82558
+G1 X3.593 Y-20.378 Z7.956 E168.88515
+G1 X5.176 Y-19.319 Z7.958 E168.94802
+G1 X6.603 Y-18.143 Z7.961 E169.00904
+G1 X8.160 Y-17.498 Z7.964 E169.06462
+G1 X10.000 Y-17.321 Z7.967 E169.12564
+G1 X11.869 Y-16.951 Z7.969 E169.18851
+G1 X13.301 Y-15.852 Z7.972 E169.24808
+G1 X14.142 Y-14.142 Z7.975 E169.31095
+G1 X14.790 Y-12.410 Z7.978 E169.37197
+G1 X15.816 Y-11.074 Z7.981 E169.42755
+G1 X17.321 Y-10.000 Z7.983 E169.48857
+G1 X18.754 Y-8.745 Z7.986 E169.55144
+G1 X19.445 Y-7.077 Z7.989 E169.61101
+G1 X19.319 Y-5.176 Z7.992 E169.67388
+G1 X19.014 Y-3.353 Z7.994 E169.73490
+G1 X19.234 Y-1.683 Z7.997 E169.79048
+G1 X20.000 Y-0.000 Z8.000 E169.85150
+G1 X20.614 Y1.803 Z8.003 E169.91437
+G1 X20.378 Y3.593 Z8.006 E169.97394
+G1 X19.319 Y5.176 Z8.008 E170.03681
+G1 X18.143 Y6.603 Z8.011 E170.09783
+G1 X17.498 Y8.160 Z8.014 E170.15341
+G1 X17.321 Y10.000 Z8.017 E170.21443
+G1 X16.951 Y11.869 Z8.019 E170.27730
+G1 X15.852 Y13.301 Z8.022 E170.33687
+G1 X14.142 Y14.142 Z8.025 E170.39974
+G1 X12.410 Y14.790 Z8.028 E170.46076
+G1 X11.074 Y15.816 Z8.031 E170.51634
+G1 X10.000 Y17.321 Z8.033 E170.57736
+G1 X8.745 Y18.754 Z8.036 E170.64023
+G1 X7.077 Y19.445 Z8.039 E170.69980
+G1 X5.176 Y19.319 Z8.042 E170.76268
+G1 X3.353 Y19.014 Z8.044 E170.82369
+G1 X1.683 Y19.234 Z8.047 E170.87928
+G1 X-0.000 Y20.000 Z8.050 E170.94029
+G1 X-1.803 Y20.614 Z8.053 E171.00316
+G1 X-3.593 Y20.378 Z8.056 E171.06273
+G1 X-5.176 Y19.319 Z8.058 E171.12561
+G1 X-6.603 Y18.143 Z8.061 E171.18662
+G1 X-8.160 Y17.498 Z8.064 E171.24221
+G1 X-10.000 Y17.321 Z8.067 E171.30322
+G1 X-11.869 Y16.951 Z8.069 E171.36609
+G1 X-13.301 Y15.852 Z8.072 E171.42567
+G1 X-14.142 Y14.142 Z8.075 E171.48854
+G1 X-14.790 Y12.410 Z8.078 E171.54955
+G1 X-15.816 Y11.074 Z8.081 E171.60514
+G1 X-17.321 Y10.000 Z8.083 E171.66615
+G1 X-18.754 Y8.745 Z8.086 E171.72902
+G1 X-19.445 Y7.077 Z8.089 E171.78860
+G1 X-19.319 Y5.176 Z8.092 E171.85147
+G1 X-19.014 Y3.353 Z8.094 E171.91248
+G1 X-19.234 Y1.683 Z8.097 E171.96807
+G1 X-20.000 Y0.000 Z8.100 E172.02908
+G1 X-20.614 Y-1.803 Z8.103 E172.09195
+G1 X-20.378 Y-3.593 Z8.106 E172.15153
+G1 X-19.319 Y-5.176 Z8.108 E172.21440
+G1 X-18.143 Y-6.603 Z8.111 E172.27541
+G1 X-17.498 Y-8.160 Z8.114 E172.33100
+G1 X-17.321 Y-10.000 Z8.117 E172.39201
+G1 X-16.951 Y-11.869 Z8.119 E172.45489
+G1 X-15.852 Y-13.301 Z8.122 E172.51446
+G1 X-14.142 Y-14.142 Z8.125 E172.57733
+G1 X-12.410 Y-14.790 Z8.128 E172.63834
+G1 X-11.074 Y-15.816 Z8.131 E172.69393
+G1 X-10.000 Y-17.321 Z8.133 E172.75494
+G1 X-8.745 Y-18.754 Z8.136 E172.81782
+G1 X-7.077 Y-19.445 Z8.139 E172.87739
+G1 X-5.176 Y-19.319 Z8.142 E172.94026
+G1 X-3.353 Y-19.014 Z8.144 E173.00128
+G1 X-1.683 Y-19.234 Z8.147 E173.05686
+G1 X-0.000 Y-20.000 Z8.150 E173.11788
+G1 X1.803 Y-20.614 Z8.153 E173.18075
+G1 X3.593 Y-20.378 Z8.156 E173.24032
+G1 X5.176 Y-19.319 Z8.158 E173.30319
+G1 X6.603 Y-18.143 Z8.161 E173.36421
+G1 X8.160 Y-17.498 Z8.164 E173.41979
+G1 X10.000 Y-17.321 Z8.167 E173.48081
+G1 X11.869 Y-16.951 Z8.169 E173.54368
+G1 X13.301 Y-15.852 Z8.172 E173.60325
+G1 X14.142 Y-14.142 Z8.175 E173.66612
+G1 X14.790 Y-12.410 Z8.178 E173.72714
+G1 X15.816 Y-11.074 Z8.181 E173.78272
+G1 X17.321 Y-10.000 Z8.183 E173.84374
+G1 X18.754 Y-8.745 Z8.186 E173.90661
+G1 X19.445 Y-7.077 Z8.189 E173.96618
+G1 X19.319 Y-5.176 Z8.192 E174.02905
+G1 X19.014 Y-3.353 Z8.194 E174.09007
+G1 X19.234 Y-1.683 Z8.197 E174.14565
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Writes the gcode files in corpus/ that the benchmarks run, they are checked in so every run uses the same ones.
+
+All of them stay within 30mm of the origin so they fit the cartesian, delta and scara bench configs.
+Run it again after changing it, and say so when comparing results from before and after.
+"""
+
+import math
+import os
+
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'corpus')
+
+
+def write(name, header, lines):
+    with open(os.path.join(OUT, name), 'w') as f:
+        f.write('; %s\n' % header)
+        f.write('; generated by make_corpus.py\n')
+        f.write('G21\nG90\n')
+        for l in lines:
+            f.write(l + '\n')
+
+
+def surfacing():
+    """CNC finishing pass over a wavy surface, zigzag rows of short XYZ moves"""
+    lines = ['G0 Z5', 'G0 X-30 Y-30', 'G1 Z0 F600', 'G1 F3000']
+    step = 1.0
+    n = int(60 / step)
+    for row in range(50):
+        y = -30 + row * 1.2
+        cols = range(n + 1) if row % 2 == 0 else range(n, -1, -1)
+        for c in cols:
+            x = -30 + c * step
+            z = 1.5 * math.sin(x / 6.0) * math.cos(y / 9.0)
+            lines.append('G1 X%.3f Y%.3f Z%.3f' % (x, y, z))
+    lines.append('G0 Z5')
+    return lines
+
+
+def raster():
+    """laser engraving of a grey scale image, one G1 per pixel with its power"""
+    lines = ['G0 X-10 Y-5', 'M3', 'G1 F6000']
+    pixel = 0.25
+    width = 80
+    for row in range(40):
+        y = -5 + row * pixel
+        lines.append('G0 X%.3f Y%.3f' % (-10 if row % 2 == 0 else -10 + width * pixel, y))
+        cols = range(width) if row % 2 == 0 else range(width - 1, -1, -1)
+        for c in cols:
+            x = -10 + (c + (1 if row % 2 == 0 else 0)) * pixel
+            s = 0.5 + 0.5 * math.sin(c / 7.0) * math.cos(row / 5.0)
+            lines.append('G1 X%.3f S%.2f' % (x, s))
+    lines.append('M5')
+    return lines
+
+
+def vase():
+    """spiral vase mode, a continuous climb around a ribbed cylinder with extrusion"""
+    lines = ['G0 X20 Y0 Z0.2', 'G92 E0', 'G1 F2400']
+    per_layer = 72
+    layer = 0.2
+    e = 0.0
+    px, py = 20.0, 0.0
+    for i in range(per_layer * 40):
+        a = 2 * math.pi * i / per_layer
+        r = 20 + 0.8 * math.sin(a * 12)
+        x, y = r * math.cos(a), r * math.sin(a)
+        z = 0.2 + layer * i / per_layer
+        e += math.hypot(x - px, y - py) * 0.033
+        px, py = x, y
+        lines.append('G1 X%.3f Y%.3f Z%.3f E%.5f' % (x, y, z, e))
+    return lines
+
+
+def arcs():
+    """G2 and G3 arcs of all sizes, each one is cut into segments by the Robot"""
+    lines = ['G0 X0 Y0', 'G1 F4800']
+    x, y = 0.0, 0.0
+    for i in range(400):
+        r = 0.5 + (i * 7 % 25)
+        a = (i * 37 % 360) * math.pi / 180
+        sweep = (30 + i * 53 % 300) * math.pi / 180
+        cw = i % 2 == 0
+        # the centre is r away from the current point in direction a
+        cx, cy = x + r * math.cos(a), y + r * math.sin(a)
+        start = math.atan2(y - cy, x - cx)
+        end = start - sweep if cw else start + sweep
+        ex, ey = cx + r * math.cos(end), cy + r * math.sin(end)
+        if math.hypot(ex, ey) > 28:
+            # head back towards the middle
+            lines.append('G1 X%.3f Y%.3f' % (x * 0.2, y * 0.2))
+            x, y = x * 0.2, y * 0.2
+            continue
+        lines.append('%s X%.3f Y%.3f I%.3f J%.3f' % ('G2' if cw else 'G3', ex, ey, cx - x, cy - y))
+        x, y = ex, ey
+    return lines
+
+
+if __name__ == '__main__':
+    os.makedirs(OUT, exist_ok=True)
+    write('surfacing.gcode', 'dense surfacing', surfacing())
+    write('raster.gcode', 'laser raster', raster())
+    write('vase.gcode', 'vase mode', vase())
+    write('arcs.gcode', 'arcs', arcs())
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Runs the host benchmarks, every corpus/*.gcode on every *.config here, and writes one line of JSON per run.
+
+    run.py [-r repeat] [-f] [-o results.jsonl] [-c old.jsonl]
+
+Each one is run repeat times (default 3) and the fastest of the timings is kept, the host is never quieter than
+its best run. With -c the results are compared with an earlier file, for each benchmark the change in the
+timings is printed as a percentage, negative is faster. The motion results have to be exactly the same, any
+difference in the steps, positions or motion time is printed as well, as that means the motion changed.
+With -f every step is also checked against the plan, and the compare prints any change in how far off they were.
+Run it from src/testframework/host after make.
+"""
+
+import argparse
+import glob
+import json
+import os
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+MOTIONSIM = os.path.join(HERE, '..', 'build', 'motionsim')
+
+# timings where the lowest of the runs is kept, path into the result and whether higher is better
+TIMINGS = [
+    ('segments_per_second', True),
+    ('append_block.ns_per_call', False),
+    ('calculate_trapezoid.ns_per_call', False),
+    ('update_trapezoid.ns_per_call', False),
+    ('step_tick.ns_per_busy_tick', False),
+]
+# these are the same every run unless the motion code changed
+MOTION = ['motion_seconds', 'segments', 'step_tick.ticks', 'step_tick.steps', 'actuator_steps']
+
+
+def get(r, path):
+    for p in path.split('.'):
+        r = r[p]
+    return r
+
+
+def put(r, path, v):
+    ps = path.split('.')
+    for p in ps[:-1]:
+        r = r[p]
+    r[ps[-1]] = v
+
+
+# fidelity results compared with -f, the worst of the motors
+FIDELITY = ['position_error_steps', 'timing_error_us', 'jitter_us', 'measured_junction_mm_s', 'count_errors', 'direction_errors']
+
+
+def run(name, config, gcode, repeat, verify):
+    best = None
+    for _ in range(repeat):
+        out = subprocess.run([MOTIONSIM, '-j', '-n', name, '-c', config, gcode] + (['-f'] if verify else []), stdout=subprocess.PIPE, check=True,
+                             universal_newlines=True).stdout
+        r = json.loads(out.splitlines()[-1])
+        if best is None:
+            best = r
+            continue
+        for path, higher in TIMINGS:
+            v = get(r, path)
+            if (v > get(best, path)) == higher and v != 0:
+                put(best, path, v)
+        # the per motor costs are kept from the run with the fastest tick
+        if get(r, 'step_tick.ns_per_busy_tick') <= get(best, 'step_tick.ns_per_busy_tick'):
+            best['step_tick']['ns_by_moving_motors'] = r['step_tick']['ns_by_moving_motors']
+    return best
+
+
+def load(file):
+    old = {}
+    with open(file) as f:
+        for l in f:
+            r = json.loads(l)
+            old[r['name']] = r
+    return old
+
+
+def compare(old, results):
+    for r in results:
+        o = old.get(r['name'])
+        if o is None:
+            print('%-24s new' % r['name'])
+            continue
+        changes = []
+        for path, higher in TIMINGS:
+            a, b = get(o, path), get(r, path)
+            if a == 0 or b == 0:
+                continue
+            # always as the change in time taken, negative is faster
+            pct = (a / b - 1) * 100 if higher else (b / a - 1) * 100
+            changes.append('%s %+.1f%%' % (path, pct))
+        print('%-24s %s' % (r['name'], ', '.join(changes)))
+        for path in MOTION:
+            if get(o, path) != get(r, path):
+                print('%-24s MOTION CHANGED %s %s -> %s' % ('', path, get(o, path), get(r, path)))
+        if 'fidelity' in o and 'fidelity' in r:
+            for k in FIDELITY:
+                a, b = max(o['fidelity'][k]), max(r['fidelity'][k])
+                if abs(a - b) > 1e-3 * max(abs(a), 1):
+                    print('%-24s fidelity %s %g -> %g' % ('', k, a, b))
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('-r', '--repeat', type=int, default=3)
+    ap.add_argument('-f', '--verify', action='store_true')
+    ap.add_argument('-o', '--output')
+    ap.add_argument('-c', '--compare')
+    args = ap.parse_args()
+    # read first, it may be the file about to be written
+    old = load(args.compare) if args.compare else None
+
+    results = []
+    for config in sorted(glob.glob(os.path.join(HERE, '*.config'))):
+        for gcode in sorted(glob.glob(os.path.join(HERE, 'corpus', '*.gcode'))):
+            name = '%s/%s' % (os.path.splitext(os.path.basename(config))[0], os.path.splitext(os.path.basename(gcode))[0])
+            r = run(name, os.path.relpath(config), os.path.relpath(gcode), args.repeat, args.verify)
+            results.append(r)
+            sys.stderr.write('%-24s %8.0f segments/s  append_block %6.0fns  step_tick %5.1fns\n' % (
+                name, r['segments_per_second'], r['append_block']['ns_per_call'], r['step_tick']['ns_per_busy_tick']))
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    for r in results:
+        out.write(json.dumps(r) + '\n')
+    if args.output:
+        out.close()
+
+    if old is not None:
+        compare(old, results)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,266 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Times the Gcode parser and the line handling of GcodeDispatch on the PC, and checks them on random lines.
+//
+//   gcodebench -c config [-r repeats] [-n lines] [-s seed]
+//
+// The properties are checked first, any that fail are printed and it exits with 1 before timing anything.
+// Then each shape in GcodeLines.h is timed being made into a Gcode and having the letters of a move looked up,
+// and a line with no module acting on it is timed through GcodeDispatch with and without a line number, checksum
+// and comment, which includes the event going to the modules of the host build. The fastest of the repeats is
+// printed in ns per line. The unit test TEST_gcodeparser.cpp times the same shapes in cycles on the board.
+
+#include "HostKernel.h"
+#include "MotionSimulator.h"
+#include "../GcodeLines.h"
+
+#include "libs/Kernel.h"
+#include "libs/Module.h"
+#include "libs/StreamOutput.h"
+#include "modules/communication/GcodeDispatch.h"
+#include "modules/communication/utils/Gcode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include <functional>
+
+// no module acts on this, and what is made of random lines is never a move
+#define UNUSED_MCODE 9100
+
+// keeps the last reply
+class LastReply : public StreamOutput {
+    public:
+        int puts(const char *s)
+        {
+            last= s;
+            return strlen(s);
+        }
+        std::string last;
+};
+
+// keeps a copy of the last Gcode dispatched
+class Capture : public Module {
+    public:
+        Capture() : gcode(nullptr), count(0) {}
+        void on_module_loaded() { register_for_event(ON_GCODE_RECEIVED); }
+        void on_gcode_received(void *argument)
+        {
+            delete gcode;
+            gcode= new Gcode(*static_cast<Gcode *>(argument));
+            ++count;
+        }
+        Gcode *gcode;
+        uint32_t count;
+};
+
+static double host_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int checksum(const std::string &s)
+{
+    int cs= 0;
+    for (char c : s) cs ^= c;
+    return cs & 0xff;
+}
+
+static std::string numbered(int n, const std::string &line)
+{
+    std::string s= "N" + std::to_string(n) + " " + line;
+    return s + "*" + std::to_string(checksum(s));
+}
+
+static uint32_t failures= 0;
+
+static void fail(const char *what, const std::string &line)
+{
+    if(++failures <= 20) printf("FAIL %s: %s\n", what, line.c_str());
+}
+
+// what GcodeDispatch passes on has the values of the line without its number, checksum or comment
+static void check_dispatched(const Capture &cap, uint32_t before, const gcode_expect_t &e, const std::string &line)
+{
+    if(cap.count != before + 1 || cap.gcode == nullptr) {
+        fail("not dispatched", line);
+        return;
+    }
+    const Gcode &gc= *cap.gcode;
+    if(!gc.has_m || gc.m != e.code || gc.subcode != e.subcode) fail("code", line);
+    if(gc.get_num_args() != e.args) fail("number of arguments", line);
+    for (char c = 'A'; c <= 'Z'; ++c) {
+        if(c == 'G' || c == 'M') continue;
+        bool has= (e.letters & (1 << (c - 'A'))) != 0;
+        if(gc.has_letter(c) != has) fail("letter", line);
+        else if(has && gc.get_value(c) != e.values[c - 'A']) fail("value", line);
+    }
+}
+
+static void check_properties(GcodeDispatch *dispatch, Capture &cap, uint32_t seed, int lines)
+{
+    LastReply reply;
+    int ln= 0;
+    dispatch->dispatch("N-1 M110", 8, &reply);
+
+    for (int i = 0; i < lines; ++i) {
+        gcode_expect_t e;
+        std::string line= gcode_random_line(seed, e, UNUSED_MCODE);
+
+        // a Gcode made from the line parses the way it was made, and its letter table agrees with scanning for them
+        Gcode gc(line, nullptr);
+        if(gc.has_m != !e.is_g || (e.is_g ? gc.g : gc.m) != e.code || gc.subcode != e.subcode) fail("Gcode code", line);
+        for (char c = 'A'; c <= 'Z'; ++c) {
+            if(c == 'G' || c == 'M' || !gc.has_letter(c)) continue;
+            char *p;
+            if(gc.get_value(c) != gc.get_value(c, &p)) fail("Gcode table and scan", line);
+        }
+
+        std::string comment= " ; comment with X1 Y2 in it";
+        uint32_t before= cap.count;
+        std::string s;
+        switch(i % 5) {
+            case 0: s= line; break;
+            case 1: s= line + comment; break;
+            case 2: s= numbered(ln++, line); break;
+            case 3: s= numbered(ln++, line + comment); break;
+            case 4:
+                // a bad checksum is not dispatched and asks for the same line again
+                s= numbered(ln, line);
+                s.back()= s.back() == '0' ? '1' : '0';
+                dispatch->dispatch(s.data(), s.size(), &reply);
+                if(cap.count != before) fail("dispatched with a bad checksum", s);
+                if(reply.last != "rs N" + std::to_string(ln) + "\r\n") fail("no resend", s);
+                continue;
+        }
+        dispatch->dispatch(s.data(), s.size(), &reply);
+        check_dispatched(cap, before, e, s);
+        if(reply.last.compare(0, 2, "ok") != 0) fail("no ok", s);
+    }
+}
+
+// the fastest of the repeats of running fnc n times, in ns each
+template<typename F> static double time_ns(int repeats, int n, F fnc)
+{
+    double best= 0;
+    for (int r = 0; r < repeats; ++r) {
+        double start= host_ns();
+        for (int i = 0; i < n; ++i) fnc(i);
+        double t= (host_ns() - start) / n;
+        if(r == 0 || t < best) best= t;
+    }
+    return best;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: gcodebench -c config [-r repeats] [-n lines] [-s seed]\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_file= nullptr;
+    int repeats= 5;
+    int lines= 100000;
+    uint32_t seed= 1;
+
+    int c;
+    while((c= getopt(argc, argv, "c:r:n:s:")) != -1) {
+        switch(c) {
+            case 'c': config_file= optarg; break;
+            case 'r': repeats= atoi(optarg); break;
+            case 'n': lines= atoi(optarg); break;
+            case 's': seed= strtoul(optarg, nullptr, 10); break;
+            default: usage();
+        }
+    }
+    if(config_file == nullptr || repeats < 1 || lines < 1) usage();
+
+    FILE *fp= fopen(config_file, "r");
+    if(fp == nullptr) {
+        fprintf(stderr, "can not read %s\n", config_file);
+        return 1;
+    }
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) host_config.append(buf, n);
+    fclose(fp);
+
+    MotionSimulator *sim= new MotionSimulator();
+    new Kernel();
+    THEKERNEL->add_module(sim);
+    Capture cap;
+    THEKERNEL->add_module(&cap);
+    GcodeDispatch *dispatch= THEKERNEL->gcode_dispatch;
+
+    check_properties(dispatch, cap, seed, lines);
+    if(failures > 0) {
+        printf("%lu of %d random lines failed\n", (unsigned long)failures, lines);
+        return 1;
+    }
+    printf("%d random lines passed\n", lines);
+
+    volatile float sink= 0;
+    printf("ns per line         construct  lookup %s\n", gcode_lookup_letters);
+    for (int i = 0; i < gcode_line_shape_count; ++i) {
+        const char *line= gcode_line_shapes[i].line;
+        size_t len= strlen(line);
+        double construct= time_ns(repeats, lines, [&](int) {
+            Gcode *gc= new Gcode(line, len, nullptr);
+            delete gc;
+        });
+        Gcode gc(line, nullptr);
+        double lookup= time_ns(repeats, lines, [&](int) {
+            for (const char *l = gcode_lookup_letters; *l; ++l) {
+                if(gc.has_letter(*l)) sink= sink + gc.get_value(*l);
+            }
+        });
+        printf("  %-16s %10.1f %7.1f\n", gcode_line_shapes[i].name, construct, lookup);
+    }
+
+    // the line numbers have to follow on, so the numbered lines are made first and it starts again at each repeat
+    const std::string move= "M9100 X123.456 Y-78.901 E1.23456 F3000";
+    const std::string comment= move + " ; perimeter";
+    std::vector<std::string> with_number, with_both;
+    for (int i = 0; i < lines; ++i) {
+        with_number.push_back(numbered(i, move));
+        with_both.push_back(numbered(i, comment));
+    }
+    struct {
+        const char *name;
+        std::function<const std::string&(int)> line;
+    } forms[]= {
+        {"plain",    [&](int) -> const std::string& { return move; }},
+        {"comment",  [&](int) -> const std::string& { return comment; }},
+        {"numbered", [&](int i) -> const std::string& { return with_number[i]; }},
+        {"both",     [&](int i) -> const std::string& { return with_both[i]; }},
+    };
+
+    printf("ns per line         dispatch\n");
+    for (auto &f : forms) {
+        double best= 0;
+        for (int r = 0; r < repeats; ++r) {
+            dispatch->dispatch("N-1 M110", 8, &StreamOutput::NullStream);
+            double t= time_ns(1, lines, [&](int i) {
+                const std::string &s= f.line(i);
+                dispatch->dispatch(s.data(), s.size(), &StreamOutput::NullStream);
+            });
+            if(r == 0 || t < best) best= t;
+        }
+        printf("  %-16s %10.1f\n", f.name, best);
+    }
+
+    return 0;
+}
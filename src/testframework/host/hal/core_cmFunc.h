@@ -0,0 +1,39 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host versions of the Cortex-M3 core register intrinsics for the host build.
+// The simulated interrupts are only run from the main thread between calls, so masking them just has to be remembered
+
+#ifndef __CORE_CMFUNC_H
+#define __CORE_CMFUNC_H
+
+#include <stdint.h>
+
+extern uint32_t host_primask;
+extern uint32_t host_basepri;
+
+static inline void __enable_irq(void) { host_primask= 0; }
+static inline void __disable_irq(void) { host_primask= 1; }
+static inline uint32_t __get_PRIMASK(void) { return host_primask; }
+static inline void __set_PRIMASK(uint32_t priMask) { host_primask= priMask; }
+static inline uint32_t __get_BASEPRI(void) { return host_basepri; }
+static inline void __set_BASEPRI(uint32_t value) { host_basepri= value; }
+static inline void __enable_fault_irq(void) {}
+static inline void __disable_fault_irq(void) {}
+static inline uint32_t __get_FAULTMASK(void) { return 0; }
+static inline void __set_FAULTMASK(uint32_t) {}
+static inline uint32_t __get_CONTROL(void) { return 0; }
+static inline void __set_CONTROL(uint32_t) {}
+static inline uint32_t __get_IPSR(void) { return 0; } // always thread mode
+static inline uint32_t __get_APSR(void) { return 0; }
+static inline uint32_t __get_xPSR(void) { return 0; }
+static inline uint32_t __get_PSP(void) { return 0; }
+static inline void __set_PSP(uint32_t) {}
+static inline uint32_t __get_MSP(void) { return 0; }
+static inline void __set_MSP(uint32_t) {}
+
+#endif
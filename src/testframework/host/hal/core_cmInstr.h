@@ -0,0 +1,43 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host versions of the Cortex-M3 instruction intrinsics for the host build, nothing runs concurrently so the
+// barriers are only compiler barriers and the exclusive stores always succeed
+
+#ifndef __CORE_CMINSTR_H
+#define __CORE_CMINSTR_H
+
+#include <stdint.h>
+
+static inline void __NOP(void) {}
+static inline void __WFI(void) {}
+static inline void __WFE(void) {}
+static inline void __SEV(void) {}
+static inline void __ISB(void) { __asm__ volatile("" ::: "memory"); }
+static inline void __DSB(void) { __asm__ volatile("" ::: "memory"); }
+static inline void __DMB(void) { __asm__ volatile("" ::: "memory"); }
+
+static inline uint32_t __REV(uint32_t value) { return __builtin_bswap32(value); }
+static inline uint32_t __REV16(uint32_t value) { return ((value & 0xFF00FF00UL) >> 8) | ((value & 0x00FF00FFUL) << 8); }
+static inline int32_t __REVSH(int32_t value) { return (int16_t)__builtin_bswap16(value); }
+static inline uint32_t __RBIT(uint32_t value)
+{
+    uint32_t r= 0;
+    for (int i = 0; i < 32; ++i) r |= ((value >> i) & 1) << (31 - i);
+    return r;
+}
+static inline uint8_t __CLZ(uint32_t value) { return value == 0 ? 32 : __builtin_clz(value); }
+
+static inline uint8_t __LDREXB(volatile uint8_t *addr) { return *addr; }
+static inline uint16_t __LDREXH(volatile uint16_t *addr) { return *addr; }
+static inline uint32_t __LDREXW(volatile uint32_t *addr) { return *addr; }
+static inline uint32_t __STREXB(uint8_t value, volatile uint8_t *addr) { *addr= value; return 0; }
+static inline uint32_t __STREXH(uint16_t value, volatile uint16_t *addr) { *addr= value; return 0; }
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t *addr) { *addr= value; return 0; }
+static inline void __CLREX(void) {}
+
+#endif
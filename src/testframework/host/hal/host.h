@@ -0,0 +1,23 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Included before every file of the host build by the makefile.
+// The mbed LPC17xx.h is used in place of the smoothed one in libs/LPC17xx as its core header takes the intrinsics
+// from core_cmInstr.h and core_cmFunc.h, which are replaced by the host versions next to this file.
+// The peripheral registers are left at their real addresses, HostHal.cpp maps memory there before anything runs.
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stddef.h> // newlib gets size_t into everything that includes a standard header, glibc does not
+
+#define __CM3_CORE_H__ // smoothie's copy of the core header, it is ARM only
+#include "LPC17xx.h"
+
+#define __debugbreak() __builtin_trap() // in place of the bkpt in mri.h
+
+#endif
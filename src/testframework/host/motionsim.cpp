@@ -0,0 +1,375 @@
+/*
+      This file is part of Smoothie (http://smoothieware.org/). The motion control part is heavily based on Grbl (https://github.com/simen/grbl).
+      Smoothie is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+      Smoothie is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+      You should have received a copy of the GNU General Public License along with Smoothie. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Replays gcode files through the motion pipeline of the host build and reports how long the motion took in
+// virtual time, how long it took the host to plan and step it, and where each actuator ended up.
+//
+//   motionsim -c config [-i idle_us] [-v] [-f] [-j] [-n name] [-p plan.bin] file.gcode...
+//   motionsim -c config [-i idle_us] [-f] [-j] [-n name] -r plan.bin
+//
+// The config is the same as for the board, anything for modules that are not in the host build is ignored.
+// -i is how much virtual time passes each time the firmware idles, the default is 100us
+// -v echoes everything the firmware replies
+// -f checks every step against the planned trapezoids and reports how far off they were, see StepVerifier.h
+// -j reports as a single line of JSON, for the benchmarks, with -n as its name
+// -p writes the planned blocks for the board to run as they are, fast-stream.py -p sends them, see PlanWriter.h
+// -r runs such a plan instead of gcode, the way the board does, so it can be checked to give the same motion
+
+#include "HostKernel.h"
+#include "MotionSimulator.h"
+#include "Probe.h"
+#include "StepVerifier.h"
+#include "PlanWriter.h"
+
+#include "libs/Kernel.h"
+#include "libs/SerialMessage.h"
+#include "libs/StreamOutput.h"
+#include "libs/StepperMotor.h"
+#include "libs/StepTicker.h"
+#include "modules/robot/Robot.h"
+#include "modules/robot/Conveyor.h"
+#include "modules/robot/Planner.h"
+#include "libs/USBDevice/USBSerial/USBSerial.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+
+// counts the oks and errors sent back for the lines
+class ReplyStream : public StreamOutput {
+    public:
+        ReplyStream(bool echo) : echo(echo), oks(0), errors(0) {}
+        int puts(const char *s)
+        {
+            if(strncmp(s, "ok", 2) == 0) ++oks;
+            else if(strncmp(s, "error", 5) == 0 || strncmp(s, "!!", 2) == 0) ++errors;
+            if(echo || strncmp(s, "error", 5) == 0) fputs(s, stdout);
+            return strlen(s);
+        }
+        bool echo;
+        uint32_t oks;
+        uint32_t errors;
+};
+
+static bool read_file(const char *fn, std::string &s)
+{
+    FILE *fp= fopen(fn, "r");
+    if(fp == nullptr) return false;
+    char buf[4096];
+    size_t n;
+    while((n= fread(buf, 1, sizeof(buf), fp)) > 0) s.append(buf, n);
+    fclose(fp);
+    return true;
+}
+
+// feeds the frames motionsim -p wrote to the planner the way USBSerial does, returns the number run or -1 if one was bad
+static int run_plan(const char *fn)
+{
+    FILE *fp= fopen(fn, "rb");
+    if(fp == nullptr) return -1;
+
+    int n= 0;
+    int c;
+    uint8_t f[3 + USBSERIAL_PLANNED_SIZE + 8 * 4 + 2];
+    while((c= fgetc(fp)) == USBSERIAL_BINARY_SYNC && fread(f, 1, 3, fp) == 3) {
+        size_t len= (f[1] == 2 ? USBSERIAL_PLANNED_SIZE : 0) + 4 * __builtin_popcount(f[2]);
+        if(fread(&f[3], 1, len + 2, fp) != len + 2) break;
+        const uint8_t *p= &f[3];
+
+        if(f[1] == 3) {
+            float frequency;
+            memcpy(&frequency, p, 4);
+            if(fabsf(frequency - StepTicker::getInstance()->get_frequency()) > 0.5F) break;
+
+        } else if(f[1] == 4) {
+            THECONVEYOR->wait_for_idle();
+            THEROBOT->reset_position_from_current_actuator_position();
+
+        } else if(f[1] == 2) {
+            Planner::planned_block_t b;
+            memcpy(&b.accelerate_until, p, 4);
+            memcpy(&b.decelerate_after, p + 4, 4);
+            memcpy(&b.total_move_ticks, p + 8, 4);
+            memcpy(&b.initial_rate, p + 12, 4);
+            memcpy(&b.maximum_rate, p + 16, 4);
+            memcpy(&b.final_rate, p + 20, 4);
+            memcpy(&b.millimeters, p + 24, 4);
+            memcpy(&b.nominal_speed, p + 28, 4);
+            memcpy(&b.acceleration, p + 32, 4);
+            memcpy(&b.s_value, p + 36, 4);
+            b.g123= p[40] & 1;
+            p += USBSERIAL_PLANNED_SIZE;
+            for (uint8_t m = 0; m < k_max_actuators; m++) {
+                b.steps[m]= 0;
+                if(!(f[2] & (1 << m))) continue;
+                memcpy(&b.steps[m], p, 4);
+                p += 4;
+            }
+            if(!THEKERNEL->planner->append_planned_block(b, THEROBOT->get_number_registered_motors())) break;
+            THEKERNEL->call_event(ON_MAIN_LOOP);
+            THEKERNEL->call_event(ON_IDLE);
+        }
+        ++n;
+    }
+    bool ok= feof(fp) || c == EOF;
+    fclose(fp);
+    return ok ? n : -1;
+}
+
+static double host_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// prints the results as "key: value" lines, or as one line of JSON when it has a file
+// only as much JSON as the report needs, the names and strings never need escaping
+struct report {
+    FILE *json;
+    bool first;
+    int depth;
+
+    void key(const char *k)
+    {
+        if(json != nullptr) {
+            fprintf(json, "%s\"%s\":", first ? "" : ",", k);
+        } else {
+            printf("%*s%s:", depth * 2, "", k);
+        }
+        first= false;
+    }
+    void item()
+    {
+        if(json != nullptr) fprintf(json, "%s", first ? "" : ",");
+        else printf(" ");
+        first= false;
+    }
+    void text(const char *k, const char *v) { key(k); if(json != nullptr) fprintf(json, "\"%s\"", v); else printf(" %s\n", v); }
+    void integer(const char *k, uint64_t v) { key(k); if(json != nullptr) fprintf(json, "%llu", (unsigned long long)v); else printf(" %llu\n", (unsigned long long)v); }
+    void number(const char *k, double v) { key(k); if(json != nullptr) fprintf(json, "%1.6g", v); else printf(" %1.6g\n", v); }
+    void begin() { first= true; depth= 0; if(json != nullptr) fprintf(json, "{"); }
+    void end() { if(json != nullptr) fprintf(json, "}\n"); }
+    void begin_object(const char *k) { key(k); if(json != nullptr) fprintf(json, "{"); else printf("\n"); first= true; ++depth; }
+    void end_object() { if(json != nullptr) fprintf(json, "}"); first= false; --depth; }
+    void begin_list(const char *k) { key(k); if(json != nullptr) fprintf(json, "["); first= true; }
+    void end_list() { if(json != nullptr) fprintf(json, "]"); else printf("\n"); first= false; }
+    void list_text(const char *v) { item(); if(json != nullptr) fprintf(json, "\"%s\"", v); else printf("%s", v); }
+    void list_integer(int64_t v) { item(); if(json != nullptr) fprintf(json, "%lld", (long long)v); else printf("%lld", (long long)v); }
+    void list_number(double v) { item(); if(json != nullptr) fprintf(json, "%1.6g", v); else printf("%1.6g", v); }
+};
+
+static void usage()
+{
+    fprintf(stderr, "usage: motionsim -c config [-i idle_us] [-v] [-f] [-j] [-n name] [-p plan.bin] file.gcode...\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *config_file= nullptr;
+    uint32_t idle_us= 100;
+    bool verbose= false;
+    bool verify= false;
+    bool json= false;
+    const char *name= "";
+    const char *plan_file= nullptr;
+    const char *run_file= nullptr;
+
+    int c;
+    while((c= getopt(argc, argv, "c:i:vfjn:p:r:")) != -1) {
+        switch(c) {
+            case 'c': config_file= optarg; break;
+            case 'i': idle_us= strtoul(optarg, nullptr, 10); break;
+            case 'v': verbose= true; break;
+            case 'f': verify= true; break;
+            case 'j': json= true; break;
+            case 'n': name= optarg; break;
+            case 'p': plan_file= optarg; break;
+            case 'r': run_file= optarg; break;
+            default: usage();
+        }
+    }
+    if(config_file == nullptr || (optind >= argc) == (run_file == nullptr)) usage();
+
+    if(!read_file(config_file, host_config)) {
+        fprintf(stderr, "can not read %s\n", config_file);
+        return 1;
+    }
+
+    MotionSimulator *sim= new MotionSimulator();
+    new Kernel();
+    THEKERNEL->add_module(sim);
+    sim->set_idle_time(idle_us);
+    StepVerifier *verifier= verify ? new StepVerifier(sim, StepTicker::getInstance()->get_frequency()) : nullptr;
+    PlanWriter *plan= nullptr;
+    if(plan_file != nullptr) {
+        FILE *fp= fopen(plan_file, "wb");
+        if(fp == nullptr) {
+            fprintf(stderr, "can not write %s\n", plan_file);
+            return 1;
+        }
+        plan= new PlanWriter(sim, fp, StepTicker::getInstance()->get_frequency());
+    }
+
+    ReplyStream replies(verbose);
+    uint32_t lines= 0;
+    double start= host_seconds();
+
+    if(run_file != nullptr) {
+        int n= run_plan(run_file);
+        if(n < 0) {
+            fprintf(stderr, "%s is not a plan for this config\n", run_file);
+            return 1;
+        }
+        lines= n;
+    }
+
+    for (int i = optind; i < argc; ++i) {
+        FILE *fp= fopen(argv[i], "r");
+        if(fp == nullptr) {
+            fprintf(stderr, "can not read %s\n", argv[i]);
+            return 1;
+        }
+
+        // the same loop as main(), a line then the main loop and idle events
+        char buf[256];
+        while(fgets(buf, sizeof(buf), fp) != nullptr) {
+            size_t n= strcspn(buf, "\r\n");
+            buf[n]= '\0';
+            SerialMessage message;
+            message.message= buf;
+            message.stream= &replies;
+            THEKERNEL->call_event(ON_CONSOLE_LINE_RECEIVED, &message);
+            THEKERNEL->call_event(ON_MAIN_LOOP);
+            THEKERNEL->call_event(ON_IDLE);
+            ++lines;
+        }
+        fclose(fp);
+    }
+
+    THECONVEYOR->wait_for_idle();
+    double elapsed= host_seconds() - start;
+    if(verifier != nullptr) verifier->finish();
+    if(plan != nullptr) plan->finish();
+
+    report r{json ? stdout : nullptr};
+    r.begin();
+    if(json || *name) r.text("name", name);
+    r.text("config", config_file);
+    r.begin_list("gcode");
+    for (int i = optind; i < argc; ++i) r.list_text(argv[i]);
+    if(run_file != nullptr) r.list_text(run_file);
+    r.end_list();
+    r.integer("lines", lines);
+    r.integer("errors", replies.errors);
+    r.number("motion_seconds", sim->get_seconds());
+    r.number("first_step_seconds", sim->get_stats().first_step_us / 1e6);
+    r.number("host_seconds", elapsed);
+
+    // what the main loop gets through, the time the simulated step interrupts took is not counted
+    const MotionSimulator::stats_t& stats= sim->get_stats();
+    double main_seconds= elapsed - (stats.isr_ns + stats.secondary_ns) / 1e9;
+    uint64_t segments= Probe::append_block.calls;
+    r.integer("segments", segments);
+    r.number("segments_per_second", main_seconds > 0 ? segments / main_seconds : 0);
+    for (Probe *p : {&Probe::append_block, &Probe::calculate_trapezoid, &Probe::update_trapezoid}) {
+        r.begin_object(p->name);
+        r.integer("calls", p->calls);
+        r.number("ns_per_call", p->calls == 0 ? 0 : (double)p->total_ns / p->calls);
+        r.number("per_second", p->total_ns == 0 ? 0 : p->calls * 1e9 / p->total_ns);
+        r.end_object();
+    }
+
+    r.begin_object("step_tick");
+    r.integer("ticks", stats.ticks);
+    r.integer("busy_ticks", stats.busy_ticks);
+    r.integer("steps", stats.steps);
+    r.number("ns_per_busy_tick", stats.busy_ticks == 0 ? 0 : (double)stats.isr_ns / stats.busy_ticks);
+    r.integer("secondary_ticks", stats.secondary_ticks);
+    r.number("ns_per_secondary_tick", stats.secondary_ticks == 0 ? 0 : (double)stats.secondary_ns / stats.secondary_ticks);
+    // the cost of a tick by how many motors were moving in it, the difference between them is the cost per motor
+    r.begin_list("ns_by_moving_motors");
+    for (size_t i = 0; i <= k_max_actuators; ++i) r.list_number(stats.motor_ticks[i] == 0 ? 0 : (double)stats.motor_ns[i] / stats.motor_ticks[i]);
+    r.end_list();
+    r.begin_list("ticks_by_moving_motors");
+    for (size_t i = 0; i <= k_max_actuators; ++i) r.list_integer(stats.motor_ticks[i]);
+    r.end_list();
+    r.end_object();
+
+    // in virtual time, so a parser that is too slow only shows here as far as -i makes it
+    Conveyor::stats_t q= THECONVEYOR->get_stats();
+    r.begin_object("queue");
+    r.integer("blocks", q.blocks);
+    r.integer("min_depth", q.blocks == 0 ? 0 : q.min_depth);
+    r.number("avg_depth", q.blocks == 0 ? 0 : (double)q.depth_sum / q.blocks);
+    r.integer("underruns", q.underruns);
+    r.number("starved_seconds", q.starved_us / 1e6);
+    r.end_object();
+
+    if(verifier != nullptr) {
+        // the timings above include the checking
+        size_t n= THEROBOT->actuators.size();
+        r.begin_object("fidelity");
+        r.integer("blocks", verifier->get_blocks());
+        r.integer("skipped_blocks", verifier->get_skipped_blocks());
+        r.begin_list("position_error_steps");
+        for (size_t i = 0; i < n; ++i) r.list_number(verifier->get_result(i).position_error);
+        r.end_list();
+        r.begin_list("timing_error_us");
+        for (size_t i = 0; i < n; ++i) r.list_number(verifier->get_result(i).timing_error_us);
+        r.end_list();
+        r.begin_list("jitter_us");
+        for (size_t i = 0; i < n; ++i) r.list_number(verifier->get_result(i).jitter_us);
+        r.end_list();
+        r.begin_list("jitter_rms_us");
+        for (size_t i = 0; i < n; ++i) {
+            const StepVerifier::motor_result_t &m= verifier->get_result(i);
+            r.list_number(m.intervals == 0 ? 0 : sqrt(m.jitter_sum_sq / m.intervals));
+        }
+        r.end_list();
+        r.begin_list("planned_junction_mm_s");
+        for (size_t i = 0; i < n; ++i) r.list_number(verifier->get_result(i).planned_junction);
+        r.end_list();
+        r.begin_list("measured_junction_mm_s");
+        for (size_t i = 0; i < n; ++i) r.list_number(verifier->get_result(i).measured_junction);
+        r.end_list();
+        r.begin_list("count_errors");
+        for (size_t i = 0; i < n; ++i) r.list_integer(verifier->get_result(i).count_errors);
+        r.end_list();
+        r.begin_list("direction_errors");
+        for (size_t i = 0; i < n; ++i) r.list_integer(verifier->get_result(i).direction_errors);
+        r.end_list();
+        r.end_object();
+    }
+
+    if(plan != nullptr) {
+        r.begin_object("plan");
+        r.integer("blocks", plan->get_blocks());
+        r.integer("refused", plan->get_refused());
+        r.end_object();
+    }
+
+    r.begin_list("actuator_steps");
+    for (auto a : THEROBOT->actuators) r.list_integer((int32_t)a->get_current_step());
+    r.end_list();
+    r.begin_list("actuator_mm");
+    for (auto a : THEROBOT->actuators) r.list_number(a->get_current_position());
+    r.end_list();
+    r.end();
+
+    if(plan != nullptr && plan->get_refused() > 0) {
+        fprintf(stderr, "%lu s-curve or backlash blocks were left out of %s, the board can not run them as they are\n", (unsigned long)plan->get_refused(), plan_file);
+        return 1;
+    }
+
+    return replies.errors == 0 ? 0 : 1;
+}
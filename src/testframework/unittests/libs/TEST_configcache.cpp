@@ -0,0 +1,37 @@
+#include "ConfigCache.h"
+#include "ConfigValue.h"
+
+#include "easyunit/test.h"
+
+#include <vector>
+
+static void add(ConfigCache &c, uint16_t a, uint16_t b, uint16_t s)
+{
+    uint16_t cs[3]= {a, b, s};
+    c.replace_or_push_back(new ConfigValue(cs));
+}
+
+TEST(ConfigCacheTest,indexed_lookup_and_collect)
+{
+    ConfigCache c;
+    // two modules of family 1 in the config, the second first, with enable (9) and another setting (5)
+    add(c, 1, 20, 9);
+    add(c, 7, 0, 0);
+    add(c, 1, 20, 5);
+    add(c, 1, 10, 9);
+    add(c, 1, 10, 5);
+    c.build_index();
+
+    uint16_t found[3]= {1, 10, 5};
+    ASSERT_TRUE(c.lookup(found) != NULL);
+    uint16_t plain[3]= {7, 0, 0};
+    ASSERT_TRUE(c.lookup(plain) != NULL);
+    uint16_t missing[3]= {1, 30, 5};
+    ASSERT_TRUE(c.lookup(missing) == NULL);
+
+    std::vector<uint16_t> list;
+    c.collect(1, 9, &list);
+    ASSERT_TRUE(list.size() == 2);
+    ASSERT_TRUE(list[0] == 20);
+    ASSERT_TRUE(list[1] == 10);
+}
@@ -0,0 +1,41 @@
+#include "FileTail.h"
+
+#include <string.h>
+
+#include "easyunit/test.h"
+
+TEST(FileTailTest,follows_the_end_of_the_upload)
+{
+    char buf[8];
+
+    ASSERT_TRUE(FileTail::begin("/sd/job.g"));
+    ASSERT_TRUE(!FileTail::begin("/sd/other.g"));
+    ASSERT_TRUE(FileTail::is_writing("/sd/job.g"));
+    ASSERT_TRUE(!FileTail::is_writing("/sd/other.g"));
+
+    // what was written before following is not kept so the card must have it
+    ASSERT_TRUE(!FileTail::write("G1 X1\n", 6));
+    ASSERT_TRUE(FileTail::follow());
+    ASSERT_TRUE(FileTail::read(0, buf, sizeof(buf)) == 0);
+    ASSERT_TRUE(FileTail::write("G1 X2\n", 6));
+    FileTail::synced();
+    ASSERT_EQUALS_V(12, (int)FileTail::get_on_card());
+
+    ASSERT_TRUE(!FileTail::write("G1 X3\n", 6));
+    ASSERT_EQUALS_V(6, (int)FileTail::read(6, buf, 6));
+    ASSERT_TRUE(strncmp(buf, "G1 X2\n", 6) == 0);
+    ASSERT_EQUALS_V(4, (int)FileTail::read(14, buf, sizeof(buf)));
+    ASSERT_TRUE(strncmp(buf, " X3\n", 4) == 0);
+
+    // a follower that falls behind the ring gets nothing from it
+    char big[5000];
+    memset(big, ';', sizeof(big));
+    FileTail::write(big, sizeof(big));
+    ASSERT_TRUE(FileTail::read(6, buf, sizeof(buf)) == 0);
+    ASSERT_EQUALS_V(8, (int)FileTail::read(FileTail::get_written() - 8, buf, sizeof(buf)));
+
+    FileTail::end(false);
+    ASSERT_TRUE(!FileTail::is_writing("/sd/job.g"));
+    ASSERT_TRUE(FileTail::has_failed("/sd/job.g"));
+    FileTail::unfollow();
+}
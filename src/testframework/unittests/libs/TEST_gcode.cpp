@@ -60,3 +60,44 @@ TEST(GCodeTest,subcode)
     ASSERT_EQUALS_DELTA_V(2.3, gc4.get_value('Y'), 0.001);
 
 }
+
+TEST(GCodeTest,letter_table)
+{
+    // a line longer than fits in the object itself
+    Gcode gc1("G1 X10.5 Y-2.25 Z0.3 E123.456789 F3000 A1 B2 C3 S0.5 P12", nullptr);
+    ASSERT_TRUE(gc1.has_g);
+    ASSERT_EQUALS_V(1, gc1.g);
+    ASSERT_TRUE(!gc1.has_letter('G'));
+    ASSERT_TRUE(gc1.has_letter('E'));
+    ASSERT_TRUE(!gc1.has_letter('I'));
+    ASSERT_EQUALS_DELTA_V(10.5, gc1.get_value('X'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(-2.25, gc1.get_value('Y'), 0.0001);
+    ASSERT_EQUALS_DELTA_V(123.456789, gc1.get_value('E'), 0.0001);
+    ASSERT_EQUALS_V(12, gc1.get_int('P'));
+    ASSERT_EQUALS_V(0, gc1.get_value('I'));
+
+    Gcode gc2(gc1);
+    ASSERT_EQUALS_DELTA_V(3000, gc2.get_value('F'), 0.0001);
+    ASSERT_TRUE(strcmp(gc1.get_command(), gc2.get_command()) == 0);
+
+    // a letter with no number is present but has no value, the first one with a number wins
+    Gcode gc3("G28 X Y2 Y3", nullptr);
+    ASSERT_TRUE(gc3.has_letter('X'));
+    ASSERT_EQUALS_V(0, gc3.get_value('X'));
+    ASSERT_EQUALS_DELTA_V(2, gc3.get_value('Y'), 0.0001);
+    ASSERT_EQUALS_V(3, gc3.get_num_args());
+
+    // built from part of a line buffer
+    const char *buf= "M104 S210 M105";
+    Gcode gc4(buf, 9, nullptr);
+    ASSERT_TRUE(gc4.has_m);
+    ASSERT_EQUALS_V(104, gc4.m);
+    ASSERT_EQUALS_V(210, gc4.get_int('S'));
+    ASSERT_TRUE(!gc4.has_letter('M'));
+
+    // not stripped keeps the G and the N
+    Gcode gc5("N10 G1 X1*99", nullptr, false);
+    ASSERT_EQUALS_V(10, gc5.get_int('N'));
+    ASSERT_EQUALS_V(99, gc5.get_value('*'));
+    ASSERT_TRUE(gc5.has_letter('G'));
+}
@@ -0,0 +1,92 @@
+#include "Gcode.h"
+#include "GcodeLines.h"
+#include "CycleCounter.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "easyunit/test.h"
+
+// random lines parse to the code, subcode and values they were made from, and the table every letter is looked up
+// in on construction agrees with scanning the line for it
+TEST(GcodeParserTest,random_lines)
+{
+    uint32_t seed= 12345;
+    for (int n = 0; n < 2000; ++n) {
+        gcode_expect_t e;
+        std::string line= gcode_random_line(seed, e);
+        Gcode gc(line, nullptr);
+
+        ASSERT_TRUE(gc.has_g == e.is_g);
+        ASSERT_TRUE(gc.has_m == !e.is_g);
+        ASSERT_EQUALS_V(e.code, (e.is_g ? gc.g : gc.m));
+        ASSERT_EQUALS_V(e.subcode, gc.subcode);
+        ASSERT_EQUALS_V(e.args, gc.get_num_args());
+
+        for (char c = 'A'; c <= 'Z'; ++c) {
+            if(c == 'G' || c == 'M') continue;
+            bool has= (e.letters & (1 << (c - 'A'))) != 0;
+            ASSERT_TRUE(gc.has_letter(c) == has);
+            if(!has) {
+                ASSERT_TRUE(gc.get_value(c) == 0);
+                continue;
+            }
+            char *p;
+            ASSERT_TRUE(gc.get_value(c) == e.values[c - 'A']);
+            ASSERT_TRUE(gc.get_value(c, &p) == e.values[c - 'A']);
+            ASSERT_TRUE(gc.get_int(c) == (int)e.values[c - 'A']);
+        }
+
+        // a copy parses the same
+        Gcode cp(gc);
+        for (char c = 'A'; c <= 'Z'; ++c) {
+            ASSERT_TRUE(cp.has_letter(c) == gc.has_letter(c));
+            ASSERT_TRUE(cp.get_value(c) == gc.get_value(c));
+        }
+    }
+}
+
+// the line shapes the benchmark times parse the way they read
+TEST(GcodeParserTest,shapes)
+{
+    for (int i = 0; i < gcode_line_shape_count; ++i) {
+        const char *line= gcode_line_shapes[i].line;
+        Gcode gc(line, nullptr);
+        ASSERT_TRUE(gc.has_g == (line[0] == 'G'));
+        ASSERT_TRUE(gc.has_m == (line[0] == 'M'));
+        for (const char *c = gcode_lookup_letters; *c; ++c) {
+            const char *p= strchr(line + 1, *c);
+            ASSERT_TRUE(gc.has_letter(*c) == (p != nullptr));
+            if(p != nullptr) ASSERT_EQUALS_DELTA_V(strtof(p + 1, nullptr), gc.get_value(*c), 0.00001F);
+        }
+    }
+}
+
+// cycles per line to make the Gcode in each shape, and to look up the letters of a move in it
+// printed for comparing one build with another, it asserts nothing
+TEST(GcodeParserTest,cycles_per_line)
+{
+    const int n= 200;
+    cycle_counter_enable();
+    printf("Gcode parser cycles per line, construct and lookup of %s\n", gcode_lookup_letters);
+    for (int i = 0; i < gcode_line_shape_count; ++i) {
+        const char *line= gcode_line_shapes[i].line;
+        size_t len= strlen(line);
+
+        uint32_t construct= 0, lookup= 0;
+        volatile float sum= 0;
+        for (int j = 0; j < n; ++j) {
+            uint32_t t0= cycle_counter_read();
+            Gcode *gc= new Gcode(line, len, nullptr);
+            uint32_t t1= cycle_counter_read();
+            for (const char *c = gcode_lookup_letters; *c; ++c) {
+                if(gc->has_letter(*c)) sum += gc->get_value(*c);
+            }
+            uint32_t t2= cycle_counter_read();
+            delete gc;
+            construct += t1 - t0;
+            lookup += t2 - t1;
+        }
+        printf("  %-8s %6lu %6lu\n", gcode_line_shapes[i].name, construct / n, lookup / n);
+    }
+}
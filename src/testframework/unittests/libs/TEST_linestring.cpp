@@ -0,0 +1,33 @@
+#include "LineString.h"
+
+#include "easyunit/test.h"
+
+#include <string>
+
+TEST(LineStringTest,inline_and_long_lines)
+{
+    LineString s("G1 X10");
+    ASSERT_TRUE(s.size() == 6);
+    ASSERT_TRUE(strcmp(s.c_str(), "G1 X10") == 0);
+
+    s += ' ';
+    s += 'Y';
+    ASSERT_TRUE(std::string(s) == "G1 X10 Y");
+
+    // longer than fits inline, built a character at a time as the consoles do
+    LineString l;
+    std::string expect;
+    for (int i = 0; i < 300; ++i) {
+        l += 'a' + i % 26;
+        expect += 'a' + i % 26;
+    }
+    ASSERT_TRUE(l.size() == 300);
+    ASSERT_TRUE(std::string(l) == expect);
+
+    LineString c(l);
+    ASSERT_TRUE(std::string(c) == expect);
+    c = "ok";
+    ASSERT_TRUE(c.size() == 2 && c[1] == 'k');
+    c.clear();
+    ASSERT_TRUE(c.empty());
+}
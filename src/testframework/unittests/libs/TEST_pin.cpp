@@ -0,0 +1,39 @@
+#include "Pin.h"
+
+#include "InterruptIn.h"
+#include "LPC17xx.h"
+
+#include "easyunit/test.h"
+
+// the two PINMODE bits of a pin, 0 pull up, 2 none, 3 pull down
+static uint32_t pin_mode_bits(const Pin &p)
+{
+    volatile uint32_t *pinmode = &LPC_PINCON->PINMODE0 + (p.port_number * 2) + (p.pin >> 4);
+    return (*pinmode >> ((p.pin & 0x0F) * 2)) & 3;
+}
+
+static uint32_t mode_after_interrupt_pin(const char *config)
+{
+    Pin p;
+    p.from_string(config)->as_input();
+    mbed::InterruptIn *irq = p.interrupt_pin();
+    uint32_t mode = pin_mode_bits(p);
+    delete irq;
+    return mode;
+}
+
+TEST(PinTest,interrupt_pin_keeps_pull_up)
+{
+    ASSERT_TRUE(mode_after_interrupt_pin("2.13^") == 0);
+    ASSERT_TRUE(mode_after_interrupt_pin("0.26^") == 0);
+}
+
+TEST(PinTest,interrupt_pin_keeps_pull_none)
+{
+    ASSERT_TRUE(mode_after_interrupt_pin("2.13-") == 2);
+}
+
+TEST(PinTest,interrupt_pin_keeps_pull_down)
+{
+    ASSERT_TRUE(mode_after_interrupt_pin("2.13v") == 3);
+}
@@ -0,0 +1,25 @@
+#include "SlabPool.h"
+
+#include "easyunit/test.h"
+
+TEST(SlabPoolTest,reuses_blocks_and_falls_back)
+{
+    SlabPool pool("test", 20, 2);
+
+    void *a = pool.alloc(20);
+    void *b = pool.alloc(16);
+    ASSERT_TRUE(a != NULL && b != NULL && a != b);
+
+    // all in use, and too big, both go to malloc
+    void *c = pool.alloc(20);
+    void *d = pool.alloc(64);
+    ASSERT_TRUE(c != NULL && d != NULL);
+
+    pool.dealloc(a);
+    ASSERT_TRUE(pool.alloc(20) == a);
+
+    pool.dealloc(c);
+    pool.dealloc(d);
+    pool.dealloc(b);
+    ASSERT_TRUE(pool.alloc(8) == b);
+}
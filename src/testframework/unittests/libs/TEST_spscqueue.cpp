@@ -0,0 +1,105 @@
+#include "SPSCQueue.h"
+
+#include <string.h>
+
+#include "easyunit/test.h"
+
+TEST(SPSCQueueTest,empty_full)
+{
+    SPSCQueue<int, 4> q;
+    ASSERT_TRUE(q.empty());
+    ASSERT_TRUE(!q.full());
+    ASSERT_TRUE(q.size() == 0);
+    ASSERT_TRUE(q.max_size() == 3);
+
+    ASSERT_TRUE(q.push(1));
+    ASSERT_TRUE(q.push(2));
+    ASSERT_TRUE(q.push(3));
+    ASSERT_TRUE(q.full());
+    ASSERT_TRUE(!q.push(4));
+    ASSERT_TRUE(q.size() == 3);
+    ASSERT_TRUE(q.free() == 0);
+}
+
+TEST(SPSCQueueTest,fifo_order_and_wrap)
+{
+    SPSCQueue<int, 4> q;
+    int v;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(q.push(i));
+        ASSERT_TRUE(q.push(i + 100));
+        ASSERT_TRUE(q.peek() == i);
+        ASSERT_TRUE(q.peek(1) == i + 100);
+        ASSERT_TRUE(q.pop(v));
+        ASSERT_TRUE(v == i);
+        ASSERT_TRUE(q.pop(v));
+        ASSERT_TRUE(v == i + 100);
+    }
+    ASSERT_TRUE(q.empty());
+    ASSERT_TRUE(!q.pop(v));
+}
+
+TEST(SPSCQueueTest,batched)
+{
+    SPSCQueue<char, 8> q;
+    ASSERT_TRUE(q.push("abcdefghij", 10) == 7);
+    ASSERT_TRUE(q.full());
+
+    char buf[8];
+    ASSERT_TRUE(q.pop(buf, 3) == 3);
+    ASSERT_TRUE(buf[0] == 'a' && buf[1] == 'b' && buf[2] == 'c');
+    ASSERT_TRUE(q.size() == 4);
+
+    // wraps around the end of the buffer
+    ASSERT_TRUE(q.push("xyz", 3) == 3);
+    ASSERT_TRUE(q.pop(buf, 8) == 7);
+    ASSERT_TRUE(buf[0] == 'd' && buf[3] == 'g' && buf[4] == 'x' && buf[6] == 'z');
+    ASSERT_TRUE(q.empty());
+
+    q.push('q');
+    q.flush();
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(SPSCQueueTest,spans)
+{
+    SPSCQueue<char, 8> q;
+    const char *r;
+    char *w;
+
+    ASSERT_TRUE(q.read_span(r) == 0);
+    ASSERT_TRUE(q.write_span(w) == 7);
+    memcpy(w, "abcde", 5);
+    q.commit(5);
+    ASSERT_TRUE(q.size() == 5);
+
+    ASSERT_TRUE(q.read_span(r) == 5);
+    ASSERT_TRUE(r[0] == 'a' && r[4] == 'e');
+    q.consume(4);
+
+    // the spans stop at the end of the buffer
+    ASSERT_TRUE(q.write_span(w) == 3);
+    memcpy(w, "fgh", 3);
+    q.commit(3);
+    ASSERT_TRUE(q.write_span(w) == 3);
+    ASSERT_TRUE(q.read_span(r) == 4);
+    ASSERT_TRUE(r[0] == 'e' && r[3] == 'h');
+    q.consume(4);
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(SPSCQueueTest,scan_and_unpush)
+{
+    SPSCQueue<char, 16> q;
+    ASSERT_TRUE(q.find('\n') == q.max_size());
+    ASSERT_TRUE(!q.unpush());
+
+    q.push("G1\nG2\nG3", 8);
+    ASSERT_TRUE(q.count('\n') == 2);
+    ASSERT_TRUE(q.find('\n') == 2);
+    ASSERT_TRUE(q.find('3') == 7);
+
+    ASSERT_TRUE(q.unpush());
+    ASSERT_TRUE(q.size() == 7);
+    ASSERT_TRUE(q.find('3') == q.max_size());
+}
@@ -3,6 +3,7 @@
 #include <vector>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #include "easyunit/test.h"
 
@@ -45,3 +46,41 @@ TEST(UtilsTest,append_parameters)
     ASSERT_TRUE(n == 24);
     ASSERT_TRUE(strcmp(buf, "X1.0000 Y2.0000 Z3.0000 ") == 0);
 }
+
+// the box starts as the end of the arc, as it does in Robot::append_arc()
+static void arc_box(float start_deg, float travel_deg, float lo[2], float hi[2])
+{
+    const float r = 10, d = 3.14159265358979323846F / 180;
+    float end = (start_deg + travel_deg) * d;
+    lo[0] = hi[0] = r * cosf(end);
+    lo[1] = hi[1] = r * sinf(end);
+    arc_extremes(0, 0, r, start_deg * d, travel_deg * d, lo, hi);
+}
+
+TEST(UtilsTest,arc_extremes_past_90_sweeping_over_180)
+{
+    float lo[2], hi[2];
+    // counter clockwise from 162 through 180, 270, 0 and 90 to 102
+    arc_box(162, 300, lo, hi);
+    ASSERT_EQUALS_DELTA_V(-10, lo[0], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(-10, lo[1], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10, hi[0], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10, hi[1], 0.0001F);
+
+    // clockwise from -150 through 180 and 90 to 20, which does not reach 0 or 270
+    arc_box(-150, -190, lo, hi);
+    ASSERT_EQUALS_DELTA_V(-10, lo[0], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(0, lo[1], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10 * cosf(20 * 3.14159265F / 180), hi[0], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10, hi[1], 0.0001F);
+}
+
+TEST(UtilsTest,arc_extremes_within_a_quadrant)
+{
+    float lo[2], hi[2];
+    arc_box(10, 30, lo, hi);
+    ASSERT_EQUALS_DELTA_V(10 * cosf(40 * 3.14159265F / 180), lo[0], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10 * cosf(40 * 3.14159265F / 180), hi[0], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10 * sinf(40 * 3.14159265F / 180), lo[1], 0.0001F);
+    ASSERT_EQUALS_DELTA_V(10 * sinf(40 * 3.14159265F / 180), hi[1], 0.0001F);
+}
@@ -0,0 +1,30 @@
+#include "AtanTable.h"
+
+#include <math.h>
+
+#include "easyunit/test.h"
+
+// a little over the interpolation error to allow for the float rounding
+static const float error= AtanTable::max_error + 1e-6F;
+
+TEST(AtanTableTest,atan)
+{
+    AtanTable t;
+    for (int i = -2000; i <= 2000; ++i) {
+        float x= i / 100.0F;
+        ASSERT_TRUE(fabsf(t.atan(x) - atanf(x)) < error);
+    }
+    ASSERT_TRUE(fabsf(t.atan(INFINITY) - atanf(INFINITY)) < error);
+    ASSERT_TRUE(fabsf(t.atan(-INFINITY) - atanf(-INFINITY)) < error);
+}
+
+TEST(AtanTableTest,atan2_all_quadrants)
+{
+    AtanTable t;
+    for (int i = 0; i < 3600; ++i) {
+        float a= i * 0.1F * 3.14159265F / 180.0F;
+        float y= 150.0F * sinf(a), x= 150.0F * cosf(a);
+        ASSERT_TRUE(fabsf(t.atan2(y, x) - atan2f(y, x)) < error || fabsf(fabsf(t.atan2(y, x)) - 3.14159265F) < error);
+    }
+    ASSERT_TRUE(t.atan2(0, 0) == 0);
+}
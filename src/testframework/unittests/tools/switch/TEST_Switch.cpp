@@ -65,7 +65,7 @@ TESTF(Switch,set_on_off_with_gcode)
     test_kernel_setup_config(switch_config, &switch_config[sizeof(switch_config)]);
 
     // make module load the config
-    ts->on_config_reload(nullptr);
+    ts->load_config();
 
     // make sure switch starts off
     struct pad_switch s;
@@ -0,0 +1,44 @@
+#include "TemperatureHistory.h"
+
+#include "easyunit/test.h"
+
+TEST(TemperatureHistoryTest,newest_first)
+{
+    TemperatureHistory h;
+    ASSERT_TRUE(h.count(0) == 0);
+
+    h.add(20.0F, 0, 0);
+    h.add(21.5F, 200.0F, 255);
+    ASSERT_TRUE(h.count(0) == 2);
+    ASSERT_TRUE(h.get(0, 0).actual == 215);
+    ASSERT_TRUE(h.get(0, 0).target == 2000);
+    ASSERT_TRUE(h.get(0, 0).pwm == 255);
+    ASSERT_TRUE(h.get(0, 1).actual == 200);
+    ASSERT_TRUE(h.get(0, 1).target == 0);
+}
+
+TEST(TemperatureHistoryTest,downsampled)
+{
+    TemperatureHistory h;
+    // ten seconds at 200 with one spike, then another ten at 210
+    for (int i = 0; i < 10; ++i) h.add(i == 4 ? 230.0F : 200.0F, 200.0F, i < 5 ? 100 : 50);
+    ASSERT_TRUE(h.count(1) == 1);
+    ASSERT_TRUE(h.get(1, 0).actual == 2300);
+    ASSERT_TRUE(h.get(1, 0).target == 2000);
+    ASSERT_TRUE(h.get(1, 0).pwm == 75);
+
+    for (int i = 0; i < 50; ++i) h.add(210.0F, 210.0F, 10);
+    ASSERT_TRUE(h.count(1) == 6);
+    ASSERT_TRUE(h.count(2) == 1);
+    ASSERT_TRUE(h.get(2, 0).actual == 2300);
+    ASSERT_TRUE(h.get(1, 0).actual == 2100);
+}
+
+TEST(TemperatureHistoryTest,wraps)
+{
+    TemperatureHistory h;
+    for (int i = 0; i < TemperatureHistory::size + 5; ++i) h.add(i, 0, 0);
+    ASSERT_TRUE(h.count(0) == TemperatureHistory::size);
+    ASSERT_TRUE(h.get(0, 0).actual == (TemperatureHistory::size + 4) * 10);
+    ASSERT_TRUE(h.get(0, TemperatureHistory::size - 1).actual == 50);
+}
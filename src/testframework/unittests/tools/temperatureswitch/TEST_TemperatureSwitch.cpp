@@ -62,55 +62,37 @@ temperatureswitch.psu_off.cooldown_poll 5 \n\
 ";
 
 // handle mock call to temperature control
-// simulates one temperature control with T designator and id of 123
-static void on_get_public_data_tc1(void *argument)
+// simulates one temperature control with T designator taking the watch
+static struct pad_temperature_watch *watch= nullptr;
+static void on_set_public_data_tc1(void *argument)
 {
     PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
 
     if(!pdr->starts_with(temperature_control_checksum)) return;
-    if(!pdr->second_element_is(poll_controls_checksum)) return;
+    if(!pdr->second_element_is(watch_temperature_checksum)) return;
 
-    std::vector<struct pad_temperature> *v= static_cast<std::vector<pad_temperature>*>(pdr->get_data_ptr());
+    struct pad_temperature_watch *w= static_cast<pad_temperature_watch*>(pdr->get_data_ptr());
+    if(w->designator != 'T') return;
 
-    struct pad_temperature t;
-    // setup data
-    t.designator= "T";
-    t.id= 123;
-    v->push_back(t);
+    w->controllers++;
+    watch= w;
     pdr->set_taken();
 }
 
-// Handle temperature request and switch status request
+// Handle switch status request
 static bool switch_state;
 static bool switch_get_hit= false;
-static int hitcnt= 0;
-static float return_current_temp= 0;
 static void on_get_public_data_tc2(void *argument)
 {
     PublicDataRequest *pdr = static_cast<PublicDataRequest *>(argument);
 
-    if(pdr->starts_with(temperature_control_checksum)) {
-        // return a current temperature of return_current_temp when requested
-        if(!pdr->second_element_is(current_temperature_checksum)) return;
-        if(!pdr->third_element_is(123)) return;
-
-        hitcnt++;
-
-        struct pad_temperature *t= static_cast<pad_temperature*>(pdr->get_data_ptr());
-        t->current_temperature = return_current_temp;
-        t->target_temperature = 0;
-        t->pwm = 0;
-        t->designator= "T";
-        t->id= 123;
-        pdr->set_taken();
-
-    } else if(pdr->starts_with(switch_checksum)){
+    if(pdr->starts_with(switch_checksum)){
         // return status of the fan switch
         if(!pdr->second_element_is(get_checksum("fan"))) return;
 
         switch_get_hit= true;
 
-        static struct pad_switch *pad= static_cast<pad_switch*>(pdr->get_data_ptr());;
+        struct pad_switch *pad= static_cast<pad_switch*>(pdr->get_data_ptr());
         pad->name = get_checksum("fan");
         pad->state = switch_state;
         pad->value = 0;
@@ -135,21 +117,63 @@ static void on_set_public_data_switch(void *argument)
     pdr->set_taken();
 }
 
-// stimulates the module with on_second ticks in which it asks for a temperature which we simulate above
+// updates the watch as the temperature control would on a reading, then lets the module see it after the 5 second hold
 static bool set_temp(TemperatureSwitch *nts, float t)
 {
-    // trap public data request to TemperatureControl and return a temperature
-    hitcnt= 0;
-    return_current_temp= t;
+    if(watch == nullptr) return false;
+
+    // trap public data request to the switch
     test_kernel_trap_event(ON_GET_PUBLIC_DATA, on_get_public_data_tc2);
 
+    if(t >= watch->threshold) watch->above |= 1;
+    else watch->above &= ~1;
+
     // tick 5 times for 5 seconds
     for (int i = 0; i < 5; ++i) {
         nts->on_second_tick(nullptr);
+        nts->on_idle(nullptr);
     }
 
-    // make sure the temp was read at least once
-    return (hitcnt > 0);
+    return true;
+}
+
+// until the hold is over a crossing is not acted on
+TESTF(TemperatureSwitch,level_hold)
+{
+    test_kernel_setup_config(level_config, &level_config[sizeof(level_config)]);
+    watch= nullptr;
+    test_kernel_trap_event(ON_SET_PUBLIC_DATA, on_set_public_data_tc1);
+
+    uint16_t cs= get_checksum("psu_off");
+    std::unique_ptr<TemperatureSwitch> nts(ts->load_config(cs));
+    if(nts.get() == nullptr) {
+        FAIL_M("load config failed");
+    }
+    ASSERT_TRUE(THEKERNEL->kernel_has_event(ON_IDLE, nts.get()));
+
+    // goes low at once
+    ASSERT_TRUE(set_temp(nts.get(), 25));
+
+    switch_state= false;
+    test_kernel_trap_event(ON_SET_PUBLIC_DATA, on_set_public_data_switch);
+    test_kernel_trap_event(ON_GET_PUBLIC_DATA, on_get_public_data_tc2);
+
+    // and switches on as soon as it is seen once the heatup poll time is over
+    nts->on_second_tick(nullptr);
+    watch->above= 1;
+    nts->on_idle(nullptr);
+    ASSERT_TRUE(switch_state);
+
+    // but holds high for the cooldown poll time
+    watch->above= 0;
+    nts->on_idle(nullptr);
+    ASSERT_TRUE(switch_state);
+    for (int i = 0; i < 4; ++i) nts->on_second_tick(nullptr);
+    nts->on_idle(nullptr);
+    ASSERT_TRUE(switch_state);
+    nts->on_second_tick(nullptr);
+    nts->on_idle(nullptr);
+    ASSERT_TRUE(!switch_state);
 }
 
 TESTF(TemperatureSwitch,level_low_high)
@@ -158,7 +182,8 @@ TESTF(TemperatureSwitch,level_low_high)
     test_kernel_setup_config(level_config, &level_config[sizeof(level_config)]);
 
     // trap public data request to TemperatureControl and return a mock tempcontrol
-    test_kernel_trap_event(ON_GET_PUBLIC_DATA, on_get_public_data_tc1);
+    watch= nullptr;
+    test_kernel_trap_event(ON_SET_PUBLIC_DATA, on_set_public_data_tc1);
 
     // make module load the config
     uint16_t cs= get_checksum("psu_off");
@@ -169,10 +194,10 @@ TESTF(TemperatureSwitch,level_low_high)
     }
 
     // stop handling this event
-    test_kernel_untrap_event(ON_GET_PUBLIC_DATA);
+    test_kernel_untrap_event(ON_SET_PUBLIC_DATA);
 
     // test it registered the event
-    ASSERT_TRUE(THEKERNEL->kernel_has_event(ON_GCODE_RECEIVED, nts.get()));
+    ASSERT_TRUE(THEKERNEL->kernel_has_event(ON_IDLE, nts.get()));
 
     // set the first temperature
     ASSERT_TRUE(set_temp(nts.get(), 25));
@@ -206,7 +231,8 @@ TESTF(TemperatureSwitch,edge_high_low)
     test_kernel_setup_config(edge_low_config, &edge_low_config[sizeof(edge_low_config)]);
 
     // trap public data request to TemperatureControl and return a mock tempcontrol
-    test_kernel_trap_event(ON_GET_PUBLIC_DATA, on_get_public_data_tc1);
+    watch= nullptr;
+    test_kernel_trap_event(ON_SET_PUBLIC_DATA, on_set_public_data_tc1);
 
     // make module load the config
     uint16_t cs= get_checksum("psu_off");
@@ -217,7 +243,7 @@ TESTF(TemperatureSwitch,edge_high_low)
     }
 
     // stop handling this event
-    test_kernel_untrap_event(ON_GET_PUBLIC_DATA);
+    test_kernel_untrap_event(ON_SET_PUBLIC_DATA);
 
     // test it registered the event
     ASSERT_TRUE(THEKERNEL->kernel_has_event(ON_GCODE_RECEIVED, nts.get()));
@@ -0,0 +1,74 @@
+#include "BilinearGrid.h"
+
+#include "platform_memory.h"
+
+#include <math.h>
+
+#include "easyunit/test.h"
+
+// z = a + bx + cy + dxy is reproduced exactly by bilinear interpolation, whatever the cells
+static float bed(float x, float y)
+{
+    return 0.1F + 0.002F * x - 0.001F * y + 0.00001F * x * y;
+}
+
+static void fill(float *grid, int nx, int ny, float x_size, float y_size)
+{
+    for (int y = 0; y < ny; y++) {
+        for (int x = 0; x < nx; x++) {
+            grid[x + (y * nx)] = bed(x * x_size / (nx - 1), y * y_size / (ny - 1));
+        }
+    }
+}
+
+TEST(BilinearGrid,matches_the_grid)
+{
+    float grid[5 * 4];
+    fill(grid, 5, 4, 200, 150);
+    BilinearGrid c;
+    c.allocate(5 * 4);
+    c.build(grid, 5, 4, 0, 0, 200, 150);
+    for (float x = 0; x <= 200; x += 12.5F) {
+        for (float y = 0; y <= 150; y += 12.5F) {
+            ASSERT_EQUALS_DELTA_V(bed(x, y), c.get_offset(x, y), 0.0001F);
+        }
+    }
+    // outside it gets the closest point on the edge
+    ASSERT_EQUALS_DELTA_V(bed(0, 150), c.get_offset(-20, 170), 0.0001F);
+}
+
+TEST(BilinearGrid,fits_a_reshaped_grid)
+{
+    // allocated for 2 by 10, which is 9 cells, then probed as 4 by 5, which is 12
+    float grid[4 * 5];
+    fill(grid, 4, 5, 100, 100);
+    BilinearGrid c;
+    c.allocate(2 * 10);
+    c.build(grid, 4, 5, 0, 0, 100, 100);
+    ASSERT_EQUALS_DELTA_V(bed(99, 99), c.get_offset(99, 99), 0.0001F);
+    ASSERT_EQUALS_DELTA_V(bed(37, 81), c.get_offset(37, 81), 0.0001F);
+}
+
+TEST(BilinearGrid,largest_grid_that_fits_in_ahb0)
+{
+    // CartGridStrategy puts the grid in AHB0 first, the largest one that fits there has always loaded, so it still has to
+    // work with no room left for the cells in AHB0
+    uint32_t n = AHB0.largest_free() / sizeof(float);
+    int side = sqrtf(n);
+    if(side > 255) side = 255;
+    ASSERT_TRUE(side >= 2);
+    float *grid = (float *)AHB0.alloc(side * side * sizeof(float));
+    ASSERT_TRUE(grid != nullptr);
+    fill(grid, side, side, 300, 300);
+
+    BilinearGrid *c = new BilinearGrid;
+    c->allocate(side * side);
+    c->build(grid, side, side, 0, 0, 300, 300);
+    for (float x = 0; x <= 300; x += 37.5F) {
+        for (float y = 0; y <= 300; y += 37.5F) {
+            ASSERT_EQUALS_DELTA_V(bed(x, y), c->get_offset(x, y), 0.0001F);
+        }
+    }
+    delete c;
+    AHB0.dealloc(grid);
+}
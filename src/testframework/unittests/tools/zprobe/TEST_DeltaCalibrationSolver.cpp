@@ -0,0 +1,90 @@
+#include "DeltaCalibrationSolver.h"
+
+#include <math.h>
+
+#include "easyunit/test.h"
+
+typedef DeltaCalibrationSolver::geometry_t geometry_t;
+
+static geometry_t nominal()
+{
+    geometry_t g {250.0F, 124.0F, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+    return g;
+}
+
+// the z the probe touches a flat bed at z 0 of the real delta, with the nozzle at x and y of the one it is set to be
+static float probe(const geometry_t& set, const geometry_t& real, float x, float y)
+{
+    float lo = -20, hi = 20;
+    for (int i = 0; i < 40; ++i) {
+        float z = (lo + hi) / 2, carriage[3];
+        DeltaCalibrationSolver::inverse(set, x, y, z, carriage);
+        if(DeltaCalibrationSolver::forward_z(real, carriage) > 0) hi = z;
+        else lo = z;
+    }
+    return (lo + hi) / 2;
+}
+
+// center, six points around the edge and six half way in
+static void probe_all(DeltaCalibrationSolver& solver, const geometry_t& set, const geometry_t& real, float radius)
+{
+    solver.add_point(0, 0, probe(set, real, 0, 0));
+    for (int i = 0; i < 12; ++i) {
+        float a = i * 60.0F * 3.14159265F / 180.0F, r = i < 6 ? radius : radius / 2;
+        solver.add_point(r * cosf(a), r * sinf(a), probe(set, real, r * cosf(a), r * sinf(a)));
+    }
+}
+
+TEST(DeltaCalibrationSolver,forward_inverse)
+{
+    geometry_t g = nominal();
+    g.tower_angle[1] = 0.5F;
+    g.trim[2] = -1.0F;
+    for (float x = -80; x <= 80; x += 40) {
+        for (float y = -80; y <= 80; y += 40) {
+            float carriage[3];
+            DeltaCalibrationSolver::inverse(g, x, y, 3.0F, carriage);
+            ASSERT_EQUALS_DELTA_V(3.0F, DeltaCalibrationSolver::forward_z(g, carriage), 0.001F);
+        }
+    }
+}
+
+TEST(DeltaCalibrationSolver,six_factors_from_one_set_of_points)
+{
+    geometry_t real = nominal();
+    real.trim[0] = -0.8F;
+    real.trim[1] = -0.2F;
+    real.trim[2] = 0;
+    real.arm_radius = 125.3F;
+    real.tower_angle[0] = 0.4F;
+    real.tower_angle[1] = -0.3F;
+    geometry_t set = nominal();
+
+    DeltaCalibrationSolver solver(set);
+    probe_all(solver, set, real, 100);
+
+    geometry_t result;
+    ASSERT_TRUE(solver.solve(6, result));
+    for (int i = 0; i < 3; ++i) ASSERT_EQUALS_DELTA_V(real.trim[i], result.trim[i], 0.005F);
+    ASSERT_EQUALS_DELTA_V(real.arm_radius, result.arm_radius, 0.01F);
+    ASSERT_EQUALS_DELTA_V(real.tower_angle[0], result.tower_angle[0], 0.01F);
+    ASSERT_EQUALS_DELTA_V(real.tower_angle[1], result.tower_angle[1], 0.01F);
+
+    // probed again with what it found the bed is flat
+    float lo = 1e6F, hi = -1e6F;
+    for (int i = 0; i < 12; ++i) {
+        float a = i * 30.0F * 3.14159265F / 180.0F;
+        float z = probe(result, real, 90 * cosf(a), 90 * sinf(a));
+        lo = fminf(lo, z);
+        hi = fmaxf(hi, z);
+    }
+    ASSERT_TRUE(hi - lo < 0.005F);
+}
+
+TEST(DeltaCalibrationSolver,not_enough_points)
+{
+    geometry_t set = nominal(), result;
+    DeltaCalibrationSolver solver(set);
+    for (int i = 0; i < 5; ++i) solver.add_point(i * 10.0F, 0, 0);
+    ASSERT_TRUE(!solver.solve(6, result));
+}
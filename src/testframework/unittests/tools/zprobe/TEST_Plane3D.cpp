@@ -0,0 +1,45 @@
+#include "Plane3D.h"
+
+#include <math.h>
+
+#include "easyunit/test.h"
+
+TEST(Plane3D,fit_matches_three_points)
+{
+    Vector3 v[3] {Vector3(100, 0, 0.1F), Vector3(200, 200, -0.2F), Vector3(0, 200, 0.05F)};
+    Plane3D three(v[0], v[1], v[2]);
+    Plane3D *fit = Plane3D::fit(v, 3);
+    ASSERT_TRUE(fit != nullptr);
+    for (float x = 0; x <= 200; x += 50) {
+        for (float y = 0; y <= 200; y += 50) {
+            ASSERT_EQUALS_DELTA_V(three.getz(x, y), fit->getz(x, y), 0.0001F);
+        }
+    }
+    delete fit;
+}
+
+TEST(Plane3D,fit_averages_noise)
+{
+    // z = 0.001x - 0.002y + 0.3 with the probes alternately 0.01 high and low
+    Vector3 v[9];
+    int n = 0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            float x = i * 100.0F, y = j * 100.0F;
+            v[n] = Vector3(x, y, 0.001F * x - 0.002F * y + 0.3F + (n % 2 ? 0.01F : -0.01F));
+            ++n;
+        }
+    }
+    Plane3D *fit = Plane3D::fit(v, n);
+    ASSERT_TRUE(fit != nullptr);
+    ASSERT_EQUALS_DELTA_V(0.3F, fit->getz(0, 0), 0.015F);
+    ASSERT_EQUALS_DELTA_V(0.3F + 0.2F - 0.4F, fit->getz(200, 200), 0.015F);
+    delete fit;
+}
+
+TEST(Plane3D,fit_needs_a_plane)
+{
+    Vector3 v[4] {Vector3(0, 0, 0), Vector3(10, 10, 1), Vector3(20, 20, 2), Vector3(30, 30, 0)};
+    ASSERT_TRUE(Plane3D::fit(v, 4) == nullptr);
+    ASSERT_TRUE(Plane3D::fit(v, 2) == nullptr);
+}